@@ -0,0 +1,32 @@
+set(BENCHMARKS_ROOT_DIR "${BHUMAN_PREFIX}/Src/Apps/Benchmarks")
+if(BUILD_DESKTOP)
+  set(BENCHMARKS_OUTPUT_DIR "${OUTPUT_PREFIX}/Build/${PLATFORM}/Benchmarks/$<CONFIG>")
+else()
+  set(BENCHMARKS_OUTPUT_DIR "${OUTPUT_PREFIX}/Build/Linux/Nao/$<CONFIG>")
+endif()
+
+file(GLOB_RECURSE BENCHMARKS_SOURCES CONFIGURE_DEPENDS
+    "${BENCHMARKS_ROOT_DIR}/*.cpp" "${BENCHMARKS_ROOT_DIR}/*.h")
+
+add_executable(Benchmarks${TARGET_SUFFIX} ${BENCHMARKS_SOURCES})
+
+set_property(TARGET Benchmarks${TARGET_SUFFIX} PROPERTY RUNTIME_OUTPUT_DIRECTORY "${BENCHMARKS_OUTPUT_DIR}")
+set_property(TARGET Benchmarks${TARGET_SUFFIX} PROPERTY RUNTIME_OUTPUT_NAME benchmarks)
+set_property(TARGET Benchmarks${TARGET_SUFFIX} PROPERTY FOLDER Apps)
+if(NOT BUILD_DESKTOP)
+  # The robot code is built with the default target, which should not include the benchmarks.
+  set_property(TARGET Benchmarks${TARGET_SUFFIX} PROPERTY EXCLUDE_FROM_ALL ON)
+endif()
+
+target_include_directories(Benchmarks${TARGET_SUFFIX} PRIVATE "${BENCHMARKS_ROOT_DIR}")
+
+target_link_libraries(Benchmarks${TARGET_SUFFIX} PRIVATE B-Human${TARGET_SUFFIX})
+target_link_libraries(Benchmarks${TARGET_SUFFIX} PRIVATE Framework${TARGET_SUFFIX})
+target_link_libraries(Benchmarks${TARGET_SUFFIX} PRIVATE ImageProcessing${TARGET_SUFFIX})
+target_link_libraries(Benchmarks${TARGET_SUFFIX} PRIVATE Math${TARGET_SUFFIX})
+target_link_libraries(Benchmarks${TARGET_SUFFIX} PRIVATE Platform${TARGET_SUFFIX})
+target_link_libraries(Benchmarks${TARGET_SUFFIX} PRIVATE Streaming${TARGET_SUFFIX})
+
+target_link_libraries(Benchmarks${TARGET_SUFFIX} PRIVATE Flags::Default)
+
+source_group(TREE "${BENCHMARKS_ROOT_DIR}" FILES ${BENCHMARKS_SOURCES})
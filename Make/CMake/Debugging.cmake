@@ -6,6 +6,10 @@ set(DEBUGGING_SOURCES
     "${DEBUGGING_ROOT_DIR}/AnnotationManager.h"
     "${DEBUGGING_ROOT_DIR}/ColorRGBA.cpp"
     "${DEBUGGING_ROOT_DIR}/ColorRGBA.h"
+    "${DEBUGGING_ROOT_DIR}/ColumnStream.cpp"
+    "${DEBUGGING_ROOT_DIR}/ColumnStream.h"
+    "${DEBUGGING_ROOT_DIR}/DebugDataSchema.cpp"
+    "${DEBUGGING_ROOT_DIR}/DebugDataSchema.h"
     "${DEBUGGING_ROOT_DIR}/DebugDataStreamer.cpp"
     "${DEBUGGING_ROOT_DIR}/DebugDataStreamer.h"
     "${DEBUGGING_ROOT_DIR}/DebugDataTable.cpp"
@@ -23,7 +27,9 @@ set(DEBUGGING_SOURCES
     "${DEBUGGING_ROOT_DIR}/TcpConnection.cpp"
     "${DEBUGGING_ROOT_DIR}/TcpConnection.h"
     "${DEBUGGING_ROOT_DIR}/TimingManager.cpp"
-    "${DEBUGGING_ROOT_DIR}/TimingManager.h")
+    "${DEBUGGING_ROOT_DIR}/TimingManager.h"
+    "${DEBUGGING_ROOT_DIR}/Tracer.cpp"
+    "${DEBUGGING_ROOT_DIR}/Tracer.h")
 
 add_library(Debugging${TARGET_SUFFIX} OBJECT ${DEBUGGING_SOURCES})
 target_sources(Debugging${TARGET_SUFFIX} INTERFACE $<TARGET_OBJECTS:ImageProcessing${TARGET_SUFFIX}> $<TARGET_OBJECTS:Math${TARGET_SUFFIX}> $<TARGET_OBJECTS:Network${TARGET_SUFFIX}> $<TARGET_OBJECTS:Platform${TARGET_SUFFIX}> $<TARGET_OBJECTS:RobotParts${TARGET_SUFFIX}> $<TARGET_OBJECTS:Streaming${TARGET_SUFFIX}>)
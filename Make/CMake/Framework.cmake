@@ -10,8 +10,12 @@ set(FRAMEWORK_SOURCES
     "${FRAMEWORK_ROOT_DIR}/DebugHandler.h"
     "${FRAMEWORK_ROOT_DIR}/Communication.cpp"
     "${FRAMEWORK_ROOT_DIR}/Communication.h"
+    "${FRAMEWORK_ROOT_DIR}/FrameArena.cpp"
+    "${FRAMEWORK_ROOT_DIR}/FrameArena.h"
     "${FRAMEWORK_ROOT_DIR}/FrameExecutionUnit.cpp"
     "${FRAMEWORK_ROOT_DIR}/FrameExecutionUnit.h"
+    "${FRAMEWORK_ROOT_DIR}/LogStreamServer.cpp"
+    "${FRAMEWORK_ROOT_DIR}/LogStreamServer.h"
     "${FRAMEWORK_ROOT_DIR}/Logger.cpp"
     "${FRAMEWORK_ROOT_DIR}/Logger.h"
     "${FRAMEWORK_ROOT_DIR}/LoggingTools.cpp"
@@ -26,10 +30,16 @@ set(FRAMEWORK_SOURCES
     "${FRAMEWORK_ROOT_DIR}/ModuleGraphRunner.h"
     "${FRAMEWORK_ROOT_DIR}/ModulePacket.h"
     "${FRAMEWORK_ROOT_DIR}/Next.h"
+    "${FRAMEWORK_ROOT_DIR}/ParallelExecutor.cpp"
+    "${FRAMEWORK_ROOT_DIR}/ParallelExecutor.h"
     "${FRAMEWORK_ROOT_DIR}/Robot.cpp"
     "${FRAMEWORK_ROOT_DIR}/Robot.h"
     "${FRAMEWORK_ROOT_DIR}/Settings.cpp"
     "${FRAMEWORK_ROOT_DIR}/Settings.h"
+    "${FRAMEWORK_ROOT_DIR}/SharedLogRing.cpp"
+    "${FRAMEWORK_ROOT_DIR}/SharedLogRing.h"
+    "${FRAMEWORK_ROOT_DIR}/StartupTrace.cpp"
+    "${FRAMEWORK_ROOT_DIR}/StartupTrace.h"
     "${FRAMEWORK_ROOT_DIR}/ThreadFrame.cpp"
     "${FRAMEWORK_ROOT_DIR}/ThreadFrame.h")
 
@@ -33,6 +33,8 @@ set(IMAGEPROCESSING_SOURCES
     "${IMAGEPROCESSING_ROOT_DIR}/Resize.cpp"
     "${IMAGEPROCESSING_ROOT_DIR}/Resize.h"
     "${IMAGEPROCESSING_ROOT_DIR}/SIMD.h"
+    "${IMAGEPROCESSING_ROOT_DIR}/ScanLineSmoothing.cpp"
+    "${IMAGEPROCESSING_ROOT_DIR}/ScanLineSmoothing.h"
     "${IMAGEPROCESSING_ROOT_DIR}/Sobel.cpp"
     "${IMAGEPROCESSING_ROOT_DIR}/Sobel.h"
     "${IMAGEPROCESSING_ROOT_DIR}/YHSColorConversion.h")
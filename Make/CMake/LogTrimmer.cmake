@@ -0,0 +1,24 @@
+set(LOG_TRIMMER_ROOT_DIR "${BHUMAN_PREFIX}/Src/Apps/LogTrimmer")
+set(LOG_TRIMMER_OUTPUT_DIR "${OUTPUT_PREFIX}/Build/${PLATFORM}/LogTrimmer/$<CONFIG>")
+
+file(GLOB_RECURSE LOG_TRIMMER_SOURCES CONFIGURE_DEPENDS
+    "${LOG_TRIMMER_ROOT_DIR}/*.cpp" "${LOG_TRIMMER_ROOT_DIR}/*.h")
+
+set(LOG_TRIMMER_TREE "${LOG_TRIMMER_SOURCES}")
+
+add_executable(LogTrimmer EXCLUDE_FROM_ALL ${LOG_TRIMMER_SOURCES})
+
+set_property(TARGET LogTrimmer PROPERTY RUNTIME_OUTPUT_DIRECTORY "${LOG_TRIMMER_OUTPUT_DIR}")
+set_property(TARGET LogTrimmer PROPERTY FOLDER Apps)
+# This is not quite the nice way.
+set_property(TARGET LogTrimmer PROPERTY XCODE_ATTRIBUTE_LD_RUNPATH_SEARCH_PATHS "@executable_path/../../../../Util/onnxruntime/lib/${PLATFORM}")
+
+target_include_directories(LogTrimmer PRIVATE "${LOG_TRIMMER_ROOT_DIR}")
+
+target_link_libraries(LogTrimmer PRIVATE B-Human)
+target_link_libraries(LogTrimmer PRIVATE Framework)
+target_link_libraries(LogTrimmer PRIVATE Streaming)
+target_link_libraries(LogTrimmer PRIVATE snappy::snappy)
+target_link_libraries(LogTrimmer PRIVATE Flags::Default)
+
+source_group(TREE "${LOG_TRIMMER_ROOT_DIR}" FILES ${LOG_TRIMMER_TREE})
@@ -9,6 +9,7 @@ set(MATH_SOURCES
     "${MATH_ROOT_DIR}/Covariance.h"
     "${MATH_ROOT_DIR}/Deviation.h"
     "${MATH_ROOT_DIR}/Eigen.h"
+    "${MATH_ROOT_DIR}/FastMath.h"
     "${MATH_ROOT_DIR}/GaussNewtonOptimizer.h"
     "${MATH_ROOT_DIR}/Geometry.cpp"
     "${MATH_ROOT_DIR}/Geometry.h"
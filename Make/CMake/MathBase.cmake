@@ -11,6 +11,7 @@ set(MATHBASE_SOURCES
     "${MATHBASE_ROOT_DIR}/Eigen.h"
     "${MATHBASE_ROOT_DIR}/EigenArrayExtensions.h"
     "${MATHBASE_ROOT_DIR}/EigenMatrixBaseExtensions.h"
+    "${MATHBASE_ROOT_DIR}/FastMath.h"
     "${MATHBASE_ROOT_DIR}/GaussNewtonOptimizer.h"
     "${MATHBASE_ROOT_DIR}/LeastSquares.cpp"
     "${MATHBASE_ROOT_DIR}/LeastSquares.h"
@@ -0,0 +1,24 @@
+set(MODULE_BENCHMARK_ROOT_DIR "${BHUMAN_PREFIX}/Src/Apps/ModuleBenchmark")
+set(MODULE_BENCHMARK_OUTPUT_DIR "${OUTPUT_PREFIX}/Build/${PLATFORM}/ModuleBenchmark/$<CONFIG>")
+
+file(GLOB_RECURSE MODULE_BENCHMARK_SOURCES CONFIGURE_DEPENDS
+    "${MODULE_BENCHMARK_ROOT_DIR}/*.cpp" "${MODULE_BENCHMARK_ROOT_DIR}/*.h")
+
+set(MODULE_BENCHMARK_TREE "${MODULE_BENCHMARK_SOURCES}")
+
+add_executable(ModuleBenchmark EXCLUDE_FROM_ALL ${MODULE_BENCHMARK_SOURCES})
+
+set_property(TARGET ModuleBenchmark PROPERTY RUNTIME_OUTPUT_DIRECTORY "${MODULE_BENCHMARK_OUTPUT_DIR}")
+set_property(TARGET ModuleBenchmark PROPERTY FOLDER Apps)
+# This is not quite the nice way.
+set_property(TARGET ModuleBenchmark PROPERTY XCODE_ATTRIBUTE_LD_RUNPATH_SEARCH_PATHS "@executable_path/../../../../Util/onnxruntime/lib/${PLATFORM}")
+
+target_include_directories(ModuleBenchmark PRIVATE "${MODULE_BENCHMARK_ROOT_DIR}")
+
+target_link_libraries(ModuleBenchmark PRIVATE B-Human)
+target_link_libraries(ModuleBenchmark PRIVATE Framework)
+target_link_libraries(ModuleBenchmark PRIVATE Streaming)
+target_link_libraries(ModuleBenchmark PRIVATE snappy::snappy)
+target_link_libraries(ModuleBenchmark PRIVATE Flags::Default)
+
+source_group(TREE "${MODULE_BENCHMARK_ROOT_DIR}" FILES ${MODULE_BENCHMARK_TREE})
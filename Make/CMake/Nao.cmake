@@ -27,6 +27,10 @@ if(BUILD_NAO)
   endif()
 
   target_link_libraries(Nao PRIVATE Flags::Default)
+
+  if(NOT MACOS)
+    include("../CMake/Benchmarks.cmake")
+  endif()
 elseif(WINDOWS)
   set(CMAKE_MSVCIDE_RUN_PATH "%systemroot%\\Sysnative")
   add_custom_target(Nao ALL bash -c "cd Linux/CMake/$<CONFIG>; stdbuf -e0 -oL cmake --build . --target Nao | stdbuf -e0 -oL sed 's@^/mnt/\\([a-z]\\)@\\U\\1:@'"
@@ -11,11 +11,15 @@ set(PLATFORM_SOURCES
     "${PLATFORM_ROOT_DIR}/BHAssert.h"
     "${PLATFORM_ROOT_DIR}/File.cpp"
     "${PLATFORM_ROOT_DIR}/File.h"
+    "${PLATFORM_ROOT_DIR}/FutexSemaphore.cpp"
+    "${PLATFORM_ROOT_DIR}/FutexSemaphore.h"
     "${PLATFORM_ROOT_DIR}/Memory.cpp"
     "${PLATFORM_ROOT_DIR}/Memory.h"
     "${PLATFORM_ROOT_DIR}/MemoryMappedFile.cpp"
     "${PLATFORM_ROOT_DIR}/MemoryMappedFile.h"
     "${PLATFORM_ROOT_DIR}/Semaphore.h"
+    "${PLATFORM_ROOT_DIR}/SharedMemory.cpp"
+    "${PLATFORM_ROOT_DIR}/SharedMemory.h"
     "${PLATFORM_ROOT_DIR}/SystemCall.cpp"
     "${PLATFORM_ROOT_DIR}/SystemCall.h"
     "${PLATFORM_ROOT_DIR}/Thread.h"
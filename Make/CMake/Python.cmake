@@ -10,8 +10,12 @@ if(Python3_FOUND)
   set(PYTHON_OUTPUT_DIR "${OUTPUT_PREFIX}/Build/${PLATFORM}/Python/$<CONFIG>")
 
   set(PYTHON_LOGS_SOURCES
+      "${PYTHON_ROOT_DIR}/Logs/Analyzer.cpp"
+      "${PYTHON_ROOT_DIR}/Logs/Analyzer.h"
       "${PYTHON_ROOT_DIR}/Logs/Frame.cpp"
       "${PYTHON_ROOT_DIR}/Logs/Frame.h"
+      "${PYTHON_ROOT_DIR}/Logs/Lazy.cpp"
+      "${PYTHON_ROOT_DIR}/Logs/Lazy.h"
       "${PYTHON_ROOT_DIR}/Logs/Module.cpp"
       "${PYTHON_ROOT_DIR}/Logs/Log.cpp"
       "${PYTHON_ROOT_DIR}/Logs/Log.h"
@@ -0,0 +1,42 @@
+/**
+ * @file Benchmark.cpp
+ *
+ * This file implements a minimal harness for micro benchmarks.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "Benchmark.h"
+#include <algorithm>
+
+Benchmark::Benchmark(const char* name, Function function) :
+  name(name), function(function)
+{
+  getAll().push_back(this);
+}
+
+std::vector<Benchmark*>& Benchmark::getAll()
+{
+  static std::vector<Benchmark*> benchmarks;
+  return benchmarks;
+}
+
+Benchmark::Result Benchmark::run(double minTime) const
+{
+  static constexpr std::size_t maxIterations = 1000000000;
+
+  std::size_t iterations = 1;
+  while(true)
+  {
+    State state(iterations);
+    function(state);
+    if(state.realTime >= minTime || iterations >= maxIterations)
+      return {name, iterations, state.realTime * 1e9 / static_cast<double>(iterations),
+              state.cpuTime * 1e9 / static_cast<double>(iterations),
+              state.itemsProcessed && state.realTime > 0.0 ? static_cast<double>(state.itemsProcessed) / state.realTime : 0.0};
+
+    // Predict the iterations required, but grow at least by a factor of 2 and at most by a factor of 10.
+    const double factor = state.realTime > 0.0 ? minTime * 1.4 / state.realTime : 10.0;
+    iterations = std::min(maxIterations, static_cast<std::size_t>(static_cast<double>(iterations) * std::clamp(factor, 2.0, 10.0)));
+  }
+}
@@ -0,0 +1,148 @@
+/**
+ * @file Benchmark.h
+ *
+ * This file declares a minimal harness for micro benchmarks. Benchmarks are
+ * functions that are registered with the macro BENCHMARK. Each of them
+ * contains a loop over the state passed, which measures the time of its
+ * body. The number of iterations is determined automatically. The command
+ * line options and the JSON output follow the conventions of Google
+ * Benchmark, so that the results can be compared with the usual tools.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <ctime>
+#include <string>
+#include <vector>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+class Benchmark
+{
+public:
+  /** The state passed to a benchmark. Iterating over it runs the measured loop. */
+  class State
+  {
+  public:
+    /** The iterator of the measured loop. Reaching its end stops the time measurement. */
+    class Iterator
+    {
+      State* state; /**< The state iterated over. */
+      std::size_t remaining; /**< The number of iterations left. */
+
+    public:
+      Iterator(State* state, std::size_t remaining) : state(state), remaining(remaining) {}
+
+      struct [[maybe_unused]] Value {};
+      Value operator*() const {return Value();}
+      Iterator& operator++() {--remaining; return *this;}
+
+      bool operator!=(const Iterator&)
+      {
+        if(remaining)
+          return true;
+        state->stop();
+        return false;
+      }
+    };
+
+  private:
+    std::size_t iterations; /**< The number of iterations of the measured loop. */
+    std::size_t itemsProcessed = 0; /**< The number of items processed in all iterations. 0 if not set. */
+    std::chrono::steady_clock::time_point realStart; /**< The wall clock time when the loop started. */
+    std::clock_t cpuStart = 0; /**< The processor time when the loop started. */
+    double realTime = 0.0; /**< The wall clock time of the whole loop in s. */
+    double cpuTime = 0.0; /**< The processor time of the whole loop in s. */
+
+    /** Stops the time measurement. */
+    void stop()
+    {
+      cpuTime = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+      realTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - realStart).count();
+    }
+
+    friend class Benchmark;
+
+  public:
+    /**
+     * Constructor.
+     * @param iterations The number of iterations of the measured loop.
+     */
+    State(std::size_t iterations) : iterations(iterations) {}
+
+    /** Starts the time measurement. */
+    Iterator begin()
+    {
+      cpuStart = std::clock();
+      realStart = std::chrono::steady_clock::now();
+      return Iterator(this, iterations);
+    }
+
+    Iterator end() {return Iterator(this, 0);}
+
+    /** @return The number of iterations of the measured loop. */
+    std::size_t getIterations() const {return iterations;}
+
+    /**
+     * Sets the number of items processed in all iterations to report a throughput.
+     * @param items The number of items.
+     */
+    void setItemsProcessed(std::size_t items) {itemsProcessed = items;}
+  };
+
+  /** The result of running a benchmark. */
+  struct Result
+  {
+    std::string name; /**< The name of the benchmark. */
+    std::size_t iterations; /**< The number of iterations measured. */
+    double realTime; /**< The wall clock time per iteration in ns. */
+    double cpuTime; /**< The processor time per iteration in ns. */
+    double itemsPerSecond; /**< The number of items processed per second. 0 if not reported. */
+  };
+
+  using Function = void (*)(State& state);
+
+  const char* name; /**< The name of the benchmark. */
+  Function function; /**< The function that implements the benchmark. */
+
+  /**
+   * Constructor. Registers the benchmark.
+   * @param name The name of the benchmark.
+   * @param function The function that implements the benchmark.
+   */
+  Benchmark(const char* name, Function function);
+
+  /** @return All benchmarks registered. */
+  static std::vector<Benchmark*>& getAll();
+
+  /**
+   * Runs the benchmark. The number of iterations is increased until the
+   * measured loop runs at least for the minimum time given.
+   * @param minTime The minimum time of the measurement in s.
+   * @return The result of the measurement.
+   */
+  Result run(double minTime) const;
+};
+
+/**
+ * Prevents the compiler from optimizing away the computation of a value.
+ * @param value The value that must be computed.
+ */
+template<typename T> inline void doNotOptimize(T& value)
+{
+#ifdef _MSC_VER
+  static const void* volatile sink;
+  sink = &value;
+  _ReadWriteBarrier();
+#else
+  asm volatile("" : : "r"(&value) : "memory");
+#endif
+}
+
+/** Registers a function as benchmark. */
+#define BENCHMARK(function) static Benchmark _benchmark##function(#function, function)
@@ -0,0 +1,50 @@
+#include "Benchmark.h"
+#include "Tools/Communication/MsgPack.h"
+#include <iterator>
+#include <vector>
+
+namespace
+{
+  /** Creates a packet that resembles the sensor data sent by LoLA. */
+  std::vector<unsigned char> createPacket()
+  {
+    static const char* keys[] = {"Accelerometer", "Angles", "Battery", "Current", "FSR", "Gyroscope", "Position", "Sonar", "Stiffness", "Temperature", "Touch", "Status"};
+    static const std::size_t sizes[] = {3, 2, 4, 25, 8, 3, 25, 2, 25, 25, 14, 25};
+
+    std::vector<unsigned char> packet(4096);
+    unsigned char* p = packet.data();
+    MsgPack::writeMapHeader(std::size(keys) + 1, p);
+    for(std::size_t i = 0; i < std::size(keys); ++i)
+    {
+      MsgPack::write(keys[i], p);
+      MsgPack::writeArrayHeader(sizes[i], p);
+      for(std::size_t j = 0; j < sizes[i]; ++j)
+        if(i == std::size(keys) - 1)
+          *p++ = static_cast<unsigned char>(j); // positive fixint
+        else
+          MsgPack::write(static_cast<float>(j) * 0.1f, p);
+    }
+    MsgPack::write("RobotConfig", p);
+    MsgPack::writeArrayHeader(4, p);
+    for(const char* value : {"P0000074A04S8C700011", "6.0.0", "P0000073A07S94700017", "6.0.0"})
+      MsgPack::write(value, p);
+    packet.resize(p - packet.data());
+    return packet;
+  }
+
+  void MsgPackParse(Benchmark::State& state)
+  {
+    const std::vector<unsigned char> packet = createPacket();
+    float sum = 0.f;
+    for(auto _ : state)
+    {
+      MsgPack::parse(packet.data(), packet.size(),
+                     [&sum](const std::string&, const unsigned char* value) {sum += MsgPack::readFloat(value);},
+                     [&sum](const std::string&, const unsigned char* value) {sum += *value;},
+                     [&sum](const std::string&, const unsigned char*, size_t size) {sum += static_cast<float>(size);});
+      doNotOptimize(sum);
+    }
+    state.setItemsProcessed(state.getIterations() * packet.size());
+  }
+  BENCHMARK(MsgPackParse);
+}
@@ -0,0 +1,40 @@
+#include "Benchmark.h"
+#include "ImageProcessing/Resize.h"
+#include <random>
+
+namespace
+{
+  void ResizeShrinkY(Benchmark::State& state)
+  {
+    Image<PixelTypes::GrayscaledPixel> image(640, 480);
+    std::mt19937 random(42);
+    for(unsigned int y = 0; y < image.height; ++y)
+      for(unsigned int x = 0; x < image.width; ++x)
+        image[y][x] = static_cast<PixelTypes::GrayscaledPixel>(random());
+    Image<PixelTypes::GrayscaledPixel> shrunk;
+    for(auto _ : state)
+    {
+      Resize::shrinkY(1, image, shrunk);
+      doNotOptimize(shrunk[0][0]);
+    }
+    state.setItemsProcessed(state.getIterations() * image.width * image.height);
+  }
+  BENCHMARK(ResizeShrinkY);
+
+  void ResizeShrinkUV(Benchmark::State& state)
+  {
+    Image<PixelTypes::YUYVPixel> image(320, 480);
+    std::mt19937 random(42);
+    for(unsigned int y = 0; y < image.height; ++y)
+      for(unsigned int x = 0; x < image.width; ++x)
+        image[y][x].color = static_cast<unsigned>(random());
+    Image<unsigned short> shrunk;
+    for(auto _ : state)
+    {
+      Resize::shrinkUV(1, image, shrunk);
+      doNotOptimize(shrunk[0][0]);
+    }
+    state.setItemsProcessed(state.getIterations() * image.width * image.height);
+  }
+  BENCHMARK(ResizeShrinkUV);
+}
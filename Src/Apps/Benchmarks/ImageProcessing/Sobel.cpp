@@ -0,0 +1,24 @@
+#include "Benchmark.h"
+#include "ImageProcessing/Sobel.h"
+#include <random>
+
+namespace
+{
+  void SobelSSE(Benchmark::State& state)
+  {
+    // The source image needs a padding of at least one pixel.
+    Sobel::Image1D image(320, 240, sizeof(Sobel::Image1D::PixelType));
+    std::mt19937 random(42);
+    for(unsigned int y = 0; y < image.height; ++y)
+      for(unsigned int x = 0; x < image.width; ++x)
+        image[y][x] = static_cast<unsigned char>(random());
+    Sobel::SobelImage sobelImage(image.width, image.height);
+    for(auto _ : state)
+    {
+      Sobel::sobelSSE(image, sobelImage);
+      doNotOptimize(sobelImage[0][0]);
+    }
+    state.setItemsProcessed(state.getIterations() * image.width * image.height);
+  }
+  BENCHMARK(SobelSSE);
+}
@@ -0,0 +1,187 @@
+/**
+ * @file Main.cpp
+ *
+ * This file implements the main function of the micro benchmarks. It
+ * understands the following subset of the options of Google Benchmark:
+ * --benchmark_filter=<regex>: Only runs the benchmarks whose names match.
+ * --benchmark_list_tests: Only lists the names of the benchmarks.
+ * --benchmark_min_time=<s>: The minimum time measured per benchmark.
+ * --benchmark_format=<console|json>: The format written to stdout.
+ * --benchmark_out=<file>: Also writes the results to a file.
+ * --benchmark_out_format=<console|json>: The format of that file (default: json).
+ *
+ * @author Thomas Röfer
+ */
+
+#include "Benchmark.h"
+#include "Platform/SystemCall.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <thread>
+
+namespace
+{
+  /**
+   * Writes the results in the console format of Google Benchmark.
+   * @param stream The stream written to.
+   * @param results The results of all benchmarks run.
+   */
+  void writeConsole(std::ostream& stream, const std::vector<Benchmark::Result>& results)
+  {
+    std::size_t nameWidth = 9;
+    for(const Benchmark::Result& result : results)
+      nameWidth = std::max(nameWidth, result.name.size());
+
+    stream << std::left << std::setw(static_cast<int>(nameWidth)) << "Benchmark" << std::right
+           << std::setw(16) << "Time" << std::setw(16) << "CPU" << std::setw(12) << "Iterations" << "\n"
+           << std::string(nameWidth + 44, '-') << "\n";
+    for(const Benchmark::Result& result : results)
+    {
+      stream << std::left << std::setw(static_cast<int>(nameWidth)) << result.name << std::right << std::fixed << std::setprecision(1)
+             << std::setw(13) << result.realTime << " ns" << std::setw(13) << result.cpuTime << " ns"
+             << std::setw(12) << result.iterations;
+      if(result.itemsPerSecond > 0.0)
+        stream << " items_per_second=" << std::setprecision(3) << result.itemsPerSecond / 1e6 << "M/s";
+      stream << "\n";
+    }
+  }
+
+  /**
+   * Writes the results in the JSON format of Google Benchmark.
+   * @param stream The stream written to.
+   * @param results The results of all benchmarks run.
+   * @param executable The name of this program.
+   */
+  void writeJSON(std::ostream& stream, const std::vector<Benchmark::Result>& results, const char* executable)
+  {
+    char date[32];
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    stream << "{\n"
+           << "  \"context\": {\n"
+           << "    \"date\": \"" << date << "\",\n"
+           << "    \"host_name\": \"" << SystemCall::getHostName() << "\",\n"
+           << "    \"executable\": \"" << std::regex_replace(executable, std::regex(R"(\\)"), R"(\\)") << "\",\n"
+           << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+#ifdef NDEBUG
+           << "    \"library_build_type\": \"release\"\n"
+#else
+           << "    \"library_build_type\": \"debug\"\n"
+#endif
+           << "  },\n"
+           << "  \"benchmarks\": [";
+    for(std::size_t i = 0; i < results.size(); ++i)
+    {
+      const Benchmark::Result& result = results[i];
+      stream << (i ? "," : "") << "\n"
+             << "    {\n"
+             << "      \"name\": \"" << result.name << "\",\n"
+             << "      \"run_name\": \"" << result.name << "\",\n"
+             << "      \"run_type\": \"iteration\",\n"
+             << "      \"iterations\": " << result.iterations << ",\n"
+             << std::setprecision(6) << std::defaultfloat
+             << "      \"real_time\": " << result.realTime << ",\n"
+             << "      \"cpu_time\": " << result.cpuTime << ",\n";
+      if(result.itemsPerSecond > 0.0)
+        stream << "      \"items_per_second\": " << result.itemsPerSecond << ",\n";
+      stream << "      \"time_unit\": \"ns\"\n"
+             << "    }";
+    }
+    stream << "\n  ]\n}\n";
+  }
+
+  /**
+   * Returns the value of a command line option.
+   * @param arg The command line argument.
+   * @param name The name of the option including the leading dashes.
+   * @param value The value of the option is returned here.
+   * @return Is the argument the option requested?
+   */
+  bool getOption(const char* arg, const char* name, std::string& value)
+  {
+    const std::size_t length = std::strlen(name);
+    if(std::strncmp(arg, name, length) || arg[length] != '=')
+      return false;
+    value = arg + length + 1;
+    return true;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  std::string filter = ".";
+  std::string format = "console";
+  std::string outFile;
+  std::string outFormat = "json";
+  std::string minTime = "0.5";
+  bool listOnly = false;
+
+  for(int i = 1; i < argc; ++i)
+    if(!std::strcmp(argv[i], "--benchmark_list_tests") || !std::strcmp(argv[i], "--benchmark_list_tests=true"))
+      listOnly = true;
+    else if(!getOption(argv[i], "--benchmark_filter", filter)
+            && !getOption(argv[i], "--benchmark_format", format)
+            && !getOption(argv[i], "--benchmark_out", outFile)
+            && !getOption(argv[i], "--benchmark_out_format", outFormat)
+            && !getOption(argv[i], "--benchmark_min_time", minTime))
+    {
+      std::cerr << "Unknown option " << argv[i] << "\n";
+      return 1;
+    }
+
+  const std::regex regex(filter);
+  std::vector<const Benchmark*> selected;
+  for(const Benchmark* benchmark : Benchmark::getAll())
+    if(std::regex_search(benchmark->name, regex))
+      selected.push_back(benchmark);
+  std::sort(selected.begin(), selected.end(), [](const Benchmark* a, const Benchmark* b) {return std::strcmp(a->name, b->name) < 0;});
+
+  if(listOnly)
+  {
+    for(const Benchmark* benchmark : selected)
+      std::cout << benchmark->name << "\n";
+    return 0;
+  }
+
+  // Google Benchmark accepts the minimum time with and without the unit "s".
+  const double seconds = std::strtod(minTime.c_str(), nullptr);
+  std::vector<Benchmark::Result> results;
+  for(const Benchmark* benchmark : selected)
+    results.push_back(benchmark->run(seconds));
+
+  if(format == "json")
+    writeJSON(std::cout, results, argv[0]);
+  else
+    writeConsole(std::cout, results);
+
+  if(!outFile.empty())
+  {
+    std::ofstream stream(outFile);
+    if(!stream)
+    {
+      std::cerr << "Cannot write " << outFile << "\n";
+      return 1;
+    }
+    if(outFormat == "console")
+      writeConsole(stream, results);
+    else
+      writeJSON(stream, results, argv[0]);
+  }
+  return 0;
+}
+
+SystemCall::Mode SystemCall::getMode()
+{
+#ifdef TARGET_ROBOT
+  return physicalRobot;
+#else
+  return simulatedRobot;
+#endif
+}
@@ -0,0 +1,105 @@
+#include "Benchmark.h"
+#include "Math/Geometry.h"
+#include "Math/BHMath.h"
+#include <algorithm>
+#include <random>
+
+namespace
+{
+  constexpr std::size_t numOfPoints = 256;
+
+  /** The same random points in each benchmark. */
+  std::vector<Vector2f> createPoints()
+  {
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> coordinate(-200.f, 200.f);
+    std::vector<Vector2f> points(numOfPoints);
+    for(Vector2f& point : points)
+      point = Vector2f(coordinate(random), coordinate(random));
+    return points;
+  }
+
+  /** A hexagon, which is about the size of the polygons checked in perception. */
+  Geometry::FixedPolygon<8> createPolygon()
+  {
+    Geometry::FixedPolygon<8> polygon;
+    for(int i = 0; i < 6; ++i)
+      polygon.push_back(Vector2f(120.f, 0.f).rotate(pi2 * static_cast<float>(i) / 6.f));
+    return polygon;
+  }
+
+  void GeometryIsPointInsideConvexPolygon(Benchmark::State& state)
+  {
+    const std::vector<Vector2f> points = createPoints();
+    const Geometry::FixedPolygon<8> polygon = createPolygon();
+    bool inside[numOfPoints];
+    for(auto _ : state)
+    {
+      for(std::size_t i = 0; i < numOfPoints; ++i)
+        inside[i] = Geometry::isPointInsideConvexPolygon(polygon.data(), static_cast<int>(polygon.size()), points[i]);
+      doNotOptimize(inside);
+    }
+    state.setItemsProcessed(state.getIterations() * numOfPoints);
+  }
+  BENCHMARK(GeometryIsPointInsideConvexPolygon);
+
+  void GeometryIsPointInsideConvexPolygonBatch(Benchmark::State& state)
+  {
+    const std::vector<Vector2f> points = createPoints();
+    const Geometry::FixedPolygon<8> polygon = createPolygon();
+    bool inside[numOfPoints];
+    for(auto _ : state)
+    {
+      std::size_t numberInside = Geometry::isPointInsideConvexPolygon(polygon.data(), static_cast<int>(polygon.size()), points.data(), numOfPoints, inside);
+      doNotOptimize(numberInside);
+      doNotOptimize(inside);
+    }
+    state.setItemsProcessed(state.getIterations() * numOfPoints);
+  }
+  BENCHMARK(GeometryIsPointInsideConvexPolygonBatch);
+
+  void GeometryGetDistanceToEdge(Benchmark::State& state)
+  {
+    const std::vector<Vector2f> points = createPoints();
+    const Geometry::Line edge(Vector2f(-50.f, 20.f), Vector2f(100.f, 30.f));
+    float distances[numOfPoints];
+    for(auto _ : state)
+    {
+      for(std::size_t i = 0; i < numOfPoints; ++i)
+        distances[i] = Geometry::getDistanceToEdge(edge, points[i]);
+      doNotOptimize(distances);
+    }
+    state.setItemsProcessed(state.getIterations() * numOfPoints);
+  }
+  BENCHMARK(GeometryGetDistanceToEdge);
+
+  void GeometryGetDistanceToEdgeBatch(Benchmark::State& state)
+  {
+    const std::vector<Vector2f> points = createPoints();
+    const Geometry::Line edge(Vector2f(-50.f, 20.f), Vector2f(100.f, 30.f));
+    float distances[numOfPoints];
+    for(auto _ : state)
+    {
+      Geometry::getDistanceToEdge(edge, points.data(), numOfPoints, distances);
+      doNotOptimize(distances);
+    }
+    state.setItemsProcessed(state.getIterations() * numOfPoints);
+  }
+  BENCHMARK(GeometryGetDistanceToEdgeBatch);
+
+  void GeometryCheckIntersectionOfLinesBatch(Benchmark::State& state)
+  {
+    const std::vector<Vector2f> starts = createPoints();
+    std::vector<Vector2f> ends = starts;
+    std::reverse(ends.begin(), ends.end());
+    bool intersect[numOfPoints];
+    for(auto _ : state)
+    {
+      std::size_t numberIntersecting = Geometry::checkIntersectionOfLines(Vector2f(-100.f, -80.f), Vector2f(90.f, 110.f), starts.data(), ends.data(), numOfPoints, intersect);
+      doNotOptimize(numberIntersecting);
+      doNotOptimize(intersect);
+    }
+    state.setItemsProcessed(state.getIterations() * numOfPoints);
+  }
+  BENCHMARK(GeometryCheckIntersectionOfLinesBatch);
+}
@@ -0,0 +1,51 @@
+#include "Benchmark.h"
+#include "Math/RingBufferWithSum.h"
+#include <random>
+
+namespace
+{
+  constexpr std::size_t numOfValues = 1024;
+
+  /** The same random values in each benchmark. */
+  std::vector<float> createValues()
+  {
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> value(-1.f, 1.f);
+    std::vector<float> values(numOfValues);
+    for(float& v : values)
+      v = value(random);
+    return values;
+  }
+
+  void RingBufferWithSumPushFrontAverage(Benchmark::State& state)
+  {
+    const std::vector<float> values = createValues();
+    RingBufferWithSum<float, 30> buffer;
+    for(auto _ : state)
+    {
+      for(float value : values)
+      {
+        buffer.push_front(value);
+        float average = buffer.average();
+        doNotOptimize(average);
+      }
+    }
+    state.setItemsProcessed(state.getIterations() * numOfValues);
+  }
+  BENCHMARK(RingBufferWithSumPushFrontAverage);
+
+  void RingBufferWithSumMaximum(Benchmark::State& state)
+  {
+    const std::vector<float> values = createValues();
+    RingBufferWithSum<float, 100> buffer;
+    for(std::size_t i = 0; i < 150; ++i)
+      buffer.push_front(values[i]);
+    for(auto _ : state)
+    {
+      float maximum = buffer.maximum();
+      doNotOptimize(maximum);
+    }
+    state.setItemsProcessed(state.getIterations() * buffer.size());
+  }
+  BENCHMARK(RingBufferWithSumMaximum);
+}
@@ -0,0 +1,98 @@
+#include "Benchmark.h"
+#include "Tools/Modeling/UKFPose2DBatch.h"
+#include <random>
+
+namespace
+{
+  /** Makes the state of the filter and its sensor updates accessible. */
+  struct Hypothesis : public UKFPose2D
+  {
+    using UKFPose2D::landmarkSensorUpdate;
+    using UKFPose2D::lineSensorUpdate;
+
+    void set(const Vector3f& mean, const Matrix3f& cov)
+    {
+      this->mean = mean;
+      this->cov = cov;
+    }
+  };
+
+  constexpr std::size_t numOfHypotheses = 12;
+
+  const Pose2f filterProcessDeviation(0.002f, 0.5f, 0.5f);
+  const Pose2f odometryDeviation(0.5f, 0.1f, 0.1f);
+  const Vector2f odometryRotationDeviation(0.0001f, 0.0001f);
+
+  /** Creates hypotheses with random means and plausible covariances. */
+  std::vector<Hypothesis> createHypotheses(std::vector<Pose2f>& odometryOffsets)
+  {
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> position(-4500.f, 4500.f);
+    std::uniform_real_distribution<float> angle(-3.f, 3.f);
+    std::uniform_real_distribution<float> translation(-40.f, 40.f);
+    std::vector<Hypothesis> hypotheses(numOfHypotheses);
+    odometryOffsets.resize(numOfHypotheses);
+    for(std::size_t i = 0; i < numOfHypotheses; ++i)
+    {
+      hypotheses[i].set(Vector3f(position(random), position(random), angle(random)), Vector3f(10000.f, 10000.f, 0.01f).asDiagonal());
+      odometryOffsets[i] = Pose2f(0.01f, translation(random), translation(random));
+    }
+    return hypotheses;
+  }
+
+  void UKFPose2DMotionUpdate(Benchmark::State& state)
+  {
+    std::vector<Pose2f> odometryOffsets;
+    const std::vector<Hypothesis> initial = createHypotheses(odometryOffsets);
+    std::vector<Hypothesis> hypotheses = initial;
+    for(auto _ : state)
+    {
+      // Restart now and then so that the covariances do not grow without bounds.
+      if(hypotheses[0].getCov()(0, 0) > 1e7f)
+        hypotheses = initial;
+      for(std::size_t i = 0; i < numOfHypotheses; ++i)
+        hypotheses[i].motionUpdate(odometryOffsets[i], filterProcessDeviation, odometryDeviation, odometryRotationDeviation);
+      doNotOptimize(hypotheses);
+    }
+    state.setItemsProcessed(state.getIterations() * numOfHypotheses);
+  }
+  BENCHMARK(UKFPose2DMotionUpdate);
+
+  void UKFPose2DBatchMotionUpdate(Benchmark::State& state)
+  {
+    std::vector<Pose2f> odometryOffsets;
+    const std::vector<Hypothesis> initial = createHypotheses(odometryOffsets);
+    std::vector<Hypothesis> hypotheses = initial;
+    UKFPose2DBatch batch;
+    for(auto _ : state)
+    {
+      if(hypotheses[0].getCov()(0, 0) > 1e7f)
+        hypotheses = initial;
+      batch.motionUpdate(hypotheses.data(), numOfHypotheses, odometryOffsets, filterProcessDeviation, odometryDeviation, odometryRotationDeviation);
+      doNotOptimize(hypotheses);
+    }
+    state.setItemsProcessed(state.getIterations() * numOfHypotheses);
+  }
+  BENCHMARK(UKFPose2DBatchMotionUpdate);
+
+  void UKFPose2DSensorUpdates(Benchmark::State& state)
+  {
+    std::vector<Pose2f> odometryOffsets;
+    const std::vector<Hypothesis> initial = createHypotheses(odometryOffsets);
+    const Matrix2f readingCov = Vector2f(2500.f, 2500.f).asDiagonal();
+    const Matrix2f lineCov = Vector2f(2500.f, 0.01f).asDiagonal();
+    std::vector<Hypothesis> hypotheses = initial;
+    for(auto _ : state)
+    {
+      hypotheses = initial;
+      for(Hypothesis& hypothesis : hypotheses)
+      {
+        hypothesis.landmarkSensorUpdate(Vector2f(0.f, 0.f), hypothesis.getPose().inverse() * Vector2f(30.f, -20.f), readingCov);
+        hypothesis.lineSensorUpdate(true, Vector2f(hypothesis.getPose().translation.y() + 50.f, hypothesis.getPose().rotation), lineCov);
+      }
+      doNotOptimize(hypotheses);
+    }
+    state.setItemsProcessed(state.getIterations() * numOfHypotheses);
+  }
+  BENCHMARK(UKFPose2DSensorUpdates);
+}
@@ -0,0 +1,59 @@
+#include "Benchmark.h"
+#include "Representations/Perception/FieldPercepts/LinesPercept.h"
+#include "Streaming/InStreams.h"
+#include "Streaming/OutStreams.h"
+#include <random>
+
+namespace
+{
+  /** Creates a percept with a typical number of lines and spots. */
+  LinesPercept createLinesPercept()
+  {
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> position(-3000.f, 3000.f);
+    LinesPercept linesPercept;
+    linesPercept.lines.resize(8);
+    for(LinesPercept::Line& line : linesPercept.lines)
+    {
+      line.line = Geometry::Line(Vector2f(position(random), position(random)), Vector2f(position(random), position(random)));
+      for(int i = 0; i < 20; ++i)
+      {
+        line.spotsInField.emplace_back(position(random), position(random));
+        line.spotsInImg.emplace_back(static_cast<int>(random() % 640), static_cast<int>(random() % 480));
+      }
+    }
+    return linesPercept;
+  }
+
+  void StreamingWriteBinary(Benchmark::State& state)
+  {
+    const LinesPercept linesPercept = createLinesPercept();
+    std::vector<char> buffer(65536);
+    std::size_t bytes = 0;
+    for(auto _ : state)
+    {
+      OutBinaryMemory stream(buffer.size(), buffer.data());
+      stream << linesPercept;
+      bytes = stream.size();
+      doNotOptimize(buffer);
+    }
+    state.setItemsProcessed(state.getIterations() * bytes);
+  }
+  BENCHMARK(StreamingWriteBinary);
+
+  void StreamingReadBinary(Benchmark::State& state)
+  {
+    std::vector<char> buffer(65536);
+    OutBinaryMemory out(buffer.size(), buffer.data());
+    out << createLinesPercept();
+    LinesPercept linesPercept;
+    for(auto _ : state)
+    {
+      InBinaryMemory stream(buffer.data(), out.size());
+      stream >> linesPercept;
+      doNotOptimize(linesPercept);
+    }
+    state.setItemsProcessed(state.getIterations() * out.size());
+  }
+  BENCHMARK(StreamingReadBinary);
+}
@@ -1,16 +1,130 @@
 #include "Framework/Configuration.h"
 #include "Framework/ModuleGraphCreator.h"
+#include "Platform/File.h"
 #include "Platform/SystemCall.h"
 #include "Streaming/FunctionList.h"
 #include "Streaming/InStreams.h"
 #include "Streaming/Output.h"
 #include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+/** The timing of a stopwatch in a profile (in ms). */
+struct Timing
+{
+  float median = 0.f;
+  float p95 = 0.f;
+};
+
+/** The stopwatches of a thread in a profile. */
+struct ThreadProfile
+{
+  float framePeriod = 0.f; /**< The average time between two frames (in ms). 0 if unknown. */
+  std::unordered_map<std::string, Timing> timings; /**< The timings by stopwatch names. */
+};
+
+/**
+ * Reads a timing profile saved with the console command "ts".
+ * @param name The name of the file.
+ * @param profile The profile is stored here, indexed by the thread names.
+ * @return Could the file be read?
+ */
+static bool readProfile(const std::string& name, std::unordered_map<std::string, ThreadProfile>& profile)
+{
+  File file(name, "r");
+  if(!file.exists())
+    return false;
+  char buffer[1024];
+  file.readLine(buffer, sizeof(buffer)); // Skip the header
+  while(!file.eof() && file.readLine(buffer, sizeof(buffer)))
+  {
+    std::istringstream line(buffer);
+    std::string thread, stopwatch;
+    std::vector<float> values;
+    std::getline(line, thread, ',');
+    std::getline(line, stopwatch, ',');
+    for(std::string value; std::getline(line, value, ',');)
+      values.push_back(value.empty() ? 0.f : static_cast<float>(std::atof(value.c_str())));
+    if(values.size() < 5)
+      continue;
+    if(stopwatch == "framePeriod")
+      profile[thread].framePeriod = values[4];
+    else
+      profile[thread].timings[stopwatch] = {values[0], values[1]};
+  }
+  return true;
+}
+
+/**
+ * Estimates the frame time of each thread from the providers assigned to it
+ * and a timing profile. The timings of representations are looked up in the
+ * thread of the same name in the profile first and otherwise in any thread,
+ * so profiles also cover representations moved between threads.
+ * @param config The threads configuration.
+ * @param profile The timing profile.
+ * @return Is the expected frame time of all threads within the frame period?
+ */
+static bool checkBudgets(const Configuration& config, const std::unordered_map<std::string, ThreadProfile>& profile)
+{
+  bool withinBudget = true;
+  for(const Configuration::Thread& thread : config())
+  {
+    const auto threadProfile = profile.find(thread.name);
+    float median = 0.f;
+    float p95 = 0.f;
+    std::vector<std::string> unknown;
+    for(const Configuration::RepresentationProvider& rp : thread.representationProviders)
+    {
+      const Timing* timing = nullptr;
+      if(threadProfile != profile.end())
+        if(const auto t = threadProfile->second.timings.find(rp.representation); t != threadProfile->second.timings.end())
+          timing = &t->second;
+      for(auto p = profile.begin(); !timing && p != profile.end(); ++p)
+        if(const auto t = p->second.timings.find(rp.representation); t != p->second.timings.end())
+          timing = &t->second;
+      if(timing)
+      {
+        median += timing->median;
+        p95 += timing->p95;
+      }
+      else
+        unknown.push_back(rp.representation);
+    }
+
+    std::cout << thread.name << ": " << median << " ms expected, " << p95 << " ms at the 95% quantiles";
+    const float framePeriod = threadProfile != profile.end() ? threadProfile->second.framePeriod : 0.f;
+    if(framePeriod > 0.f)
+      std::cout << ", frame period " << framePeriod << " ms (" << 100.f * median / framePeriod << "%)";
+    std::cout << std::endl;
+    if(!unknown.empty())
+    {
+      std::cout << "  no timing for";
+      for(const std::string& representation : unknown)
+        std::cout << " " << representation;
+      std::cout << std::endl;
+    }
+    if(framePeriod > 0.f)
+    {
+      if(median > framePeriod)
+      {
+        OUTPUT_ERROR(thread.name << ": The expected frame time exceeds the frame period.");
+        withinBudget = false;
+      }
+      else if(p95 > framePeriod)
+        OUTPUT_WARNING(thread.name << ": The frame time at the 95% quantiles exceeds the frame period.");
+    }
+  }
+  return withinBudget;
+}
 
 int main(int argc, char** argv)
 {
-  if(argc != 2)
+  if(argc != 2 && argc != 3)
   {
-    OUTPUT_ERROR("Usage: CheckThreads <threads.cfg>");
+    OUTPUT_ERROR("Usage: CheckThreads <threads.cfg> [<timing.csv>]");
+    OUTPUT_ERROR("  <timing.csv> is a profile saved with the console command \"ts\", preferably on a NAO.");
     return EXIT_FAILURE;
   }
   FunctionList::execute();
@@ -36,6 +150,17 @@ int main(int argc, char** argv)
     OUTPUT_ERROR(argv[1] << ": Invalid threads configuration for this scenario. See error above.");
     return EXIT_FAILURE;
   }
+  if(argc == 3)
+  {
+    std::unordered_map<std::string, ThreadProfile> profile;
+    if(!readProfile(argv[2], profile))
+    {
+      OUTPUT_ERROR(argv[2] << ": Could not open the file.");
+      return EXIT_FAILURE;
+    }
+    if(!checkBudgets(config, profile))
+      return EXIT_FAILURE;
+  }
   return EXIT_SUCCESS;
 }
 
@@ -0,0 +1,332 @@
+/**
+ * @file LogTrimmer.cpp
+ *
+ * This file implements a class that writes a subset of a log file to a new
+ * log file.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "LogTrimmer.h"
+#include "Framework/LoggingTools.h"
+#include "Representations/Infrastructure/CameraImage.h"
+#include "Representations/Infrastructure/JPEGImage.h"
+#include "Streaming/InStreams.h"
+#include "Streaming/OutStreams.h"
+#include "Streaming/Output.h"
+#include "Streaming/TypeRegistry.h"
+#include <snappy-c.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <thread>
+
+LogTrimmer::LogTrimmer(const Options& options) :
+  options(options),
+  logTypeInfo(false),
+  slots(framesPerBlock)
+{}
+
+bool LogTrimmer::run()
+{
+  file = std::make_unique<MemoryMappedFile>(options.inputFile);
+  if(!file->exists())
+  {
+    OUTPUT_ERROR("Could not open " << options.inputFile << ".");
+    return false;
+  }
+
+  // The input file is mapped to memory, so it must not be overwritten while it is read.
+  std::error_code error;
+  if(std::filesystem::equivalent(options.inputFile, options.outputFile, error))
+  {
+    OUTPUT_ERROR("The log must be written to a different file.");
+    return false;
+  }
+  output = std::make_unique<OutBinaryFile>(std::filesystem::absolute(options.outputFile).generic_string());
+  if(!output->exists())
+  {
+    OUTPUT_ERROR("Could not create " << options.outputFile << ".");
+    return false;
+  }
+
+  InBinaryMemory stream(file->getData(), file->getSize());
+  char format;
+  if(!readHeader(stream, format) || !configure())
+    return false;
+
+  MessageQueue messages;
+  if(format == LoggingTools::logFileUncompressed)
+  {
+    MessageQueue::QueueHeader header;
+    stream.read(&header, sizeof(MessageQueue::QueueHeader));
+    std::size_t usedSize = header.sizeLow | static_cast<std::size_t>(header.sizeHigh) << 32;
+    if(header.messages == 0x0fffffff)
+      usedSize = stream.getSize() - stream.getPosition();
+    messages.setBuffer(file->getData() + stream.getPosition(), usedSize);
+    for(MessageQueue::Message message : messages)
+      add(message);
+  }
+  else
+  {
+    // Each block is decompressed on its own. Frames may continue in the next block.
+    std::vector<char> uncompressedBuffer;
+    while(!stream.eof())
+    {
+      unsigned compressedSize;
+      stream >> compressedSize;
+      if(!compressedSize || compressedSize > stream.getSize() - stream.getPosition()) // End of compressed data -> an index written by the logger follows.
+        break;
+      const char* compressedBuffer = file->getData() + stream.getPosition();
+      stream.skip(compressedSize);
+      std::size_t uncompressedSize = 0;
+      snappy_uncompressed_length(compressedBuffer, compressedSize, &uncompressedSize);
+      uncompressedBuffer.resize(uncompressedSize);
+      if(snappy_uncompress(compressedBuffer, compressedSize, uncompressedBuffer.data(), &uncompressedSize) != SNAPPY_OK
+         || uncompressedSize < sizeof(MessageQueue::QueueHeader))
+        break;
+      messages.setBuffer(uncompressedBuffer.data() + sizeof(MessageQueue::QueueHeader), uncompressedSize - sizeof(MessageQueue::QueueHeader));
+      for(MessageQueue::Message message : messages)
+        add(message);
+    }
+  }
+
+  // An incomplete last frame is dropped.
+  flush();
+
+  // A compressed block of size 0 marks the end of the compressed data.
+  *output << 0u;
+  index.write(*output);
+  output = nullptr;
+
+  std::printf("%s: %d of %d frames, %.1f MB of messages", options.outputFile.c_str(), framesKept, frame + 1,
+              static_cast<double>(bytesWritten) / (1 << 20));
+  if(cameraImageID != undefined)
+    std::printf(", %u camera images transcoded", static_cast<unsigned>(imagesTranscoded));
+  std::printf("\n");
+  return true;
+}
+
+bool LogTrimmer::readHeader(InBinaryMemory& stream, char& format)
+{
+  for(;;)
+  {
+    const std::size_t start = stream.getPosition();
+    stream >> format;
+    switch(format)
+    {
+      case LoggingTools::logFileSettings:
+        LoggingTools::skipSettings(stream);
+        break;
+      case LoggingTools::logFileMessageIDs:
+        readMessageIDs(stream);
+        break;
+      case LoggingTools::logFileTypeInfo:
+        stream >> logTypeInfo;
+        break;
+      case LoggingTools::logFileUncompressed:
+      case LoggingTools::logFileCompressed:
+        if(mapLogToID.empty())
+        {
+          OUTPUT_ERROR(options.inputFile << " does not contain message ids.");
+          return false;
+        }
+        // The settings, the message ids, and the type information are copied unchanged.
+        output->write(file->getData(), start);
+        *output << LoggingTools::logFileCompressed;
+        return true;
+      default:
+        OUTPUT_ERROR(options.inputFile << " is not a log file or its format is unknown.");
+        return false;
+    }
+  }
+}
+
+void LogTrimmer::readMessageIDs(In& stream)
+{
+  std::unordered_map<std::string, MessageID> mapNameToID;
+  FOREACH_ENUM(MessageID, id, numOfDataMessageIDs)
+    mapNameToID[TypeRegistry::getEnumName(id)] = id;
+  mapNameToID["idProcessBegin"] = idFrameBegin;
+  mapNameToID["idProcessFinished"] = idFrameFinished;
+
+  unsigned char size;
+  stream >> size;
+  mapLogToID.resize(size);
+  logIDNames.resize(size);
+  for(unsigned char id = 0; id < size; ++id)
+  {
+    stream >> logIDNames[id];
+    const auto i = mapNameToID.find(logIDNames[id]);
+    mapLogToID[id] = i != mapNameToID.end() ? i->second : undefined;
+  }
+}
+
+bool LogTrimmer::configure()
+{
+  keepMessage.assign(logIDNames.size(), options.keep.empty());
+  for(const std::string& name : options.keep)
+  {
+    const MessageID id = findID(name);
+    if(id == undefined)
+    {
+      OUTPUT_ERROR(options.inputFile << " does not contain the message id " << name << ".");
+      return false;
+    }
+    keepMessage[id] = true;
+  }
+  for(const std::string& name : options.drop)
+  {
+    const MessageID id = findID(name);
+    if(id == undefined)
+    {
+      OUTPUT_ERROR(options.inputFile << " does not contain the message id " << name << ".");
+      return false;
+    }
+    keepMessage[id] = false;
+  }
+
+  // Frames are always kept complete.
+  for(std::size_t i = 0; i < mapLogToID.size(); ++i)
+    if(mapLogToID[i] == idFrameBegin || mapLogToID[i] == idFrameFinished)
+      keepMessage[i] = true;
+
+  if(options.jpegQuality >= 0)
+  {
+    cameraImageID = findID("CameraImage");
+    jpegImageID = findID("JPEGImage");
+    if(jpegImageID == undefined)
+    {
+      OUTPUT_ERROR(options.inputFile << " does not support JPEG images.");
+      return false;
+    }
+
+    // The images are decoded and encoded with the current types, so they must not have changed.
+    TypeInfo::initCurrent();
+    if(!TypeInfo::current->areTypesEqual(logTypeInfo, "CameraImage", "CameraImage")
+       || !TypeInfo::current->areTypesEqual(logTypeInfo, "JPEGImage", "JPEGImage"))
+    {
+      OUTPUT_ERROR("The images in " << options.inputFile << " differ from the current ones and cannot be transcoded.");
+      return false;
+    }
+    if(cameraImageID != undefined && !keepMessage[cameraImageID])
+      cameraImageID = undefined;
+  }
+  return true;
+}
+
+MessageID LogTrimmer::findID(const std::string& name) const
+{
+  const auto i = std::find(logIDNames.begin(), logIDNames.end(), name.starts_with("id") ? name : "id" + name);
+  return i == logIDNames.end() ? undefined : static_cast<MessageID>(i - logIDNames.begin());
+}
+
+void LogTrimmer::add(MessageQueue::Message message)
+{
+  Slot& slot = slots[slotsUsed];
+  const MessageID messageID = id(message);
+  if(messageID == idFrameBegin)
+  {
+    message.bin() >> thread;
+    keepThread = options.threads.empty() || std::find(options.threads.begin(), options.threads.end(), thread) != options.threads.end();
+    isFrameOpen = true;
+    slot.frame.clear();
+    slot.hasCameraImage = false;
+    slot.frame << message;
+  }
+  else if(!isFrameOpen)
+    return;
+  else if(messageID == idFrameFinished)
+  {
+    isFrameOpen = false;
+    ++frame;
+    const unsigned time = times[thread];
+    if(keepThread && frame >= options.firstFrame && frame <= options.lastFrame
+       && time >= options.firstTime && time <= options.lastTime)
+    {
+      slot.frame << message;
+      ++slotsUsed;
+      bytesUsed += slot.frame.size();
+      if(slotsUsed == slots.size() || bytesUsed >= bytesPerBlock)
+        flush();
+    }
+  }
+  else
+  {
+    if(messageID == idFrameInfo)
+      message.bin() >> times[thread]; // FrameInfo::time is streamed first.
+    if(keepThread && message.id() < keepMessage.size() && keepMessage[message.id()])
+    {
+      slot.frame << message;
+      slot.hasCameraImage |= message.id() == cameraImageID;
+    }
+  }
+}
+
+void LogTrimmer::flush()
+{
+  if(!slotsUsed)
+    return;
+
+  // Each worker takes the next frame that was not transcoded yet.
+  if(cameraImageID != undefined)
+  {
+    unsigned numOfWorkers = options.workers ? options.workers : std::max(1u, std::thread::hardware_concurrency());
+    numOfWorkers = static_cast<unsigned>(std::min<std::size_t>(numOfWorkers, slotsUsed));
+    std::atomic<std::size_t> next = 0;
+    std::atomic<std::size_t> images = 0;
+    std::vector<std::thread> workers;
+    for(unsigned i = 0; i < numOfWorkers; ++i)
+      workers.emplace_back([&]
+      {
+        for(std::size_t index = next++; index < slotsUsed; index = next++)
+          if(slots[index].hasCameraImage)
+            images += transcode(slots[index]);
+      });
+    for(std::thread& worker : workers)
+      worker.join();
+    imagesTranscoded += images;
+  }
+
+  std::size_t size = 0;
+  for(std::size_t i = 0; i < slotsUsed; ++i)
+    size += (slots[i].hasCameraImage ? slots[i].transcoded : slots[i].frame).size();
+
+  const MessageQueue::QueueHeader header = {static_cast<unsigned>(size), 0, static_cast<unsigned>(size >> 32)};
+  OutBinaryMemory block(sizeof(header) + size);
+  block.write(&header, sizeof(header));
+  for(std::size_t i = 0; i < slotsUsed; ++i)
+  {
+    const MessageQueue& queue = slots[i].hasCameraImage ? slots[i].transcoded : slots[i].frame;
+    index.add(queue, mapLogToID);
+    queue.append(block);
+  }
+  LoggingTools::compress(block.data(), block.size(), compressed);
+  *output << static_cast<unsigned>(compressed.size());
+  output->write(compressed.data(), compressed.size());
+
+  framesKept += static_cast<int>(slotsUsed);
+  bytesWritten += size;
+  slotsUsed = 0;
+  bytesUsed = 0;
+}
+
+std::size_t LogTrimmer::transcode(Slot& slot) const
+{
+  std::size_t images = 0;
+  slot.transcoded.clear();
+  for(MessageQueue::Message message : slot.frame)
+    if(message.id() == cameraImageID)
+    {
+      CameraImage cameraImage;
+      message.bin() >> cameraImage;
+      JPEGImage jpegImage;
+      jpegImage.fromCameraImage(cameraImage, options.jpegQuality);
+      slot.transcoded.bin(jpegImageID) << jpegImage;
+      ++images;
+    }
+    else
+      slot.transcoded << message;
+  return images;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file LogTrimmer.h
+ *
+ * This file declares a class that writes a subset of a log file to a new log
+ * file. Messages can be dropped by their ids, frames by their threads, their
+ * numbers, or their times. Camera images can be replaced by JPEG images. The
+ * log is streamed from the memory-mapped input file frame by frame, i.e. it is
+ * never loaded completely. Apart from the camera images that are transcoded,
+ * the messages are copied without deserializing them.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Framework/Logger.h"
+#include "Platform/MemoryMappedFile.h"
+#include "Streaming/MessageIDs.h"
+#include "Streaming/MessageQueue.h"
+#include "Streaming/TypeInfo.h"
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class OutBinaryFile;
+
+class LogTrimmer
+{
+public:
+  /** The options of a run. */
+  struct Options
+  {
+    std::string inputFile; /**< The log file read. */
+    std::string outputFile; /**< The log file written. */
+    std::vector<std::string> keep; /**< Only messages with these ids are kept. All if empty. */
+    std::vector<std::string> drop; /**< Messages with these ids are dropped. */
+    std::vector<std::string> threads; /**< Only frames of these threads are kept. All if empty. */
+    int firstFrame = 0; /**< The first frame kept (counting the frames of all threads). */
+    int lastFrame = std::numeric_limits<int>::max(); /**< The last frame kept. */
+    unsigned firstTime = 0; /**< Only frames whose \c FrameInfo::time is at least this are kept (in ms). */
+    unsigned lastTime = std::numeric_limits<unsigned>::max(); /**< Only frames whose \c FrameInfo::time is at most this are kept (in ms). */
+    int jpegQuality = -1; /**< The quality camera images are compressed with to JPEG images. Negative: No transcoding. */
+    unsigned workers = 0; /**< The number of threads that transcode images. 0 means one per hardware thread. */
+  };
+
+  /**
+   * Constructor.
+   * @param options The options of the run.
+   */
+  LogTrimmer(const Options& options);
+
+  /**
+   * Writes the new log file and prints some statistics.
+   * @return Was the log written successfully?
+   */
+  bool run();
+
+private:
+  /** A frame collected for the next block written. */
+  struct Slot
+  {
+    MessageQueue frame; /**< The messages of the frame kept. */
+    MessageQueue transcoded; /**< The frame with JPEG images instead of camera images. */
+    bool hasCameraImage = false; /**< Does \c frame contain a camera image that must be transcoded? */
+  };
+
+  static constexpr std::size_t framesPerBlock = 64; /**< The maximum number of frames per compressed block. */
+  static constexpr std::size_t bytesPerBlock = 8 << 20; /**< A block is written when its frames reach this size. */
+
+  const Options options; /**< The options of the run. */
+  std::unique_ptr<MemoryMappedFile> file; /**< The log file read. */
+  std::unique_ptr<OutBinaryFile> output; /**< The log file written. */
+  TypeInfo logTypeInfo; /**< The specifications of all the types from the log file. */
+  std::vector<MessageID> mapLogToID; /**< Maps message ids from the log to their current values. */
+  std::vector<std::string> logIDNames; /**< The names of the message ids in the log. */
+  std::vector<bool> keepMessage; /**< Are messages kept per message id in the log? */
+  MessageID cameraImageID = undefined; /**< The id of camera images in the log. undefined if they are not transcoded. */
+  MessageID jpegImageID = undefined; /**< The id of JPEG images in the log. */
+
+  std::vector<Slot> slots; /**< The frames of the next block. */
+  std::size_t slotsUsed = 0; /**< The number of entries in \c slots used. */
+  std::size_t bytesUsed = 0; /**< The number of bytes in the entries of \c slots used. */
+  LogFileIndex index; /**< The index of the log written. */
+  std::vector<char> compressed; /**< The buffer for compressing a block. */
+
+  bool isFrameOpen = false; /**< Is a frame currently read? */
+  bool keepThread = false; /**< Is the thread of the current frame kept? */
+  std::string thread; /**< The thread of the current frame. */
+  std::unordered_map<std::string, unsigned> times; /**< The last time from a \c FrameInfo per thread. */
+  int frame = -1; /**< The number of the current frame in the log read. */
+
+  int framesKept = 0; /**< The number of frames written. */
+  std::size_t imagesTranscoded = 0; /**< The number of camera images replaced by JPEG images. */
+  std::size_t bytesWritten = 0; /**< The size of the (uncompressed) messages written. */
+
+  /**
+   * Reads all chunks of the log file before its messages and copies them to the new one.
+   * @param stream The stream of the log file read. Afterwards, it is positioned after
+   *               the byte that describes how the messages are stored.
+   * @param format The format of the messages is returned here.
+   * @return Could the chunks be read and was their content valid?
+   */
+  bool readHeader(InBinaryMemory& stream, char& format);
+
+  /**
+   * Reads the names of the message ids from the log and maps them to the current ones.
+   * @param stream The stream positioned at the beginning of the message ids.
+   */
+  void readMessageIDs(In& stream);
+
+  /**
+   * Determines which messages are kept and whether images can be transcoded.
+   * @return Were the options valid for this log?
+   */
+  bool configure();
+
+  /**
+   * Finds a message id in the log by its name.
+   * @param name The name of the id with or without the prefix "id".
+   * @return The id in the log or \c undefined if the log does not contain it.
+   */
+  MessageID findID(const std::string& name) const;
+
+  /**
+   * Adds a message to the current frame if it is kept.
+   * @param message A message of the log read in the order of the log.
+   */
+  void add(MessageQueue::Message message);
+
+  /** Transcodes the images of the frames collected and writes them as a compressed block. */
+  void flush();
+
+  /**
+   * Replaces the camera images of a frame by JPEG images.
+   * @param slot The frame. The result is stored in its entry \c transcoded.
+   * @return The number of images transcoded.
+   */
+  std::size_t transcode(Slot& slot) const;
+
+  /**
+   * Returns the message type translated to the current value in the enumeration type.
+   * @param message A message from the log file.
+   * @return The corresponding constant in \c MessageID.
+   */
+  MessageID id(MessageQueue::Message message) const
+  {
+    return message.id() < mapLogToID.size() ? mapLogToID[message.id()] : undefined;
+  }
+};
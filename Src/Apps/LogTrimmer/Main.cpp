@@ -0,0 +1,91 @@
+/**
+ * @file Main.cpp
+ *
+ * This file implements the main function of a tool that writes a subset of a
+ * log file to a new log file.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "LogTrimmer.h"
+#include "Platform/SystemCall.h"
+#include "Streaming/FunctionList.h"
+#include "Streaming/Output.h"
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * Splits a comma-separated list.
+ * @param value The list.
+ * @return Its non-empty elements.
+ */
+static std::vector<std::string> split(const char* value)
+{
+  std::vector<std::string> result;
+  for(const char* end = value;; value = end + 1)
+  {
+    end = std::strchr(value, ',');
+    const std::string element = end ? std::string(value, end - value) : std::string(value);
+    if(!element.empty())
+      result.push_back(element);
+    if(!end)
+      return result;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  LogTrimmer::Options options;
+  bool valid = true;
+  for(int i = 1; i < argc && valid; ++i)
+  {
+    const char* value = std::strchr(argv[i], '=');
+    const std::string name = value ? std::string(argv[i], value++ - argv[i]) : std::string(argv[i]);
+    if(name == "--keep" && value)
+      options.keep = split(value);
+    else if(name == "--drop" && value)
+      options.drop = split(value);
+    else if(name == "--threads" && value)
+      options.threads = split(value);
+    else if(name == "--frames" && value)
+    {
+      char* end;
+      options.firstFrame = static_cast<int>(std::strtol(value, &end, 10));
+      options.lastFrame = *end == '-' ? static_cast<int>(std::strtol(end + 1, nullptr, 10)) : options.firstFrame;
+    }
+    else if(name == "--time" && value)
+    {
+      char* end;
+      options.firstTime = static_cast<unsigned>(std::strtoul(value, &end, 10));
+      options.lastTime = *end == '-' ? static_cast<unsigned>(std::strtoul(end + 1, nullptr, 10)) : options.firstTime;
+    }
+    else if(name == "--jpeg")
+      options.jpegQuality = value ? static_cast<int>(std::strtol(value, nullptr, 10)) : 75;
+    else if(name == "--workers" && value)
+      options.workers = static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+    else if(name.starts_with("--"))
+      valid = false;
+    else if(options.inputFile.empty())
+      options.inputFile = argv[i];
+    else if(options.outputFile.empty())
+      options.outputFile = argv[i];
+    else
+      valid = false;
+  }
+
+  if(!valid || options.outputFile.empty() || options.jpegQuality > 100)
+  {
+    OUTPUT_ERROR("Usage: LogTrimmer <input log> <output log> [--keep=<id>,...] [--drop=<id>,...] [--threads=<name>,...]\n"
+                 "       [--frames=<first>[-<last>]] [--time=<from>[-<to>]] [--jpeg[=<quality>]] [--workers=<n>]");
+    return EXIT_FAILURE;
+  }
+
+  FunctionList::execute();
+  LogTrimmer logTrimmer(options);
+  return logTrimmer.run() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+SystemCall::Mode SystemCall::getMode()
+{
+  return SystemCall::logFileReplay;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file Main.cpp
+ *
+ * This file implements the main function of a tool that benchmarks a single
+ * module on the data of a log file.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "ModuleBenchmark.h"
+#include "Platform/SystemCall.h"
+#include "Streaming/FunctionList.h"
+#include "Streaming/Output.h"
+#include <cstdlib>
+#include <cstring>
+
+int main(int argc, char** argv)
+{
+  ModuleBenchmark::Options options;
+  bool valid = true;
+  for(int i = 1; i < argc && valid; ++i)
+  {
+    const char* value = std::strchr(argv[i], '=');
+    const std::string name = value ? std::string(argv[i], value++ - argv[i]) : std::string(argv[i]);
+    if(name == "--thread" && value)
+      options.thread = value;
+    else if(name == "--repetitions" && value)
+      options.repetitions = static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+    else if(name == "--frames" && value)
+    {
+      char* end;
+      options.firstFrame = static_cast<int>(std::strtol(value, &end, 10));
+      options.lastFrame = *end == '-' ? static_cast<int>(std::strtol(end + 1, nullptr, 10)) : options.firstFrame;
+    }
+    else if(name == "--location" && value)
+      options.location = value;
+    else if(name == "--scenario" && value)
+      options.scenario = value;
+    else if(name == "--csv" && value)
+      options.csvFile = value;
+    else if(name.starts_with("--"))
+      valid = false;
+    else if(options.logFile.empty())
+      options.logFile = argv[i];
+    else if(options.module.empty())
+      options.module = argv[i];
+    else
+      valid = false;
+  }
+
+  if(!valid || options.module.empty())
+  {
+    OUTPUT_ERROR("Usage: ModuleBenchmark <log> <module> [--thread=<name>] [--repetitions=<n>] [--frames=<first>[-<last>]]\n"
+                 "       [--location=<name>] [--scenario=<name>] [--csv=<file>]");
+    return EXIT_FAILURE;
+  }
+
+  FunctionList::execute();
+  ModuleBenchmark moduleBenchmark(options);
+  return moduleBenchmark.run() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+SystemCall::Mode SystemCall::getMode()
+{
+  return SystemCall::logFileReplay;
+}
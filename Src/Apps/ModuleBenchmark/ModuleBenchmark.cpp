@@ -0,0 +1,363 @@
+/**
+ * @file ModuleBenchmark.cpp
+ *
+ * This file implements a class that runs a single module on the data of a log
+ * file without the simulator.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "ModuleBenchmark.h"
+#include "Debugging/DebugDataStreamer.h"
+#include "Framework/LoggingTools.h"
+#include "Platform/File.h"
+#include "Platform/Time.h"
+#include "Streaming/InStreams.h"
+#include "Streaming/OutStreams.h"
+#include "Streaming/Output.h"
+#include <snappy-c.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <unordered_map>
+
+ModuleBenchmark::ModuleBenchmark(const Options& options) :
+  ThreadFrame(Settings(options.logFile, options.location.empty() ? nullptr : &options.location,
+                       options.scenario.empty() ? nullptr : &options.scenario), "", nullptr, nullptr),
+  options(options)
+{
+  setGlobals();
+  TypeInfo::initCurrent();
+  states.fill(unknown);
+}
+
+bool ModuleBenchmark::run()
+{
+  ModuleBase* moduleBase = ModuleBase::first;
+  while(moduleBase && options.module != moduleBase->name)
+    moduleBase = moduleBase->next;
+  if(!moduleBase)
+  {
+    OUTPUT_ERROR("Unknown module " << options.module << ".");
+    return false;
+  }
+  if(!readLog())
+    return false;
+
+  // Determine which representations are read from the log and which are compared with it.
+  std::vector<std::pair<const char*, MessageID>> inputs;
+  std::vector<Comparison> comparisons;
+  for(const ModuleBase::Info& info : moduleBase->getModuleInfo())
+    if(info.update)
+      comparisons.push_back({info.representation, info.update, ModuleBase::getMessageID(info.representation)});
+    else
+      inputs.emplace_back(info.representation, ModuleBase::getMessageID(info.representation));
+  for(const char* representation : moduleBase->getUsedRepresentations())
+    inputs.emplace_back(representation, ModuleBase::getMessageID(representation));
+
+  std::vector<bool> inputSeen(inputs.size(), false);
+  std::vector<int> frames;
+  std::vector<float> times;
+  std::vector<unsigned long long> repetitionTimes(std::max(1u, options.repetitions));
+  std::unordered_map<MessageID, MessageQueue::Message> frameMessages;
+  std::unique_ptr<Streamable> instance;
+  bool inThread = false;
+  int frame = -1;
+
+  for(MessageQueue::Message message : log)
+  {
+    const MessageID messageID = id(message);
+    if(messageID == idFrameBegin)
+    {
+      std::string thread;
+      message.bin() >> thread;
+      inThread = thread == options.thread;
+      if(inThread)
+        ++frame;
+      frameMessages.clear();
+    }
+    else if(!inThread || frame < options.firstFrame)
+      continue;
+    else if(messageID != idFrameFinished)
+    {
+      if(messageID < numOfDataMessageIDs)
+        frameMessages.insert_or_assign(messageID, message);
+    }
+    else if(frame > options.lastFrame)
+      break;
+    else
+    {
+      // The module must exist to fill the representations it requires.
+      if(!instance)
+      {
+        instance.reset(moduleBase->createNew());
+        if(!instance)
+        {
+          OUTPUT_ERROR("Could not create module " << options.module << ".");
+          return false;
+        }
+      }
+
+      for(std::size_t i = 0; i < inputs.size(); ++i)
+      {
+        const auto logged = frameMessages.find(inputs[i].second);
+        if(logged != frameMessages.end())
+        {
+          readMessage(logged->second, Blackboard::getInstance()[inputs[i].first]);
+          inputSeen[i] = true;
+        }
+      }
+
+      for(std::size_t repetition = 0; repetition < repetitionTimes.size(); ++repetition)
+      {
+        const unsigned long long start = Time::getRealSystemTimeNs();
+        for(const Comparison& comparison : comparisons)
+          comparison.update(*instance);
+        repetitionTimes[repetition] = Time::getRealSystemTimeNs() - start;
+
+        // Only the first execution in a frame sees the same state as on the robot.
+        if(!repetition)
+          for(Comparison& comparison : comparisons)
+          {
+            const auto logged = frameMessages.find(comparison.id);
+            if(logged != frameMessages.end())
+            {
+              ++comparison.framesCompared;
+              std::string difference;
+              if(!compare(logged->second, Blackboard::getInstance()[comparison.representation], difference))
+              {
+                ++comparison.framesDiffering;
+                if(comparison.firstDifferingFrame < 0)
+                {
+                  comparison.firstDifferingFrame = frame;
+                  comparison.firstDifference = difference;
+                }
+              }
+            }
+          }
+      }
+
+      std::nth_element(repetitionTimes.begin(), repetitionTimes.begin() + repetitionTimes.size() / 2, repetitionTimes.end());
+      frames.push_back(frame);
+      times.push_back(static_cast<float>(repetitionTimes[repetitionTimes.size() / 2]) / 1000.f);
+
+      // Nobody reads the debug output, so it must not accumulate.
+      debugSender->clear();
+    }
+  }
+
+  std::vector<std::string> missing;
+  for(std::size_t i = 0; i < inputs.size(); ++i)
+    if(!inputSeen[i])
+      missing.emplace_back(inputs[i].first);
+
+  instance.reset();
+  printResults(frames, times, comparisons, missing);
+  if(frames.empty())
+  {
+    OUTPUT_ERROR("The log contains no frames of thread " << options.thread << " in the range selected.");
+    return false;
+  }
+  return true;
+}
+
+bool ModuleBenchmark::readLog()
+{
+  file = std::make_unique<MemoryMappedFile>(options.logFile);
+  if(!file->exists())
+  {
+    OUTPUT_ERROR("Could not open " << options.logFile << ".");
+    return false;
+  }
+
+  InBinaryMemory stream(file->getData(), file->getSize());
+  for(;;)
+  {
+    char chunk;
+    stream >> chunk;
+    switch(chunk)
+    {
+      case LoggingTools::logFileSettings:
+        LoggingTools::skipSettings(stream);
+        break;
+      case LoggingTools::logFileMessageIDs:
+        readMessageIDs(stream);
+        break;
+      case LoggingTools::logFileTypeInfo:
+        logTypeInfo = std::make_unique<TypeInfo>(false);
+        stream >> *logTypeInfo;
+        logSchema = std::make_unique<DebugDataSchema>(*logTypeInfo);
+        break;
+      case LoggingTools::logFileCompressed:
+        log.reserve(0xfffffffffull);
+        while(!stream.eof())
+        {
+          unsigned compressedSize;
+          stream >> compressedSize;
+          if(!compressedSize) // End of compressed data -> an index written by the logger follows.
+            break;
+          std::vector<char> compressedBuffer(compressedSize);
+          stream.read(compressedBuffer.data(), compressedSize);
+          std::size_t uncompressedSize = 0;
+          snappy_uncompressed_length(compressedBuffer.data(), compressedSize, &uncompressedSize);
+          std::vector<char> uncompressedBuffer(uncompressedSize);
+          if(snappy_uncompress(compressedBuffer.data(), compressedSize, uncompressedBuffer.data(), &uncompressedSize) != SNAPPY_OK)
+            break;
+          InBinaryMemory(uncompressedBuffer.data(), uncompressedSize) >> log;
+        }
+        return !mapLogToID.empty();
+      case LoggingTools::logFileUncompressed:
+      {
+        MessageQueue::QueueHeader header;
+        stream.read(&header, sizeof(MessageQueue::QueueHeader));
+        std::size_t usedSize = header.sizeLow | static_cast<std::size_t>(header.sizeHigh) << 32;
+        if(header.messages == 0x0fffffff)
+          usedSize = stream.getSize() - stream.getPosition();
+        log.setBuffer(file->getData() + stream.getPosition(), usedSize);
+        return !mapLogToID.empty();
+      }
+      default:
+        OUTPUT_ERROR(options.logFile << " is not a log file or its format is unknown.");
+        return false;
+    }
+  }
+}
+
+void ModuleBenchmark::readMessageIDs(In& stream)
+{
+  std::unordered_map<std::string, MessageID> mapNameToID;
+  FOREACH_ENUM(MessageID, id, numOfDataMessageIDs)
+    mapNameToID[TypeRegistry::getEnumName(id)] = id;
+  mapNameToID["idProcessBegin"] = idFrameBegin;
+  mapNameToID["idProcessFinished"] = idFrameFinished;
+
+  unsigned char size;
+  stream >> size;
+  mapLogToID.resize(size);
+  for(unsigned char id = 0; id < size; ++id)
+  {
+    std::string logIDName;
+    stream >> logIDName;
+    const auto i = mapNameToID.find(logIDName);
+    mapLogToID[id] = i != mapNameToID.end() ? i->second : undefined;
+  }
+}
+
+bool ModuleBenchmark::isTypeUnchanged(MessageID id)
+{
+  if(states[id] == unknown)
+  {
+    const char* type = TypeRegistry::getEnumName(id) + 2; // +2 to skip the id of the messageID enums.
+    states[id] = !logTypeInfo || TypeInfo::current->areTypesEqual(*logTypeInfo, type, type) ? accept : convert;
+    if(states[id] == convert)
+      OUTPUT_WARNING(type << " has changed and is converted. Some fields will keep their previous values.");
+  }
+  return states[id] == accept;
+}
+
+void ModuleBenchmark::readMessage(MessageQueue::Message message, Streamable& representation)
+{
+  if(isTypeUnchanged(id(message)))
+    message.bin() >> representation;
+  else
+  {
+    // Stream into textual representation in memory using type specification of log file.
+    OutMapMemory outMap(true, 16384);
+    InBinaryMemory stream = message.bin();
+    DebugDataStreamer streamer(*logSchema, stream, TypeRegistry::getEnumName(id(message)) + 2);
+    outMap << streamer;
+
+    // Read from textual representation. Errors are suppressed.
+    InMapMemory inMap(outMap.data(), outMap.size(), 0);
+    inMap >> representation;
+  }
+}
+
+bool ModuleBenchmark::compare(MessageQueue::Message message, const Streamable& representation, std::string& difference)
+{
+  if(isTypeUnchanged(id(message)))
+  {
+    OutBinaryMemory stream(message.size() + 1024);
+    stream << representation;
+    if(stream.size() == message.size() && !std::memcmp(stream.data(), message.data(), message.size()))
+      return true;
+  }
+
+  // Compare the textual representations to describe the difference.
+  OutMapMemory loggedMap(false, 16384);
+  InBinaryMemory stream = message.bin();
+  DebugDataStreamer streamer(*logSchema, stream, TypeRegistry::getEnumName(id(message)) + 2);
+  loggedMap << streamer;
+  OutMapMemory currentMap(false, 16384);
+  currentMap << representation;
+
+  const std::string logged(loggedMap.data(), loggedMap.size());
+  const std::string current(currentMap.data(), currentMap.size());
+  if(logged == current)
+    return true; // Only differences below the precision of the text format.
+
+  std::size_t begin = 0;
+  while(begin < logged.size() && begin < current.size())
+  {
+    const std::size_t loggedEnd = std::min(logged.find('\n', begin), logged.size());
+    const std::size_t currentEnd = std::min(current.find('\n', begin), current.size());
+    if(logged.compare(begin, loggedEnd - begin, current, begin, currentEnd - begin))
+    {
+      difference = "logged \"" + logged.substr(begin, loggedEnd - begin) + "\", computed \"" + current.substr(begin, currentEnd - begin) + "\"";
+      return false;
+    }
+    begin = loggedEnd + 1;
+  }
+  difference = "different number of lines";
+  return false;
+}
+
+void ModuleBenchmark::printResults(const std::vector<int>& frames, const std::vector<float>& times,
+                                   const std::vector<Comparison>& comparisons, const std::vector<std::string>& missing) const
+{
+  for(const std::string& representation : missing)
+    std::printf("Warning: %s is not part of the log and keeps its default value.\n", representation.c_str());
+
+  if(!times.empty())
+  {
+    std::vector<float> sorted(times);
+    std::sort(sorted.begin(), sorted.end());
+    const auto percentile = [&sorted](float p)
+    {
+      return sorted[static_cast<std::size_t>(std::round(p * static_cast<float>(sorted.size() - 1)))];
+    };
+    std::printf("%s: %d frames of %s, %u repetitions per frame\n", options.module.c_str(), static_cast<int>(times.size()),
+                options.thread.c_str(), std::max(1u, options.repetitions));
+    std::printf("time per frame (µs): mean %.1f, min %.1f, median %.1f, 90%% %.1f, 99%% %.1f, max %.1f\n",
+                std::accumulate(sorted.begin(), sorted.end(), 0.f) / static_cast<float>(sorted.size()),
+                sorted.front(), percentile(0.5f), percentile(0.9f), percentile(0.99f), sorted.back());
+    const auto slowest = std::max_element(times.begin(), times.end());
+    std::printf("slowest frame: %d\n", frames[slowest - times.begin()]);
+  }
+
+  for(const Comparison& comparison : comparisons)
+    if(!comparison.framesCompared)
+      std::printf("%s: not part of the log\n", comparison.representation);
+    else if(!comparison.framesDiffering)
+      std::printf("%s: identical in all %d frames\n", comparison.representation, comparison.framesCompared);
+    else
+      std::printf("%s: differs in %d of %d frames, first in frame %d: %s\n", comparison.representation,
+                  comparison.framesDiffering, comparison.framesCompared, comparison.firstDifferingFrame,
+                  comparison.firstDifference.c_str());
+
+  if(!options.csvFile.empty())
+  {
+    std::ofstream stream(options.csvFile);
+    if(!stream)
+      OUTPUT_ERROR("Could not write " << options.csvFile << ".");
+    else
+    {
+      stream << "frame,time\n";
+      for(std::size_t i = 0; i < times.size(); ++i)
+        stream << frames[i] << "," << times[i] << "\n";
+    }
+  }
+}
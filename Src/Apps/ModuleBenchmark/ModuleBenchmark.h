@@ -0,0 +1,147 @@
+/**
+ * @file ModuleBenchmark.h
+ *
+ * This file declares a class that runs a single module on the data of a log
+ * file without the simulator. In each frame of the selected thread, all
+ * representations the module requires or uses are filled from the log. Then
+ * the module is executed several times and the time each execution takes is
+ * measured. After the first execution, the representations provided are
+ * compared with the ones that were logged.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Debugging/DebugDataSchema.h"
+#include "Framework/Module.h"
+#include "Framework/ThreadFrame.h"
+#include "Platform/MemoryMappedFile.h"
+#include "Streaming/MessageIDs.h"
+#include "Streaming/MessageQueue.h"
+#include "Streaming/TypeInfo.h"
+#include <array>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+class ModuleBenchmark : public ThreadFrame
+{
+public:
+  /** The options of a benchmark run. */
+  struct Options
+  {
+    std::string logFile; /**< The log file replayed. */
+    std::string module; /**< The name of the module benchmarked. */
+    std::string thread = "Cognition"; /**< The thread whose frames are replayed. */
+    unsigned repetitions = 10; /**< How often is the module executed per frame? */
+    int firstFrame = 0; /**< The first frame of the thread replayed. */
+    int lastFrame = std::numeric_limits<int>::max(); /**< The last frame of the thread replayed. */
+    std::string location; /**< The location used for loading the configuration. Empty: Use the one from the log. */
+    std::string scenario; /**< The scenario used for loading the configuration. Empty: Use the one from the log. */
+    std::string csvFile; /**< If not empty, the times of all frames are written to this file. */
+  };
+
+  /**
+   * Constructor.
+   * @param options The options of the benchmark run.
+   */
+  ModuleBenchmark(const Options& options);
+
+  /**
+   * Runs the benchmark and prints the results.
+   * @return Was the benchmark run successfully?
+   */
+  bool run();
+
+protected:
+  int getPriority() const override {return 0;}
+  void init() override {}
+  bool main() override {return false;}
+  void terminate() override {}
+
+private:
+  /** The comparison of a provided representation with the logged one. */
+  struct Comparison
+  {
+    const char* representation; /**< The name of the representation. */
+    void (*update)(Streamable&); /**< The update handler within the module. */
+    MessageID id; /**< The id of the representation's messages. */
+    int framesCompared = 0; /**< The number of frames in which the representation was logged. */
+    int framesDiffering = 0; /**< The number of frames in which it differed from the logged one. */
+    int firstDifferingFrame = -1; /**< The first frame in which it differed. -1 if none. */
+    std::string firstDifference; /**< A description of the first difference found. */
+  };
+
+  /** The compatibility of a logged type with the current one. */
+  ENUM(State,
+  {,
+    unknown, /**< Not checked yet. */
+    accept, /**< The specifications are the same. */
+    convert, /**< The specifications differ. */
+  });
+
+  const Options options; /**< The options of the benchmark run. */
+  std::unique_ptr<MemoryMappedFile> file; /**< The log file if it is uncompressed. Its contents are used directly. */
+  MessageQueue log; /**< The messages of the log file. */
+  std::unique_ptr<TypeInfo> logTypeInfo; /**< The specifications of all the types from the log file. */
+  std::unique_ptr<DebugDataSchema> logSchema; /**< The types from the log file compiled for converting them. */
+  std::vector<MessageID> mapLogToID; /**< Maps message ids from the log to their current values. */
+  std::array<State, numOfDataMessageIDs> states; /**< Are the logged types compatible with the current ones? */
+
+  /**
+   * Loads the log file.
+   * @return Could it be loaded?
+   */
+  bool readLog();
+
+  /**
+   * Reads the names of the message ids from the log and maps them to the current ones.
+   * @param stream The stream positioned at the beginning of the message ids.
+   */
+  void readMessageIDs(In& stream);
+
+  /**
+   * Returns the message type translated to the current value in the enumeration type.
+   * @param message A message from the log file.
+   * @return The corresponding constant in \c MessageID.
+   */
+  MessageID id(MessageQueue::Message message) const
+  {
+    return message.id() < mapLogToID.size() ? mapLogToID[message.id()] : undefined;
+  }
+
+  /**
+   * Checks whether the logged type of a message is the same as the current one.
+   * @param id The id of the message.
+   * @return Is the type unchanged?
+   */
+  bool isTypeUnchanged(MessageID id);
+
+  /**
+   * Reads a logged representation. It is converted if its type has changed.
+   * @param message The message that contains the representation.
+   * @param representation The representation that is overwritten.
+   */
+  void readMessage(MessageQueue::Message message, Streamable& representation);
+
+  /**
+   * Compares a representation with a logged one.
+   * @param message The message that contains the logged representation.
+   * @param representation The representation compared.
+   * @param difference A description of the first difference is returned here.
+   * @return Are they the same?
+   */
+  bool compare(MessageQueue::Message message, const Streamable& representation, std::string& difference);
+
+  /**
+   * Prints the results.
+   * @param frames The numbers of the frames replayed.
+   * @param times The median execution time of the module per frame (in µs).
+   * @param comparisons The comparisons of the provided representations.
+   * @param missing The representations required that were not part of the log.
+   */
+  void printResults(const std::vector<int>& frames, const std::vector<float>& times,
+                    const std::vector<Comparison>& comparisons, const std::vector<std::string>& missing) const;
+};
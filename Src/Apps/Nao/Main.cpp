@@ -18,6 +18,7 @@
 
 #include "Framework/Robot.h"
 #include "Framework/Settings.h"
+#include "Framework/StartupTrace.h"
 #include "Math/Angle.h"
 #include "Math/Constants.h"
 #include "Platform/File.h"
@@ -43,6 +44,7 @@ static void bhumanStart(const Settings& settings)
 {
   fprintf(stderr, "B-Human: Start.\n");
 
+  StartupTrace::Step step("robot", "construct");
   robot = new Robot(settings, std::string());
   robot->start();
 }
@@ -0,0 +1,55 @@
+#include "ImageProcessing/PatchUtilities.h"
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+static GrayscaledImage createRandomImage(unsigned int width, unsigned int height)
+{
+  GrayscaledImage image(width, height);
+  std::mt19937 random(42);
+  for(unsigned int y = 0; y < image.height; ++y)
+    for(unsigned int x = 0; x < image.width; ++x)
+      image[y][x] = static_cast<PixelTypes::GrayscaledPixel>(random());
+  return image;
+}
+
+GTEST_TEST(ImageView, SubViewAddressesPixelsOfImage)
+{
+  GrayscaledImage image = createRandomImage(40, 30);
+  const GrayscaledImageView view = GrayscaledImageView(image).subView(7, 5, 20, 10);
+  ASSERT_EQ(20u, view.width);
+  ASSERT_EQ(10u, view.height);
+  ASSERT_EQ(40u, view.stride);
+  ASSERT_FALSE(view.isContiguous());
+  for(unsigned int y = 0; y < view.height; ++y)
+    for(unsigned int x = 0; x < view.width; ++x)
+    {
+      ASSERT_EQ(&image[y + 5][x + 7], &view[y][x]);
+      ASSERT_EQ(&image[y + 5][x + 7], &view(x, y));
+    }
+  ASSERT_TRUE(GrayscaledImageView(image).isContiguous());
+}
+
+GTEST_TEST(ImageView, PatchOfSubViewMatchesPatchOfCopy)
+{
+  const GrayscaledImage image = createRandomImage(64, 48);
+  const unsigned int left = 9, top = 13, width = 30, height = 20;
+  GrayscaledImage copy(width, height);
+  for(unsigned int y = 0; y < height; ++y)
+    for(unsigned int x = 0; x < width; ++x)
+      copy[y][x] = image[y + top][x + left];
+  const GrayscaledImageView view = GrayscaledImageView(image).subView(left, top, width, height);
+
+  const Vector2i outSize(16, 16);
+  std::vector<float> fromCopy(outSize.x() * outSize.y());
+  std::vector<float> fromView(outSize.x() * outSize.y());
+  for(const PatchUtilities::ExtractionMode mode : {PatchUtilities::fast, PatchUtilities::fastInterpolated, PatchUtilities::interpolated})
+    for(const Vector2i& center : {Vector2i(15, 10), Vector2i(2, 3), Vector2i(28, 18)})
+    {
+      PatchUtilities::extractPatch(center, Vector2i(12, 12), outSize, copy, fromCopy.data(), mode);
+      PatchUtilities::extractPatch(center, Vector2i(12, 12), outSize, view, fromView.data(), mode);
+      for(std::size_t i = 0; i < fromCopy.size(); ++i)
+        ASSERT_EQ(fromCopy[i], fromView[i]);
+    }
+}
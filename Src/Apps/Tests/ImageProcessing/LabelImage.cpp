@@ -0,0 +1,112 @@
+#include "ImageProcessing/LabelImage.h"
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+/** Creates boxes with many overlaps, including some with the same confidence. */
+static LabelImage createLabelImage(std::mt19937& random)
+{
+  std::uniform_real_distribution<float> position(0.f, 640.f);
+  std::uniform_real_distribution<float> size(5.f, 150.f);
+  std::uniform_int_distribution<int> confidence(60, 80);
+  LabelImage labelImage;
+  for(int i = 0; i < 60; ++i)
+  {
+    LabelImage::Annotation annotation;
+    annotation.upperLeft = Vector2f(position(random), position(random) * 0.75f);
+    annotation.lowerRight = annotation.upperLeft + Vector2f(size(random), size(random));
+    annotation.confidence = static_cast<float>(confidence(random)) / 100.f;
+    annotation.fallen = false;
+    annotation.distance = static_cast<float>(i);
+    labelImage.annotations.push_back(annotation);
+  }
+  return labelImage;
+}
+
+/** Returns the identifying distances of the annotations in their order. */
+static std::vector<float> getIds(const LabelImage& labelImage)
+{
+  std::vector<float> ids;
+  for(const LabelImage::Annotation& annotation : labelImage.annotations)
+    ids.push_back(annotation.distance);
+  return ids;
+}
+
+GTEST_TEST(LabelImage, nonMaximumSuppression)
+{
+  std::mt19937 random(42);
+  for(int run = 0; run < 50; ++run)
+    for(float threshold : {-0.1f, 0.f, 0.3f, 0.7f})
+    {
+      LabelImage labelImage = createLabelImage(random);
+
+      // The pairwise comparison of all boxes.
+      std::vector<float> expected;
+      for(const LabelImage::Annotation& annotation : labelImage.annotations)
+      {
+        bool best = true;
+        for(const LabelImage::Annotation& cmp : labelImage.annotations)
+          best &= !(annotation.getIou(cmp) > threshold && annotation < cmp);
+        if(best)
+          expected.push_back(annotation.distance);
+      }
+
+      labelImage.nonMaximumSuppression(threshold);
+      EXPECT_EQ(getIds(labelImage), expected) << "threshold: " << threshold;
+    }
+}
+
+GTEST_TEST(LabelImage, bigBoxSuppression)
+{
+  std::mt19937 random(43);
+  for(int run = 0; run < 50; ++run)
+  {
+    LabelImage labelImage = createLabelImage(random);
+
+    // The pairwise comparison of all boxes.
+    std::vector<float> expected;
+    for(const LabelImage::Annotation& annotation : labelImage.annotations)
+    {
+      bool best = true;
+      for(const LabelImage::Annotation& cmp : labelImage.annotations)
+        best &= !annotation.isInside(cmp);
+      if(best)
+        expected.push_back(annotation.distance);
+    }
+
+    labelImage.bigBoxSuppression();
+    EXPECT_EQ(getIds(labelImage), expected);
+  }
+}
+
+GTEST_TEST(LabelImage, softNonMaximumSuppression)
+{
+  LabelImage labelImage;
+  LabelImage::Annotation annotation;
+  annotation.fallen = false;
+  annotation.distance = 0.f;
+  annotation.upperLeft = Vector2f(0.f, 0.f);
+  annotation.lowerRight = Vector2f(100.f, 100.f);
+  annotation.confidence = 0.9f;
+  labelImage.annotations.push_back(annotation);
+  annotation.upperLeft = Vector2f(10.f, 0.f);
+  annotation.lowerRight = Vector2f(110.f, 100.f);
+  annotation.confidence = 0.8f;
+  labelImage.annotations.push_back(annotation);
+  annotation.upperLeft = Vector2f(300.f, 0.f);
+  annotation.lowerRight = Vector2f(400.f, 100.f);
+  annotation.confidence = 0.7f;
+  labelImage.annotations.push_back(annotation);
+
+  // The IoU of the first two boxes is 9/11, so the second is decayed to about 0.21.
+  labelImage.softNonMaximumSuppression(0.5f, 0.1f);
+  ASSERT_EQ(labelImage.annotations.size(), 3u);
+  EXPECT_EQ(labelImage.annotations[0].confidence, 0.9f);
+  EXPECT_EQ(labelImage.annotations[1].confidence, 0.7f);
+  EXPECT_LT(labelImage.annotations[2].confidence, 0.8f);
+  EXPECT_GT(labelImage.annotations[2].confidence, 0.1f);
+
+  labelImage.softNonMaximumSuppression(0.5f, 0.3f);
+  EXPECT_EQ(labelImage.annotations.size(), 2u);
+}
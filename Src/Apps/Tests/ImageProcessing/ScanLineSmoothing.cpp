@@ -0,0 +1,50 @@
+#include "ImageProcessing/ScanLineSmoothing.h"
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+template<int filterSize>
+static void compareWithReference()
+{
+  Image<PixelTypes::GrayscaledPixel> image(80, 12);
+  std::mt19937 random(42);
+  for(unsigned int y = 0; y < image.height; ++y)
+    for(unsigned int x = 0; x < image.width; ++x)
+      image[y][x] = static_cast<PixelTypes::GrayscaledPixel>(random());
+
+  std::vector<int> smoothed(image.width);
+  std::vector<int> reference(image.width);
+  for(unsigned int y = filterSize / 2; y < image.height - filterSize / 2; ++y)
+    for(unsigned int x = 0; x < image.width; ++x)
+      for(unsigned int count = 0; x + count <= image.width; count += 3)
+      {
+        ScanLineSmoothing::smoothVertically<filterSize>(image, x, y, count, smoothed.data());
+        ScanLineSmoothing::smoothVerticallyReference<filterSize>(image, x, y, count, reference.data());
+        for(unsigned int i = 0; i < count; ++i)
+          ASSERT_EQ(reference[i], smoothed[i]);
+      }
+}
+
+GTEST_TEST(ScanLineSmoothing, Filter3x3MatchesReference)
+{
+  compareWithReference<3>();
+}
+
+GTEST_TEST(ScanLineSmoothing, Filter5x5MatchesReference)
+{
+  compareWithReference<5>();
+}
+
+GTEST_TEST(ScanLineSmoothing, SaturatedPixels)
+{
+  Image<PixelTypes::GrayscaledPixel> image(32, 5);
+  for(unsigned int y = 0; y < image.height; ++y)
+    for(unsigned int x = 0; x < image.width; ++x)
+      image[y][x] = 255;
+
+  std::vector<int> smoothed(image.width);
+  ScanLineSmoothing::smoothVertically<5>(image, 0, 2, image.width, smoothed.data());
+  for(int value : smoothed)
+    EXPECT_EQ(10 * 255, value);
+}
@@ -0,0 +1,52 @@
+#include "ImageProcessing/CNS/SubpixelMaximizer.h"
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+/** Gives access to the fitting methods. */
+struct SubpixelMaximizerTest : public SubpixelMaximizer
+{
+  using SubpixelMaximizer::fitUsingSSE3;
+  using SubpixelMaximizer::fitUsingC;
+};
+
+GTEST_TEST(SubpixelMaximizer, FitMatchesReference)
+{
+  const SubpixelMaximizerTest maximizer;
+  std::mt19937 random(42);
+  std::uniform_int_distribution<int> value(-0x3fff, 0x3fff);
+  for(int run = 0; run < 1000; ++run)
+  {
+    // One more layer, because the fit reads over the end.
+    signed short data[4][3][3];
+    float floatData[3][3][3];
+    for(int i = 0; i < 3; ++i)
+      for(int j = 0; j < 3; ++j)
+        for(int k = 0; k < 3; ++k)
+          floatData[i][j][k] = data[i][j][k] = static_cast<signed short>(value(random));
+    float coef[10];
+    float referenceCoef[10];
+    maximizer.fitUsingSSE3(coef, data);
+    maximizer.fitUsingC(referenceCoef, floatData);
+    for(int i = 0; i < 10; ++i)
+      ASSERT_NEAR(referenceCoef[i], coef[i], 1e-3f * std::max(1.f, std::abs(referenceCoef[i])));
+  }
+}
+
+GTEST_TEST(SubpixelMaximizer, MaximumOfQuadraticFunction)
+{
+  const SubpixelMaximizer maximizer;
+  signed short data[4][3][3];
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j)
+      for(int k = 0; k < 3; ++k)
+        data[i][j][k] = static_cast<signed short>(1000 - 100 * ((i - 1.2f) * (i - 1.2f) + (j - 0.9f) * (j - 0.9f) + (k - 1.f) * (k - 1.f)));
+  float value;
+  float arg[3];
+  maximizer.max(value, arg, data);
+  EXPECT_NEAR(0.2f, arg[0], 0.01f);
+  EXPECT_NEAR(-0.1f, arg[1], 0.01f);
+  EXPECT_NEAR(0.f, arg[2], 0.01f);
+  EXPECT_NEAR(1000.f, value, 1.f);
+}
@@ -0,0 +1,50 @@
+#include "Tools/Math/Assignment.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <random>
+
+GTEST_TEST(Assignment, MatchesExhaustiveSearch)
+{
+  std::mt19937 random(42);
+  std::uniform_real_distribution<float> cost(0.f, 100.f);
+
+  for(int trial = 0; trial < 200; ++trial)
+  {
+    const std::size_t rows = 1 + trial % 5;
+    const std::size_t columns = rows + trial % 3;
+    std::vector<float> costs(rows * columns);
+    for(float& c : costs)
+      c = cost(random);
+
+    std::vector<std::size_t> assignment;
+    Assignment::solve(costs, rows, columns, assignment);
+    ASSERT_EQ(rows, assignment.size());
+    std::vector<bool> used(columns, false);
+    float sum = 0.f;
+    for(std::size_t row = 0; row < rows; ++row)
+    {
+      ASSERT_LT(assignment[row], columns);
+      EXPECT_FALSE(used[assignment[row]]);
+      used[assignment[row]] = true;
+      sum += costs[row * columns + assignment[row]];
+    }
+
+    // Try all assignments of the columns to the rows.
+    std::vector<std::size_t> permutation(columns);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    float bestSum = std::numeric_limits<float>::max();
+    do
+    {
+      float permutationSum = 0.f;
+      for(std::size_t row = 0; row < rows; ++row)
+        permutationSum += costs[row * columns + permutation[row]];
+      bestSum = std::min(bestSum, permutationSum);
+    }
+    while(std::next_permutation(permutation.begin(), permutation.end()));
+
+    EXPECT_NEAR(bestSum, sum, 1e-3f);
+  }
+}
@@ -0,0 +1,65 @@
+#include "Math/FastMath.h"
+#include "Math/Probabilistics.h"
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(FastMath, atan)
+{
+  for(int i = -100000; i <= 100000; ++i)
+  {
+    const float x = static_cast<float>(i) / 1000.f;
+    EXPECT_NEAR(FastMath::atan(x), std::atan(x), 1.2e-5f) << "x: " << x;
+  }
+}
+
+GTEST_TEST(FastMath, atan2)
+{
+  for(int i = -500; i <= 500; ++i)
+    for(int j = -500; j <= 500; ++j)
+    {
+      const float y = static_cast<float>(i) / 50.f;
+      const float x = static_cast<float>(j) / 50.f;
+      const float expected = std::atan2(y, x);
+      const float actual = FastMath::atan2(y, x);
+
+      // -pi and pi are the same angle.
+      EXPECT_NEAR(std::abs(expected) > 3.14f ? std::abs(actual) : actual, std::abs(expected) > 3.14f ? std::abs(expected) : expected, 1.2e-5f) << "y: " << y << ", x: " << x;
+    }
+  EXPECT_EQ(FastMath::atan2(0.f, 0.f), 0.f);
+  EXPECT_NEAR(FastMath::atan2(0.f, -1.f), pi, 1e-6f);
+  EXPECT_NEAR(FastMath::atan2(1.f, 0.f), pi_2, 1e-6f);
+  EXPECT_NEAR(FastMath::atan2(-1.f, 0.f), -pi_2, 1e-6f);
+}
+
+GTEST_TEST(FastMath, exp)
+{
+  for(int i = -87000; i <= 88000; ++i)
+  {
+    const float x = static_cast<float>(i) / 1000.f;
+    const double expected = std::exp(static_cast<double>(x));
+    EXPECT_LE(std::abs(FastMath::exp(x) - expected) / expected, 4e-6) << "x: " << x;
+  }
+  EXPECT_EQ(FastMath::exp(-100.f), 0.f);
+  EXPECT_TRUE(std::isfinite(FastMath::exp(100.f)));
+}
+
+GTEST_TEST(FastMath, invSqrt)
+{
+  for(int e = -40; e <= 40; ++e)
+    for(int i = 0; i < 1000; ++i)
+    {
+      const float x = std::ldexp(1.f + static_cast<float>(i) / 1000.f, e);
+      const double expected = 1.0 / std::sqrt(static_cast<double>(x));
+      EXPECT_LE(std::abs(FastMath::invSqrt(x) - expected) / expected, 5e-6) << "x: " << x;
+    }
+}
+
+GTEST_TEST(FastMath, gaussianProbability)
+{
+  for(int i = -5000; i <= 5000; ++i)
+  {
+    const float x = static_cast<float>(i) / 100.f;
+    const float expected = gaussianProbability(x, 7.f);
+    EXPECT_LE(std::abs(FastMath::gaussianProbability(x, 7.f) - expected) / expected, 5e-6f) << "x: " << x;
+  }
+}
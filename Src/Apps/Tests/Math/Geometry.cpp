@@ -0,0 +1,114 @@
+#include "Math/Geometry.h"
+#include "Math/BHMath.h"
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+  std::mt19937 random(42);
+
+  float uniform(float min, float max)
+  {
+    return std::uniform_real_distribution<float>(min, max)(random);
+  }
+
+  /** Random points, a few of them exactly on the vertices of the polygon. */
+  std::vector<Vector2f> createPoints(std::size_t n, const Geometry::FixedPolygon<8>& polygon)
+  {
+    std::vector<Vector2f> points(n);
+    for(std::size_t i = 0; i < n; ++i)
+      points[i] = i % 10 == 0 ? polygon[i / 10 % polygon.size()] : Vector2f(uniform(-200.f, 200.f), uniform(-200.f, 200.f));
+    return points;
+  }
+
+  /** A convex polygon with vertices on a circle. */
+  Geometry::FixedPolygon<8> createPolygon()
+  {
+    Geometry::FixedPolygon<8> polygon;
+    const int numberOfVertices = 3 + static_cast<int>(random() % 6);
+    const float radius = uniform(10.f, 150.f);
+    const float rotation = uniform(-pi, pi);
+    for(int i = 0; i < numberOfVertices; ++i)
+      polygon.push_back(Vector2f(radius, 0.f).rotate(rotation + pi2 * static_cast<float>(i) / static_cast<float>(numberOfVertices)));
+    return polygon;
+  }
+}
+
+GTEST_TEST(Geometry, batchIsPointInsideConvexPolygon)
+{
+  for(int i = 0; i < 100; ++i)
+  {
+    const Geometry::FixedPolygon<8> polygon = createPolygon();
+    const std::vector<Vector2f> points = createPoints(200, polygon);
+    bool inside[200];
+    const std::size_t numberInside = Geometry::isPointInsideConvexPolygon(polygon.data(), static_cast<int>(polygon.size()), points.data(), points.size(), inside);
+    std::size_t expectedInside = 0;
+    for(std::size_t j = 0; j < points.size(); ++j)
+    {
+      const bool expected = Geometry::isPointInsideConvexPolygon(polygon.data(), static_cast<int>(polygon.size()), points[j]);
+      EXPECT_EQ(expected, inside[j]);
+      expectedInside += expected ? 1 : 0;
+    }
+    EXPECT_EQ(expectedInside, numberInside);
+  }
+}
+
+GTEST_TEST(Geometry, batchGetDistanceToEdge)
+{
+  for(int i = 0; i < 100; ++i)
+  {
+    const Geometry::Line edge(Vector2f(uniform(-100.f, 100.f), uniform(-100.f, 100.f)),
+                              i == 0 ? Vector2f::Zero() : Vector2f(uniform(-100.f, 100.f), uniform(-100.f, 100.f)));
+    const std::vector<Vector2f> points = createPoints(100, createPolygon());
+    float distances[100];
+    Geometry::getDistanceToEdge(edge, points.data(), points.size(), distances);
+    for(std::size_t j = 0; j < points.size(); ++j)
+      EXPECT_FLOAT_EQ(Geometry::getDistanceToEdge(edge, points[j]), distances[j]);
+  }
+}
+
+GTEST_TEST(Geometry, batchCheckIntersectionOfLines)
+{
+  for(int i = 0; i < 100; ++i)
+  {
+    const Geometry::FixedPolygon<8> polygon = createPolygon();
+    const std::vector<Vector2f> starts = createPoints(100, polygon);
+    const std::vector<Vector2f> ends = createPoints(100, polygon);
+    const Vector2f l1p1(uniform(-100.f, 100.f), uniform(-100.f, 100.f));
+    const Vector2f l1p2 = i % 2 ? polygon[0] : Vector2f(uniform(-100.f, 100.f), uniform(-100.f, 100.f));
+    bool intersect[100];
+    const std::size_t numberIntersecting = Geometry::checkIntersectionOfLines(l1p1, l1p2, starts.data(), ends.data(), starts.size(), intersect);
+    std::size_t expectedIntersecting = 0;
+    for(std::size_t j = 0; j < starts.size(); ++j)
+    {
+      const bool expected = Geometry::checkIntersectionOfLines(l1p1, l1p2, starts[j], ends[j]);
+      EXPECT_EQ(expected, intersect[j]);
+      expectedIntersecting += expected ? 1 : 0;
+    }
+    EXPECT_EQ(expectedIntersecting, numberIntersecting);
+  }
+}
+
+GTEST_TEST(Geometry, batchCheckIntersectionOfEdgeAndCircles)
+{
+  for(int i = 0; i < 100; ++i)
+  {
+    const Vector2f start(uniform(-100.f, 100.f), uniform(-100.f, 100.f));
+    const Vector2f end = i == 0 ? start : Vector2f(uniform(-100.f, 100.f), uniform(-100.f, 100.f));
+    std::vector<Geometry::Circle> circles;
+    for(const Vector2f& center : createPoints(100, createPolygon()))
+      circles.emplace_back(center, uniform(0.f, 100.f));
+    bool intersect[100];
+    const std::size_t numberIntersected = Geometry::checkIntersectionOfEdgeAndCircles(start, end, circles.data(), circles.size(), intersect);
+    std::size_t expectedIntersected = 0;
+    for(std::size_t j = 0; j < circles.size(); ++j)
+    {
+      const bool expected = Geometry::getDistanceToEdge(Geometry::Line(start, end - start), circles[j].center) <= circles[j].radius;
+      EXPECT_EQ(expected, intersect[j]);
+      expectedIntersected += expected ? 1 : 0;
+    }
+    EXPECT_EQ(expectedIntersected, numberIntersected);
+  }
+}
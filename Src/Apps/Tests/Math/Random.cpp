@@ -0,0 +1,71 @@
+#include "Math/Random.h"
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+GTEST_TEST(Random, philoxKnownAnswers)
+{
+  // Known answers from the reference implementation of Philox4x32-10.
+  using Block = std::array<std::uint32_t, 4>;
+  EXPECT_EQ(Random::Philox::block({0u, 0u, 0u, 0u}, {0u, 0u}), (Block{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}));
+  EXPECT_EQ(Random::Philox::block({0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu}, {0xffffffffu, 0xffffffffu}),
+            (Block{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}));
+  EXPECT_EQ(Random::Philox::block({0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u}, {0xa4093822u, 0x299f31d0u}),
+            (Block{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}));
+}
+
+GTEST_TEST(Random, philoxStreams)
+{
+  Random::Philox a(42, 1);
+  Random::Philox b(42, 1);
+  Random::Philox c = a.split(2);
+  bool allSame = true;
+  for(int i = 0; i < 100; ++i)
+  {
+    const std::uint32_t value = a();
+    EXPECT_EQ(value, b());
+    allSame &= value == c();
+  }
+  EXPECT_FALSE(allSame);
+}
+
+GTEST_TEST(Random, philoxDiscard)
+{
+  Random::Philox a(7);
+  Random::Philox b(7);
+  for(int i = 0; i < 13; ++i)
+    a();
+  b.discard(13);
+  for(int i = 0; i < 10; ++i)
+    EXPECT_EQ(a(), b());
+}
+
+GTEST_TEST(Random, philoxDistributions)
+{
+  Random::Philox philox(3);
+  std::vector<float> values(100001);
+
+  philox.uniform(values.data(), values.size(), -2.f, 3.f);
+  double sum = 0.0;
+  for(float value : values)
+  {
+    EXPECT_GE(value, -2.f);
+    EXPECT_LT(value, 3.f);
+    sum += value;
+  }
+  EXPECT_NEAR(sum / static_cast<double>(values.size()), 0.5, 0.02);
+
+  philox.normal(values.data(), values.size(), 2.f);
+  sum = 0.0;
+  double sumOfSquares = 0.0;
+  for(float value : values)
+  {
+    ASSERT_TRUE(std::isfinite(value));
+    sum += value;
+    sumOfSquares += value * value;
+  }
+  const double mean = sum / static_cast<double>(values.size());
+  EXPECT_NEAR(mean, 0.0, 0.03);
+  EXPECT_NEAR(std::sqrt(sumOfSquares / static_cast<double>(values.size()) - mean * mean), 2.0, 0.03);
+}
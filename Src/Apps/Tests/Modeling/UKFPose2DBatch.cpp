@@ -0,0 +1,68 @@
+#include "Tools/Modeling/UKFPose2DBatch.h"
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+  /** Makes the state of the filter accessible. */
+  struct Hypothesis : public UKFPose2D
+  {
+    void set(const Vector3f& mean, const Matrix3f& cov)
+    {
+      this->mean = mean;
+      this->cov = cov;
+    }
+
+    const Vector3f& getMean() const {return mean;}
+  };
+}
+
+GTEST_TEST(UKFPose2DBatch, MotionUpdateMatchesSingleUpdate)
+{
+  std::mt19937 random(42);
+  std::uniform_real_distribution<float> position(-4500.f, 4500.f);
+  std::uniform_real_distribution<float> angle(-3.f, 3.f);
+  std::uniform_real_distribution<float> deviation(1.f, 300.f);
+  std::uniform_real_distribution<float> translation(-40.f, 40.f);
+  std::uniform_real_distribution<float> rotation(-0.2f, 0.2f);
+
+  const std::size_t numOfHypotheses = 37;
+  std::vector<Hypothesis> single(numOfHypotheses);
+  std::vector<Pose2f> odometryOffsets(numOfHypotheses);
+  for(std::size_t i = 0; i < numOfHypotheses; ++i)
+  {
+    const Vector3f mean(position(random), position(random), angle(random));
+    const Vector3f stdDev(deviation(random), deviation(random), deviation(random) * 0.002f);
+    Matrix3f cov = stdDev.asDiagonal();
+    cov = cov * cov;
+    cov(0, 1) = cov(1, 0) = 0.3f * stdDev.x() * stdDev.y();
+    cov(1, 2) = cov(2, 1) = -0.2f * stdDev.y() * stdDev.z();
+    single[i].set(mean, cov);
+    odometryOffsets[i] = Pose2f(rotation(random), translation(random), translation(random));
+  }
+  std::vector<Hypothesis> batched(single);
+
+  const Pose2f filterProcessDeviation(0.002f, 0.5f, 0.5f);
+  const Pose2f odometryDeviation(0.5f, 0.1f, 0.1f);
+  const Vector2f odometryRotationDeviation(0.0001f, 0.0001f);
+  UKFPose2DBatch batch;
+  for(int frame = 0; frame < 10; ++frame)
+  {
+    for(std::size_t i = 0; i < numOfHypotheses; ++i)
+      single[i].motionUpdate(odometryOffsets[i], filterProcessDeviation, odometryDeviation, odometryRotationDeviation);
+    batch.motionUpdate(batched.data(), numOfHypotheses, odometryOffsets, filterProcessDeviation, odometryDeviation, odometryRotationDeviation);
+  }
+
+  for(std::size_t i = 0; i < numOfHypotheses; ++i)
+  {
+    EXPECT_NEAR(single[i].getMean().x(), batched[i].getMean().x(), 0.05f);
+    EXPECT_NEAR(single[i].getMean().y(), batched[i].getMean().y(), 0.05f);
+    EXPECT_NEAR(Angle::normalize(single[i].getMean().z() - batched[i].getMean().z()), 0.f, 1e-4f);
+    for(int row = 0; row < 3; ++row)
+      for(int column = 0; column < 3; ++column)
+        EXPECT_NEAR(single[i].getCov()(row, column), batched[i].getCov()(row, column),
+                    1e-3f * std::max(1.f, std::abs(single[i].getCov()(row, column))));
+  }
+}
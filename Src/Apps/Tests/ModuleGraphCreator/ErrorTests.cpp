@@ -71,6 +71,60 @@ INSTANTIATE_TEST_CASE_P(UnknownModule, ModuleGraphCreatorDeathTest, testing::Val
     "a: Module XYZ is unknown!\n$"}
 ));
 
+/**
+ * Restricts a module in the first thread of a configuration to a certain state.
+ * @param config The configuration.
+ * @param module The name of the module.
+ * @return The configuration changed.
+ */
+static Configuration addStateDependentModule(Configuration config, const std::string& module)
+{
+  config()[0].stateDependentModules.emplace_back();
+  config()[0].stateDependentModules.back().module = module;
+  config()[0].stateDependentModules.back().states = {"playing"};
+  return config;
+}
+
+// OUTPUT_ERROR(thread.name << ": State dependent module " << stateDependentModule.module << " is unknown!");
+INSTANTIATE_TEST_CASE_P(UnknownStateDependentModule, ModuleGraphCreatorDeathTest, testing::Values(
+  Errors {addStateDependentModule(createConfig({{{"A", "Ac"}}}), "XYZ"),
+    "a: State dependent module XYZ is unknown!\n$"}
+));
+
+/**
+ * Adds a shadow provider to the first thread of a configuration.
+ * @param config The configuration.
+ * @param representation The name of the representation shadowed.
+ * @param provider The name of the shadow provider.
+ * @return The configuration changed.
+ */
+static Configuration addShadowProvider(Configuration config, const std::string& representation, const std::string& provider)
+{
+  config()[0].shadowProviders.emplace_back();
+  config()[0].shadowProviders.back().representation = representation;
+  config()[0].shadowProviders.back().provider = provider;
+  return config;
+}
+
+INSTANTIATE_TEST_CASE_P(InvalidShadowProvider, ModuleGraphCreatorDeathTest, testing::Values(
+  // OUTPUT_ERROR(thread.name << ": Shadow provider " << shadowProvider.provider << " is unknown!");
+  Errors {addShadowProvider(createConfig({{{"A", "Ac"}}}), "A", "XYZ"),
+    "a: Shadow provider XYZ is unknown!\n$"},
+  // OUTPUT_ERROR(thread.name << ": Shadow provider " << shadowProvider.provider << " does not provide " << shadowProvider.representation << "!");
+  Errors {addShadowProvider(createConfig({{{"A", "Ac"}}}), "A", "Bc"),
+    "a: Shadow provider Bc does not provide A!\n$"},
+  // OUTPUT_ERROR(thread.name << ": The representation " << shadowProvider.representation << " shadowed by "
+  //              << shadowProvider.provider << " is not provided by another module!");
+  Errors {addShadowProvider(createConfig({{{"A", "Ac"}}}), "B", "Bc"),
+    "a: The representation B shadowed by Bc is not provided by another module!\n$"},
+  Errors {addShadowProvider(createConfig({{{"B", "Bc"}}}), "B", "Bc"),
+    "a: The representation B shadowed by Bc is not provided by another module!\n$"},
+  // OUTPUT_ERROR(thread.name << ": Representation " << requirement.representation << " required by shadow provider "
+  //              << shadowProvider.provider << " is not available!");
+  Errors {addShadowProvider(createConfig({{{"B", "Bc"}}}), "B", "Cc"),
+    "a: Representation A required by shadow provider Cc is not available!\n$"}
+));
+
 // OUTPUT_ERROR("Default representation " << rrepresentation << " is not required anywhere!");
 INSTANTIATE_TEST_CASE_P(UnknownRepresentation, ModuleGraphCreatorDeathTest, testing::Values(
   // No existing representation.
@@ -85,6 +85,7 @@ protected:
 
   const std::vector<std::vector<std::vector<const char*>>>& received() { return moduleGraphCreator.received; }
   const std::vector<std::vector<std::vector<const char*>>>& sent() { return moduleGraphCreator.sent; }
+  std::size_t numOfPlans() const { return moduleGraphCreator.plans.size(); }
 };
 
 using ExpModuleGraphCreatorDeathTest = ModuleGraphCreatorTest;
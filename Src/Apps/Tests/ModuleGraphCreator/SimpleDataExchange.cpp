@@ -48,6 +48,25 @@ TEST_P(ModuleGraphCreatorSimple, updateTest)
   ASSERT_DEATH(exit(-1), "^$");
 }
 
+// Test switching back to configurations that were already calculated
+TEST_P(ModuleGraphCreatorSimple, cacheTest)
+{
+  update(GetParam().config);
+  const auto received1 = received();
+  const auto sent1 = sent();
+  update(GetParam().config2);
+  const auto received2 = received();
+  const auto sent2 = sent();
+  const std::size_t numOfPlansCalculated = numOfPlans();
+  update(GetParam().config);
+  EXPECT_EQ(received1, received());
+  EXPECT_EQ(sent1, sent());
+  update(GetParam().config2);
+  EXPECT_EQ(received2, received());
+  EXPECT_EQ(sent2, sent());
+  EXPECT_EQ(numOfPlansCalculated, numOfPlans());
+}
+
 // No communication, change a module.
 INSTANTIATE_TEST_CASE_P(ChangeModule, ModuleGraphCreatorSimple, testing::Values(
   // Provide the same.
@@ -0,0 +1,40 @@
+#include "Representations/Perception/ImagePreprocessing/ImageCoordinateSystem.h"
+
+#include <gtest/gtest.h>
+#include <random>
+
+GTEST_TEST(ImageCoordinateSystem, RowCorrectionsMatchAnalyticCorrection)
+{
+  std::mt19937 random(42);
+  std::uniform_real_distribution<float> offsetDistribution(-0.03f, 0.03f);
+  std::uniform_real_distribution<float> xDistribution(0.f, 640.f);
+  std::uniform_real_distribution<float> yDistribution(0.f, 479.99f);
+
+  ImageCoordinateSystem analytic;
+  analytic.cameraInfo.width = 640;
+  analytic.cameraInfo.height = 480;
+  analytic.cameraInfo.opticalCenter = Vector2f(320.f, 240.f);
+  analytic.cameraInfo.openingAngleWidth = 56.3_deg;
+  analytic.cameraInfo.openingAngleHeight = 43.7_deg;
+  analytic.cameraInfo.updateFocalLength();
+
+  for(int i = 0; i < 100; ++i)
+  {
+    analytic.offset = Vector2f(offsetDistribution(random), offsetDistribution(random));
+    analytic.a = -0.5f + static_cast<float>(i % 10) * 0.1f;
+    analytic.b = 0.005f;
+    ImageCoordinateSystem lookup = analytic;
+    lookup.updateRowCorrections();
+
+    for(int j = 0; j < 100; ++j)
+    {
+      const Vector2f point(xDistribution(random), yDistribution(random));
+      const Vector2f corrected = analytic.toCorrected(point);
+      EXPECT_LT((lookup.toCorrected(point) - corrected).norm(), 0.01f);
+
+      // The analytic inverse only iterates until it is closer than half a pixel.
+      EXPECT_LT((lookup.fromCorrected(corrected) - analytic.fromCorrected(corrected)).norm(), 0.5f);
+      EXPECT_LT((lookup.fromCorrected(lookup.toCorrected(point)) - point).norm(), 0.05f);
+    }
+  }
+}
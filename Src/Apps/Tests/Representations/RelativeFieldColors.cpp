@@ -0,0 +1,45 @@
+#include "Representations/Perception/ImagePreprocessing/RelativeFieldColors.h"
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+GTEST_TEST(RelativeFieldColors, RowClassificationMatchesReference)
+{
+  RelativeFieldColors colors;
+  colors.averageLuminance = 120;
+  colors.averageSaturation = 110;
+
+  std::mt19937 random(42);
+  const unsigned numOfPixels = 45;
+  std::vector<PixelTypes::GrayscaledPixel> luminance(numOfPixels);
+  std::vector<PixelTypes::GrayscaledPixel> saturation(numOfPixels);
+  for(unsigned i = 0; i < numOfPixels; ++i)
+  {
+    luminance[i] = static_cast<PixelTypes::GrayscaledPixel>(random());
+    saturation[i] = static_cast<PixelTypes::GrayscaledPixel>(random());
+  }
+
+  bool isField[numOfPixels];
+  bool isWhite[numOfPixels];
+  for(int luminanceReference = 0; luminanceReference < 256; luminanceReference += 5)
+    for(int saturationReference = 0; saturationReference < 256; saturationReference += 5)
+    {
+      const unsigned char lumRef = static_cast<unsigned char>(luminanceReference);
+      const unsigned char satRef = static_cast<unsigned char>(saturationReference);
+      for(unsigned count = 0; count <= numOfPixels; count += 7)
+      {
+        colors.classifyFieldNearWhite(luminance.data(), saturation.data(), count, lumRef, satRef, isField);
+        colors.classifyWhiteNearField(luminance.data(), saturation.data(), count, lumRef, satRef, isWhite);
+        unsigned numOfField = 0;
+        for(unsigned i = 0; i < count; ++i)
+        {
+          const bool field = colors.isFieldNearWhite(luminance[i], saturation[i], lumRef, satRef);
+          ASSERT_EQ(field, isField[i]);
+          ASSERT_EQ(colors.isWhiteNearField(luminance[i], saturation[i], lumRef, satRef), isWhite[i]);
+          numOfField += field ? 1 : 0;
+        }
+        ASSERT_EQ(numOfField, colors.countFieldNearWhite(luminance.data(), saturation.data(), count, lumRef, satRef));
+      }
+    }
+}
@@ -4,6 +4,7 @@
  */
 
 #include "AnnotationManager.h"
+#include <vector>
 
 AnnotationManager::AnnotationManager()
 {
@@ -21,3 +22,18 @@ MessageQueue& AnnotationManager::getOut()
 {
   return outData;
 }
+
+void AnnotationManager::merge(AnnotationManager& other)
+{
+  std::vector<char> buffer;
+  for(MessageQueue::Message message : other.outData)
+  {
+    InBinaryMemory stream = message.bin();
+    unsigned number;
+    stream >> number;
+    buffer.resize(message.size() - sizeof(number));
+    stream.read(buffer.data(), buffer.size());
+    add().write(buffer.data(), buffer.size());
+  }
+  other.outData.clear();
+}
@@ -16,6 +16,14 @@ public:
   MessageQueue::OutBinary add();
   MessageQueue& getOut();
 
+  /**
+   * Moves the annotations of another annotation manager to this one.
+   * They are renumbered to continue the numbering of this manager.
+   * @param other The annotation manager the annotations are taken from.
+   *              It will be empty afterwards.
+   */
+  void merge(AnnotationManager& other);
+
 private:
   MessageQueue outData;
   unsigned annotationCounter = 0;
@@ -0,0 +1,67 @@
+/**
+ * @file ColumnStream.cpp
+ *
+ * The file implements an output stream that extracts selected scalar fields
+ * of data streamed into columns.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "ColumnStream.h"
+#include "Streaming/TypeInfo.h"
+#include <cstdlib>
+
+std::vector<std::string> ColumnStream::getColumns(const TypeInfo& typeInfo, const std::string& type)
+{
+  std::vector<std::string> paths;
+  getColumns(typeInfo, type, "", paths);
+  return paths;
+}
+
+void ColumnStream::getColumns(const TypeInfo& typeInfo, const std::string& type, const std::string& path, std::vector<std::string>& paths)
+{
+  if(type.back() == ']')
+  {
+    const std::size_t endOfType = type.find_last_of('[');
+    const int size = std::atoi(&type[endOfType + 1]);
+    const std::string elementType = type.substr(0, endOfType);
+    for(int i = 0; i < size; ++i)
+      getColumns(typeInfo, elementType, path + "[" + std::to_string(i) + "]", paths);
+  }
+  else if(type.back() == '*')
+    paths.push_back(path);
+  else if(typeInfo.primitives.contains(type))
+  {
+    if(type != "std::string")
+      paths.push_back(path);
+  }
+  else if(typeInfo.enums.contains(type))
+    paths.push_back(path);
+  else
+  {
+    const auto attributes = typeInfo.classes.find(type);
+    if(attributes != typeInfo.classes.end())
+      for(const TypeInfo::Attribute& attribute : attributes->second)
+        getColumns(typeInfo, attribute.type, path.empty() ? attribute.name : path + "." + attribute.name, paths);
+  }
+}
+
+void ColumnStream::select(const char* name, int type, const char*)
+{
+  lengths.push_back(path.size());
+  if(name)
+  {
+    Streaming::trimName(name);
+    if(!path.empty())
+      path += '.';
+    path += name;
+  }
+  else
+    path += "[" + std::to_string(type) + "]";
+}
+
+void ColumnStream::deselect()
+{
+  path.resize(lengths.back());
+  lengths.pop_back();
+}
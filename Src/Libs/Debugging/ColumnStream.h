@@ -0,0 +1,92 @@
+/**
+ * @file ColumnStream.h
+ *
+ * The file declares an output stream that extracts selected scalar fields of
+ * data streamed into columns. It is meant to be used together with the
+ * DebugDataStreamer to convert logged representations into tables.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Math/Angle.h"
+#include "Streaming/InOut.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct TypeInfo;
+
+/**
+ * An output stream that extracts selected scalar fields into columns. Fields
+ * are addressed by paths such as "a.b.x" or "a[2].x". The path of an array
+ * itself yields its number of elements. Strings are not extracted.
+ */
+class ColumnStream : public Out
+{
+public:
+  /**
+   * Constructor.
+   * @param columns Maps the paths of the fields to extract to their columns.
+   * @param data The columns. Only the entries of the given row are written.
+   * @param row The row the values of a single object are written to.
+   */
+  ColumnStream(const std::unordered_map<std::string, std::size_t>& columns, std::vector<std::vector<double>>& data, std::size_t row) :
+    columns(columns), data(data), row(row)
+  {}
+
+  /**
+   * Determines the paths of all fields of a type that can be extracted, i.e.
+   * all fields of primitive types except for strings, all enums, all elements
+   * of arrays with a static size, and the sizes of dynamic arrays.
+   * @param typeInfo The type information used.
+   * @param type The name of the type.
+   * @return The paths of all fields of the type that are extracted.
+   */
+  static std::vector<std::string> getColumns(const TypeInfo& typeInfo, const std::string& type);
+
+private:
+  const std::unordered_map<std::string, std::size_t>& columns; /**< Maps the paths of the fields to extract to their columns. */
+  std::vector<std::vector<double>>& data; /**< The columns. */
+  std::size_t row; /**< The row written to. */
+  std::string path; /**< The path of the field currently streamed. */
+  std::vector<std::size_t> lengths; /**< The lengths of the path before each selection. */
+
+  /**
+   * Writes a value if the current path is one of the extracted fields.
+   * @param value The value to write.
+   */
+  void out(double value)
+  {
+    auto column = columns.find(path);
+    if(column != columns.end())
+      data[column->second][row] = value;
+  }
+
+  /**
+   * Adds the paths of all extractable fields of a type to a list.
+   * @param typeInfo The type information used.
+   * @param type The name of the type.
+   * @param path The path of the field that has this type.
+   * @param paths The list the paths are added to.
+   */
+  static void getColumns(const TypeInfo& typeInfo, const std::string& type, const std::string& path, std::vector<std::string>& paths);
+
+  void outBool(bool value) override { out(value); }
+  void outChar(char value) override { out(value); }
+  void outSChar(signed char value) override { out(value); }
+  void outUChar(unsigned char value) override { out(value); }
+  void outShort(short value) override { out(value); }
+  void outUShort(unsigned short value) override { out(value); }
+  void outInt(int value) override { out(value); }
+  void outUInt(unsigned int value) override { out(value); }
+  void outFloat(float value) override { out(value); }
+  void outDouble(double value) override { out(value); }
+  void outString(const char*) override {}
+  void outAngle(const Angle& value) override { out(static_cast<double>(value)); }
+  void outEndL() override {}
+  void write(const void*, std::size_t) override {}
+  void select(const char* name, int type, const char* enumType = nullptr) override;
+  void deselect() override;
+};
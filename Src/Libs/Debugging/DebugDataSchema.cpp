@@ -0,0 +1,106 @@
+/**
+ * @file DebugDataSchema.cpp
+ *
+ * This file implements a class that compiles the types of a type information
+ * into a flat program that the DebugDataStreamer executes.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "DebugDataSchema.h"
+#include "Streaming/TypeInfo.h"
+#include <cstdlib>
+
+std::size_t DebugDataSchema::getNode(const std::string& type)
+{
+  const auto i = nodesByType.find(type);
+  if(i != nodesByType.end())
+    return i->second;
+
+  // The node is registered before its parts are compiled to support recursive types.
+  const std::size_t index = nodes.size();
+  nodes.emplace_back();
+  nodesByType[type] = index;
+  Opcode opcode = unknown;
+  unsigned size = 0;
+  std::size_t next = 0;
+  const std::vector<std::string>* enumNames = nullptr;
+  const std::unordered_map<std::string, int>* enumValuesByName = nullptr;
+
+  if(!type.empty() && (type.back() == ']' || type.back() == '*'))
+  {
+    if(type.back() == ']')
+    {
+      const std::size_t endOfType = type.find_last_of('[');
+      opcode = staticArray;
+      size = static_cast<unsigned>(std::atoi(&type[endOfType + 1]));
+      next = getNode(type.substr(0, endOfType));
+    }
+    else
+    {
+      opcode = dynamicArray;
+      next = getNode(type.substr(0, type.size() - 1));
+    }
+  }
+  else if(typeInfo.primitives.contains(type))
+  {
+    static const std::unordered_map<std::string, Opcode> primitives =
+    {
+      {"char", charType},
+      {"signed char", signedCharType},
+      {"unsigned char", unsignedCharType},
+      {"short", shortType},
+      {"unsigned short", unsignedShortType},
+      {"int", intType},
+      {"unsigned", unsignedType},
+      {"unsigned int", unsignedType},
+      {"float", floatType},
+      {"double", doubleType},
+      {"bool", boolType},
+      {"Angle", angleType},
+      {"std::string", stringType}
+    };
+    const auto primitive = primitives.find(type);
+    if(primitive != primitives.end())
+      opcode = primitive->second;
+  }
+  else if(const auto e = typeInfo.enums.find(type); e != typeInfo.enums.end())
+  {
+    opcode = enumType;
+    enumNames = &e->second;
+    std::unordered_map<std::string, int>& values = enumValues[type];
+    values.clear();
+    for(std::size_t i = 0; i < enumNames->size(); ++i)
+      values.emplace((*enumNames)[i], static_cast<int>(i));
+    enumValuesByName = &values;
+  }
+  else if(const auto c = typeInfo.classes.find(type); c != typeInfo.classes.end())
+  {
+    // The types of the attributes are compiled first, because the fields of a record must be consecutive.
+    std::vector<Field> attributes;
+    attributes.reserve(c->second.size());
+    for(const TypeInfo::Attribute& attribute : c->second)
+      attributes.push_back({attribute.name.c_str(), getNode(attribute.type)});
+    opcode = record;
+    size = static_cast<unsigned>(attributes.size());
+    next = fields.size();
+    fields.insert(fields.end(), attributes.begin(), attributes.end());
+  }
+
+  Node& node = nodes[index];
+  node.opcode = opcode;
+  node.size = size;
+  node.next = next;
+  node.enumType.byOrder = enumNames;
+  node.enumType.byName = enumValuesByName;
+  node.type = type;
+  return index;
+}
+
+void DebugDataSchema::clear()
+{
+  nodes.clear();
+  fields.clear();
+  nodesByType.clear();
+  enumValues.clear();
+}
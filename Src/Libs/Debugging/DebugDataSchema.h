@@ -0,0 +1,102 @@
+/**
+ * @file DebugDataSchema.h
+ *
+ * This file declares a class that compiles the types of a type information
+ * into a flat program that the DebugDataStreamer executes. Thereby, the type
+ * names are only parsed and looked up once per type instead of for every
+ * value streamed. A schema compiles types when they are requested for the
+ * first time. It refers to the type information it was created for, i.e. it
+ * must be cleared if that type information changes and it must not outlive it.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Streaming/TypeRegistry.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct TypeInfo;
+
+class DebugDataSchema
+{
+public:
+  /** The operations of a schema program. */
+  enum Opcode : unsigned char
+  {
+    charType,
+    signedCharType,
+    unsignedCharType,
+    shortType,
+    unsignedShortType,
+    intType,
+    unsignedType,
+    floatType,
+    doubleType,
+    boolType,
+    angleType,
+    stringType,
+    enumType,
+    staticArray,
+    dynamicArray,
+    record,
+    unknown, /**< The type is not streamable. Streaming it fails. */
+  };
+
+  /** A compiled type. */
+  struct Node
+  {
+    Opcode opcode = unknown; /**< The operation that streams the type. */
+    unsigned size = 0; /**< The number of elements of a static array or the number of attributes of a record. */
+    std::size_t next = 0; /**< The node of the elements of an array or the first field of a record. */
+    TypeRegistry::DynamicEnum enumType; /**< The enum type in the format expected by In::select and Out::select. */
+    std::string type; /**< The name of the type. */
+  };
+
+  /** An attribute of a record. */
+  struct Field
+  {
+    const char* name; /**< The name of the attribute. */
+    std::size_t node; /**< The node of the type of the attribute. */
+  };
+
+private:
+  const TypeInfo& typeInfo; /**< The type information the program is compiled from. */
+  std::vector<Node> nodes; /**< The program. */
+  std::vector<Field> fields; /**< The attributes of all records. */
+  std::unordered_map<std::string, std::size_t> nodesByType; /**< The node of each type compiled. */
+  std::unordered_map<std::string, std::unordered_map<std::string, int>> enumValues; /**< The values of the constants of each enum type compiled, indexed by their names. */
+
+public:
+  /**
+   * Constructor.
+   * @param typeInfo The type information the program is compiled from.
+   */
+  DebugDataSchema(const TypeInfo& typeInfo) : typeInfo(typeInfo) {}
+
+  /**
+   * Returns the node for a type. The type is compiled if this did not happen yet.
+   * @param type The name of the type.
+   * @return The index of the node.
+   */
+  std::size_t getNode(const std::string& type);
+
+  /**
+   * Returns a node of the program.
+   * @param index The index of the node.
+   * @return The node.
+   */
+  const Node& operator[](std::size_t index) const {return nodes[index];}
+
+  /**
+   * Returns an attribute of a record.
+   * @param index The index of the attribute.
+   * @return The attribute.
+   */
+  const Field& field(std::size_t index) const {return fields[index];}
+
+  /** Forgets all types compiled, e.g. because the type information changed. */
+  void clear();
+};
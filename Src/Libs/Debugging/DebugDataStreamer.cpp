@@ -10,149 +10,146 @@
 #include "Platform/BHAssert.h"
 #include "Streaming/InStreams.h"
 #include "Streaming/Output.h"
-#include "Streaming/TypeInfo.h"
 #include <sstream>
 
 DebugDataStreamer::DebugDataStreamer(const TypeInfo& typeInfo, In& stream, const std::string& type, const char* name) :
-  typeInfo(typeInfo), inData(&stream), type(type), name(name)
+  ownSchema(std::make_unique<DebugDataSchema>(typeInfo)), schema(*ownSchema), inData(&stream), type(type), name(name)
 {}
 
 DebugDataStreamer::DebugDataStreamer(const TypeInfo& typeInfo, Out& stream, const std::string& type, const char* name) :
-  typeInfo(typeInfo), outData(&stream), type(type), name(name)
+  ownSchema(std::make_unique<DebugDataSchema>(typeInfo)), schema(*ownSchema), outData(&stream), type(type), name(name)
+{}
+
+DebugDataStreamer::DebugDataStreamer(DebugDataSchema& schema, In& stream, const std::string& type, const char* name) :
+  schema(schema), inData(&stream), type(type), name(name)
+{}
+
+DebugDataStreamer::DebugDataStreamer(DebugDataSchema& schema, Out& stream, const std::string& type, const char* name) :
+  schema(schema), outData(&stream), type(type), name(name)
 {}
 
 void DebugDataStreamer::serialize(In* in, Out* out)
 {
   ASSERT((inData && out) || (outData && in));
+  execute(schema.getNode(type), in, out, name, -2);
+}
 
-  if(type[type.size() - 1] == ']' || type[type.size() - 1] == '*')
+void DebugDataStreamer::execute(std::size_t index, In* in, Out* out, const char* name, int elementIndex)
+{
+  const DebugDataSchema::Node& node = schema[index];
+  switch(node.opcode)
   {
-    unsigned size = 0;
-    std::string elementType;
-    bool staticSize = type[type.size() - 1] == ']';
-    if(staticSize)
-    {
-      size_t endOfType = type.find_last_of('[');
-      size = atoi(&type[endOfType + 1]);
-      elementType = type.substr(0, endOfType);
-    }
-    else
+    case DebugDataSchema::charType:
+      streamIt<char>(in, out, name, elementIndex);
+      break;
+    case DebugDataSchema::signedCharType:
+      streamIt<signed char>(in, out, name, elementIndex);
+      break;
+    case DebugDataSchema::unsignedCharType:
+      streamIt<unsigned char>(in, out, name, elementIndex);
+      break;
+    case DebugDataSchema::shortType:
+      streamIt<short>(in, out, name, elementIndex);
+      break;
+    case DebugDataSchema::unsignedShortType:
+      streamIt<unsigned short>(in, out, name, elementIndex);
+      break;
+    case DebugDataSchema::intType:
+      streamIt<int>(in, out, name, elementIndex);
+      break;
+    case DebugDataSchema::unsignedType:
+      streamIt<unsigned>(in, out, name, elementIndex);
+      break;
+    case DebugDataSchema::floatType:
+      streamIt<float>(in, out, name, elementIndex);
+      break;
+    case DebugDataSchema::doubleType:
+      streamIt<double>(in, out, name, elementIndex);
+      break;
+    case DebugDataSchema::boolType:
+      streamIt<bool>(in, out, name, elementIndex);
+      break;
+    case DebugDataSchema::angleType:
+      streamIt<Angle>(in, out, name, elementIndex);
+      break;
+    case DebugDataSchema::stringType:
+      streamIt<std::string>(in, out, name, elementIndex);
+      break;
+    case DebugDataSchema::enumType:
+      streamIt<unsigned char>(in, out, name, elementIndex, reinterpret_cast<const char*>(&node.enumType));
+      break;
+    case DebugDataSchema::staticArray:
+    case DebugDataSchema::dynamicArray:
+      executeArray(node, in, out, name);
+      break;
+    case DebugDataSchema::record:
     {
-      elementType = type.substr(0, type.size() - 1);
-      if(inData)
-        *inData >> size;
-    }
-
-    if(in)
-    {
-      in->select(name, -1);
-      unsigned dynamicSize;
-      *in >> dynamicSize;
-      if(!staticSize)
+      const bool select = name != 0 || elementIndex >= 0;
+      if(select)
       {
-        size = dynamicSize;
-        *outData << size;
+        if(in)
+          in->select(name, elementIndex);
+        else
+          out->select(name, elementIndex);
       }
-      else if(size != dynamicSize)
+      for(std::size_t i = node.next; i < node.next + node.size; ++i)
+        execute(schema.field(i).node, in, out, schema.field(i).name, -2);
+      if(select)
       {
-        std::ostringstream stream;
-        stream << "array has " << dynamicSize << " elements instead of " << size;
-        InMap* inMap = dynamic_cast<InMap*>(in);
-        if(inMap)
-          inMap->printError(stream.str(), InMap::outOfRange);
+        if(in)
+          in->deselect();
         else
-        {
-          OUTPUT_ERROR(stream.str());
-          size = dynamicSize;
-        }
+          out->deselect();
       }
+      break;
     }
-    else
-    {
-      out->select(name, -1);
-      *out << size;
-    }
+    default:
+      FAIL("Specification for " << node.type << " not found");
+  }
+}
 
-    for(unsigned i = 0; i < size; ++i)
-    {
-      // set attributes for recursive call to this method
-      type = elementType;
-      name = 0;
-      index = static_cast<int>(i);
-      if(in)
-        *in >> *this;
-      else
-        *out << *this;
-    }
+void DebugDataStreamer::executeArray(const DebugDataSchema::Node& node, In* in, Out* out, const char* name)
+{
+  const bool staticSize = node.opcode == DebugDataSchema::staticArray;
+  unsigned size = node.size;
+  if(!staticSize && inData)
+    *inData >> size;
 
-    if(in)
-      in->deselect();
-    else
-      out->deselect();
-  }
-  else if(typeInfo.primitives.find(type) != typeInfo.primitives.end())
-  {
-    if(type == "char")
-      streamIt<char>(in, out);
-    else if(type == "signed char")
-      streamIt<signed char>(in, out);
-    else if(type == "unsigned char")
-      streamIt<unsigned char>(in, out);
-    else if(type == "short")
-      streamIt<short>(in, out);
-    else if(type == "unsigned short")
-      streamIt<unsigned short>(in, out);
-    else if(type == "int")
-      streamIt<int>(in, out);
-    else if(type == "unsigned" || type == "unsigned int")
-      streamIt<unsigned>(in, out);
-    else if(type == "float")
-      streamIt<float>(in, out);
-    else if(type == "double")
-      streamIt<double>(in, out);
-    else if(type == "bool")
-      streamIt<bool>(in, out);
-    else if(type == "Angle")
-      streamIt<Angle>(in, out);
-    else if(type == "std::string")
-      streamIt<std::string>(in, out);
-    else
-      FAIL(type << " is not a streamable type!");
-  }
-  else if(typeInfo.enums.find(type) != typeInfo.enums.end())
+  if(in)
   {
-    const std::vector<std::string>* enumType[2] = {nullptr, &typeInfo.enums.find(type)->second};
-    streamIt<unsigned char>(in, out, reinterpret_cast<const char*>(enumType));
-  }
-  else if(typeInfo.classes.find(type) != typeInfo.classes.end())
-  {
-    bool select = name != 0 || index >= 0;
-    if(select)
+    in->select(name, -1);
+    unsigned dynamicSize;
+    *in >> dynamicSize;
+    if(!staticSize)
     {
-      if(in)
-        in->select(name, index);
-      else
-        out->select(name, index);
+      size = dynamicSize;
+      *outData << size;
     }
-    for(const TypeInfo::Attribute& attribute : typeInfo.classes.find(type)->second)
+    else if(size != dynamicSize)
     {
-      // set attributes for recursive call to this method
-      type = attribute.type;
-      name = attribute.name.c_str();
-      index = -2;
-      if(in)
-        *in >> *this;
+      std::ostringstream stream;
+      stream << "array has " << dynamicSize << " elements instead of " << size;
+      InMap* inMap = dynamic_cast<InMap*>(in);
+      if(inMap)
+        inMap->printError(stream.str(), InMap::outOfRange);
       else
-        *out << *this;
-    }
-    if(select)
-    {
-      if(in)
-        in->deselect();
-      else
-        out->deselect();
+      {
+        OUTPUT_ERROR(stream.str());
+        size = dynamicSize;
+      }
     }
   }
   else
-    FAIL("Specification for " << type << " not found");
+  {
+    out->select(name, -1);
+    *out << size;
+  }
+
+  for(unsigned i = 0; i < size; ++i)
+    execute(node.next, in, out, nullptr, static_cast<int>(i));
+
+  if(in)
+    in->deselect();
+  else
+    out->deselect();
 }
@@ -7,9 +7,9 @@
 
 #pragma once
 
+#include "DebugDataSchema.h"
 #include "Streaming/Streamable.h"
-
-struct TypeInfo;
+#include <memory>
 
 /**
  * A class that makes the debug data in a stream streamable according to the
@@ -17,17 +17,20 @@ struct TypeInfo;
  * an object for reading from a debug data stream, the other one for writing
  * to it. Since the object represents the stream that it encapsulates, it
  * must be used with matching streaming operators, i.e. >> if it encapsulates
- * a writing stream and << for a reading stream.
+ * a writing stream and << for a reading stream. The data is streamed by
+ * executing the program a DebugDataSchema compiled for its type. Users that
+ * stream many messages should pass a schema they keep, so that each type is
+ * only compiled once.
  */
 class DebugDataStreamer : public Streamable
 {
 private:
-  const TypeInfo& typeInfo; /**< The type information for the data streamed. */
+  std::unique_ptr<DebugDataSchema> ownSchema; /**< The schema if none was passed to the constructor. */
+  DebugDataSchema& schema; /**< The compiled type information for the data streamed. */
   In* inData = nullptr; /**< The debug data stream to read from. 0 if we are writing. */
   Out* outData = nullptr; /**< The debug data stream to write to. 0 if we are reading. */
-  std::string type; /**< The string representation of the type of the next data streamed. */
-  const char* name; /**< The name of the next entry streamed. 0 if it does not have a name, because it is an array element. */
-  int index = -2; /**< The index of the next element streamed or -2 if we are currently not streaming an array. */
+  std::string type; /**< The string representation of the type of the data streamed. */
+  const char* name; /**< The name of the data streamed. 0 if it does not have a name. */
 
   /**
    * The method streams the debug data according to its specification.
@@ -49,13 +52,34 @@ private:
   void write(Out& stream) const override {const_cast<DebugDataStreamer*>(this)->serialize(nullptr, &stream);}
 
   /**
-   * The method streams an entry.
+   * The method streams an entry according to a node of the schema.
+   * @param index The index of the node of the type of the entry.
+   * @param in The stream from which the object is read. Must be 0 if this object was constructed for a reading stream.
+   * @param out The stream to which the object is written. Must be 0 if this object was constructed for a writing stream.
+   * @param name The name of the entry. 0 if it does not have a name, because it is an array element.
+   * @param elementIndex The index of the entry or -2 if it is not an array element.
+   */
+  void execute(std::size_t index, In* in, Out* out, const char* name, int elementIndex);
+
+  /**
+   * The method streams an array.
+   * @param node The node of the array.
+   * @param in The stream from which the object is read. Must be 0 if this object was constructed for a reading stream.
+   * @param out The stream to which the object is written. Must be 0 if this object was constructed for a writing stream.
+   * @param name The name of the array. 0 if it does not have a name, because it is an array element.
+   */
+  void executeArray(const DebugDataSchema::Node& node, In* in, Out* out, const char* name);
+
+  /**
+   * The method streams a primitive entry.
    * @param T The type of the entry to be streamed.
    * @param in The stream from which the object is read. Must be 0 if this object was constructed for a reading stream.
    * @param out The stream to which the object is written. Must be 0 if this object was constructed for a writing stream.
+   * @param name The name of the entry. 0 if it does not have a name, because it is an array element.
+   * @param index The index of the entry or -2 if it is not an array element.
    * @param enumType The type as string if it is an enum. Otherwise nullptr.
    */
-  template<typename T> void streamIt(In* in, Out* out, const char* enumType = nullptr);
+  template<typename T> void streamIt(In* in, Out* out, const char* name, int index, const char* enumType = nullptr);
 
 public:
   /**
@@ -68,6 +92,16 @@ public:
    */
   DebugDataStreamer(const TypeInfo& typeInfo, In& stream, const std::string& type, const char* name = nullptr);
 
+  /**
+   * Constructs an object that reads from a debug data stream.
+   * Note that this object can only be used together with the << operator.
+   * @param schema The compiled type information for the data streamed.
+   * @param stream The debug data stream to read from.
+   * @param type The string representation of the type of the data streamed.
+   * @param name The name of the data streamed. 0 if it does not have a name.
+   */
+  DebugDataStreamer(DebugDataSchema& schema, In& stream, const std::string& type, const char* name = nullptr);
+
   /**
    * Constructs an object that writes to a debug data stream.
    * Note that this object can only be used together with the >> operator.
@@ -77,9 +111,19 @@ public:
    * @param name The name of the data streamed. 0 if it does not have a name.
    */
   DebugDataStreamer(const TypeInfo& typeInfo, Out& stream, const std::string& type, const char* name = nullptr);
+
+  /**
+   * Constructs an object that writes to a debug data stream.
+   * Note that this object can only be used together with the >> operator.
+   * @param schema The compiled type information for the data streamed.
+   * @param stream The debug data stream to write to.
+   * @param type The string representation of the type of the data streamed.
+   * @param name The name of the data streamed. 0 if it does not have a name.
+   */
+  DebugDataStreamer(DebugDataSchema& schema, Out& stream, const std::string& type, const char* name = nullptr);
 };
 
-template<typename T> void DebugDataStreamer::streamIt(In* in, Out* out, const char* enumType)
+template<typename T> void DebugDataStreamer::streamIt(In* in, Out* out, const char* name, int index, const char* enumType)
 {
   T t = T();
   if(in)
@@ -38,6 +38,7 @@ void DrawingManager::clear()
   strings.clear();
   drawingsById.clear();
   typesById.clear();
+  idsBySlot.clear();
 }
 
 const char* DrawingManager::getString(const std::string& string)
@@ -57,8 +58,10 @@ In& operator>>(In& stream, DrawingManager& drawingManager)
   // note that this operator appends the data read to the drawingManager
   // clear() has to be called first to replace the existing data
 
+  drawingManager.idsBySlot.clear();
+
   int size;
-  stream >> size;;
+  stream >> size;
   for(int i = 0; i < size; ++i)
   {
     std::string str;
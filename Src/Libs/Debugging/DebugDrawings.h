@@ -10,6 +10,7 @@
 #include "Math/Covariance.h"
 #include "Math/Eigen.h"
 #include <unordered_map>
+#include <vector>
 
 namespace Drawings
 {
@@ -21,7 +22,8 @@ namespace Drawings
   {
     arc, arrow, circle, dot, dotLarge, dotMedium, ellipse,
     line, origin, polygon, rectangle, text, tip, robot, spot,
-    thread, gridMono, gridRGBA, gridRectangleRGBA
+    thread, gridMono, gridRGBA, gridRectangleRGBA,
+    binaryPolygon /**< A polygon with its points in binary format. \c polygon is only kept to read old logs. */
   };
 
   /** The pen style that is used for basic shapes*/
@@ -52,6 +54,15 @@ public:
   void clear();
   void addDrawingId(const char* name, const char* typeName);
   char getDrawingId(const char* name) const;
+
+  /**
+   * Determines the id of a drawing and caches it.
+   * @param slot The slot of the debug request that belongs to the drawing.
+   * @param name The name of the drawing.
+   * @return The id of the drawing or -1 if it was not declared.
+   */
+  char getDrawingId(std::size_t slot, const char* name);
+
   const char* getDrawingType(const char* name) const;
   const char* getDrawingName(char id) const;
   const char* getString(const std::string& string);
@@ -67,6 +78,8 @@ private:
   std::unordered_map<char, const char*> drawingsById;
   std::unordered_map<char, const char*> typesById;
 
+  std::vector<short> idsBySlot; /**< Drawing ids indexed by the slots of their debug requests (-1 if unknown). */
+
   friend class DrawingManager3D;
   friend In& operator>>(In& stream, DrawingManager&);
   friend Out& operator<<(Out& stream, const DrawingManager&);
@@ -84,6 +97,20 @@ inline char DrawingManager::getDrawingId(const char* name) const
   return -1;
 }
 
+inline char DrawingManager::getDrawingId(std::size_t slot, const char* name)
+{
+  if(slot < idsBySlot.size() && idsBySlot[slot] != -1)
+    return static_cast<char>(idsBySlot[slot]);
+  const char id = getDrawingId(name);
+  if(id != -1)
+  {
+    if(slot >= idsBySlot.size())
+      idsBySlot.resize(slot + 1, -1);
+    idsBySlot[slot] = id;
+  }
+  return id;
+}
+
 inline const char* DrawingManager::getDrawingType(const char* name) const
 {
   std::unordered_map< const char*, Drawing>::const_iterator i = drawings.find(name);
@@ -113,6 +140,28 @@ inline const char* DrawingManager::getTypeName(char id) const
 
 #if !defined TARGET_ROBOT || !defined NDEBUG
 
+/**
+ * Determines the id of a drawing. The lookup is cached per call site.
+ * @param id A drawing id
+ */
+#define _DRAWING_ID(id) \
+  Global::getDrawingManager().getDrawingId(_DEBUG_REQUEST_SLOT("debug drawing:" id), id)
+
+/**
+ * Sends a shape. Shapes of the same drawing that are sent one after another
+ * are batched into a single message.
+ * @param id A drawing id
+ * @param shapeType The type of the shape (Drawings::ShapeType)
+ * @param expression The streaming expression that writes the shape's data
+ */
+#define _DRAWING_OUTPUT(id, shapeType, expression) \
+  do \
+  { \
+    const char _drawingId = _DRAWING_ID(id); \
+    Global::getDebugOut().bin(idDebugDrawing, 1, _drawingId) << static_cast<char>(shapeType) << _drawingId << expression; \
+  } \
+  while(false)
+
 /**
  * A macro that declares
  * @param id A drawing id
@@ -120,7 +169,7 @@ inline const char* DrawingManager::getTypeName(char id) const
  * and executes the following block if the drawing is requested.
  */
 #define DEBUG_DRAWING(id, type) \
-  if(Global::getDrawingManager().addDrawingId(id, type), _debugRequestActive("debug drawing:" id))
+  if(Global::getDrawingManager().addDrawingId(id, type), _debugRequestActive(_DEBUG_REQUEST_SLOT("debug drawing:" id), "debug drawing:" id))
 
 /**
  * A macro that declares
@@ -158,9 +207,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::circle) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::circle, \
              static_cast<int>(center_x) << static_cast<int>(center_y) << \
              static_cast<int>(radius) << static_cast<char>(penWidth) << \
              static_cast<char>(penStyle) << ColorRGBA(penColor) << \
@@ -187,9 +234,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::arc) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::arc, \
              static_cast<int>(center_x) << static_cast<int>(center_y) << static_cast<int>(radius) << \
              Angle(startAngle) << Angle(spanAngle) << \
              static_cast<char>(penWidth) << \
@@ -216,9 +261,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::ellipse) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::ellipse, \
              static_cast<int>((center).x()) << static_cast<int>((center).y()) << \
              static_cast<int>(radiusX) << static_cast<int>(radiusY) << static_cast<float>(rotation) << \
              static_cast<char>(penWidth) << static_cast<char>(penStyle) << ColorRGBA(penColor) << \
@@ -242,9 +285,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::rectangle) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::rectangle, \
              static_cast<int>((topLeft).x()) << static_cast<int>((topLeft).y()) << \
              static_cast<int>(width) << static_cast<int>(height) << static_cast<float>(rotation) << \
              static_cast<char>(penWidth) << static_cast<char>(penStyle) << ColorRGBA(penColor) << \
@@ -268,17 +309,14 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OutTextMemory _stream(static_cast<int>(numberOfPoints) * 12); \
-      for(int _i = 0; _i < static_cast<int>(numberOfPoints); ++_i) \
+      const int _numberOfPoints = static_cast<int>(numberOfPoints); \
+      const char _drawingId = _DRAWING_ID(id); \
+      auto _stream = Global::getDebugOut().bin(idDebugDrawing, 1, _drawingId); \
+      _stream << static_cast<char>(Drawings::binaryPolygon) << _drawingId << _numberOfPoints; \
+      for(int _i = 0; _i < _numberOfPoints; ++_i) \
         _stream << static_cast<int>(points[_i].x()) << static_cast<int>(points[_i].y()); \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::polygon) << \
-             Global::getDrawingManager().getDrawingId(id) << \
-             static_cast<int>(numberOfPoints) << \
-             _stream.data() << \
-             static_cast<char>(penWidth) << static_cast<char>(penStyle) << ColorRGBA(penColor) << \
-             static_cast<char>(brushStyle) << ColorRGBA(brushColor) \
-            );  \
+      _stream << static_cast<char>(penWidth) << static_cast<char>(penStyle) << ColorRGBA(penColor) \
+              << static_cast<char>(brushStyle) << ColorRGBA(brushColor); \
     } \
   while(false)
 
@@ -294,9 +332,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::dot) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::dot, \
              static_cast<int>(x) << static_cast<int>(y) << ColorRGBA(penColor) << ColorRGBA(brushColor) \
             ); \
     } \
@@ -313,9 +349,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::dot) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::dot, \
              static_cast<int>((xy).x()) << static_cast<int>((xy).y()) << \
              ColorRGBA(penColor) << ColorRGBA(brushColor) \
             ); \
@@ -334,9 +368,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::dotMedium) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::dotMedium, \
              static_cast<int>(x) << static_cast<int>(y) << ColorRGBA(penColor) << ColorRGBA(brushColor) \
             ); \
     } \
@@ -354,9 +386,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::dotLarge) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::dotLarge, \
              static_cast<int>(x) << static_cast<int>(y) << ColorRGBA(penColor) << ColorRGBA(brushColor) \
             ); \
     } \
@@ -377,9 +407,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::line) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::line, \
              static_cast<float>(x1) << static_cast<float>(y1) << \
              static_cast<float>(x2) << static_cast<float>(y2) << \
              static_cast<float>(penWidth) << static_cast<char>(penStyle) << ColorRGBA(penColor) \
@@ -409,9 +437,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::arrow) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::arrow, \
              static_cast<float>(x1) << static_cast<float>(y1) << \
              static_cast<float>(x2) << static_cast<float>(y2) << \
              static_cast<float>(penWidth) << static_cast<char>(penStyle) << ColorRGBA(penColor) \
@@ -513,9 +539,7 @@ inline const char* DrawingManager::getTypeName(char id) const
     { \
       OutTextRawMemory _stream; \
       _stream << txt; \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::text) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::text, \
              static_cast<int>(x) << static_cast<int>(y) << \
              static_cast<short>(fontSize) << ColorRGBA(color) << _stream.data() \
             ); \
@@ -531,9 +555,7 @@ inline const char* DrawingManager::getTypeName(char id) const
     { \
       OutTextRawMemory _stream(1024); \
       _stream << action; \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::spot) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::spot, \
              static_cast<int>(x1) << static_cast<int>(y1) << \
              static_cast<int>(x2) << static_cast<int>(y2) << _stream.data() \
             ); \
@@ -554,9 +576,7 @@ inline const char* DrawingManager::getTypeName(char id) const
     { \
       OutTextRawMemory _stream(1024); \
       _stream << text; \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::tip) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::tip, \
              static_cast<int>(x) << static_cast<int>(y) << static_cast<int>(radius) << _stream.data() \
             ); \
     } \
@@ -571,9 +591,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::thread) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::thread, \
              (threadName) \
             ); \
     } \
@@ -590,9 +608,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::origin) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::origin, \
              static_cast<int>(x) << static_cast<int>(y) << static_cast<float>(angle) \
             ); \
     } \
@@ -613,9 +629,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::robot) << \
-             Global::getDrawingManager().getDrawingId(id) << \
+      _DRAWING_OUTPUT(id, Drawings::robot, \
              Pose2f(p) << Vector2f(dirVec) << Vector2f(dirHeadVec) << \
              static_cast<float>(alphaRobot) << ColorRGBA(colorBody) << ColorRGBA(colorDirVec) << ColorRGBA(colorDirHeadVec)); \
     } \
@@ -758,9 +772,9 @@ inline const char* DrawingManager::getTypeName(char id) const
     { \
       const int _cellsX = static_cast<int>(cellsX); \
       const int _cellsY = static_cast<int>(cellsY); \
-      auto _stream = Global::getDebugOut().bin(idDebugDrawing); \
-      _stream << static_cast<char>(Drawings::gridMono) \
-              << Global::getDrawingManager().getDrawingId(id) \
+      const char _drawingId = _DRAWING_ID(id); \
+      auto _stream = Global::getDebugOut().bin(idDebugDrawing, 1, _drawingId); \
+      _stream << static_cast<char>(Drawings::gridMono) << _drawingId \
               << static_cast<int>(x) << static_cast<int>(y) << static_cast<int>(cellSize) \
               << _cellsX << _cellsY << ColorRGBA(baseColor); \
       _stream.write(cells, _cellsX * _cellsY); \
@@ -783,9 +797,9 @@ inline const char* DrawingManager::getTypeName(char id) const
     { \
       const int _cellsX = static_cast<int>(cellsX); \
       const int _cellsY = static_cast<int>(cellsY); \
-      auto _stream = Global::getDebugOut().bin(idDebugDrawing); \
-      _stream << static_cast<char>(Drawings::gridRGBA) \
-              << Global::getDrawingManager().getDrawingId(id) \
+      const char _drawingId = _DRAWING_ID(id); \
+      auto _stream = Global::getDebugOut().bin(idDebugDrawing, 1, _drawingId); \
+      _stream << static_cast<char>(Drawings::gridRGBA) << _drawingId \
               << static_cast<int>(x) << static_cast<int>(y) << static_cast<int>(cellSize) \
               << _cellsX << _cellsY; \
       _stream.write(cells, _cellsX * _cellsY * sizeof(ColorRGBA)); \
@@ -809,9 +823,9 @@ inline const char* DrawingManager::getTypeName(char id) const
     { \
       const int _cellsX = static_cast<int>(cellsX); \
       const int _cellsY = static_cast<int>(cellsY); \
-      auto _stream = Global::getDebugOut().bin(idDebugDrawing); \
-      _stream << static_cast<char>(Drawings::gridRectangleRGBA) \
-              << Global::getDrawingManager().getDrawingId(id) \
+      const char _drawingId = _DRAWING_ID(id); \
+      auto _stream = Global::getDebugOut().bin(idDebugDrawing, 1, _drawingId); \
+      _stream << static_cast<char>(Drawings::gridRectangleRGBA) << _drawingId \
               << static_cast<int>(x) << static_cast<int>(y) << static_cast<int>(cellWidth) \
               << static_cast<int>(cellHeight) << _cellsX << _cellsY; \
       _stream.write(cells, _cellsX * _cellsY * sizeof(ColorRGBA)); \
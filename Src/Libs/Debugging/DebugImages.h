@@ -32,7 +32,7 @@ public:
   DebugImage(const Image<PixelTypes::BGRAPixel>& image)
     : data(const_cast<void*>(static_cast<const void*>(image[0]))), width(static_cast<unsigned short>(image.width)), height(static_cast<unsigned short>(image.height)), isReference(true), type(PixelTypes::PixelType::BGRA) {}
   DebugImage(const Image<PixelTypes::YUYVPixel>& image, const bool copy = false)
-    : data(copy ? Memory::alignedMalloc(image.width * image.height * sizeof(PixelTypes::YUYVPixel), 32) : const_cast<void*>(static_cast<const void*>(image[0]))), width(static_cast<unsigned short>(image.width)), height(static_cast<unsigned short>(image.height)), isReference(!copy), type(PixelTypes::PixelType::YUYV)
+    : data(copy ? Memory::largeMalloc(image.width * image.height * sizeof(PixelTypes::YUYVPixel), Memory::debugImages) : const_cast<void*>(static_cast<const void*>(image[0]))), width(static_cast<unsigned short>(image.width)), height(static_cast<unsigned short>(image.height)), isReference(!copy), type(PixelTypes::PixelType::YUYV)
   {
     if(copy)
     {
@@ -43,7 +43,7 @@ public:
   DebugImage(const Image<PixelTypes::YUVPixel>& image)
     : data(const_cast<void*>(static_cast<const void*>(image[0]))), width(static_cast<unsigned short>(image.width)), height(static_cast<unsigned short>(image.height)), isReference(true), type(PixelTypes::PixelType::YUV) {}
   DebugImage(const Image<PixelTypes::GrayscaledPixel>& image, const bool copy = false)
-    : data(copy ? Memory::alignedMalloc(image.width * image.height * sizeof(PixelTypes::GrayscaledPixel), 32) : const_cast<void*>(static_cast<const void*>(image[0]))), width(static_cast<unsigned short>(image.width)), height(static_cast<unsigned short>(image.height)), isReference(!copy), type(PixelTypes::PixelType::Grayscale)
+    : data(copy ? Memory::largeMalloc(image.width * image.height * sizeof(PixelTypes::GrayscaledPixel), Memory::debugImages) : const_cast<void*>(static_cast<const void*>(image[0]))), width(static_cast<unsigned short>(image.width)), height(static_cast<unsigned short>(image.height)), isReference(!copy), type(PixelTypes::PixelType::Grayscale)
   {
     if(copy)
     {
@@ -68,7 +68,7 @@ public:
   {
     if(!isReference && data)
     {
-      Memory::alignedFree(data);
+      Memory::largeFree(data);
       data = nullptr;
     }
   }
@@ -93,9 +93,9 @@ public:
     if(isReference || !data || size > maxSize)
     {
       if(!isReference && data)
-        Memory::alignedFree(data);
+        Memory::largeFree(data);
       isReference = false;
-      data = Memory::alignedMalloc(size, 32);
+      data = Memory::largeMalloc(size, Memory::debugImages);
       maxSize = size;
     }
     width = static_cast<unsigned short>(image.width);
@@ -110,9 +110,9 @@ public:
     if(isReference || !data || size > maxSize)
     {
       if(!isReference && data)
-        Memory::alignedFree(data);
+        Memory::largeFree(data);
       isReference = false;
-      data = Memory::alignedMalloc(size, 32);
+      data = Memory::largeMalloc(size, Memory::debugImages);
       maxSize = size;
     }
     width = static_cast<unsigned short>(image.width);
@@ -141,9 +141,9 @@ protected:
     if(isReference || !data || size > maxSize)
     {
       if(!isReference && data)
-        Memory::alignedFree(data);
+        Memory::largeFree(data);
       isReference = false;
-      data = Memory::alignedMalloc(size, 32);
+      data = Memory::largeMalloc(size, Memory::debugImages);
       maxSize = size;
     }
     stream.read(data, size);
@@ -9,7 +9,7 @@
  */
 
 #include "DebugRequest.h"
-#include "Platform/BHAssert.h"
+#include <mutex>
 
 DebugRequestTable::DebugRequestTable()
 {
@@ -19,6 +19,24 @@ DebugRequestTable::DebugRequestTable()
   polled.reserve(10000);
 }
 
+size_t DebugRequestTable::getSlot(const std::string& name)
+{
+  static std::mutex mutex;
+  static std::unordered_map<std::string, size_t> slots;
+  std::lock_guard<std::mutex> lock(mutex);
+  return slots.try_emplace(name, slots.size()).first->second;
+}
+
+size_t DebugRequestTable::addName(const std::string& name)
+{
+  std::unordered_map<std::string, size_t>::const_iterator i = slowIndex.find(name);
+  if(i != slowIndex.end())
+    return i->second;
+  const size_t slot = getSlot(name);
+  slowIndex[name] = slot;
+  return slot;
+}
+
 void DebugRequestTable::addRequest(const DebugRequest& debugRequest)
 {
   if(debugRequest.name == "poll")
@@ -30,44 +48,33 @@ void DebugRequestTable::addRequest(const DebugRequest& debugRequest)
     clear();
   else
   {
-    std::unordered_map<std::string, size_t>::const_iterator i = slowIndex.find(debugRequest.name);
-    if(i != slowIndex.end())
-      enabled[i->second] = debugRequest.enable ? 1 : 0;
-    else
-    {
-      slowIndex[debugRequest.name] = enabled.size();
-      enabled.push_back(debugRequest.enable ? 1 : 0);
-    }
+    const size_t slot = addName(debugRequest.name);
+    if(slot >= enabled.size())
+      enabled.resize(slot + 1, 0);
+    enabled[slot] = debugRequest.enable ? 1 : 0;
   }
 }
 
 bool DebugRequestTable::isActiveSlow(const char* name)
 {
-  std::unordered_map<std::string, size_t>::const_iterator j = slowIndex.find(name);
-  size_t k;
-  if(j != slowIndex.end())
-    k = j->second;
-  else
-  {
-    k = enabled.size();
-    slowIndex[name] = k;
-    enabled.push_back(0);
-  }
-  fastIndex[name] = k;
-  return enabled[k] != 0;
+  const size_t slot = addName(name);
+  fastIndex[name] = slot;
+  return isActive(slot);
 }
 
-void DebugRequestTable::disable(const char* name)
+void DebugRequestTable::disable(size_t slot)
 {
-  ASSERT(fastIndex.find(name) != fastIndex.end());
-  enabled[fastIndex[name]] = 0;
+  if(slot < enabled.size())
+    enabled[slot] = 0;
 }
 
-bool DebugRequestTable::notYetPolled(const char* name)
+bool DebugRequestTable::notYetPolled(size_t slot)
 {
-  if(polled.find(name) == polled.end())
+  if(slot >= polled.size())
+    polled.resize(slot + 1, 0);
+  if(!polled[slot])
   {
-    polled.insert(name);
+    polled[slot] = 1;
     return true;
   }
   else
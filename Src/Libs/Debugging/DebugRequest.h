@@ -36,16 +36,18 @@ inline DebugRequest::DebugRequest(const std::string& name, bool enable)
  * @class DebugRequestTable
  *
  * A class that maintains the table of currently active debug requests.
- * It provides a fast access based on character pointers and a slower one based
- * on strings.
+ * Each name of a debug request is assigned a slot that is the same in all
+ * threads. The macros determine the slot once per call site, so they can
+ * access the table by slot. There is also a fast access based on character
+ * pointers and a slower one based on strings.
  */
 class DebugRequestTable final
 {
 private:
-  std::vector<char> enabled; /**< Are requests enabled or disabled? */
-  std::unordered_map<const char*, size_t> fastIndex; /**< Maps char pointers to entries of vector "enabled". */
-  std::unordered_map<std::string, size_t> slowIndex; /**< Maps strings to entries of vector "enabled". */
-  std::unordered_set<const char*> polled; /**< Which requests were already published during this polling phase? */
+  std::vector<char> enabled; /**< Are requests enabled or disabled? Indexed by slot. */
+  std::unordered_map<const char*, size_t> fastIndex; /**< Maps char pointers to slots. */
+  std::unordered_map<std::string, size_t> slowIndex; /**< Maps the strings known to this table to slots. */
+  std::vector<char> polled; /**< Which requests were already published during this polling phase? Indexed by slot. */
 
   /**
    * Uses the slow index to find request and updates the fast index.
@@ -54,6 +56,13 @@ private:
    */
   bool isActiveSlow(const char* name);
 
+  /**
+   * Adds a name to the slow index.
+   * @param name The name of the debug request.
+   * @return The slot of the debug request.
+   */
+  size_t addName(const std::string& name);
+
 public:
   int pollCounter = 0; /**< How many frames is polling still active? */
 
@@ -63,6 +72,14 @@ public:
   /** No copy constructor. */
   DebugRequestTable(const DebugRequestTable&) = delete;
 
+  /**
+   * Returns the slot of a debug request. The slot is assigned when a name
+   * is used for the first time and it is the same in all threads.
+   * @param name The name of the debug request.
+   * @return The slot.
+   */
+  static size_t getSlot(const std::string& name);
+
   /**
    * Adds or updates a certain debug request.
    * @param debugRequest The debug request that is updated in the table.
@@ -76,20 +93,26 @@ public:
    */
   bool isActive(const char* name);
 
+  /**
+   * Is a debug request active?
+   * @param slot The slot of the request.
+   * @return Is it active?
+   */
+  bool isActive(size_t slot) const {return slot < enabled.size() && enabled[slot];}
+
   /**
    * Disable a debug request.
-   * Note: isActive must have been called before for this request.
-   * @param name The name of the request to disable.
+   * @param slot The slot of the request to disable.
    */
-  void disable(const char* name);
+  void disable(size_t slot);
 
   /**
    * Has this request still to be published during this polling phase?
    * This also marks the request as polled.
-   * @param name The name of the request.
+   * @param slot The slot of the request.
    * @return Was the request not yet polled?
    */
-  bool notYetPolled(const char* name);
+  bool notYetPolled(size_t slot);
 
   /** Clear the table. */
   void clear();
@@ -101,5 +124,5 @@ public:
 inline bool DebugRequestTable::isActive(const char* name)
 {
   std::unordered_map<const char*, size_t>::const_iterator i = fastIndex.find(name);
-  return i != fastIndex.end() ? enabled[i->second] != 0 : isActiveSlow(name);
+  return i != fastIndex.end() ? isActive(i->second) : isActiveSlow(name);
 }
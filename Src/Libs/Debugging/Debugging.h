@@ -25,16 +25,27 @@
 #else
 /**
  * Register debug request if required and check whether it is active.
+ * @param slot The slot of the debug request (see \c _DEBUG_REQUEST_SLOT ).
  * @param id The name of the debug request.
  * @return Is it active?
  */
-inline bool _debugRequestActive(const char* id)
+inline bool _debugRequestActive(std::size_t slot, const char* id)
 {
-  if(Global::getDebugRequestTable().pollCounter && Global::getDebugRequestTable().notYetPolled(id))
-    OUTPUT(idDebugResponse, text, id << Global::getDebugRequestTable().isActive(id));
-  return Global::getDebugRequestTable().isActive(id);
+  DebugRequestTable& debugRequestTable = Global::getDebugRequestTable();
+  if(debugRequestTable.pollCounter && debugRequestTable.notYetPolled(slot))
+    OUTPUT(idDebugResponse, text, id << debugRequestTable.isActive(slot));
+  return debugRequestTable.isActive(slot);
 }
 
+/**
+ * Determines the slot of a debug request. The slot is only looked up once
+ * per call site, so checking whether a debug request is active is an
+ * array lookup afterwards.
+ * @param id The name of the debug request. It must be a string literal.
+ */
+#define _DEBUG_REQUEST_SLOT(id) \
+  [] {static const std::size_t _slot = DebugRequestTable::getSlot(id); return _slot;}()
+
 /**
  * Declares a debugging switch. This is only necessary in case, where the actual switch
  * is not always reached in each execution cycle.
@@ -42,8 +53,8 @@ inline bool _debugRequestActive(const char* id)
  */
 #define DECLARE_DEBUG_RESPONSE(id) \
   do \
-    if(Global::getDebugRequestTable().pollCounter && Global::getDebugRequestTable().notYetPolled(id)) \
-      OUTPUT(idDebugResponse, text, id << Global::getDebugRequestTable().isActive(id)); \
+    if(Global::getDebugRequestTable().pollCounter) \
+      static_cast<void>(_debugRequestActive(_DEBUG_REQUEST_SLOT(id), id)); \
   while(false)
 
 /**
@@ -51,26 +62,26 @@ inline bool _debugRequestActive(const char* id)
  * @param id The id of the debugging switch
  */
 #define DEBUG_RESPONSE(id) \
-  if(_debugRequestActive(id))
+  if(_debugRequestActive(_DEBUG_REQUEST_SLOT(id), id))
 
 /**
  * A debugging switch, allowing the non-recurring execution of the following block.
  * @param id The id of the debugging switch
  */
 #define DEBUG_RESPONSE_ONCE(id) \
-  if(_debugRequestActive(id) && (Global::getDebugRequestTable().disable(id), true))
+  if(const std::size_t _slot = _DEBUG_REQUEST_SLOT(id); _debugRequestActive(_slot, id) && (Global::getDebugRequestTable().disable(_slot), true))
 
 /**
  * A debugging switch, allowing the enabling or disabling of the block that follows.
  * @param id The id of the debugging switch
  */
 #define DEBUG_RESPONSE_NOT(id) \
-  if(!_debugRequestActive(id))
+  if(!_debugRequestActive(_DEBUG_REQUEST_SLOT(id), id))
 
 /**
  * Execute following block if debug request is active.
  * The request is not pollable.
  */
 #define DECLARED_DEBUG_RESPONSE(id) \
-  if(Global::getDebugRequestTable().isActive(id))
+  if(Global::getDebugRequestTable().isActive(_DEBUG_REQUEST_SLOT(id)))
 #endif
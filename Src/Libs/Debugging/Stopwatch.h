@@ -10,26 +10,51 @@
 
 #include "Debugging/TimingManager.h"
 #include "Debugging/Debugging.h"
+#include "Debugging/Tracer.h"
 
 /** A stopwatch that measures the time an instance of it lives and plots it. */
 class Stopwatch
 {
+public:
+  /** The slots of a stopwatch. They are determined once per call site. */
+  struct Slots
+  {
+    std::size_t timing; /**< The slot in the timing manager. */
+    std::size_t debugRequest; /**< The slot of the debug request that plots the measurements. */
+
+    /**
+     * Determines the slots.
+     * @param name The name of the plot.
+     */
+    Slots(const char* name) : timing(TimingManager::getSlot(name + 15)), debugRequest(DebugRequestTable::getSlot(name)) {}
+  };
+
+private:
   const char* const name; /**< The name of the plot. */
+  const Slots slots; /**< The slots of this stopwatch. */
   bool running = true; /**< Should the stopwatch still be running? */
 
 public:
   /**
    * Start the stopwatch.
    * @param name The name of the plot.
+   * @param slots The slots of the stopwatch.
    */
-  Stopwatch(const char* name) : name(name) {Global::getTimingManager().startTiming(name + 15);}
+  Stopwatch(const char* name, const Slots& slots) : name(name), slots(slots)
+  {
+    Tracer::begin(name + 15);
+    Global::getTimingManager().startTiming(slots.timing);
+  }
 
   /** Stop the stopwatch.*/
   ~Stopwatch()
   {
-    [[maybe_unused]] const unsigned time = Global::getTimingManager().stopTiming(name + 15);
-    DEBUG_RESPONSE(name)
+    [[maybe_unused]] const unsigned time = Global::getTimingManager().stopTiming(slots.timing);
+    Tracer::end(name + 15);
+#if !defined TARGET_ROBOT || !defined NDEBUG
+    if(_debugRequestActive(slots.debugRequest, name))
       OUTPUT(idPlot, bin, (name + 5) << static_cast<float>(time) * 0.001f);
+#endif
   }
 
   /**< Should the stopwatch still be running? */
@@ -41,4 +66,4 @@ public:
  * @param name The name of the stopwatch.
  */
 #define STOPWATCH(name) \
-  for(Stopwatch _stopwatch("plot:stopwatch:" name); _stopwatch.isRunning();)
+  for(Stopwatch _stopwatch("plot:stopwatch:" name, [] {static const Stopwatch::Slots _slots("plot:stopwatch:" name); return _slots;}()); _stopwatch.isRunning();)
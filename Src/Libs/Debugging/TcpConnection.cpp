@@ -14,6 +14,7 @@ void TcpConnection::connect(const char* ip, int port, Handshake handshake, int m
   this->handshake = handshake;
   ack = false;
   client = false;
+  bytesSent = 0;
 
   tcpComm = std::make_unique<TcpComm>(ip, port, maxPacketSendSize, maxPacketReceiveSize);
   ASSERT(tcpComm);
@@ -30,11 +31,13 @@ void TcpConnection::connect(const char* ip, int port, Handshake handshake, int m
 }
 
 bool TcpConnection::sendAndReceive(const unsigned char* dataToSend, int sendSize,
-                                   unsigned char*& dataRead, int& readSize)
+                                   unsigned char*& dataRead, int& readSize, bool wait)
 {
   ASSERT(tcpComm);
   bool connectedBefore = isConnected();
   readSize = receive(dataRead);
+  if(!isConnected())
+    bytesSent = 0; // a new connection starts with a new packet
 
   if(handshake == sender &&
      ((readSize > 0 && !sendSize) || (!connectedBefore && isConnected())))
@@ -48,7 +51,38 @@ bool TcpConnection::sendAndReceive(const unsigned char* dataToSend, int sendSize
   if((handshake != receiver || ack) &&
      isConnected() && sendSize > 0)
   {
-    if(tcpComm->send(reinterpret_cast<unsigned char*>(&sendSize), sizeof(sendSize)) && // sends size of block
+    if(!wait)
+    {
+      // Continue where the previous call stopped. The size of the block is sent first.
+      const int headerSize = static_cast<int>(sizeof(sendSize));
+      int sent = 0;
+      if(bytesSent < headerSize)
+      {
+        sent = tcpComm->sendNonBlocking(reinterpret_cast<unsigned char*>(&sendSize) + bytesSent, headerSize - bytesSent);
+        if(sent > 0)
+          bytesSent += sent;
+      }
+      if(sent >= 0 && bytesSent >= headerSize)
+      {
+        sent = tcpComm->sendNonBlocking(dataToSend + bytesSent - headerSize, sendSize + headerSize - bytesSent);
+        if(sent > 0)
+          bytesSent += sent;
+      }
+      if(sent < 0)
+      {
+        bytesSent = 0;
+        return connectedBefore; // We cannot reconnect, so we fake success to prevent this packet from being sent again
+      }
+      else if(bytesSent == sendSize + headerSize)
+      {
+        bytesSent = 0;
+        ack = false;
+        return true;
+      }
+      else
+        return false;
+    }
+    else if(tcpComm->send(reinterpret_cast<unsigned char*>(&sendSize), sizeof(sendSize)) && // sends size of block
        tcpComm->send(dataToSend, sendSize))                           // sends data
     {
       ack = false;
@@ -31,6 +31,7 @@ private:
   std::unique_ptr<TcpComm> tcpComm; /**< The TCP/IP connection. */
   bool ack = false;
   bool client = false;;
+  int bytesSent = 0; /**< The number of bytes of the current packet (including its size) already sent without waiting. */
   Handshake handshake = noHandshake; /**< The handshake mode. */
 
 public:
@@ -79,9 +80,12 @@ public:
    * @param readSize The size of the block read. "dataRead" is only valid
    *                 (and has to be freed) if this parameter contains a
    *                 positive number after the call to the function.
+   * @param wait Wait until the whole packet was sent? Otherwise, only as many
+   *             bytes are sent as the send buffer accepts and the function
+   *             must be called again with the same packet until it returns true.
    * @return Returns true if the data has been sent.
    */
-  bool sendAndReceive(const unsigned char* dataToSend, int sendSize, unsigned char*& dataRead, int& readSize);
+  bool sendAndReceive(const unsigned char* dataToSend, int sendSize, unsigned char*& dataRead, int& readSize, bool wait = true);
 
   /**
    * The function states whether the connection is still established.
@@ -10,27 +10,167 @@
 #include "Platform/Time.h"
 #include "Streaming/Output.h"
 #include "Streaming/MessageQueue.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <mutex>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
-struct TimingManager::Pimpl
+/**
+ * A histogram of the last measurements of a stopwatch. The buckets are
+ * logarithmically spaced, each power of two is divided into eight buckets.
+ * Therefore, the quantiles determined are at most 12.5% too high.
+ */
+class TimingHistogram
 {
+  static constexpr std::size_t windowSize = 1024; /**< The number of measurements considered. */
+  static constexpr std::size_t blockSize = 128; /**< The size of the blocks the maxima are tracked for. */
+  static constexpr std::size_t numOfBuckets = 8 + 21 * 8; /**< Buckets up to 2^24 us. */
+
+  std::array<unsigned short, numOfBuckets> counts{}; /**< The number of measurements in each bucket. */
+  std::array<unsigned char, windowSize> buckets; /**< The buckets of all measurements in the window. */
+  std::array<unsigned, windowSize / blockSize> maxima{}; /**< The longest measurement in each block of the window. */
+  std::size_t next = 0; /**< The index of the next measurement in the window. */
+  std::size_t size = 0; /**< The number of measurements in the window. */
+
+  /**
+   * Determines the bucket of a measurement.
+   * @param time The measurement in us.
+   * @return The index of the bucket.
+   */
+  static std::size_t bucket(unsigned time)
+  {
+    if(time < 8)
+      return time;
+    const unsigned exponent = static_cast<unsigned>(std::bit_width(time)) - 1;
+    if(exponent > 23)
+      return numOfBuckets - 1;
+    return (exponent - 2) * 8 + ((time >> (exponent - 3)) & 7u);
+  }
+
+  /**
+   * Determines the largest measurement a bucket can contain.
+   * @param bucket The index of the bucket.
+   * @return The upper bound of the bucket in us.
+   */
+  static unsigned upperBound(std::size_t bucket)
+  {
+    if(bucket < 8)
+      return static_cast<unsigned>(bucket);
+    const unsigned shift = static_cast<unsigned>(bucket / 8 - 1);
+    return ((8u + bucket % 8 + 1) << shift) - 1;
+  }
+
+public:
+  /**
+   * Adds a measurement replacing the oldest one if the window is full.
+   * @param time The measurement in us.
+   */
+  void add(unsigned time)
+  {
+    if(size == windowSize)
+      --counts[buckets[next]];
+    else
+      ++size;
+    if(next % blockSize == 0)
+      maxima[next / blockSize] = 0;
+    maxima[next / blockSize] = std::max(maxima[next / blockSize], time);
+    ++counts[buckets[next] = static_cast<unsigned char>(bucket(time))];
+    next = (next + 1) % windowSize;
+  }
+
+  /**
+   * Determines a quantile of the measurements.
+   * @param q The quantile in the range [0..1].
+   * @return The quantile in us. It is never larger than the maximum.
+   */
+  unsigned quantile(float q) const
+  {
+    const std::size_t rank = std::max(static_cast<std::size_t>(q * static_cast<float>(size) + 0.999f), std::size_t(1));
+    std::size_t sum = 0;
+    for(std::size_t i = 0; i < numOfBuckets; ++i)
+      if((sum += counts[i]) >= rank)
+        return std::min(upperBound(i), maximum());
+    return maximum();
+  }
+
+  /**
+   * Determines the longest measurement. It considers up to blockSize
+   * fewer measurements than the other statistics.
+   * @return The longest measurement in us.
+   */
+  unsigned maximum() const { return *std::max_element(maxima.begin(), maxima.end()); }
+
+  /**
+   * Were any measurements added?
+   * @return Is the window empty?
+   */
+  bool empty() const { return size == 0; }
+};
+
+/** The names of all stopwatches in all threads, which assigns each of them a slot. */
+class TimingSlots
+{
+  std::mutex mutex; /**< Protects the tables. */
+  std::unordered_map<std::string, std::size_t> slots; /**< Maps names to slots. */
+  std::vector<const char*> names; /**< The names of all slots. They point to the keys of \c slots , which never move. */
+
+public:
+  /**
+   * Returns the slot of a stopwatch and creates it if it does not exist yet.
+   * @param identifier The name of the stopwatch.
+   * @return The slot.
+   */
+  std::size_t getSlot(const char* identifier)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto [i, inserted] = slots.try_emplace(identifier, names.size());
+    if(inserted)
+      names.push_back(i->first.c_str());
+    return i->second;
+  }
+
   /**
-   * NOTE: the hash maps only work because the compiler uses a string table and
-   *       allocates only one address for all const string literals with the same value.
-   *       If this ever changes you have to replace the key with std::string
+   * Returns the name of a slot.
+   * @param slot The slot.
+   * @return The name of the stopwatch.
    */
+  const char* getName(std::size_t slot)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return names[slot];
+  }
+};
+
+/**
+ * Returns the only instance of the stopwatch slots.
+ * @return The instance.
+ */
+static TimingSlots& getTimingSlots()
+{
+  static TimingSlots timingSlots;
+  return timingSlots;
+}
+
+struct TimingManager::Pimpl
+{
+  static constexpr unsigned short noIndex = 0xffff; /**< Marks slots that are not used in this thread. */
+
+  std::vector<unsigned short> indices; /**< Maps slots to the indices of the stopwatches in this thread. The index is also used as the id when sending timing data over the network. */
 
   /**
-   * Key: name of the timer
-   * value: If timer has been started but not stopped, yet: the start time.
+   * Index: index of the stopwatch.
+   * Value: If timer has been started but not stopped, yet: the start time.
    *        Else: the time between start and stop.
    */
-  std::unordered_map<const char*, unsigned long long> timing;
-  std::unordered_map<const char*, unsigned short> idTable; /**< Key: name of the stopwatch. Value: the id that is used when sending timing data over the network */
+  std::vector<unsigned long long> timing;
+  std::vector<TimingHistogram> histograms; /**< Index: index of the stopwatch. Value: the distribution of its last measurements. */
+  std::vector<const char*> watchNames; /**< Contains the names of the stopwatches */
   unsigned currentThreadStartTime = 0; /**< Timestamp of the current thread iteration */
   unsigned frameNo = 0; /**<  Number of the current frame*/
-  std::vector<const char*> watchNames; /**< Contains the names of the stopwatches */
+  std::vector<std::pair<const char*, unsigned>> lastFrameTimings; /**< The measurements of the previous thread iteration. */
   MessageQueue data; /**< Contains the timing data in streamable format inbetween frames */
   bool dataPrepared = false; /**< True if data hs already been prepared this frame */
   int watchNameIndex = 0; /**< Every frame a few watch names are transmitted. This is the index of the watchname that is to be transmitted next */
@@ -46,37 +186,72 @@ TimingManager::~TimingManager()
   delete prvt;
 }
 
-void TimingManager::startTiming(const char* identifier)
+std::size_t TimingManager::getSlot(const char* identifier)
 {
-  auto timing = prvt->timing.find(identifier);
-  if(timing == prvt->timing.end())
-  {
-    //create new entry
-    prvt->watchNames.push_back(identifier);
-    prvt->idTable[identifier] = static_cast<unsigned short>(prvt->idTable.size()); //NOTE: this assumes that an unsigned short will always be big big enough to count the timers...
-    timing = prvt->timing.insert(std::pair<const char*, unsigned long long>(identifier, 0)).first;
-  }
+  return getTimingSlots().getSlot(identifier);
+}
+
+void TimingManager::startTiming(std::size_t slot)
+{
+  unsigned long long& timing = getTiming(slot);
   prvt->dataPrepared = false;
-  timing->second = Time::getCurrentThreadTime() - timing->second; // accumulate measurements
+  timing = Time::getCurrentThreadTime() - timing; // accumulate measurements
 }
 
-unsigned TimingManager::stopTiming(const char* identifier)
+unsigned TimingManager::stopTiming(std::size_t slot)
 {
   const unsigned long long stopTime = Time::getCurrentThreadTime();
-  auto timing = prvt->timing.find(identifier);
-  const unsigned diff = unsigned(stopTime - timing->second);
-  timing->second = diff;
+  unsigned long long& timing = prvt->timing[prvt->indices[slot]];
+  const unsigned diff = unsigned(stopTime - timing);
+  timing = diff;
   return diff;
 }
 
+void TimingManager::addTiming(const char* identifier, unsigned time)
+{
+  prvt->dataPrepared = false;
+  getTiming(getSlot(identifier)) += time;
+}
+
+unsigned long long& TimingManager::getTiming(std::size_t slot)
+{
+  if(slot >= prvt->indices.size())
+    prvt->indices.resize(slot + 1, Pimpl::noIndex);
+  unsigned short& index = prvt->indices[slot];
+  if(index == Pimpl::noIndex)
+  {
+    //create new entry
+    ASSERT(prvt->timing.size() < Pimpl::noIndex);
+    index = static_cast<unsigned short>(prvt->timing.size());
+    prvt->watchNames.push_back(getTimingSlots().getName(slot));
+    prvt->timing.push_back(0);
+    prvt->histograms.emplace_back();
+  }
+  return prvt->timing[index];
+}
+
 void TimingManager::signalThreadStart()
 {
   prvt->currentThreadStartTime = Time::getCurrentSystemTime();
   prvt->frameNo++;
   prvt->data.clear();
   prvt->dataPrepared = false;
-  for(std::pair<const char* const, unsigned long long>& it : prvt->timing)
-    it.second = 0;
+  prvt->lastFrameTimings.clear();
+  for(std::size_t i = 0; i < prvt->timing.size(); ++i)
+  {
+    // The measurements of the previous frame are complete now.
+    if(prvt->timing[i])
+    {
+      prvt->histograms[i].add(static_cast<unsigned>(prvt->timing[i]));
+      prvt->lastFrameTimings.emplace_back(prvt->watchNames[i], static_cast<unsigned>(prvt->timing[i]));
+    }
+    prvt->timing[i] = 0;
+  }
+}
+
+const std::vector<std::pair<const char*, unsigned>>& TimingManager::getLastFrameTimings() const
+{
+  return prvt->lastFrameTimings;
 }
 
 MessageQueue& TimingManager::getData()
@@ -104,26 +279,38 @@ void TimingManager::prepareData()
    *
    * unsigned : timestamp at which the last iteration started.
    * unsigned : frame number of the current frame
+   *
+   * unsigned short : Number of stopwatches with a distribution (may be missing in old logs)
+   * for each of these stopwatches:
+   *  short : id of the stopwatch
+   *  unsigned : median of the last measurements in microseconds
+   *  unsigned : 95% quantile of the last measurements in microseconds
+   *  unsigned : 99% quantile of the last measurements in microseconds
+   *  unsigned : longest of the last measurements in microseconds
    */
   MessageQueue::OutBinary out = prvt->data.bin(idStopwatch);
 
   // every frame we send 3 watch names
   out << static_cast<unsigned short>(3); //number of names to follow
   for(int i = 0; i < 3; ++i, prvt->watchNameIndex = (prvt->watchNameIndex + 1) % prvt->watchNames.size())
-  {
-    const char* watchName = prvt->watchNames[prvt->watchNameIndex];
-    out << prvt->idTable[watchName] << watchName;
-  }
+    out << static_cast<unsigned short>(prvt->watchNameIndex) << prvt->watchNames[prvt->watchNameIndex];
 
   // now write the data of all watches
   out << static_cast<unsigned short>(prvt->timing.size());
-  for(const std::pair<const char* const, unsigned long long>& it : prvt->timing)
+  for(std::size_t i = 0; i < prvt->timing.size(); ++i)
   {
-    out << prvt->idTable[it.first];
-    out << static_cast<unsigned>(it.second); // the cast is ok because the time between start and stop will never be bigger than an int...
+    out << static_cast<unsigned short>(i);
+    out << static_cast<unsigned>(prvt->timing[i]); // the cast is ok because the time between start and stop will never be bigger than an int...
   }
   out << prvt->currentThreadStartTime;
   out << prvt->frameNo;
+
+  out << static_cast<unsigned short>(std::count_if(prvt->histograms.begin(), prvt->histograms.end(),
+                                                   [](const TimingHistogram& histogram) {return !histogram.empty();}));
+  for(std::size_t i = 0; i < prvt->histograms.size(); ++i)
+    if(!prvt->histograms[i].empty())
+      out << static_cast<unsigned short>(i) << prvt->histograms[i].quantile(0.5f) << prvt->histograms[i].quantile(0.95f)
+          << prvt->histograms[i].quantile(0.99f) << prvt->histograms[i].maximum();
   if(out.failed())
     OUTPUT_WARNING("TimingManager: queue is full!!!");
 }
@@ -7,6 +7,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <utility>
+#include <vector>
+
 class MessageQueue;
 
 /**
@@ -21,11 +25,36 @@ public:
   /** Destructor. */
   ~TimingManager();
 
-  /** Start the stopwatch for the specified identifier. */
-  void startTiming(const char* identifier);
+  /**
+   * Returns the slot of a stopwatch. The slot is assigned when a name is
+   * used for the first time and it is the same in all threads. It should be
+   * determined only once per call site, because this requires a lookup.
+   * @param identifier The name of the stopwatch.
+   * @return The slot.
+   */
+  static std::size_t getSlot(const char* identifier);
 
-  /** Stops the stopwatch for the specified identifier and returns the time in us. */
-  unsigned stopTiming(const char* identifier);
+  /**
+   * Start the stopwatch in the specified slot.
+   * @param slot The slot of the stopwatch.
+   */
+  void startTiming(std::size_t slot);
+
+  /**
+   * Stops the stopwatch in the specified slot.
+   * @param slot The slot of the stopwatch.
+   * @return The time in us.
+   */
+  unsigned stopTiming(std::size_t slot);
+
+  /**
+   * Adds a measurement that was not taken by starting and stopping a stopwatch,
+   * e.g. a latency measured in real time rather than in thread time. It is
+   * treated like a stopwatch with the specified identifier.
+   * @param identifier The name of the stopwatch.
+   * @param time The time in us.
+   */
+  void addTiming(const char* identifier, unsigned time);
 
   /**
    * The TimingManager has a special stopwatch that is used to keep track
@@ -41,10 +70,25 @@ public:
    */
   MessageQueue& getData();
 
+  /**
+   * Returns the measurements of the previous thread iteration, i.e. the one that
+   * was completed by the last call of signalThreadStart.
+   * @return Pairs of stopwatch names and times in us. Stopwatches that did not run
+   *         in that iteration are missing.
+   */
+  const std::vector<std::pair<const char*, unsigned>>& getLastFrameTimings() const;
+
 private:
   /** Prepares timing data for streaming. */
   void prepareData();
 
+  /**
+   * Returns the current value of a stopwatch and creates it if it does not exist yet.
+   * @param slot The slot of the stopwatch.
+   * @return The start time if the stopwatch is running, the time accumulated otherwise.
+   */
+  unsigned long long& getTiming(std::size_t slot);
+
   struct Pimpl;
   Pimpl* prvt;
 };
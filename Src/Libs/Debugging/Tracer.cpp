@@ -0,0 +1,142 @@
+/**
+ * @file Tracer.cpp
+ *
+ * This file implements a tracer that records begin and end events of all
+ * threads in a timeline.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "Tracer.h"
+#include "Platform/Thread.h"
+#include "Platform/Time.h"
+#include "Streaming/OutStreams.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+  /** An event recorded. */
+  struct Event
+  {
+    const char* name; /**< The name of the event. */
+    std::uint64_t time; /**< The time of the event in ns. */
+    bool begin; /**< Is this the begin of the event, otherwise its end? */
+  };
+
+  /** The ring buffer of a single thread. It is only written by that thread. */
+  struct Ring
+  {
+    static constexpr std::uint64_t size = 1 << 15; /**< The number of events kept. */
+
+    std::string threadName; /**< The name of the thread. */
+    unsigned id; /**< A unique number of the thread in the trace. */
+    std::array<Event, size> events; /**< The events. */
+    std::atomic<std::uint64_t> written = 0; /**< The number of events written so far. */
+  };
+
+  std::mutex mutex; /**< Protects the list of rings. */
+  std::vector<std::unique_ptr<Ring>> rings; /**< The rings of all threads that ever recorded an event. */
+  thread_local Ring* ring = nullptr; /**< The ring of the calling thread. */
+  std::atomic<unsigned> timeOfLastDump = 0; /**< When was the last dump written (in ms)? */
+
+  /**
+   * Records an event in the ring of the calling thread, which is created on first use.
+   * @param name The name of the event.
+   * @param begin Is this the begin of the event, otherwise its end?
+   */
+  void record(const char* name, bool begin)
+  {
+    if(!ring)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ring = rings.emplace_back(std::make_unique<Ring>()).get();
+      ring->threadName = Thread::getCurrentThreadName();
+      ring->id = static_cast<unsigned>(rings.size());
+    }
+
+    const std::uint64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    const std::uint64_t position = ring->written.load(std::memory_order_relaxed);
+    ring->events[position % Ring::size] = {name, nanoseconds, begin};
+    ring->written.store(position + 1, std::memory_order_release);
+  }
+}
+
+void Tracer::begin(const char* name)
+{
+  record(name, true);
+}
+
+void Tracer::end(const char* name)
+{
+  record(name, false);
+}
+
+bool Tracer::dump(const std::string& name)
+{
+  const unsigned now = Time::getRealSystemTime();
+  unsigned last = timeOfLastDump.load();
+  if((last && now - last < 1000) || !timeOfLastDump.compare_exchange_strong(last, now))
+    return false;
+
+  OutBinaryFile stream(name + ".json");
+  if(!stream.exists())
+    return false;
+
+  std::vector<Ring*> ringsToDump;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    for(const std::unique_ptr<Ring>& ring : rings)
+      ringsToDump.push_back(ring.get());
+  }
+
+  char line[256];
+  const auto write = [&](int length)
+  {
+    stream.write(line, std::min(length, static_cast<int>(sizeof(line)) - 1));
+  };
+
+  bool first = true;
+  write(std::snprintf(line, sizeof(line), "{\"traceEvents\":[\n"));
+  std::vector<Event> events(Ring::size);
+  for(const Ring* ring : ringsToDump)
+  {
+    write(std::snprintf(line, sizeof(line), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                        first ? "" : ",\n", ring->id, ring->threadName.c_str()));
+    first = false;
+
+    // Copy the events and drop all that might have been overwritten while copying.
+    const std::uint64_t to = ring->written.load(std::memory_order_acquire);
+    const std::uint64_t from = to > Ring::size ? to - Ring::size : 0;
+    for(std::uint64_t i = from; i < to; ++i)
+      events[i - from] = ring->events[i % Ring::size];
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const std::uint64_t written = ring->written.load(std::memory_order_relaxed);
+    const std::uint64_t skip = written >= Ring::size ? std::max(from, written - Ring::size + 1) - from : 0;
+
+    // End events without a begin in the window are dropped.
+    unsigned depth = 0;
+    for(std::uint64_t i = skip; i < to - from; ++i)
+    {
+      const Event& event = events[i];
+      if(event.begin)
+        ++depth;
+      else if(depth)
+        --depth;
+      else
+        continue;
+      write(std::snprintf(line, sizeof(line), ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":1,\"tid\":%u,\"ts\":%llu.%03u}",
+                          event.name, event.begin ? 'B' : 'E', ring->id,
+                          static_cast<unsigned long long>(event.time / 1000), static_cast<unsigned>(event.time % 1000)));
+    }
+  }
+  write(std::snprintf(line, sizeof(line), "\n]}\n"));
+  return true;
+}
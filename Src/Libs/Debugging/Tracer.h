@@ -0,0 +1,58 @@
+/**
+ * @file Tracer.h
+ *
+ * This file declares a tracer that records begin and end events of all
+ * threads in a timeline. Each thread writes to its own ring buffer without
+ * locking. The timeline can be written to a file in the Chrome trace event
+ * format, which can be viewed with chrome://tracing or Perfetto.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include <string>
+
+class Tracer
+{
+public:
+  /**
+   * Records the begin of an event in the ring buffer of the calling thread.
+   * @param name The name of the event. It must be a string that exists as
+   *             long as the program runs, e.g. a string literal.
+   */
+  static void begin(const char* name);
+
+  /**
+   * Records the end of an event in the ring buffer of the calling thread.
+   * @param name The name of the event. It must be the same as the one passed
+   *             to the matching call of \c begin .
+   */
+  static void end(const char* name);
+
+  /**
+   * Writes the events of all threads to a file in the Chrome trace event
+   * format. Dumps that are requested within a second of a previous dump
+   * are ignored, because a request usually reaches all threads.
+   * @param name The name of the file without its extension. It is interpreted
+   *             as relative to the configuration directory.
+   * @return Was the file written?
+   */
+  static bool dump(const std::string& name);
+
+  /** Records an event that lasts as long as an instance of this class exists. */
+  class Scope
+  {
+    const char* name; /**< The name of the event. */
+
+  public:
+    /**
+     * Records the begin of the event.
+     * @param name The name of the event, usually a string literal.
+     */
+    Scope(const char* name) : name(name) {begin(name);}
+
+    /** Records the end of the event. */
+    ~Scope() {end(name);}
+  };
+};
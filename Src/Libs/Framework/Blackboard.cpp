@@ -7,13 +7,20 @@
 #include "Blackboard.h"
 #include "Platform/BHAssert.h"
 #include "Streaming/Streamable.h"
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <string>
 #include <unordered_map>
 
 /** The instance of the blackboard of the current thread. */
 static thread_local Blackboard* theInstance = nullptr;
 
-/** The actual type of the map for all entries. */
-class Blackboard::Entries : public std::unordered_map<std::string, Blackboard::Entry> {};
+/**
+ * The actual type of the array of all entries. A deque is used, because
+ * growing it does not move the existing entries.
+ */
+class Blackboard::Entries : public std::deque<Blackboard::Entry> {};
 
 Blackboard::Blackboard() :
   entries(new Entries)
@@ -25,55 +32,97 @@ Blackboard::~Blackboard()
 {
   ASSERT(theInstance == this);
   theInstance = nullptr;
-  ASSERT(entries->size() == 0);
+  ASSERT(std::all_of(entries->begin(), entries->end(), [](const Entry& entry) {return entry.counter == 0;}));
+}
+
+Blackboard::Id Blackboard::getId(const char* representation)
+{
+  // The ids are shared by all threads.
+  static std::mutex mutex;
+  static std::unordered_map<std::string, Id> ids;
+  std::lock_guard<std::mutex> lock(mutex);
+  return ids.emplace(representation, ids.size()).first->second;
+}
+
+Blackboard::Entry& Blackboard::get(Id id)
+{
+  if(id >= entries->size())
+    entries->resize(id + 1);
+  return (*entries)[id];
 }
 
-Blackboard::Entry& Blackboard::get(const char* representation)
+const Blackboard::Entry& Blackboard::get(Id id) const
 {
-  return (*entries)[representation];
+  ASSERT(id < entries->size());
+  return (*entries)[id];
 }
 
-const Blackboard::Entry& Blackboard::get(const char* representation) const
+bool Blackboard::exists(Id id) const
 {
-  return entries->find(representation)->second;
+  return id < entries->size() && (*entries)[id].counter > 0;
 }
 
-bool Blackboard::exists(const char* representation) const
+bool Blackboard::getCopyFunctions(const char* representation, Create& create, Copy& copy) const
 {
-  return entries->find(representation) != entries->end();
+  const Entry& entry = get(getId(representation));
+  create = entry.create;
+  copy = entry.copy;
+  return copy != nullptr;
 }
 
-Streamable& Blackboard::operator[](const char* representation)
+Streamable& Blackboard::operator[](Id id)
 {
-  Entry& entry = get(representation);
+  Entry& entry = get(id);
   ASSERT(entry.data);
   return *entry.data;
 }
 
-const Streamable& Blackboard::operator[](const char* representation) const
+const Streamable& Blackboard::operator[](Id id) const
 {
-  const Entry& entry = get(representation);
+  const Entry& entry = get(id);
   ASSERT(entry.data);
   return *entry.data;
 }
 
-void Blackboard::free(const char* representation)
+void Blackboard::free(Id id)
 {
-  Entry& entry = get(representation);
+  Entry& entry = get(id);
   ASSERT(entry.counter > 0);
   if(--entry.counter == 0)
   {
-    entries->erase(representation);
+    entry = Entry();
     ++version;
   }
 }
 
-void Blackboard::reset(const char* representation)
+void Blackboard::reset(Id id)
 {
-  Entry& entry = get(representation);
+  Entry& entry = get(id);
   entry.reset(&*entry.data);
 }
 
+void Blackboard::setLazyUpdate(Id id, LazyUpdate lazyUpdate, void* context)
+{
+  Entry& entry = get(id);
+  entry.lazyUpdate = lazyUpdate;
+  entry.lazyContext = context;
+}
+
+void Blackboard::update(Id id)
+{
+  if(id < entries->size())
+  {
+    Entry& entry = (*entries)[id];
+    if(entry.lazyUpdate)
+    {
+      // Reset first to prevent recursion.
+      const LazyUpdate lazyUpdate = entry.lazyUpdate;
+      entry.lazyUpdate = nullptr;
+      lazyUpdate(entry.lazyContext);
+    }
+  }
+}
+
 Blackboard& Blackboard::getInstance()
 {
   return *theInstance;
@@ -8,8 +8,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <functional>
+#include <type_traits>
 
 class Streamable;
 class In;
@@ -25,17 +27,40 @@ struct HasReadWrite
 
 class Blackboard
 {
+public:
+  using Create = Streamable* (*)(); /**< Creates a new instance of the type of a representation. */
+  using Copy = void (*)(const Streamable& from, Streamable& to); /**< Assigns a representation to another one of the same or a derived type. */
+  using Id = std::size_t; /**< The unique number of a representation name. It is the same in all threads. */
+  using LazyUpdate = void (*)(void* context); /**< Updates a representation that is provided lazily. */
+
 private:
   /** A single entry of the blackboard. */
   struct Entry
   {
     std::unique_ptr<Streamable> data; /**< The representation. */
     int counter = 0; /**< How many modules requested its existence? */
+    std::size_t size = 0; /**< The size of the type of the representation in bytes. */
     std::function<void(Streamable*)> reset;
+    Create create = nullptr; /**< Creates an instance of this representation or nullptr if it cannot be copied. */
+    Copy copy = nullptr; /**< Copies this representation or nullptr if it cannot be copied. */
+    LazyUpdate lazyUpdate = nullptr; /**< Brings the representation up to date if that is still pending. Otherwise nullptr. */
+    void* lazyContext = nullptr; /**< The parameter passed to lazyUpdate. */
   };
 
-  class Entries; /**< Type of the map for all entries. */
-  std::unique_ptr<Entries> entries; /**< All entries of the blackboard. */
+  /**
+   * Assigns a representation to another one.
+   * The target can also be an alias of the representation, i.e. a type derived from it.
+   * @param T The type of the source representation.
+   * @param from The representation copied.
+   * @param to The representation that is assigned to.
+   */
+  template<typename T> static void copy(const Streamable& from, Streamable& to)
+  {
+    *dynamic_cast<T*>(&to) = *dynamic_cast<const T*>(&from);
+  }
+
+  class Entries; /**< Type of the array of all entries. */
+  std::unique_ptr<Entries> entries; /**< All entries of the blackboard, indexed by the ids of their names. */
   int version = 0; /**< A version that is increased with each configuration change. */
 
   /**
@@ -47,13 +72,13 @@ private:
   friend class ThreadFrame; /**< A thread is allowed to set the instance. */
 
   /**
-   * Retrieve the blackboard entry for the name of a representation.
-   * @param representation The name of the representation.
+   * Retrieve the blackboard entry for the id of a representation.
+   * @param id The id of the name of the representation.
    * @return The blackboard entry. If it does not exist, it will
    * be created, but not the representation.
    */
-  Entry& get(const char* representation);
-  const Entry& get(const char* representation) const;
+  Entry& get(Id id);
+  const Entry& get(Id id) const;
 
 public:
   /**
@@ -68,12 +93,22 @@ public:
    */
   ~Blackboard();
 
+  /**
+   * Returns the id of the name of a representation. Ids are assigned when a
+   * name is used for the first time. Code that accesses the blackboard in
+   * every frame should determine the id only once, e.g. in a static variable.
+   * @param representation The name of the representation.
+   * @return The id. It is the same in all threads.
+   */
+  static Id getId(const char* representation);
+
   /**
    * Does a certain representation exist?
    * @param representation The name of the representation.
    * @return Does it exist in this blackboard?
    */
-  bool exists(const char* representation) const;
+  bool exists(const char* representation) const {return exists(getId(representation));}
+  bool exists(Id id) const;
 
   /**
    * Allocate a new blackboard entry for a representation of a
@@ -83,12 +118,14 @@ public:
    * @param representation The name of the representation.
    * @return The representation.
    */
-  template<typename T> T& alloc(const char* representation)
+  template<typename T> T& alloc(const char* representation) {return alloc<T>(getId(representation));}
+  template<typename T> T& alloc(Id id)
   {
-    Entry& entry = get(representation);
+    Entry& entry = get(id);
     if(entry.counter++ == 0)
     {
       entry.data = std::make_unique<T>();
+      entry.size = sizeof(T);
       if(HasReadWrite::test(dynamic_cast<T*>(&*entry.data)))
         entry.reset = [](Streamable* data)
       {
@@ -98,6 +135,15 @@ public:
       };
       else
         entry.reset = [](Streamable*) {};
+
+      // Representations with functions must not be copied to other threads, because the
+      // functions are bound to the modules of this thread.
+      if constexpr(std::is_copy_assignable_v<T>)
+        if(!HasReadWrite::test(dynamic_cast<T*>(&*entry.data)))
+        {
+          entry.create = []() -> Streamable* {return new T;};
+          entry.copy = &copy<T>;
+        }
       ++version;
     }
     return dynamic_cast<T&>(*entry.data);
@@ -109,14 +155,51 @@ public:
    * allocated.
    * @param representation The name of the representation.
    */
-  void free(const char* representation);
+  void free(const char* representation) {free(getId(representation));}
+  void free(Id id);
 
   /**
    * Reset the blackboard entry for a representation of a certain
    * name to its default state.
    * @param representation The name of the representation.
    */
-  void reset(const char* representation);
+  void reset(const char* representation) {reset(getId(representation));}
+  void reset(Id id);
+
+  /**
+   * Sets the function that brings a representation up to date when it is read
+   * the next time. It replaces an update that is still pending.
+   * @param id The id of the name of the representation.
+   * @param lazyUpdate The function or nullptr to cancel a pending update.
+   * @param context The parameter passed to the function.
+   */
+  void setLazyUpdate(Id id, LazyUpdate lazyUpdate, void* context);
+
+  /**
+   * Executes the pending update of a representation that is provided lazily.
+   * Nothing happens if there is none.
+   * @param representation The name of the representation.
+   */
+  void update(const char* representation) {update(getId(representation));}
+  void update(Id id);
+
+  /**
+   * Returns the functions that allow exchanging a representation between
+   * threads by copying it instead of streaming it.
+   * @param representation The name of the representation. It must exist.
+   * @param create Is set to a function that creates an instance of the representation's type.
+   * @param copy Is set to a function that copies the representation.
+   * @return Can the representation be copied? Otherwise, both functions are nullptr.
+   */
+  bool getCopyFunctions(const char* representation, Create& create, Copy& copy) const;
+
+  /**
+   * Returns the size of the type of a representation, i.e. without the
+   * memory it allocated itself.
+   * @param representation The name of the representation. It must exist.
+   * @return The size in bytes.
+   */
+  std::size_t getSize(const char* representation) const {return get(getId(representation)).size;}
 
   /**
    * Access a representation of a certain name. The representation
@@ -124,8 +207,10 @@ public:
    * @param representation The name of the representation.
    * @return The instance of the representation in the blackboard.
    */
-  Streamable& operator[](const char* representation);
-  const Streamable& operator[](const char* representation) const;
+  Streamable& operator[](const char* representation) {return (*this)[getId(representation)];}
+  const Streamable& operator[](const char* representation) const {return (*this)[getId(representation)];}
+  Streamable& operator[](Id id);
+  const Streamable& operator[](Id id) const;
 
   /**
    * Return the current version.
@@ -9,10 +9,11 @@
 
 #include "Communication.h"
 #include "Framework/ThreadFrame.h"
+#include <algorithm>
 
 bool DebugSenderBase::terminating = false;
 
-void ReceiverBase::setPacket(void* p)
+int ReceiverBase::getWritingIndex() const
 {
   int writing = 0;
   if(writing == actual)
@@ -20,11 +21,29 @@ void ReceiverBase::setPacket(void* p)
   if(writing == reading)
     if(++writing == actual)
       ++writing;
+  return writing;
+}
+
+OutBinaryMemory ReceiverBase::getPacketStream(int writing)
+{
+  if(pending[writing]) // An unread packet is overwritten.
+  {
+    packetsMerged.fetch_add(1, std::memory_order_relaxed);
+    pending[writing] = false;
+  }
+  char* buffer = packet[writing];
+  packet[writing] = nullptr;
+  return OutBinaryMemory(capacity[writing], buffer, true);
+}
+
+void ReceiverBase::setPacket(OutBinaryMemory& stream, int writing)
+{
   ASSERT(writing != actual);
   ASSERT(writing != reading);
-  if(packet[writing])
-    std::free(packet[writing]);
-  packet[writing] = p;
+  highWaterMark = std::max(highWaterMark, stream.size());
+  capacity[writing] = stream.capacity();
+  packet[writing] = stream.obtainData();
+  pending[writing] = true;
   actual = writing;
   thread->trigger();
 }
@@ -13,6 +13,7 @@
 #include "Platform/Thread.h"
 #include "Streaming/InStreams.h"
 #include "Streaming/OutStreams.h"
+#include <atomic>
 #include <cstdlib>
 
 class ThreadFrame;
@@ -38,21 +39,31 @@ public:
 
 protected:
   ThreadFrame* thread;   /**< The thread this receiver is associated with. */
-  void* packet[3];           /**< A triple buffer for received packets. */
+  char* packet[3];           /**< A triple buffer for received packets. The buffers are reused for all packets. */
+  size_t capacity[3];        /**< The sizes of the buffers in packet. */
+  volatile bool pending[3];  /**< Does the corresponding buffer contain a packet that was not read yet? */
   volatile int reading = 0;   /**< Index of packet reserved for reading. */
   volatile int actual = 0;    /**< Index of packet that is the most actual. */
+  size_t highWaterMark = 0;  /**< The size of the largest packet received so far. */
+  std::atomic<unsigned> packetsMerged = 0; /**< The number of packets overwritten before they were read. */
 
 public:
   /**
    * The constructor.
    * @param thread The thread that should be notified that a packet has arrived.
    * @param senderThreadName The name of the sender thread.
+   * @param packetSize The initial size of each packet buffer in bytes. Buffers grow if a
+   *                   packet does not fit in, but they are never shrunk.
    */
-  ReceiverBase(ThreadFrame* thread, const std::string& senderThreadName) :
+  ReceiverBase(ThreadFrame* thread, const std::string& senderThreadName, size_t packetSize = 16384) :
     senderThreadName(senderThreadName), thread(thread)
   {
     for(int i = 0; i < 3; ++i)
-      packet[i] = 0;
+    {
+      packet[i] = nullptr;
+      capacity[i] = packetSize;
+      pending[i] = false;
+    }
   }
 
   virtual ~ReceiverBase()
@@ -62,21 +73,64 @@ public:
         std::free(packet[i]);
   }
 
+  /**
+   * The function determines the buffer the next packet will be written to.
+   * It must only be called by the sender.
+   *
+   * @return The index of a buffer that is neither the most actual nor reserved for reading.
+   */
+  int getWritingIndex() const;
+
+  /**
+   * The function creates a stream that writes into the buffer of a packet.
+   * It must only be called by the sender. The buffer is owned by the stream
+   * until it is returned by calling setPacket.
+   *
+   * @param writing The index of the buffer as returned by getWritingIndex().
+   * @return The stream that writes into the buffer.
+   */
+  OutBinaryMemory getPacketStream(int writing);
+
   /**
    * The function sets the packet.
    *
-   * @param p The packet.
+   * @param stream The stream the packet was written to, as returned by getPacketStream().
+   * @param writing The index of the buffer the packet is stored in, as returned by getWritingIndex().
    */
-  void setPacket(void* p);
+  void setPacket(OutBinaryMemory& stream, int writing);
 
   /**
    * The function determines whether the receiver has a pending packet.
    *
    * @return Is there still an unprocessed packet?
    */
-  bool hasPendingPacket() const { return packet[actual] != 0; }
+  bool hasPendingPacket() const { return pending[actual]; }
+
+  /**
+   * Returns the size of the largest packet received so far.
+   * It can be used to configure the initial size of the packet buffers.
+   *
+   * @return The size in bytes.
+   */
+  size_t getHighWaterMark() const { return highWaterMark; }
+
+  /**
+   * Returns the number of packets that were replaced by a newer one before
+   * the receiving thread read them, i.e. that were merged into a later frame.
+   *
+   * @return The number of packets.
+   */
+  unsigned getPacketsMerged() const { return packetsMerged.load(std::memory_order_relaxed); }
 };
 
+/**
+ * Packet types that exchange data beside the streamed packet (e.g. ModulePacket) can
+ * implement a method <code>void setSlot(int slot)</code>. The sender and the receiver
+ * call it with the index of the triple buffer entry that is currently written or read.
+ */
+template<typename PacketType>
+concept SlotAwarePacket = requires(PacketType& packet) { packet.setSlot(0); };
+
 /**
  * @class Receiver
  *
@@ -91,9 +145,10 @@ public:
    * The constructor.
    * @param thread The thread that should be notified that a packet has arrived.
    * @param senderThreadName The name of the sender thread.
+   * @param packetSize The initial size of each packet buffer in bytes.
    */
-  Receiver(ThreadFrame* thread, const std::string& senderThreadName) :
-    ReceiverBase(thread, senderThreadName) {}
+  Receiver(ThreadFrame* thread, const std::string& senderThreadName, size_t packetSize = 16384) :
+    ReceiverBase(thread, senderThreadName, packetSize) {}
 
   /**
    * The function checks whether a new packet has arrived and streams it into the local buffer.
@@ -101,13 +156,14 @@ public:
   void receivePacket()
   {
     reading = actual;
-    if(packet[reading])
+    if(pending[reading])
     {
       PacketType& data = *static_cast<PacketType*>(this);
+      if constexpr(SlotAwarePacket<PacketType>)
+        data.setSlot(reading);
       InBinaryMemory memory(packet[reading]);
       memory >> data;
-      std::free(packet[reading]);
-      packet[reading] = 0;
+      pending[reading] = false;
     }
   }
 };
@@ -170,10 +226,13 @@ public:
     // Dummy Sender does not send anything
     if(receiverThreadName == Communication::dummy)
       return;
-    const PacketType& data = *static_cast<const PacketType*>(this);
-    OutBinaryMemory stream(16384);
+    const int writing = receiver.getWritingIndex();
+    PacketType& data = *static_cast<PacketType*>(this);
+    if constexpr(SlotAwarePacket<PacketType>)
+      data.setSlot(writing);
+    OutBinaryMemory stream = receiver.getPacketStream(writing);
     stream << data;
-    receiver.setPacket(stream.obtainData());
+    receiver.setPacket(stream, writing);
   }
 
   /**
@@ -36,6 +36,25 @@ STREAMABLE(Configuration,
     (std::string) provider,
   });
 
+  /** A module whose providers are only executed in certain states of a thread, e.g. game states. */
+  STREAMABLE(StateDependentModule,
+  {,
+    (std::string) module,
+    (std::vector<std::string>) states, /**< The names of the states in which the providers of the module are executed. */
+  });
+
+  /**
+   * A module that provides a representation in addition to its actual provider,
+   * e.g. an optimized variant of it. The results of both are compared in every
+   * frame, but only those of the actual provider are used.
+   */
+  STREAMABLE(ShadowProvider,
+  {,
+    (std::string) representation,
+    (std::string) provider,
+    (float)(0.f) tolerance, /**< The maximum absolute difference of numbers in the results that is still accepted. */
+  });
+
   STREAMABLE(Thread,
   {
     /**
@@ -50,11 +69,20 @@ STREAMABLE(Configuration,
 
     (std::string) name,
     (int)(0) priority,
+    (std::vector<unsigned>) affinity, /**< The cores this thread may run on (only on the robot). Empty means all cores. */
+    (unsigned)(0) wakeUpSpinTime, /**< If not 0, the thread waits for new data with a futex-based semaphore that spins up to this time before sleeping (in µs). */
     (unsigned)(0) debugReceiverSize, /**< The maximum size of the queue in Bytes. */
     (unsigned)(0) debugSenderSize, /**< The maximum size of the queue in Bytes. */
     (unsigned)(0) debugSenderInfrastructureSize,
+    (unsigned)(16384) receiverPacketSize, /**< The initial size of the buffers for packets received from each other thread in Bytes. */
+    (unsigned)(0) workerThreads, /**< The number of additional threads executing independent providers in parallel (only in Release builds on the robot). */
+    (unsigned)(0) minFramePeriod, /**< If not 0, frames of this thread start at most this often (in ms). Packets arriving in between are merged into the next frame. */
+    (unsigned)(0) traceOverrun, /**< If not 0, a trace of all threads is written when a frame of this thread takes longer than this (in ms). */
+    (unsigned)(0) frameArenaSize, /**< The size of the arena for temporary data of a frame in KB. Each worker thread gets one as well. 0 means none. */
     (std::string) executionUnit,
+    (std::vector<StateDependentModule>) stateDependentModules, /**< Modules that are only executed in certain states. All others are always executed. */
     (std::vector<RepresentationProvider>) representationProviders,
+    (std::vector<ShadowProvider>) shadowProviders, /**< Alternative providers whose results are compared to those of the actual providers. */
   });
 
   /**
@@ -64,6 +92,8 @@ STREAMABLE(Configuration,
   std::vector<Thread>& operator()() { return threads; };
   const std::vector<Thread>& operator()() const { return threads; },
 
+  (bool)(false) hugePages, /**< Back large blocks such as images with transparent huge pages (only on Linux)? */
   (std::vector<std::string>) defaultRepresentations,
+  (std::vector<std::string>) sharedRepresentations, /**< Representations exchanged between threads by copying instead of streaming them. Only used if they contain no functions. */
   (std::vector<Thread>) threads, /**< Should be accessed via operator(). */
 });
@@ -9,8 +9,10 @@
 
 #include "Debug.h"
 #include "Debugging/Debugging.h"
+#include "Platform/Memory.h"
 #include "Platform/Time.h"
 #include "Streaming/TypeInfo.h"
+#include <algorithm>
 
 Debug::Debug(const Settings& settings, const std::string& robotName, const Configuration& config) :
 #ifdef TARGET_ROBOT
@@ -137,6 +139,13 @@ bool Debug::main()
     OUTPUT_TEXT(text);
   }
 
+  DEBUG_RESPONSE_ONCE("debug:memory")
+  {
+    // Shows the size of the large blocks allocated per subsystem.
+    OUTPUT_TEXT("images: " << static_cast<unsigned>(Memory::getAllocated(Memory::images) / 1024) << " KB");
+    OUTPUT_TEXT("debug images: " << static_cast<unsigned>(Memory::getAllocated(Memory::debugImages) / 1024) << " KB");
+  }
+
   // Move the messages from other threads' debug queues to the outgoing queue
   for(Receiver<MessageQueue>& receiver : receivers)
   {
@@ -148,8 +157,13 @@ bool Debug::main()
   }
 
   // If not requested otherwise, send only latest of each type
+  bool skipUnchanged = false;
+  DEBUG_RESPONSE("debug:skipUnchangedData")
+    skipUnchanged = true;
+  if(!skipUnchanged)
+    sentData.clear();
   DEBUG_RESPONSE_NOT("debug:keepAllMessages")
-    removeRepetitions();
+    removeRepetitions(skipUnchanged);
 
   // Send messages to the threads
 #ifndef TARGET_ROBOT
@@ -183,7 +197,7 @@ bool Debug::main()
     return true;
 }
 
-void Debug::removeRepetitions()
+void Debug::removeRepetitions(bool skipUnchanged)
 {
   std::unordered_map<std::string, std::array<size_t, numOfMessageIDs>> threads;
   std::string thread = "unknown";
@@ -200,6 +214,7 @@ void Debug::removeRepetitions()
   }
 
   messagesPerType = threads["unknown"].data();
+  SentData* sentPerType = skipUnchanged ? sentData[thread].data() : nullptr;
   size_t originalSize = 0;
   size_t sizeAfterFrameBegin = 0;
 
@@ -213,6 +228,8 @@ void Debug::removeRepetitions()
         message.bin() >> thread;
         sizeAfterFrameBegin = debugSender->size();
         messagesPerType = threads[thread].data();
+        if(skipUnchanged)
+          sentPerType = sentData[thread].data();
         return true;
 
       case idFrameFinished:
@@ -245,6 +262,17 @@ void Debug::removeRepetitions()
       default:
         if(message.id() >= numOfDataMessageIDs)
           return --messagesPerType[message.id()] == 0;
+        else if(skipUnchanged && messagesPerType[idFrameFinished] == 1)
+        {
+          // data only from latest frame and only if it changed or was not sent for a while
+          SentData& sent = sentPerType[message.id()];
+          if(sent.data.size() == message.size() && std::equal(sent.data.begin(), sent.data.end(), message.data())
+             && Time::getTimeSince(sent.timestamp) < keyframeInterval)
+            return false;
+          sent.data.assign(message.data(), message.data() + message.size());
+          sent.timestamp = Time::getCurrentSystemTime();
+          return true;
+        }
         [[fallthrough]];
 
       // data only from latest frame
@@ -305,6 +333,7 @@ bool Debug::handleMessage(MessageQueue::Message message)
       }
       [[fallthrough]];
 
+    case idModuleSnapshot:
     case idTypeInfo:
       for(DebugSender<MessageQueue>& sender : senders)
         sender << message;
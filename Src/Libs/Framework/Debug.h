@@ -19,7 +19,9 @@
 #include "Framework/ModuleGraphCreator.h"
 #include "Framework/ThreadFrame.h"
 
+#include <array>
 #include <unordered_map>
+#include <vector>
 
 /**
  * @class Debug
@@ -44,6 +46,16 @@ private:
   std::list<DebugSender<MessageQueue>> senders; /**< The list of all senders of this thread. */
   std::unordered_map<std::string, DebugSender<MessageQueue>*> senderMap;
 
+  /** The data message last sent of a certain type from a certain thread. */
+  struct SentData
+  {
+    std::vector<char> data; /**< The contents of the message. */
+    unsigned timestamp = 0; /**< When was it sent? */
+  };
+
+  static constexpr int keyframeInterval = 1000; /**< Unchanged data messages are sent again after this many milliseconds. */
+  std::unordered_map<std::string, std::array<SentData, numOfDataMessageIDs>> sentData; /**< The data messages last sent per thread. */
+
   std::unique_ptr<ModuleGraphCreator> moduleGraphCreator; /**< Calculates the execution order of the modules of all threads and their data exchange. */
   Configuration config; /**< The initial configuration of all threads. */
 
@@ -52,8 +64,13 @@ private:
    * the size of the queue. Some message types are kept, for some only the latest
    * messages per thread are kept, and for others only messages from the latest
    * frame are kept.
+   * @param skipUnchanged Also remove data messages that are identical to the ones
+   *                      of the same type and thread sent last, unless that was
+   *                      more than \c keyframeInterval ago. The receiver keeps the
+   *                      data it received before, so this is transparent for views,
+   *                      but not for logs recorded from the stream.
    */
-  void removeRepetitions();
+  void removeRepetitions(bool skipUnchanged);
 
 public:
   /**
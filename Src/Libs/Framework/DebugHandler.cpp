@@ -34,7 +34,8 @@ void DebugHandler::communicate(bool send)
   int receivedSize = 0;
 
   ASSERT(sendSize <= std::numeric_limits<int>::max());
-  if(sendAndReceive(sendData, static_cast<int>(sendSize), receivedData, receivedSize) && sendSize)
+  // Do not block this thread if the receiver is slow. The rest of the packet is sent in later frames.
+  if(sendAndReceive(sendData, static_cast<int>(sendSize), receivedData, receivedSize, false) && sendSize)
   {
     delete [] sendData;
     sendData = nullptr;
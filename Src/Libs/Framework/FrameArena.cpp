@@ -0,0 +1,63 @@
+/**
+ * @file FrameArena.cpp
+ *
+ * This file implements a memory arena for temporary data that only lives
+ * during a single frame.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "FrameArena.h"
+#include "Debugging/Debugging.h"
+#include "Platform/BHAssert.h"
+#include "Platform/Thread.h"
+#include <algorithm>
+#include <new>
+
+thread_local FrameArena* FrameArena::current = nullptr;
+
+FrameArena::FrameArena(std::size_t size) :
+  buffer(std::make_unique<char[]>(size)),
+  size(size)
+{}
+
+void FrameArena::reset()
+{
+  ASSERT(!allocations);
+  if(required > size && required > reported)
+  {
+    OUTPUT_WARNING("Frame arena of " << Thread::getCurrentThreadName() << " is too small, " << static_cast<unsigned>((required + 1023) / 1024) << " KB required");
+    reported = required;
+  }
+  used = required = allocations = 0;
+}
+
+void* FrameArena::allocate(FrameArena* arena, std::size_t bytes, std::size_t alignment)
+{
+  if(arena)
+  {
+    const std::size_t begin = (arena->used + alignment - 1) & ~(alignment - 1);
+    if(begin + bytes <= arena->size)
+    {
+      arena->used = begin + bytes;
+      arena->required = std::max(arena->required, arena->used);
+      ++arena->allocations;
+      return arena->buffer.get() + begin;
+    }
+    arena->required = std::max(arena->required, begin + bytes);
+  }
+  return ::operator new(bytes, std::align_val_t(alignment));
+}
+
+void FrameArena::deallocate(FrameArena* arena, void* p, std::size_t bytes, std::size_t alignment)
+{
+  if(arena && p >= arena->buffer.get() && p < arena->buffer.get() + arena->size)
+  {
+    // Only the most recent block can be given back, which is common when a vector grows.
+    if(static_cast<char*>(p) + bytes == arena->buffer.get() + arena->used)
+      arena->used -= bytes;
+    --arena->allocations;
+  }
+  else
+    ::operator delete(p, bytes, std::align_val_t(alignment));
+}
@@ -0,0 +1,114 @@
+/**
+ * @file FrameArena.h
+ *
+ * This file declares a memory arena for temporary data that only lives
+ * during a single frame. Each thread executing modules activates its own
+ * arena, which is reset by the ModuleGraphRunner when a frame begins.
+ * Allocation only increments a pointer and deallocation does nothing
+ * (except for the most recent block, which is given back), so containers
+ * using \c FrameArena::Allocator do not access the heap in steady-state
+ * frames. If no arena is active in a thread or the arena is exhausted, the
+ * heap is used instead.
+ *
+ * Containers allocated from an arena must not survive the frame, i.e. they
+ * should be local variables of an update method.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class FrameArena
+{
+  thread_local static FrameArena* current; /**< The arena active in this thread. nullptr if none. */
+
+  std::unique_ptr<char[]> buffer; /**< The memory of the arena. */
+  std::size_t size; /**< The size of the memory in bytes. */
+  std::size_t used = 0; /**< The number of bytes allocated. */
+  std::size_t required = 0; /**< The number of bytes that would have been allocated if the arena were large enough. */
+  std::size_t reported = 0; /**< The largest value of \c required reported so far. */
+  std::size_t allocations = 0; /**< The number of blocks currently allocated from this arena. */
+
+public:
+  /**
+   * An allocator for STL containers that allocates from the arena that was
+   * active in the thread when the allocator was constructed.
+   * @tparam T The type of the elements allocated.
+   */
+  template<typename T> class Allocator
+  {
+    FrameArena* arena; /**< The arena allocated from. nullptr if the heap is used. */
+
+    template<typename U> friend class Allocator;
+
+  public:
+    using value_type = T;
+
+    /** Constructs an allocator for the arena of the current thread. */
+    Allocator() : arena(FrameArena::current) {}
+
+    template<typename U> Allocator(const Allocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(std::size_t n)
+    {
+      return static_cast<T*>(FrameArena::allocate(arena, n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n)
+    {
+      FrameArena::deallocate(arena, p, n * sizeof(T), alignof(T));
+    }
+
+    template<typename U> bool operator==(const Allocator<U>& other) const {return arena == other.arena;}
+  };
+
+  /**
+   * Constructor.
+   * @param size The size of the arena in bytes.
+   */
+  FrameArena(std::size_t size);
+
+  /** Destructor. The arena is deactivated if it is active in the calling thread. */
+  ~FrameArena() {if(current == this) current = nullptr;}
+
+  FrameArena(const FrameArena&) = delete;
+  FrameArena& operator=(const FrameArena&) = delete;
+
+  /** @return The size of the arena in bytes. */
+  std::size_t getSize() const {return size;}
+
+  /** Makes this arena the one that is used by the calling thread. */
+  void activate() {current = this;}
+
+  /**
+   * Frees all blocks allocated. None of them must still be in use. A warning
+   * is printed if the arena was too small in the frame that ended.
+   */
+  void reset();
+
+private:
+  /**
+   * Allocates a block of memory.
+   * @param arena The arena to allocate from. If nullptr, the heap is used.
+   * @param bytes The size of the block in bytes.
+   * @param alignment The alignment of the block.
+   * @return The address of the block.
+   */
+  static void* allocate(FrameArena* arena, std::size_t bytes, std::size_t alignment);
+
+  /**
+   * Frees a block of memory.
+   * @param arena The arena the block was allocated from. If nullptr, the heap is used.
+   * @param p The address of the block.
+   * @param bytes The size of the block in bytes.
+   * @param alignment The alignment of the block.
+   */
+  static void deallocate(FrameArena* arena, void* p, std::size_t bytes, std::size_t alignment);
+};
+
+/** A vector that allocates its elements from the frame arena of the current thread. */
+template<typename T> using FrameVector = std::vector<T, FrameArena::Allocator<T>>;
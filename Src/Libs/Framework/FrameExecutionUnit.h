@@ -47,6 +47,15 @@ public:
    */
   virtual bool beforeFrame() {return true;}
 
+  /**
+   * The function returns the state the modules of this frame are executed in.
+   * The configuration can restrict modules to certain states. The function
+   * is called after \c beforeFrame .
+   * @return The name of the state or nullptr if there is none. In that case,
+   *         all modules are executed.
+   */
+  virtual const char* getState() const {return nullptr;}
+
   /**
    * The function is executed before the modules are executed.
    */
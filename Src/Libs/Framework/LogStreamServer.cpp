@@ -0,0 +1,76 @@
+/**
+ * @file LogStreamServer.cpp
+ *
+ * This file implements a TCP server through which the logger streams the
+ * frames it logs to a workstation.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "LogStreamServer.h"
+#include <cstring>
+
+LogStreamServer::LogStreamServer(int port, std::size_t capacity, const char* prefix, std::size_t prefixSize) :
+  server(nullptr, port),
+  prefix(prefix, prefix + prefixSize),
+  capacity(capacity)
+{
+  queue.reserve(prefixSize + capacity);
+}
+
+bool LogStreamServer::write(const char* data, std::size_t size)
+{
+  send();
+  const unsigned blockSize = static_cast<unsigned>(size);
+  if(!isConnected || queue.size() - sent + sizeof(blockSize) + size > prefix.size() + capacity)
+    return false;
+
+  // Same format as a block in a compressed log file.
+  queue.resize(queue.size() + sizeof(blockSize) + size);
+  std::memcpy(queue.data() + queue.size() - size - sizeof(blockSize), &blockSize, sizeof(blockSize));
+  std::memcpy(queue.data() + queue.size() - size, data, size);
+  send();
+  return true;
+}
+
+void LogStreamServer::send()
+{
+  if(!isConnected)
+  {
+    if(!server.checkConnection())
+      return;
+
+    // A new client first receives the beginning of a log file.
+    isConnected = true;
+    queue = prefix;
+    sent = 0;
+  }
+
+  while(sent < queue.size())
+  {
+    const int bytes = server.sendNonBlocking(reinterpret_cast<const unsigned char*>(queue.data() + sent), static_cast<int>(queue.size() - sent));
+    if(bytes < 0)
+    {
+      // Frames that were not sent completely are lost.
+      isConnected = false;
+      queue.clear();
+      sent = 0;
+      return;
+    }
+    else if(!bytes)
+      break; // The send buffer is full.
+    sent += bytes;
+  }
+
+  // Remove the data sent as soon as it is at least half of the queue.
+  if(sent == queue.size())
+  {
+    queue.clear();
+    sent = 0;
+  }
+  else if(sent >= queue.size() / 2)
+  {
+    queue.erase(queue.begin(), queue.begin() + sent);
+    sent = 0;
+  }
+}
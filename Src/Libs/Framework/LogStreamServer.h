@@ -0,0 +1,57 @@
+/**
+ * @file LogStreamServer.h
+ *
+ * This file declares a TCP server through which the logger streams the
+ * frames it logs to a workstation. A client receives the data in the format
+ * of a compressed log file without its index, i.e. it can be played back
+ * while it is received and simply be saved as a log file. Each client
+ * receives the beginning of a log file (settings, message ids, type info)
+ * when it connects, followed by the frames logged from then on. The frames
+ * are queued up to a certain size. Frames that do not fit into the queue or
+ * that are logged while no client is connected are not streamed.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Network/TcpComm.h"
+#include <vector>
+
+class LogStreamServer
+{
+  TcpComm server; /**< The server socket and the connection to the client. */
+  std::vector<char> prefix; /**< The beginning of a log file up to, but not including, the log data. */
+  std::size_t capacity; /**< The maximum number of bytes queued (excluding the prefix). */
+  std::vector<char> queue; /**< The data that is sent to the client. */
+  std::size_t sent = 0; /**< The number of bytes in \c queue that were already sent. */
+  bool isConnected = false; /**< Is a client connected? */
+
+public:
+  /**
+   * Opens the server.
+   * @param port The port the server listens on.
+   * @param capacity The maximum number of bytes queued.
+   * @param prefix The beginning of a log file up to, but not including, the log data.
+   * @param prefixSize The size of the prefix in bytes.
+   */
+  LogStreamServer(int port, std::size_t capacity, const char* prefix, std::size_t prefixSize);
+
+  /**
+   * Queues a frame for sending it to the client.
+   * @param data The frame as a compressed log file block without its size.
+   * @param size The size of the compressed block in bytes.
+   * @return Will the frame be sent? If not, no client is connected or the
+   *         queue is full.
+   */
+  bool write(const char* data, std::size_t size);
+
+  /** Sends as much of the data queued as possible without waiting. */
+  void send();
+
+  /**
+   * Is there queued data that was not sent yet?
+   * @return Is data waiting to be sent?
+   */
+  bool isSending() const {return sent < queue.size();}
+};
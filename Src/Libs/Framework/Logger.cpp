@@ -13,15 +13,19 @@
 #include "Logger.h"
 #include "Debugging/AnnotationManager.h"
 #include "Debugging/Debugging.h"
+#include "Debugging/Modify.h"
 #include "Debugging/Stopwatch.h"
+#include "Debugging/Tracer.h"
 #include "Framework/Blackboard.h"
 #include "Framework/LoggingTools.h"
 #include "Framework/Settings.h"
 #include "Platform/BHAssert.h"
 #include "Platform/File.h"
 #include "Platform/SystemCall.h"
+#include "Platform/Time.h"
 #include "Streaming/Global.h"
 #include "Streaming/TypeInfo.h"
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #ifdef LINUX
@@ -85,6 +89,10 @@ Logger::Logger(const Configuration& config) :
     threadFound:;
     }
 
+  for(const RepresentationsPerThread& rpt : representationsPerThread)
+    statistics.threads.emplace_back().thread = rpt.thread;
+  framesPerThread.resize(representationsPerThread.size(), 0);
+
 #ifndef TARGET_ROBOT
   enabled = false;
   path = "Logs/";
@@ -96,6 +104,24 @@ Logger::Logger(const Configuration& config) :
     typeInfo << *TypeInfo::current;
     LoggingTools::writeSettings(settings, Global::getSettings());
 
+    if(sharedMemorySize || streamPort)
+    {
+      OutBinaryMemory prefix(typeInfo.size() + settings.size() + 4096);
+      writeLogFilePrefix(prefix);
+      if(sharedMemorySize)
+      {
+        sharedLogRing = std::make_unique<SharedLogRing>("/bhuman-log", sharedMemorySize, prefix.data(), prefix.size());
+        if(!sharedLogRing->exists())
+          OUTPUT_WARNING("Logger: Shared memory could not be created!");
+      }
+      if(streamPort)
+      {
+        // The stream has the format of a compressed log file.
+        prefix << LoggingTools::logFileCompressed;
+        logStreamServer = std::make_unique<LogStreamServer>(static_cast<int>(streamPort), streamQueueSize, prefix.data(), prefix.size());
+      }
+    }
+
     buffers.resize(numOfBuffers);
     for(MessageQueue& buffer : buffers)
     {
@@ -122,6 +148,11 @@ void Logger::update(const LoggingController& controller)
       SYNC;
       if(!buffersAvailable.empty())
       {
+        // The statistics cover a single logging period.
+        for(Statistics::ThreadStatistics& threadStatistics : statistics.threads)
+          threadStatistics.framesLogged = threadStatistics.framesDropped = 0;
+        statistics.maxQueueDepth = statistics.maxBatchSize = 0;
+
         MessageQueue* buffer = buffersAvailable.top();
         buffersAvailable.pop();
         buffer->bin(undefined) << (path + LoggingTools::createName(Global::getSettings().headName, Global::getSettings().bodyName,
@@ -148,12 +179,25 @@ bool Logger::execute(const std::string& threadName)
   if(!enabled)
     return true; // true because if the logger is not enabled, it doesn't make sense to keep data for later.
 
+#if !defined TARGET_ROBOT || !defined NDEBUG
+  {
+    Statistics statistics;
+    {
+      SYNC;
+      statistics = this->statistics;
+    }
+    MODIFY("logger:statistics", statistics);
+  }
+#endif
+
   // If not logging, stop here.
   if(!logging.load(std::memory_order_relaxed))
     return false;
 
   bool bufferAvailabilityChanged = false;
-  for(const RepresentationsPerThread& rpt : representationsPerThread)
+  for(std::size_t i = 0; i < representationsPerThread.size(); ++i)
+  {
+    const RepresentationsPerThread& rpt = representationsPerThread[i];
     if(rpt.thread == threadName && !rpt.representations.empty())
     {
       MessageQueue* buffer = nullptr;
@@ -164,6 +208,8 @@ bool Logger::execute(const std::string& threadName)
           buffer = buffersAvailable.top();
           buffersAvailable.pop();
         }
+        else
+          ++statistics.threads[i].framesDropped;
         const bool bufferIsAvailable = buffer != nullptr;
         bufferAvailabilityChanged = bufferWasAvailable != bufferIsAvailable;
         bufferWasAvailable = bufferIsAvailable;
@@ -181,19 +227,22 @@ bool Logger::execute(const std::string& threadName)
       {
         buffer->bin(idFrameBegin) << threadName;
 
+        const bool logLowRate = lowRateInterval <= 1 || framesPerThread[i]++ % lowRateInterval == 0;
         for(const std::string& representation : rpt.representations)
+          if(logLowRate || std::find(lowRateRepresentations.begin(), lowRateRepresentations.end(), representation) == lowRateRepresentations.end())
 #ifndef NDEBUG
-          if(Blackboard::getInstance().exists(representation.c_str()))
+            if(Blackboard::getInstance().exists(representation.c_str()))
 #endif
-          {
-            MessageQueue::OutBinary stream = buffer->bin(static_cast<MessageID>(TypeRegistry::getEnumValue(typeid(MessageID).name(), "id" + representation)));
-            stream << Blackboard::getInstance()[representation.c_str()];
-            if(stream.failed())
-              OUTPUT_WARNING("Logger: Representation " << representation << " did not fit into buffer!");
-          }
+            {
+              MessageQueue::OutBinary stream = buffer->bin(static_cast<MessageID>(TypeRegistry::getEnumValue(typeid(MessageID).name(), "id" + representation)));
+              Blackboard::getInstance().update(representation.c_str());
+              stream << Blackboard::getInstance()[representation.c_str()];
+              if(stream.failed())
+                OUTPUT_WARNING("Logger: Representation " << representation << " did not fit into buffer!");
+            }
 #ifndef NDEBUG
-          else
-            OUTPUT_WARNING("Logger: Representation " << representation << " does not exist!");
+            else
+              OUTPUT_WARNING("Logger: Representation " << representation << " does not exist!");
 #endif
 
         *buffer << Global::getAnnotationManager().getOut();
@@ -204,10 +253,14 @@ bool Logger::execute(const std::string& threadName)
         SYNC;
         buffersToWrite.push_back(buffer);
         bufferWasAvailable = true;
+        ++statistics.threads[i].framesLogged;
+        statistics.queueDepth = static_cast<unsigned>(buffersToWrite.size());
+        statistics.maxQueueDepth = std::max(statistics.maxQueueDepth, statistics.queueDepth);
       }
       framesToWrite.post();
       break;
     }
+  }
 
   return true;
 }
@@ -219,6 +272,96 @@ Logger::~Logger()
   writerThread.stop();
 }
 
+void Logger::writeLogFilePrefix(Out& stream) const
+{
+  stream << LoggingTools::logFileSettings;
+  stream.write(settings.data(), settings.size());
+  stream << LoggingTools::logFileMessageIDs << static_cast<unsigned char>(numOfMessageIDs);
+  FOREACH_ENUM(MessageID, i, numOfMessageIDs)
+    stream << TypeRegistry::getEnumName(i);
+  stream << LoggingTools::logFileTypeInfo;
+  stream.write(typeInfo.data(), typeInfo.size());
+}
+
+void LogFileIndex::clear()
+{
+  size = 0;
+  frames.clear();
+  statsPerThread.clear();
+  annotationsPerThread.clear();
+}
+
+void LogFileIndex::add(const MessageQueue& frame, const std::vector<MessageID>& mapLogToID)
+{
+  std::string thread;
+  (*frame.begin()).bin() >> thread;
+  std::vector<std::pair<std::size_t, std::size_t>>& stats = statsPerThread[thread];
+  stats.resize(std::max(static_cast<std::size_t>(numOfMessageIDs), mapLogToID.size()));
+
+  bool hasImage = false;
+  unsigned time = 0;
+  const auto previousAnnotations = annotationsPerThread.find(thread);
+  const std::size_t firstAnnotation = previousAnnotations == annotationsPerThread.end() ? 0 : previousAnnotations->second.size();
+  for(MessageQueue::Message message : frame)
+  {
+    MessageID id = message.id();
+    if(!mapLogToID.empty())
+      id = id < mapLogToID.size() ? mapLogToID[id] : undefined;
+    if(id == idCameraImage || id == idJPEGImage)
+      hasImage = true;
+    else if(id == idFrameInfo)
+      message.bin() >> time; // FrameInfo::time is streamed first.
+    else if(id == idAnnotation)
+    {
+      // See AnnotationManager::add for the format.
+      Annotation& annotation = annotationsPerThread[thread].emplace_back();
+      InBinaryMemory stream = message.bin();
+      stream >> annotation.number;
+      annotation.number &= ~0x80000000;
+      annotation.frame = static_cast<unsigned>(frames.size());
+      const std::size_t size = stream.getSize() - stream.getPosition();
+      std::string text(size, 0);
+      stream.read(text.data(), size);
+      InTextMemory textStream(text.data(), size);
+      textStream >> annotation.name;
+      annotation.annotation = textStream.readAll();
+    }
+    ++stats[message.id()].first;
+    stats[message.id()].second += sizeof(MessageQueue::MessageHeader) + message.size();
+  }
+
+  if(const auto annotations = annotationsPerThread.find(thread); annotations != annotationsPerThread.end())
+    for(std::size_t i = firstAnnotation; i < annotations->second.size(); ++i)
+      annotations->second[i].time = time;
+  frames.push_back(size | (hasImage ? 1ull << 63 : 0));
+  size += frame.size();
+}
+
+void LogFileIndex::write(Out& stream) const
+{
+  // Same format as LogPlayer::writeIndices.
+  stream << static_cast<unsigned char>(LoggingTools::logFileIndices) << LoggingTools::indexVersion;
+  stream << static_cast<unsigned>(size) << static_cast<unsigned>(size >> 32);
+
+  stream << static_cast<unsigned>(frames.size());
+  stream.write(frames.data(), frames.size() * sizeof(frames[0]));
+
+  stream << static_cast<unsigned>(statsPerThread.size());
+  for(const auto& [thread, stats] : statsPerThread)
+  {
+    stream << thread << static_cast<unsigned>(stats.size());
+    stream.write(stats.data(), stats.size() * sizeof(stats[0]));
+  }
+
+  stream << static_cast<unsigned>(annotationsPerThread.size());
+  for(const auto& [thread, annotations] : annotationsPerThread)
+  {
+    stream << thread << static_cast<unsigned>(annotations.size());
+    for(const Annotation& annotation : annotations)
+      stream << annotation.number << annotation.frame << annotation.name << annotation.annotation << annotation.time;
+  }
+}
+
 void Logger::writer()
 {
   Thread::nameCurrentThread("Logger");
@@ -227,18 +370,118 @@ void Logger::writer()
   OutBinaryFile* file = nullptr;
   MessageQueue* buffer = nullptr;
   std::string filename, completeFilename;
+  OutBinaryMemory uncompressedBuffer(sizeOfBuffer + sizeof(MessageQueue::QueueHeader));
+  std::vector<char> compressedBuffer;
+  OutBinaryMemory batch(writeBatchSize + 2 * sizeOfBuffer);
+  unsigned lastFreeDiskSpaceCheck = 0;
+  long headerPosition = 0;
+  LogFileIndex index;
+
+  // Write all collected data to the file at once.
+  const auto flush = [&]
+  {
+    if(file && batch.size())
+    {
+      Tracer::Scope scope("write");
+      file->write(batch.data(), batch.size());
+      SYNC;
+      statistics.maxBatchSize = std::max(statistics.maxBatchSize, static_cast<unsigned>(batch.size()));
+    }
+    batch.clear();
+  };
+
+  // Write the remaining data and the index, sync the file to disk, and close it.
+  const auto closeFile = [&]
+  {
+    flush();
+
+    // A compressed block of size 0 marks the end of the compressed data.
+    if(compressed)
+      batch << 0u;
+    index.write(batch);
+    flush();
+
+    FILE* nativeFile = static_cast<FILE*>(file->getFile()->getNativeFile());
+    if(!compressed)
+    {
+      // The header is written last, because readers only expect an index if it contains the actual size.
+      const MessageQueue::QueueHeader header = {static_cast<unsigned>(index.getSize()), 0, static_cast<unsigned>(index.getSize() >> 32)};
+      std::fseek(nativeFile, headerPosition, SEEK_SET);
+      file->write(&header, sizeof(header));
+    }
+#ifdef LINUX
+    ::fsync(::fileno(nativeFile));
+#endif
+    delete file;
+    file = nullptr;
+  };
+
+  // Find the next free log file name, create the file, and write everything before the log data.
+  const auto openFile = [&]
+  {
+    for(int i = 0; i < 100; ++i)
+    {
+      completeFilename = filename + (i ? "_(" + ((i < 10 ? "0" : "") + std::to_string(i)) + ")" : "") + ".log";
+      InBinaryFile stream(completeFilename);
+      if(!stream.exists())
+        break;
+    }
+
+    ASSERT(!file);
+    file = new OutBinaryFile(completeFilename);
+    if(!file->exists())
+    {
+      OUTPUT_WARNING("Logger: File " << completeFilename << " could not be created!");
+      return false;
+    }
+
+    // On the robot, we want this to end up in bhumand.log.
+#ifdef TARGET_ROBOT
+    std::printf("Logging to %s\n", completeFilename.c_str());
+#endif
+
+    writeLogFilePrefix(*file);
+    if(compressed)
+      *file << LoggingTools::logFileCompressed;
+    else
+    {
+      *file << LoggingTools::logFileUncompressed;
+      headerPosition = std::ftell(static_cast<std::FILE*>(file->getFile()->getNativeFile()));
+      *file << -1 << -1;
+    }
+    index.clear();
+
+    // Turn off userspace buffering.
+    std::setvbuf(static_cast<std::FILE*>(file->getFile()->getNativeFile()), nullptr, _IONBF, 0);
+    return true;
+  };
 
   while(true)
   {
-    // Wait for new data to log to arrive.
-    framesToWrite.wait();
+    // Wait for new data to log to arrive. Data queued for streaming is still sent meanwhile.
+    Tracer::begin("wait");
+    const bool frameToWrite = logStreamServer && logStreamServer->isSending() ? framesToWrite.wait(10) : framesToWrite.wait();
+    Tracer::end("wait");
 
-    // Terminate thread if it is told so or there is no disk space left.
-    if(!writerThread.isRunning()
-       || (!completeFilename.empty()
-           && SystemCall::getFreeDiskSpace(completeFilename.c_str()) < static_cast<unsigned long long>(minFreeDriveSpace) << 20))
+    // Terminate thread if it is told so.
+    if(!writerThread.isRunning())
       break;
 
+    if(!frameToWrite)
+    {
+      logStreamServer->send();
+      continue;
+    }
+
+    // Terminate thread if there is no disk space left. Determining the free space is rather
+    // expensive, so it is only checked once per second.
+    if(!completeFilename.empty() && Time::getRealTimeSince(lastFreeDiskSpaceCheck) >= 1000)
+    {
+      lastFreeDiskSpaceCheck = Time::getRealSystemTime();
+      if(SystemCall::getFreeDiskSpace(completeFilename.c_str()) < static_cast<unsigned long long>(minFreeDriveSpace) << 20)
+        break;
+    }
+
     // Get next buffer to write (there must be one).
     {
       SYNC;
@@ -247,14 +490,13 @@ void Logger::writer()
 
     if(!buffer)
     {
-      // Sync the current file to disk and close it.
-      ASSERT(file);
-#ifdef LINUX
-      ::fsync(::fileno(static_cast<FILE*>(file->getFile()->getNativeFile())));
-#endif
-      delete file;
-      file = nullptr;
-      SystemCall::say("Log file written");
+      // Without a file, all frames of this logging period were streamed.
+      if(file)
+      {
+        closeFile();
+        SystemCall::say("Log file written");
+      }
+      filename.clear();
     }
     else if(++buffer->begin() == buffer->end())
     {
@@ -264,57 +506,62 @@ void Logger::writer()
       (*buffer->begin()).bin() >> filename;
       buffer->clear();
 
-      // find next free log filename
-      for(int i = 0; i < 100; ++i)
+      // When only streaming, the file is created when the first frame cannot be streamed.
+      if(!(logStreamServer && streamOnly) && !openFile())
+        break;
+    }
+    else
+    {
+      // Each block is a complete message queue including its header.
+      if(compressed || logStreamServer)
       {
-        completeFilename = filename + (i ? "_(" + ((i < 10 ? "0" : "") + std::to_string(i)) + ")" : "") + ".log";
-        InBinaryFile stream(completeFilename);
-        if(!stream.exists())
-          break;
+        Tracer::Scope scope("compress");
+        uncompressedBuffer.clear();
+        uncompressedBuffer << *buffer;
+        LoggingTools::compress(uncompressedBuffer.data(), uncompressedBuffer.size(), compressedBuffer);
       }
+      const bool streamed = logStreamServer && logStreamServer->write(compressedBuffer.data(), compressedBuffer.size());
 
-      ASSERT(!file);
-      file = new OutBinaryFile(completeFilename);
-      if(!file->exists())
+      // Add buffered frame to the data to be written to the file.
+      if(!streamed || !streamOnly)
       {
-        OUTPUT_WARNING("Logger: File " << completeFilename << " could not be created!");
-        break;
+        if(!file && !filename.empty() && !openFile())
+          break;
+        if(file)
+        {
+          index.add(*buffer);
+          if(compressed)
+          {
+            batch << static_cast<unsigned>(compressedBuffer.size());
+            batch.write(compressedBuffer.data(), compressedBuffer.size());
+          }
+          else
+            buffer->append(batch);
+        }
       }
-
-      // On the robot, we want this to end up in bhumand.log.
-#ifdef TARGET_ROBOT
-      std::printf("Logging to %s\n", completeFilename.c_str());
-#endif
-
-      *file << LoggingTools::logFileSettings;
-      file->write(settings.data(), settings.size());
-      *file << LoggingTools::logFileMessageIDs << static_cast<unsigned char>(numOfMessageIDs);
-      FOREACH_ENUM(MessageID, i, numOfMessageIDs)
-        *file << TypeRegistry::getEnumName(i);
-      *file << LoggingTools::logFileTypeInfo;
-      file->write(typeInfo.data(), typeInfo.size());
-      *file << LoggingTools::logFileUncompressed << -1 << -1;
-
-      // Turn off userspace buffering.
-      std::setvbuf(static_cast<std::FILE*>(file->getFile()->getNativeFile()), nullptr, _IONBF, 0);
-    }
-    else
-    {
-      // Write buffered frame to file.
-      if(file)
-        buffer->append(*file);
+      if(sharedLogRing)
+        sharedLogRing->write(*buffer);
       buffer->clear();
     }
 
     // Return the buffer.
+    bool moreToWrite;
     {
       SYNC;
       buffersToWrite.pop_front();
       if(buffer)
         buffersAvailable.push(buffer);
+      statistics.queueDepth = static_cast<unsigned>(buffersToWrite.size());
+      moreToWrite = !buffersToWrite.empty();
     }
+
+    // Data is collected while the writer is behind, but written as soon as it caught up.
+    if(batch.size() >= writeBatchSize || !moreToWrite)
+      flush();
   }
 
-  // Delete file before thread ends.
+  // Close file before thread ends.
+  if(file && file->exists())
+    closeFile();
   delete file;
 }
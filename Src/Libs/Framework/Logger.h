@@ -13,6 +13,8 @@
 #pragma once
 
 #include "Framework/Configuration.h"
+#include "Framework/LogStreamServer.h"
+#include "Framework/SharedLogRing.h"
 #include "Platform/Semaphore.h"
 #include "Platform/Thread.h"
 #include "Streaming/MessageQueue.h"
@@ -20,6 +22,7 @@
 #include "Streaming/InStreams.h"
 #include <atomic>
 #include <deque>
+#include <memory>
 #include <stack>
 #include <unordered_map>
 
@@ -44,6 +47,54 @@ public:
   virtual std::string getDescription() const = 0;
 };
 
+/**
+ * The index of a log file written by the logger. It is built incrementally
+ * and appended to the log file when it is closed. It uses the format of
+ * the chunk \c logFileIndices , which allows log file readers to skip
+ * indexing the log.
+ */
+class LogFileIndex
+{
+  /** An annotation in the log file. */
+  struct Annotation
+  {
+    unsigned number; /**< The number of the annotation. */
+    unsigned frame; /**< The index of the frame the annotation is part of. */
+    std::string name; /**< The name of the annotation. */
+    std::string annotation; /**< The text of the annotation. */
+    unsigned time; /**< The time of the frame (from its \c FrameInfo ) or 0 if unknown. */
+  };
+
+  std::size_t size = 0; /**< The number of bytes of all frames added. */
+  std::vector<std::size_t> frames; /**< The byte offsets of all frames. The highest bit is set if a frame contains an image. */
+  std::unordered_map<std::string, std::vector<std::pair<std::size_t, std::size_t>>> statsPerThread; /**< Number and size of messages per thread and message id. */
+  std::unordered_map<std::string, std::vector<Annotation>> annotationsPerThread; /**< The annotations per thread. */
+
+public:
+  /** Forget all frames added. */
+  void clear();
+
+  /**
+   * Adds a frame to the index.
+   * @param frame A message queue containing exactly one frame.
+   * @param mapLogToID Maps the message ids of the frame to their current values.
+   *                   Empty if they already are the current ones.
+   */
+  void add(const MessageQueue& frame, const std::vector<MessageID>& mapLogToID = {});
+
+  /**
+   * Writes the index as \c logFileIndices chunk.
+   * @param stream The stream to write to.
+   */
+  void write(Out& stream) const;
+
+  /**
+   * Returns the number of bytes of all frames added.
+   * @return The size of the message queue indexed.
+   */
+  std::size_t getSize() const {return size;}
+};
+
 STREAMABLE(Logger,
 {
   /** Which representations will be logged for a certain thread? */
@@ -53,6 +104,23 @@ STREAMABLE(Logger,
     (std::vector<std::string>) representations,
   });
 
+  /** Statistics about the utilization of the logger. They can be watched with "vd logger:statistics". */
+  STREAMABLE(Statistics,
+  {
+    /** The statistics per logged thread. */
+    STREAMABLE(ThreadStatistics,
+    {,
+      (std::string) thread,
+      (unsigned)(0) framesLogged, /**< The number of frames logged in this logging period. */
+      (unsigned)(0) framesDropped, /**< The number of frames dropped in this logging period, because no buffer was available. */
+    });
+    ,
+    (unsigned)(0) queueDepth, /**< The number of buffers currently waiting to be written. */
+    (unsigned)(0) maxQueueDepth, /**< The maximum number of buffers waiting to be written in this logging period. */
+    (unsigned)(0) maxBatchSize, /**< The maximum number of bytes written to the file at once in this logging period. */
+    (std::vector<ThreadStatistics>) threads, /**< The statistics per thread in the order of \c representationsPerThread. */
+  });
+
 private:
   DECLARE_SYNC;
   OutBinaryMemory typeInfo; /**< Streamed type information created in main thread and used in logger thread. */
@@ -64,10 +132,20 @@ private:
   std::atomic<bool> logging = false; /**< Are we currently logging? */
   Thread writerThread; /**< The thread that is writing the logged data to a file. */
   Semaphore framesToWrite; /**< How many frames the writer thread should write? */
+  Statistics statistics; /**< The statistics about the buffer utilization. Protected by \c SYNC. */
+  std::unique_ptr<SharedLogRing> sharedLogRing; /**< Frames written are also published here for other local processes. Only used by the writer thread. */
+  std::unique_ptr<LogStreamServer> logStreamServer; /**< Frames written are also streamed to a workstation through this server. Only used by the writer thread. */
+  std::vector<unsigned> framesPerThread; /**< The number of frames logged per entry of \c representationsPerThread. Each is only used by its thread. */
 
   /** The method runs in a separate thread and writes the logged data to a file. */
   void writer();
 
+  /**
+   * Writes the beginning of a log file, i.e. everything before the log data.
+   * @param stream The stream to write to.
+   */
+  void writeLogFilePrefix(Out& stream) const;
+
 public:
   /**
    * The constructor reads the configuration file and checks it against the module configuration.
@@ -98,7 +176,15 @@ private:,
   (std::string) path, /**< The directory that will contain the log file. */
   (unsigned) numOfBuffers, /**< The number of buffers allocated. */
   (unsigned) sizeOfBuffer, /**< The size of each buffer in bytes. */
+  (bool) compressed, /**< Are the buffers compressed before they are written? */
+  (unsigned) writeBatchSize, /**< Queued buffers are collected until this number of bytes is reached before they are written to the file. */
   (int) writePriority, /**< The scheduling priority of the writer thread. */
   (unsigned) minFreeDriveSpace, /**< Logging will stop if less MB are available to the target device. */
+  (unsigned) sharedMemorySize, /**< If not 0, the frames logged are also published in shared memory "/bhuman-log" of this size (in bytes). */
+  (unsigned) streamPort, /**< If not 0, the frames logged are also streamed to a client connecting to this TCP port. */
+  (unsigned) streamQueueSize, /**< The maximum number of bytes queued for streaming. Frames that do not fit are not streamed. */
+  (bool) streamOnly, /**< Write only the frames to the log file that could not be streamed? */
+  (std::vector<std::string>) lowRateRepresentations, /**< Representations that are only logged every \c lowRateInterval -th frame of their thread, e.g. full images when only image patches are logged otherwise. */
+  (unsigned) lowRateInterval, /**< The number of frames of a thread per frame in which the \c lowRateRepresentations are logged. */
   (std::vector<RepresentationsPerThread>) representationsPerThread, /**< Representations to log per thread. */
 });
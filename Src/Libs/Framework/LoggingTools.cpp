@@ -10,6 +10,10 @@
 #include "Framework/Settings.h"
 #include "Platform/BHAssert.h"
 #include "Streaming/InOut.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
 #include <regex>
 #include <type_traits>
 
@@ -60,6 +64,167 @@ void LoggingTools::skipSettings(In& stream)
     FAIL("Unknown settings version " << version << ".");
 }
 
+std::size_t LoggingTools::getPrefixSize(const char* data, std::size_t size)
+{
+  // The chunks are parsed with bounds checks, because the streams would read beyond the data.
+  std::size_t position = 0;
+  bool complete = true;
+  const auto skip = [&](std::size_t bytes)
+  {
+    if(size - position < bytes)
+      complete = false;
+    position = complete ? position + bytes : size;
+    return complete;
+  };
+  const auto readUnsigned = [&]
+  {
+    unsigned value = 0;
+    if(skip(sizeof(unsigned)))
+      std::memcpy(&value, data + position - sizeof(unsigned), sizeof(unsigned));
+    return value;
+  };
+  const auto skipStrings = [&](unsigned count)
+  {
+    for(unsigned i = 0; i < count && complete; ++i)
+      skip(readUnsigned());
+  };
+
+  while(complete && position < size)
+    switch(data[position++])
+    {
+      case logFileSettings: // See writeSettings.
+        if(readUnsigned() != 1)
+          return 0;
+        skipStrings(2);
+        skip(sizeof(Settings::playerNumber));
+        skipStrings(2);
+        break;
+      case logFileMessageIDs:
+        if(skip(1))
+          skipStrings(static_cast<unsigned char>(data[position - 1]));
+        break;
+      case logFileTypeInfo: // See operator<<(Out&, const TypeInfo&).
+        skipStrings(readUnsigned() & 0x7fffffff); // The highest bit marks unified type names.
+        for(unsigned i = 0, classes = readUnsigned(); i < classes && complete; ++i)
+        {
+          skipStrings(1);
+          skipStrings(2 * readUnsigned());
+        }
+        for(unsigned i = 0, enums = readUnsigned(); i < enums && complete; ++i)
+        {
+          skipStrings(1);
+          skipStrings(readUnsigned());
+        }
+        break;
+      default: // The log data starts.
+        return position;
+    }
+  return 0;
+}
+
+void LoggingTools::compress(const void* data, std::size_t size, std::vector<char>& compressed)
+{
+  // Snappy compresses 64 KiB fragments independently. Within a fragment, matches
+  // of at least 4 bytes are found through a hash table of 4 byte sequences.
+  constexpr std::size_t fragmentSize = 1 << 16;
+  constexpr unsigned hashBits = 14;
+
+  const unsigned char* const input = static_cast<const unsigned char*>(data);
+  compressed.resize(32 + size + size / 6); // The worst case according to snappy.
+  unsigned char* output = reinterpret_cast<unsigned char*>(compressed.data());
+
+  // The uncompressed size as varint.
+  for(std::size_t remaining = size; ; remaining >>= 7)
+    if(remaining < 0x80)
+    {
+      *output++ = static_cast<unsigned char>(remaining);
+      break;
+    }
+    else
+      *output++ = static_cast<unsigned char>(remaining | 0x80);
+
+  const auto emitLiteral = [&output](const unsigned char* literal, std::size_t length)
+  {
+    const std::size_t n = length - 1;
+    if(n < 60)
+      *output++ = static_cast<unsigned char>(n << 2);
+    else
+    {
+      const unsigned bytes = n < 0x100 ? 1 : n < 0x10000 ? 2 : n < 0x1000000 ? 3 : 4;
+      *output++ = static_cast<unsigned char>((59 + bytes) << 2);
+      for(unsigned i = 0; i < bytes; ++i)
+        *output++ = static_cast<unsigned char>(n >> (8 * i));
+    }
+    std::memcpy(output, literal, length);
+    output += length;
+  };
+
+  const auto emitCopy = [&output](std::size_t offset, std::size_t length)
+  {
+    while(length > 0)
+    {
+      // Copies with 2 byte offsets are limited to 64 bytes. Avoid remainders shorter than 4 bytes.
+      const std::size_t n = length > 64 ? (length - 64 < 4 ? 60 : 64) : length;
+      if(n >= 4 && n < 12 && offset < 2048)
+      {
+        *output++ = static_cast<unsigned char>(1 | ((n - 4) << 2) | ((offset >> 8) << 5));
+        *output++ = static_cast<unsigned char>(offset);
+      }
+      else
+      {
+        *output++ = static_cast<unsigned char>(2 | ((n - 1) << 2));
+        *output++ = static_cast<unsigned char>(offset);
+        *output++ = static_cast<unsigned char>(offset >> 8);
+      }
+      length -= n;
+    }
+  };
+
+  const auto load = [](const unsigned char* p)
+  {
+    std::uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+  };
+
+  std::array<std::uint16_t, 1 << hashBits> table;
+  for(std::size_t fragment = 0; fragment < size; fragment += fragmentSize)
+  {
+    const unsigned char* const begin = input + fragment;
+    const unsigned char* const end = begin + std::min(fragmentSize, size - fragment);
+    const unsigned char* literal = begin;
+    table.fill(0);
+
+    if(end - begin >= 8)
+      for(const unsigned char* p = begin + 1; p + 4 <= end;)
+      {
+        const std::uint32_t value = load(p);
+        std::uint16_t& entry = table[(value * 0x1e35a7bdu) >> (32 - hashBits)];
+        const unsigned char* candidate = begin + entry;
+        entry = static_cast<std::uint16_t>(p - begin);
+        if(candidate >= p || load(candidate) != value)
+        {
+          ++p;
+          continue;
+        }
+
+        if(literal < p)
+          emitLiteral(literal, p - literal);
+        std::size_t length = 4;
+        while(p + length < end && candidate[length] == p[length])
+          ++length;
+        emitCopy(p - candidate, length);
+        p += length;
+        literal = p;
+      }
+
+    if(literal < end)
+      emitLiteral(literal, end - literal);
+  }
+
+  compressed.resize(output - reinterpret_cast<unsigned char*>(compressed.data()));
+}
+
 std::string LoggingTools::createName(const std::string& headName, const std::string& bodyName, const std::string& scenario,
                                      const std::string& location, const std::string& identifier, int playerNumber,
                                      const std::string& suffix)
@@ -11,6 +11,7 @@
 
 #include "Streaming/Enum.h"
 #include <string>
+#include <vector>
 
 class In;
 class Out;
@@ -28,6 +29,9 @@ namespace LoggingTools
     logFileIndices,
   });
 
+  /** The version of the format of the \c logFileIndices chunk. Version 3 added the times of the annotations. */
+  constexpr unsigned char indexVersion = 3;
+
   /**
    * Writes parts of the settings that are relevant for log files to a stream.
    * @param stream The stream to which to write.
@@ -48,6 +52,28 @@ namespace LoggingTools
    */
   void skipSettings(In& stream);
 
+  /**
+   * Determines the size of the beginning of a log file, i.e. the chunks
+   * before the log data, from data that might be incomplete, e.g. because
+   * it is still being received.
+   * @param data The beginning of the log file.
+   * @param size The number of bytes available.
+   * @return The size of the chunks including the byte that starts the log
+   *         data or 0 if more data is needed.
+   */
+  std::size_t getPrefixSize(const char* data, std::size_t size);
+
+  /**
+   * Compresses a block of data in the format of the snappy library. This
+   * allows the robot to write compressed log files without depending on that
+   * library. The log file readers decompress the blocks with snappy.
+   * @param data The data to compress.
+   * @param size The size of the data in bytes.
+   * @param compressed The compressed data is stored here. Its previous
+   *                   contents are replaced.
+   */
+  void compress(const void* data, std::size_t size, std::vector<char>& compressed);
+
   /**
    * Creates a log file name from lots of components.
    * @param headName The name of the robot's head on which the log is recorded. Must contain only letters.
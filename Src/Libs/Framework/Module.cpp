@@ -5,11 +5,21 @@
  */
 
 #include "Module.h"
+#include "Platform/File.h"
+#include "StartupTrace.h"
 #include "Streaming/InStreams.h"
 
 ModuleBase* ModuleBase::first = nullptr;
 
-void loadModuleParameters(Streamable& parameters, const char* moduleName, const char* fileName, const char* prefix)
+/**
+ * Determines the name of the configuration file of a module.
+ * @param moduleName The filename is determined from the name of the module if it
+ *                   is not explicitly specified.
+ * @param fileName The filename used or nullptr if it should be created from the module's name.
+ * @param prefix A prefix to prepend to the filename or nullptr.
+ * @return The name of the file.
+ */
+static std::string getModuleParametersFileName(const char* moduleName, const char* fileName, const char* prefix)
 {
   std::string name;
   if(!fileName)
@@ -25,6 +35,25 @@ void loadModuleParameters(Streamable& parameters, const char* moduleName, const
     name = fileName;
   if(prefix)
     name = prefix + name;
+  return name;
+}
+
+void readModuleParametersFile(const char* moduleName, const char* fileName, std::string& fullName, std::string& content)
+{
+  InBinaryFile stream(getModuleParametersFileName(moduleName, fileName, nullptr));
+  ASSERT(stream.exists());
+  if(!stream.exists())
+    return;
+  fullName = stream.getFile()->getFullName();
+  content.resize(stream.getSize());
+  if(!content.empty())
+    stream.read(content.data(), content.size());
+}
+
+void loadModuleParameters(Streamable& parameters, const char* moduleName, const char* fileName, const char* prefix)
+{
+  const std::string name = getModuleParametersFileName(moduleName, fileName, prefix);
+  StartupTrace::Step step("parameters", name.c_str());
   InMapFile stream(name);
   ASSERT(stream.exists());
   stream >> parameters;
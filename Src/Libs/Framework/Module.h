@@ -12,6 +12,7 @@
  *   USES(RobotPose),                         // Is used, but has not to be updated before
  *   PROVIDES(BallPercept),                   // Class provides a method to update BallPercept.
  *   PROVIDES_WITHOUT_MODIFY(PlayersPercept), // Class provides a method to update PlayersPercept. Representation cannot be MODIFYed.
+ *   PROVIDES_LAZY(RobotHealth),              // Class provides a method to update RobotHealth, which is only called when it is read (see UPDATE_LAZILY).
  *   DEFINES_PARAMETERS(                      // Has parameters that must have an initial value. If LOADS_PARAMETERS is used instead,
  *   {,                                       // they are loaded from a configuration file that has the same name as the module defined, but starts with lowercase letters.
  *     (float)(42.0f) focalLen,               // Has a parameter named focalLen of type float. By default it has the value 42.0f.
@@ -32,6 +33,16 @@
  *
  * MAKE_MODULE(MyImageProcessor)
  *
+ * A representation that is provided lazily is only updated in a frame when it is
+ * read for the first time. Since reading a representation through its reference cannot
+ * be detected, modules that require it have to state that they read it now:
+ *
+ * UPDATE_LAZILY(RobotHealth);
+ * if(theRobotHealth.batteryLevel < 10) ...
+ *
+ * This has no effect if the representation is provided normally. The provider
+ * is still executed in every frame if the representation is sent to another thread.
+ *
  * @author Thomas Röfer
  */
 
@@ -43,6 +54,11 @@
 #include "Platform/BHAssert.h"
 #include "Streaming/AutoStreamable.h"
 
+#include <list>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 /**
@@ -56,9 +72,10 @@ public:
   public:
     const char* representation;
     void (*update)(Streamable&);
+    bool lazy; /**< Is the representation only updated when it is read? */
 
-    Info(const char* representation, void (*update)(Streamable&)) :
-      representation(representation), update(update)
+    Info(const char* representation, void (*update)(Streamable&), bool lazy = false) :
+      representation(representation), update(update), lazy(lazy)
     {}
   };
 
@@ -104,6 +121,7 @@ private:
   ModuleBase* next; /**< The next entry in the list of all modules. */
   const char* name; /**< The name of the module that can be created by this instance. */
   std::vector<Info> (*getModuleInfo)(); /**< A function that returns information about the requirements and provisions of the module. */
+  std::vector<const char*> (*getUsedRepresentations)(); /**< A function that returns the representations the module uses without requiring them. */
 
 protected:
   /**
@@ -117,9 +135,10 @@ public:
    * Constructor.
    * @param name The name of the module that can be created by this instance.
    * @param getModuleInfo The function that returns the module info.
+   * @param getUsedRepresentations The function that returns the representations used.
    */
-  ModuleBase(const char* name, std::vector<Info> (*getModuleInfo)()) noexcept :
-    next(first), name(name), getModuleInfo(getModuleInfo)
+  ModuleBase(const char* name, std::vector<Info> (*getModuleInfo)(), std::vector<const char*> (*getUsedRepresentations)()) noexcept :
+    next(first), name(name), getModuleInfo(getModuleInfo), getUsedRepresentations(getUsedRepresentations)
   {
     first = this;
   }
@@ -127,6 +146,7 @@ public:
   friend class ModuleGraphCreator; /**< The ModuleGraphCreator gathers all private data. */
   friend class ModuleGraphRunner; /**< To create new modules. */
   friend class Debug; /**< To send the ModuleTable. */
+  friend class ModuleBenchmark; /**< To run a single module on logged data. */
 };
 
 /**
@@ -163,10 +183,34 @@ public:
    * @param getModuleInfo The function that returns the module info.
    */
   Module(const char* name, std::vector<ModuleBase::Info> (*getModuleInfo)()) noexcept :
-    ModuleBase(name, getModuleInfo)
+    ModuleBase(name, getModuleInfo, B::getUsedRepresentations)
   {}
 };
 
+/**
+ * A module that is additionally derived from this class contributes its
+ * internal state to the snapshots of its thread, which are taken during log
+ * replay to seek backward without replaying the whole log. Streaming the
+ * module itself only covers its parameters.
+ */
+class ModuleSnapshot
+{
+public:
+  virtual ~ModuleSnapshot() = default;
+
+  /**
+   * Writes the internal state of the module.
+   * @param stream The stream to write to.
+   */
+  virtual void writeSnapshot(Out& stream) const = 0;
+
+  /**
+   * Restores the internal state of the module.
+   * @param stream The stream written by \c writeSnapshot .
+   */
+  virtual void readSnapshot(In& stream) = 0;
+};
+
 /**
  * If a module has no parameters, it is derived from this class.
  */
@@ -184,6 +228,52 @@ STREAMABLE(NoParameters,
  */
 void loadModuleParameters(Streamable& parameters, const char* moduleName, const char* fileName, const char* prefix = nullptr);
 
+/**
+ * Reads the configuration file of a module without parsing it.
+ * @param moduleName The filename is determined from the name of the module if it
+ *                   is not explicitly specified.
+ * @param fileName The filename used or nullptr if it should be created from the module's name.
+ * @param fullName The path of the file found is returned here.
+ * @param content The content of the file is returned here.
+ */
+void readModuleParametersFile(const char* moduleName, const char* fileName, std::string& fullName, std::string& content);
+
+/**
+ * Load the parameters of a module like \c loadModuleParameters. In the simulator, the
+ * instances of a module in all robots usually load the same configuration file. Therefore,
+ * the parameters parsed are shared between them, i.e. only the first instance parses the
+ * file and all others copy the result. A file is parsed again if its content changed.
+ * @param T The type of the parameters. It must be copy-assignable to be shared.
+ * @param parameters The parameters.
+ * @param moduleName The filename is determined from the name of the module if it
+ *                   is not explicitly specified.
+ * @param fileName The filename used or nullptr if it should be created from the module's name.
+ */
+template<typename T> void loadSharedModuleParameters(T& parameters, const char* moduleName, const char* fileName)
+{
+#ifndef TARGET_ROBOT
+  if constexpr(std::is_copy_assignable_v<T>)
+  {
+    static std::mutex mutex;
+    static std::list<std::tuple<std::string, std::string, T>> cache; /**< The full name, content, and parameters parsed of each file. */
+
+    std::string fullName, content;
+    readModuleParametersFile(moduleName, fileName, fullName, content);
+    std::lock_guard<std::mutex> lock(mutex);
+    for(const auto& [cachedFullName, cachedContent, cachedParameters] : cache)
+      if(cachedFullName == fullName && cachedContent == content)
+      {
+        parameters = cachedParameters;
+        return;
+      }
+    loadModuleParameters(parameters, moduleName, fileName);
+    cache.emplace_back(fullName, content, parameters);
+  }
+  else
+#endif
+    loadModuleParameters(parameters, moduleName, fileName);
+}
+
 // Some of the following macros can also be found in AutoStreamable.h with different names.
 // However, separate versions are required here, because the preprocessor only expands each
 // macro once in a recursive structure.
@@ -406,6 +496,7 @@ void loadModuleParameters(Streamable& parameters, const char* moduleName, const
 #define _MODULE_PARAMETERS(x) _MODULE_JOIN(_MODULE_PARAMETERS_, x)
 #define _MODULE_PARAMETERS_PROVIDES(type)
 #define _MODULE_PARAMETERS_PROVIDES_WITHOUT_MODIFY(type)
+#define _MODULE_PARAMETERS_PROVIDES_LAZY(type)
 #define _MODULE_PARAMETERS_REQUIRES(type)
 #define _MODULE_PARAMETERS_USES(type)
 #define _MODULE_PARAMETERS__MODULE_DEFINES_PARAMETERS(header, ...) _STREAM_STREAMABLE(Params, Streamable, , , header, __VA_ARGS__); using NoParameters = Params;
@@ -419,10 +510,11 @@ void loadModuleParameters(Streamable& parameters, const char* moduleName, const
 #define _MODULE_LOAD(x) _MODULE_JOIN(_MODULE_LOAD_, x)
 #define _MODULE_LOAD_PROVIDES(type) _MODULE_INIT_ID(type)
 #define _MODULE_LOAD_PROVIDES_WITHOUT_MODIFY(type) _MODULE_INIT_ID(type)
+#define _MODULE_LOAD_PROVIDES_LAZY(type) _MODULE_INIT_ID(type)
 #define _MODULE_LOAD_REQUIRES(type)
 #define _MODULE_LOAD_USES(type)
 #define _MODULE_LOAD__MODULE_DEFINES_PARAMETERS(...)
-#define _MODULE_LOAD__MODULE_LOADS_PARAMETERS(...) loadModuleParameters(*this, moduleName, fileName);
+#define _MODULE_LOAD__MODULE_LOADS_PARAMETERS(...) loadSharedModuleParameters(static_cast<Parameters&>(*this), moduleName, fileName);
 
 #if defined TARGET_ROBOT && defined NDEBUG
 #define _MODULE_DRAW(...)
@@ -450,6 +542,7 @@ void loadModuleParameters(Streamable& parameters, const char* moduleName, const
 #define _MODULE_DECLARE_PROVIDES_WITHOUT_MODIFY(type) _MODULE_PROVIDES(type, \
     _MODULE_VERIFY(r) \
     _MODULE_DRAW(r))
+#define _MODULE_DECLARE_PROVIDES_LAZY(type) _MODULE_DECLARE_PROVIDES(type)
 #define _MODULE_DECLARE_REQUIRES(type) public: const type& the##type = Blackboard::getInstance().alloc<type>(#type);
 #define _MODULE_DECLARE_USES(type) public: const type& the##type = Blackboard::getInstance().alloc<type>(#type);
 #define _MODULE_DECLARE__MODULE_DEFINES_PARAMETERS(...)
@@ -463,6 +556,7 @@ void loadModuleParameters(Streamable& parameters, const char* moduleName, const
 #define _MODULE_FREE(x) _MODULE_JOIN(_MODULE_FREE_, x)
 #define _MODULE_FREE_PROVIDES(type) if(_the##type) Blackboard::getInstance().free(#type);
 #define _MODULE_FREE_PROVIDES_WITHOUT_MODIFY(type) if(_the##type) Blackboard::getInstance().free(#type);
+#define _MODULE_FREE_PROVIDES_LAZY(type) if(_the##type) Blackboard::getInstance().free(#type);
 #define _MODULE_FREE_REQUIRES(type) Blackboard::getInstance().free(#type);
 #define _MODULE_FREE_USES(type) Blackboard::getInstance().free(#type);
 #define _MODULE_FREE__MODULE_DEFINES_PARAMETERS(...)
@@ -476,11 +570,26 @@ void loadModuleParameters(Streamable& parameters, const char* moduleName, const
 #define _MODULE_INFO(x) _MODULE_JOIN(_MODULE_INFO_, x)
 #define _MODULE_INFO_PROVIDES(type) infos.emplace_back(#type, &BaseType::update##type);
 #define _MODULE_INFO_PROVIDES_WITHOUT_MODIFY(type) infos.emplace_back(#type, &BaseType::update##type);
+#define _MODULE_INFO_PROVIDES_LAZY(type) infos.emplace_back(#type, &BaseType::update##type, true);
 #define _MODULE_INFO_REQUIRES(type) infos.emplace_back(#type, nullptr);
 #define _MODULE_INFO_USES(type)
 #define _MODULE_INFO__MODULE_DEFINES_PARAMETERS(...)
 #define _MODULE_INFO__MODULE_LOADS_PARAMETERS(...)
 
+/**
+ * The following macros generate the code that provides the names of all
+ * representations used, but not required. They filter out all other macro names.
+ * @param x The type name of a representation or the set of all parameters.
+ */
+#define _MODULE_USED(x) _MODULE_JOIN(_MODULE_USED_, x)
+#define _MODULE_USED_PROVIDES(type)
+#define _MODULE_USED_PROVIDES_WITHOUT_MODIFY(type)
+#define _MODULE_USED_PROVIDES_LAZY(type)
+#define _MODULE_USED_REQUIRES(type)
+#define _MODULE_USED_USES(type) used.emplace_back(#type);
+#define _MODULE_USED__MODULE_DEFINES_PARAMETERS(...)
+#define _MODULE_USED__MODULE_LOADS_PARAMETERS(...)
+
 /**
  * Assign message id for a representation.
  * @param type The type of the representation the id of which is assigned.
@@ -519,14 +628,14 @@ void loadModuleParameters(Streamable& parameters, const char* moduleName, const
  * @param n The number of entries in the third parameter.
  * @param ... The requirements, provided representations and parameter definitions.
  */
-#define _MODULE_I(name, n, header, ...) _MODULE_II(name, n, header, (_MODULE_PARAMETERS, __VA_ARGS__), (_MODULE_LOAD, __VA_ARGS__), (_MODULE_DECLARE, __VA_ARGS__), (_MODULE_FREE, __VA_ARGS__), (_MODULE_INFO, __VA_ARGS__), (__VA_ARGS__))
+#define _MODULE_I(name, n, header, ...) _MODULE_II(name, n, header, (_MODULE_PARAMETERS, __VA_ARGS__), (_MODULE_LOAD, __VA_ARGS__), (_MODULE_DECLARE, __VA_ARGS__), (_MODULE_FREE, __VA_ARGS__), (_MODULE_INFO, __VA_ARGS__), (_MODULE_USED, __VA_ARGS__), (__VA_ARGS__))
 
 /**
  * Generates the actual code of the module's base class.
  * It create all the code and fills in data from the requirements, representations,
  * provided, and parameters defined.
  */
-#define _MODULE_II(theName, n, header, params, load, declare, free, info, tail) \
+#define _MODULE_II(theName, n, header, params, load, declare, free, info, usedList, tail) \
   namespace theName##Module \
   { \
     _MODULE_ATTR_##n params \
@@ -553,6 +662,12 @@ void loadModuleParameters(Streamable& parameters, const char* moduleName, const
       _MODULE_ATTR_##n info \
       return infos; \
     } \
+    static std::vector<const char*> getUsedRepresentations() \
+    { \
+      std::vector<const char*> used; \
+      _MODULE_ATTR_##n usedList \
+      return used; \
+    } \
   private: \
     _MODULE_ATTR_##n declare \
   public: \
@@ -590,6 +705,20 @@ void loadModuleParameters(Streamable& parameters, const char* moduleName, const
 #define MODULE(name, header, ...) \
   _MODULE_I(name, _MODULE_TUPLE_SIZE(__VA_ARGS__), (header), __VA_ARGS__)
 
+/**
+ * Makes sure that a representation is up to date before it is read. This is
+ * only necessary for representations that might be provided lazily.
+ * See beginning of this file.
+ * @param type The type of the representation.
+ */
+#define UPDATE_LAZILY(type) \
+  do \
+  { \
+    static const Blackboard::Id _idLazy##type = Blackboard::getId(#type); \
+    Blackboard::getInstance().update(_idLazy##type); \
+  } \
+  while(false)
+
 /**
  * MAKE_MODULE(module [, getModuleInfo])
  *
@@ -9,22 +9,30 @@
 #include "ModuleContainer.h"
 #include "Debugging/AnnotationManager.h"
 #include "Debugging/Debugging.h"
+#include "Debugging/Modify.h"
 #include "Debugging/Stopwatch.h"
+#include "Debugging/Tracer.h"
 #include "Framework/Blackboard.h"
 #include "Framework/Debug.h"
 #include "Framework/FrameExecutionUnit.h"
 #include "Framework/Logger.h"
 #include "Platform/BHAssert.h"
 #include "Platform/SystemCall.h"
+#include "Platform/Time.h"
 #include "Streaming/Global.h"
 #include "Streaming/Output.h"
 
-thread_local std::list<std::function<bool(MessageQueue::Message message)>> ModuleContainer::messageHandlers;
+thread_local std::vector<std::function<bool(MessageQueue::Message message)>> ModuleContainer::messageHandlers;
 
 ModuleContainer::ModuleContainer(const Settings& settings, const std::string& robotName, const Configuration& config, const std::size_t index, Logger* logger) :
   ThreadFrame(settings, robotName),
   name(config()[index].name),
   priority(config()[index].priority),
+  affinity(config()[index].affinity),
+  minFramePeriod(config()[index].minFramePeriod),
+  traceOverrun(config()[index].traceOverrun),
+  frameArenaSize(config()[index].frameArenaSize),
+  workers(config()[index].workerThreads),
   moduleGraphRunner(config().size()),
   logger(logger)
 {
@@ -38,6 +46,9 @@ ModuleContainer::ModuleContainer(const Settings& settings, const std::string& ro
   }
   ASSERT(executionUnit);
 
+  if(config()[index].wakeUpSpinTime)
+    useFutexSemaphore(config()[index].wakeUpSpinTime);
+
   loggingController = executionUnit->initLogging(config, index);
 }
 
@@ -50,8 +61,17 @@ ModuleContainer::~ModuleContainer()
 
 void ModuleContainer::connectWithSender(ModuleContainer* sender, const Configuration& config)
 {
-  receivers.emplace_back(this, sender->getName());
+  unsigned packetSize = 0;
+  for(const Configuration::Thread& thread : config())
+    if(thread.name == getName())
+    {
+      packetSize = thread.receiverPacketSize;
+      break;
+    }
+
+  receivers.emplace_back(this, sender->getName(), packetSize);
   receivers.back().moduleGraphRunner = &moduleGraphRunner;
+  receivers.back().sharedBuffer = &sharedBuffers.emplace_back();
   for(std::size_t i = 0; i < config().size(); i++)
     if(sender->getName() == config()[i].name)
     {
@@ -60,6 +80,7 @@ void ModuleContainer::connectWithSender(ModuleContainer* sender, const Configura
     }
   sender->senders.emplace_back(receivers.back(), getName());
   sender->senders.back().moduleGraphRunner = &sender->moduleGraphRunner;
+  sender->senders.back().sharedBuffer = receivers.back().sharedBuffer;
   for(std::size_t i = 0; i < config().size(); i++)
     if(getName() == config()[i].name)
     {
@@ -82,6 +103,14 @@ void ModuleContainer::init()
 {
   BH_TRACE_INIT(getName().c_str());
 
+  if(frameArenaSize)
+    moduleGraphRunner.enableFrameArena(frameArenaSize * 1024);
+  if(!workers.empty())
+    moduleGraphRunner.enableParallelExecution(getName(), workers.size(), priority, [this](std::size_t index)
+    {
+      setWorkerGlobals(workers[index].annotationManager, workers[index].timingManager);
+    });
+
   // Prepare first frame
   originalSize = debugSender->size();
   OUTPUT(idFrameBegin, bin, getName());
@@ -90,27 +119,95 @@ void ModuleContainer::init()
 
 bool ModuleContainer::main()
 {
+  // Starting the next frame is delayed if the previous one started too recently.
+  // The receivers only keep the newest packets, so all arriving in the meantime are merged.
+  if(minFramePeriod && lastFrameStart)
+  {
+    const int remaining = static_cast<int>(minFramePeriod) - Time::getRealTimeSince(lastFrameStart);
+    if(remaining > 0)
+    {
+      ++framesDeferred;
+      Thread::sleep(remaining);
+    }
+  }
+
+  Tracer::begin("receive");
   for(Receiver<ModulePacket>& receiver : receivers)
     if(!moduleGraphRunner.receiverEmpty(receiver.index))
       receiver.receivePacket();
+  Tracer::end("receive");
 
   if((executionUnit->beforeFrame() || moduleGraphRunner.hasChanged()) && moduleGraphRunner.isValid())
   {
     Global::getTimingManager().signalThreadStart();
+    const unsigned frameStart = Time::getRealSystemTime();
+    lastFrameStart = frameStart;
 
+    moduleGraphRunner.setState(executionUnit->getState());
     executionUnit->beforeModules();
     STOPWATCH("AllModules") moduleGraphRunner.execute();
+    for(Worker& worker : workers)
+    {
+      Global::getAnnotationManager().merge(worker.annotationManager);
+      worker.timingManager.signalThreadStart();
+    }
     executionUnit->afterModules();
 
     DEBUG_RESPONSE_ONCE("automated requests:DrawingManager") OUTPUT(idDrawingManager, bin, Global::getDrawingManager());
     DEBUG_RESPONSE_ONCE("automated requests:DrawingManager3D") OUTPUT(idDrawingManager3D, bin, Global::getDrawingManager3D());
 
+    DEBUG_RESPONSE_ONCE("communication:packetBuffers")
+    {
+      // Shows the largest packets received, e.g. to configure receiverPacketSize in threads.cfg.
+      std::string text = getName() + " receives from:";
+      for(const Receiver<ModulePacket>& receiver : receivers)
+        text += "\n  " + receiver.senderThreadName + ": " + std::to_string(receiver.getHighWaterMark()) + " bytes";
+      OUTPUT_TEXT(text);
+    }
+
+    Tracer::begin("send");
     for(Sender<ModulePacket>& sender : senders)
       if(!moduleGraphRunner.senderEmpty(sender.index))
       {
         BH_TRACE_MSG("before sender.send() to: " + sender.receiverThreadName);
         sender.send();
       }
+    Tracer::end("send");
+
+    // The trace is written after the frame so that it contains the whole frame.
+    if(traceOverrun && Time::getRealTimeSince(frameStart) > static_cast<int>(traceOverrun)
+       && Tracer::dump(getTraceFilename()))
+      OUTPUT_WARNING(getName() << ": Frame took " << Time::getRealTimeSince(frameStart) << " ms, trace written");
+    DEBUG_RESPONSE_ONCE("tracer:dump")
+      if(Tracer::dump(getTraceFilename()))
+        OUTPUT_TEXT("Trace written");
+
+    if(minFramePeriod && Time::getRealTimeSince(frameStart) > static_cast<int>(minFramePeriod))
+      ++framesOverrun;
+    DEBUG_RESPONSE_ONCE("thread:scheduling")
+    {
+      std::string text = getName() + ": " + std::to_string(framesDeferred) + " frames deferred, "
+                         + std::to_string(framesOverrun) + " frames longer than the minimum period";
+      for(const Receiver<ModulePacket>& receiver : receivers)
+        text += "\n  " + receiver.senderThreadName + ": " + std::to_string(receiver.getPacketsMerged()) + " packets merged";
+      OUTPUT_TEXT(text);
+    }
+
+    DEBUG_RESPONSE_ONCE("thread:wakeUpStatistics")
+      if(const FutexSemaphore::Statistics* statistics = getWakeUpStatistics())
+        OUTPUT_TEXT(getName() << ": " << statistics->spinWakeUps << " while spinning, "
+                    << statistics->sleepWakeUps << " from sleep (mean latency "
+                    << (statistics->sleepWakeUps ? static_cast<unsigned>(statistics->totalLatency / statistics->sleepWakeUps / 1000) : 0u)
+                    << " µs, max " << static_cast<unsigned>(statistics->maxLatency / 1000) << " µs), "
+                    << statistics->spuriousWakeUps << " spurious, " << statistics->timeouts << " timeouts");
+
+    // The memory usage is only determined if it is requested, because all representations are streamed.
+    DEBUG_RESPONSE("debug data:thread:memoryUsage")
+    {
+      ModuleGraphRunner::MemoryUsage memoryUsage;
+      moduleGraphRunner.getMemoryUsage(memoryUsage);
+      MODIFY("thread:memoryUsage", memoryUsage);
+    }
 
     if(logger && loggingController)
       logger->update(*loggingController);
@@ -199,6 +296,12 @@ bool ModuleContainer::handleMessage(MessageQueue::Message message)
       moduleGraphRunner.update(stream);
       return true;
     }
+    case idModuleSnapshot:
+    {
+      auto stream = message.bin();
+      moduleGraphRunner.handleSnapshotCommand(stream);
+      return true;
+    }
     default:
       for(const std::function<bool(MessageQueue::Message message)>& messageHandler : messageHandlers)
         if(messageHandler(message))
@@ -206,3 +309,13 @@ bool ModuleContainer::handleMessage(MessageQueue::Message message)
       return ThreadFrame::handleMessage(message);
   }
 }
+
+std::string ModuleContainer::getTraceFilename() const
+{
+#ifdef TARGET_ROBOT
+  const std::string path = "/home/nao/logging/";
+#else
+  const std::string path = "Logs/";
+#endif
+  return path + "trace_" + getName() + "_" + std::to_string(Time::getRealSystemTime());
+}
@@ -16,6 +16,7 @@
 #include <functional>
 #include <list>
 #include <string>
+#include <vector>
 
 class Debug;
 class FrameExecutionUnit;
@@ -31,18 +32,34 @@ struct Settings;
 class ModuleContainer : public ThreadFrame
 {
 private:
-  static thread_local std::list<std::function<bool(MessageQueue::Message message)>> messageHandlers; /**< A list of all MessageHandlers of this thread. */
+  static thread_local std::vector<std::function<bool(MessageQueue::Message message)>> messageHandlers; /**< A list of all MessageHandlers of this thread. */
 
   // Lists, since Sender.receiver would become invalid when resizing a vector.
   std::list<Receiver<ModulePacket>> receivers; /**< The list of all receivers of this thread. */
   std::list<Sender<ModulePacket>> senders; /**< The list of all senders of this thread. */
+  std::list<ModuleGraphRunner::SharedBuffer> sharedBuffers; /**< The representations copied by the senders of the receivers of this thread. */
 
   const std::string name; /**< The name of this thread. */
   const int priority; /**< The priority of this thread. */
+  const std::vector<unsigned> affinity; /**< The cores this thread may run on. Empty means all cores. */
+  const unsigned minFramePeriod; /**< If not 0, frames start at most this often (in ms). */
+  const unsigned traceOverrun; /**< If not 0, a trace is dumped when a frame takes longer than this (in ms). */
+  const unsigned frameArenaSize; /**< The size of the arena for temporary data of a frame in KB. 0 means none. */
+
+  /** The state of a worker thread of the module graph runner that is not shared with this thread. */
+  struct Worker
+  {
+    AnnotationManager annotationManager; /**< The annotations added by the worker. */
+    TimingManager timingManager; /**< The timing of the modules executed by the worker. */
+  };
 
   FrameExecutionUnit* executionUnit = nullptr; /**< The thread specific code. */
+  std::vector<Worker> workers; /**< The worker threads executing providers in parallel. Must be destroyed after the module graph runner. */
   ModuleGraphRunner moduleGraphRunner; /**< The solution manager handles the execution of modules. */
 
+  unsigned lastFrameStart = 0; /**< When did the previous frame start (real time in ms)? 0 if there was none. */
+  unsigned framesDeferred = 0; /**< The number of frames delayed to keep the minimum frame period. */
+  unsigned framesOverrun = 0; /**< The number of frames that took longer than the minimum frame period. */
   size_t originalSize = 0; /**< The size of the outgoing message queue at the begin of the frame. */
   size_t sizeAfterFrameBegin; /**< The size of the message queue after the first message was added. */
   Logger* logger; /**< Points to the only logger of this robot. */
@@ -100,6 +117,12 @@ protected:
    */
   int getPriority() const override { return priority; }
 
+  /**
+   * The function determines the cores the thread may run on.
+   * @return The indices of the cores. If empty, the thread may run on all cores.
+   */
+  std::vector<unsigned> getAffinity() const override { return affinity; }
+
   /**
    * The function is called once before the first frame. It should be used
    * for things that can't be done in the constructor.
@@ -125,4 +148,11 @@ protected:
    * @return Has the message been handled?
    */
   bool handleMessage(MessageQueue::Message message) override;
+
+private:
+  /**
+   * Determines the name of a file a trace is written to.
+   * @return The name of the file without its extension.
+   */
+  std::string getTraceFilename() const;
 };
@@ -8,9 +8,11 @@
  */
 
 #include "ModuleGraphCreator.h"
+#include "Streaming/OutStreams.h"
 #include "Streaming/TypeInfo.h"
 
 #include <algorithm>
+#include <cstring>
 #include <map>
 #include <unordered_map>
 
@@ -270,6 +272,54 @@ bool ModuleGraphCreator::calcShared(const Configuration& config, std::size_t ind
   return true;
 }
 
+bool ModuleGraphCreator::checkShadowProviders(const Configuration::Thread& thread) const
+{
+  for(const Configuration::ShadowProvider& shadowProvider : thread.shadowProviders)
+  {
+    const auto shadowModule = modules.find(shadowProvider.provider);
+    if(shadowModule == modules.end())
+    {
+      OUTPUT_ERROR(thread.name << ": Shadow provider " << shadowProvider.provider << " is unknown!");
+      return false;
+    }
+
+    const std::vector<ModuleBase::Info> shadowInfo = shadowModule->second->getModuleInfo();
+    if(std::none_of(shadowInfo.begin(), shadowInfo.end(), [&](const ModuleBase::Info& info)
+                    {return info.update && shadowProvider.representation == info.representation;}))
+    {
+      OUTPUT_ERROR(thread.name << ": Shadow provider " << shadowProvider.provider << " does not provide " << shadowProvider.representation << "!");
+      return false;
+    }
+
+    const auto rp = std::find_if(thread.representationProviders.begin(), thread.representationProviders.end(),
+                                 [&](const Configuration::RepresentationProvider& rp) {return rp.representation == shadowProvider.representation;});
+    const auto module = rp == thread.representationProviders.end() ? modules.end() : modules.find(rp->provider);
+    if(module == modules.end() || rp->provider == shadowProvider.provider)
+    {
+      OUTPUT_ERROR(thread.name << ": The representation " << shadowProvider.representation << " shadowed by "
+                   << shadowProvider.provider << " is not provided by another module!");
+      return false;
+    }
+
+    // The shadow provider is executed right after the actual one. Therefore, it can only rely on
+    // representations that are already available to the actual provider.
+    const std::vector<ModuleBase::Info> info = module->second->getModuleInfo();
+    for(const ModuleBase::Info& requirement : shadowInfo)
+      if(!requirement.update
+         && std::find(config.defaultRepresentations.begin(), config.defaultRepresentations.end(), requirement.representation) == config.defaultRepresentations.end()
+         && std::none_of(thread.representationProviders.begin(), thread.representationProviders.end(), [&](const Configuration::RepresentationProvider& rp)
+                         {return rp.representation == requirement.representation;})
+         && std::none_of(info.begin(), info.end(), [&](const ModuleBase::Info& info)
+                         {return !info.update && !std::strcmp(info.representation, requirement.representation);}))
+      {
+        OUTPUT_ERROR(thread.name << ": Representation " << requirement.representation << " required by shadow provider "
+                     << shadowProvider.provider << " is not available!");
+        return false;
+      }
+  }
+  return true;
+}
+
 bool ModuleGraphCreator::update(In& stream)
 {
   for(std::list<Provider>& providerList : providers)
@@ -304,44 +354,37 @@ bool ModuleGraphCreator::update(In& stream)
       OUTPUT_ERROR(thread.name << ": " << duplicate->representation << " is provided by more than one module!");
       return false;
     }
-  }
 
-  // Fill shared representations
-  if(!calcShared(config))
-    return false;
+    for(const Configuration::StateDependentModule& stateDependentModule : thread.stateDependentModules)
+      if(modules.find(stateDependentModule.module) == modules.end())
+      {
+        OUTPUT_ERROR(thread.name << ": State dependent module " << stateDependentModule.module << " is unknown!");
+        return false;
+      }
 
-  // Fill the list of all providers
-  for(std::size_t j = 0; j < config().size(); j++)
-  {
-    for(const auto& rp : config()[j].representationProviders)
-    {
-      auto module = modules.find(rp.provider);
-      for(const ModuleBase::Info& i : module->second->getModuleInfo())
-        if(i.update && rp.representation == i.representation)
-        {
-          providers[j].emplace_back(i.representation, module->second);
-          break;
-        }
-      int index = static_cast<int>(std::distance(modules.begin(), module));
-      required[j][index] = true;
-    }
+    if(!checkShadowProviders(thread))
+      return false;
   }
 
-  // Fill providedByDefault list
-  std::vector<std::string> providedByDefault;
-  for(const std::string& representation : config.defaultRepresentations)
+  // Reuse the plan if this configuration was calculated before.
+  OutBinaryMemory key;
+  key << config;
+  const std::string planKey(key.data(), key.size());
+  const auto plan = plans.find(planKey);
+  if(plan != plans.end())
   {
-    providedByDefault.emplace_back(representation);
-    // Alias of every thread is also "provided"
-    for(const Configuration::Thread& thread : config())
-      providedByDefault.emplace_back(thread.name + representation);
+    required = plan->second.required;
+    received = plan->second.received;
+    sent = plan->second.sent;
+    providers = plan->second.providers;
   }
-
-  // Sort providers
-  for(std::size_t i = 0; i < providers.size(); i++)
+  else
   {
-    if(!sortProviders(providedByDefault, i))
+    if(!calcPlan())
       return false;
+    if(plans.size() >= maxNumOfPlans)
+      plans.clear();
+    plans.emplace(planKey, Plan{required, received, sent, providers});
   }
 
   // Append all blackboard entries that are now provided by a different module or no module anymore.
@@ -377,6 +420,48 @@ bool ModuleGraphCreator::update(In& stream)
   return true;
 }
 
+bool ModuleGraphCreator::calcPlan()
+{
+  // Fill shared representations
+  if(!calcShared(config))
+    return false;
+
+  // Fill the list of all providers
+  for(std::size_t j = 0; j < config().size(); j++)
+  {
+    for(const auto& rp : config()[j].representationProviders)
+    {
+      auto module = modules.find(rp.provider);
+      for(const ModuleBase::Info& i : module->second->getModuleInfo())
+        if(i.update && rp.representation == i.representation)
+        {
+          providers[j].emplace_back(i.representation, module->second);
+          break;
+        }
+      int index = static_cast<int>(std::distance(modules.begin(), module));
+      required[j][index] = true;
+    }
+  }
+
+  // Fill providedByDefault list
+  std::vector<std::string> providedByDefault;
+  for(const std::string& representation : config.defaultRepresentations)
+  {
+    providedByDefault.emplace_back(representation);
+    // Alias of every thread is also "provided"
+    for(const Configuration::Thread& thread : config())
+      providedByDefault.emplace_back(thread.name + representation);
+  }
+
+  // Sort providers
+  for(std::size_t i = 0; i < providers.size(); i++)
+  {
+    if(!sortProviders(providedByDefault, i))
+      return false;
+  }
+  return true;
+}
+
 bool ModuleGraphCreator::sortProviders(const std::vector<std::string>& providedByDefault, std::size_t index)
 {
   // Collect all representations already provided by default or by other threads.
@@ -466,8 +551,12 @@ bool ModuleGraphCreator::topologicalSort(const char* threadName, Node* node, std
 
 ModuleGraphCreator::ExecutionValues::ExecutionValues(std::vector<std::vector<const char*>>& received, std::vector<std::vector<const char*>>& sent,
                                                      std::vector<std::string>& representationsToReset, std::vector<ModuleRequired>& modules,
-                                                     std::vector<Configuration::RepresentationProvider>& providers) :
-  representationsToReset(representationsToReset), modules(modules), providers(providers)
+                                                     std::vector<Configuration::RepresentationProvider>& providers,
+                                                     const std::vector<std::string>& sharedRepresentations,
+                                                     const std::vector<Configuration::StateDependentModule>& stateDependentModules,
+                                                     const std::vector<Configuration::ShadowProvider>& shadowProviders) :
+  representationsToReset(representationsToReset), modules(modules), providers(providers), sharedRepresentations(sharedRepresentations),
+  stateDependentModules(stateDependentModules), shadowProviders(shadowProviders)
 {
   ASSERT(received.size() == sent.size());
   for(std::size_t i = 0; i < received.size(); i++)
@@ -491,5 +580,6 @@ const ModuleGraphCreator::ExecutionValues ModuleGraphCreator::getExecutionValues
   for(const Provider& provider : providers[index])
     providerList.emplace_back(provider.representation, provider.moduleBase->name);
 
-  return ExecutionValues(received[index], sent[index], representationsToReset, modulesRequired, providerList);
+  return ExecutionValues(received[index], sent[index], representationsToReset, modulesRequired, providerList, config.sharedRepresentations,
+                         config()[index].stateDependentModules, config()[index].shadowProviders);
 }
@@ -13,6 +13,7 @@
 #include "Framework/Configuration.h"
 
 #include <list>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -76,6 +77,18 @@ private:
   std::vector<std::list<Provider>> providers; /**< The list of providers of each thread that will be executed. */
   std::vector<std::string> representationsToReset; /**< The list of all representations that must be reset. */
 
+  /** The results of calculating a configuration that are reused if it is set again. */
+  struct Plan
+  {
+    std::vector<std::vector<bool>> required;
+    std::vector<std::vector<std::vector<const char*>>> received;
+    std::vector<std::vector<std::vector<const char*>>> sent;
+    std::vector<std::list<Provider>> providers;
+  };
+
+  static constexpr std::size_t maxNumOfPlans = 16; /**< The cache of plans is cleared when it reaches this size. */
+  std::unordered_map<std::string, Plan> plans; /**< The valid plans calculated, indexed by their streamed configurations. */
+
 public:
   /**
    * The constructor.
@@ -102,6 +115,22 @@ private:
   static std::vector<ModuleBase::Info>::const_iterator find(const std::vector<ModuleBase::Info>& info, const std::string& representation,
                                                             bool required = false);
 
+  /**
+   * Checks whether the shadow providers of a thread are valid, i.e. they exist,
+   * provide the representations they shadow, these representations are provided
+   * by other modules in the same thread, and all their requirements are available.
+   * @param thread The thread whose shadow providers are checked.
+   * @return Are all shadow providers valid?
+   */
+  bool checkShadowProviders(const Configuration::Thread& thread) const;
+
+  /**
+   * Calculates the representations exchanged between threads and the sequences
+   * of the providers for the current configuration.
+   * @return Is the configuration valid?
+   */
+  bool calcPlan();
+
   /**
    * Adds all representations that need to be shared between threads to the
    * attributes "sent" and "received".
@@ -164,13 +193,19 @@ public: // Passing data to the public:
     ExecutionValues() = default;
     ExecutionValues(std::vector<std::vector<const char*>>& received,  std::vector<std::vector<const char*>>& sent,
                     std::vector<std::string>& representationsToReset, std::vector<ModuleRequired>& modules,
-                    std::vector<Configuration::RepresentationProvider>& providers),
+                    std::vector<Configuration::RepresentationProvider>& providers,
+                    const std::vector<std::string>& sharedRepresentations,
+                    const std::vector<Configuration::StateDependentModule>& stateDependentModules,
+                    const std::vector<Configuration::ShadowProvider>& shadowProviders),
 
     (std::vector<StringVector>) received, /**< Which data is received from which thread. */
     (std::vector<StringVector>) sent, /**< Which data is sent to which thread. */
     (std::vector<std::string>) representationsToReset, /**< All representations that must be reset. */
     (std::vector<ModuleRequired>) modules, /**< All available modules and whether they need to be executed. */
     (std::vector<Configuration::RepresentationProvider>) providers, /**< All active modules and the order in which they must be executed. */
+    (std::vector<std::string>) sharedRepresentations, /**< The representations sent by copying rather than streaming them. */
+    (std::vector<Configuration::StateDependentModule>) stateDependentModules, /**< The modules that are only executed in certain states. */
+    (std::vector<Configuration::ShadowProvider>) shadowProviders, /**< The alternative providers whose results are compared to those of the actual providers. */
   });
 
   /**
@@ -8,21 +8,87 @@
  */
 
 #include "ModuleGraphRunner.h"
+#include "StartupTrace.h"
+#include "Debugging/Debugging.h"
+#include "Platform/File.h"
+#include "Platform/Memory.h"
+#include "Platform/Thread.h"
+#include "Streaming/InStreams.h"
+#include "Streaming/OutStreams.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
 #ifdef TARGET_ROBOT
 #include "Platform/Time.h"
 #endif
 
 thread_local ModuleGraphRunner* ModuleGraphRunner::instance = nullptr;
 
+/**
+ * Finds the first line in which two texts differ. Numbers in both texts are
+ * considered equal if they do not differ by more than a tolerance.
+ * @param a The first text.
+ * @param b The second text.
+ * @param tolerance The maximum absolute difference of numbers accepted.
+ * @param lineA The first line of the first text that differs is returned here.
+ * @param lineB The first line of the second text that differs is returned here.
+ * @return Do the texts differ?
+ */
+static bool findDifference(const std::string& a, const std::string& b, float tolerance, std::string& lineA, std::string& lineB)
+{
+  const auto isNumber = [](const char* p)
+  {
+    return std::isdigit(static_cast<unsigned char>(*p))
+           || ((*p == '-' || *p == '.') && std::isdigit(static_cast<unsigned char>(p[1])));
+  };
+
+  const char* pA = a.c_str();
+  const char* pB = b.c_str();
+  const char* startA = pA;
+  const char* startB = pB;
+  while(*pA || *pB)
+  {
+    if(isNumber(pA) && isNumber(pB))
+    {
+      char* endA;
+      char* endB;
+      if(std::abs(std::strtod(pA, &endA) - std::strtod(pB, &endB)) > tolerance)
+        break;
+      pA = endA;
+      pB = endB;
+    }
+    else if(*pA != *pB)
+      break;
+    else if(*pA++ == '\n')
+    {
+      startA = pA;
+      startB = ++pB;
+    }
+    else
+      ++pB;
+  }
+  if(!*pA && !*pB)
+    return false;
+  lineA.assign(startA, std::strcspn(startA, "\n"));
+  lineB.assign(startB, std::strcspn(startB, "\n"));
+  return true;
+}
+
 void ModuleGraphRunner::destroy()
 {
   validConfiguration = false;
+  cancelLazyUpdates();
   for(Provider& m : providers)
-    if(m.moduleState->instance)
-    {
-      delete m.moduleState->instance;
-      m.moduleState->instance = 0;
-    }
+    for(ModuleState* moduleState : {m.moduleState, m.shadowModuleState})
+      if(moduleState && moduleState->instance)
+      {
+        delete moduleState->instance;
+        moduleState->instance = 0;
+        moduleState->heap = 0;
+      }
   providers.clear();
   sent.clear();
   received.clear();
@@ -30,6 +96,7 @@ void ModuleGraphRunner::destroy()
 
 void ModuleGraphRunner::update(In& stream)
 {
+  cancelLazyUpdates();
   providers.clear();
   representationProviders.clear();
 
@@ -37,34 +104,66 @@ void ModuleGraphRunner::update(In& stream)
   stream >> values;
   received = values.received;
   sent = values.sent;
+  sharedRepresentations = std::unordered_set<std::string>(values.sharedRepresentations.begin(), values.sharedRepresentations.end());
 
   // Adds available modules and updates if they are needed
   for(const auto& module : values.modules)
   {
-    auto i = modules.find(module.module);
-    if(i != modules.end())
-      i->second.required = module.required;
-    else
-    {
-      ASSERT(allModules.find(module.module) != allModules.end());
-      modules.emplace(module.module, allModules.find(module.module)->second).first->second.required = module.required;
-    }
+    const auto i = allModules.find(module.module);
+    ASSERT(i != allModules.end());
+    modules[i->second].required = module.required;
   }
 
+  std::unordered_map<std::string, std::vector<std::string>> states;
+  for(const Configuration::StateDependentModule& stateDependentModule : values.stateDependentModules)
+    states[stateDependentModule.module] = stateDependentModule.states;
+
   // Creating the provider list
   for(const auto& rp : values.providers)
   {
-    const auto m = modules.find(rp.provider);
-    ASSERT(m != modules.end());
-    for(const ModuleBase::Info& i : m->second.module->getModuleInfo())
+    const auto m = allModules.find(rp.provider);
+    ASSERT(m != allModules.end());
+    ModuleState& moduleState = modules[m->second];
+    for(const ModuleBase::Info& i : moduleState.getInfo())
       if(i.update && rp.representation == i.representation)
       {
-        providers.emplace_back(i.representation, &m->second, i.update);
+        // Representations sent to other threads are written after all providers were executed.
+        // Lazy providers would have to be executed by worker threads in parallel to others.
+        bool lazy = i.lazy && !parallelExecutor;
+        for(const auto& s : sent)
+          lazy &= std::find(s.vector.begin(), s.vector.end(), rp.representation) == s.vector.end();
+        providers.emplace_back(i.representation, &moduleState, i.update, lazy);
+        const auto s = states.find(rp.provider);
+        if(s != states.end())
+          providers.back().states = s->second;
         representationProviders[i.representation] = rp.provider;
         break;
       }
   }
 
+  // Shadow providers are executed together with the providers of the representations they shadow.
+  for(const Configuration::ShadowProvider& shadowProvider : values.shadowProviders)
+  {
+    const auto p = std::find_if(providers.begin(), providers.end(),
+                                [&](const Provider& p) {return shadowProvider.representation == p.representation;});
+    const auto m = allModules.find(shadowProvider.provider);
+    ASSERT(p != providers.end() && m != allModules.end());
+    ModuleState& moduleState = modules[m->second];
+    for(const ModuleBase::Info& i : moduleState.getInfo())
+      if(i.update && shadowProvider.representation == i.representation)
+      {
+        p->shadowModuleState = &moduleState;
+        p->shadowUpdate = i.update;
+        p->shadowTolerance = shadowProvider.tolerance;
+        p->lazy = false;
+        moduleState.required = true;
+        break;
+      }
+  }
+
+  determineDependencies();
+  updateActivity();
+
   // Reset all blackboard entries that are now provided by a different module or no module anymore
   // Note: Needed to prevent function pointers from becoming invalid.
   for(const std::string& representation : values.representationsToReset)
@@ -72,12 +171,13 @@ void ModuleGraphRunner::update(In& stream)
       Blackboard::getInstance().reset(representation.c_str());
 
   // Delete all modules that are not required anymore
-  for(auto& m : modules)
+  for(ModuleState& m : modules)
   {
-    if(!m.second.required && m.second.instance)
+    if(!m.required && m.instance)
     {
-      delete m.second.instance;
-      m.second.instance = 0;
+      delete m.instance;
+      m.instance = 0;
+      m.heap = 0;
     }
   }
 
@@ -90,31 +190,26 @@ void ModuleGraphRunner::execute()
 {
   instance = this;
 
+  // Temporary data of the previous frame is not needed anymore.
+  for(const std::unique_ptr<FrameArena>& frameArena : frameArenas)
+    frameArena->reset();
+
   // Execute all providers in the given sequence
-  for(Provider& p : providers)
-  {
-    ASSERT(p.moduleState->required);
-    if(!p.moduleState->instance)
-      p.moduleState->instance = p.moduleState->module->createNew();
-#ifdef TARGET_ROBOT
-    unsigned timestamp = Time::getCurrentSystemTime();
-#endif
-    if(p.moduleState->instance)
-      p.update(*p.moduleState->instance);
-#ifdef TARGET_ROBOT
-    int duration = Time::getTimeSince(timestamp);
-    if(timestamp > 110000 &&
-       ((duration > 100 &&
-         !Global::getDebugRequestTable().isActive("representation:JPEGImage") &&
-         !Global::getDebugRequestTable().isActive("representation:CameraImage")) ||
-        duration > 500) &&
-       std::string(p.representation) != "Keypoints") // @todo Remove again later
-      OUTPUT_ERROR("TIMING: providing " << p.representation << " took " << duration
-                   << " ms at " << timestamp / 1000 - 100 << " s after start");
+#if defined TARGET_ROBOT && defined NDEBUG
+  // Providers are only executed in parallel after they were all executed once
+  // with the current configuration, because that creates all modules and
+  // allocates all representations in the blackboard.
+  if(parallelExecutor && timestamp)
+    parallelExecutor->execute(numOfPredecessors, successors, [this](std::size_t index) {execute(*tasks[index]);});
+  else
 #endif
-  }
+    for(Provider& p : providers)
+      execute(p);
   BH_TRACE;
 
+  DEBUG_RESPONSE_ONCE("module:ModuleGraphRunner:lazyProviders")
+    printLazyStatistics();
+
   if(!timestamp) // Configuration changed recently?
   {
     // all representations must be constructed now, so we can receive data
@@ -123,7 +218,16 @@ void ModuleGraphRunner::execute()
       s.clear();
     for(std::size_t i = 0; i < sent.size(); i++)
       for(const std::string& s : sent[i].vector)
-        toSend[i].emplace_back(&Blackboard::getInstance()[s.c_str()]);
+      {
+        Outgoing& outgoing = toSend[i].emplace_back(Outgoing{&Blackboard::getInstance()[s.c_str()]});
+        if(sharedRepresentations.contains(s))
+          Blackboard::getInstance().getCopyFunctions(s.c_str(), outgoing.create, outgoing.copy);
+      }
+
+    // Inactive providers were only executed to allocate their representations.
+    for(Provider& p : providers)
+      if(!p.active)
+        deactivate(p);
 
     for(auto& r : toReceive)
       r.clear();
@@ -133,23 +237,473 @@ void ModuleGraphRunner::execute()
   }
 }
 
-void ModuleGraphRunner::readPacket(In& stream, const std::size_t index)
+void ModuleGraphRunner::readPacket(In& stream, const std::size_t index, const SharedSlot* slot)
 {
   unsigned timestamp;
   stream >> timestamp;
   // Communication is only possible if both sides are based on the same module request.
   if(timestamp == this->timestamp)
+  {
+    std::size_t next = 0;
     for(Streamable* s : toReceive[index])
-      stream >> *s;
+    {
+      bool copied;
+      stream >> copied;
+      if(copied)
+      {
+        ASSERT(slot && next < slot->size());
+        const SharedRepresentation& shared = (*slot)[next++];
+        shared.copy(*shared.data, *s);
+      }
+      else
+        stream >> *s;
+    }
+  }
   else
     stream.skip(10000000); // skip everything
 }
 
-void ModuleGraphRunner::writePacket(Out& stream, const std::size_t index) const
+void ModuleGraphRunner::writePacket(Out& stream, const std::size_t index, SharedSlot* slot) const
 {
   stream << timestamp;
-  for(const Streamable* s : toSend[index])
-    stream << *s;
+  std::size_t next = 0;
+  for(const Outgoing& outgoing : toSend[index])
+    if(slot && outgoing.copy)
+    {
+      stream << true;
+      if(next == slot->size())
+        slot->emplace_back();
+      SharedRepresentation& shared = (*slot)[next++];
+
+      // The configuration might have changed since this slot was filled.
+      if(shared.copy != outgoing.copy)
+      {
+        shared.data.reset(outgoing.create());
+        shared.copy = outgoing.copy;
+      }
+      outgoing.copy(*outgoing.representation, *shared.data);
+    }
+    else
+      stream << false << *outgoing.representation;
+}
+
+void ModuleGraphRunner::execute(Provider& p)
+{
+  if(!p.active && timestamp)
+    return;
+
+  // Lazy providers are executed normally in the first frame after a configuration
+  // change, because that creates their modules and representations.
+  if(p.lazy && timestamp)
+  {
+    if(p.pending)
+      ++p.skipped;
+    p.pending = true;
+    Blackboard::getInstance().setLazyUpdate(Blackboard::getId(p.representation), [](void* context)
+    {
+      ModuleGraphRunner& runner = ModuleGraphRunner::getInstance();
+      Provider& p = *static_cast<Provider*>(context);
+      ++p.updates;
+      runner.run(p);
+    }, &p);
+  }
+  else
+    run(p);
+}
+
+void ModuleGraphRunner::run(Provider& p)
+{
+  p.pending = false;
+  for(Provider* predecessor : p.lazyPredecessors)
+    if(predecessor->pending)
+      Blackboard::getInstance().update(Blackboard::getId(predecessor->representation));
+
+  ASSERT(p.moduleState->required);
+  const long long heapBalance = Memory::getHeapBalance();
+  if(!p.moduleState->instance)
+  {
+    StartupTrace::Step step("module", p.moduleState->module->name);
+    p.moduleState->instance = p.moduleState->module->createNew();
+  }
+#ifdef TARGET_ROBOT
+  unsigned timestamp = Time::getCurrentSystemTime();
+#endif
+  if(p.moduleState->instance)
+  {
+    if(p.shadowModuleState)
+      runWithShadow(p);
+    else
+      p.update(*p.moduleState->instance);
+  }
+  p.moduleState->heap += Memory::getHeapBalance() - heapBalance;
+#ifdef TARGET_ROBOT
+  int duration = Time::getTimeSince(timestamp);
+  if(timestamp > 110000 &&
+     ((duration > 100 &&
+       !Global::getDebugRequestTable().isActive("representation:JPEGImage") &&
+       !Global::getDebugRequestTable().isActive("representation:CameraImage")) ||
+      duration > 500) &&
+     std::string(p.representation) != "Keypoints") // @todo Remove again later
+    OUTPUT_ERROR("TIMING: providing " << p.representation << " took " << duration
+                 << " ms at " << timestamp / 1000 - 100 << " s after start");
+#endif
+}
+
+void ModuleGraphRunner::runWithShadow(Provider& p)
+{
+  Streamable& representation = Blackboard::getInstance()[p.representation];
+
+  // Both providers start from the same previous state of the representation.
+  OutBinaryMemory previous;
+  previous << representation;
+  if(!p.shadowModuleState->instance)
+  {
+    StartupTrace::Step step("module", p.shadowModuleState->module->name);
+    p.shadowModuleState->instance = p.shadowModuleState->module->createNew();
+  }
+  OutBinaryMemory shadowResult;
+  if(p.shadowModuleState->instance)
+  {
+    p.shadowUpdate(*p.shadowModuleState->instance);
+    shadowResult << representation;
+    InBinaryMemory stream(previous.data(), previous.size());
+    stream >> representation;
+  }
+
+  // The actual provider is executed last, so the functions it binds are kept as well.
+  p.update(*p.moduleState->instance);
+  if(!p.shadowModuleState->instance || p.diverged)
+    return;
+
+  ++p.comparisons;
+  OutBinaryMemory result;
+  result << representation;
+  if(result.size() == shadowResult.size() && !std::memcmp(result.data(), shadowResult.data(), result.size()))
+    return;
+
+  // Compare the results as text to accept small numerical differences and to report where they differ.
+  OutMapMemory resultText;
+  resultText << representation;
+  OutMapMemory shadowText;
+  {
+    InBinaryMemory stream(shadowResult.data(), shadowResult.size());
+    stream >> representation;
+  }
+  shadowText << representation;
+  {
+    InBinaryMemory stream(result.data(), result.size());
+    stream >> representation;
+  }
+
+  std::string resultLine, shadowLine;
+  if(findDifference(std::string(resultText.data(), resultText.size()), std::string(shadowText.data(), shadowText.size()),
+                    p.shadowTolerance, resultLine, shadowLine))
+  {
+    p.diverged = true;
+    OUTPUT_ERROR("Shadow provider " << p.shadowModuleState->module->name << " diverged from " << p.moduleState->module->name
+                 << " for " << p.representation << " in comparison " << p.comparisons << ": \"" << shadowLine
+                 << "\" instead of \"" << resultLine << "\", inputs written to " << writeDivergence(p, previous, shadowResult, result));
+  }
+}
+
+std::string ModuleGraphRunner::writeDivergence(const Provider& p, const OutBinaryMemory& previous,
+                                               const OutBinaryMemory& shadowResult, const OutBinaryMemory& result) const
+{
+  std::string name = Thread::getCurrentThreadName() + p.representation + "Divergence.bin";
+  std::replace(name.begin(), name.end(), ' ', '_');
+  OutBinaryFile stream(name);
+  const auto write = [&](const std::string& name, const OutBinaryMemory& entry)
+  {
+    stream << false << name << static_cast<unsigned>(entry.size());
+    stream.write(entry.data(), entry.size());
+  };
+
+  // The representations read. Neither provider has changed them.
+  const Blackboard& blackboard = Blackboard::getInstance();
+  std::unordered_set<std::string> written;
+  for(const ModuleState* moduleState : {p.moduleState, p.shadowModuleState})
+  {
+    std::vector<std::string> read(moduleState->used.begin(), moduleState->used.end());
+    for(const ModuleBase::Info& info : moduleState->info)
+      if(!info.update)
+        read.emplace_back(info.representation);
+    for(const std::string& representation : read)
+      if(blackboard.exists(representation.c_str()) && written.insert(representation).second)
+      {
+        OutBinaryMemory entry;
+        entry << blackboard[representation.c_str()];
+        write(representation, entry);
+      }
+  }
+
+  // The representation provided before both providers were executed and both results.
+  // Restoring this file only restores the previous state, because the results are stored under different names.
+  write(p.representation, previous);
+  write(std::string(p.representation) + ":" + p.moduleState->module->name, result);
+  write(std::string(p.representation) + ":" + p.shadowModuleState->module->name, shadowResult);
+  return stream.getFile()->getFullName();
+}
+
+void ModuleGraphRunner::setState(const char* state)
+{
+  if(state ? this->state != state : !this->state.empty())
+  {
+    this->state = state ? state : "";
+    updateActivity();
+  }
+}
+
+void ModuleGraphRunner::updateActivity()
+{
+  for(Provider& p : providers)
+  {
+    const bool active = state.empty() || p.states.empty()
+                        || std::find(p.states.begin(), p.states.end(), state) != p.states.end();
+    if(p.active && !active)
+      deactivate(p);
+    p.active = active;
+  }
+}
+
+void ModuleGraphRunner::deactivate(Provider& p)
+{
+  Blackboard& blackboard = Blackboard::getInstance();
+  const Blackboard::Id id = Blackboard::getId(p.representation);
+  if(blackboard.exists(id))
+  {
+    if(p.pending)
+    {
+      blackboard.setLazyUpdate(id, nullptr, nullptr);
+      p.pending = false;
+    }
+    Blackboard::Create create;
+    Blackboard::Copy copy;
+    if(blackboard.getCopyFunctions(p.representation, create, copy))
+    {
+      const std::unique_ptr<Streamable> defaultRepresentation(create());
+      copy(*defaultRepresentation, blackboard[id]);
+    }
+  }
+}
+
+void ModuleGraphRunner::cancelLazyUpdates()
+{
+  Blackboard& blackboard = Blackboard::getInstance();
+  for(Provider& p : providers)
+    if(p.lazy)
+    {
+      const Blackboard::Id id = Blackboard::getId(p.representation);
+      if(blackboard.exists(id))
+        blackboard.setLazyUpdate(id, nullptr, nullptr);
+    }
+}
+
+void ModuleGraphRunner::printLazyStatistics() const
+{
+  for(const Provider& p : providers)
+    if(p.lazy)
+      OUTPUT_TEXT(p.representation << ": " << p.updates << " updates, " << p.skipped << " skipped ("
+                  << (p.updates + p.skipped ? 100 * p.skipped / (p.updates + p.skipped) : 0) << "%)");
+}
+
+void ModuleGraphRunner::getMemoryUsage(MemoryUsage& memoryUsage) const
+{
+  memoryUsage.representations.clear();
+  memoryUsage.modules.clear();
+  const Blackboard& blackboard = Blackboard::getInstance();
+  std::unordered_set<const ModuleState*> modulesAdded;
+  for(const Provider& p : providers)
+  {
+    if(blackboard.exists(p.representation))
+    {
+      OutBinarySize stream;
+      stream << blackboard[p.representation];
+      memoryUsage.representations.emplace_back();
+      MemoryUsage::Representation& representation = memoryUsage.representations.back();
+      representation.name = p.representation;
+      representation.size = static_cast<unsigned>(blackboard.getSize(p.representation));
+      representation.streamedSize = static_cast<unsigned>(stream.size());
+    }
+    if(p.moduleState->instance && modulesAdded.insert(p.moduleState).second)
+    {
+      memoryUsage.modules.emplace_back();
+      MemoryUsage::Module& module = memoryUsage.modules.back();
+      module.name = p.moduleState->module->name;
+      module.heap = static_cast<int>(p.moduleState->heap);
+    }
+  }
+  memoryUsage.heap = static_cast<int>(Memory::getHeapBalance());
+}
+
+void ModuleGraphRunner::handleSnapshotCommand(In& stream)
+{
+  unsigned char command;
+  unsigned key;
+  stream >> command >> key;
+  switch(command)
+  {
+    case saveSnapshot:
+    {
+      OutBinaryMemory snapshot;
+      writeSnapshot(snapshot);
+      snapshots[key].assign(snapshot.data(), snapshot.data() + snapshot.size());
+      break;
+    }
+    case restoreSnapshot:
+      if(const auto snapshot = snapshots.find(key); snapshot != snapshots.end())
+      {
+        InBinaryMemory stream(snapshot->second.data(), snapshot->second.size());
+        readSnapshot(stream);
+      }
+      break;
+    case clearSnapshots:
+      snapshots.clear();
+  }
+}
+
+void ModuleGraphRunner::writeSnapshot(Out& stream) const
+{
+  // Each entry is prefixed by its size so that it can be skipped when restoring.
+  OutBinaryMemory entry;
+  const auto write = [&](bool isModule, const std::string& name)
+  {
+    stream << isModule << name << static_cast<unsigned>(entry.size());
+    stream.write(entry.data(), entry.size());
+    entry.clear();
+  };
+
+  const Blackboard& blackboard = Blackboard::getInstance();
+  std::unordered_set<const ModuleState*> modulesAdded;
+  for(const Provider& p : providers)
+  {
+    if(blackboard.exists(p.representation))
+    {
+      entry << blackboard[p.representation];
+      write(false, p.representation);
+    }
+    if(const ModuleSnapshot* module = dynamic_cast<const ModuleSnapshot*>(p.moduleState->instance);
+       module && modulesAdded.insert(p.moduleState).second)
+    {
+      module->writeSnapshot(entry);
+      write(true, p.moduleState->module->name);
+    }
+  }
+}
+
+void ModuleGraphRunner::readSnapshot(In& stream)
+{
+  Blackboard& blackboard = Blackboard::getInstance();
+  std::vector<char> entry;
+  while(!stream.eof())
+  {
+    bool isModule;
+    std::string name;
+    unsigned size;
+    stream >> isModule >> name >> size;
+    entry.resize(size);
+    stream.read(entry.data(), size);
+
+    InBinaryMemory data(entry.data(), entry.size());
+    if(!isModule)
+    {
+      if(blackboard.exists(name.c_str()))
+        data >> blackboard[name.c_str()];
+    }
+    else if(const auto module = allModules.find(name); module != allModules.end())
+      if(ModuleSnapshot* instance = dynamic_cast<ModuleSnapshot*>(modules[module->second].instance))
+        instance->readSnapshot(data);
+  }
+}
+
+void ModuleGraphRunner::enableFrameArena(std::size_t size)
+{
+  frameArenas.emplace_back(std::make_unique<FrameArena>(size))->activate();
+}
+
+void ModuleGraphRunner::enableParallelExecution(const std::string& name, std::size_t numOfWorkers, int priority,
+                                                const std::function<void(std::size_t)>& initWorker)
+{
+#if defined TARGET_ROBOT && defined NDEBUG
+  if(!frameArenas.empty())
+    for(std::size_t i = 0; i < numOfWorkers; ++i)
+      frameArenas.emplace_back(std::make_unique<FrameArena>(frameArenas.front()->getSize()));
+  parallelExecutor = std::make_unique<ParallelExecutor>(name, numOfWorkers, priority, [this, initWorker](std::size_t index)
+  {
+    instance = this;
+    if(index + 1 < frameArenas.size())
+      frameArenas[index + 1]->activate();
+    initWorker(index);
+  });
+#else
+  static_cast<void>(name);
+  static_cast<void>(numOfWorkers);
+  static_cast<void>(priority);
+  static_cast<void>(initWorker);
+#endif
+}
+
+void ModuleGraphRunner::determineDependencies()
+{
+  // Collect which representations are read and written by each module.
+  struct Access
+  {
+    std::vector<std::string> read;
+    std::vector<std::string> written;
+  };
+  std::unordered_map<ModuleState*, Access> accesses;
+  for(Provider& p : providers)
+    for(ModuleState* moduleState : {p.moduleState, p.shadowModuleState})
+      if(moduleState && !accesses.contains(moduleState))
+      {
+        Access& access = accesses[moduleState];
+        for(const ModuleBase::Info& info : moduleState->getInfo())
+          (info.update ? access.written : access.read).emplace_back(info.representation);
+        for(const char* representation : moduleState->used)
+          access.read.emplace_back(representation);
+      }
+
+  const auto accessesAny = [](const std::vector<std::string>& a, const std::vector<std::string>& b)
+  {
+    for(const std::string& s : a)
+      if(std::find(b.begin(), b.end(), s) != b.end())
+        return true;
+    return false;
+  };
+
+  // A shadow provider is executed together with the provider it shadows.
+  const auto dependsOn = [&](const Provider& p1, const Provider& p2)
+  {
+    for(ModuleState* m1 : {p1.moduleState, p1.shadowModuleState})
+      for(ModuleState* m2 : {p2.moduleState, p2.shadowModuleState})
+        if(m1 && m2)
+        {
+          const Access& a = accesses[m1];
+          const Access& b = accesses[m2];
+          if(m1 == m2 || accessesAny(a.read, b.written) || accessesAny(b.read, a.written))
+            return true;
+        }
+    return false;
+  };
+
+  tasks.clear();
+  for(Provider& p : providers)
+    tasks.emplace_back(&p);
+  numOfPredecessors.assign(tasks.size(), 0);
+  successors.assign(tasks.size(), {});
+  for(std::size_t i = 0; i < tasks.size(); ++i)
+  {
+    tasks[i]->lazyPredecessors.clear();
+    for(std::size_t j = 0; j < i; ++j)
+    {
+      if(dependsOn(*tasks[i], *tasks[j]))
+      {
+        ++numOfPredecessors[i];
+        successors[j].push_back(i);
+        if(tasks[j]->lazy)
+          tasks[i]->lazyPredecessors.push_back(tasks[j]);
+      }
+    }
+  }
 }
 
 const std::string& ModuleGraphRunner::getProvider(const std::string& representation) const
@@ -10,12 +10,20 @@
 #pragma once
 
 #include "Framework/Configuration.h"
+#include "Framework/FrameArena.h"
 #include "Framework/ModuleGraphCreator.h"
+#include "Framework/ParallelExecutor.h"
 
+#include <array>
+#include <functional>
+#include <map>
+#include <memory>
+#include <unordered_set>
 #include <vector>
 
 class In;
 class Out;
+class OutBinaryMemory;
 
 /**
  * @class ModuleGraphRunner
@@ -24,6 +32,46 @@ class Out;
  */
 class ModuleGraphRunner
 {
+public:
+  /** A representation that is exchanged by copying it rather than streaming it. */
+  struct SharedRepresentation
+  {
+    std::unique_ptr<Streamable> data; /**< The copy of the representation. */
+    Blackboard::Copy copy = nullptr; /**< The function that copies the representation. */
+  };
+
+  using SharedSlot = std::vector<SharedRepresentation>; /**< The representations copied into one entry of the triple buffer. */
+  using SharedBuffer = std::array<SharedSlot, 3>; /**< The representations copied into all entries of the triple buffer of a receiver. */
+
+  /** The memory used by the representations and modules of a thread. */
+  STREAMABLE(MemoryUsage,
+  {
+    STREAMABLE(Representation,
+    {,
+      (std::string) name,
+      (unsigned) size, /**< The size of its type in bytes. */
+      (unsigned) streamedSize, /**< The size of its data when streamed in bytes, which includes the contents of its containers. */
+    });
+
+    STREAMABLE(Module,
+    {,
+      (std::string) name,
+      (int) heap, /**< The growth of the heap caused by creating and executing the module in bytes (only on Linux). */
+    }),
+
+    (std::vector<Representation>) representations, /**< The representations provided in this thread. */
+    (std::vector<Module>) modules, /**< The modules that currently exist in this thread. */
+    (int) heap, /**< The bytes allocated by this thread minus the bytes it freed (only on Linux). */
+  });
+
+  /** The commands that can be sent to a thread in a message \c idModuleSnapshot , followed by a key. */
+  enum SnapshotCommand : unsigned char
+  {
+    saveSnapshot, /**< Store the state of the thread under the key. */
+    restoreSnapshot, /**< Restore the state stored under the key. */
+    clearSnapshots, /**< Forget all states stored. The key is ignored. */
+  };
+
 private:
   /**
    * The class represents the current state of a module.
@@ -34,12 +82,30 @@ private:
     ModuleBase* module; /**< A pointer to the module base that is able to create an instance of the module. */
     Streamable* instance = nullptr; /**< A pointer to the instance of the module if it was created. Otherwise the pointer is 0. */
     bool required = false; /**< A flag that is required when determining whether a module is currently required or not. */
+    std::vector<ModuleBase::Info> info; /**< The requirements and provisions of the module. Empty until first needed. */
+    std::vector<const char*> used; /**< The representations used by the module. Only valid if info is not empty. */
+    long long heap = 0; /**< The growth of the heap caused by creating and executing the module in bytes. */
 
     /**
      * Constructor.
      * @param module A pointer to the module base that is able to create an instance of the module.
      */
     ModuleState(ModuleBase* module) : module(module) {}
+
+    /**
+     * Returns the requirements and provisions of the module.
+     * They are only determined once.
+     * @return The information about the module.
+     */
+    const std::vector<ModuleBase::Info>& getInfo()
+    {
+      if(info.empty())
+      {
+        info = module->getModuleInfo();
+        used = module->getUsedRepresentations();
+      }
+      return info;
+    }
   };
 
   /**
@@ -51,33 +117,63 @@ private:
     const char* representation; /**< The representation that will be provided. */
     ModuleState* moduleState; /**< The moduleState that will give access to the module that provides the information. */
     void (*update)(Streamable&); /**< The update handler within the module. */
+    bool lazy; /**< Is the update handler only called when the representation is read? */
+    bool pending = false; /**< Is a lazy update still pending in this frame? */
+    unsigned updates = 0; /**< The number of frames the update handler was called in lazy mode. */
+    unsigned skipped = 0; /**< The number of frames the update handler was not called in lazy mode. */
+    std::vector<Provider*> lazyPredecessors; /**< The lazy providers this provider depends on. */
+    std::vector<std::string> states; /**< The states in which this provider is executed. Empty means all. */
+    bool active = true; /**< Is this provider executed in the current state? */
+    ModuleState* shadowModuleState = nullptr; /**< The module of the shadow provider whose result is compared to the one of this provider. nullptr if there is none. */
+    void (*shadowUpdate)(Streamable&) = nullptr; /**< The update handler within the shadow module. */
+    float shadowTolerance = 0.f; /**< The maximum absolute difference of numbers in both results that is still accepted. */
+    unsigned comparisons = 0; /**< The number of frames in which both results were compared. */
+    bool diverged = false; /**< Was a divergence between both results already reported? */
 
     /**
      * Constructor.
      * @param representation The name of the representation provided.
      * @param moduleState The moduleState that will give access to the module that provides the information.
      * @param update The update handler within the module.
+     * @param lazy Is the update handler only called when the representation is read?
      */
-    Provider(const char* representation, ModuleState* moduleState, void (*update)(Streamable&)) :
-      representation(representation), moduleState(moduleState), update(update)
+    Provider(const char* representation, ModuleState* moduleState, void (*update)(Streamable&), bool lazy) :
+      representation(representation), moduleState(moduleState), update(update), lazy(lazy)
     {}
   };
 
   thread_local static ModuleGraphRunner* instance; /**< The only instance of this class in the thread. */
-  std::unordered_map<std::string, ModuleBase*> allModules; /**< A map of all modules for quick access via name. */
+  std::unordered_map<std::string, std::size_t> allModules; /**< The indices of all modules in the vector modules for quick access via name. */
   bool validConfiguration = false;
 
-  std::unordered_map<std::string, ModuleState> modules; /**< The current state of all available modules. Must not be changed after adding to the providers list. */
+  std::vector<ModuleState> modules; /**< The current state of all available modules. Must not be resized after construction, because the providers point to its elements. */
   std::vector<ModuleGraphCreator::ExecutionValues::StringVector> received; /**< The list of all names of representations received from other threads. */
   std::vector<ModuleGraphCreator::ExecutionValues::StringVector> sent; /**< The list of all names of representations sent to other threads */
 
   std::list<Provider> providers; /**< The list of providers that will be executed. */
   std::unordered_map<std::string, std::string> representationProviders; /**< Which representation is provided by which provider? */
+  /** A representation sent to another thread. */
+  struct Outgoing
+  {
+    Streamable* representation; /**< The representation in the blackboard. */
+    Blackboard::Create create = nullptr; /**< Creates a copy of the representation if it is shared. */
+    Blackboard::Copy copy = nullptr; /**< Copies the representation if it is shared. Otherwise, it is streamed. */
+  };
+
+  std::unordered_set<std::string> sharedRepresentations; /**< The representations that are copied instead of streamed if possible. */
   std::vector<std::vector<Streamable*>> toReceive; /**< The list of all representations received from other threads. */
-  std::vector<std::vector<Streamable*>> toSend; /**< The list of all representations sent to other threads. */
+  std::vector<std::vector<Outgoing>> toSend; /**< The list of all representations sent to other threads. */
+
+  std::vector<std::unique_ptr<FrameArena>> frameArenas; /**< The arenas for temporary data of this thread (first entry) and its workers. Empty if not used. */
+  std::unique_ptr<ParallelExecutor> parallelExecutor; /**< Executes independent providers in parallel. nullptr if they are executed sequentially. */
+  std::vector<Provider*> tasks; /**< The providers in the sequence of their execution, i.e. the tasks of the parallel executor. */
+  std::vector<unsigned> numOfPredecessors; /**< The number of earlier providers each provider depends on. */
+  std::vector<std::vector<std::size_t>> successors; /**< The indices of the later providers that depend on each provider. */
 
+  std::string state; /**< The current state. Empty if there is none. */
   unsigned timestamp = 0; /**< The timestamp of the last module request. Communication is only possible if both sides use the same timestamp. */
   unsigned nextTimestamp = 0; /**< The next timestamp used to verify communication. */
+  std::map<unsigned, std::vector<char>> snapshots; /**< The states of this thread stored per key. */
 
 public:
   /**
@@ -88,7 +184,10 @@ public:
   {
     instance = this;
     for(ModuleBase* i = ModuleBase::first; i; i = i->next)
-      allModules.emplace(i->name, i);
+    {
+      allModules.emplace(i->name, modules.size());
+      modules.emplace_back(i);
+    }
   }
 
   /**
@@ -97,6 +196,7 @@ public:
    */
   ~ModuleGraphRunner()
   {
+    parallelExecutor.reset();
     destroy();
     instance = nullptr;
   }
@@ -134,20 +234,76 @@ public:
    */
   void execute();
 
+  /**
+   * Sets the state the modules are executed in. Modules can be restricted to
+   * certain states by the configuration. All other modules are always executed.
+   * Restricted modules are neither destroyed nor created when the state changes.
+   * Instead, their providers are just not executed anymore and the
+   * representations they provide are reset if that is possible.
+   * @param state The name of the state or nullptr if there is none, which
+   *              executes all modules.
+   */
+  void setState(const char* state);
+
+  /**
+   * Determines the memory used by the representations and modules of this
+   * thread. This is expensive, because all representations are streamed.
+   * @param memoryUsage The memory usage is written to this object.
+   */
+  void getMemoryUsage(MemoryUsage& memoryUsage) const;
+
+  /**
+   * Stores or restores the state of this thread, i.e. its representations
+   * provided and the internal states of its modules that are derived from
+   * \c ModuleSnapshot . Restoring ignores representations and modules that
+   * do not exist anymore.
+   * @param stream The stream the \c SnapshotCommand and the key are read from.
+   */
+  void handleSnapshotCommand(In& stream);
+
+  /**
+   * Provides an arena for temporary data to the modules executed by this
+   * thread, which is reset at the beginning of each frame. Must be called
+   * in this thread before \c enableParallelExecution , which creates
+   * arenas of the same size for the worker threads.
+   * @param size The size of the arena in bytes.
+   */
+  void enableFrameArena(std::size_t size);
+
+  /**
+   * Lets worker threads execute providers that do not depend on each other
+   * in parallel. This only happens in release builds for the robot, because
+   * the debugging infrastructure is not thread-safe. Otherwise, all providers
+   * are still executed sequentially.
+   * @param name The name of the thread.
+   * @param numOfWorkers The number of worker threads in addition to the thread
+   *                     calling execute().
+   * @param priority The priority of the worker threads.
+   * @param initWorker A function that is called in each worker thread with its
+   *                   index. It must initialize the thread-local state the
+   *                   modules rely on.
+   */
+  void enableParallelExecution(const std::string& name, std::size_t numOfWorkers, int priority,
+                               const std::function<void(std::size_t)>& initWorker);
+
   /**
    * The function reads a packet from a stream.
    * @param stream A stream containing representations received from another thread.
    * @param index The index of the thread this packet is from.
+   * @param slot The representations the sender copied instead of streaming them.
+   *             nullptr if the sender must stream everything.
    */
-  void readPacket(In& stream, const std::size_t index);
+  void readPacket(In& stream, const std::size_t index, const SharedSlot* slot = nullptr);
 
   /**
    * The function writes a packet to a stream.
    * @param stream A stream that will be filled with representations that are sent
    *               to another thread.
    * @param index The index of the thread this packet is for.
+   * @param slot The representations shared are copied to this slot rather than streamed.
+   *             If nullptr, all representations are streamed.
    */
-  void writePacket(Out& stream, const std::size_t index) const;
+  void writePacket(Out& stream, const std::size_t index, SharedSlot* slot = nullptr) const;
 
   /**
    * The function checks whether no data would be received in a packet from a
@@ -175,4 +331,82 @@ public:
    * @return The name of the provider or an empty string if the representation is not provided.
    */
   const std::string& getProvider(const std::string& representation) const;
+
+private:
+  /**
+   * Determines which providers depend on which earlier providers. A provider
+   * depends on another one if they belong to the same module or if one of their
+   * modules requires or uses a representation the other module provides.
+   */
+  void determineDependencies();
+
+  /**
+   * Writes the state of this thread.
+   * @param stream The stream the representations and module instances are written to.
+   */
+  void writeSnapshot(Out& stream) const;
+
+  /**
+   * Restores the state of this thread.
+   * @param stream The stream written by \c writeSnapshot .
+   */
+  void readSnapshot(In& stream);
+
+  /**
+   * Executes a single provider. Lazy providers are only prepared to be executed
+   * when their representation is read.
+   * @param p The provider.
+   */
+  void execute(Provider& p);
+
+  /**
+   * Actually executes a single provider. The lazy providers it depends on are
+   * executed first if they are still pending.
+   * @param p The provider.
+   */
+  void run(Provider& p);
+
+  /**
+   * Executes a provider together with its shadow provider. The shadow provider
+   * is executed first. Afterwards, the previous state of the representation is
+   * restored and the actual provider is executed, i.e. only its result is used.
+   * The first divergence between both results is reported and the inputs of
+   * this frame are written to a file.
+   * @param p The provider. Its module must exist.
+   */
+  void runWithShadow(Provider& p);
+
+  /**
+   * Writes the inputs of a provider and its shadow provider as well as their
+   * results to a file in the format of \c writeSnapshot .
+   * @param p The provider.
+   * @param previous The state of the representation before both were executed.
+   * @param shadowResult The result of the shadow provider.
+   * @param result The result of the actual provider.
+   * @return The name of the file written.
+   */
+  std::string writeDivergence(const Provider& p, const OutBinaryMemory& previous,
+                              const OutBinaryMemory& shadowResult, const OutBinaryMemory& result) const;
+
+  /**
+   * Cancels all pending lazy updates, because the providers will be destroyed.
+   */
+  void cancelLazyUpdates();
+
+  /**
+   * Determines which providers are executed in the current state. The
+   * representations of providers that are not executed anymore are reset.
+   */
+  void updateActivity();
+
+  /**
+   * Resets the representation of a provider that is not executed anymore to
+   * its default. This is only possible if it can be copied. Otherwise, it
+   * keeps its last value.
+   * @param p The provider.
+   */
+  void deactivate(Provider& p);
+
+  /** Prints how often the lazy providers were executed and skipped. */
+  void printLazyStatistics() const;
 };
@@ -16,6 +16,15 @@ struct ModulePacket
 {
   ModuleGraphRunner* moduleGraphRunner = nullptr; /**< A pointer to the module graph runner. It knows the actual data to be streamed. */
   size_t index = -1; /**< The index of the thread of the packet. */
+  ModuleGraphRunner::SharedBuffer* sharedBuffer = nullptr; /**< Representations copied rather than streamed. Owned by the receiving thread. */
+  int slot = 0; /**< The entry of the triple buffer that is currently written or read. */
+
+  /**
+   * Sets the entry of the triple buffer that is written or read next.
+   * Called by Sender and Receiver.
+   * @param slot The index of the entry.
+   */
+  void setSlot(int slot) {this->slot = slot;}
 };
 
 /**
@@ -27,7 +36,8 @@ struct ModulePacket
  */
 inline Out& operator<<(Out& stream, const ModulePacket& modulePacket)
 {
-  modulePacket.moduleGraphRunner->writePacket(stream, modulePacket.index);
+  modulePacket.moduleGraphRunner->writePacket(stream, modulePacket.index,
+                                              modulePacket.sharedBuffer ? &(*modulePacket.sharedBuffer)[modulePacket.slot] : nullptr);
   return stream;
 }
 
@@ -40,6 +50,7 @@ inline Out& operator<<(Out& stream, const ModulePacket& modulePacket)
  */
 inline In& operator>>(In& stream, ModulePacket& modulePacket)
 {
-  modulePacket.moduleGraphRunner->readPacket(stream, modulePacket.index);
+  modulePacket.moduleGraphRunner->readPacket(stream, modulePacket.index,
+                                             modulePacket.sharedBuffer ? &(*modulePacket.sharedBuffer)[modulePacket.slot] : nullptr);
   return stream;
 }
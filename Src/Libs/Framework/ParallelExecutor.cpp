@@ -0,0 +1,92 @@
+/**
+ * @file ParallelExecutor.cpp
+ *
+ * This file implements a class that executes tasks that depend on each other
+ * using a pool of worker threads.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "ParallelExecutor.h"
+#include "Platform/BHAssert.h"
+
+ParallelExecutor::ParallelExecutor(const std::string& name, std::size_t numOfWorkers, int priority,
+                                   const std::function<void(std::size_t)>& initWorker) :
+  name(name), initWorker(initWorker)
+{
+  for(std::size_t i = 0; i < numOfWorkers; ++i)
+  {
+    workers.emplace_back(std::make_unique<Thread>(priority));
+    workers.back()->start(this, &ParallelExecutor::worker);
+  }
+}
+
+ParallelExecutor::~ParallelExecutor()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    terminating = true;
+  }
+  changed.notify_all();
+  for(std::unique_ptr<Thread>& worker : workers)
+    worker->stop();
+}
+
+void ParallelExecutor::execute(const std::vector<unsigned>& numOfPredecessors, const std::vector<std::vector<std::size_t>>& successors,
+                               const std::function<void(std::size_t)>& run)
+{
+  ASSERT(numOfPredecessors.size() == successors.size());
+  std::unique_lock<std::mutex> lock(mutex);
+  this->successors = &successors;
+  this->run = &run;
+  remaining = numOfPredecessors;
+  unfinished = remaining.size();
+  ready.clear();
+  for(std::size_t i = 0; i < remaining.size(); ++i)
+    if(!remaining[i])
+      ready.push_back(i);
+  changed.notify_all();
+
+  while(unfinished)
+    if(ready.empty())
+      changed.wait(lock);
+    else
+      runTask(lock);
+
+  this->successors = nullptr;
+  this->run = nullptr;
+}
+
+void ParallelExecutor::worker()
+{
+  const std::size_t index = nextWorkerIndex++;
+  Thread::nameCurrentThread(std::to_string(index) + "." + name);
+  initWorker(index);
+
+  std::unique_lock<std::mutex> lock(mutex);
+  while(!terminating)
+    if(ready.empty())
+      changed.wait(lock);
+    else
+      runTask(lock);
+}
+
+void ParallelExecutor::runTask(std::unique_lock<std::mutex>& lock)
+{
+  const std::size_t task = ready.back();
+  ready.pop_back();
+  const std::function<void(std::size_t)>& run = *this->run;
+  lock.unlock();
+  run(task);
+  lock.lock();
+
+  bool notify = !--unfinished;
+  for(std::size_t successor : (*successors)[task])
+    if(!--remaining[successor])
+    {
+      ready.push_back(successor);
+      notify = true;
+    }
+  if(notify)
+    changed.notify_all();
+}
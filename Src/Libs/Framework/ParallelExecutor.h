@@ -0,0 +1,80 @@
+/**
+ * @file ParallelExecutor.h
+ *
+ * This file declares a class that executes tasks that depend on each other
+ * using a pool of worker threads.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Platform/Thread.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @class ParallelExecutor
+ *
+ * A pool of worker threads that execute a set of tasks as soon as all the tasks
+ * they depend on are finished. The thread calling execute() also works on the tasks.
+ * All workers take their tasks from a single queue of tasks that are ready.
+ */
+class ParallelExecutor
+{
+private:
+  const std::string name; /**< The name of the thread the workers work for. */
+  std::vector<std::unique_ptr<Thread>> workers; /**< The worker threads. */
+  std::function<void(std::size_t)> initWorker; /**< Is called in each worker thread with its index when it starts. */
+  std::atomic<std::size_t> nextWorkerIndex = 0; /**< The index of the worker thread that is started next. */
+
+  std::mutex mutex; /**< Protects all members below. */
+  std::condition_variable changed; /**< Signals that tasks became ready, all tasks are finished, or the workers should terminate. */
+  bool terminating = false; /**< Should the worker threads terminate? */
+  const std::vector<std::vector<std::size_t>>* successors = nullptr; /**< The tasks that depend on each task. */
+  const std::function<void(std::size_t)>* run = nullptr; /**< Executes a task. */
+  std::vector<unsigned> remaining; /**< The number of unfinished predecessors of each task. */
+  std::vector<std::size_t> ready; /**< The tasks that are ready to be executed. */
+  std::size_t unfinished = 0; /**< The number of tasks not finished yet. */
+
+public:
+  /**
+   * The constructor starts the worker threads.
+   * @param name The name of the thread the workers work for. The workers use the
+   *             same name, prefixed by their index as debug information.
+   * @param numOfWorkers The number of worker threads. The thread calling execute()
+   *                     is not included.
+   * @param priority The priority of the worker threads.
+   * @param initWorker A function that is called in each worker thread
+   *                   with its index before it executes any tasks.
+   */
+  ParallelExecutor(const std::string& name, std::size_t numOfWorkers, int priority, const std::function<void(std::size_t)>& initWorker);
+
+  /** The destructor stops all worker threads. */
+  ~ParallelExecutor();
+
+  /**
+   * Executes all tasks and returns when they are all finished.
+   * @param numOfPredecessors The number of tasks each task depends on.
+   * @param successors The indices of the tasks that depend on each task.
+   * @param run The function that executes the task with the index passed.
+   */
+  void execute(const std::vector<unsigned>& numOfPredecessors, const std::vector<std::vector<std::size_t>>& successors,
+               const std::function<void(std::size_t)>& run);
+
+private:
+  /** The main function of the worker threads. */
+  void worker();
+
+  /**
+   * Executes a task that is ready and updates the tasks depending on it.
+   * @param lock The lock of the mutex that is held when this function is called.
+   *             It is released while the task is executed.
+   */
+  void runTask(std::unique_lock<std::mutex>& lock);
+};
@@ -12,6 +12,7 @@
 #include "Framework/ModuleContainer.h"
 #include "Platform/BHAssert.h"
 #include "Platform/File.h"
+#include "Platform/Memory.h"
 #include "Streaming/InStreams.h"
 
 Robot::Robot(const Settings& settings, const std::string& name) : name(name)
@@ -24,6 +25,7 @@ Robot::Robot(const Settings& settings, const std::string& name) : name(name)
   stream >> config;
   if(!stream.exists() || config().empty())
     FAIL("Cannot open the file threads.cfg or the file is empty.");
+  Memory::setHugePages(config.hugePages);
 
   push_back(new Debug(settings, name, config));
 
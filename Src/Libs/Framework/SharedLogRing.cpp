@@ -0,0 +1,170 @@
+/**
+ * @file SharedLogRing.cpp
+ *
+ * This file implements a ring buffer in shared memory, through which the
+ * logger publishes the frames it logs to other processes on the same
+ * machine.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "SharedLogRing.h"
+#include "Streaming/InStreams.h"
+#include "Streaming/MessageQueue.h"
+#include "Streaming/OutStreams.h"
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace
+{
+  /** A physical stream that writes to the ring, wrapping around at its end. */
+  class OutRing : public PhysicalOutStream
+  {
+    char* ring = nullptr; /**< The begin of the ring. */
+    std::uint64_t capacity = 0; /**< The size of the ring in bytes. */
+    std::uint64_t position = 0; /**< The position of the next byte to write. */
+
+  public:
+    /**
+     * Opens the stream.
+     * @param ring The begin of the ring.
+     * @param capacity The size of the ring in bytes.
+     * @param position The position of the first byte to write.
+     */
+    void open(char* ring, std::uint64_t capacity, std::uint64_t position)
+    {
+      this->ring = ring;
+      this->capacity = capacity;
+      this->position = position;
+    }
+
+    void writeToStream(const void* p, size_t size) override
+    {
+      const char* src = static_cast<const char*>(p);
+      while(size > 0)
+      {
+        const std::uint64_t offset = position % capacity;
+        const std::size_t bytes = static_cast<std::size_t>(std::min<std::uint64_t>(size, capacity - offset));
+        std::memcpy(ring + offset, src, bytes);
+        src += bytes;
+        position += bytes;
+        size -= bytes;
+      }
+    }
+  };
+
+  using OutBinaryRing = OutStream<OutRing, OutBinary>;
+}
+
+SharedLogRing::SharedLogRing(const std::string& name, std::size_t capacity, const char* prefix, std::size_t prefixSize) :
+  memory(std::make_unique<SharedMemory>(name, sizeof(Header) + prefixSize + capacity))
+{
+  if(memory->exists())
+  {
+    header = new(memory->getData()) Header;
+    header->prefixSize = static_cast<std::uint32_t>(prefixSize);
+    header->capacity = capacity;
+    header->reserved.store(0, std::memory_order_relaxed);
+    header->written.store(0, std::memory_order_relaxed);
+    header->lastFrame.store(0, std::memory_order_relaxed);
+    std::memcpy(memory->getData() + sizeof(Header), prefix, prefixSize);
+    ring = memory->getData() + sizeof(Header) + prefixSize;
+
+    // Readers only accept the memory if the magic number is set.
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = magic;
+  }
+}
+
+SharedLogRing::SharedLogRing(const std::string& name) :
+  memory(std::make_unique<SharedMemory>(name))
+{
+  if(memory->getSize() >= sizeof(Header))
+  {
+    Header* header = reinterpret_cast<Header*>(memory->getData());
+    if(header->magic == magic && memory->getSize() >= sizeof(Header) + header->prefixSize + header->capacity)
+    {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      this->header = header;
+      ring = memory->getData() + sizeof(Header) + header->prefixSize;
+      readPosition = header->lastFrame.load(std::memory_order_acquire);
+    }
+  }
+}
+
+void SharedLogRing::copy(std::uint64_t position, void* dest, std::size_t size) const
+{
+  char* dst = static_cast<char*>(dest);
+  while(size > 0)
+  {
+    const std::uint64_t offset = position % header->capacity;
+    const std::size_t bytes = static_cast<std::size_t>(std::min<std::uint64_t>(size, header->capacity - offset));
+    std::memcpy(dst, ring + offset, bytes);
+    dst += bytes;
+    position += bytes;
+    size -= bytes;
+  }
+}
+
+void SharedLogRing::write(const MessageQueue& frame)
+{
+  const MessageQueue::QueueHeader queueHeader = {frame.size(), 0, frame.size() >> 32};
+  const std::uint64_t size = sizeof(queueHeader) + frame.size();
+  if(!header || size > header->capacity / 2)
+    return;
+
+  // Announce the range that is overwritten before actually writing it.
+  const std::uint64_t start = header->written.load(std::memory_order_relaxed);
+  header->reserved.store(start + size, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  OutBinaryRing stream;
+  stream.open(ring, header->capacity, start);
+  stream.write(&queueHeader, sizeof(queueHeader));
+  frame.append(stream);
+
+  header->lastFrame.store(start, std::memory_order_release);
+  header->written.store(start + size, std::memory_order_release);
+}
+
+bool SharedLogRing::read(MessageQueue& frame)
+{
+  if(!header)
+    return false;
+
+  const std::uint64_t written = header->written.load(std::memory_order_acquire);
+  if(readPosition == written)
+    return false;
+  else if(written - readPosition > header->capacity)
+    readPosition = header->lastFrame.load(std::memory_order_acquire);
+
+  // Was data overwritten while it was copied? Then continue with the latest frame.
+  const auto overwritten = [this]
+  {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if(header->reserved.load(std::memory_order_relaxed) - readPosition > header->capacity)
+    {
+      readPosition = header->lastFrame.load(std::memory_order_acquire);
+      return true;
+    }
+    else
+      return false;
+  };
+
+  MessageQueue::QueueHeader queueHeader;
+  copy(readPosition, &queueHeader, sizeof(queueHeader));
+  if(overwritten())
+    return false;
+
+  const std::size_t size = sizeof(queueHeader) + (queueHeader.sizeLow | static_cast<std::size_t>(queueHeader.sizeHigh) << 32);
+  buffer.resize(size);
+  copy(readPosition, buffer.data(), size);
+  if(overwritten())
+    return false;
+
+  readPosition += size;
+  InBinaryMemory stream(buffer.data(), size);
+  stream >> frame;
+  return true;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file SharedLogRing.h
+ *
+ * This file declares a ring buffer in shared memory, through which the
+ * logger publishes the frames it logs to other processes on the same
+ * machine, e.g. a monitoring tool. The ring has a single writer and any
+ * number of readers that never block the writer. Readers that are too
+ * slow lose frames.
+ *
+ * The shared memory starts with a \c Header , followed by a prefix that
+ * contains the same chunks a log file starts with (settings, message ids,
+ * type info) up to, but not including, the log data. The rest is the ring.
+ * Each frame in the ring is stored in the format of a compressed log file
+ * block before it was compressed, i.e. as a complete message queue
+ * including its header.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Platform/SharedMemory.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class MessageQueue;
+
+class SharedLogRing
+{
+  /** The header at the beginning of the shared memory. */
+  struct Header
+  {
+    std::uint32_t magic; /**< Identifies the format of the shared memory. */
+    std::uint32_t prefixSize; /**< The size of the prefix following this header in bytes. */
+    std::uint64_t capacity; /**< The size of the ring in bytes. */
+    std::atomic<std::uint64_t> reserved; /**< The ring is currently written up to (excluding) this position. */
+    std::atomic<std::uint64_t> written; /**< All data up to (excluding) this position is complete. */
+    std::atomic<std::uint64_t> lastFrame; /**< The position of the latest complete frame. */
+  };
+  static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "The positions must be lock-free to be shared between processes.");
+
+  static constexpr std::uint32_t magic = 0x474f4c42; /**< "BLOG" in little endian. */
+
+  std::unique_ptr<SharedMemory> memory; /**< The shared memory block. */
+  Header* header = nullptr; /**< The header in the shared memory. */
+  char* ring = nullptr; /**< The begin of the ring in the shared memory. */
+  std::uint64_t readPosition = 0; /**< The position of the next frame to read (only used by readers). */
+  std::vector<char> buffer; /**< A buffer for the frame read (only used by readers). */
+
+  /**
+   * Copies bytes from the ring, handling the wrap around.
+   * @param position The position of the first byte in the ring.
+   * @param dest The memory the bytes are copied to.
+   * @param size The number of bytes to copy.
+   */
+  void copy(std::uint64_t position, void* dest, std::size_t size) const;
+
+public:
+  /**
+   * Creates the shared memory for writing.
+   * @param name The name of the shared memory. It must start with a slash.
+   * @param capacity The size of the ring in bytes.
+   * @param prefix The beginning of a log file up to, but not including, the log data.
+   * @param prefixSize The size of the prefix in bytes.
+   */
+  SharedLogRing(const std::string& name, std::size_t capacity, const char* prefix, std::size_t prefixSize);
+
+  /**
+   * Opens existing shared memory for reading. Reading starts with the
+   * latest frame written.
+   * @param name The name of the shared memory. It must start with a slash.
+   */
+  SharedLogRing(const std::string& name);
+
+  /**
+   * Could the shared memory be created or opened?
+   * @return Is the ring usable?
+   */
+  bool exists() const {return header != nullptr;}
+
+  /**
+   * Returns the prefix, i.e. the beginning of a log file up to the log data.
+   * A reader needs it to interpret the frames.
+   * @return The address of the prefix. It contains \c getPrefixSize() bytes.
+   */
+  const char* getPrefix() const {return reinterpret_cast<const char*>(header + 1);}
+
+  /**
+   * Returns the size of the prefix.
+   * @return The size in bytes.
+   */
+  std::size_t getPrefixSize() const {return header->prefixSize;}
+
+  /**
+   * Writes a frame to the ring. Frames that are larger than half of the
+   * ring are not written.
+   * @param frame The message queue that contains the frame.
+   */
+  void write(const MessageQueue& frame);
+
+  /**
+   * Reads the next frame from the ring. If the reader was too slow and the
+   * writer has already overwritten it, it continues with the latest frame.
+   * @param frame The messages of the frame are appended to this queue.
+   * @return Was a frame read? If not, no new frame is available yet.
+   */
+  bool read(MessageQueue& frame);
+};
@@ -0,0 +1,72 @@
+/**
+ * @file StartupTrace.cpp
+ *
+ * This file implements functions that record how long the steps of starting
+ * the software take.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "StartupTrace.h"
+#include "Platform/File.h"
+#include "Platform/SystemCall.h"
+#include "Platform/Thread.h"
+#include <cstdio>
+#include <mutex>
+
+namespace StartupTrace
+{
+  static thread_local bool finished = false; /**< Did the current thread finish its first frame? */
+  static const std::chrono::steady_clock::time_point processStart = std::chrono::steady_clock::now(); /**< When was the process started (approximately)? */
+
+  /**
+   * Records a step.
+   * @param category The kind of the step.
+   * @param name The name of the step.
+   * @param start When did the step start?
+   */
+  static void record(const char* category, const std::string& name, std::chrono::steady_clock::time_point start)
+  {
+    static std::mutex mutex;
+    static FILE* file = nullptr;
+    static bool opened = false;
+
+    const auto now = std::chrono::steady_clock::now();
+    const float duration = std::chrono::duration<float, std::milli>(now - start).count();
+    const float end = std::chrono::duration<float, std::milli>(now - processStart).count();
+    const std::string thread = Thread::getCurrentThreadName();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if(!opened)
+    {
+      opened = true;
+      const std::string path = SystemCall::getMode() == SystemCall::physicalRobot
+                               ? std::string("/home/nao/logs/startup.txt")
+                               : std::string(File::getBHDir()) + "/Config/Logs/startup.txt";
+      file = std::fopen(path.c_str(), "w");
+    }
+    std::printf("startup: %s %s %s took %.1f ms, done at %.1f ms\n", thread.c_str(), category, name.c_str(), duration, end);
+    if(file)
+    {
+      std::fprintf(file, "%s\t%s\t%s\t%.1f\t%.1f\n", thread.c_str(), category, name.c_str(), duration, end);
+      std::fflush(file);
+    }
+  }
+
+  Step::Step(const char* category, const char* name) :
+    category(category),
+    name(finished ? "" : name),
+    start(std::chrono::steady_clock::now())
+  {}
+
+  Step::~Step()
+  {
+    if(!name.empty())
+      record(category, name, start);
+  }
+
+  void finishThread()
+  {
+    finished = true;
+  }
+}
@@ -0,0 +1,45 @@
+/**
+ * @file StartupTrace.h
+ *
+ * This file declares functions that record how long the steps of starting
+ * the software take, e.g. constructing modules, loading their parameters,
+ * and the first frame of each thread. Each step is printed to the console
+ * and appended to the file startup.txt in the log directory. A thread only
+ * records steps until it finished its first frame, i.e. modules constructed
+ * later, e.g. after a change of the module configuration, are not traced.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include <chrono>
+#include <string>
+
+namespace StartupTrace
+{
+  /** Measures the wall-clock time of a step from its construction to its destruction. */
+  class Step
+  {
+    const char* category; /**< The kind of the step, e.g. "module". */
+    std::string name; /**< The name of the step. Empty if nothing is recorded. */
+    std::chrono::steady_clock::time_point start; /**< When did the step start? */
+
+  public:
+    /**
+     * Constructor.
+     * @param category The kind of the step, e.g. "module".
+     * @param name The name of the step. It is only copied if the step is recorded.
+     */
+    Step(const char* category, const char* name);
+
+    /** The destructor records the step. */
+    ~Step();
+  };
+
+  /**
+   * Ends the tracing of the current thread. It is called after the
+   * thread finished its first frame.
+   */
+  void finishThread();
+}
@@ -8,10 +8,12 @@
  */
 
 #include "ThreadFrame.h"
+#include "StartupTrace.h"
 #include "Debugging/Debugging.h"
 #include "Platform/File.h"
 #include "Streaming/Global.h"
 #include <asmjit/asmjit.h>
+#include <cstdio>
 
 ThreadFrame::ThreadFrame(const Settings& settings, const std::string& robotName) :
   settings(settings),
@@ -68,6 +70,13 @@ void ThreadFrame::setGlobals()
   Blackboard::setInstance(blackboard); // blackboard is NOT globally accessible
 }
 
+void ThreadFrame::setWorkerGlobals(AnnotationManager& annotationManager, TimingManager& timingManager)
+{
+  setGlobals();
+  Global::theAnnotationManager = &annotationManager;
+  Global::theTimingManager = &timingManager;
+}
+
 void ThreadFrame::threadMain()
 {
   Thread::nameCurrentThread(robotName.empty() ? getName() : (robotName + "." + getName()));
@@ -77,19 +86,44 @@ void ThreadFrame::threadMain()
     setPriority(0);
   else
 #endif
+  {
     setPriority(getPriority());
+    const std::vector<unsigned> cores = Thread::setCurrentAffinity(getAffinity());
+    std::string placement;
+    for(const unsigned core : cores)
+      placement += (placement.empty() ? "" : ",") + std::to_string(core);
+    std::printf("%s: priority %d, cores %s\n", getName().c_str(), getPriority(), placement.empty() ? "unknown" : placement.c_str());
+  }
   Thread::yield(); // always leave processing time to other threads
   setGlobals();
-  init();
+  {
+    StartupTrace::Step step("init", getName().c_str());
+    init();
+  }
+  bool firstFrame = true;
   while(isRunning())
   {
-    while(sem.tryWait());
+    if(futexSemaphore)
+      while(futexSemaphore->tryWait());
+    else
+      while(sem.tryWait());
 
     debugReceiver->receivePacket();
     handleAllMessages(*debugReceiver);
     debugReceiver->clear();
 
-    bool shouldWait = main();
+    bool shouldWait;
+    if(firstFrame)
+    {
+      {
+        StartupTrace::Step step("first frame", getName().c_str());
+        shouldWait = main();
+      }
+      StartupTrace::finishThread();
+      firstFrame = false;
+    }
+    else
+      shouldWait = main();
 
     if(Global::getDebugRequestTable().pollCounter > 0 &&
        --Global::getDebugRequestTable().pollCounter == 0)
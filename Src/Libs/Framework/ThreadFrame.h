@@ -19,6 +19,8 @@
 #include "Debugging/DebugDrawings3D.h"
 #include "Debugging/DebugRequest.h"
 #include "Debugging/TimingManager.h"
+#include "Debugging/Tracer.h"
+#include "Platform/FutexSemaphore.h"
 #include "Platform/SystemCall.h"
 #include "Platform/Thread.h"
 #ifdef TARGET_ROBOT
@@ -26,6 +28,7 @@
 #endif
 
 #include <list>
+#include <memory>
 
 namespace asmjit
 {
@@ -52,6 +55,7 @@ protected:
 
 private:
   Semaphore sem; /**< The semaphore is triggered whenever this thread receives new data. */
+  std::unique_ptr<FutexSemaphore> futexSemaphore; /**< If it exists, it replaces \c sem . */
 
   AnnotationManager annotationManager; /**< Keeps track of the annotations in this thread. */
   Blackboard blackboard; /**< The blackboard of this thread. */
@@ -92,10 +96,26 @@ public:
    */
   void setGlobals();
 
+  /**
+   * The function initializes the pointers in class Global for a worker thread
+   * that executes code on behalf of this thread. The worker shares everything
+   * with this thread, except for the annotations and the timing, which are not
+   * thread-safe.
+   * @param annotationManager The annotation manager of the worker thread.
+   * @param timingManager The timing manager of the worker thread.
+   */
+  void setWorkerGlobals(AnnotationManager& annotationManager, TimingManager& timingManager);
+
   /**
    * The function has to be called to announce the reception of a packet.
    */
-  void trigger() { sem.post(); }
+  void trigger()
+  {
+    if(futexSemaphore)
+      futexSemaphore->post();
+    else
+      sem.post();
+  }
 
   /**
    * The function announces that the thread shall terminate.
@@ -127,6 +147,26 @@ protected:
    */
   virtual int getPriority() const = 0;
 
+  /**
+   * The function determines the cores the thread may run on.
+   *
+   * @return The indices of the cores. If empty, the thread may run on all cores.
+   */
+  virtual std::vector<unsigned> getAffinity() const { return {}; }
+
+  /**
+   * Lets this thread wait for new data with a futex-based semaphore that
+   * spins before it sleeps. Must be called before the thread is started.
+   * @param maxSpinTime The maximum time spent spinning (in µs).
+   */
+  void useFutexSemaphore(unsigned maxSpinTime) { futexSemaphore = std::make_unique<FutexSemaphore>(maxSpinTime); }
+
+  /**
+   * Returns how this thread was woken up. Must only be called by this thread.
+   * @return The statistics or nullptr if the futex-based semaphore is not used.
+   */
+  const FutexSemaphore::Statistics* getWakeUpStatistics() const { return futexSemaphore ? &futexSemaphore->getStatistics() : nullptr; }
+
   /**
    * The function is called once before the first frame. It should be used
    * for things that can't be done in the constructor.
@@ -171,7 +211,15 @@ private:
    */
   void wait()
   {
-    if(SystemCall::getMode() == SystemCall::physicalRobot)
+    Tracer::Scope scope("wait");
+    if(futexSemaphore)
+    {
+      if(SystemCall::getMode() == SystemCall::physicalRobot)
+        futexSemaphore->wait(100);
+      else
+        futexSemaphore->wait();
+    }
+    else if(SystemCall::getMode() == SystemCall::physicalRobot)
       sem.wait(100);
     else
       sem.wait();
@@ -26,41 +26,46 @@ void LutRasterizer::loadOrCreate(const TriangleMesh& object, const Eigen::Aligne
 
 bool LutRasterizer::loadVertexList(const char* filename)
 {
+  if(filename == nullptr)
+    return false;
   FILE* f = fopen(filename, "rb");
   if(f == nullptr)
     return false;
-  for(int idx = 0; idx < static_cast<int>(vertexList.size()); idx++)
+
+  // A table computed for other parameters or another object must not be used,
+  // so the sizes and vertex indices of all entries are checked.
+  bool valid = true;
+  for(int idx = 0; valid && idx < static_cast<int>(vertexList.size()); idx++)
   {
     int ctr;
-    fread(&ctr, sizeof(ctr), 1, f);
-    vertexList[idx].resize(ctr);
-    if(ctr > 0)
-      fread(&vertexList[idx][0], sizeof(vertexList[idx][0]), ctr, f);
-    if(feof(f) || ferror(f))
+    valid = fread(&ctr, sizeof(ctr), 1, f) == 1 && ctr >= 0;
+    if(valid)
     {
-      vertexList.clear();
-      fclose(f);
-      return false;
+      vertexList[idx].resize(ctr);
+      valid = ctr == 0 || fread(vertexList[idx].data(), sizeof(vertexList[idx][0]), ctr, f) == static_cast<size_t>(ctr);
+      for(int i = 0; valid && i < ctr; i++)
+        valid = vertexList[idx][i] == NEWSTART || vertexList[idx][i] < vertexWith1.size();
     }
   }
   char x;
-  if(fread(&x, sizeof(x), 1, f) != 0)
-  {
-    vertexList.clear();
-    return false; // file should have an end
-  }
+  valid &= fread(&x, sizeof(x), 1, f) == 0; // file should have an end
   fclose(f);
-  return true;
+
+  if(!valid)
+    vertexList.assign(vertexList.size(), VertexList()); // Keep the allocation, so the table can be computed instead
+  return valid;
 }
 
 void LutRasterizer::saveVertexList(const char* filename) const
 {
   FILE* f = fopen(filename, "wb");
+  if(f == nullptr)
+    return; // The table is only a cache, so it is simply computed again next time
   for(int idx = 0; idx < static_cast<int>(vertexList.size()); idx++)
   {
     int ctr = static_cast<int>(vertexList[idx].size());
     fwrite(&ctr, sizeof(ctr), 1, f);
-    fwrite(&vertexList[idx][0], sizeof(vertexList[idx][0]), ctr, f);
+    fwrite(vertexList[idx].data(), sizeof(vertexList[idx][0]), ctr, f);
   }
   fclose(f);
 }
@@ -89,7 +89,8 @@ public:
   void create(const TriangleMesh& object, const Eigen::AlignedBox3d& viewpointRange, double spacing);
 
   //! Same as \c create but tries to load and saves the look-up-table in \c filename
-  /*! Note: At the moment the user has to take care to delete \c filename the parameters have been changed.
+  /*! A file whose number of entries or vertex indices do not match the table is recomputed and
+      saved again. Otherwise, the user has to take care to delete \c filename if the parameters have been changed.
       If \c filename is \c nullptr, the table is neither loaded nor saved.
    */
   void loadOrCreate(const TriangleMesh& object, const Eigen::AlignedBox3d& viewpointRange, double spacing, const char* filename = nullptr);
@@ -223,6 +224,8 @@ public:
 
   //! Tries to load \c vertexList from \c filename
   /*! \c vertexList must already be allocated and all parameter set. If loading fails, \c false is returned.
+      This also happens if the file does not match the size of the table or refers to vertices
+      \c object does not have. In that case, \c vertexList is still allocated, but empty.
    */
   bool loadVertexList(const char* filename);
 
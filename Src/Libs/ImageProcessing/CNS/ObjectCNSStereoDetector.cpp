@@ -109,10 +109,10 @@ void ObjectCNSStereoDetector::renderBlockAllPoses(Contour& ct,
 
 void ObjectCNSStereoDetector::searchBlockAllPoses(IsometryWithResponses& object2WorldList,
     const Image<CNSResponse>& cns,
-    int x, int y) const
+    int x, int y, int blockX, int blockY) const
 {
   Eigen::Vector3d p, v;
-  camera.image2WorldRay(x + spec.blockX / 2, y + spec.blockY / 2, p, v);
+  camera.image2WorldRay(x + blockX / 2, y + blockY / 2, p, v);
   double minLambda, maxLambda;
   spec.positionSpace.intersectWithRay(minLambda, maxLambda, p, v);
   if(!(minLambda <= maxLambda))
@@ -130,7 +130,7 @@ void ObjectCNSStereoDetector::searchBlockAllPoses(IsometryWithResponses& object2
       IsometryWithResponse result;
       if(object2WorldList.size() == static_cast<size_t>(spec.nResponses))
         result.response = object2WorldList.back().response;
-      if(searchBlockFixedPose(result, cns, object2World))
+      if(searchBlockFixedPose(result, cns, object2World, blockX, blockY))
         addToList(object2WorldList, result, spec.nResponses);
     }
 
@@ -158,10 +158,11 @@ void ObjectCNSStereoDetector::renderBlockFixedPose(Contour& ct,
 
 bool ObjectCNSStereoDetector::searchBlockFixedPose(IsometryWithResponse& object2World,
     const Image<CNSResponse>& cns,
-    const Eigen::Isometry3d& object2WorldTry) const
+    const Eigen::Isometry3d& object2WorldTry,
+    int blockX, int blockY) const
 {
   int maxVal = 0, argMaxX = 0, argMaxY = 0;
-  responseXYMax(maxVal, argMaxX, argMaxY, cns, object2WorldTry, spec.blockX, spec.blockY);
+  responseXYMax(maxVal, argMaxX, argMaxY, cns, object2WorldTry, blockX, blockY);
   double maxF = LinearResponseMapping().finalBin2FinalFloat(static_cast<short>(maxVal));
 
   if(maxF > object2World.response)
@@ -150,7 +150,18 @@ public:
    */
   void searchBlockAllPoses(IsometryWithResponses& object2WorldList,
                            const Image<CNSResponse>& cns,
-                           int x, int y) const;
+                           int x, int y) const
+  {
+    searchBlockAllPoses(object2WorldList, cns, x, y, spec.blockX, spec.blockY);
+  }
+
+  //! Same as above, but with a block size that overrides \c spec.blockX and \c spec.blockY
+  /*! Since the search specification is not changed, searches of different blocks
+      can run concurrently on the same detector.
+   */
+  void searchBlockAllPoses(IsometryWithResponses& object2WorldList,
+                           const Image<CNSResponse>& cns,
+                           int x, int y, int blockX, int blockY) const;
 
   //! Search for a single object pose \c object2WorldTry with a block of image translation
   /*! \c object is rasterized with the pose \c object2WorldTry and the resulting
@@ -166,7 +177,16 @@ public:
    */
   bool searchBlockFixedPose(IsometryWithResponse& object2World,
                             const Image<CNSResponse>& cns,
-                            const Eigen::Isometry3d& object2WorldTry) const;
+                            const Eigen::Isometry3d& object2WorldTry) const
+  {
+    return searchBlockFixedPose(object2World, cns, object2WorldTry, spec.blockX, spec.blockY);
+  }
+
+  //! Same as above, but with a block size that overrides \c spec.blockX and \c spec.blockY
+  bool searchBlockFixedPose(IsometryWithResponse& object2World,
+                            const Image<CNSResponse>& cns,
+                            const Eigen::Isometry3d& object2WorldTry,
+                            int blockX, int blockY) const;
 
   //! Renders the object in all poses searched for into \c ct for visualization of the search space
   /*! Actually the same contour is searched for in different translations according to
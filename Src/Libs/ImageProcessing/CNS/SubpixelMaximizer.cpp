@@ -39,7 +39,7 @@ SubpixelMaximizer::FitMatrix::FitMatrix()
 void SubpixelMaximizer::fitUsingSSE3(float coef[FitMatrix::ROWS], const signed short data[3][3][3]) const
 {
   assert(FitMatrix::PADDEDCOLS == 32);
-  __m128 localFitMatrixScale = _mm_set_ss(fitMatrix.scale);
+  const __m128 localFitMatrixScale = _mm_set1_ps(fitMatrix.scale);
   const short* localFitMatrix = fitMatrix();
   // Load data into four SSE Registers
   __m128i x[4];
@@ -50,18 +50,25 @@ void SubpixelMaximizer::fitUsingSSE3(float coef[FitMatrix::ROWS], const signed s
   x[3] = _mm_loadu_si128((__m128i*)(dataFlat + 24));
   x[3] = _mm_srli_si128(_mm_slli_si128(x[3], 10), 10);   // Clear dataFlat[27..31]
 
-  for(int i = 0; i < FitMatrix::ROWS; i++)
+  // Compute four partial sums of the scalar product between ((float*)x)[0..31] and row i of localFitMatrix
+  auto partialSums = [&](int i)
   {
-    // Compute scalar product between ((float*)x)[0..31] and localFitMatrix
-    __m128i sum =             _mm_madd_epi16(x[0], *(__m128i*)(localFitMatrix + 0));
-    sum = _mm_add_epi32(sum, _mm_madd_epi16(x[1], *(__m128i*)(localFitMatrix + 8)));
-    sum = _mm_add_epi32(sum, _mm_madd_epi16(x[2], *(__m128i*)(localFitMatrix + 16)));
-    sum = _mm_add_epi32(sum, _mm_madd_epi16(x[3], *(__m128i*)(localFitMatrix + 24)));
-    sum = _mm_hadd_epi32(sum, sum);
-    sum = _mm_hadd_epi32(sum, sum);
-    _mm_store_ss(coef + i, _mm_mul_ss(_mm_cvtepi32_ps(sum), localFitMatrixScale));
-    localFitMatrix += 32;
+    const short* row = localFitMatrix + i * FitMatrix::PADDEDCOLS;
+    __m128i sum =             _mm_madd_epi16(x[0], *(__m128i*)(row + 0));
+    sum = _mm_add_epi32(sum, _mm_madd_epi16(x[1], *(__m128i*)(row + 8)));
+    sum = _mm_add_epi32(sum, _mm_madd_epi16(x[2], *(__m128i*)(row + 16)));
+    return _mm_add_epi32(sum, _mm_madd_epi16(x[3], *(__m128i*)(row + 24)));
+  };
+
+  // The partial sums of four rows are added horizontally, converted, and scaled together.
+  alignas(16) float result[(FitMatrix::ROWS + 3) & ~3];
+  for(int i = 0; i < FitMatrix::ROWS; i += 4)
+  {
+    const __m128i sum01 = _mm_hadd_epi32(partialSums(i), partialSums(i + 1));
+    const __m128i sum23 = i + 2 < FitMatrix::ROWS ? _mm_hadd_epi32(partialSums(i + 2), partialSums(i + 3)) : _mm_setzero_si128();
+    _mm_store_ps(result + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_hadd_epi32(sum01, sum23)), localFitMatrixScale));
   }
+  memcpy(coef, result, FitMatrix::ROWS * sizeof(float));
 }
 
 void SubpixelMaximizer::fitUsingC(float coef[10], const signed short data[3][3][3]) const
@@ -10,7 +10,9 @@
 #include "ImageProcessing/PixelTypes.h"
 #include "Math/Eigen.h"
 #include "Platform/BHAssert.h"
+#include "Platform/Memory.h"
 #include "Streaming/Streamable.h"
+#include <type_traits>
 #include <vector>
 
 /**
@@ -25,7 +27,7 @@ public:
   unsigned int height;
 
 private:
-  std::vector<unsigned char> allocator;
+  std::vector<unsigned char, Memory::LargeAllocator<unsigned char, Memory::images>> allocator; /**< The memory of the image. Might be backed by huge pages. */
 
 protected:
   Pixel* image; /**< A pointer to the memory for the image */
@@ -79,10 +81,10 @@ public:
     this->height = height;
 
     if(allocator.size() < width * height * sizeof(Pixel) + padding * 2)
-    {
-      allocator.resize(width * height * sizeof(Pixel) + 31 + padding * 2);
-      image = reinterpret_cast<Pixel*>(reinterpret_cast<ptrdiff_t>(allocator.data() + 31 + padding) & (~ptrdiff_t(31)));
-    }
+      allocator.resize(width * height * sizeof(Pixel) + Memory::cacheLineSize - 1 + padding * 2);
+
+    // Always set the pointer, because a derived class might have let it reference external memory.
+    image = reinterpret_cast<Pixel*>(reinterpret_cast<ptrdiff_t>(allocator.data() + Memory::cacheLineSize - 1 + padding) & (~ptrdiff_t(Memory::cacheLineSize - 1)));
   }
 
 protected:
@@ -124,6 +126,100 @@ using GrayscaledImage = Image<PixelTypes::GrayscaledPixel>;
 using YUYVImage = Image<PixelTypes::YUYVPixel>;
 using BGRAPixel = Image<PixelTypes::BGRAPixel>;
 
+/**
+ * A rectangular region of an image that does not own its pixels. The rows
+ * of a view do not have to follow each other directly in memory, so crops of
+ * an image can be processed without copying them. A view of constant pixels
+ * has a const-qualified pixel type. The image viewed must outlive the view.
+ */
+template<typename Pixel>
+class ImageView
+{
+public:
+  using PixelType = Pixel;
+  unsigned int width = 0;
+  unsigned int height = 0;
+  size_t stride = 0; /**< The distance between the beginnings of two consecutive rows in pixels. */
+
+private:
+  Pixel* image = nullptr; /**< The first pixel of the first row. */
+
+public:
+  ImageView() = default;
+
+  /**
+   * Constructor for a view of external memory.
+   * @param width The width of the view in pixels.
+   * @param height The height of the view in pixels.
+   * @param image The first pixel of the first row.
+   * @param stride The distance between the beginnings of two consecutive rows in pixels.
+   */
+  ImageView(const unsigned int width, const unsigned int height, Pixel* image, const size_t stride) :
+    width(width), height(height), stride(stride), image(image)
+  {
+    ASSERT(stride >= width);
+  }
+
+  /**
+   * Constructor for a view of a whole image. It allows to pass images to
+   * functions that expect views.
+   * @param image The image viewed.
+   */
+  ImageView(Image<std::remove_const_t<Pixel>>& image) :
+    width(image.width), height(image.height), stride(image.width), image(image.width && image.height ? image[0] : nullptr) {}
+
+  /**
+   * Constructor for a read-only view of a whole image.
+   * @param image The image viewed.
+   */
+  ImageView(const Image<std::remove_const_t<Pixel>>& image) requires std::is_const_v<Pixel> :
+    width(image.width), height(image.height), stride(image.width), image(image.width && image.height ? image[0] : nullptr) {}
+
+  /**
+   * Converts a view of mutable pixels into a read-only view.
+   * @param other The view converted.
+   */
+  template<typename OtherPixel>
+  ImageView(const ImageView<OtherPixel>& other) requires std::is_const_v<Pixel> && std::is_same_v<OtherPixel, std::remove_const_t<Pixel>> :
+    width(other.width), height(other.height), stride(other.stride), image(other.width && other.height ? other[0] : nullptr) {}
+
+  Pixel* operator[](const size_t y) const { return image + y * stride; }
+  Pixel& operator[](const Vector2s& p) const { return image[p.y() * stride + p.x()]; }
+  Pixel& operator[](const Vector2i& p) const { return image[p.y() * stride + p.x()]; }
+
+  /**
+   * Get the pixel at x,y. No boundary check!
+   *
+   * @param x The x coordinate.
+   * @param y The y coordinate.
+   * @return The requested pixel.
+   */
+  Pixel& operator()(const size_t x, const size_t y) const { return image[y * stride + x]; }
+
+  /**
+   * Returns a view of a rectangular region of this view without copying it.
+   * @param x The left border of the region in this view.
+   * @param y The upper border of the region in this view.
+   * @param width The width of the region. It must fit into this view.
+   * @param height The height of the region. It must fit into this view.
+   * @return The view of the region.
+   */
+  ImageView subView(const unsigned int x, const unsigned int y, const unsigned int width, const unsigned int height) const
+  {
+    ASSERT(x + width <= this->width && y + height <= this->height);
+    return ImageView(width, height, image + y * stride + x, stride);
+  }
+
+  /**
+   * Are the rows of this view consecutive in memory, i.e. can it be processed
+   * as a single block of pixels?
+   * @return Are they?
+   */
+  bool isContiguous() const { return stride == width || height <= 1; }
+};
+
+using GrayscaledImageView = ImageView<const PixelTypes::GrayscaledPixel>;
+
 template<typename Pixel>
 class ImageWrapper : public Image<Pixel>
 {
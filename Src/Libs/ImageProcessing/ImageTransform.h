@@ -21,8 +21,8 @@ namespace ImageTransform
     return _mm_setr_ps(v0, v1, v2, v3);
   }
 
-  template<typename T>
-  ALWAYSINLINE static __m128 getPixel(const Image<T>& src, __m128 x_x_x_x_Dash, __m128 y_y_y_y_Dash, float defaultValue = 0.f)
+  template<typename SrcImage>
+  ALWAYSINLINE static __m128 getPixel(const SrcImage& src, __m128 x_x_x_x_Dash, __m128 y_y_y_y_Dash, float defaultValue = 0.f)
   {
     int32_t xCoordinates[4];
     int32_t yCoordinates[4];
@@ -93,7 +93,7 @@ namespace ImageTransform
   }
 
   // writes the result of the affine transformation into dest, which has to be a buffer with a sufficient large size
-  void transform(const Image<PixelTypes::GrayscaledPixel>& src, float* destP, unsigned int dest_width, unsigned int dest_height, const Matrix3f& inverseTransformation, const Vector2f& relativeTransformationCenter = Vector2f(0.5f, 0.5f), const float defaultValue = 0.f)
+  void transform(const GrayscaledImageView& src, float* destP, unsigned int dest_width, unsigned int dest_height, const Matrix3f& inverseTransformation, const Vector2f& relativeTransformationCenter = Vector2f(0.5f, 0.5f), const float defaultValue = 0.f)
   {
     const __m128 a0 = _mm_set1_ps(inverseTransformation(0, 0));
     const __m128 a1 = _mm_set1_ps(inverseTransformation(0, 1));
@@ -1,5 +1,7 @@
 #include "LabelImage.h"
+#include "Math/BHMath.h"
 #include <algorithm>
+#include <cmath>
 
 bool LabelImage::Annotation::isInside(const Annotation& annotation) const
 {
@@ -32,42 +34,101 @@ float LabelImage::Annotation::getIou(const Annotation& annotation) const
   return intersection / (getArea() + annotation.getArea() - intersection + 1e-6f);
 }
 
+std::vector<std::size_t> LabelImage::sortByLeftEdge(std::vector<float>& left, std::vector<float>& right) const
+{
+  std::vector<std::size_t> order(annotations.size());
+  for(std::size_t i = 0; i < order.size(); ++i)
+    order[i] = i;
+  std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {return annotations[a].upperLeft.x() < annotations[b].upperLeft.x();});
+
+  left.resize(order.size());
+  right.resize(order.size());
+  for(std::size_t i = 0; i < order.size(); ++i)
+  {
+    left[i] = annotations[order[i]].upperLeft.x();
+    right[i] = annotations[order[i]].lowerRight.x();
+  }
+  return order;
+}
+
+void LabelImage::removeSuppressed(const std::vector<bool>& suppressed)
+{
+  std::size_t numOfKept = 0;
+  for(std::size_t i = 0; i < annotations.size(); ++i)
+    if(!suppressed[i])
+      annotations[numOfKept++] = annotations[i];
+  annotations.resize(numOfKept);
+}
+
 void LabelImage::nonMaximumSuppression(float threshold)
 {
-  std::vector<Annotation> maximumAnnotations;
-  for(const Annotation& annotation : annotations)
+  std::vector<bool> suppressed(annotations.size(), false);
+  if(threshold < 0.f)
   {
-    bool best = true;
-    for(const Annotation& cmp : annotations)
-    {
-      if((annotation.getIou(cmp) > threshold && annotation < cmp))
+    // Even boxes that do not overlap have an IoU above the threshold.
+    // Therefore, only the boxes with the highest confidence survive.
+    const auto best = std::max_element(annotations.begin(), annotations.end());
+    for(std::size_t i = 0; i < annotations.size(); ++i)
+      suppressed[i] = annotations[i] < *best;
+  }
+  else
+  {
+    // Boxes that do not overlap horizontally have an IoU of 0. Therefore, only
+    // pairs are checked of which the second box starts before the first one ends.
+    std::vector<float> left;
+    std::vector<float> right;
+    const std::vector<std::size_t> order = sortByLeftEdge(left, right);
+    for(std::size_t i = 0; i < order.size(); ++i)
+      for(std::size_t j = i + 1; j < order.size() && left[j] < right[i]; ++j)
       {
-        best = false;
-        break;
+        const Annotation& a = annotations[order[i]];
+        const Annotation& b = annotations[order[j]];
+        if(a.getIou(b) > threshold)
+        {
+          if(a < b)
+            suppressed[order[i]] = true;
+          else if(b < a)
+            suppressed[order[j]] = true;
+        }
       }
-    }
-    if(best)
-      maximumAnnotations.push_back(annotation);
   }
-  annotations = maximumAnnotations;
+  removeSuppressed(suppressed);
 }
 
-void LabelImage::bigBoxSuppression()
+void LabelImage::softNonMaximumSuppression(float sigma, float threshold)
 {
-  std::vector<Annotation> smallerAnnotations;
-  for(const Annotation& annotation : annotations)
+  std::vector<Annotation> remaining = annotations;
+  annotations.clear();
+  while(!remaining.empty())
   {
-    bool best = true;
-    for(const Annotation& cmp : annotations)
+    const auto best = std::max_element(remaining.begin(), remaining.end());
+    annotations.push_back(*best);
+    *best = remaining.back();
+    remaining.pop_back();
+
+    const Annotation& selected = annotations.back();
+    std::size_t numOfKept = 0;
+    for(Annotation& annotation : remaining)
     {
-      if(annotation.isInside(cmp))
-      {
-        best = false;
-        break;
-      }
+      annotation.confidence *= std::exp(-sqr(selected.getIou(annotation)) / sigma);
+      if(annotation.confidence >= threshold)
+        remaining[numOfKept++] = annotation;
     }
-    if(best)
-      smallerAnnotations.push_back(annotation);
+    remaining.resize(numOfKept);
   }
-  annotations = smallerAnnotations;
+}
+
+void LabelImage::bigBoxSuppression()
+{
+  // A box can only be inside another one if its left edge is right of the
+  // left edge of the other one and left of its right edge.
+  std::vector<bool> suppressed(annotations.size(), false);
+  std::vector<float> left;
+  std::vector<float> right;
+  const std::vector<std::size_t> order = sortByLeftEdge(left, right);
+  for(std::size_t i = 0; i < order.size(); ++i)
+    for(std::size_t j = i + 1; j < order.size() && left[j] < right[i]; ++j)
+      if(annotations[order[i]].isInside(annotations[order[j]]))
+        suppressed[order[i]] = true;
+  removeSuppressed(suppressed);
 }
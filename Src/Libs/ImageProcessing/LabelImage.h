@@ -28,14 +28,41 @@ struct LabelImage
 
   /**
    * If bounding boxes overlap with an intersection over union score above the threshold,
-   * remove all bounding boxes with non-maximal prediction confodence
+   * remove all bounding boxes with non-maximal prediction confodence.
+   * All boxes must have a positive width.
    * @param threshold
    */
   void nonMaximumSuppression(float threshold = 0.7f);
+
+  /**
+   * Soft non-maximum suppression (Bodla et al., 2017). The boxes are selected in the
+   * order of their confidences. The confidences of the remaining boxes are reduced
+   * by a Gaussian of their intersection over union with the box selected.
+   * @param sigma The variance of the Gaussian.
+   * @param threshold Boxes whose confidences drop below this threshold are removed.
+   */
+  void softNonMaximumSuppression(float sigma = 0.5f, float threshold = 0.5f);
+
   /**
    * Remove bounding boxes that are inside another bounding box.
+   * All boxes must have a positive width.
    */
   void bigBoxSuppression();
 
   std::vector<Annotation> annotations;
+
+private:
+  /**
+   * Sorts the annotations by their left edges.
+   * @param left The left edges in the sorted order are returned here.
+   * @param right The right edges in the sorted order are returned here.
+   * @return The indices of the annotations in the sorted order.
+   */
+  std::vector<std::size_t> sortByLeftEdge(std::vector<float>& left, std::vector<float>& right) const;
+
+  /**
+   * Removes annotations, keeping the order of the others.
+   * @param suppressed For each annotation, whether it should be removed.
+   */
+  void removeSuppressed(const std::vector<bool>& suppressed);
 };
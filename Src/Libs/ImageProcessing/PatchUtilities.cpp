@@ -6,8 +6,12 @@
 
 #include "PatchUtilities.h"
 #include "ImageProcessing/ImageTransform.h"
+#include "ImageProcessing/SIMD.h"
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <cmath>
+#include <vector>
 
 Matrix3f PatchUtilities::calcInverseTransformation(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize)
 {
@@ -29,7 +33,7 @@ Matrix3f PatchUtilities::calcInverseTransformation(const Vector2i& center, const
 
 
 template<typename OutType>
-void PatchUtilities::getInterpolatedImageSection(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImage& src, OutType* output)
+void PatchUtilities::getInterpolatedImageSection(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImageView& src, OutType* output)
 {
   Matrix3f inverseTransformation = calcInverseTransformation(center, inSize, outSize);
 
@@ -45,7 +49,7 @@ void PatchUtilities::getInterpolatedImageSection(const Vector2i& center, const V
 }
 
 template<typename OutType, bool interpolate>
-void PatchUtilities::getImageSection(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImage& src, OutType* output)
+void PatchUtilities::getImageSection(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImageView& src, OutType* output)
 {
   const Vector2i upperLeft = (center.array() - inSize.array() / 2).matrix();
   const Vector2f stepSize = (inSize.cast<float>().array() / outSize.cast<float>().array()).matrix();
@@ -186,16 +190,35 @@ void PatchUtilities::normalizeContrast(GrayscaledImage& output, const float perc
 template<typename OutType>
 void PatchUtilities::normalizeContrast(OutType* output, const Vector2i& size, const float percent)
 {
-  Eigen::Map<Eigen::Matrix<OutType, Eigen::Dynamic, Eigen::Dynamic>> patch(output, size.x(), size.y());
-  Eigen::Matrix<OutType, Eigen::Dynamic, 1> sorted = Eigen::Map<Eigen::Matrix<OutType, Eigen::Dynamic, 1>>(patch.data(), size.x() * size.y());
-  std::sort(sorted.data(), sorted.data() + sorted.size());
+  const std::size_t numOfPixels = static_cast<std::size_t>(size.x() * size.y());
+  if(numOfPixels == 0)
+    return;
 
-  OutType min = sorted(static_cast<int>((sorted.size() - 1) * percent));
-  OutType max = sorted(static_cast<int>((sorted.size() - 1) * (1.f - percent)));
-  if(max == 0)
-    patch.setConstant(0);
+  OutType min, max;
+  getOrderStatistics(output, numOfPixels, static_cast<std::size_t>((numOfPixels - 1) * percent),
+                     static_cast<std::size_t>((numOfPixels - 1) * (1.f - percent)), min, max);
+  if(max == 0 || max == min)
+    std::fill_n(output, numOfPixels, static_cast<OutType>(0));
+  else if constexpr(std::is_same<OutType, unsigned char>::value)
+  {
+    std::array<unsigned char, 256> lookup;
+    for(int i = 0; i < 256; ++i)
+      lookup[i] = static_cast<unsigned char>(static_cast<float>(std::clamp(static_cast<unsigned char>(i), min, max) - min) * 255.f / static_cast<float>(max - min));
+    for(unsigned char* p = output, * pEnd = output + numOfPixels; p < pEnd; ++p)
+      *p = lookup[*p];
+  }
   else
-    patch.array() = ((patch.array().max(min).min(max) - min).template cast<float>() * 255.f / (static_cast<float>(max - min))).template cast<OutType>();
+  {
+    const __m128 minValue = _mm_set1_ps(min);
+    const __m128 maxValue = _mm_set1_ps(max);
+    const __m128 range = _mm_set1_ps(max - min);
+    const __m128 maxOutput = _mm_set1_ps(255.f);
+    float* p = output;
+    for(float* pEnd = output + (numOfPixels & ~static_cast<std::size_t>(3)); p < pEnd; p += 4)
+      _mm_storeu_ps(p, _mm_div_ps(_mm_mul_ps(_mm_sub_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(p), minValue), maxValue), minValue), maxOutput), range));
+    for(float* pEnd = output + numOfPixels; p < pEnd; ++p)
+      *p = (std::clamp(*p, min, max) - min) * 255.f / (max - min);
+  }
 }
 
 template void PatchUtilities::normalizeContrast<float>(float* output, const Vector2i& size, const float percent);
@@ -204,32 +227,96 @@ template void PatchUtilities::normalizeContrast<unsigned char>(unsigned char* ou
 template<typename OutType>
 void PatchUtilities::normalizeBrightness(OutType* output, const Vector2i& size, const float percent)
 {
-  Eigen::Map<Eigen::Matrix<OutType, Eigen::Dynamic, Eigen::Dynamic>> patch(output, size.x(), size.y());
-  Eigen::Matrix<OutType, Eigen::Dynamic, 1> sorted = Eigen::Map<Eigen::Matrix<OutType, Eigen::Dynamic, 1>>(patch.data(), size.x() * size.y());
-  if(sorted.size() == 0)
+  const std::size_t numOfPixels = static_cast<std::size_t>(size.x() * size.y());
+  if(numOfPixels == 0)
     return;
 
-  std::partial_sort(sorted.data(), sorted.data() + static_cast<size_t>((sorted.size() - 1) * percent) + 1,
-                    sorted.data() + sorted.size(), std::greater<>());
-
-  OutType max = sorted(static_cast<int>((sorted.size() - 1) * percent));
+  // The value that is exceeded by the given ratio of all pixels.
+  const std::size_t rank = numOfPixels - 1 - static_cast<std::size_t>((numOfPixels - 1) * percent);
+  OutType max, unused;
+  getOrderStatistics(output, numOfPixels, rank, rank, max, unused);
   if(max == 0)
-    patch.setConstant(0);
+    std::fill_n(output, numOfPixels, static_cast<OutType>(0));
+  else if constexpr(std::is_same<OutType, unsigned char>::value)
+  {
+    std::array<unsigned char, 256> lookup;
+    for(int i = 0; i < 256; ++i)
+      lookup[i] = static_cast<unsigned char>(static_cast<float>(std::min(static_cast<unsigned char>(i), max)) * 255.f / static_cast<float>(max));
+    for(unsigned char* p = output, * pEnd = output + numOfPixels; p < pEnd; ++p)
+      *p = lookup[*p];
+  }
   else
-    patch.array() = (patch.array().min(max).template cast<float>() * 255.f / static_cast<float>(max)).template cast<OutType>();
+  {
+    const __m128 maxValue = _mm_set1_ps(max);
+    const __m128 maxOutput = _mm_set1_ps(255.f);
+    float* p = output;
+    for(float* pEnd = output + (numOfPixels & ~static_cast<std::size_t>(3)); p < pEnd; p += 4)
+      _mm_storeu_ps(p, _mm_div_ps(_mm_mul_ps(_mm_min_ps(_mm_loadu_ps(p), maxValue), maxOutput), maxValue));
+    for(float* pEnd = output + numOfPixels; p < pEnd; ++p)
+      *p = std::min(*p, max) * 255.f / max;
+  }
 }
 
 template void PatchUtilities::normalizeBrightness<float>(float* output, const Vector2i& size, const float percent);
 template void PatchUtilities::normalizeBrightness<unsigned char>(unsigned char* output, const Vector2i& size, const float percent);
 
-void PatchUtilities::extractPatch(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImage& src, GrayscaledImage& dest, const ExtractionMode mode)
+void PatchUtilities::getOrderStatistics(const unsigned char* data, std::size_t size, std::size_t lowRank, std::size_t highRank,
+                                        unsigned char& low, unsigned char& high)
+{
+  // Four interleaved histograms avoid stalls when neighboring pixels have the same value.
+  std::array<std::array<unsigned, 256>, 4> histograms{};
+  const unsigned char* p = data;
+  for(const unsigned char* pEnd = data + (size & ~static_cast<std::size_t>(3)); p < pEnd; p += 4)
+  {
+    ++histograms[0][p[0]];
+    ++histograms[1][p[1]];
+    ++histograms[2][p[2]];
+    ++histograms[3][p[3]];
+  }
+  for(const unsigned char* pEnd = data + size; p < pEnd; ++p)
+    ++histograms[0][*p];
+
+  std::size_t count = 0;
+  bool lowFound = false;
+  for(int i = 0; i < 256; ++i)
+  {
+    count += histograms[0][i] + histograms[1][i] + histograms[2][i] + histograms[3][i];
+    if(!lowFound && count > lowRank)
+    {
+      low = static_cast<unsigned char>(i);
+      lowFound = true;
+    }
+    if(count > highRank)
+    {
+      high = static_cast<unsigned char>(i);
+      if(lowFound)
+        return;
+    }
+  }
+}
+
+void PatchUtilities::getOrderStatistics(const float* data, std::size_t size, std::size_t lowRank, std::size_t highRank,
+                                        float& low, float& high)
+{
+  thread_local std::vector<float> values;
+  values.assign(data, data + size);
+  std::nth_element(values.begin(), values.begin() + lowRank, values.end());
+  low = values[lowRank];
+  if(highRank >= lowRank)
+    std::nth_element(values.begin() + lowRank, values.begin() + highRank, values.end());
+  else
+    std::nth_element(values.begin(), values.begin() + highRank, values.begin() + lowRank);
+  high = values[highRank];
+}
+
+void PatchUtilities::extractPatch(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImageView& src, GrayscaledImage& dest, const ExtractionMode mode)
 {
   dest.setResolution(static_cast<unsigned int>(outSize(0)), static_cast<unsigned int>(outSize(1)));
   extractPatch(center, inSize, outSize, src, dest[0], mode);
 }
 
 template<typename OutType>
-void PatchUtilities::extractPatch(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImage& src, OutType* dest, const ExtractionMode mode)
+void PatchUtilities::extractPatch(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImageView& src, OutType* dest, const ExtractionMode mode)
 {
   switch (mode)
   {
@@ -245,8 +332,8 @@ void PatchUtilities::extractPatch(const Vector2i& center, const Vector2i& inSize
   }
 }
 
-template void PatchUtilities::extractPatch<float>(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImage& src, float* dest, const ExtractionMode mode);
-template void PatchUtilities::extractPatch<unsigned char>(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImage& src, unsigned char* dest, const ExtractionMode mode);
+template void PatchUtilities::extractPatch<float>(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImageView& src, float* dest, const ExtractionMode mode);
+template void PatchUtilities::extractPatch<unsigned char>(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImageView& src, unsigned char* dest, const ExtractionMode mode);
 
 template<typename OutType, bool grayscale>
 void PatchUtilities::extractInput(const YUYVImage& cameraImage, const Vector2i& patchSize, OutType* input)
@@ -28,9 +28,14 @@ public:
   static void normalizeBrightness(OutType* output, const Vector2i& size, const float percent = 0.02f);
   static void normalizeBrightness(GrayscaledImage& output, const float percent = 0.02f);
 
+  /**
+   * Extracts a patch from an image and scales it to a certain size. The source
+   * can be a view of a part of an image. In that case, the center is relative to
+   * the view and pixels outside of it are treated as being outside of the image.
+   */
   template<typename OutType>
-  static void extractPatch(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImage& src, OutType* dest, const ExtractionMode mode = fast);
-  static void extractPatch(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImage& src, GrayscaledImage& dest, const ExtractionMode mode = fast);
+  static void extractPatch(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImageView& src, OutType* dest, const ExtractionMode mode = fast);
+  static void extractPatch(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImageView& src, GrayscaledImage& dest, const ExtractionMode mode = fast);
 
   // This methods only work correctly if the image dimensions are multiples of the patch size.
   template<typename OutType, bool grayscale>
@@ -39,10 +44,25 @@ public:
 
 private:
   template<typename OutType, bool interpolate = false>
-  static void getImageSection(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImage& src, OutType* output);
+  static void getImageSection(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImageView& src, OutType* output);
 
   template<typename OutType>
-  static void getInterpolatedImageSection(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImage& src, OutType* output);
+  static void getInterpolatedImageSection(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize, const GrayscaledImageView& src, OutType* output);
 
   static Matrix3f calcInverseTransformation(const Vector2i& center, const Vector2i& inSize, const Vector2i& outSize);
+
+  /**
+   * Determines two order statistics of a patch in a single pass over its pixels.
+   * For unsigned chars, a histogram is used. Otherwise, the values are partially sorted.
+   * @param data The pixels of the patch. They are not changed.
+   * @param size The number of pixels.
+   * @param lowRank The rank (index in ascending order) of the first value to determine.
+   * @param highRank The rank of the second value to determine.
+   * @param low The value with the rank \c lowRank.
+   * @param high The value with the rank \c highRank.
+   */
+  static void getOrderStatistics(const unsigned char* data, std::size_t size, std::size_t lowRank, std::size_t highRank,
+                                 unsigned char& low, unsigned char& high);
+  static void getOrderStatistics(const float* data, std::size_t size, std::size_t lowRank, std::size_t highRank,
+                                 float& low, float& high);
 };
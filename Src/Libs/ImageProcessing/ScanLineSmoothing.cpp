@@ -0,0 +1,58 @@
+/**
+ * @file ScanLineSmoothing.cpp
+ *
+ * Functions to smooth consecutive pixels of a grayscale image row with a
+ * vertical binomial filter, as required when scanning horizontal scan lines
+ * for edges.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "ScanLineSmoothing.h"
+#include "ImageProcessing/SIMD.h"
+
+template<int filterSize>
+void ScanLineSmoothing::smoothVertically(const Image<PixelTypes::GrayscaledPixel>& image, unsigned int x, unsigned int y, unsigned int count, int* dest)
+{
+  static_assert(filterSize == 3 || filterSize == 5);
+  const std::ptrdiff_t width = image.width;
+  const PixelTypes::GrayscaledPixel* p = &image[y][x];
+  const __m128i zero = _mm_setzero_si128();
+
+  // The sums fit into 16 bits (at most 10 * 255), so 8 pixels are processed at once.
+  for(const PixelTypes::GrayscaledPixel* pEnd = p + (count & ~7u); p < pEnd; p += 8, dest += 8)
+  {
+    const auto load = [&](std::ptrdiff_t offset)
+    {
+      return _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p + offset)), zero);
+    };
+    const __m128i center = load(0);
+    const __m128i neighbors = _mm_add_epi16(load(-width), load(width));
+    __m128i sum;
+    if constexpr(filterSize == 3)
+      sum = _mm_add_epi16(neighbors, _mm_slli_epi16(center, 1));
+    else
+      sum = _mm_add_epi16(_mm_add_epi16(load(-2 * width), load(2 * width)),
+                          _mm_add_epi16(_mm_slli_epi16(neighbors, 1), _mm_slli_epi16(center, 2)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), _mm_unpacklo_epi16(sum, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 4), _mm_unpackhi_epi16(sum, zero));
+  }
+  smoothVerticallyReference<filterSize>(image, x + (count & ~7u), y, count & 7u, dest);
+}
+
+template<int filterSize>
+void ScanLineSmoothing::smoothVerticallyReference(const Image<PixelTypes::GrayscaledPixel>& image, unsigned int x, unsigned int y, unsigned int count, int* dest)
+{
+  static_assert(filterSize == 3 || filterSize == 5);
+  const std::ptrdiff_t width = image.width;
+  for(const PixelTypes::GrayscaledPixel* p = &image[y][x], * pEnd = p + count; p < pEnd; ++p)
+    if constexpr(filterSize == 3)
+      *dest++ = static_cast<int>(p[-width] + 2 * p[0] + p[width]);
+    else
+      *dest++ = static_cast<int>(p[-2 * width] + 2 * p[-width] + 4 * p[0] + 2 * p[width] + p[2 * width]);
+}
+
+template void ScanLineSmoothing::smoothVertically<3>(const Image<PixelTypes::GrayscaledPixel>& image, unsigned int x, unsigned int y, unsigned int count, int* dest);
+template void ScanLineSmoothing::smoothVertically<5>(const Image<PixelTypes::GrayscaledPixel>& image, unsigned int x, unsigned int y, unsigned int count, int* dest);
+template void ScanLineSmoothing::smoothVerticallyReference<3>(const Image<PixelTypes::GrayscaledPixel>& image, unsigned int x, unsigned int y, unsigned int count, int* dest);
+template void ScanLineSmoothing::smoothVerticallyReference<5>(const Image<PixelTypes::GrayscaledPixel>& image, unsigned int x, unsigned int y, unsigned int count, int* dest);
@@ -0,0 +1,43 @@
+/**
+ * @file ScanLineSmoothing.h
+ *
+ * Functions to smooth consecutive pixels of a grayscale image row with a
+ * vertical binomial filter, as required when scanning horizontal scan lines
+ * for edges.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "ImageProcessing/Image.h"
+#include "ImageProcessing/PixelTypes.h"
+
+namespace ScanLineSmoothing
+{
+  /**
+   * Smooths consecutive pixels of a row vertically with the filter
+   * [1, 2, 1] (filterSize 3) or [1, 2, 4, 2, 1] (filterSize 5).
+   * This version uses SSE.
+   * @tparam filterSize The size of the filter (3 or 5).
+   * @param image The image. It must contain filterSize / 2 rows above and below the row.
+   * @param x The first column smoothed.
+   * @param y The row smoothed.
+   * @param count The number of pixels smoothed.
+   * @param dest The smoothed values. Must provide space for \c count entries.
+   */
+  template<int filterSize>
+  void smoothVertically(const Image<PixelTypes::GrayscaledPixel>& image, unsigned int x, unsigned int y, unsigned int count, int* dest);
+
+  /**
+   * Scalar version of \c smoothVertically that serves as reference.
+   * @tparam filterSize The size of the filter (3 or 5).
+   * @param image The image. It must contain filterSize / 2 rows above and below the row.
+   * @param x The first column smoothed.
+   * @param y The row smoothed.
+   * @param count The number of pixels smoothed.
+   * @param dest The smoothed values. Must provide space for \c count entries.
+   */
+  template<int filterSize>
+  void smoothVerticallyReference(const Image<PixelTypes::GrayscaledPixel>& image, unsigned int x, unsigned int y, unsigned int count, int* dest);
+}
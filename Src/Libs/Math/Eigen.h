@@ -12,6 +12,25 @@
 #include "MathBase/Eigen.h"
 #include "Streaming/AutoStreamable.h"
 
+namespace Streaming
+{
+  /**
+   * Fixed-size Eigen matrices, arrays, and quaternions stream their coefficients in
+   * memory order. Therefore, their binary format equals their memory layout if they
+   * contain no padding.
+   */
+  template<typename T, int ROWS, int COLS, int OPTIONS>
+  struct IsRawBinary<Eigen::Matrix<T, ROWS, COLS, OPTIONS, ROWS, COLS>>
+    : std::bool_constant<ROWS != Eigen::Dynamic && COLS != Eigen::Dynamic && IsRawBinary<T>::value &&
+                         sizeof(Eigen::Matrix<T, ROWS, COLS, OPTIONS, ROWS, COLS>) == ROWS * COLS * sizeof(T)> {};
+  template<typename T, int OPTIONS>
+  struct IsRawBinary<Eigen::Array<T, 2, 1, OPTIONS, 2, 1>>
+    : std::bool_constant<IsRawBinary<T>::value && sizeof(Eigen::Array<T, 2, 1, OPTIONS, 2, 1>) == 2 * sizeof(T)> {};
+  template<typename T, int OPTIONS>
+  struct IsRawBinary<Eigen::Quaternion<T, OPTIONS>>
+    : std::bool_constant<IsRawBinary<T>::value && sizeof(Eigen::Quaternion<T, OPTIONS>) == 4 * sizeof(T)> {};
+}
+
 /**
  * Helper class to stream a fixed-sized row or column of an Eigen matrix.
  * @tparam T The element type of the row or column.
@@ -0,0 +1 @@
+#include "MathBase/FastMath.h"
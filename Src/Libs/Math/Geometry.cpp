@@ -12,6 +12,49 @@
 #include <algorithm>
 #include <cstdlib>
 
+namespace
+{
+  /**
+   * The same as Geometry::ccw, but based on the differences p1 - p0 and
+   * p2 - p0 and without branches.
+   */
+  inline int ccw(const float dx1, const float dy1, const float dx2, const float dy2)
+  {
+    const float left = dx1 * dy2;
+    const float right = dy1 * dx2;
+    const int collinear = dx1 * dx2 < 0.0f || dy1 * dy2 < 0.0f ? -1
+                          : dx1 * dx1 + dy1 * dy1 >= dx2 * dx2 + dy2 * dy2 ? 0 : 1;
+    return left > right ? 1 : left < right ? -1 : collinear;
+  }
+
+  /** The quantities of an edge that Geometry::getDistanceToEdge derives for each point. */
+  struct Edge
+  {
+    Vector2f base; /**< The start of the edge. */
+    Vector2f direction; /**< The vector from the start to the end of the edge. */
+    Vector2f end; /**< The end of the edge. */
+    Vector2f normal; /**< The normalized normal of the edge. */
+    float c; /**< The distance of the line through the edge from the origin in the direction of the normal. */
+    float squaredLength; /**< The squared length of the edge. */
+
+    Edge(const Vector2f& base, const Vector2f& direction) :
+      base(base), direction(direction), end(base + direction), normal(Vector2f(direction.y(), -direction.x()).normalized()),
+      c(normal.dot(base)), squaredLength(direction.dot(direction))
+    {}
+
+    /**
+     * The same as Geometry::getDistanceToEdge, but without branches.
+     * The edge must not be degenerated to a point.
+     */
+    float getDistance(const Vector2f& point) const
+    {
+      const float d = (point - base).dot(direction) / squaredLength;
+      const float squaredDistanceToEnd = d < 0 ? (base - point).squaredNorm() : (end - point).squaredNorm();
+      return d >= 0 && d <= 1.0f ? std::abs(normal.dot(point) - c) : std::sqrt(squaredDistanceToEnd);
+    }
+  };
+}
+
 float Geometry::angleTo(const Pose2f& from, const Vector2f& to)
 {
   const Pose2f relPos = Pose2f(to) - from;
@@ -208,12 +251,17 @@ bool Geometry::getIntersectionOfRaysFactor(const Line& ray1, const Line& ray2, f
 
 bool Geometry::getIntersectionOfLineAndConvexPolygon(const std::vector<Vector2f>& polygon, const Line& direction, Vector2f& intersection, const bool isCCW, Line* intersectedLine)
 {
-  ASSERT(polygon.size() >= 3);
-  for(size_t i = 0; i < polygon.size(); ++i)
+  return getIntersectionOfLineAndConvexPolygon(polygon.data(), polygon.size(), direction, intersection, isCCW, intersectedLine);
+}
+
+bool Geometry::getIntersectionOfLineAndConvexPolygon(const Vector2f polygon[], const std::size_t numberOfPoints, const Line& direction, Vector2f& intersection, const bool isCCW, Line* intersectedLine)
+{
+  ASSERT(numberOfPoints >= 3);
+  for(size_t i = 0; i < numberOfPoints; ++i)
   {
     Vector2f intersection2D;
     const Vector2f& p1 = polygon[i];
-    const Vector2f& p2 = polygon[(i + 1) % polygon.size()];
+    const Vector2f& p2 = polygon[(i + 1) % numberOfPoints];
     const Vector2f dir = p2 - p1;
     const Geometry::Line polygonLine(p1, dir.normalized());
     const bool isLeftP1 = Geometry::isPointLeftOfLine(direction.base, direction.base + direction.direction, p1);
@@ -694,3 +742,97 @@ bool Geometry::isPointInsideArc(const Vector2f& point, const Vector2f& center, c
   const Vector2f pointToArc = point - center;
   return (pointToArc.squaredNorm() <= sqr(radius) && angleRange.isInside(pointToArc.angle()));
 }
+
+std::size_t Geometry::isPointInsideConvexPolygon(const Vector2f polygon[], const int numberOfPoints,
+                                                 const Vector2f points[], const std::size_t numberOfQueries, bool inside[])
+{
+  // The points are processed in blocks to keep the intermediate results on the stack.
+  constexpr std::size_t blockSize = 64;
+  int orientation[blockSize];
+  bool undecided[blockSize];
+  std::size_t numberInside = 0;
+  for(std::size_t begin = 0; begin < numberOfQueries; begin += blockSize)
+  {
+    const std::size_t n = std::min(blockSize, numberOfQueries - begin);
+    const Vector2f* block = points + begin;
+    bool* result = inside + begin;
+
+    const Vector2f edge = polygon[1] - polygon[0];
+    for(std::size_t i = 0; i < n; ++i)
+    {
+      orientation[i] = ::ccw(edge.x(), edge.y(), block[i].x() - polygon[0].x(), block[i].y() - polygon[0].y());
+      result[i] = true;
+      undecided[i] = orientation[i] != 0;
+    }
+
+    // As in the scalar version, a point on an edge is inside and the first edge that disagrees decides.
+    for(int j = 1; j < numberOfPoints; ++j)
+    {
+      const Vector2f& p0 = polygon[j];
+      const Vector2f edge = polygon[(j + 1) % numberOfPoints] - p0;
+      for(std::size_t i = 0; i < n; ++i)
+      {
+        const int currentOrientation = ::ccw(edge.x(), edge.y(), block[i].x() - p0.x(), block[i].y() - p0.y());
+        result[i] = result[i] && !(undecided[i] && currentOrientation != 0 && currentOrientation != orientation[i]);
+        undecided[i] = undecided[i] && currentOrientation == orientation[i];
+      }
+    }
+
+    for(std::size_t i = 0; i < n; ++i)
+      numberInside += result[i] ? 1 : 0;
+  }
+  return numberInside;
+}
+
+void Geometry::getDistanceToEdge(const Line& line, const Vector2f points[], const std::size_t numberOfQueries, float distances[])
+{
+  if(line.direction.x() == 0 && line.direction.y() == 0)
+    for(std::size_t i = 0; i < numberOfQueries; ++i)
+      distances[i] = distance(points[i], line.base);
+  else
+  {
+    const Edge edge(line.base, line.direction);
+    for(std::size_t i = 0; i < numberOfQueries; ++i)
+      distances[i] = edge.getDistance(points[i]);
+  }
+}
+
+std::size_t Geometry::checkIntersectionOfLines(const Vector2f& l1p1, const Vector2f& l1p2, const Vector2f starts[], const Vector2f ends[],
+                                               const std::size_t numberOfQueries, bool intersect[])
+{
+  const Vector2f l1 = l1p2 - l1p1;
+  std::size_t numberIntersecting = 0;
+  for(std::size_t i = 0; i < numberOfQueries; ++i)
+  {
+    const Vector2f l2 = ends[i] - starts[i];
+    const Vector2f startToP1 = l1p1 - starts[i];
+    const Vector2f startToP2 = l1p2 - starts[i];
+    intersect[i] = ::ccw(l1.x(), l1.y(), starts[i].x() - l1p1.x(), starts[i].y() - l1p1.y())
+                   * ::ccw(l1.x(), l1.y(), ends[i].x() - l1p1.x(), ends[i].y() - l1p1.y()) <= 0
+                   && ::ccw(l2.x(), l2.y(), startToP1.x(), startToP1.y()) * ::ccw(l2.x(), l2.y(), startToP2.x(), startToP2.y()) <= 0;
+    numberIntersecting += intersect[i] ? 1 : 0;
+  }
+  return numberIntersecting;
+}
+
+std::size_t Geometry::checkIntersectionOfEdgeAndCircles(const Vector2f& start, const Vector2f& end, const Circle circles[],
+                                                        const std::size_t numberOfQueries, bool intersect[])
+{
+  std::size_t numberIntersected = 0;
+  if(start == end)
+    for(std::size_t i = 0; i < numberOfQueries; ++i)
+    {
+      intersect[i] = distance(circles[i].center, start) <= circles[i].radius;
+      numberIntersected += intersect[i] ? 1 : 0;
+    }
+  else
+  {
+    const Edge edge(start, end - start);
+    for(std::size_t i = 0; i < numberOfQueries; ++i)
+    {
+      intersect[i] = edge.getDistance(circles[i].center) <= circles[i].radius;
+      numberIntersected += intersect[i] ? 1 : 0;
+    }
+  }
+  return numberIntersected;
+}
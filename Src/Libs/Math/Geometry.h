@@ -10,6 +10,9 @@
 #include "Math/Eigen.h"
 #include "Math/Pose2f.h"
 #include "Streaming/Streamable.h"
+#include <array>
+#include <cstddef>
+#include <initializer_list>
 
 /**
  * The namespace Geometry contains representations for geometric objects and methods
@@ -128,6 +131,7 @@ namespace Geometry
   [[nodiscard]] bool getIntersectionOfLines(const Line& line1, const Line& line2, Vector2f& intersection);
   [[nodiscard]] bool getIntersectionOfRaysFactor(const Line& ray1, const Line& ray2, float& intersection);
   [[nodiscard]] bool getIntersectionOfLineAndConvexPolygon(const std::vector<Vector2f>& polygon, const Line& direction, Vector2f& intersection, const bool isCCW, Line* intersectedLine = nullptr);
+  [[nodiscard]] bool getIntersectionOfLineAndConvexPolygon(const Vector2f polygon[], const std::size_t numberOfPoints, const Line& direction, Vector2f& intersection, const bool isCCW, Line* intersectedLine = nullptr);
 
   /**
    * Computes the signed distance of a point to a line.
@@ -237,4 +241,94 @@ namespace Geometry
    * @return 0 if all points are on a line, 1 if ccw, -1 if cw
    */
   int ccw(const Vector2f& p0, const Vector2f& p1, const Vector2f& p2);
+
+  /**
+   * A polygon with a maximum number of vertices. In contrast to
+   * std::vector<Vector2f>, it never allocates memory.
+   * @tparam capacity The maximum number of vertices.
+   */
+  template<std::size_t capacity> class FixedPolygon
+  {
+    std::array<Vector2f, capacity> vertices; /**< The vertices. Only the first numberOfVertices are used. */
+    std::size_t numberOfVertices = 0; /**< The number of vertices. */
+
+  public:
+    FixedPolygon() = default;
+
+    /**
+     * Constructs a polygon from a list of vertices.
+     * @param vertices The vertices. There must not be more than capacity.
+     */
+    FixedPolygon(std::initializer_list<Vector2f> vertices)
+    {
+      for(const Vector2f& vertex : vertices)
+        push_back(vertex);
+    }
+
+    void push_back(const Vector2f& vertex) {vertices[numberOfVertices++] = vertex;}
+    void clear() {numberOfVertices = 0;}
+    std::size_t size() const {return numberOfVertices;}
+    bool empty() const {return numberOfVertices == 0;}
+    const Vector2f* data() const {return vertices.data();}
+    const Vector2f& operator[](std::size_t i) const {return vertices[i];}
+    Vector2f& operator[](std::size_t i) {return vertices[i];}
+    const Vector2f* begin() const {return vertices.data();}
+    const Vector2f* end() const {return vertices.data() + numberOfVertices;}
+  };
+
+  /**
+   * The batch functions answer the same query for many inputs at once. Their
+   * results are the same as those of the corresponding scalar functions.
+   * They loop over the edges of the polygon in the outer loop and over the
+   * inputs in the inner loop. The inner loops do not branch, so that the
+   * compiler can vectorize them.
+   */
+
+  /**
+   * Checks for many points whether they are inside a convex polygon.
+   * @param polygon The vertices of the polygon.
+   * @param numberOfPoints The number of vertices of the polygon.
+   * @param points The points to check.
+   * @param numberOfQueries The number of points to check.
+   * @param inside For each point, whether it is inside the polygon.
+   * @return The number of points inside the polygon.
+   */
+  std::size_t isPointInsideConvexPolygon(const Vector2f polygon[], const int numberOfPoints,
+                                         const Vector2f points[], const std::size_t numberOfQueries, bool inside[]);
+
+  /**
+   * Computes the absolute distances of many points to an edge.
+   * @param line The edge from line.base to line.base + line.direction.
+   * @param points The points.
+   * @param numberOfQueries The number of points.
+   * @param distances For each point, its distance to the edge.
+   */
+  void getDistanceToEdge(const Line& line, const Vector2f points[], const std::size_t numberOfQueries, float distances[]);
+
+  /**
+   * Checks for many segments whether they intersect a segment.
+   * @param l1p1 The start of the segment.
+   * @param l1p2 The end of the segment.
+   * @param starts The starts of the other segments.
+   * @param ends The ends of the other segments.
+   * @param numberOfQueries The number of other segments.
+   * @param intersect For each other segment, whether it intersects the segment.
+   * @return The number of segments intersecting the segment.
+   */
+  std::size_t checkIntersectionOfLines(const Vector2f& l1p1, const Vector2f& l1p2, const Vector2f starts[], const Vector2f ends[],
+                                       const std::size_t numberOfQueries, bool intersect[]);
+
+  /**
+   * Checks for many circles whether a segment intersects with them, i.e.
+   * whether the distance between their centers and the segment is not bigger
+   * than their radii.
+   * @param start The start of the segment.
+   * @param end The end of the segment.
+   * @param circles The circles.
+   * @param numberOfQueries The number of circles.
+   * @param intersect For each circle, whether the segment intersects it.
+   * @return The number of circles intersected.
+   */
+  std::size_t checkIntersectionOfEdgeAndCircles(const Vector2f& start, const Vector2f& end, const Circle circles[],
+                                                const std::size_t numberOfQueries, bool intersect[]);
 };
@@ -0,0 +1,113 @@
+/**
+ * @file FastMath.h
+ *
+ * This file declares approximations of some elementary functions. They are
+ * faster than their counterparts from the standard library and free of
+ * branches and lookup tables, so that loops using them can be vectorized by
+ * the compiler. Each function documents its maximum error. They should only
+ * be used where this error is acceptable.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "MathBase/BHMath.h"
+#include "MathBase/Constants.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+namespace FastMath
+{
+  /**
+   * Approximates the arc tangent for arguments in [-1, 1].
+   * The maximum absolute error is 1.2e-5 rad.
+   * @param x The argument. Must be in [-1, 1].
+   * @return The arc tangent of x.
+   */
+  inline float atanUnit(float x)
+  {
+    const float x2 = x * x;
+    return x * (0.9998660f + x2 * (-0.3302995f + x2 * (0.1801410f + x2 * (-0.0851330f + x2 * 0.0208351f))));
+  }
+
+  /**
+   * Approximates the arc tangent.
+   * The maximum absolute error is 1.2e-5 rad.
+   * @param x The argument.
+   * @return The arc tangent of x.
+   */
+  inline float atan(float x)
+  {
+    const float atanOfMin = atanUnit(std::abs(x) > 1.f ? 1.f / x : x);
+    return std::abs(x) > 1.f ? std::copysign(pi_2, x) - atanOfMin : atanOfMin;
+  }
+
+  /**
+   * Approximates the arc tangent of y / x with the sign of both arguments
+   * determining the quadrant, like std::atan2.
+   * The maximum absolute error is 1.2e-5 rad. atan2(0, 0) is 0.
+   * @param y The y coordinate.
+   * @param x The x coordinate.
+   * @return The angle in [-pi, pi].
+   */
+  inline float atan2(float y, float x)
+  {
+    const float absX = std::abs(x);
+    const float absY = std::abs(y);
+    const float max = std::max(absX, absY);
+    const float a = atanUnit(std::min(absX, absY) / (max == 0.f ? 1.f : max));
+    const float firstOctant = absY > absX ? pi_2 - a : a;
+    const float halfPlane = x < 0.f ? pi - firstOctant : firstOctant;
+    return std::copysign(halfPlane, y);
+  }
+
+  /**
+   * Approximates the exponential function. Results below e^-87 are flushed
+   * to 0, arguments above 88 return e^88.
+   * The maximum relative error is 4e-6.
+   * @param x The exponent.
+   * @return e^x.
+   */
+  inline float exp(float x)
+  {
+    // e^x = 2^n * e^f with n integral and f in [-ln(2) / 2, ln(2) / 2]
+    const float clamped = std::min(std::max(x, -87.f), 88.f);
+    const float n = std::floor(clamped * 1.44269504f + 0.5f);
+    const float f = clamped - n * 0.693145752f - n * 1.42860677e-6f; // ln(2) split into two parts for precision
+    const float expF = 1.f + f * (1.f + f * (0.5f + f * (0.166666667f + f * (0.0416666667f + f * 0.00833333333f))));
+    const float twoToN = std::bit_cast<float>(static_cast<std::uint32_t>(static_cast<std::int32_t>(n) + 127) << 23);
+    return x < -87.f ? 0.f : twoToN * expF;
+  }
+
+  /**
+   * Approximates the inverse square root with two Newton iterations.
+   * The maximum relative error is 5e-6.
+   * @param x The argument. Must be positive.
+   * @return 1 / sqrt(x).
+   */
+  inline float invSqrt(float x)
+  {
+    float y = std::bit_cast<float>(0x5f375a86u - (std::bit_cast<std::uint32_t>(x) >> 1));
+    const float halfX = 0.5f * x;
+    y *= 1.5f - halfX * y * y;
+    y *= 1.5f - halfX * y * y;
+    return y;
+  }
+
+  /**
+   * Approximates the probability density of a value in a Gaussian distribution
+   * with the mean 0. It is the same as gaussianProbability in Probabilistics.h,
+   * but uses the approximated exponential function.
+   * The maximum relative error is 4e-6.
+   * @param x The value
+   * @param s The standard deviation
+   * @return The probability density at x, but at least 0.000001.
+   */
+  inline float gaussianProbability(float x, float s)
+  {
+    return std::max(1.f / (s * 2.50662827f) * exp(-0.5f * sqr(x / s)), 0.000001f);
+  }
+}
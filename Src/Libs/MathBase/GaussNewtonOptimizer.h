@@ -1,8 +1,10 @@
 #pragma once
 
+#include "MathBase/BHMath.h"
 #include "MathBase/Eigen.h"
 #include "Platform/BHAssert.h"
 #include <Eigen/Cholesky>
+#include <algorithm>
 
 template<size_t N>
 class GaussNewtonOptimizer
@@ -20,6 +22,15 @@ public:
 
     /** The number of measurements. */
     virtual size_t getNumOfMeasurements() const = 0;
+
+    /**
+     * Can the error of a measurement change with a parameter? If not, the
+     * corresponding entry of the Jacobian is zero and is not computed.
+     * @param measurement The index of the measurement.
+     * @param parameter The index of the parameter.
+     * @return Does the error depend on the parameter?
+     */
+    virtual bool dependsOn([[maybe_unused]] size_t measurement, [[maybe_unused]] size_t parameter) const {return true;}
   };
 
 private:
@@ -27,9 +38,16 @@ private:
   using JacobianTransposed = Eigen::Matrix<float, N, Eigen::Dynamic>;
 
   const Functor& functor;
+  float damping; /**< The damping of the Levenberg-Marquardt algorithm. 0 means Gauss-Newton. */
 
 public:
-  GaussNewtonOptimizer(const Functor& functor) : functor(functor) {};
+  /**
+   * Constructor.
+   * @param functor The functor that calculates the errors.
+   * @param damping The initial damping if a Levenberg-Marquardt step should be performed
+   *                instead of a Gauss-Newton step. 0 means Gauss-Newton.
+   */
+  GaussNewtonOptimizer(const Functor& functor, float damping = 0.f) : functor(functor), damping(damping) {};
 
   float iterate(Vector& params, const Vector& epsilon);
 };
@@ -38,6 +56,7 @@ template<size_t N>
 float GaussNewtonOptimizer<N>::iterate(Vector& params, const Vector& epsilon)
 {
   // See: https://en.wikipedia.org/wiki/Gauss%E2%80%93Newton_algorithm
+  // and: https://en.wikipedia.org/wiki/Levenberg%E2%80%93Marquardt_algorithm
 
   const size_t numOfMeasurements = functor.getNumOfMeasurements();
   ASSERT(numOfMeasurements >= N);
@@ -51,7 +70,7 @@ float GaussNewtonOptimizer<N>::iterate(Vector& params, const Vector& epsilon)
     const Vector paramsAbove = params + epsilonj;
     const Vector paramsBelow = params - epsilonj;
     for(size_t i = 0; i < numOfMeasurements; ++i)
-      J(i, j) = (functor(paramsAbove, i) - functor(paramsBelow, i)) / (2 * epsilon(j));
+      J(i, j) = functor.dependsOn(i, j) ? (functor(paramsAbove, i) - functor(paramsBelow, i)) / (2 * epsilon(j)) : 0.f;
   }
 
   VectorXf r = VectorXf(numOfMeasurements);
@@ -59,10 +78,29 @@ float GaussNewtonOptimizer<N>::iterate(Vector& params, const Vector& epsilon)
     r(i) = functor(params, i);
 
   const JacobianTransposed Jt = J.transpose();
-  const Eigen::LDLT<Eigen::Matrix<float, N, N>> JtJdecomposed(Jt * J);
+  Eigen::Matrix<float, N, N> JtJ = Jt * J;
+  if(damping > 0.f)
+    JtJ.diagonal() *= 1.f + damping;
+  const Eigen::LDLT<Eigen::Matrix<float, N, N>> JtJdecomposed(JtJ);
   const Vector s = JtJdecomposed.solve(Jt * r);
 
-  params -= s;
+  if(damping > 0.f)
+  {
+    // Only accept the step if it reduces the error. Otherwise, move closer to gradient descent.
+    const Vector candidate = params - s;
+    float error = 0.f;
+    for(size_t i = 0; i < numOfMeasurements; ++i)
+      error += sqr(functor(candidate, i));
+    if(error < r.squaredNorm())
+    {
+      params = candidate;
+      damping = std::max(damping * 0.1f, 1e-6f);
+    }
+    else
+      damping *= 10.f;
+  }
+  else
+    params -= s;
 
   float sum = 0.f;
   for(size_t i = 0; i < N; ++i)
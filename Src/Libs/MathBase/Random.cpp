@@ -1,4 +1,5 @@
 #include "Random.h"
+#include <cmath>
 
 #ifndef TARGET_ROBOT
 #include <chrono>
@@ -32,3 +33,68 @@ Random::HardwareGenerator& Random::getGenerator()
   return generator;
 }
 #endif
+
+Random::Philox::Philox(std::uint64_t seed, std::uint64_t stream) :
+  key({static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)}),
+  stream(stream)
+{}
+
+Random::Philox::result_type Random::Philox::operator()()
+{
+  const std::uint64_t blockIndex = position >> 2;
+  if(blockIndex != bufferedBlock)
+  {
+    buffer = block({static_cast<std::uint32_t>(blockIndex), static_cast<std::uint32_t>(blockIndex >> 32),
+                    static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)}, key);
+    bufferedBlock = blockIndex;
+  }
+  return buffer[position++ & 3];
+}
+
+Random::Philox Random::Philox::split(std::uint64_t stream) const
+{
+  Philox philox(*this);
+  philox.stream = stream;
+  philox.position = 0;
+  philox.bufferedBlock = static_cast<std::uint64_t>(-1);
+  return philox;
+}
+
+void Random::Philox::uniform(float* values, std::size_t count, float min, float max)
+{
+  const float scale = (max - min) / 16777216.f;
+  for(std::size_t i = 0; i < count; ++i)
+    values[i] = min + static_cast<float>((*this)() >> 8) * scale;
+}
+
+void Random::Philox::normal(float* values, std::size_t count, float sigma)
+{
+  for(std::size_t i = 0; i < count; i += 2)
+  {
+    // u1 is in (0, 1], so that its logarithm is finite.
+    const float u1 = static_cast<float>(((*this)() >> 8) + 1) / 16777216.f;
+    const float u2 = static_cast<float>((*this)() >> 8) / 16777216.f;
+    const float r = sigma * std::sqrt(-2.f * std::log(u1));
+    const float phi = 6.2831853f * u2;
+    values[i] = r * std::cos(phi);
+    if(i + 1 < count)
+      values[i + 1] = r * std::sin(phi);
+  }
+}
+
+std::array<std::uint32_t, 4> Random::Philox::block(std::array<std::uint32_t, 4> counter, std::array<std::uint32_t, 2> key)
+{
+  for(int round = 0; round < 10; ++round)
+  {
+    if(round)
+    {
+      key[0] += 0x9E3779B9u;
+      key[1] += 0xBB67AE85u;
+    }
+    const std::uint64_t product0 = static_cast<std::uint64_t>(0xD2511F53u) * counter[0];
+    const std::uint64_t product1 = static_cast<std::uint64_t>(0xCD9E8D57u) * counter[2];
+    counter = {static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ key[0], static_cast<std::uint32_t>(product1),
+               static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ key[1], static_cast<std::uint32_t>(product0)};
+  }
+  return counter;
+}
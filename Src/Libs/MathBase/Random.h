@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <random>
 
 namespace Random
@@ -74,6 +77,85 @@ namespace Random
   };
   HardwareGenerator& getGenerator();
 #endif
+
+  /**
+   * A counter-based random number generator (Philox4x32-10, see Salmon et al.:
+   * "Parallel Random Numbers: As Easy as 1, 2, 3", 2011). Each block of four
+   * values is computed only from a key and a counter. Therefore, the generator
+   * is deterministic for a given seed, skipping values is cheap, and streams
+   * with different numbers never overlap. Separate streams can be used per
+   * robot, thread, or hypothesis, so that the results do not depend on the
+   * order in which they draw their numbers. The class satisfies the requirements
+   * of a uniform random bit generator, i.e. it can be used with the
+   * distributions of the standard library.
+   */
+  class Philox
+  {
+  public:
+    using result_type = std::uint32_t;
+
+    static constexpr result_type min() {return 0;}
+    static constexpr result_type max() {return static_cast<result_type>(-1);}
+
+    /**
+     * Constructor.
+     * @param seed The seed, which is used as the key of the generator.
+     * @param stream The number of the stream within the sequences of this seed.
+     */
+    explicit Philox(std::uint64_t seed = 0, std::uint64_t stream = 0);
+
+    /** Returns the next random number. */
+    result_type operator()();
+
+    /**
+     * Skips random numbers in O(1).
+     * @param z The number of random numbers skipped.
+     */
+    void discard(unsigned long long z) {position += z;}
+
+    /**
+     * Returns a generator with the same seed, but for another stream. Its sequence
+     * starts at the beginning.
+     * @param stream The number of the stream.
+     * @return The new generator.
+     */
+    Philox split(std::uint64_t stream) const;
+
+    /**
+     * Fills an array with uniformly distributed random numbers in [min, max).
+     * They are based on 24 bits of randomness each.
+     * @param values The array that is filled.
+     * @param count The number of entries in the array.
+     * @param min The minimum value.
+     * @param max The maximum value (excluded).
+     */
+    void uniform(float* values, std::size_t count, float min = 0.f, float max = 1.f);
+
+    /**
+     * Fills an array with normally distributed random numbers with zero mean
+     * using the Box-Muller transform. Each pair of values consumes two random
+     * numbers.
+     * @param values The array that is filled.
+     * @param count The number of entries in the array.
+     * @param sigma The standard deviation.
+     */
+    void normal(float* values, std::size_t count, float sigma = 1.f);
+
+    /**
+     * Computes a block of the Philox4x32-10 function.
+     * @param counter The counter.
+     * @param key The key.
+     * @return Four random numbers.
+     */
+    static std::array<std::uint32_t, 4> block(std::array<std::uint32_t, 4> counter, std::array<std::uint32_t, 2> key);
+
+  private:
+    std::array<std::uint32_t, 2> key; /**< The key, i.e. the seed. */
+    std::uint64_t stream; /**< The number of the stream, which forms the upper half of the counter. */
+    std::uint64_t position = 0; /**< The number of random numbers consumed so far. */
+    std::uint64_t bufferedBlock = static_cast<std::uint64_t>(-1); /**< The index of the block in the buffer. */
+    std::array<std::uint32_t, 4> buffer; /**< The block that contains the current position. */
+  };
 };
 
 inline bool Random::bernoulli(double p)
@@ -155,14 +155,15 @@ public:
     }
     else
       buffer[head] = value;
-    head = (head + 1) % allocated;
+    if(++head == allocated)
+      head = 0;
   }
 
   /** Removes the entry back() from the buffer. */
   void pop_back()
   {
     ASSERT(!empty());
-    buffer[(allocated + head - entries) % allocated].~T();
+    buffer[wrap(allocated + head - entries)].~T();
     --entries;
   }
 
@@ -171,8 +172,8 @@ public:
    * @param index The index of the element. Element 0 is the same as front(), element
    *              size()-1 is the same as back().
    */
-  T& operator[](std::size_t index) {ASSERT(!empty()); return buffer[(allocated + head - index - 1) % allocated];}
-  const T& operator[](std::size_t index) const {ASSERT(!empty()); return buffer[(allocated + head - index - 1) % allocated];}
+  T& operator[](std::size_t index) {ASSERT(!empty()); return buffer[wrap(allocated + head - index - 1)];}
+  const T& operator[](std::size_t index) const {ASSERT(!empty()); return buffer[wrap(allocated + head - index - 1)];}
 
   /** Access the first element of the buffer. */
   T& front() {ASSERT(!empty()); return (*this)[0];}
@@ -235,4 +236,14 @@ protected:
 
   /** Is the current content wrapped around the end of the buffer? */
   bool wrapped() const {return head < entries;}
+
+private:
+  /**
+   * Maps a position in the range [0, 2 * capacity()) to an index into the buffer.
+   * This avoids the integer division of a modulo operation in the frequently used
+   * element access.
+   * @param position The position.
+   * @return The index into the buffer.
+   */
+  std::size_t wrap(std::size_t position) const {return position >= allocated ? position - allocated : position;}
 };
@@ -13,7 +13,7 @@
 #include "MathBase/Eigen.h"
 #include "Platform/BHAssert.h"
 
-#include <functional>
+#include <array>
 #include <limits>
 
 /**
@@ -58,6 +58,9 @@ namespace impl
     template<typename T>
     using SigmaArray = std::array < T, DOF * 2 + 1 >; // The array type for the sigma points
 
+    static constexpr float meanWeight = 1.f / static_cast<float>(DOF * 2 + 1); // The weight of each sigma point when computing a mean
+    static constexpr float covarianceWeight = 0.5f; // The weight of each sigma point when computing a covariance
+
   public:
     State mean; // The mean of the hypothesis that is generated
     CovarianceType cov = CovarianceType::Zero(); // The covariance of the hypothesis to quantify the certainty
@@ -82,10 +85,11 @@ namespace impl
     /**
      * The prediction step to propagate the whole hypothesis with a given dynamic model and an operation specific noise.
      * In other works this function is referred as dynamic step.
-     * @param dynamicModel, a function to propagate the state
+     * @param dynamicModel, a function to propagate the state. Any callable is accepted, so that it can be inlined.
      * @param noise, the propagation specific noise (as a variance) to quantify the uncertainty
      */
-    void predict(const std::function<void(State&)>& dynamicModel, const CovarianceType& noise);
+    template<typename DynamicModel>
+    void predict(const DynamicModel& dynamicModel, const CovarianceType& noise);
 
     /**
      * The multi dimensional update step to integrate a measurement into an existing hypothesis.
@@ -94,8 +98,8 @@ namespace impl
      * @param measurementModel, a function that returns a measurement for a state
      * @param measurementNoise, the measurement specific noise (as a variance) to quantify the uncertainty
      */
-    template<unsigned N>
-    void update(const Vectorf<N>& measurement, const std::function<Vectorf<N>(const State&)>& measurementModel, const Eigen::Matrix<float, N, N>& measurementNoise);
+    template<unsigned N, typename MeasurementModel>
+    void update(const Vectorf<N>& measurement, const MeasurementModel& measurementModel, const Eigen::Matrix<float, N, N>& measurementNoise);
 
     /**
      * The single dimensional update step to integrate a measurement into an existing hypothesis.
@@ -104,7 +108,8 @@ namespace impl
      * @param measurementModel, a function that returns a measurement for a state
      * @param measurementNoise, the measurement specific noise (as a variance) to quantify the uncertainty
      */
-    void update(float measurement, const std::function<float(const State&)>& measurementModel, float measurementNoise);
+    template<typename MeasurementModel>
+    void update(float measurement, const MeasurementModel& measurementModel, float measurementNoise);
 
   private:
     /**
@@ -163,7 +168,8 @@ namespace impl
    * @param noise, the propagation specific noise (as variance) to quantify the uncertainty
    */
   template<typename State, unsigned DOF, bool Manifold>
-  void UnscentedKalmanFilter<State, DOF, Manifold>::predict(const std::function<void(State&)>& dynamicModel, const CovarianceType& noise)
+  template<typename DynamicModel>
+  void UnscentedKalmanFilter<State, DOF, Manifold>::predict(const DynamicModel& dynamicModel, const CovarianceType& noise)
   {
     ASSERT((noise.array() >= 0.f).all());
     ASSERT(noise.trace() > 0.f);
@@ -181,7 +187,7 @@ namespace impl
       const Vectorf<DOF> dist = sigmaPoint - mean;
       cov += dist * dist.transpose();
     }
-    cov *= 0.5f;
+    cov *= covarianceWeight;
     cov += noise;
 
     fixCovarianceMatrix(cov);
@@ -196,8 +202,8 @@ namespace impl
    * @param measurementNoise, the measurement specific noise (as variance) to quantify the uncertainty
    */
   template<typename State, unsigned DOF, bool IsManifold>
-  template<unsigned N>
-  void UnscentedKalmanFilter<State, DOF, IsManifold>::update(const Vectorf<N>& measurement, const std::function<Vectorf<N>(const State&)>& measurementModel, const Eigen::Matrix<float, N, N>& measurementNoise)
+  template<unsigned N, typename MeasurementModel>
+  void UnscentedKalmanFilter<State, DOF, IsManifold>::update(const Vectorf<N>& measurement, const MeasurementModel& measurementModel, const Eigen::Matrix<float, N, N>& measurementNoise)
   {
     ASSERT((measurementNoise.diagonal().array() >= 0.f).all());
     ASSERT(measurementNoise.trace() > 0.f);
@@ -215,7 +221,7 @@ namespace impl
     MeasurementType z = MeasurementType::Zero();
     for(MeasurementType& Zi : Z)
       z += Zi;
-    z /= static_cast<float>(sigmaPoints.size());
+    z *= meanWeight;
 
     MeasurementCovarianceType sigmaz = MeasurementCovarianceType::Zero();
     for(MeasurementType& Zi : Z)
@@ -223,7 +229,7 @@ namespace impl
       const MeasurementType dist = Zi - z;
       sigmaz += dist * dist.transpose();
     }
-    sigmaz *= 0.5f;
+    sigmaz *= covarianceWeight;
     sigmaz += measurementNoise;
 
     MixedCovarianceType sigmaxz = MixedCovarianceType::Zero();
@@ -233,16 +239,17 @@ namespace impl
       const MeasurementType& Zi = Z[i];
       sigmaxz += (Xi - mean) * (Zi - z).transpose();
     }
-    sigmaxz *= 0.5f;
-    //The kalman gain
+    sigmaxz *= covarianceWeight;
+    //The kalman gain. Since sigmaz is symmetric, K = sigmaxz * sigmaz^-1 is the transposed solution of sigmaz * K^T = sigmaxz^T.
     MixedCovarianceType K = MixedCovarianceType::Zero();
-    if(sigmaz.determinant() != 0)
-      K = sigmaxz * sigmaz.inverse();
+    const Eigen::LDLT<MeasurementCovarianceType> ldlt(sigmaz);
+    if(ldlt.info() == Eigen::Success && (ldlt.vectorD().array() != 0.f).all())
+      K = ldlt.solve(sigmaxz.transpose()).transpose();
     ASSERT(K.allFinite());
 
-    //Derive the mean and the covariance using the kalman gain
+    //Derive the mean and the covariance using the kalman gain. K * sigmaz * K^T is the same as K * sigmaxz^T.
     mean += K * (measurement - z);
-    cov -= K * sigmaz * K.transpose();
+    cov -= K * sigmaxz.transpose();
 
     fixCovarianceMatrix(cov);
     covarianceMatrixValidation(cov);
@@ -256,7 +263,8 @@ namespace impl
    * @param measurementNoise, the measurement specific noise (as variance) to quantify the uncertainty
    */
   template<typename State, unsigned DOF, bool IsManifold>
-  void UnscentedKalmanFilter<State, DOF, IsManifold>::update(float measurement, const std::function<float(const State&)>& measurementModel, float measurementNoise)
+  template<typename MeasurementModel>
+  void UnscentedKalmanFilter<State, DOF, IsManifold>::update(float measurement, const MeasurementModel& measurementModel, float measurementNoise)
   {
     ASSERT(measurementNoise > 0.f);
 
@@ -271,12 +279,12 @@ namespace impl
     float z = 0.f;
     for(float& Zi : Z)
       z += Zi;
-    z /= static_cast<float>(sigmaPoints.size());
+    z *= meanWeight;
 
     float sigmaz = 0.f;
     for(float& Zi : Z)
       sigmaz += sqr(Zi - z);
-    sigmaz *= 0.5f;
+    sigmaz *= covarianceWeight;
     sigmaz += measurementNoise;
 
     MixedCovarianceType sigmaxz = MixedCovarianceType::Zero();
@@ -286,12 +294,12 @@ namespace impl
       const float& Zi = Z[i];
       sigmaxz += (Xi - mean) * (Zi - z);
     }
-    sigmaxz *= 0.5f;
+    sigmaxz *= covarianceWeight;
 
     const MixedCovarianceType K = sigmaxz * (1.f / sigmaz);
 
     mean += K * (measurement - z);
-    cov -= K * sigmaz * K.transpose();
+    cov -= K * sigmaxz.transpose();
 
     fixCovarianceMatrix(cov);
     covarianceMatrixValidation(cov);
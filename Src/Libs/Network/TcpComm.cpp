@@ -196,6 +196,27 @@ bool TcpComm::receive(unsigned char* buffer, int size, bool wait)
   return true; // ok, data received
 }
 
+int TcpComm::receiveNonBlocking(unsigned char* buffer, int size)
+{
+  if(!checkConnection())
+    return -1;
+
+  RESET_ERRNO;
+  const int received = static_cast<int>(recv(transferSocket, reinterpret_cast<char*>(buffer), size, 0));
+  if(received > 0)
+  {
+    overallBytesReceived += received;
+    return received;
+  }
+  else if(received < 0 && (ERRNO == EWOULDBLOCK || ERRNO == EINPROGRESS))
+    return 0; // nothing received yet, try again later
+  else
+  {
+    closeTransferSocket();
+    return -1;
+  }
+}
+
 bool TcpComm::send(const unsigned char* buffer, int size)
 {
   if(!checkConnection())
@@ -223,7 +244,7 @@ bool TcpComm::send(const unsigned char* buffer, int size)
     if(sent2 >= 0)
     {
       sent += sent2;
-      overallBytesSent += sent;
+      overallBytesSent += sent2;
     }
   }
 
@@ -235,3 +256,24 @@ bool TcpComm::send(const unsigned char* buffer, int size)
     return false;
   }
 }
+
+int TcpComm::sendNonBlocking(const unsigned char* buffer, int size)
+{
+  if(!checkConnection())
+    return -1;
+
+  RESET_ERRNO;
+  const int sent = static_cast<int>(::send(transferSocket, reinterpret_cast<const char*>(buffer), size, MSG_NOSIGNAL));
+  if(sent >= 0)
+  {
+    overallBytesSent += sent;
+    return sent;
+  }
+  else if(ERRNO == EWOULDBLOCK || ERRNO == EINPROGRESS)
+    return 0; // send buffer is full, try again later
+  else
+  {
+    closeTransferSocket();
+    return -1;
+  }
+}
@@ -37,13 +37,6 @@ private:
   int maxPacketReceiveSize; /**< The maximum size of an incoming packet. If 0, this setting is ignored. */
   bool wasConnected = false; /**< Whether a transfer connection was established or not */
 
-  /**
-   * The method checks whether the connection is available.
-   * If not, it tries to reestablish it.
-   * @return Can the connection be used now?
-   */
-  bool checkConnection();
-
   /**
    * The function closes the transfer socket.
    */
@@ -64,6 +57,14 @@ public:
 
   ~TcpComm();
 
+  /**
+   * The method checks whether the connection is available.
+   * If not, it tries to reestablish it. A server accepts a new
+   * client without waiting.
+   * @return Can the connection be used now?
+   */
+  bool checkConnection();
+
   /**
    * The function sends a block of bytes.
    * It will return immediately unless the send buffer is full.
@@ -73,6 +74,16 @@ public:
    */
   bool send(const unsigned char* buffer, int size);
 
+  /**
+   * The function sends as many bytes of a block as the send buffer
+   * currently accepts. It never waits.
+   * @param buffer The bytes to send.
+   * @param size The number of bytes to send.
+   * @return The number of bytes actually sent or -1 if the connection
+   *         was lost.
+   */
+  int sendNonBlocking(const unsigned char* buffer, int size);
+
   /**
    * The function receives a block of bytes.
    * @param buffer This buffer will be filled with the bytes to receive.
@@ -84,6 +95,17 @@ public:
    */
   bool receive(unsigned char* buffer, int size, bool wait = true);
 
+  /**
+   * The function receives the bytes that are currently available, but at
+   * most a certain number. It never waits.
+   * @param buffer This buffer will be filled with the bytes received.
+   *               It must provide at least "size" bytes.
+   * @param size The maximum number of bytes to receive.
+   * @return The number of bytes actually received or -1 if the connection
+   *         was lost.
+   */
+  int receiveNonBlocking(unsigned char* buffer, int size);
+
   /**
    * The function returns the overall number of bytes sent so far by this object.
    * @return The number of bytes sent since this object was created.
@@ -25,10 +25,39 @@
 #include <time.h>
 #endif
 
+#include <algorithm>
+
 #include "Platform/BHAssert.h"
 #include "Platform/Time.h"
 #include "Streaming/Output.h"
 
+#ifdef TARGET_ROBOT
+/**
+ * Converts a kernel timestamp of a packet to B-Human system time in nanoseconds.
+ * @param tsPacket The timestamp of the packet in real time.
+ * @return The timestamp in B-Human system time (in ns).
+ */
+static unsigned long long toSystemTimeNs(const ::timespec& tsPacket)
+{
+  ::timespec tsReal, tsMonotonic;
+  clock_gettime(CLOCK_REALTIME, &tsReal);
+  clock_gettime(CLOCK_MONOTONIC, &tsMonotonic);
+  const long long timeInMonotonic = (tsPacket.tv_sec - tsReal.tv_sec + tsMonotonic.tv_sec) * 1000000000ll +
+                                    (tsPacket.tv_nsec - tsReal.tv_nsec + tsMonotonic.tv_nsec);
+  return Time::fromMonotonicTimeNs(static_cast<unsigned long long>(timeInMonotonic));
+}
+
+/**
+ * Converts a kernel timestamp of a packet to B-Human system time.
+ * @param tsPacket The timestamp of the packet in real time.
+ * @return The timestamp in B-Human system time.
+ */
+static unsigned toSystemTime(const ::timespec& tsPacket)
+{
+  return static_cast<unsigned>(toSystemTimeNs(tsPacket) / 1000000ull);
+}
+#endif
+
 UdpComm::UdpComm()
 {
   sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
@@ -40,6 +69,11 @@ UdpComm::UdpComm()
   target = reinterpret_cast<sockaddr*>(new sockaddr_in);
 
   ASSERT(-1 != sock);
+#ifdef TARGET_ROBOT
+  // Let the kernel attach receive timestamps to the packets.
+  const int yes = 1;
+  setsockopt(sock, SOL_SOCKET, SO_TIMESTAMPNS, &yes, sizeof(yes));
+#endif
 }
 
 UdpComm::~UdpComm()
@@ -275,6 +309,71 @@ int UdpComm::read(char* data, int len)
   return static_cast<int>(::recv(sock, data, len, 0));
 }
 
+int UdpComm::read(Packet* packets, int numOfPackets)
+{
+  numOfPackets = std::min(numOfPackets, maxPacketsPerRead);
+#if defined TARGET_ROBOT || defined LINUX
+  mmsghdr headers[maxPacketsPerRead];
+  iovec buffers[maxPacketsPerRead];
+  sockaddr_in senderAddrs[maxPacketsPerRead];
+#ifdef TARGET_ROBOT
+  alignas(cmsghdr) char controls[maxPacketsPerRead][CMSG_SPACE(sizeof(::timespec))];
+#endif
+  for(int i = 0; i < numOfPackets; ++i)
+  {
+    buffers[i].iov_base = packets[i].data;
+    buffers[i].iov_len = packets[i].size;
+    std::memset(&headers[i], 0, sizeof(headers[i]));
+    headers[i].msg_hdr.msg_name = &senderAddrs[i];
+    headers[i].msg_hdr.msg_namelen = sizeof(senderAddrs[i]);
+    headers[i].msg_hdr.msg_iov = &buffers[i];
+    headers[i].msg_hdr.msg_iovlen = 1;
+#ifdef TARGET_ROBOT
+    headers[i].msg_hdr.msg_control = controls[i];
+    headers[i].msg_hdr.msg_controllen = sizeof(controls[i]);
+#endif
+  }
+
+  const int received = ::recvmmsg(sock, headers, numOfPackets, MSG_DONTWAIT, nullptr);
+  if(received < 0)
+    return errno == EAGAIN || errno == EWOULDBLOCK ? 0 : -1;
+#ifndef TARGET_ROBOT
+  const unsigned long long now = Time::getCurrentSystemTimeNs();
+#endif
+  for(int i = 0; i < received; ++i)
+  {
+    packets[i].size = static_cast<int>(headers[i].msg_len);
+    packets[i].ip = ntohl(senderAddrs[i].sin_addr.s_addr);
+#ifdef TARGET_ROBOT
+    packets[i].timestampNs = Time::getCurrentSystemTimeNs();
+    for(cmsghdr* cmsg = CMSG_FIRSTHDR(&headers[i].msg_hdr); cmsg; cmsg = CMSG_NXTHDR(&headers[i].msg_hdr, cmsg))
+      if(cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS)
+      {
+        ::timespec tsPacket;
+        std::memcpy(&tsPacket, CMSG_DATA(cmsg), sizeof(tsPacket));
+        packets[i].timestampNs = toSystemTimeNs(tsPacket);
+      }
+#else
+    packets[i].timestampNs = now;
+#endif
+    packets[i].timestamp = static_cast<unsigned>(packets[i].timestampNs / 1000000ull);
+  }
+  return received;
+#else
+  int received = 0;
+  for(; received < numOfPackets; ++received)
+  {
+    const int size = read(packets[received].data, packets[received].size, packets[received].ip);
+    if(size < 0)
+      break;
+    packets[received].size = size;
+    packets[received].timestampNs = Time::getCurrentSystemTimeNs();
+    packets[received].timestamp = static_cast<unsigned>(packets[received].timestampNs / 1000000ull);
+  }
+  return received;
+#endif
+}
+
 int UdpComm::readLocal(char* data, int len)
 {
   sockaddr_in senderAddr;
@@ -319,13 +418,9 @@ int UdpComm::readLocal(char* data, int len)
 unsigned UdpComm::getLastReadTimestamp() const
 {
 #ifdef TARGET_ROBOT
-  ::timespec tsPacket, tsReal, tsMonotonic;
+  ::timespec tsPacket;
   VERIFY(::ioctl(sock, SIOCGSTAMPNS, &tsPacket) == 0);
-  clock_gettime(CLOCK_REALTIME, &tsReal);
-  clock_gettime(CLOCK_MONOTONIC, &tsMonotonic);
-  const long long timeInMonotonic = (tsPacket.tv_sec - tsReal.tv_sec + tsMonotonic.tv_sec) * 1000ll +
-                                    (tsPacket.tv_nsec - tsReal.tv_nsec + tsMonotonic.tv_nsec) / 1000000ll;
-  return static_cast<unsigned>(timeInMonotonic - Time::getSystemTimeBase());
+  return toSystemTime(tsPacket);
 #else
   return Time::getCurrentSystemTime();
 #endif
@@ -26,6 +26,19 @@ struct sockaddr_in;
  */
 class UdpComm
 {
+public:
+  /** A packet read by \c read(Packet*, int). */
+  struct Packet
+  {
+    char* data = nullptr; /**< The buffer the packet is written to. */
+    int size = 0; /**< The size of the buffer. It is replaced by the size of the packet received. */
+    unsigned ip = 0; /**< The IPv4 address of the sender. */
+    unsigned timestamp = 0; /**< When was the packet received (in B-Human system time)? */
+    unsigned long long timestampNs = 0; /**< The same as \c timestamp, but in nanoseconds. On the robot, it is taken by the kernel when the packet arrived. */
+  };
+
+  static constexpr int maxPacketsPerRead = 16; /**< The maximum number of packets \c read(Packet*, int) returns at once. */
+
 private:
   sockaddr* target;
   socket_t sock;
@@ -84,6 +97,17 @@ public:
    */
   int read(char* data, int len);
 
+  /**
+   * The function reads as many pending packets as possible without blocking.
+   * On Linux, this requires a single system call.
+   * @param packets The packets to fill. Their buffers must be set.
+   * @param numOfPackets The number of entries in \c packets. At most
+   *                     \c maxPacketsPerRead of them are filled.
+   * @return The number of packets received. 0 if none was pending or
+   *         -1 in case of an error.
+   */
+  int read(Packet* packets, int numOfPackets);
+
   /**
    * The function tries to read a packet from a socket.
    * It only accepts a packet from this host.
@@ -0,0 +1,157 @@
+/**
+ * @file Platform/FutexSemaphore.cpp
+ *
+ * Implementation of a semaphore with a low wake-up latency.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "Platform/FutexSemaphore.h"
+#include "Platform/BHAssert.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#ifdef LINUX
+#include <cerrno>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#if defined __x86_64__ || defined __i386__
+#include <immintrin.h>
+#endif
+
+namespace
+{
+  /** @return The current time in ns. */
+  std::uint64_t now()
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  /** Tells the processor that this is a spin loop. */
+  void relax()
+  {
+#if defined __x86_64__ || defined __i386__
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+  }
+
+  constexpr std::uint64_t minSpinTime = 1000; /**< The spin time is not reduced below this value (in ns). */
+}
+
+FutexSemaphore::FutexSemaphore(unsigned maxSpinTime, unsigned value) :
+  value(value),
+  maxSpinTime(static_cast<std::uint64_t>(maxSpinTime) * 1000),
+  spinTime(std::min(minSpinTime, this->maxSpinTime))
+{}
+
+void FutexSemaphore::post()
+{
+  timeOfLastPost.store(now(), std::memory_order_relaxed);
+  value.fetch_add(1);
+#ifdef LINUX
+  if(sleeping.load())
+    syscall(SYS_futex, &value, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#else
+  semaphore.post();
+#endif
+}
+
+bool FutexSemaphore::tryWait()
+{
+  unsigned expected = value.load(std::memory_order_relaxed);
+  while(expected)
+    if(value.compare_exchange_weak(expected, expected - 1, std::memory_order_acquire, std::memory_order_relaxed))
+      return true;
+  return false;
+}
+
+bool FutexSemaphore::waitFor(std::uint64_t timeout)
+{
+  const std::uint64_t start = now();
+
+  // Spin first. The spin time grows while posts arrive during spinning and shrinks otherwise.
+  if(spinTime)
+  {
+    const std::uint64_t end = start + std::min(spinTime, timeout ? timeout : spinTime);
+    do
+    {
+      if(tryWait())
+      {
+        ++statistics.spinWakeUps;
+        spinTime = std::min(spinTime * 2, maxSpinTime);
+        return true;
+      }
+      relax();
+    }
+    while(now() < end);
+    spinTime = std::max(spinTime / 2, std::min(minSpinTime, maxSpinTime));
+  }
+
+  while(true)
+  {
+#ifdef LINUX
+    sleeping.store(1);
+#endif
+    if(tryWait())
+    {
+#ifdef LINUX
+      sleeping.store(0);
+#endif
+      return true;
+    }
+
+    std::uint64_t remaining = 0;
+    if(timeout)
+    {
+      const std::uint64_t elapsed = now() - start;
+      if(elapsed >= timeout)
+      {
+#ifdef LINUX
+        sleeping.store(0);
+#endif
+        ++statistics.timeouts;
+        return false;
+      }
+      remaining = timeout - elapsed;
+    }
+
+    sleep(remaining);
+#ifdef LINUX
+    sleeping.store(0);
+#endif
+
+    if(tryWait())
+    {
+      const std::uint64_t latency = now() - timeOfLastPost.load(std::memory_order_relaxed);
+      ++statistics.sleepWakeUps;
+      statistics.totalLatency += latency;
+      statistics.maxLatency = std::max(statistics.maxLatency, latency);
+      return true;
+    }
+    else if(!timeout || now() - start < timeout)
+      ++statistics.spuriousWakeUps;
+  }
+}
+
+void FutexSemaphore::sleep(std::uint64_t timeout)
+{
+#ifdef LINUX
+  struct timespec ts;
+  ts.tv_sec = static_cast<time_t>(timeout / 1000000000);
+  ts.tv_nsec = static_cast<long>(timeout % 1000000000);
+  // Only sleeps if the counter is still 0. Otherwise, it returns immediately.
+  syscall(SYS_futex, &value, FUTEX_WAIT_PRIVATE, 0, timeout ? &ts : nullptr, nullptr, 0);
+#else
+  // The semaphore counts pending wake-ups. Consume all of them, because the actual counter is checked anyway.
+  if(timeout)
+    semaphore.wait(static_cast<unsigned>(std::max<std::uint64_t>(timeout / 1000000, 1)));
+  else
+    semaphore.wait();
+  while(semaphore.tryWait());
+#endif
+}
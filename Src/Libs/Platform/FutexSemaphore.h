@@ -0,0 +1,99 @@
+/**
+ * @file Platform/FutexSemaphore.h
+ *
+ * Declaration of a semaphore with a low wake-up latency. A waiting thread
+ * first spins for a while before it goes to sleep. The time spent spinning
+ * adapts to how often the semaphore is posted while spinning. On Linux, the
+ * sleeping is implemented with a futex, which is only entered and left
+ * through system calls if a thread actually has to sleep. On other
+ * platforms, a normal semaphore is used for sleeping. Only a single thread
+ * may wait for the semaphore.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#ifndef LINUX
+#include "Platform/Semaphore.h"
+#endif
+
+class FutexSemaphore
+{
+public:
+  /** Counters that describe how the waiting thread was woken up. */
+  struct Statistics
+  {
+    unsigned spinWakeUps = 0; /**< How often was the semaphore posted while spinning? */
+    unsigned sleepWakeUps = 0; /**< How often was the waiting thread woken up from sleeping? */
+    unsigned spuriousWakeUps = 0; /**< How often did the thread wake up without the semaphore being posted? */
+    unsigned timeouts = 0; /**< How often did waiting time out? */
+    std::uint64_t totalLatency = 0; /**< The sum of the times between the latest post and waking up from sleeping (in ns). */
+    std::uint64_t maxLatency = 0; /**< The longest time between the latest post and waking up from sleeping (in ns). */
+  };
+
+private:
+  std::atomic<unsigned> value; /**< The counter of the semaphore. */
+#ifdef LINUX
+  std::atomic<unsigned> sleeping = 0; /**< Is the waiting thread sleeping or about to sleep? */
+#else
+  Semaphore semaphore; /**< The semaphore slept on. Its counter is always 0, except for pending wake-ups. */
+#endif
+  std::atomic<std::uint64_t> timeOfLastPost = 0; /**< When was the semaphore posted the last time (in ns)? */
+  const std::uint64_t maxSpinTime; /**< The maximum time spent spinning (in ns). */
+  std::uint64_t spinTime; /**< The time currently spent spinning before sleeping (in ns). */
+  Statistics statistics; /**< The statistics of the waiting thread. */
+
+  /**
+   * Waits for the semaphore.
+   * @param timeout The maximum time to wait (in ns). 0 means forever.
+   * @return Was the semaphore posted?
+   */
+  bool waitFor(std::uint64_t timeout);
+
+  /**
+   * Lets the waiting thread sleep until it is woken up.
+   * @param timeout The maximum time to sleep (in ns). 0 means forever.
+   */
+  void sleep(std::uint64_t timeout);
+
+public:
+  /**
+   * Constructs a new semaphore.
+   * @param maxSpinTime The maximum time a waiting thread spins before it sleeps (in µs).
+   * @param value The initial value of the counter.
+   */
+  FutexSemaphore(unsigned maxSpinTime, unsigned value = 0);
+
+  /** Increments the counter and wakes up the waiting thread if necessary. */
+  void post();
+
+  /**
+   * Decrements the counter. If it is zero, the call blocks until the counter
+   * can be decremented.
+   * @return Whether the decrementation was successful.
+   */
+  bool wait() {return waitFor(0);}
+
+  /**
+   * Decrements the counter. If it is zero, the call blocks until the counter
+   * can be decremented or the timeout has elapsed.
+   * @param timeout A timeout for the blocking call (in ms).
+   * @return Whether the decrementation was successful.
+   */
+  bool wait(unsigned timeout) {return waitFor(timeout ? static_cast<std::uint64_t>(timeout) * 1000000 : 1);}
+
+  /**
+   * Tries to decrement the counter. This function returns immediately.
+   * @return Whether the decrementation was successful.
+   */
+  bool tryWait();
+
+  /**
+   * Returns the statistics. They must only be read by the waiting thread.
+   * @return The statistics collected so far.
+   */
+  const Statistics& getStatistics() const {return statistics;}
+};
@@ -2,6 +2,7 @@
 #include "Platform/Thread.h"
 
 #include <pthread.h>
+#include <sched.h>
 
 thread_local Thread* Thread::instance = nullptr;
 
@@ -75,3 +76,23 @@ void Thread::nameCurrentThread(const std::string& name)
   cname[sizeof(cname) - 1] = '\0';
   VERIFY(!pthread_setname_np(pthread_self(), cname));
 }
+
+std::vector<unsigned> Thread::setCurrentAffinity(const std::vector<unsigned>& cores)
+{
+  cpu_set_t set;
+  if(!cores.empty())
+  {
+    CPU_ZERO(&set);
+    for(const unsigned core : cores)
+      if(core < CPU_SETSIZE)
+        CPU_SET(core, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set); // The effective placement is returned below.
+  }
+
+  std::vector<unsigned> result;
+  if(!pthread_getaffinity_np(pthread_self(), sizeof(set), &set))
+    for(unsigned core = 0; core < CPU_SETSIZE; ++core)
+      if(CPU_ISSET(core, &set))
+        result.push_back(core);
+  return result;
+}
@@ -1,9 +1,53 @@
 #include "Platform/Memory.h"
+#include <atomic>
 
 #ifdef WINDOWS
 #include <Windows.h>
 #else
 #include <cstdlib>
+#ifdef LINUX
+#include <malloc.h>
+#include <new>
+#include <sys/mman.h>
+#endif
+#endif
+
+namespace
+{
+  /** The header in front of each large block. It fills a whole cache line to keep the block aligned. */
+  struct alignas(Memory::cacheLineSize) LargeHeader
+  {
+    size_t size; /**< The size of the whole block including this header in bytes. */
+    Memory::Subsystem subsystem; /**< The subsystem the block was allocated for. */
+  };
+
+  constexpr size_t hugePageSize = 2 << 20; /**< The size of a huge page in bytes. */
+  std::atomic<bool> useHugePages = false; /**< Should large blocks be backed by huge pages? */
+  std::atomic<size_t> allocated[Memory::numOfSubsystems]; /**< The bytes currently allocated per subsystem. */
+  thread_local long long heapBalance = 0; /**< The bytes allocated with new minus the bytes deleted by this thread. */
+}
+
+#ifdef LINUX
+// The global operators new and delete are replaced to count the heap usage of
+// each thread. The default implementations of the array, nothrow, and sized
+// variants call these.
+void* operator new(size_t size)
+{
+  void* ptr = malloc(size ? size : 1);
+  if(!ptr)
+    throw std::bad_alloc();
+  heapBalance += malloc_usable_size(ptr);
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+  if(ptr)
+  {
+    heapBalance -= malloc_usable_size(ptr);
+    free(ptr);
+  }
+}
 #endif
 
 void* Memory::alignedMalloc(size_t size, size_t alignment)
@@ -27,3 +71,55 @@ void Memory::alignedFree(void* ptr)
   free(ptr);
 #endif
 }
+
+void Memory::setHugePages(bool enable)
+{
+  useHugePages = enable;
+}
+
+void* Memory::largeMalloc(size_t size, Subsystem subsystem)
+{
+  size += sizeof(LargeHeader);
+  size_t alignment = cacheLineSize;
+#ifdef LINUX
+  // Blocks of at least half a huge page are rounded up to whole huge pages.
+  const bool huge = useHugePages && size >= hugePageSize / 2;
+  if(huge)
+  {
+    size = (size + hugePageSize - 1) & ~(hugePageSize - 1);
+    alignment = hugePageSize;
+  }
+#endif
+
+  LargeHeader* header = static_cast<LargeHeader*>(alignedMalloc(size, alignment));
+  if(!header)
+    return nullptr;
+#ifdef LINUX
+  if(huge)
+    madvise(header, size, MADV_HUGEPAGE);
+#endif
+  header->size = size;
+  header->subsystem = subsystem;
+  allocated[subsystem] += size;
+  return header + 1;
+}
+
+void Memory::largeFree(void* ptr)
+{
+  if(ptr)
+  {
+    LargeHeader* header = static_cast<LargeHeader*>(ptr) - 1;
+    allocated[header->subsystem] -= header->size;
+    alignedFree(header);
+  }
+}
+
+size_t Memory::getAllocated(Subsystem subsystem)
+{
+  return allocated[subsystem];
+}
+
+long long Memory::getHeapBalance()
+{
+  return heapBalance;
+}
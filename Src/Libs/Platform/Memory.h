@@ -4,9 +4,82 @@
 
 namespace Memory
 {
+  /** The size of a cache line in bytes. Large blocks are aligned to it. */
+  constexpr size_t cacheLineSize = 64;
+
+  /** The subsystems for which the size of all large blocks allocated is counted. */
+  enum Subsystem
+  {
+    images, /**< Camera images and images computed from them. */
+    debugImages, /**< Images only sent for debugging. */
+    numOfSubsystems
+  };
+
   /** Allocate memory of given size with given alignment. */
   void* alignedMalloc(size_t size, size_t alignment = 32);
 
   /** Free aligned memory. */
   void alignedFree(void* ptr);
+
+  /**
+   * Determines whether large blocks should be backed by (transparent) huge
+   * pages to reduce TLB misses. This is only supported on Linux and only
+   * affects blocks allocated afterwards.
+   * @param enable Use huge pages?
+   */
+  void setHugePages(bool enable);
+
+  /**
+   * Allocates a large block of memory that is aligned to a cache line.
+   * Large blocks might be backed by huge pages.
+   * @param size The size of the block in bytes.
+   * @param subsystem The subsystem the size is counted for.
+   * @return The address of the block or nullptr if it could not be allocated.
+   */
+  void* largeMalloc(size_t size, Subsystem subsystem);
+
+  /**
+   * Frees a block allocated with \c largeMalloc .
+   * @param ptr The address of the block. Might be nullptr.
+   */
+  void largeFree(void* ptr);
+
+  /**
+   * Returns the number of bytes currently allocated with \c largeMalloc .
+   * @param subsystem The subsystem the bytes were allocated for.
+   * @return The number of bytes, including the overhead of the blocks.
+   */
+  size_t getAllocated(Subsystem subsystem);
+
+  /**
+   * Returns the number of bytes the calling thread allocated with \c new
+   * minus the number of bytes it deleted. The difference between two calls
+   * is the growth of the heap caused by the code executed in between. Heap
+   * usage is only counted on Linux. Otherwise, 0 is returned.
+   * @return The balance in bytes.
+   */
+  long long getHeapBalance();
+
+  /**
+   * An allocator for STL containers that allocates large blocks.
+   * @tparam T The type of the elements allocated.
+   * @tparam subsystem The subsystem the size is counted for.
+   */
+  template<typename T, Subsystem subsystem> struct LargeAllocator
+  {
+    using value_type = T;
+
+    template<typename U> struct rebind
+    {
+      using other = LargeAllocator<U, subsystem>;
+    };
+
+    LargeAllocator() = default;
+    template<typename U> LargeAllocator(const LargeAllocator<U, subsystem>&) {}
+
+    T* allocate(size_t n) {return static_cast<T*>(largeMalloc(n * sizeof(T), subsystem));}
+    void deallocate(T* p, size_t) {largeFree(p);}
+
+    template<typename U> bool operator==(const LargeAllocator<U, subsystem>&) const {return true;}
+  };
 }
@@ -0,0 +1,72 @@
+/**
+ * @file SharedMemory.cpp
+ *
+ * This file implements a class that represents a named block of memory that
+ * is shared between processes.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "SharedMemory.h"
+#include "BHAssert.h"
+#ifndef WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+SharedMemory::SharedMemory(const std::string& name, size_t size)
+{
+#ifndef WINDOWS
+  shm_unlink(name.c_str());
+  const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  if(fd != -1)
+  {
+    if(ftruncate(fd, static_cast<off_t>(size)) != -1)
+    {
+      void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      if(address != MAP_FAILED)
+      {
+        data = static_cast<char*>(address);
+        this->size = size;
+        this->name = name;
+      }
+    }
+    close(fd);
+    if(!data)
+      shm_unlink(name.c_str());
+  }
+#endif
+}
+
+SharedMemory::SharedMemory(const std::string& name)
+{
+#ifndef WINDOWS
+  const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+  if(fd != -1)
+  {
+    struct stat status;
+    if(fstat(fd, &status) != -1 && status.st_size > 0)
+    {
+      void* address = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_SHARED, fd, 0);
+      if(address != MAP_FAILED)
+      {
+        data = static_cast<char*>(address);
+        size = static_cast<size_t>(status.st_size);
+      }
+    }
+    close(fd);
+  }
+#endif
+}
+
+SharedMemory::~SharedMemory()
+{
+#ifndef WINDOWS
+  if(data)
+    VERIFY(munmap(data, size) != -1);
+  if(!name.empty())
+    shm_unlink(name.c_str());
+#endif
+}
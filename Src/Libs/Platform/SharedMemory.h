@@ -0,0 +1,57 @@
+/**
+ * @file SharedMemory.h
+ *
+ * This file declares a class that represents a named block of memory that
+ * is shared between processes.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include <string>
+
+class SharedMemory
+{
+  char* data = nullptr; /**< The start address of the shared memory block. */
+  size_t size = 0; /**< The size of the memory block. */
+  std::string name; /**< The name of the memory block. Only set if this object created it. */
+
+public:
+  /**
+   * Creates a new shared memory block. An existing block with the same
+   * name is replaced. The block is removed again when this object is destroyed.
+   * @param name The name of the block. It must start with a slash.
+   * @param size The size of the block in bytes.
+   */
+  SharedMemory(const std::string& name, size_t size);
+
+  /**
+   * Maps an existing shared memory block read-only.
+   * @param name The name of the block. It must start with a slash.
+   */
+  SharedMemory(const std::string& name);
+
+  /** Destructor. */
+  ~SharedMemory();
+
+  /**
+   * Does the memory block exist?
+   * Shared memory is only supported on Linux and macOS.
+   * @return Does it exist?
+   */
+  bool exists() const {return data != nullptr;}
+
+  /**
+   * Returns the begin of the memory block.
+   * @return The address of the memory block or \c nullptr
+   *         if the block does not exist.
+   */
+  char* getData() {return data;}
+
+  /**
+   * Returns the size of the memory block.
+   * @return The size in bytes or 0 if the block does not exist.
+   */
+  size_t getSize() const {return size;}
+};
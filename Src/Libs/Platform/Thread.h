@@ -6,6 +6,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 /**
  * The macro places a std::recursive_mutex as member variable into a class.
@@ -82,6 +83,15 @@ public:
    */
   void setPriority(int prio) { priority = prio; changePriority(); }
 
+  /**
+   * The function restricts the calling thread to a set of cores.
+   * It is only implemented on Linux. On other platforms, it does nothing.
+   * @param cores The indices of the cores the calling thread may run on.
+   *              If empty, the current placement is not changed.
+   * @return The cores the calling thread may actually run on.
+   */
+  static std::vector<unsigned> setCurrentAffinity(const std::vector<unsigned>& cores);
+
   /**
    * The function determines whether the thread should still be running.
    * @return Should it continue?
@@ -79,22 +79,48 @@ unsigned Time::getCurrentSystemTime()
     return getRealSystemTime();
 }
 
+unsigned long long Time::getCurrentSystemTimeNs()
+{
+#ifndef TARGET_ROBOT
+  if(isInitialized)
+  {
+    if(isTimeSimulated)
+      return static_cast<unsigned long long>(static_cast<unsigned>(simulatedTime)) * 1000000ull;
+    else
+      return static_cast<unsigned long long>(static_cast<long long>(getRealSystemTimeNs()) + simulatedTime * 1000000ll);
+  }
+  else
+#endif
+    return getRealSystemTimeNs();
+}
+
 unsigned Time::getRealSystemTime()
+{
+  return static_cast<unsigned>(getRealSystemTimeNs() / 1000000);
+}
+
+unsigned long long Time::getRealSystemTimeNs()
 {
 #ifdef MACOS
   if(machTimebaseInfo.denom == 0)
     mach_timebase_info(&machTimebaseInfo);
-  const unsigned long long time = mach_absolute_time() * machTimebaseInfo.numer / machTimebaseInfo.denom / 1000000;
+  const unsigned long long time = mach_absolute_time() * machTimebaseInfo.numer / machTimebaseInfo.denom;
 #elif defined WINDOWS
-  const unsigned time = timeGetTime();
+  static LARGE_INTEGER frequency = { 0 };
+  if(frequency.QuadPart == 0)
+    QueryPerformanceFrequency(&frequency);
+  LARGE_INTEGER timeLL;
+  QueryPerformanceCounter(&timeLL);
+  const unsigned long long time = static_cast<unsigned long long>(timeLL.QuadPart / frequency.QuadPart * 1000000000ll
+                                                                  + timeLL.QuadPart % frequency.QuadPart * 1000000000ll / frequency.QuadPart);
 #elif defined LINUX
   timespec ts;
   clock_gettime(CLOCK_MONOTONIC, &ts); // NTP might change CLOCK_REALTIME on desktop systems
-  const unsigned long long time = ts.tv_sec * 1000ll + ts.tv_nsec / 1000000;
+  const unsigned long long time = ts.tv_sec * 1000000000ll + ts.tv_nsec;
 #endif
   if(!base)
-    base = time - 100000; // avoid time == 0, because it is often used as a marker
-  return static_cast<unsigned>(time - base);
+    base = time / 1000000 - 100000; // avoid time == 0, because it is often used as a marker
+  return time - base * 1000000;
 }
 
 unsigned long long Time::getCurrentThreadTime()
@@ -19,6 +19,24 @@ public:
   /** returns the real system time in milliseconds (never the simulated one)*/
   static unsigned getRealSystemTime();
 
+  /**
+   * returns the current system time in nanoseconds. It has the same origin as
+   * getCurrentSystemTime(), i.e. dividing it by 1000000 results in that time.
+   * If the time is simulated, there is no sub-millisecond part.
+   */
+  static unsigned long long getCurrentSystemTimeNs();
+
+  /** returns the real system time in nanoseconds (never the simulated one)*/
+  static unsigned long long getRealSystemTimeNs();
+
+  /**
+   * Converts a timestamp of the monotonic clock of the operating system, e.g.
+   * one attached to data by a driver, to the real system time.
+   * @param monotonicTime The timestamp in nanoseconds (CLOCK_MONOTONIC on Linux).
+   * @return The real system time in nanoseconds. 0 if the timestamp is older than the origin.
+   */
+  static unsigned long long fromMonotonicTimeNs(unsigned long long monotonicTime);
+
   /** returns an offset used to convert the time to the time provided by this class. */
   static unsigned long long getSystemTimeBase();
 
@@ -56,6 +74,12 @@ inline unsigned long long Time::getSystemTimeBase()
   return base;
 }
 
+inline unsigned long long Time::fromMonotonicTimeNs(unsigned long long monotonicTime)
+{
+  const unsigned long long offset = getSystemTimeBase() * 1000000ull;
+  return monotonicTime > offset ? monotonicTime - offset : 0;
+}
+
 inline int Time::getTimeSince(unsigned aTime)
 {
   return static_cast<int>(getCurrentSystemTime() - aTime);
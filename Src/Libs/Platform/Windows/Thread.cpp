@@ -69,3 +69,8 @@ const std::string Thread::getCurrentThreadName()
   demangleThreadName(name);
   return name;
 }
+
+std::vector<unsigned> Thread::setCurrentAffinity(const std::vector<unsigned>&)
+{
+  return {};
+}
@@ -70,3 +70,8 @@ void Thread::nameCurrentThread(const std::string& name)
   cname[sizeof(cname) - 1] = '\0';
   VERIFY(!pthread_setname_np(cname));
 }
+
+std::vector<unsigned> Thread::setCurrentAffinity(const std::vector<unsigned>&)
+{
+  return {};
+}
@@ -0,0 +1,375 @@
+/**
+ * @file Analyzer.cpp
+ *
+ * This file implements a class that computes statistics over logs natively.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "Analyzer.h"
+#include "Log.h"
+#include "Debugging/ColumnStream.h"
+#include "Debugging/DebugDataStreamer.h"
+#include "Streaming/InStreams.h"
+#include <pybind11/pybind11.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+/**
+ * Normalizes an angle to [-pi, pi].
+ * @param angle The angle.
+ * @return The normalized angle.
+ */
+static double normalize(double angle)
+{
+  return std::remainder(angle, 2.0 * std::numbers::pi);
+}
+
+void Analyzer::addChangeOscillation(const std::string& name, const std::string& thread, const std::string& field, unsigned threshold)
+{
+  checkName(name);
+  Rule rule;
+  rule.name = name;
+  rule.type = Type::change;
+  rule.thread = thread;
+  rule.fields.push_back(getField(thread, field));
+  rule.threshold = threshold;
+  rules.push_back(rule);
+}
+
+void Analyzer::addAngleOscillation(const std::string& name, const std::string& thread, const std::vector<std::string>& fields,
+                                   unsigned window, double threshold, const std::string& condition, double conditionValue)
+{
+  checkName(name);
+  if(fields.empty())
+    throw std::invalid_argument("Rule '" + name + "' does not observe any field.");
+  if(!window)
+    throw std::invalid_argument("The window of rule '" + name + "' is empty.");
+  Rule rule;
+  rule.name = name;
+  rule.type = Type::angle;
+  rule.thread = thread;
+  for(const std::string& field : fields)
+    rule.fields.push_back(getField(thread, field));
+  if(!condition.empty())
+    rule.condition = getField(thread, condition);
+  rule.conditionValue = conditionValue;
+  rule.window = window;
+  rule.angleThreshold = threshold;
+  rules.push_back(rule);
+}
+
+void Analyzer::addAnnotationFilter(const std::string& name, const std::string& pattern, const std::string& thread)
+{
+  checkName(name);
+  Rule rule;
+  rule.name = name;
+  rule.type = Type::annotation;
+  rule.thread = thread;
+  rule.pattern = std::regex(pattern); // Throws std::regex_error for invalid patterns.
+  rules.push_back(rule);
+}
+
+void Analyzer::addTiming(const std::string& name, const std::string& thread)
+{
+  checkName(name);
+  Rule rule;
+  rule.name = name;
+  rule.type = Type::timing;
+  rule.thread = thread;
+  rules.push_back(rule);
+}
+
+std::vector<Analyzer::Result> Analyzer::run(const std::vector<std::string>& paths, unsigned numOfThreads, bool keepGoing) const
+{
+  std::vector<Result> results(paths.size());
+  pybind11::gil_scoped_release release;
+
+  // Each thread takes the next log that was not analyzed yet, because logs differ in size.
+  if(!numOfThreads)
+    numOfThreads = std::max(1u, std::thread::hardware_concurrency());
+  numOfThreads = static_cast<unsigned>(std::min<std::size_t>(numOfThreads, paths.size()));
+  std::atomic<std::size_t> next = 0;
+  std::vector<std::thread> workers;
+  for(unsigned i = 0; i < numOfThreads; ++i)
+    workers.emplace_back([&]
+    {
+      for(std::size_t index = next++; index < paths.size(); index = next++)
+        results[index] = analyze(paths[index], keepGoing);
+    });
+  for(std::thread& worker : workers)
+    worker.join();
+  return results;
+}
+
+std::size_t Analyzer::getField(const std::string& thread, const std::string& field)
+{
+  const std::size_t separator = field.find('.');
+  if(separator == std::string::npos || separator == 0 || separator == field.size() - 1)
+    throw std::invalid_argument("Field '" + field + "' is not of the form 'Representation.path'.");
+  const Field newField = {thread, field.substr(0, separator), field.substr(separator + 1)};
+  for(std::size_t i = 0; i < fields.size(); ++i)
+    if(fields[i].thread == newField.thread && fields[i].representation == newField.representation && fields[i].path == newField.path)
+      return i;
+  fields.push_back(newField);
+  return fields.size() - 1;
+}
+
+void Analyzer::checkName(const std::string& name) const
+{
+  for(const Rule& rule : rules)
+    if(rule.name == name)
+      throw std::invalid_argument("There already is a rule named '" + name + "'.");
+}
+
+Analyzer::Result Analyzer::analyze(const std::string& path, bool keepGoing) const
+{
+  /** A representation of a thread from which fields are extracted. */
+  struct Source
+  {
+    std::string thread;
+    std::string representation;
+    MessageID logID = undefined; /**< The id of the representation in the log. undefined if the log does not contain it. */
+    std::unordered_map<std::string, std::size_t> columns; /**< Maps the paths of the fields to their indices. */
+  };
+
+  /** The state of a rule while the log is analyzed. */
+  struct State
+  {
+    unsigned updates = 0; /**< The number of updates so far. */
+    int lastChange = -1; /**< The update of the last change (change rules). */
+    double last = std::numeric_limits<double>::quiet_NaN(); /**< The last value (change rules). */
+    double lastAngle = 0.0; /**< The last angle (angle rules). */
+    std::vector<double> differences; /**< The window of angular differences (angle rules). */
+    double sum = 0.0; /**< The sum of the window (angle rules). */
+    std::unordered_map<unsigned short, std::string> names; /**< The names of the stopwatches (timing rules). */
+    std::unordered_map<unsigned short, std::vector<unsigned>> times; /**< The times measured per stopwatch (timing rules). */
+  };
+
+  Result result;
+  result.path = path;
+  for(const Rule& rule : rules)
+    result.rules[rule.name];
+
+  try
+  {
+    const Log log(path, keepGoing);
+
+    std::vector<Source> sources;
+    for(std::size_t i = 0; i < fields.size(); ++i)
+    {
+      const Field& field = fields[i];
+      auto source = std::find_if(sources.begin(), sources.end(), [&](const Source& source)
+      {
+        return source.thread == field.thread && source.representation == field.representation;
+      });
+      if(source == sources.end())
+      {
+        source = sources.emplace(sources.end());
+        source->thread = field.thread;
+        source->representation = field.representation;
+        const auto name = std::find(log.messageIDNames->begin(), log.messageIDNames->end(), "id" + field.representation);
+        if(name != log.messageIDNames->end() && log.typeInfo.classes.contains(field.representation))
+          source->logID = static_cast<MessageID>(name - log.messageIDNames->begin());
+      }
+      source->columns.emplace(field.path, i);
+    }
+
+    std::vector<State> states(rules.size());
+    for(std::size_t i = 0; i < rules.size(); ++i)
+      if(rules[i].type == Type::angle)
+        states[i].differences.resize(rules[i].window, 0.0);
+
+    std::vector<std::vector<double>> values(fields.size(), std::vector<double>(1));
+    std::vector<Annotation> annotations;
+    std::vector<MessageQueue::Message> stopwatches;
+    std::string thread;
+    int frame = -1;
+
+    // Updates all rules of the thread of the frame that just ended.
+    auto update = [&]
+    {
+      for(std::size_t i = 0; i < rules.size(); ++i)
+      {
+        const Rule& rule = rules[i];
+        if(!rule.thread.empty() && rule.thread != thread)
+          continue;
+        State& state = states[i];
+        RuleResult& ruleResult = result.rules[rule.name];
+
+        switch(rule.type)
+        {
+          case Type::change:
+          {
+            const double value = values[rule.fields[0]][0];
+            if(std::isnan(value))
+              break;
+            if(!std::isnan(state.last) && value != state.last)
+            {
+              if(static_cast<int>(state.updates) - state.lastChange < static_cast<int>(rule.threshold))
+              {
+                ++ruleResult.hits;
+                ruleResult.events.push_back({frame, thread, state.updates, state.last, value, ""});
+              }
+              state.lastChange = static_cast<int>(state.updates);
+            }
+            state.last = value;
+            ++state.updates;
+            break;
+          }
+
+          case Type::angle:
+          {
+            double angle = 0.0;
+            for(std::size_t field : rule.fields)
+              angle += values[field][0];
+            if(std::isnan(angle))
+              break;
+            if(rule.condition != noField)
+            {
+              const double condition = values[rule.condition][0];
+              if(std::isnan(condition))
+                break;
+              if(condition != rule.conditionValue)
+              {
+                std::fill(state.differences.begin(), state.differences.end(), 0.0);
+                state.sum = 0.0;
+                state.lastAngle = 0.0;
+                break;
+              }
+            }
+            angle = normalize(angle);
+            double& difference = state.differences[state.updates % rule.window];
+            state.sum -= difference;
+            difference = std::abs(normalize(state.lastAngle - angle));
+            state.sum += difference;
+            state.lastAngle = angle;
+            const double mean = state.sum / rule.window;
+            if(mean > rule.angleThreshold)
+            {
+              ++ruleResult.hits;
+              ruleResult.events.push_back({frame, thread, state.updates, std::numeric_limits<double>::quiet_NaN(), mean, ""});
+            }
+            ++state.updates;
+            break;
+          }
+
+          case Type::annotation:
+            for(const Annotation& annotation : annotations)
+              if(std::regex_search(annotation.name, rule.pattern) || std::regex_search(annotation.description, rule.pattern))
+              {
+                ++ruleResult.hits;
+                ruleResult.events.push_back({frame, thread, state.updates++, std::numeric_limits<double>::quiet_NaN(),
+                                             std::numeric_limits<double>::quiet_NaN(), annotation.name + " - " + annotation.description});
+              }
+            break;
+
+          case Type::timing:
+            for(const MessageQueue::Message& message : stopwatches)
+            {
+              // See TimingManager::signalThreadStop for the format.
+              InBinaryMemory stream = message.bin();
+              unsigned short count;
+              stream >> count;
+              for(unsigned short j = 0; j < count; ++j)
+              {
+                unsigned short id;
+                stream >> id;
+                stream >> state.names[id];
+              }
+              stream >> count;
+              for(unsigned short j = 0; j < count; ++j)
+              {
+                unsigned short id;
+                unsigned time;
+                stream >> id >> time;
+                state.times[id].push_back(time);
+              }
+              ++ruleResult.hits;
+            }
+            break;
+        }
+      }
+    };
+
+    bool isFrameOpen = false;
+    for(MessageQueue::Message message : log)
+    {
+      const MessageID id = log.id(message);
+      if(id == idFrameBegin)
+      {
+        if(isFrameOpen)
+        {
+          if(!keepGoing)
+            throw std::runtime_error("Frame does not end with idFrameFinished.");
+          update();
+        }
+        message.bin() >> thread;
+        ++frame;
+        isFrameOpen = true;
+        annotations.clear();
+        stopwatches.clear();
+        for(std::vector<double>& value : values)
+          value[0] = std::numeric_limits<double>::quiet_NaN();
+      }
+      else if(!isFrameOpen)
+        continue;
+      else if(id == idFrameFinished)
+      {
+        std::string thread2;
+        message.bin() >> thread2;
+        if(thread != thread2)
+          throw std::runtime_error("Frame does not end with matching idFrameFinished.");
+        update();
+        isFrameOpen = false;
+      }
+      else if(id == idAnnotation)
+        annotations.push_back(Frame::readAnnotation(message));
+      else if(id == idStopwatch)
+        stopwatches.push_back(message);
+      else
+        for(const Source& source : sources)
+          if(source.logID == message.id() && source.thread == thread)
+          {
+            InBinaryMemory in = message.bin();
+            ColumnStream out(source.columns, values, 0);
+            DebugDataStreamer streamer(log.schema, in, source.representation);
+            out << streamer;
+          }
+    }
+    if(isFrameOpen)
+    {
+      if(!keepGoing)
+        throw std::runtime_error("Frame does not end with idFrameFinished.");
+      update();
+    }
+    result.frames = frame + 1;
+
+    for(std::size_t i = 0; i < rules.size(); ++i)
+      for(auto& [id, times] : states[i].times)
+      {
+        const auto name = states[i].names.find(id);
+        WatchStatistics& watch = result.rules[rules[i].name].watches[name == states[i].names.end() ? "#" + std::to_string(id) : name->second];
+        watch.count = static_cast<unsigned>(times.size());
+        double sum = 0.0;
+        for(unsigned time : times)
+          sum += time;
+        watch.mean = sum / times.size();
+        std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+        watch.median = times[times.size() / 2];
+        std::nth_element(times.begin(), times.begin() + times.size() * 95 / 100, times.end());
+        watch.p95 = times[times.size() * 95 / 100];
+        watch.max = *std::max_element(times.begin(), times.end());
+      }
+  }
+  catch(const std::exception& e)
+  {
+    result.error = e.what();
+  }
+  return result;
+}
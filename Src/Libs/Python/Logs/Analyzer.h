@@ -0,0 +1,163 @@
+/**
+ * @file Analyzer.h
+ *
+ * This file declares a class that computes statistics over logs natively.
+ * It is configured with a set of rules. Each log is then read only once and
+ * all rules are evaluated while streaming through its frames. Several logs
+ * are analyzed in parallel without holding the GIL.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include <limits>
+#include <map>
+#include <regex>
+#include <string>
+#include <vector>
+
+class Analyzer
+{
+public:
+  /** A hit of a rule. */
+  struct Event
+  {
+    int frame; /**< The number of the frame in the log. */
+    std::string thread; /**< The thread of the frame. */
+    unsigned update; /**< The number of updates of the rule before this hit. */
+    double previous; /**< The value before a change or NaN. */
+    double value; /**< The value after a change or the mean angular difference. NaN for annotations. */
+    std::string text; /**< The annotation ("name - description") or an empty string. */
+  };
+
+  /** The statistics of a stopwatch. All times are in microseconds. */
+  struct WatchStatistics
+  {
+    unsigned count = 0; /**< The number of measurements. */
+    double mean = 0.0; /**< The mean time. */
+    double median = 0.0; /**< The median time. */
+    double p95 = 0.0; /**< The 95% quantile. */
+    unsigned max = 0; /**< The longest time. */
+  };
+
+  /** The results of a single rule for a single log. */
+  struct RuleResult
+  {
+    unsigned hits = 0; /**< The number of hits. For timing rules, the number of frames with timing data. */
+    std::vector<Event> events; /**< The hits (not for timing rules). */
+    std::map<std::string, WatchStatistics> watches; /**< The statistics of all stopwatches (only for timing rules). */
+  };
+
+  /** The results of all rules for a single log. */
+  struct Result
+  {
+    std::string path; /**< The path of the log. */
+    std::string error; /**< Empty if the log could be analyzed completely. Otherwise, the reason why it could not. */
+    int frames = 0; /**< The number of frames analyzed. */
+    std::map<std::string, RuleResult> rules; /**< The results per rule name. */
+  };
+
+  /**
+   * Adds a rule that detects a field that changes its value again after less
+   * than a certain number of updates.
+   * @param name The name of the rule.
+   * @param thread The name of the thread.
+   * @param field The field as "Representation.path", e.g. "MotionRequest.motion".
+   * @param threshold A change is a hit if the previous change happened less than this many updates ago.
+   */
+  void addChangeOscillation(const std::string& name, const std::string& thread, const std::string& field, unsigned threshold);
+
+  /**
+   * Adds a rule that detects an angle that oscillates, i.e. the mean of the
+   * absolute differences between consecutive angles within a window exceeds a threshold.
+   * @param name The name of the rule.
+   * @param thread The name of the thread.
+   * @param fields The fields whose sum is the angle observed (each as "Representation.path").
+   * @param window The number of updates averaged over.
+   * @param threshold The threshold for the mean difference (in radians).
+   * @param condition The rule is only updated while this field has the value \c conditionValue.
+   *                  The window is cleared otherwise. No condition if empty.
+   * @param conditionValue The value \c condition must have.
+   */
+  void addAngleOscillation(const std::string& name, const std::string& thread, const std::vector<std::string>& fields,
+                           unsigned window, double threshold, const std::string& condition, double conditionValue);
+
+  /**
+   * Adds a rule that collects the annotations whose name or description contain
+   * a regular expression.
+   * @param name The name of the rule.
+   * @param pattern The regular expression (ECMAScript). Empty matches all annotations.
+   * @param thread Only annotations of this thread are collected. All threads if empty.
+   */
+  void addAnnotationFilter(const std::string& name, const std::string& pattern, const std::string& thread);
+
+  /**
+   * Adds a rule that accumulates the times measured by the stopwatches of a thread.
+   * @param name The name of the rule.
+   * @param thread The name of the thread.
+   */
+  void addTiming(const std::string& name, const std::string& thread);
+
+  /**
+   * Analyzes logs in parallel. The GIL is released meanwhile.
+   * @param paths The paths of the logs.
+   * @param numOfThreads The number of threads used. 0 means one per hardware thread.
+   * @param keepGoing Whether corrupt frames should be ignored as much as possible.
+   * @return The results per log in the order of \c paths.
+   */
+  std::vector<Result> run(const std::vector<std::string>& paths, unsigned numOfThreads, bool keepGoing) const;
+
+private:
+  static constexpr std::size_t noField = std::numeric_limits<std::size_t>::max(); /**< Marks a missing field. */
+
+  enum class Type {change, angle, annotation, timing};
+
+  /** A field of a representation. */
+  struct Field
+  {
+    std::string thread; /**< The thread the representation is read from. */
+    std::string representation; /**< The name of the representation. */
+    std::string path; /**< The path of the field within the representation. */
+  };
+
+  /** The configuration of a rule. */
+  struct Rule
+  {
+    std::string name;
+    Type type;
+    std::string thread; /**< The thread of the frames the rule is updated in. Empty means all threads. */
+    std::vector<std::size_t> fields; /**< The indices of the fields observed. */
+    std::size_t condition = noField; /**< The index of the condition field or \c noField. */
+    double conditionValue = 0.0; /**< The value the condition field must have. */
+    unsigned threshold = 0; /**< The number of updates for change rules. */
+    unsigned window = 0; /**< The size of the window for angle rules. */
+    double angleThreshold = 0.0; /**< The threshold for angle rules (in radians). */
+    std::regex pattern; /**< The pattern for annotation rules. */
+  };
+
+  /**
+   * Returns the index of a field. It is added if it was not used before.
+   * @param thread The thread the representation is read from.
+   * @param field The field as "Representation.path".
+   * @return The index of the field.
+   */
+  std::size_t getField(const std::string& thread, const std::string& field);
+
+  /**
+   * Checks that no other rule has the same name.
+   * @param name The name of a new rule.
+   */
+  void checkName(const std::string& name) const;
+
+  /**
+   * Analyzes a single log.
+   * @param path The path of the log.
+   * @param keepGoing Whether corrupt frames should be ignored as much as possible.
+   * @return The results of all rules.
+   */
+  Result analyze(const std::string& path, bool keepGoing) const;
+
+  std::vector<Field> fields; /**< All fields used by the rules. */
+  std::vector<Rule> rules; /**< All rules. */
+};
@@ -56,21 +56,7 @@ bool Frame::readFrame()
       throw std::runtime_error("Frame does not end with idFrameFinished.");
     }
     else if(id == idAnnotation)
-    {
-      auto stream = message.bin();
-      unsigned unused;
-      std::string name;
-      stream >> unused;
-      if(!(unused & 0x80000000u))
-        stream >> unused;
-      const size_t size = stream.getSize() - stream.getPosition();
-      std::string text;
-      text.resize(size);
-      stream.read(text.data(), size);
-      InTextMemory textStream(text.data(), size);
-      textStream >> name;
-      annotations.emplace_back(name, textStream.readAll());
-    }
+      annotations.push_back(readAnnotation(message));
     else if(id == idStopwatch)
     {
       // TODO: implement
@@ -86,6 +72,23 @@ bool Frame::readFrame()
   return false;
 }
 
+Annotation Frame::readAnnotation(const MessageQueue::Message& message)
+{
+  auto stream = message.bin();
+  unsigned unused;
+  std::string name;
+  stream >> unused;
+  if(!(unused & 0x80000000u))
+    stream >> unused;
+  const size_t size = stream.getSize() - stream.getPosition();
+  std::string text;
+  text.resize(size);
+  stream.read(text.data(), size);
+  InTextMemory textStream(text.data(), size);
+  textStream >> name;
+  return Annotation(name, textStream.readAll());
+}
+
 Frame& Frame::next()
 {
   ++frameNumber;
@@ -94,7 +97,17 @@ Frame& Frame::next()
   return *this;
 }
 
-Record Frame::getitem(const std::string& representation)
+LazyRecord Frame::getitem(const std::string& representation)
+{
+  auto it = representations.find(representation);
+  if(it == representations.end())
+    throw pybind11::key_error("Frame has no representation '" + representation + "'");
+  if(!log.typeInfo.classes.contains(representation))
+    throw pybind11::key_error("Log has no type information for '" + representation + "'");
+  return LazyRecord(log.layout, representation, it->second.data(), it->second.size(), true);
+}
+
+Record Frame::decode(const std::string& representation)
 {
   auto it = representations.find(representation);
   if(it == representations.end())
@@ -103,7 +116,7 @@ Record Frame::getitem(const std::string& representation)
   Record value;
   auto in = it->second.bin();
   TypeStream out(value);
-  DebugDataStreamer streamer(log.typeInfo, in, representation, nullptr);
+  DebugDataStreamer streamer(log.schema, in, representation, nullptr);
   out << streamer;
   if(!in.eof())
   {
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "Lazy.h"
 #include "Types.h"
 #include "Streaming/MessageQueue.h"
 #include <cstddef>
@@ -41,8 +42,14 @@ public:
     return annotations;
   }
 
-  /** Returns the representation with the given name. */
-  Record getitem(const std::string& representation);
+  /**
+   * Returns the representation with the given name. Its fields are only
+   * decoded when they are accessed.
+   */
+  LazyRecord getitem(const std::string& representation);
+
+  /** Returns the representation with the given name completely decoded. */
+  Record decode(const std::string& representation);
 
   bool contains(const std::string& representation) const
   {
@@ -54,6 +61,13 @@ public:
 
   bool readFrame();
 
+  /**
+   * Reads an annotation from a log.
+   * @param message The message with the id \c idAnnotation.
+   * @return The annotation.
+   */
+  static Annotation readAnnotation(const MessageQueue::Message& message);
+
   std::string thread;
 
 private:
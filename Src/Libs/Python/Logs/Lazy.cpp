@@ -0,0 +1,344 @@
+/**
+ * @file Lazy.cpp
+ *
+ * This file implements proxies for data in a log that only decode the fields
+ * that are actually accessed.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "Lazy.h"
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+/**
+ * Checks that a value fits into the data available.
+ * @param size The size of the value.
+ * @param available The number of bytes available.
+ */
+static void check(std::size_t size, std::size_t available)
+{
+  if(size > available)
+    throw std::runtime_error("Data ends unexpectedly.");
+}
+
+/**
+ * Reads a primitive value in binary format.
+ * @param T The type of the value.
+ * @param data The beginning of the value.
+ * @param available The number of bytes available at \c data.
+ * @return The value.
+ */
+template<typename T> static T read(const char* data, std::size_t available)
+{
+  check(sizeof(T), available);
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+/**
+ * Returns the size of a primitive type in binary format.
+ * @param type The name of the primitive type.
+ * @return The size or \c Layout::variable for strings.
+ */
+static std::size_t getPrimitiveSize(const std::string& type)
+{
+  if(type == "char" || type == "signed char" || type == "unsigned char" || type == "bool")
+    return 1;
+  else if(type == "short" || type == "unsigned short")
+    return 2;
+  else if(type == "int" || type == "unsigned" || type == "unsigned int" || type == "float" || type == "Angle")
+    return 4;
+  else if(type == "double")
+    return 8;
+  else if(type == "std::string")
+    return Layout::variable;
+  else
+    throw std::runtime_error(type + " is not a streamable type!");
+}
+
+bool Layout::splitArray(const std::string& type, std::string& elementType, std::size_t& count)
+{
+  if(type.back() == ']')
+  {
+    const std::size_t endOfType = type.find_last_of('[');
+    count = std::atoi(&type[endOfType + 1]);
+    elementType = type.substr(0, endOfType);
+    return true;
+  }
+  else if(type.back() == '*')
+  {
+    count = variable;
+    elementType = type.substr(0, type.size() - 1);
+    return true;
+  }
+  else
+    return false;
+}
+
+std::size_t Layout::getFixedSize(const std::string& type) const
+{
+  const auto cached = sizes.find(type);
+  if(cached != sizes.end())
+    return cached->second;
+
+  std::size_t size;
+  std::string elementType;
+  std::size_t count;
+  if(splitArray(type, elementType, count))
+  {
+    const std::size_t elementSize = getFixedSize(elementType);
+    size = count == variable || elementSize == variable ? variable : count * elementSize;
+  }
+  else if(typeInfo.primitives.contains(type))
+    size = getPrimitiveSize(type);
+  else if(typeInfo.enums.contains(type))
+    size = 1;
+  else if(typeInfo.classes.contains(type))
+    size = getFixedOffsets(type).back();
+  else
+    throw std::runtime_error("Specification for " + type + " not found");
+  sizes.emplace(type, size);
+  return size;
+}
+
+const std::vector<std::size_t>& Layout::getFixedOffsets(const std::string& type) const
+{
+  const auto cached = offsets.find(type);
+  if(cached != offsets.end())
+    return cached->second;
+
+  std::vector<std::size_t> result;
+  std::size_t offset = 0;
+  for(const TypeInfo::Attribute& attribute : typeInfo.classes.at(type))
+  {
+    result.push_back(offset);
+    if(offset != variable)
+    {
+      const std::size_t size = getFixedSize(attribute.type);
+      offset = size == variable ? variable : offset + size;
+    }
+  }
+  result.push_back(offset); // The end of the class.
+  return offsets.emplace(type, std::move(result)).first->second;
+}
+
+std::size_t Layout::getSize(const std::string& type, const char* data, std::size_t available) const
+{
+  const std::size_t fixedSize = getFixedSize(type);
+  if(fixedSize != variable)
+  {
+    check(fixedSize, available);
+    return fixedSize;
+  }
+
+  std::size_t size = 0;
+  std::string elementType;
+  std::size_t count;
+  if(splitArray(type, elementType, count))
+  {
+    if(count == variable)
+    {
+      count = read<unsigned>(data, available);
+      size = sizeof(unsigned);
+    }
+    const std::size_t elementSize = getFixedSize(elementType);
+    if(elementSize != variable)
+    {
+      check(count * elementSize, available - size);
+      size += count * elementSize;
+    }
+    else
+      for(std::size_t i = 0; i < count; ++i)
+        size += getSize(elementType, data + size, available - size);
+  }
+  else if(typeInfo.classes.contains(type))
+  {
+    for(const TypeInfo::Attribute& attribute : typeInfo.classes.at(type))
+      size += getSize(attribute.type, data + size, available - size);
+  }
+  else // std::string
+  {
+    size = sizeof(unsigned) + read<unsigned>(data, available);
+    check(size, available);
+  }
+  return size;
+}
+
+PyTypeVariant LazyValue::decode(const std::string& partType, std::size_t offset, std::unique_ptr<Value>& cache) const
+{
+  if(cache)
+    return cache.get();
+
+  const char* partData = data + offset;
+  const std::size_t partAvailable = available - offset;
+  std::string elementType;
+  std::size_t count;
+  if(Layout::splitArray(partType, elementType, count))
+  {
+    cache = std::make_unique<LazyArray>(layout, partType, partData, partAvailable);
+    return cache.get();
+  }
+  else if(layout.typeInfo.classes.contains(partType))
+  {
+    cache = std::make_unique<LazyRecord>(layout, partType, partData, partAvailable);
+    return cache.get();
+  }
+  else if(layout.typeInfo.enums.contains(partType) || partType == "unsigned char")
+    return pybind11::int_(static_cast<unsigned long>(read<unsigned char>(partData, partAvailable)));
+  else if(partType == "char")
+    return pybind11::int_(static_cast<long>(read<char>(partData, partAvailable)));
+  else if(partType == "signed char")
+    return pybind11::int_(static_cast<long>(read<signed char>(partData, partAvailable)));
+  else if(partType == "short")
+    return pybind11::int_(static_cast<long>(read<short>(partData, partAvailable)));
+  else if(partType == "unsigned short")
+    return pybind11::int_(static_cast<unsigned long>(read<unsigned short>(partData, partAvailable)));
+  else if(partType == "int")
+    return pybind11::int_(static_cast<long>(read<int>(partData, partAvailable)));
+  else if(partType == "unsigned" || partType == "unsigned int")
+    return pybind11::int_(static_cast<unsigned long>(read<unsigned>(partData, partAvailable)));
+  else if(partType == "float" || partType == "Angle")
+    return pybind11::float_(static_cast<double>(read<float>(partData, partAvailable)));
+  else if(partType == "double")
+    return pybind11::float_(read<double>(partData, partAvailable));
+  else if(partType == "bool")
+    return pybind11::bool_(read<char>(partData, partAvailable) != 0);
+  else if(partType == "std::string")
+  {
+    const unsigned length = read<unsigned>(partData, partAvailable);
+    check(sizeof(unsigned) + length, partAvailable);
+    return pybind11::str(std::string(partData + sizeof(unsigned), length));
+  }
+  else
+    throw std::runtime_error("Specification for " + partType + " not found");
+}
+
+LazyRecord::LazyRecord(const Layout& layout, const std::string& type, const char* data, std::size_t available, bool withData) :
+  LazyValue(layout, type, data, available),
+  attributes(layout.typeInfo.classes.at(type)),
+  withData(withData),
+  cache(attributes.size())
+{}
+
+std::size_t LazyRecord::getOffset(std::size_t index) const
+{
+  if(offsets.empty())
+    offsets = layout.getFixedOffsets(type);
+
+  // Skip the attributes from the last one with a known offset.
+  std::size_t i = index;
+  while(offsets[i] == Layout::variable)
+    --i;
+  for(; i < index; ++i)
+  {
+    check(offsets[i], available);
+    offsets[i + 1] = offsets[i] + layout.getSize(attributes[i].type, data + offsets[i], available - offsets[i]);
+  }
+  check(offsets[index], available);
+  return offsets[index];
+}
+
+PyTypeVariant LazyRecord::getattr(const std::string& name) const
+{
+  for(std::size_t i = 0; i < attributes.size(); ++i)
+    if(attributes[i].name == name)
+      return decode(attributes[i].type, getOffset(i), cache[i]);
+  if(name == "_data" && withData && getOffset(attributes.size()) < available)
+    return pybind11::bytes(data, available);
+  throw pybind11::attribute_error("Record has no attribute '" + name + "'");
+}
+
+const std::vector<std::string>& LazyRecord::getKeys() const
+{
+  if(keys.empty())
+  {
+    keys.reserve(attributes.size() + 1);
+    for(const TypeInfo::Attribute& attribute : attributes)
+      keys.push_back(attribute.name);
+    if(withData && getOffset(attributes.size()) < available)
+      keys.push_back("_data");
+  }
+  return keys;
+}
+
+LazyArray::LazyArray(const Layout& layout, const std::string& type, const char* data, std::size_t available) :
+  LazyValue(layout, type, data, available)
+{
+  Layout::splitArray(type, elementType, count);
+  begin = 0;
+  if(count == Layout::variable)
+  {
+    count = read<unsigned>(data, available);
+    begin = sizeof(unsigned);
+  }
+  elementSize = layout.getFixedSize(elementType);
+  if(elementSize != Layout::variable)
+    check(count * elementSize, available - begin);
+  isScalar = layout.typeInfo.enums.contains(elementType)
+             || (layout.typeInfo.primitives.contains(elementType) && elementType != "std::string");
+}
+
+PyTypeVariant LazyArray::getitem(std::size_t index) const
+{
+  if(index >= count)
+    throw pybind11::index_error("Array index out of range");
+
+  std::size_t offset;
+  if(elementSize != Layout::variable)
+    offset = begin + index * elementSize;
+  else
+  {
+    if(offsets.empty())
+    {
+      offsets.resize(count + 1, Layout::variable);
+      offsets[0] = begin;
+    }
+    std::size_t i = index;
+    while(offsets[i] == Layout::variable)
+      --i;
+    for(; i < index; ++i)
+      offsets[i + 1] = offsets[i] + layout.getSize(elementType, data + offsets[i], available - offsets[i]);
+    offset = offsets[index];
+  }
+
+  if(isScalar || elementType == "std::string")
+  {
+    std::unique_ptr<Value> unused;
+    return decode(elementType, offset, unused);
+  }
+  if(cache.empty())
+    cache.resize(count);
+  return decode(elementType, offset, cache[index]);
+}
+
+pybind11::array LazyArray::numpy(pybind11::handle base) const
+{
+  std::string format;
+  if(layout.typeInfo.enums.contains(elementType) || elementType == "unsigned char")
+    format = "B";
+  else if(elementType == "char" || elementType == "signed char")
+    format = "b";
+  else if(elementType == "bool")
+    format = "?";
+  else if(elementType == "short")
+    format = "h";
+  else if(elementType == "unsigned short")
+    format = "H";
+  else if(elementType == "int")
+    format = "i";
+  else if(elementType == "unsigned" || elementType == "unsigned int")
+    format = "I";
+  else if(elementType == "float" || elementType == "Angle")
+    format = "f";
+  else if(elementType == "double")
+    format = "d";
+  else
+    throw pybind11::type_error("Only arrays of numbers, bools, and enums can be mapped, not of " + elementType + ".");
+
+  pybind11::array result(pybind11::dtype(format), {count}, {elementSize}, data + begin, base);
+  result.attr("flags").attr("writeable") = false;
+  return result;
+}
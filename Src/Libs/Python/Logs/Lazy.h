@@ -0,0 +1,177 @@
+/**
+ * @file Lazy.h
+ *
+ * This file declares proxies for data in a log that only decode the fields
+ * that are actually accessed. The offsets of the fields are computed from
+ * the type information of the log. For types with a fixed layout, i.e.
+ * without strings and dynamic arrays, they are computed only once per type.
+ * Otherwise, the preceding fields are skipped without decoding them. Arrays
+ * of numbers can be mapped as NumPy arrays onto the memory of the log.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Types.h"
+#include "Streaming/TypeInfo.h"
+#include <pybind11/numpy.h>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/** Computes the sizes and the offsets of types in the binary format of a log. */
+class Layout
+{
+public:
+  static constexpr std::size_t variable = std::numeric_limits<std::size_t>::max(); /**< The size or offset is not fixed. */
+
+  /**
+   * Constructor.
+   * @param typeInfo The type information of the log.
+   */
+  Layout(const TypeInfo& typeInfo) : typeInfo(typeInfo) {}
+
+  /**
+   * Returns the size of a type if all its values have the same size.
+   * @param type The name of the type.
+   * @return The size in bytes or \c variable.
+   */
+  std::size_t getFixedSize(const std::string& type) const;
+
+  /**
+   * Returns the offsets of all attributes of a class that are the same for all of its values.
+   * @param type The name of the class.
+   * @return The offset per attribute. All attributes after one of variable size have the offset \c variable.
+   */
+  const std::vector<std::size_t>& getFixedOffsets(const std::string& type) const;
+
+  /**
+   * Returns the size of a value.
+   * @param type The name of the type of the value.
+   * @param data The beginning of the value.
+   * @param available The number of bytes available at \c data.
+   * @return The size of the value in bytes.
+   */
+  std::size_t getSize(const std::string& type, const char* data, std::size_t available) const;
+
+  /**
+   * Splits the type of an array.
+   * @param type The name of the type.
+   * @param elementType The type of the elements is stored here.
+   * @param count The number of elements of a static array or \c variable for a dynamic array is stored here.
+   * @return Is the type an array?
+   */
+  static bool splitArray(const std::string& type, std::string& elementType, std::size_t& count);
+
+  const TypeInfo& typeInfo; /**< The type information of the log. */
+
+private:
+  mutable std::unordered_map<std::string, std::size_t> sizes; /**< The cached results of getFixedSize. */
+  mutable std::unordered_map<std::string, std::vector<std::size_t>> offsets; /**< The cached results of getFixedOffsets. */
+};
+
+/** A proxy for a value in a log that only decodes its parts when they are accessed. */
+class LazyValue : public Value
+{
+protected:
+  /**
+   * Constructor.
+   * @param layout The layout of the types of the log.
+   * @param type The name of the type of the value.
+   * @param data The beginning of the value.
+   * @param available The number of bytes available at \c data.
+   */
+  LazyValue(const Layout& layout, const std::string& type, const char* data, std::size_t available) :
+    layout(layout), type(type), data(data), available(available)
+  {}
+
+  /**
+   * Decodes a part of this value.
+   * @param partType The type of the part.
+   * @param offset The offset of the part relative to the beginning of this value.
+   * @param cache A primitive is decoded directly. For other types, the proxy is stored here.
+   * @return The primitive value or the proxy, which is owned by this value.
+   */
+  PyTypeVariant decode(const std::string& partType, std::size_t offset, std::unique_ptr<Value>& cache) const;
+
+  const Layout& layout; /**< The layout of the types of the log. */
+  std::string type; /**< The name of the type of this value. */
+  const char* data; /**< The beginning of this value. */
+  std::size_t available; /**< The number of bytes available at \c data. */
+};
+
+/** A proxy for a streamable class in a log. */
+class LazyRecord : public LazyValue
+{
+public:
+  /**
+   * Constructor.
+   * @param layout The layout of the types of the log.
+   * @param type The name of the class.
+   * @param data The beginning of the value.
+   * @param available The number of bytes available at \c data.
+   * @param withData Provide the attribute "_data" with all bytes if they are not completely described by the type?
+   */
+  LazyRecord(const Layout& layout, const std::string& type, const char* data, std::size_t available, bool withData = false);
+
+  /** Returns the attribute with the given name. */
+  PyTypeVariant getattr(const std::string& name) const;
+
+  /** Returns all attribute names of this record. */
+  const std::vector<std::string>& getKeys() const;
+
+private:
+  /**
+   * Returns the offset of an attribute. Attributes without a fixed offset are
+   * located by skipping the attributes before them once.
+   * @param index The index of the attribute. The number of attributes returns the end of the record.
+   * @return The offset relative to the beginning of the record.
+   */
+  std::size_t getOffset(std::size_t index) const;
+
+  const std::vector<TypeInfo::Attribute>& attributes; /**< The attributes of the class. */
+  bool withData; /**< Provide the attribute "_data"? */
+  mutable std::vector<std::size_t> offsets; /**< The offsets of all attributes and the end of the record. Unknown ones are \c Layout::variable. */
+  mutable std::vector<std::unique_ptr<Value>> cache; /**< The proxies of the attributes that were accessed. */
+  mutable std::vector<std::string> keys; /**< The names of all attributes. Empty if not computed yet. */
+};
+
+/** A proxy for an array in a log. */
+class LazyArray : public LazyValue
+{
+public:
+  /**
+   * Constructor.
+   * @param layout The layout of the types of the log.
+   * @param type The name of the type of the array.
+   * @param data The beginning of the value.
+   * @param available The number of bytes available at \c data.
+   */
+  LazyArray(const Layout& layout, const std::string& type, const char* data, std::size_t available);
+
+  /** Returns the number of elements. */
+  std::size_t size() const {return count;}
+
+  /** Returns the element with the given index. */
+  PyTypeVariant getitem(std::size_t index) const;
+
+  /**
+   * Maps the array onto the memory of the log, which must not be released
+   * while the result is in use.
+   * @param base The Python object that keeps the memory alive.
+   * @return A read-only NumPy array. Only arrays of numbers, bools, and enums can be mapped.
+   */
+  pybind11::array numpy(pybind11::handle base) const;
+
+private:
+  std::string elementType; /**< The type of the elements. */
+  std::size_t count; /**< The number of elements. */
+  std::size_t elementSize; /**< The size of each element or \c Layout::variable. */
+  std::size_t begin; /**< The offset of the first element. */
+  bool isScalar; /**< Are the elements numbers, bools, or enums, i.e. they are not cached? */
+  mutable std::vector<std::size_t> offsets; /**< The offsets of elements of variable size. Unknown ones are \c Layout::variable. */
+  mutable std::vector<std::unique_ptr<Value>> cache; /**< The proxies of the elements that were accessed. */
+};
@@ -8,11 +8,18 @@
  */
 
 #include "Log.h"
+#include "Debugging/ColumnStream.h"
+#include "Debugging/DebugDataStreamer.h"
 #include "Framework/LoggingTools.h"
 #include "Platform/File.h"
 #include "Streaming/InStreams.h"
+#include <pybind11/numpy.h>
 #include <snappy-c.h>
+#include <algorithm>
+#include <limits>
+#include <regex>
 #include <stdexcept>
+#include <thread>
 
 Log::Log(const std::string& path, bool keepGoing) :
   typeInfo(false),
@@ -48,6 +55,7 @@ Log::Log(const std::string& path, bool keepGoing) :
   messageIDNames = &messageIDEnum->second;
 
   // TODO: do not read everything into memory at once
+  bool hasIndex = false;
   switch(magicByte)
   {
     case LoggingTools::logFileUncompressed:
@@ -58,6 +66,11 @@ Log::Log(const std::string& path, bool keepGoing) :
       const size_t position = stream.getPosition();
       if(header.messages == 0x0fffffff)
         usedSize = stream.getSize() - position;
+      else if(usedSize != stream.getSize() - position)
+      {
+        stream.skip(usedSize);
+        hasIndex = readIndex(stream, usedSize);
+      }
       setBuffer(file->getData() + position, usedSize);
       this->file = std::move(file);
       break;
@@ -68,8 +81,11 @@ Log::Log(const std::string& path, bool keepGoing) :
       {
         unsigned compressedSize;
         stream >> compressedSize;
-        if(!compressedSize)
-          throw std::runtime_error("Corrupt compressed log file.");
+        if(!compressedSize) // End of compressed data -> an index written by the logger follows.
+        {
+          hasIndex = readIndex(stream, size());
+          break;
+        }
         std::vector<char> compressedBuffer(compressedSize);
         stream.read(compressedBuffer.data(), compressedSize);
 
@@ -85,11 +101,41 @@ Log::Log(const std::string& path, bool keepGoing) :
       throw std::runtime_error("Unknown magic byte!");
   }
 
-  // Calc numberOfFrames
-  numberOfFrames = 0;
-  for(Message message : *this)
-    if(id(message) == idFrameBegin)
-      ++numberOfFrames;
+  // Calc numberOfFrames and collect the annotations if the log has no index.
+  if(!hasIndex)
+  {
+    numberOfFrames = 0;
+    annotations.clear();
+    std::string thread;
+    unsigned time = 0;
+    std::size_t firstAnnotation = 0;
+    for(Message message : *this)
+      switch(id(message))
+      {
+        case idFrameBegin:
+          message.bin() >> thread;
+          time = 0;
+          firstAnnotation = annotations.size();
+          ++numberOfFrames;
+          break;
+        case idFrameInfo:
+          message.bin() >> time; // FrameInfo::time is streamed first.
+          break;
+        case idAnnotation:
+        {
+          const Annotation annotation = Frame::readAnnotation(message);
+          annotations.emplace_back(numberOfFrames - 1, thread, 0, annotation.name, annotation.description);
+          break;
+        }
+        case idFrameFinished:
+          for(std::size_t i = firstAnnotation; i < annotations.size(); ++i)
+            annotations[i].time = time;
+          break;
+        default:
+          break;
+      }
+  }
+  std::stable_sort(annotations.begin(), annotations.end(), [](const LogAnnotation& a, const LogAnnotation& b) {return a.frame < b.frame;});
 }
 
 MessageID Log::id(Message message) const
@@ -103,6 +149,136 @@ Frame Log::iter()
   return Frame(*this);
 }
 
+pybind11::dict Log::extract(const std::string& thread, const std::string& representation,
+                            const std::vector<std::string>& fields, unsigned numOfThreads) const
+{
+  const auto name = std::find(messageIDNames->begin(), messageIDNames->end(), "id" + representation);
+  if(name == messageIDNames->end() || !typeInfo.classes.contains(representation))
+    throw pybind11::key_error("Log has no representation '" + representation + "'");
+  const MessageID logID = static_cast<MessageID>(name - messageIDNames->begin());
+
+  const std::vector<std::string> selected = fields.empty() ? ColumnStream::getColumns(typeInfo, representation) : fields;
+  std::unordered_map<std::string, std::size_t> columns;
+  for(std::size_t i = 0; i < selected.size(); ++i)
+    columns.emplace(selected[i], i);
+
+  std::vector<int> frames;
+  std::vector<std::vector<double>> data(selected.size());
+  {
+    pybind11::gil_scoped_release release;
+
+    // Find all messages to extract.
+    std::vector<Message> messages;
+    int frame = -1;
+    bool isThread = false;
+    for(Message message : *this)
+      if(id(message) == idFrameBegin)
+      {
+        std::string frameThread;
+        message.bin() >> frameThread;
+        ++frame;
+        isThread = frameThread == thread;
+      }
+      else if(isThread && message.id() == logID)
+      {
+        frames.push_back(frame);
+        messages.push_back(message);
+      }
+
+    for(std::vector<double>& column : data)
+      column.resize(messages.size(), std::numeric_limits<double>::quiet_NaN());
+
+    // Each thread deserializes a contiguous range of messages.
+    if(!numOfThreads)
+      numOfThreads = std::max(1u, std::thread::hardware_concurrency());
+    numOfThreads = static_cast<unsigned>(std::min<std::size_t>(numOfThreads, messages.size()));
+    // The type is compiled beforehand, because the workers share the schema.
+    schema.getNode(representation);
+    std::vector<std::thread> workers;
+    for(unsigned i = 0; i < numOfThreads; ++i)
+      workers.emplace_back([&, i]
+      {
+        for(std::size_t row = messages.size() * i / numOfThreads; row < messages.size() * (i + 1) / numOfThreads; ++row)
+        {
+          InBinaryMemory in = messages[row].bin();
+          ColumnStream out(columns, data, row);
+          DebugDataStreamer streamer(schema, in, representation);
+          out << streamer;
+        }
+      });
+    for(std::thread& worker : workers)
+      worker.join();
+  }
+
+  pybind11::dict result;
+  result["frame"] = pybind11::array_t<int>(frames.size(), frames.data());
+  for(std::size_t i = 0; i < selected.size(); ++i)
+    result[selected[i].c_str()] = pybind11::array_t<double>(data[i].size(), data[i].data());
+  return result;
+}
+
+std::vector<LogAnnotation> Log::findAnnotations(const std::string& pattern, unsigned from, unsigned to, const std::string& thread) const
+{
+  const std::regex regex(pattern);
+  std::vector<LogAnnotation> result;
+  for(const LogAnnotation& annotation : annotations)
+    if(annotation.time >= from && annotation.time <= to && (thread.empty() || annotation.thread == thread)
+       && (std::regex_search(annotation.name, regex) || std::regex_search(annotation.description, regex)))
+      result.push_back(annotation);
+  return result;
+}
+
+bool Log::readIndex(In& stream, size_t usedSize)
+{
+  // See LogPlayer::readIndices for the complete format. Version 2 only lacks the times of the annotations.
+  unsigned char chunk;
+  unsigned char version;
+  stream >> chunk >> version;
+  if(chunk != LoggingTools::logFileIndices || (version != LoggingTools::indexVersion && version != 2))
+    return false;
+
+  unsigned sizeLow, sizeHigh, frames;
+  stream >> sizeLow >> sizeHigh >> frames;
+  if((sizeLow | static_cast<size_t>(sizeHigh) << 32) != usedSize)
+    return false;
+
+  numberOfFrames = static_cast<int>(frames);
+
+  // Skip the offsets of the frames and the statistics per thread.
+  stream.skip(frames * sizeof(unsigned long long));
+  unsigned threads;
+  stream >> threads;
+  for(unsigned i = 0; i < threads; ++i)
+  {
+    std::string thread;
+    unsigned statsSize;
+    stream >> thread >> statsSize;
+    stream.skip(statsSize * 2 * sizeof(unsigned long long));
+  }
+
+  annotations.clear();
+  stream >> threads;
+  for(unsigned i = 0; i < threads; ++i)
+  {
+    std::string thread;
+    unsigned count;
+    stream >> thread >> count;
+    for(unsigned j = 0; j < count; ++j)
+    {
+      unsigned number;
+      unsigned frame;
+      std::string name;
+      std::string description;
+      unsigned time = 0;
+      stream >> number >> frame >> name >> description;
+      if(version >= 3)
+        stream >> time;
+      annotations.emplace_back(static_cast<int>(frame), thread, time, name, description);
+    }
+  }
+  return true;
+}
+
 void Log::readMessageIDs(In& stream)
 {
   std::unordered_map<std::string, MessageID> mapNameToID;
@@ -10,6 +10,8 @@
 #pragma once
 
 #include "Frame.h"
+#include "Debugging/DebugDataSchema.h"
+#include "Lazy.h"
 #include "Platform/MemoryMappedFile.h"
 #include "Streaming/TypeInfo.h"
 #include <string>
@@ -22,6 +24,32 @@ public:
 
   Frame iter();
 
+  /**
+   * Extracts fields of a representation from all frames of a thread. The
+   * representations are deserialized in parallel without holding the GIL.
+   * @param thread The name of the thread.
+   * @param representation The name of the representation.
+   * @param fields The paths of the fields to extract, e.g. "a.b.x" or "a[2].x".
+   *               If empty, all fields that can be extracted are.
+   * @param numOfThreads The number of threads used. 0 means one per hardware thread.
+   * @return A dictionary that maps "frame" to the numbers of the frames the
+   *         representation was found in and each field to its values. Fields
+   *         not present in a frame are NaN.
+   */
+  pybind11::dict extract(const std::string& thread, const std::string& representation,
+                         const std::vector<std::string>& fields, unsigned numOfThreads) const;
+
+  /**
+   * Searches the annotations of the log. They are taken from the index of the
+   * log if it has one, i.e. the frames are not read.
+   * @param pattern A regular expression that must be found in the name or the description.
+   * @param from The earliest time of the frame of an annotation (in ms).
+   * @param to The latest time of the frame of an annotation (in ms).
+   * @param thread Only annotations of this thread are returned. All threads if empty.
+   * @return The annotations found sorted by their frames.
+   */
+  std::vector<LogAnnotation> findAnnotations(const std::string& pattern, unsigned from, unsigned to, const std::string& thread) const;
+
   std::string headName;
   std::string bodyName;
   std::string scenario;
@@ -34,6 +62,15 @@ public:
 private:
   void readMessageIDs(In& stream);
 
+  /**
+   * Reads the number of frames and the annotations from an index chunk
+   * written by the logger or the log player.
+   * @param stream The stream positioned at the beginning of the index chunk.
+   * @param usedSize The size of the message queue the index must belong to.
+   * @return Could the index be read?
+   */
+  bool readIndex(In& stream, size_t usedSize);
+
   /**
    * Returns the message type translated to the current value in the
    * enumeration type. Any id that stems from a log file must be translated
@@ -44,11 +81,15 @@ private:
    */
   MessageID id(Message message) const;
 
+  friend class Analyzer;
   friend class Frame;
   std::unique_ptr<MemoryMappedFile> file; /**< The memory mapped file if an uncompressed log was loaded from disk. */
   TypeInfo typeInfo;
+  Layout layout{typeInfo}; /**< The layout of the types in this log, which is used to decode representations lazily. */
+  mutable DebugDataSchema schema{typeInfo}; /**< The types in this log compiled for decoding representations eagerly. */
   bool keepGoing = false;
   const std::vector<std::string>* messageIDNames = nullptr;
   std::vector<MessageID> mapLogToID; /**< Maps message ids from the log to their current values. */
   std::vector<MessageID> mapIDToLog; /**< Maps message ids from their current values to the ones found in the log. */
+  std::vector<LogAnnotation> annotations; /**< All annotations of the log sorted by their frames. */
 };
@@ -7,14 +7,17 @@
  * @author Jan Fiedler
  */
 
+#include "Analyzer.h"
 #include "Log.h"
 #include "Frame.h"
+#include "Lazy.h"
 #include "Types.h"
 #include "Framework/LoggingTools.h"
 #include "Platform/SystemCall.h"
 #include "Streaming/FunctionList.h"
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -96,6 +99,38 @@ Args:
     .def_readonly("playerNumber", &Log::playerNumber, "The player number of the log.")
     .def_readonly("suffix", &Log::suffix, "The suffix of the log.")
     .def("__len__", [](const Log& log) { return log.numberOfFrames; })
+    .def("extract", &Log::extract, R"bhdoc(Extracts fields of a representation from all frames of a thread.
+
+The representations are deserialized in parallel without holding the GIL.
+
+Args:
+    thread: The name of the thread.
+    representation: The name of the representation.
+    fields: The paths of the fields to extract, e.g. "a.b.x" or "a[2].x". The path
+        of a dynamic array yields its number of elements. If empty, all fields
+        except for strings and the elements of dynamic arrays are extracted.
+    num_threads: The number of threads used. 0 means one per hardware thread.
+
+Returns:
+    A dictionary mapping "frame" to the numbers of the frames that contain the
+    representation and each field to a NumPy array of its values in these frames.
+    Fields not present in a frame are NaN.
+)bhdoc", py::arg("thread"), py::arg("representation"), py::arg("fields") = std::vector<std::string>(), py::arg("num_threads") = 0)
+    .def("annotations", &Log::findAnnotations, R"bhdoc(Searches the annotations of the log.
+
+If the log has an index, the annotations are taken from it without reading the frames.
+
+Args:
+    pattern: A regular expression that must be found in the name or the description
+        of an annotation. Empty matches all annotations.
+    start: The earliest time of the frame of an annotation in ms.
+    end: The latest time of the frame of an annotation in ms.
+    thread: Only annotations of this thread are returned. All threads if empty.
+
+Returns:
+    A list of :class:`.LogAnnotation` sorted by their frames.
+)bhdoc", py::arg("pattern") = std::string(), py::arg("start") = 0u, py::arg("end") = std::numeric_limits<unsigned>::max(),
+         py::arg("thread") = std::string())
     // The log is alive as long as a reference to a frame exists.
     .def("__iter__", &Log::iter, py::keep_alive<0, 1>()); // loop
 
@@ -106,7 +141,16 @@ Args:
     .def("__next__", &Frame::next) // loop
     .def("__iter__", &Frame::iter) // loop
     .def("__contains__", &Frame::contains, py::arg("x")) // 'x' in frame
-    .def("__getitem__", &Frame::getitem, py::arg("index")); // frame['x']
+    // The record refers to the data of the log, which is kept alive by the frame.
+    .def("__getitem__", &Frame::getitem, py::keep_alive<0, 1>(), py::arg("index")) // frame['x']
+    .def("decode", &Frame::decode, R"bhdoc(Decodes a representation completely.
+
+In contrast to frame['x'], which only decodes the fields that are accessed, all
+fields are decoded at once into a :class:`.Record`.
+
+Args:
+    representation: The name of the representation.
+)bhdoc", py::arg("representation"));
 
   py::class_<Value>(m, "Value", "A base class for all value types for usage in the same STL-containers.");
 
@@ -135,7 +179,120 @@ Is mostly extracted automatically by the lib.
       return py::make_iterator(keys.begin(), keys.end());
     }, py::keep_alive<0, 1>());
 
+  py::class_<LazyRecord, Value>(m, "LazyRecord", R"bhdoc(A streamable class in a log whose attributes are decoded when they are accessed.
+
+Attributes of classes with a fixed layout are located by precomputed offsets.
+Otherwise, the attributes before them are skipped without decoding them.
+)bhdoc")
+    .def("__getattr__", &LazyRecord::getattr, py::return_value_policy::reference_internal, py::arg("attr")) // record.x
+    .def("__iter__", [](const LazyRecord& record) {
+      const auto& keys = record.getKeys();
+      return py::make_iterator(keys.begin(), keys.end());
+    }, py::keep_alive<0, 1>());
+
+  py::class_<LazyArray, Value>(m, "LazyArray", "An array in a log whose elements are decoded when they are accessed.")
+    .def("__len__", &LazyArray::size)
+    .def("__getitem__", &LazyArray::getitem, py::return_value_policy::reference_internal, py::arg("index"))
+    .def("numpy", [](py::object self) {
+      return self.cast<const LazyArray&>().numpy(self);
+    }, R"bhdoc(Maps the array onto the memory of the log without copying it.
+
+Returns:
+    A read-only NumPy array that keeps the log alive. Only arrays of numbers,
+    bools, and enums can be mapped.
+)bhdoc");
+
   py::class_<Annotation>(m, "Annotation", "An event annotation of a frame.")
     .def_readonly("name", &Annotation::name, "A short name of the annotation creator.")
     .def_readonly("description", &Annotation::description, "A description of the event.");
+
+  py::class_<LogAnnotation, Annotation>(m, "LogAnnotation", "An annotation of a log together with where it was found.")
+    .def_readonly("frame", &LogAnnotation::frame, "The number of the frame in the log.")
+    .def_readonly("thread", &LogAnnotation::thread, "The thread of the frame.")
+    .def_readonly("time", &LogAnnotation::time, "The time of the frame in ms (from its FrameInfo) or 0 if unknown.");
+
+  py::class_<Analyzer>(m, "Analyzer", R"bhdoc(Computes statistics over logs natively.
+
+The analyzer is configured with rules. Each log is read only once and all rules
+are evaluated while streaming through its frames. Several logs are analyzed in
+parallel without holding the GIL.
+
+Fields are given as "Representation.path", e.g. "MotionRequest.motion". Enums
+are compared by their numeric values. Strings cannot be observed.
+)bhdoc")
+    .def(py::init<>())
+    .def("add_change_oscillation", &Analyzer::addChangeOscillation, R"bhdoc(Adds a rule that detects a field that changes again too fast.
+
+Args:
+    name: The name of the rule.
+    thread: The name of the thread.
+    field: The field observed.
+    threshold: A change is a hit if the previous change happened less than this many updates ago.
+)bhdoc", py::arg("name"), py::arg("thread"), py::arg("field"), py::arg("threshold") = 10)
+    .def("add_angle_oscillation", &Analyzer::addAngleOscillation, R"bhdoc(Adds a rule that detects an oscillating angle.
+
+A hit is counted whenever the mean of the absolute normalized differences between
+consecutive angles within a window exceeds a threshold.
+
+Args:
+    name: The name of the rule.
+    thread: The name of the thread.
+    fields: The fields whose sum is the angle observed.
+    window: The number of updates averaged over.
+    threshold: The threshold for the mean difference in radians (default 10°).
+    condition: The rule is only updated while this field has the value condition_value.
+        The window is cleared otherwise. No condition if empty.
+    condition_value: The value the condition field must have.
+)bhdoc", py::arg("name"), py::arg("thread"), py::arg("fields"), py::arg("window") = 60, py::arg("threshold") = 0.17453292519943295,
+         py::arg("condition") = std::string(), py::arg("condition_value") = 0.0)
+    .def("add_annotation_filter", &Analyzer::addAnnotationFilter, R"bhdoc(Adds a rule that collects annotations.
+
+Args:
+    name: The name of the rule.
+    pattern: A regular expression that must be found in the name or the description
+        of an annotation. Empty matches all annotations.
+    thread: Only annotations of this thread are collected. All threads if empty.
+)bhdoc", py::arg("name"), py::arg("pattern") = std::string(), py::arg("thread") = std::string())
+    .def("add_timing", &Analyzer::addTiming, R"bhdoc(Adds a rule that accumulates the stopwatch times of a thread.
+
+Args:
+    name: The name of the rule.
+    thread: The name of the thread.
+)bhdoc", py::arg("name"), py::arg("thread"))
+    .def("run", &Analyzer::run, R"bhdoc(Analyzes logs in parallel.
+
+Args:
+    paths: The paths of the logs.
+    num_threads: The number of threads used. 0 means one per hardware thread.
+    keep_going: Whether corrupt frames should be ignored as much as possible.
+
+Returns:
+    An :class:`.AnalysisResult` per log in the order of the paths.
+)bhdoc", py::arg("paths"), py::arg("num_threads") = 0, py::arg("keep_going") = false);
+
+  py::class_<Analyzer::Event>(m, "AnalysisEvent", "A hit of a rule.")
+    .def_readonly("frame", &Analyzer::Event::frame, "The number of the frame in the log.")
+    .def_readonly("thread", &Analyzer::Event::thread, "The thread of the frame.")
+    .def_readonly("update", &Analyzer::Event::update, "The number of updates of the rule before this hit.")
+    .def_readonly("previous", &Analyzer::Event::previous, "The value before a change or NaN.")
+    .def_readonly("value", &Analyzer::Event::value, "The value after a change or the mean angular difference. NaN for annotations.")
+    .def_readonly("text", &Analyzer::Event::text, "The annotation (\"name - description\") or an empty string.");
+
+  py::class_<Analyzer::WatchStatistics>(m, "WatchStatistics", "The statistics of a stopwatch in microseconds.")
+    .def_readonly("count", &Analyzer::WatchStatistics::count, "The number of measurements.")
+    .def_readonly("mean", &Analyzer::WatchStatistics::mean, "The mean time.")
+    .def_readonly("median", &Analyzer::WatchStatistics::median, "The median time.")
+    .def_readonly("p95", &Analyzer::WatchStatistics::p95, "The 95% quantile.")
+    .def_readonly("max", &Analyzer::WatchStatistics::max, "The longest time.");
+
+  py::class_<Analyzer::RuleResult>(m, "RuleResult", "The results of a single rule for a single log.")
+    .def_readonly("hits", &Analyzer::RuleResult::hits, "The number of hits. For timing rules, the number of frames with timing data.")
+    .def_readonly("events", &Analyzer::RuleResult::events, "A list of :class:`.AnalysisEvent` (not for timing rules).")
+    .def_readonly("watches", &Analyzer::RuleResult::watches, "A dictionary mapping stopwatch names to :class:`.WatchStatistics` (only for timing rules).");
+
+  py::class_<Analyzer::Result>(m, "AnalysisResult", "The results of all rules for a single log.")
+    .def_readonly("path", &Analyzer::Result::path, "The path of the log.")
+    .def_readonly("error", &Analyzer::Result::error, "Empty if the log could be analyzed completely, otherwise the reason why it could not.")
+    .def_readonly("frames", &Analyzer::Result::frames, "The number of frames analyzed.")
+    .def_readonly("rules", &Analyzer::Result::rules, "A dictionary mapping rule names to :class:`.RuleResult`.");
 }
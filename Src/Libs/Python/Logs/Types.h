@@ -161,3 +161,16 @@ public:
   std::string name;
   std::string description;
 };
+
+/** An annotation of a log together with where it was found. */
+class LogAnnotation : public Annotation
+{
+public:
+  LogAnnotation(int frame, const std::string& thread, unsigned time, const std::string& name, const std::string& description) :
+    Annotation(name, description), frame(frame), thread(thread), time(time)
+  {}
+
+  int frame; /**< The number of the frame in the log. */
+  std::string thread; /**< The thread of the frame. */
+  unsigned time; /**< The time of the frame (from its FrameInfo) or 0 if unknown. */
+};
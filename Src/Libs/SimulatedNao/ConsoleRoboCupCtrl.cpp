@@ -412,6 +412,16 @@ bool ConsoleRoboCupCtrl::executeConsoleCommand(std::string command, RobotConsole
     else
       printLn("Syntax Error");
   }
+  else if(buffer == "gs")
+  {
+    stream >> buffer;
+    if(buffer.empty())
+      printLn(gameController.getSummary());
+    else if(buffer == "reset")
+      gameController.resetStatistics();
+    else
+      printLn("Syntax Error");
+  }
   else if(buffer == "mvo")
   {
     std::string objectID;
@@ -684,6 +694,7 @@ void ConsoleRoboCupCtrl::help(In& stream)
   list("  dt off | on | <fps> : Delay time of a simulation step to real time or a certain number of frames per second.", pattern, true);
   list("  echo <text> : Print text into console window. Useful in console.con.", pattern, true);
   list("  gc initial | standby | ready | set | playing | finished | goalByFirstTeam | goalBySecondTeam | kickOffFirstTeam | kickOffSecondTeam | globalGameStuckByFirstTeam | globalGameStuckBySecondTeam | goalKickForFirstTeam | goalKickForSecondTeam | pushingFreeKickForFirstTeam | pushingFreeKickForSecondTeam | cornerKickForFirstTeam | cornerKickForSecondTeam | kickInForFirstTeam | kickInForSecondTeam | penaltyKickForFirstTeam | penaltyKickForSecondTeam | halfFirst | halfSecond | gameNormal | gamePenaltyShootout | competitionPhasePlayoff | competitionPhaseRoundRobin | competitionTypeChampionsCup | competitionTypeChallengeShield | competitionTypeSharedAutonomyChallenge : Set GameController state.", pattern, true);
+  list("  gs [reset] : Print a summary of the game (score, ball possession, penalties) or restart collecting it.", pattern, true);
   list("  ( help | ? ) [<pattern>] : Display this text.", pattern, true);
   if(is2D)
     list("  mvo <name> <x> <y> [<rot>] : Move the object with the given name to the given position.", pattern, true);
@@ -703,12 +714,15 @@ void ConsoleRoboCupCtrl::help(In& stream)
   list("  log start | stop | clear : Record log file.", pattern, true);
   list("  log save [<file>] : Save log file with given name or modified current log file name.", pattern, true);
   list("  log saveAudio [<file>] : Save audio data from log.", pattern, true);
+  list("  log saveColumns <thread> <representation> {<representation>} : Save representations of a thread from log in a columnar file.", pattern, true);
   list("  log saveImages [raw] [onlyPlaying] [<takeEachNth>] [<dir>] : Save images from log.", pattern, true);
   list("  log trim ( until <end frame> | from <start frame> | between <start frame> <end frame> ) : Keep only the given section of the log. 'current' can be used as frame as well.", pattern, true);
   list("  log ? [<pattern>] : Display information about log file.", pattern, true);
   list("  log load <file> | clear : Load log-file or clear all frames.", pattern, true);
+  list("  log stream <ip> <port> | off : Replay the frames a robot streams while logging them.", pattern, true);
   list("  log ( keep | remove ) <message> {<message>} : Filter specified messages of all frames.", pattern, true);
-  list("  log start | pause | stop | ( forward | backward ) [ fast | image ] | repeat | goto <number> | cycle | once : Replay log file.", pattern, true);
+  list("  log start [ fast ] | pause | stop | ( forward | backward ) [ fast | image ] | repeat | goto <number> | cycle | once : Replay log file.", pattern, true);
+  list("  log snapshots <interval> | off : Store the module states every <interval> frames while replaying to seek backward and goto frames by restoring them.", pattern, true);
   list("  log mr [list] : Generate module requests to replay log file.", pattern, true);
   list("  log analyzeRobotStatus : Find timestamps with joints that are defect or gyros not updating.", pattern, true);
   list("  mr ? [<pattern>] | modules [<pattern>] | save | <representation> ( ? [<pattern>] | <module> | off | default ) : Send module request.", pattern, true);
@@ -723,6 +737,7 @@ void ConsoleRoboCupCtrl::help(In& stream)
     list("  si reset [<number>] | [number] [grayscale] [<file>] : Save camera image. Only \"reset\" works without \"for\".", pattern, true);
   list("  sn [ whiteNoise | timeDelay | discretization ] [ on | off ] : (De)activates the simulation of (specified) sensor noise.", pattern, true);
   list("  sv fast | oracle [ <fileName> ]: Save the current robot positions into a specified fileName. If no fileName given, it will be saved in Saved.con. Use fast to save it for Fast scenes. Use oracle to save it for PerceptOracle scenes.", pattern, true);
+  list("  ts [<file>] : Save the timing statistics of all threads as CSV (requires \"dr timing\"). The default file is Timing.csv.", pattern, true);
   list("  vf [force] <name> : Add field view.", pattern, true);
   list("  vfd ? [<pattern>] | off | ( all | <name> ) ( ? [<pattern>] | <drawing> [ on | off ] ) : (De)activate debug drawing in field view.", pattern, true);
   list("  vi ? [<pattern>] | ( <image> | none ) [<name>] [gain <value>] [ddScale <value>] : Add image view.", pattern, true);
@@ -908,6 +923,7 @@ void ConsoleRoboCupCtrl::createCompletion()
     "gc halfSecond",
     "gc gamePenaltyShootout",
     "gc gameNormal",
+    "gs reset",
     "help",
     "jc motion",
     "jc hide",
@@ -916,10 +932,12 @@ void ConsoleRoboCupCtrl::createCompletion()
     "jc release",
     "js",
     "log start",
+    "log start fast",
     "log stop",
     "log clear",
     "log save",
     "log saveAudio",
+    "log saveColumns",
     "log saveImages raw onlyPlaying",
     "log trim from current",
     "log trim until current",
@@ -927,6 +945,7 @@ void ConsoleRoboCupCtrl::createCompletion()
     "log ?",
     "log mr list",
     "log load",
+    "log stream off",
     "log cycle",
     "log once",
     "log pause",
@@ -936,7 +955,9 @@ void ConsoleRoboCupCtrl::createCompletion()
     "log backward image",
     "log repeat",
     "log goto",
+    "log snapshots off",
     "log analyzeRobotStatus",
+    "log annotations",
     "mr modules",
     "mr save",
     "msg off",
@@ -961,6 +982,7 @@ void ConsoleRoboCupCtrl::createCompletion()
     "st on",
     "sv fast",
     "sv oracle",
+    "ts",
     "vf force",
     "vp"
   };
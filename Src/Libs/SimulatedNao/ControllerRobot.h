@@ -37,6 +37,22 @@ public:
     robotConsole->update();
   }
 
+  /** The first part of \c update , which must be executed for all robots first. */
+  void beginUpdate()
+  {
+    robotConsole->beginUpdate();
+  }
+
+  /**
+   * The second part of \c update .
+   * @param wait Wait until the robot has finished its current frame?
+   * @return Was the update finished?
+   */
+  bool finishUpdate(bool wait)
+  {
+    return robotConsole->finishUpdate(wait);
+  }
+
   RobotConsole* getRobotConsole() const { return robotConsole; }
 
 private:
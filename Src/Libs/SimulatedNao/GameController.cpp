@@ -439,6 +439,15 @@ bool GameController::checkIllegalPositionInSet(int robot) const
 
 void GameController::update()
 {
+  if(gameControllerData.state == STATE_PLAYING && timeOfLastUpdate)
+  {
+    const unsigned timeSinceLastUpdate = Time::getTimeSince(timeOfLastUpdate);
+    statistics.playingTime += timeSinceLastUpdate;
+    if(lastBallContactTeam != -1)
+      statistics.possessionTime[lastBallContactTeam] += timeSinceLastUpdate;
+  }
+  timeOfLastUpdate = Time::getCurrentSystemTime();
+
   for(int i = 0; i < numOfRobots; ++i)
   {
     Robot& r = robots[i];
@@ -631,6 +640,8 @@ void GameController::update()
       }
     }
 
+    if(r.info->penalty != PENALTY_NONE && r.info->penalty != PENALTY_SUBSTITUTE && r.lastPenalty == PENALTY_NONE)
+      ++statistics.penalties[i < numOfRobots / 2 ? 0 : 1];
     r.lastPenalty = r.info->penalty;
   }
 
@@ -869,6 +880,7 @@ void GameController::setLastBallContactRobot(SimRobot::Object* robot)
   lastBallContactPose = Pose2f(teamIndex ? 0.f : pi, SimulatedRobot::getPosition(robot));
   lastBallContactTime = Time::getCurrentSystemTime();
   lastBallContactRobots[teamIndex] = robot;
+  lastBallContactTeam = static_cast<int>(teamIndex);
 }
 
 void GameController::getGameControllerData(GameControllerData& gameControllerData)
@@ -891,6 +903,25 @@ void GameController::getGameControllerData(GameControllerData& gameControllerDat
   }
 }
 
+std::string GameController::getSummary() const
+{
+  std::string summary;
+  for(int i = 0; i < 2; ++i)
+  {
+    const RoboCup::TeamInfo& team = gameControllerData.teams[i];
+    const unsigned possession = statistics.playingTime ? (statistics.possessionTime[i] * 100 + statistics.playingTime / 2) / statistics.playingTime : 0;
+    summary += "Team " + std::to_string(team.teamNumber) + ": " + std::to_string(team.score) + " goals, "
+               + std::to_string(possession) + "% ball possession, " + std::to_string(statistics.penalties[i]) + " penalties\n";
+  }
+  return summary + "Playing time: " + std::to_string(statistics.playingTime / 1000) + " s";
+}
+
+void GameController::resetStatistics()
+{
+  statistics = Statistics();
+  lastBallContactTeam = -1;
+}
+
 void GameController::getWhistle(Whistle& whistle)
 {
   whistle = this->whistle;
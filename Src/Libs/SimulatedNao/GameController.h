@@ -123,6 +123,17 @@ private:
   Robot robots[numOfRobots];
   int ballContacts[2];
 
+  /** Statistics about the game that are summarized by \c getSummary . */
+  struct Statistics
+  {
+    unsigned playingTime = 0; /**< The time spent in the state playing (in ms). */
+    unsigned possessionTime[2] = {0, 0}; /**< The time spent in the state playing while each team had touched the ball last (in ms). */
+    unsigned penalties[2] = {0, 0}; /**< The number of penalties per team. */
+  };
+  Statistics statistics;
+  int lastBallContactTeam = -1; /**< The team that touched the ball last. In contrast to \c lastBallContactRobots , it is not reset. */
+  unsigned timeOfLastUpdate = 0; /**< The time when \c update was executed the last time. */
+
   TeamMessageContainer inTeamMessage;
   TeamMessageContainer outTeamMessage;
   TeamMessageChannel* theTeamMessageChannel;
@@ -204,6 +215,16 @@ public:
    */
   void getWhistle(Whistle& whistle);
 
+  /**
+   * Returns a summary of the game so far, i.e. the score, the ball
+   * possession, and the number of penalties per team.
+   * @return A text with one line per team.
+   */
+  std::string getSummary() const;
+
+  /** Restarts collecting the statistics that are part of the summary. */
+  void resetStatistics();
+
 private:
 
   /**
@@ -158,8 +158,16 @@ bool LocalConsole::main()
 
 void LocalConsole::update()
 {
-  RobotConsole::update();
-  updatedSignal.wait();
+  beginUpdate();
+  finishUpdate(true);
+}
+
+bool LocalConsole::finishUpdate(bool wait)
+{
+  if(wait)
+    updatedSignal.wait();
+  else if(!updatedSignal.tryWait())
+    return false;
 
   QString statusText;
   {
@@ -179,15 +187,30 @@ void LocalConsole::update()
     }
     else if(mode == SystemCall::logFileReplay)
     {
-      if(logPlayer.state == LogPlayer::playing && (logPlayer.cycle || logPlayer.frame() + 1 < logPlayer.frames()))
+      if(logPlayer.isReceiving() && logPlayer.receive())
+        updateAnnotationsFromLog();
+
+      // In fast mode, frames are played back until a thread is reached that is still busy.
+      // This lets the threads process their frames in parallel rather than one per simulation step.
+      // It terminates, because each frame played back makes another thread busy.
+      while(logPlayer.state == LogPlayer::playing && (logPlayer.cycle || logPlayer.frame() + 1 < logPlayer.frames()))
       {
         const std::string threadName = logPlayer.threadOf(logPlayer.frame() +  1);
-        if(threadName != "" && threadData[threadName].logAcknowledged)
+        if(threadName == "" || !threadData[threadName].logAcknowledged)
+          break;
+        saveModuleSnapshot(logPlayer.frame() + 1);
+        logPlayer.playBack(logPlayer.frame() + 1);
+        threadData[threadName].currentFrame = logPlayer.frame();
+        threadData[threadName].logAcknowledged = false;
+
+        // Seeking replays the frames up to its target as fast as possible.
+        if(logPlayer.frame() == seekTarget)
         {
-          logPlayer.playBack(logPlayer.frame() + 1);
-          threadData[threadName].currentFrame = logPlayer.frame();
-          threadData[threadName].logAcknowledged = false;
+          logPlayer.state = LogPlayer::stopped;
+          seekTarget = -1;
         }
+        else if(!logPlayer.fast && seekTarget == static_cast<size_t>(-1))
+          break;
       }
       if(simulatedRobot)
       {
@@ -270,6 +293,7 @@ void LocalConsole::update()
 
   if(statusText.size() > 0)
     ctrl->printStatusText((QString::fromStdString(robotName) + ": " + statusText).toUtf8());
+  return true;
 }
 
 DebugReceiver<MessageQueue>* LocalConsole::connectReceiverWithRobot(Debug* debug)
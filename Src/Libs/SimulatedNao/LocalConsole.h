@@ -79,6 +79,21 @@ public:
    */
   void update() override;
 
+  /**
+   * The first part of \c update . It handles the console and must be
+   * called in the GUI thread before \c finishUpdate .
+   */
+  void beginUpdate() {RobotConsole::update();}
+
+  /**
+   * The second part of \c update . It exchanges data with SimRobot as soon
+   * as the robot has finished its previous frame and triggers the next one.
+   * @param wait Wait for the robot to finish its frame? Otherwise, the
+   *             function returns immediately if it has not finished yet.
+   * @return Was the data exchanged? Always true if \c wait is set.
+   */
+  bool finishUpdate(bool wait);
+
 private:
   /**
    * The function connects the robot to the returned receiver.
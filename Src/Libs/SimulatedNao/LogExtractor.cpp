@@ -9,6 +9,8 @@
 #include "LogExtractor.h"
 #include "ImageExport.h"
 #include "LogPlayer.h"
+#include "Debugging/ColumnStream.h"
+#include "Debugging/DebugDataStreamer.h"
 #include "MathBase/RingBuffer.h"
 #include "Platform/File.h"
 #include "Representations/Infrastructure/AudioData.h"
@@ -24,6 +26,8 @@
 #include "Representations/Sensing/FallDownState.h"
 #include "Framework/LoggingTools.h"
 #include <filesystem>
+#include <limits>
+#include <unordered_map>
 
 /**
  * Example syntax:
@@ -251,6 +255,97 @@ bool LogExtractor::saveImages(const std::string& path, const bool raw, const boo
   });
 }
 
+bool LogExtractor::saveColumns(const std::string& fileName, const std::string& thread, const std::vector<std::string>& representations)
+{
+  const TypeInfo* typeInfo = logPlayer.getTypeInfo();
+  if(!typeInfo)
+    return false;
+
+  // Determine the columns from the type information of the log.
+  struct Representation
+  {
+    std::string type;
+    std::unordered_map<std::string, std::size_t> columns;
+  };
+  std::unordered_map<MessageID, Representation> columnsPerID = {{idFrameInfo, {"FrameInfo", {{"time", 1}}}}};
+  std::vector<std::string> names = {"frame", "timestamp"};
+  bool frameInfoSelected = false;
+  for(const std::string& representation : representations)
+  {
+    const int id = TypeRegistry::getEnumValue(typeid(MessageID).name(), "id" + representation);
+    if(id == -1 || !typeInfo->classes.contains(representation))
+      return false;
+    frameInfoSelected |= id == idFrameInfo;
+    Representation& columns = columnsPerID[static_cast<MessageID>(id)];
+    columns.type = representation;
+    for(const std::string& path : ColumnStream::getColumns(*typeInfo, representation))
+      if(columns.columns.emplace(path, names.size()).second)
+        names.push_back(representation + "." + path);
+  }
+
+  // Fill the columns in a single pass through the log.
+  std::vector<std::vector<double>> data(names.size());
+  std::size_t rows = 0;
+  std::size_t frame = 0;
+  bool isThread = false;
+  bool filled = false;
+  DebugDataSchema schema(*typeInfo);
+  for(MessageQueue::Message message : logPlayer)
+  {
+    const MessageID id = logPlayer.id(message);
+    if(id == idFrameBegin)
+    {
+      std::string frameThread;
+      message.bin() >> frameThread;
+      isThread = frameThread == thread;
+      filled = false;
+      if(isThread)
+      {
+        for(std::vector<double>& column : data)
+          column.resize(rows + 1, std::numeric_limits<double>::quiet_NaN());
+        data[0][rows] = static_cast<double>(frame);
+      }
+    }
+    else if(id == idFrameFinished)
+    {
+      if(isThread && filled)
+        ++rows;
+      isThread = false;
+      ++frame;
+    }
+    else if(isThread)
+    {
+      const auto columns = columnsPerID.find(id);
+      if(columns != columnsPerID.end())
+      {
+        InBinaryMemory in = message.bin();
+        ColumnStream out(columns->second.columns, data, rows);
+        DebugDataStreamer streamer(schema, in, columns->second.type);
+        out << streamer;
+        filled |= id != idFrameInfo || frameInfoSelected;
+      }
+    }
+  }
+
+  // Write the file.
+  OutBinaryFile stream(File::isAbsolute(fileName) ? fileName : std::string(File::getBHDir()) + "/Config/" + fileName);
+  if(!stream.exists())
+    return false;
+  stream.write("BHCF", 4);
+  stream << static_cast<unsigned>(names.size()) << static_cast<unsigned>(rows);
+  std::size_t size = 4 + 2 * sizeof(unsigned);
+  for(const std::string& name : names)
+  {
+    stream << name;
+    size += sizeof(unsigned) + name.size();
+  }
+  const char padding[8] = {0};
+  stream.write(padding, (8 - size % 8) % 8);
+  for(const std::vector<double>& column : data)
+    stream.write(column.data(), rows * sizeof(double));
+  return true;
+}
+
 bool LogExtractor::analyzeRobotStatus()
 {
   DECLARE_REPRESENTATIONS_AND_MAP(
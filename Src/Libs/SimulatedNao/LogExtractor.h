@@ -13,6 +13,7 @@
 #include <functional>
 #include <map>
 #include <string>
+#include <vector>
 
 class LogPlayer;
 class Streamable;
@@ -51,6 +52,25 @@ public:
    */
   bool saveImages(const std::string& path, bool raw, bool onlyPlaying, int takeEachNthFrame);
 
+  /**
+   * Writes representations of all frames of a thread into a single file in a
+   * columnar format. Each row is a frame that contains at least one of the
+   * representations. The columns are the frame number, the time from the
+   * FrameInfo of the frame, and all fields of the representations that
+   * \c ColumnStream can extract, named "<representation>.<path>". Missing
+   * values are NaN. The file is meant to be memory mapped and has this format:
+   * - 4 bytes "BHCF",
+   * - the number of columns and the number of rows (both \c unsigned ),
+   * - the names of the columns (each \c unsigned length followed by its characters),
+   * - zeros to align the following data to 8 bytes,
+   * - for each column, a \c double per row.
+   * @param fileName The name of the file to write.
+   * @param thread The name of the thread.
+   * @param representations The names of the representations.
+   * @return if writing the file was successful
+   */
+  bool saveColumns(const std::string& fileName, const std::string& thread, const std::vector<std::string>& representations);
+
   /**
    * Analyze if the measured joint angles are jumping, which indicates defect sensors.
    * @return true if analyzing was successful
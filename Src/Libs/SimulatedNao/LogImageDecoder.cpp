@@ -0,0 +1,113 @@
+/**
+ * @file LogImageDecoder.cpp
+ *
+ * This file implements a class that decodes the JPEG images of log frames in
+ * worker threads.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "LogImageDecoder.h"
+#include <algorithm>
+
+LogImageDecoder::LogImageDecoder(unsigned numOfWorkers)
+{
+  for(unsigned i = 0; i < numOfWorkers; ++i)
+    workers.emplace_back(&LogImageDecoder::worker, this);
+}
+
+LogImageDecoder::~LogImageDecoder()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    terminating = true;
+  }
+  changed.notify_all();
+  for(std::thread& worker : workers)
+    worker.join();
+}
+
+bool LogImageDecoder::contains(std::size_t frame)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return jobs.contains(frame);
+}
+
+void LogImageDecoder::request(std::size_t frame, std::vector<JPEGImage>&& jpegImages)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if(jobs.contains(frame))
+      return;
+    std::shared_ptr<Job> job = std::make_shared<Job>();
+    job->jpegImages = std::move(jpegImages);
+    jobs[frame] = job;
+    queue.push_back(job);
+  }
+  changed.notify_one();
+}
+
+std::vector<CameraImage>& LogImageDecoder::get(std::size_t frame)
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  const std::shared_ptr<Job> job = jobs.at(frame);
+
+  // Waiting for the workers could take longer than decoding the images here.
+  if(!job->started)
+  {
+    queue.erase(std::find(queue.begin(), queue.end(), job));
+    decode(*job, lock);
+  }
+  else
+    changed.wait(lock, [&] {return job->finished;});
+  return job->cameraImages;
+}
+
+void LogImageDecoder::retain(const std::vector<std::size_t>& frames)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  for(auto i = jobs.begin(); i != jobs.end();)
+    if(std::find(frames.begin(), frames.end(), i->first) == frames.end())
+    {
+      // Workers keep their own reference to jobs they currently decode.
+      if(!i->second->started)
+        queue.erase(std::find(queue.begin(), queue.end(), i->second));
+      i = jobs.erase(i);
+    }
+    else
+      ++i;
+}
+
+void LogImageDecoder::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  queue.clear();
+  jobs.clear();
+}
+
+void LogImageDecoder::worker()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  for(;;)
+  {
+    changed.wait(lock, [&] {return terminating || !queue.empty();});
+    if(terminating)
+      return;
+    const std::shared_ptr<Job> job = queue.front();
+    queue.pop_front();
+    decode(*job, lock);
+  }
+}
+
+void LogImageDecoder::decode(Job& job, std::unique_lock<std::mutex>& lock)
+{
+  job.started = true;
+  lock.unlock();
+  job.cameraImages.resize(job.jpegImages.size());
+  for(std::size_t i = 0; i < job.jpegImages.size(); ++i)
+    job.jpegImages[i].toCameraImage(job.cameraImages[i]);
+  job.jpegImages.clear();
+  lock.lock();
+  job.finished = true;
+  changed.notify_all();
+}
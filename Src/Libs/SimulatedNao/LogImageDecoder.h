@@ -0,0 +1,95 @@
+/**
+ * @file LogImageDecoder.h
+ *
+ * This file declares a class that decodes the JPEG images of log frames in
+ * worker threads. The log player requests the frames that it will probably
+ * play back next, so their images are already decoded when they are needed.
+ * The images are decoded to camera images directly, i.e. their YUYV pixels
+ * are not converted to another color space.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Representations/Infrastructure/CameraImage.h"
+#include "Representations/Infrastructure/JPEGImage.h"
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class LogImageDecoder
+{
+  /** The images of a frame. */
+  struct Job
+  {
+    std::vector<JPEGImage> jpegImages; /**< The images to decode. */
+    std::vector<CameraImage> cameraImages; /**< The decoded images. */
+    bool started = false; /**< Was decoding started? */
+    bool finished = false; /**< Are all images decoded? */
+  };
+
+  std::vector<std::thread> workers; /**< The worker threads. */
+  std::mutex mutex; /**< Protects all members below. */
+  std::condition_variable changed; /**< Signals that jobs were added or finished or that the workers should terminate. */
+  bool terminating = false; /**< Should the worker threads terminate? */
+  std::deque<std::shared_ptr<Job>> queue; /**< The jobs not started yet in the order they were requested. */
+  std::map<std::size_t, std::shared_ptr<Job>> jobs; /**< The jobs per frame. */
+
+public:
+  /**
+   * The constructor starts the worker threads.
+   * @param numOfWorkers The number of worker threads.
+   */
+  LogImageDecoder(unsigned numOfWorkers);
+
+  /** The destructor stops the worker threads. */
+  ~LogImageDecoder();
+
+  /**
+   * Is a frame already requested?
+   * @param frame The number of the frame.
+   * @return Was it requested?
+   */
+  bool contains(std::size_t frame);
+
+  /**
+   * Requests to decode the images of a frame.
+   * @param frame The number of the frame.
+   * @param jpegImages The images of the frame in the order of the log.
+   */
+  void request(std::size_t frame, std::vector<JPEGImage>&& jpegImages);
+
+  /**
+   * Returns the decoded images of a frame. If they were not decoded yet, this
+   * method either waits until a worker has finished them or decodes them itself.
+   * @param frame The number of the frame. It must have been requested.
+   * @return The decoded images in the order of the log.
+   */
+  std::vector<CameraImage>& get(std::size_t frame);
+
+  /**
+   * Forgets all frames except for some.
+   * @param frames The numbers of the frames kept.
+   */
+  void retain(const std::vector<std::size_t>& frames);
+
+  /** Forgets all frames, e.g. because the log changed. */
+  void clear();
+
+private:
+  /** The main function of the worker threads. */
+  void worker();
+
+  /**
+   * Decodes the images of a job.
+   * @param job The job. It must not have been started yet.
+   * @param lock The lock of the mutex that is held when this method is called.
+   *             It is released during decoding.
+   */
+  void decode(Job& job, std::unique_lock<std::mutex>& lock);
+};
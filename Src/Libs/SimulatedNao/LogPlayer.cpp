@@ -12,7 +12,10 @@
 #include "Framework/Settings.h"
 #include "Platform/File.h"
 #include "Streaming/Global.h"
+#include <algorithm>
+#include <cstring>
 #include <filesystem>
+#include <thread>
 #include <snappy-c.h>
 #ifdef WINDOWS
 #include <io.h>
@@ -57,18 +60,24 @@ void LogPlayer::writeMessageIDs(Out& stream)
     stream << name;
 }
 
-void LogPlayer::updateIndices()
+void LogPlayer::updateIndices(size_t from)
 {
-  frameIndex.clear();
-  framesHaveImage.clear();
-  statsPerThread.clear();
-  annotationsPerThread.clear();
+  if(!from)
+  {
+    frameIndex.clear();
+    framesHaveImage.clear();
+    statsPerThread.clear();
+    annotationsPerThread.clear();
+    anyFrameHasImage = false;
+  }
+  invalidateImages(!from);
 
   size_t frame = 0;
-  const_iterator lastFrame = begin();
-  bool hasImage = anyFrameHasImage = false;
+  const_iterator lastFrame = begin() + from;
+  bool hasImage = false;
+  unsigned time = 0;
   std::string currentThread;
-  for(auto i = begin(); i != end(); ++i)
+  for(auto i = begin() + from; i != end(); ++i)
   {
     auto message = *i;
     switch(id(message))
@@ -77,17 +86,24 @@ void LogPlayer::updateIndices()
         frame = i - begin();
         (*i).bin() >> currentThread;
         hasImage = false;
+        time = 0;
         break;
       case idFrameFinished:
         ASSERT(frameIndex.empty() || frameIndex.back() != frame);
+        if(auto annotations = annotationsPerThread.find(currentThread); annotations != annotationsPerThread.end())
+          for(auto j = annotations->second.rbegin(); j != annotations->second.rend() && j->frame == frameIndex.size(); ++j)
+            j->time = time;
         frameIndex.push_back(frame);
         framesHaveImage.push_back(hasImage);
-        lastFrame = i;
+        lastFrame = i + sizeof(MessageHeader) + message.size();
         break;
       case idCameraImage:
       case idJPEGImage:
         hasImage = anyFrameHasImage = true;
         break;
+      case idFrameInfo:
+        (*i).bin() >> time; // FrameInfo::time is streamed first.
+        break;
       case idAnnotation:
       {
         AnnotationInfo::AnnotationData& annotation = annotationsPerThread[currentThread].emplace_back();
@@ -105,7 +121,7 @@ void LogPlayer::updateIndices()
   }
 
   // If the last frame is not complete, drop partial information.
-  resize(lastFrame == 0 ? 0 : ++lastFrame - begin());
+  resize(lastFrame - begin());
 
   for(auto& [_, annotations] : annotationsPerThread)
     while(!annotations.empty() && annotations.back().frame == frameIndex.size())
@@ -119,7 +135,8 @@ bool LogPlayer::readIndices(In& stream, size_t& usedSize)
   unsigned char chunk;
   unsigned char version;
   stream >> chunk >> version;
-  if(chunk != LoggingTools::logFileIndices || version != indexVersion)
+  // Version 2 only lacks the times of the annotations.
+  if(chunk != LoggingTools::logFileIndices || (version != LoggingTools::indexVersion && version != 2))
     return false;
 
   stream >> reinterpret_cast<unsigned*>(&usedSize)[0] >> reinterpret_cast<unsigned*>(&usedSize)[1];
@@ -164,6 +181,8 @@ bool LogPlayer::readIndices(In& stream, size_t& usedSize)
     {
       AnnotationInfo::AnnotationData& annotation = annotations.emplace_back();
       stream >> annotation.annotationNumber >> annotation.frame >> annotation.name >> annotation.annotation;
+      if(version >= 3)
+        stream >> annotation.time;
     }
   }
 
@@ -177,7 +196,7 @@ void LogPlayer::writeIndices(Out& stream) const
   if(sizeWhenIndexWasComputed != size())
     const_cast<LogPlayer*>(this)->updateIndices();
 
-  stream << static_cast<unsigned char>(LoggingTools::logFileIndices) << indexVersion;
+  stream << static_cast<unsigned char>(LoggingTools::logFileIndices) << LoggingTools::indexVersion;
 
   stream << static_cast<unsigned>(size()) << static_cast<unsigned>(size() >> 32);
 
@@ -201,7 +220,7 @@ void LogPlayer::writeIndices(Out& stream) const
   {
     stream << threadName << static_cast<unsigned>(annotations.size());
     for(const AnnotationInfo::AnnotationData& annotation : annotations)
-      stream << annotation.annotationNumber << annotation.frame << annotation.name << annotation.annotation;
+      stream << annotation.annotationNumber << annotation.frame << annotation.name << annotation.annotation << annotation.time;
   }
 }
 
@@ -250,6 +269,7 @@ void LogPlayer::clear()
   annotationsPerThread.clear();
   currentFrame = 0;
   sizeWhenIndexWasComputed = 0;
+  invalidateImages(true);
 }
 
 bool LogPlayer::open(const std::string& fileName)
@@ -259,6 +279,7 @@ bool LogPlayer::open(const std::string& fileName)
   if(file->exists())
   {
     typeInfo = nullptr;
+    invalidateImages(true);
     InBinaryMemory stream(file->getData(), file->getSize());
     path = std::filesystem::absolute(File::isAbsolute(fileName)
                                      ? fileName
@@ -280,10 +301,18 @@ bool LogPlayer::open(const std::string& fileName)
           stream >> *typeInfo;
           break;
         case LoggingTools::logFileCompressed: //compressed log file
+        {
+          bool hasIndex = false;
           while(!stream.eof())
           {
             unsigned compressedSize;
             stream >> compressedSize;
+            if(!compressedSize) // End of compressed data -> an index written by the logger follows.
+            {
+              size_t usedSize;
+              hasIndex = readIndices(stream, usedSize) && usedSize == size();
+              break;
+            }
             std::vector<char> compressedBuffer;
             compressedBuffer.resize(compressedSize);
             stream.read(compressedBuffer.data(), compressedSize);
@@ -295,8 +324,10 @@ bool LogPlayer::open(const std::string& fileName)
               break;
             InBinaryMemory(uncompressBuffer.data(), uncompressedSize) >> *this;
           }
-          updateIndices();
+          if(!hasIndex)
+            updateIndices();
           return true;
+        }
         case LoggingTools::logFileUncompressed:
         {
           QueueHeader header;
@@ -394,6 +425,111 @@ bool LogPlayer::save(std::string fileName, const TypeInfo& typeInfo)
     return false;
 }
 
+bool LogPlayer::connect(const std::string& ip, int port)
+{
+  disconnect();
+  clear();
+  logStream = std::make_unique<TcpComm>(ip.c_str(), port);
+  if(!logStream->connected())
+  {
+    logStream = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void LogPlayer::disconnect()
+{
+  logStream = nullptr;
+  streamBuffer.clear();
+  streamPrefixRead = false;
+}
+
+bool LogPlayer::receive()
+{
+  if(!logStream)
+    return false;
+
+  // Receive everything that is available without waiting.
+  constexpr size_t chunkSize = 1 << 16;
+  int received;
+  do
+  {
+    const size_t usedSize = streamBuffer.size();
+    streamBuffer.resize(usedSize + chunkSize);
+    received = logStream->receiveNonBlocking(reinterpret_cast<unsigned char*>(streamBuffer.data() + usedSize), static_cast<int>(chunkSize));
+    streamBuffer.resize(usedSize + std::max(received, 0));
+  }
+  while(received == static_cast<int>(chunkSize));
+  const bool connectionLost = received < 0;
+
+  // The stream has the format of a compressed log file without an index.
+  size_t position = 0;
+  if(!streamPrefixRead)
+  {
+    position = LoggingTools::getPrefixSize(streamBuffer.data(), streamBuffer.size());
+    if(!position)
+    {
+      if(connectionLost)
+        disconnect();
+      return false;
+    }
+    InBinaryMemory stream(streamBuffer.data(), position - 1);
+    while(!stream.eof())
+    {
+      char chunk;
+      stream >> chunk;
+      if(chunk == LoggingTools::logFileSettings)
+        LoggingTools::skipSettings(stream);
+      else if(chunk == LoggingTools::logFileMessageIDs)
+        readMessageIDs(stream);
+      else if(chunk == LoggingTools::logFileTypeInfo)
+      {
+        typeInfo = std::make_unique<TypeInfo>(false);
+        stream >> *typeInfo;
+      }
+    }
+    if(streamBuffer[position - 1] != LoggingTools::logFileCompressed)
+    {
+      disconnect();
+      return false;
+    }
+    streamPrefixRead = true;
+  }
+
+  // The blocks only contain complete frames, so the indices can be extended.
+  const size_t from = sizeWhenIndexWasComputed == size() ? size() : 0;
+  const size_t sizeBefore = size();
+  std::vector<char> uncompressBuffer;
+  while(streamBuffer.size() - position >= sizeof(unsigned))
+  {
+    unsigned compressedSize;
+    std::memcpy(&compressedSize, streamBuffer.data() + position, sizeof(compressedSize));
+    if(streamBuffer.size() - position - sizeof(compressedSize) < compressedSize)
+      break;
+    const char* compressedBuffer = streamBuffer.data() + position + sizeof(compressedSize);
+    position += sizeof(compressedSize) + compressedSize;
+    size_t uncompressedSize = 0;
+    snappy_uncompressed_length(compressedBuffer, compressedSize, &uncompressedSize);
+    uncompressBuffer.resize(uncompressedSize);
+    if(snappy_uncompress(compressedBuffer, compressedSize, uncompressBuffer.data(), &uncompressedSize) != SNAPPY_OK)
+    {
+      disconnect();
+      break;
+    }
+    InBinaryMemory(uncompressBuffer.data(), uncompressedSize) >> *this;
+  }
+  if(logStream)
+    streamBuffer.erase(streamBuffer.begin(), streamBuffer.begin() + position);
+  if(connectionLost)
+    disconnect();
+
+  if(size() == sizeBefore)
+    return false;
+  updateIndices(from);
+  return true;
+}
+
 MessageID LogPlayer::id(Message message) const
 {
   MessageID logId = message.id();
@@ -416,6 +552,18 @@ const std::unordered_map<std::string, std::vector<AnnotationInfo::AnnotationData
   return annotationsPerThread;
 }
 
+std::vector<std::pair<std::string, AnnotationInfo::AnnotationData>> LogPlayer::findAnnotations(const std::regex& pattern, unsigned from, unsigned to) const
+{
+  std::vector<std::pair<std::string, AnnotationInfo::AnnotationData>> result;
+  for(const auto& [threadName, annotations] : this->annotations())
+    for(const AnnotationInfo::AnnotationData& annotation : annotations)
+      if(annotation.time >= from && annotation.time <= to
+         && (std::regex_search(annotation.name, pattern) || std::regex_search(annotation.annotation, pattern)))
+        result.emplace_back(threadName, annotation);
+  std::sort(result.begin(), result.end(), [](const auto& a, const auto& b) {return a.second.frame < b.second.frame;});
+  return result;
+}
+
 void LogPlayer::playBack(size_t frame)
 {
   if(!frameIndex.empty())
@@ -436,18 +584,98 @@ void LogPlayer::playBack(size_t frame)
       if(currentFrame == frame)
         return;
     }
-    size_t originalSize = target.size();
     const_iterator end = frame + 1 == frameIndex.size() ? this->end() : begin() + frameIndex[frame + 1];
-    target << std::pair<const_iterator, const_iterator>(begin() + frameIndex[frame], end);
-    for(auto i = target.begin() + originalSize; i != target.end(); ++i)
+    if(!framesHaveImage[frame] || !decodesImages())
+      copyToTarget(begin() + frameIndex[frame], end);
+    else
     {
-      const MessageID id = static_cast<MessageID>(*i.current);
-      *const_cast<char*>(i.current) = id < mapLogToID.size() ? mapLogToID[id] : undefined;
+      // JPEG images are replaced by the camera images decoded from them.
+      if(!imageDecoder->contains(frame))
+        imageDecoder->request(frame, jpegImagesOf(frame));
+      const std::vector<CameraImage>& cameraImages = imageDecoder->get(frame);
+      auto cameraImage = cameraImages.begin();
+      const_iterator from = begin() + frameIndex[frame];
+      for(const_iterator i = from; i != end; ++i)
+        if(id(*i) == idJPEGImage)
+        {
+          copyToTarget(from, i);
+          target.bin(idCameraImage) << *cameraImage++;
+          from = i;
+          ++from;
+        }
+      copyToTarget(from, end);
     }
+    if(decodeImages)
+      readImagesAhead(frame, currentFrame);
   }
   currentFrame = frame;
 }
 
+void LogPlayer::copyToTarget(const_iterator from, const_iterator to)
+{
+  size_t originalSize = target.size();
+  target << std::pair<const_iterator, const_iterator>(from, to);
+  for(auto i = target.begin() + originalSize; i != target.end(); ++i)
+  {
+    const MessageID id = static_cast<MessageID>(*i.current);
+    *const_cast<char*>(i.current) = id < mapLogToID.size() ? mapLogToID[id] : undefined;
+  }
+}
+
+void LogPlayer::invalidateImages(bool completely)
+{
+  imageDecodingChecked = false;
+  if(completely && imageDecoder)
+    imageDecoder->clear();
+}
+
+bool LogPlayer::decodesImages()
+{
+  if(!imageDecodingChecked)
+  {
+    TypeInfo::initCurrent();
+    decodeImages = frequencyOf(idJPEGImage) && typeInfo
+                   && typeInfo->classes.contains("CameraImage") && typeInfo->classes.contains("JPEGImage")
+                   && TypeInfo::current->areTypesEqual(*typeInfo, "CameraImage", "CameraImage")
+                   && TypeInfo::current->areTypesEqual(*typeInfo, "JPEGImage", "JPEGImage");
+    if(decodeImages && !imageDecoder)
+      imageDecoder = std::make_unique<LogImageDecoder>(std::max(1u, std::thread::hardware_concurrency() / 2));
+    imageDecodingChecked = true;
+  }
+  return decodeImages;
+}
+
+std::vector<JPEGImage> LogPlayer::jpegImagesOf(size_t frame) const
+{
+  std::vector<JPEGImage> jpegImages;
+  const_iterator end = frame + 1 == frameIndex.size() ? this->end() : begin() + frameIndex[frame + 1];
+  for(const_iterator i = begin() + frameIndex[frame]; i != end; ++i)
+    if(id(*i) == idJPEGImage)
+      (*i).bin() >> jpegImages.emplace_back();
+  return jpegImages;
+}
+
+void LogPlayer::readImagesAhead(size_t frame, size_t previousFrame)
+{
+  const bool backward = static_cast<ptrdiff_t>(previousFrame) >= 0 && previousFrame > frame;
+
+  // Images of the frame played back are kept for playing it back again.
+  std::vector<size_t> frames = {frame};
+  for(size_t i = 0; frames.size() <= imageReadAhead && i < frameIndex.size(); ++i)
+  {
+    if(backward ? frame == 0 : (frame + 1 == frameIndex.size() && !cycle))
+      break;
+    frame = backward ? frame - 1 : (frame + 1) % frameIndex.size();
+    if(framesHaveImage[frame])
+    {
+      frames.push_back(frame);
+      if(!imageDecoder->contains(frame))
+        imageDecoder->request(frame, jpegImagesOf(frame));
+    }
+  }
+  imageDecoder->retain(frames);
+}
+
 size_t LogPlayer::nextImageFrame(size_t frame) const
 {
   if(anyFrameHasImage)
@@ -18,22 +18,31 @@
  * loaded completely. When a log file is opened for the first time, indices are
  * computed and appended to the file. Further uses can directly load these
  * indices to avoid recreating them and thereby going through the whole log
- * file.
+ * file. Log files recorded by the logger already contain these indices, also
+ * if they are compressed.
+ * The log player can also receive the frames a robot streams while it logs
+ * them. They are appended as they arrive and the indices are extended, so
+ * they can be played back immediately and saved later.
+ * JPEG images are decoded in worker threads for the frames that will
+ * probably be played back next. They are played back as camera images.
  *
  * @author Thomas Röfer
  */
 
 #pragma once
 
+#include "LogImageDecoder.h"
+#include "Network/TcpComm.h"
 #include "Platform/MemoryMappedFile.h"
 #include "Representations/AnnotationInfo.h"
 #include "Streaming/MessageQueue.h"
 #include "Streaming/TypeInfo.h"
+#include <limits>
+#include <regex>
 #include <unordered_map>
 
 class LogPlayer : public MessageQueue
 {
-  static const unsigned char indexVersion = 2; /**< The version of the index chunk. */
   MessageQueue& target; /**< The queue played back messages are copied to. */
   std::string path; /**< The file system path to the log file. */
   std::unique_ptr<MemoryMappedFile> file; /**< The memory mapped file if an uncompressed log was loaded from disk. */
@@ -49,6 +58,13 @@ class LogPlayer : public MessageQueue
   std::unordered_map<std::string, std::vector<AnnotationInfo::AnnotationData>> annotationsPerThread; /**< Annotations per thread. */
   size_t sizeWhenIndexWasComputed = 0; /**< Remembers the size of the message queue when the indices were computed. */
   size_t currentFrame = -1; /**< The current frame, i.e. the one that was last played back. */
+  std::unique_ptr<TcpComm> logStream; /**< The connection to a robot that streams the frames it logs. */
+  std::vector<char> streamBuffer; /**< The data received from the robot that was not processed yet. */
+  bool streamPrefixRead = false; /**< Were the chunks before the log data received from the robot? */
+  static constexpr size_t imageReadAhead = 8; /**< The number of frames with images ahead of the current one whose images are decoded. */
+  std::unique_ptr<LogImageDecoder> imageDecoder; /**< Decodes JPEG images in advance. Created when it is needed for the first time. */
+  bool imageDecodingChecked = false; /**< Was it determined whether JPEG images can be decoded in advance? */
+  bool decodeImages = false; /**< Are JPEG images decoded in advance and played back as camera images? */
 
   /**
    * Reads the names of the message ids from a stream and fills the fields
@@ -69,8 +85,11 @@ class LogPlayer : public MessageQueue
    * \c anyFrameHasImage and \c sizeWhenIndexWasComputed are updated as well.
    * If the last frame in the log is not complete, the queue is resized to
    * discard that frame.
+   * @param from The offset in the queue from which the indices are extended.
+   *             It must be the beginning of a frame. If 0, the indices are
+   *             recomputed completely.
    */
-  void updateIndices();
+  void updateIndices(size_t from = 0);
 
   /**
    * Load the indices from a stream, i.e. \c frameIndex , \c framesHaveImage ,
@@ -83,6 +102,43 @@ class LogPlayer : public MessageQueue
    */
   bool readIndices(In& stream, size_t& usedSize);
 
+  /**
+   * Forgets all decoded images, because the frames of the log changed.
+   * @param completely Did the existing frames change as well? Otherwise,
+   *                   frames were only appended.
+   */
+  void invalidateImages(bool completely);
+
+  /**
+   * Determines whether JPEG images are decoded in advance. This is only
+   * possible if the log contains JPEG images and its camera images and
+   * JPEG images have the same types as the current ones.
+   * @return Are JPEG images decoded in advance?
+   */
+  bool decodesImages();
+
+  /**
+   * Returns the JPEG images of a frame.
+   * @param frame The number of the frame.
+   * @return The images in the order of the log.
+   */
+  std::vector<JPEGImage> jpegImagesOf(size_t frame) const;
+
+  /**
+   * Requests to decode the images of the frames that will probably be played
+   * back after a certain frame, i.e. in the direction the log is played.
+   * @param frame The frame played back.
+   * @param previousFrame The frame played back before.
+   */
+  void readImagesAhead(size_t frame, size_t previousFrame);
+
+  /**
+   * Copies messages to the target queue and translates their ids.
+   * @param from The first message copied.
+   * @param to The end of the messages copied.
+   */
+  void copyToTarget(const_iterator from, const_iterator to);
+
   /**
    * Write the indices to a stream.
    * @param stream The stream to write to.
@@ -106,6 +162,7 @@ public:
    */
   enum State {stopped, playing, recording} state = stopped;
   bool cycle = false; /**< Will playback continue at the beginning after reaching the end? */
+  bool fast = false; /**< Are frames played back as soon as their threads processed the previous ones? */
 
   /**
    * Constructor.
@@ -138,6 +195,31 @@ public:
    */
   bool save(std::string fileName, const TypeInfo& typeInfo);
 
+  /**
+   * Connects to a robot that streams the frames it logs. The current log is
+   * cleared. The frames are appended by calling \c receive .
+   * @param ip The IP address of the robot.
+   * @param port The port the logger of the robot streams to.
+   * @return Could the connection be established?
+   */
+  bool connect(const std::string& ip, int port);
+
+  /** Closes the connection to a robot that streams its log. */
+  void disconnect();
+
+  /**
+   * Appends the frames received from the robot since the last call and
+   * extends the indices. Closes the connection if it was lost.
+   * @return Were any frames appended?
+   */
+  bool receive();
+
+  /**
+   * Is the log player connected to a robot that streams its log?
+   * @return Is it connected?
+   */
+  bool isReceiving() const {return logStream != nullptr;}
+
   /**
    * Returns the message type translated to the current value in the
    * enumeration type. Any id that stems from a log file must be translated
@@ -184,6 +266,16 @@ public:
    */
   const std::unordered_map<std::string, std::vector<AnnotationInfo::AnnotationData>>& annotations() const;
 
+  /**
+   * Searches the annotations in the index of the log without reading the frames.
+   * @param pattern A regular expression that must be found in the name or the text of an annotation.
+   * @param from The earliest time of the frame of an annotation (in ms).
+   * @param to The latest time of the frame of an annotation (in ms).
+   * @return The annotations found together with the names of their threads, sorted by their frames.
+   */
+  std::vector<std::pair<std::string, AnnotationInfo::AnnotationData>> findAnnotations(const std::regex& pattern, unsigned from = 0,
+                                                                                      unsigned to = std::numeric_limits<unsigned>::max()) const;
+
   // The remaining methods are only available when a log file was loaded from
   // disk (and not cleared afterwards).
 
@@ -200,6 +292,14 @@ public:
    */
   size_t frame() const {return currentFrame;}
 
+  /**
+   * Sets the number of the frame that was last played back without playing
+   * back any frame, e.g. because the states of the threads were restored to
+   * the ones after that frame.
+   * @param frame The number of the frame or \c size_t(-1) for none.
+   */
+  void setFrame(size_t frame) {currentFrame = frame;}
+
   /**
    * Plays back a frame.
    * @param frame The number of the frame to play back. If \c cycle is true,
@@ -236,6 +336,12 @@ public:
    */
   std::string threadOf(size_t frame) const;
 
+  /**
+   * Returns the type information of the log file entries.
+   * @return The type information or \c nullptr if the log does not contain any.
+   */
+  const TypeInfo* getTypeInfo() const {return typeInfo.get();}
+
   /** Request that the type information will be inserted into the target queue. */
   void requestTypeInfo() {typeInfoRequested = true;}
 };
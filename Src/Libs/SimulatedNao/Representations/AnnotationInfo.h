@@ -19,6 +19,7 @@ public:
     unsigned frame;
     std::string name;
     std::string annotation;
+    unsigned time = 0; /**< The time of the frame the annotation is part of (from its \c FrameInfo ) or 0 if unknown. */
 
     void read(MessageQueue::Message message);
   };
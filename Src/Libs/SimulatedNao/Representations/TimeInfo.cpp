@@ -75,6 +75,20 @@ bool TimeInfo::handleMessage(MessageQueue::Message message, bool justReadNames)
 
     lastFrameNo = frameNo;
     lastStartTime = threadStartTime;
+
+    // Older logs do not contain the distributions.
+    if(!stream.eof())
+    {
+      unsigned short distributionCount;
+      stream >> distributionCount;
+      for(int i = 0; i < distributionCount; ++i)
+      {
+        unsigned short watchId;
+        stream >> watchId;
+        Info& info = infos[watchId];
+        stream >> info.median >> info.p95 >> info.p99 >> info.longest;
+      }
+    }
     return true;
   }
   else
@@ -88,6 +102,14 @@ void TimeInfo::getStatistics(const Info& info, float& minTime, float& maxTime, f
   maxTime = info.maximum() / 1000.0f;
 }
 
+void TimeInfo::getDistribution(const Info& info, float& median, float& p95, float& p99, float& longest) const
+{
+  median = static_cast<float>(info.median) / 1000.0f;
+  p95 = static_cast<float>(info.p95) / 1000.0f;
+  p99 = static_cast<float>(info.p99) / 1000.0f;
+  longest = static_cast<float>(info.longest) / 1000.0f;
+}
+
 void TimeInfo::getThreadStatistics(float& outAvgFreq, float& outMin, float& outMax) const
 {
   outAvgFreq = threadDeltas.sum() != 0.f ? 1000.0f / threadDeltas.average() : 0.f;
@@ -18,6 +18,10 @@ class InfoWithTimestamp : public RingBufferWithSum<float, 100>
 {
 public:
   unsigned int timestamp = 0;
+  unsigned median = 0; /**< The median of the last measurements on the robot in us. */
+  unsigned p95 = 0; /**< The 95% quantile of the last measurements on the robot in us. */
+  unsigned p99 = 0; /**< The 99% quantile of the last measurements on the robot in us. */
+  unsigned longest = 0; /**< The longest of the last measurements on the robot in us. */
 };
 
 /**
@@ -70,6 +74,18 @@ public:
    */
   void getStatistics(const Info& info, float& outMinTime, float& outMaxTime, float& outAvgTime) const;
 
+  /**
+   * The function returns the distribution of the last measurements of a certain
+   * stop watch determined on the robot. In contrast to getStatistics, it also
+   * covers frames the timing was not sent for.
+   * @param info Information on the stop watch to query.
+   * @param median The median is returned to this variable in ms.
+   * @param p95 The 95% quantile is returned to this variable in ms.
+   * @param p99 The 99% quantile is returned to this variable in ms.
+   * @param longest The longest measurement is returned to this variable in ms.
+   */
+  void getDistribution(const Info& info, float& median, float& p95, float& p99, float& longest) const;
+
   /**
    * Returns the frequency of the process attached to this time info.
    */
@@ -16,8 +16,10 @@
 #include "Platform/File.h"
 #include "Platform/Time.h"
 #include "Framework/Settings.h"
+#include "Framework/StartupTrace.h"
 
 #include <QApplication>
+#include <vector>
 
 #ifdef MACOS
 #include "AppleHelper/Helper.h"
@@ -42,6 +44,7 @@ bool RoboCupCtrl::compile()
 {
   static_assert(static_cast<int>(SimRobotCore2::scene) != static_cast<int>(SimRobotCore2D::scene),
                 "The kinds 'scene' must be different to distinguish between simulation cores.");
+  StartupTrace::Step step("scene", "compile");
 
   // find simulation object
   SimRobotCore2D::Scene* scene2D = nullptr;
@@ -312,8 +315,21 @@ void RoboCupCtrl::update()
 
   gameController.update();
 
+  // The robots run their frames in parallel. Data is exchanged with each robot as soon
+  // as it has finished, so that it can continue while others are still busy.
   for(ControllerRobot* robot : robots)
-    robot->update();
+    robot->beginUpdate();
+  std::vector<ControllerRobot*> pending(robots.begin(), robots.end());
+  while(!pending.empty())
+  {
+    const std::size_t numOfPending = pending.size();
+    std::erase_if(pending, [](ControllerRobot* robot) {return robot->finishUpdate(false);});
+    if(pending.size() == numOfPending)
+    {
+      pending.front()->finishUpdate(true);
+      pending.erase(pending.begin());
+    }
+  }
 
   Time::addSimulatedTime(static_cast<int>(simStepLength + 0.5f));
 }
@@ -11,6 +11,7 @@
 #include "ConsoleRoboCupCtrl.h"
 #include "Debugging/DebugDataStreamer.h"
 #include "Framework/LoggingTools.h"
+#include "Framework/ModuleGraphRunner.h"
 #include "Framework/Settings.h"
 #include "ImageExport.h"
 #include "Platform/File.h"
@@ -35,6 +36,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 #include <iostream>
 #include <set>
 
@@ -382,6 +384,8 @@ bool RobotConsole::handleConsoleLine(const std::string& line)
   {
     result = sharedAutonomyChallenge(stream);
   }
+  else if(command == "ts")
+    result = saveTiming(stream);
   else if(command == "vfd")
   {
     PREREQUISITE(idModuleTable);
@@ -610,17 +614,39 @@ void RobotConsole::handleSharedAutonomyMessages()
     MessageQueue queue;
     queue.setBuffer(buffer, 0, sizeof(buffer) - 1);
     queue.bin(idSharedAutonomyRequest) << sharedAutonomyRequest;
-    if(joystick)
-      queue.bin(idJoystickState) << joystickState;
     sharedAutonomyChannel->send(buffer, static_cast<int>(queue.end() - queue.begin()));
   }
 
+  // Sending the joystick state more often in a compact packet. Each packet is sent
+  // several times, so that a lost packet does not delay the operator's input.
+  if(joystick && Time::getRealTimeSince(timeJoystickPacketSent) >= joystickPacketPeriod)
+  {
+    timeJoystickPacketSent = Time::getRealSystemTime();
+    SharedAutonomyChannel::JoystickPacket packet;
+    packet.sequenceNumber = ++joystickSequenceNumber;
+    packet.sendTime = timeJoystickPacketSent;
+    packet.axes = joystickState.axes;
+    packet.buttons = joystickState.buttons;
+    packet.latency = static_cast<unsigned short>(std::lround(joystickLatency));
+    char data[SharedAutonomyChannel::JoystickPacket::size];
+    packet.write(data);
+    for(int i = 0; i < joystickPacketCopies; ++i)
+      sharedAutonomyChannel->send(data, SharedAutonomyChannel::JoystickPacket::size);
+  }
+
   // receiving data from the robot
   for(;;)
   {
     const int size = sharedAutonomyChannel->receive(buffer, sizeof(buffer));
+    SharedAutonomyChannel::AckPacket ack;
     if(size <= 0) // no packet available -> stop
       break;
+    else if(ack.read(buffer, size))
+    {
+      // The latency is half of the round trip time. It is smoothed.
+      const float latency = static_cast<float>(Time::getRealTimeSince(ack.sendTime)) / 2.f;
+      joystickLatency = joystickLatency == 0.f ? latency : joystickLatency + (latency - joystickLatency) / 8.f;
+    }
     else if(static_cast<unsigned>(size) < sizeof(buffer))
     {
       MessageQueue queue;
@@ -864,11 +890,18 @@ bool RobotConsole::handleMessage(MessageQueue::Message message)
         stream >> shapeType >> id;
         const char* name = data.drawingManager.getDrawingName(id); // const char* is required here
         std::string type = data.drawingManager.getDrawingType(name);
+        DebugDrawing* drawing = type == "drawingOnImage" ? &incompleteImageDrawings[name]
+                                : type == "drawingOnField" ? &incompleteFieldDrawings[name] : nullptr;
 
-        if(type == "drawingOnImage")
-          incompleteImageDrawings[name].addShapeFromQueue(stream, static_cast<::Drawings::ShapeType>(shapeType));
-        else if(type == "drawingOnField")
-          incompleteFieldDrawings[name].addShapeFromQueue(stream, static_cast<::Drawings::ShapeType>(shapeType));
+        // All shapes in a message belong to the same drawing.
+        if(drawing)
+          while(true)
+          {
+            drawing->addShapeFromQueue(stream, static_cast<::Drawings::ShapeType>(shapeType));
+            if(stream.eof())
+              break;
+            stream >> shapeType >> id;
+          }
       }
       return true;
     }
@@ -951,9 +984,10 @@ bool RobotConsole::handleMessage(MessageQueue::Message message)
       float value;
       stream >> id >> value;
       Plot& plot = threadData[threadName].plots[ctrl->translate(id)];
-      plot.points.push_back(value);
-      while(plot.points.size() > maxPlotSize)
-        plot.points.pop_front();
+      if(plot.points.capacity() != maxPlotSize)
+        plot.points.reserve(maxPlotSize);
+      if(maxPlotSize)
+        plot.points.push_front(value);
       plot.timestamp = Time::getCurrentSystemTime();
       return true;
     }
@@ -1009,6 +1043,51 @@ void RobotConsole::updateAnnotationsFromLog()
   }
 }
 
+void RobotConsole::saveModuleSnapshot(size_t frame)
+{
+  const auto next = snapshotFrames.upper_bound(frame);
+  if(!snapshotInterval || frame >= logPlayer.frames() || (next != snapshotFrames.begin() && frame - *std::prev(next) < snapshotInterval))
+    return;
+  for(const auto& [_, data] : threadData)
+    if(!data.logAcknowledged)
+      return;
+  debugSender->bin(idModuleSnapshot) << static_cast<unsigned char>(ModuleGraphRunner::saveSnapshot) << static_cast<unsigned>(frame);
+  snapshotFrames.insert(frame);
+}
+
+bool RobotConsole::seekLogFrame(size_t frame)
+{
+  if(frame >= logPlayer.frames())
+    return false;
+  for(const auto& [_, data] : threadData)
+    if(!data.logAcknowledged)
+      return false;
+
+  // The snapshot of a frame contains the states before it was played back.
+  const auto next = snapshotFrames.upper_bound(frame);
+  const size_t current = logPlayer.frame();
+  if(next != snapshotFrames.begin() && (frame <= current || static_cast<ptrdiff_t>(current) < 0 || *std::prev(next) > current + 1))
+  {
+    const size_t snapshot = *std::prev(next);
+    debugSender->bin(idModuleSnapshot) << static_cast<unsigned char>(ModuleGraphRunner::restoreSnapshot) << static_cast<unsigned>(snapshot);
+    logPlayer.setFrame(snapshot - 1);
+  }
+  else if(frame <= current || static_cast<ptrdiff_t>(current) < 0)
+    return false;
+
+  seekTarget = frame;
+  logPlayer.state = LogPlayer::playing;
+  return true;
+}
+
+void RobotConsole::clearModuleSnapshots()
+{
+  if(!snapshotFrames.empty())
+    debugSender->bin(idModuleSnapshot) << static_cast<unsigned char>(ModuleGraphRunner::clearSnapshots) << 0u;
+  snapshotFrames.clear();
+  seekTarget = -1;
+}
+
 bool RobotConsole::poll(MessageID id)
 {
   if(moduleRequestChanged && (id == idDebugResponse || id == idDrawingManager || id == idDrawingManager3D))
@@ -1500,6 +1579,7 @@ bool RobotConsole::log(In& stream)
     {
       SYNC;
       logPlayer.state = mode == SystemCall::logFileReplay ? LogPlayer::playing : LogPlayer::recording;
+      logPlayer.fast = option == "fast";
     }
     else if(command == "stop")
     {
@@ -1527,6 +1607,26 @@ bool RobotConsole::log(In& stream)
     }
     else if(command == "analyzeRobotStatus")
       return logExtractor.analyzeRobotStatus();
+    else if(command == "annotations")
+    {
+      unsigned from = 0;
+      unsigned to = std::numeric_limits<unsigned>::max();
+      std::string time;
+      stream >> time;
+      if(!time.empty())
+      {
+        from = static_cast<unsigned>(std::stoul(time));
+        stream >> time;
+        if(time.empty())
+          return false;
+        to = static_cast<unsigned>(std::stoul(time));
+      }
+      SYNC;
+      for(const auto& [threadName, annotation] : logPlayer.findAnnotations(std::regex(option), from, to))
+        ctrl->printLn(std::to_string(annotation.frame) + "\t" + threadName + "\t" + std::to_string(annotation.time) + "\t"
+                      + annotation.name + ": " + annotation.annotation);
+      return true;
+    }
     else if(command == "saveImages")
     {
       SYNC;
@@ -1562,6 +1662,18 @@ bool RobotConsole::log(In& stream)
         option = "Images/" + option;
       return logExtractor.saveImages(option, raw, onlyPlaying, takeEachNthFrame);
     }
+    else if(command == "saveColumns")
+    {
+      SYNC;
+      const std::string thread = option;
+      std::vector<std::string> representations;
+      for(stream >> option; !option.empty(); stream >> option)
+        representations.push_back(option);
+      std::string::size_type pos = logFile.rfind('.');
+      if(thread.empty() || representations.empty() || pos == std::string::npos)
+        return false;
+      return logExtractor.saveColumns(logFile.substr(0, pos) + "_" + thread + ".columns", thread, representations);
+    }
     else if(command == "saveAudio")
     {
       SYNC;
@@ -1669,6 +1781,7 @@ bool RobotConsole::log(In& stream)
           ++frameCounter;
         return frameCounter >= startFrame && frameCounter <= endFrame;
       });
+      clearModuleSnapshots();
       updateAnnotationsFromLog();
     }
     else if(command == "?")
@@ -1769,6 +1882,7 @@ bool RobotConsole::log(In& stream)
             option = std::string("Logs/") + option;
           if(logPlayer.open(option))
           {
+            clearModuleSnapshots();
             logFile = option;
             updateAnnotationsFromLog();
           }
@@ -1776,6 +1890,38 @@ bool RobotConsole::log(In& stream)
             return false;
         }
       }
+      else if(command == "stream")
+      {
+        if(option == "off")
+          logPlayer.disconnect();
+        else
+        {
+          std::string port;
+          stream >> port;
+          if(option.empty() || port.empty())
+            return false;
+          if(logPlayer.connect(option, std::stoi(port)))
+          {
+            clearModuleSnapshots();
+            logFile = option + ":" + port;
+            logPlayer.state = LogPlayer::playing;
+          }
+          else
+            ctrl->printLn("Error: Cannot connect to " + option + ":" + port + ".");
+        }
+      }
+      else if(command == "snapshots")
+      {
+        if(option == "off")
+        {
+          snapshotInterval = 0;
+          clearModuleSnapshots();
+        }
+        else if(!option.empty())
+          snapshotInterval = std::stoul(option);
+        else
+          return false;
+      }
       else if(command == "cycle")
         logPlayer.cycle = true;
       else if(command == "once")
@@ -1784,26 +1930,33 @@ bool RobotConsole::log(In& stream)
       {
         auto state = logPlayer.state;
         logPlayer.state = LogPlayer::stopped;
+        seekTarget = -1;
+        const auto seek = [&](size_t frame) {return snapshotInterval && seekLogFrame(frame);};
         if(command == "forward" && option == "fast")
           logPlayer.playBack(logPlayer.frame() + 100);
         else if(command == "forward" && option == "image")
           logPlayer.playBack(logPlayer.nextImageFrame(logPlayer.frame()));
         else if(command == "forward" && option.empty())
           logPlayer.playBack(logPlayer.frame() + 1);
-        else if(command == "backward" && option == "fast")
-          logPlayer.playBack(logPlayer.frame() - 100);
-        else if(command == "backward" && option == "image")
-          logPlayer.playBack(logPlayer.prevImageFrame(logPlayer.frame()));
-        else if(command == "backward" && option.empty())
-          logPlayer.playBack(logPlayer.frame() - 1);
+        else if(command == "backward" && (option == "fast" || option == "image" || option.empty()))
+        {
+          const size_t frame = option == "fast" ? logPlayer.frame() - 100
+                               : option == "image" ? logPlayer.prevImageFrame(logPlayer.frame())
+                               : logPlayer.frame() - 1;
+          if(!seek(frame))
+            logPlayer.playBack(frame);
+        }
         else if(command == "repeat")
           logPlayer.playBack(logPlayer.frame());
         else if(command == "goto")
         {
           const size_t targetFrame = std::stoul(option);
-          size_t frame = logPlayer.prevImageFrame(logPlayer.prevImageFrame(targetFrame));
-          while(frame <= targetFrame)
-            logPlayer.playBack(frame++);
+          if(!seek(targetFrame))
+          {
+            size_t frame = logPlayer.prevImageFrame(logPlayer.prevImageFrame(targetFrame));
+            while(frame <= targetFrame)
+              logPlayer.playBack(frame++);
+          }
         }
         else if(command != "pause")
         {
@@ -2188,6 +2341,42 @@ bool RobotConsole::saveImage(In& stream, std::string threadName)
   }
 }
 
+bool RobotConsole::saveTiming(In& stream)
+{
+  std::string name;
+  stream >> name;
+  if(name.empty())
+    name = "Timing";
+  if(!File::hasExtension(name))
+    name += ".csv";
+
+  OutTextRawFile file(name);
+  if(!file.exists())
+    return false;
+
+  // The robot-side distribution covers all frames, the console-side statistics only those timings were sent for.
+  file << "thread,stopwatch,median,p95,p99,longest,average,minimum,maximum" << endl;
+  SYNC;
+  for(const auto& [threadName, data] : threadData)
+  {
+    const TimeInfo& timeInfo = data.timeInfo;
+    float frequency, minDelta, maxDelta;
+    timeInfo.getThreadStatistics(frequency, minDelta, maxDelta);
+    if(frequency > 0.f)
+      file << threadName << ",framePeriod,,,,," << 1000.f / frequency << "," << minDelta << "," << maxDelta << endl;
+
+    for(const auto& [id, info] : timeInfo.infos)
+    {
+      float median, p95, p99, longest, average, minimum, maximum;
+      timeInfo.getDistribution(info, median, p95, p99, longest);
+      timeInfo.getStatistics(info, minimum, maximum, average);
+      file << threadName << "," << timeInfo.getName(id) << "," << median << "," << p95 << "," << p99 << "," << longest
+           << "," << average << "," << minimum << "," << maximum << endl;
+    }
+  }
+  return true;
+}
+
 bool RobotConsole::sensorNoise(In& stream)
 {
   std::string option;
@@ -17,6 +17,7 @@
 #include "Framework/ThreadFrame.h"
 #include "LogExtractor.h"
 #include "LogPlayer.h"
+#include "Math/RingBuffer.h"
 #include "Platform/Joystick.h"
 #include "Representations/AnnotationInfo.h"
 #include "Representations/BehaviorControl/ActivationGraph.h"
@@ -39,6 +40,7 @@
 
 #include <QString>
 #include <list>
+#include <set>
 
 class ConsoleRoboCupCtrl;
 class ImageView;
@@ -89,7 +91,7 @@ public:
 
   struct Plot
   {
-    std::list<float> points;
+    RingBuffer<float> points; /**< The values of the plot. The newest one is at index 0. */
     unsigned timestamp = 0;
   };
 
@@ -176,6 +178,9 @@ public:
 
 protected:
   LogPlayer logPlayer; /**< The log player to record and replay log files. */
+  size_t snapshotInterval = 0; /**< The states of the threads are stored every this many frames during replay. 0 if never. */
+  std::set<size_t> snapshotFrames; /**< The frames before which the states of the threads were stored. */
+  size_t seekTarget = -1; /**< The frame at which replay stops after seeking. \c size_t(-1) if not seeking. */
   const char* pollingFor = nullptr; /**< The information the console is waiting for. */
   bool jointCalibrationChanged = false; /**< Was the joint calibration changed since setting it for the local robot? */
   std::unique_ptr<SimulatedRobot> simulatedRobot; /**< The interface to simulated objects. */
@@ -241,6 +246,11 @@ private:
   JoystickState joystickState; /**< The last joystick state measured. */
 
   std::unique_ptr<SharedAutonomyChannel> sharedAutonomyChannel; /**< Channel to remote robot in shared autonomy challenge. */
+  static const int joystickPacketPeriod = 20; /**< The time between two joystick packets sent to the remote robot (in ms). */
+  static const int joystickPacketCopies = 2; /**< How often is each joystick packet sent to compensate for packet loss? */
+  unsigned joystickSequenceNumber = 0; /**< The sequence number of the last joystick packet sent. */
+  unsigned timeJoystickPacketSent = 0; /**< When was the last joystick packet sent? */
+  float joystickLatency = 0.f; /**< The smoothed one-way latency to the remote robot (in ms). */
 
 public:
   /**
@@ -325,6 +335,29 @@ protected:
   /** Retrieves all annotations from the log player. */
   void updateAnnotationsFromLog();
 
+  /**
+   * Lets all threads store their states if the last snapshot before a frame
+   * is at least \c snapshotInterval frames earlier. This only happens if all
+   * threads processed the frames sent to them, because otherwise their
+   * states would not be complete.
+   * @param frame The frame that is played back next.
+   */
+  void saveModuleSnapshot(size_t frame);
+
+  /**
+   * Seeks to a frame of the log by restoring the states of the threads from
+   * the closest snapshot before it and replaying the frames in between. If
+   * the frame is ahead of the current one and no snapshot is closer, the
+   * frames are replayed from the current one. The replay stops at the frame.
+   * @param frame The frame to seek to.
+   * @return Could the seek be started? If not, there is no snapshot before
+   *         the frame or not all threads processed their frames yet.
+   */
+  bool seekLogFrame(size_t frame);
+
+  /** Lets all threads forget the states they stored. */
+  void clearModuleSnapshots();
+
 private:
   /** The function adds all per-thread views, but not. */
   void addPerThreadViews();
@@ -427,6 +460,7 @@ private:
   bool penalizeRobot(In&);
   bool repoll(In&);
   bool saveImage(In&, std::string threadName);
+  bool saveTiming(In&);
   bool sensorNoise(In&);
   bool set(In&, const std::string& threadName);
   bool sharedAutonomyChallenge(In&);
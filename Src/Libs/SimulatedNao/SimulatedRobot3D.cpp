@@ -31,6 +31,7 @@ SimulatedRobot3D::SimulatedRobot3D(SimRobot::Object* robot) :
   activeCameraIndex(activeCameraCount++)
 {
   ASSERT(activeCameraCount <= sizeof(activeCameras) / sizeof(activeCameras[0]));
+  randomGenerator = Random::Philox(0, getNumber(robot));
 
   // load camera parameters
   InMapFile intrStream("cameraIntrinsics.cfg");
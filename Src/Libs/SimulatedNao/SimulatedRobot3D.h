@@ -13,6 +13,7 @@
 #include "Representations/Configuration/RobotDimensions.h"
 #include "Representations/Infrastructure/CameraInfo.h"
 #include "Representations/Infrastructure/SensorData/RawInertialSensorData.h"
+#include "Math/Random.h"
 #include "Streaming/EnumIndexedArray.h"
 #include "RobotParts/Joints.h"
 #include <SimRobotCore2.h>
@@ -65,8 +66,7 @@ private:
   ENUM_INDEXED_ARRAY(CameraInfo, CameraInfo::Camera) cameraInfos; /**< Information about the upper camera. */
   RobotDimensions robotDimensions;
 
-  std::random_device rand {};
-  std::default_random_engine randomGenerator {rand()};
+  Random::Philox randomGenerator; /**< A separate random stream per robot, so that the noise does not depend on the order of the robots' updates. */
   std::normal_distribution<float> generalNormalDistribution {0.f, 1.f};
 
   bool newGyroMeasurement = false;
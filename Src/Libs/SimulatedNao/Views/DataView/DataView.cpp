@@ -13,6 +13,7 @@
 #include "Streaming/MessageQueue.h"
 
 #include <QEvent>
+#include <algorithm>
 
 DataView::DataView(const QString& fullName, const std::string& repName, const std::string& threadName,
                    RobotConsole& console, const TypeInfo& typeInfo) :
@@ -50,16 +51,34 @@ QtVariantProperty* DataView::getProperty(const std::string& fqn, int propertyTyp
 
   //add to parent if there is one.
   if(nullptr != pParent)
-    pParent->addSubProperty(pProp);
+    addSubProperty(pParent, pProp);
 
   return pProp;
 }
 
+void DataView::addSubProperty(QtProperty* pParent, QtProperty* pProperty)
+{
+  QtProperty*& pCurrentParent = propertiesToParents[pProperty];
+  if(pCurrentParent != pParent)
+  {
+    pParent->addSubProperty(pProperty);
+    pCurrentParent = pParent;
+  }
+}
+
+void DataView::removeSubProperty(QtProperty* pParent, QtProperty* pProperty)
+{
+  pParent->removeSubProperty(pProperty);
+  propertiesToParents.erase(pProperty);
+}
+
 void DataView::removeWidget()
 {
   pTheWidget = nullptr;
   pathsToProperties.clear();
   propertiesToPaths.clear();
+  propertiesToParents.clear();
+  displayedData.clear();
   forceUpdate = true;
 }
 
@@ -74,17 +93,24 @@ void DataView::updateTree()
   if(!shouldIgnoreUpdates())
   {
     SYNC_WITH(theConsole);
-    if(data)
+    if(data && (forceUpdate || Time::getRealTimeSince(lastUpdate) >= minUpdateInterval))
     {
-      auto stream = (*data->begin()).bin();
-      std::string type;
-      std::string representation;
-      stream >> representation >> this->type;
-      PropertyTreeCreator creator(*this);
-      DebugDataStreamer streamer(typeInfo, stream, this->type , "value");
-      creator << streamer;
-      pTheCurrentRootNode = creator.root;
-      pTheWidget->setRootProperty(pTheCurrentRootNode);
+      // The tree is only traversed if the data changed. It then only changes the properties affected.
+      const MessageQueue::Message message = *data->begin();
+      if(forceUpdate || message.size() != displayedData.size()
+         || !std::equal(displayedData.begin(), displayedData.end(), message.data()))
+      {
+        displayedData.assign(message.data(), message.data() + message.size());
+        auto stream = message.bin();
+        std::string representation;
+        stream >> representation >> this->type;
+        PropertyTreeCreator creator(*this);
+        DebugDataStreamer streamer(typeInfo, stream, this->type , "value");
+        creator << streamer;
+        pTheCurrentRootNode = creator.root;
+        pTheWidget->setRootProperty(pTheCurrentRootNode);
+        lastUpdate = Time::getRealSystemTime();
+      }
       data = nullptr;
       forceUpdate = false;
     }
@@ -178,6 +204,7 @@ void DataView::valueChanged()
 {
   if(ignoreUpdates)
   {
+    displayedData.clear(); // The tree differs from the data received now.
     if(theAutoSetModeIsEnabled)
       set(); //set current values
     else
@@ -15,6 +15,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <string>
+#include <vector>
 #include <qtvariantproperty.h>
 #include "Platform/Thread.h" // for SYNC
 #include "PropertyManager.h"
@@ -128,6 +129,9 @@ private:
   /** This map stores the reverse direction. */
   std::unordered_map<QtProperty*, std::string> propertiesToPaths;
 
+  /** The parent each property was added to. Properties without a parent are missing. */
+  std::unordered_map<QtProperty*, QtProperty*> propertiesToParents;
+
   /**
    * Which properties are differently expanded than the default? They are stored
    * in form of their paths. Since the root-level properties are expanded by default,
@@ -148,6 +152,10 @@ private:
 
   bool forceUpdate = true; /**< At least one update is required. */
 
+  static constexpr int minUpdateInterval = 16; /**< The tree is not updated more often than the display refreshes (in ms). */
+  unsigned lastUpdate = 0; /**< The real time when the tree was updated last. */
+  std::vector<char> displayedData; /**< The data displayed. Updates without changes are skipped. */
+
   /**
    * True if auto-set is enabled.
    * In auto-set mode the view will send a set command directly after the user finished editing one value.
@@ -177,6 +185,21 @@ private:
    */
   QtVariantProperty* getProperty(const std::string& fqn, int propertyType, const QString& name, QtProperty* pParent);
 
+  /**
+   * Adds a property to a parent unless it already is its child. Adding it
+   * again would be a no-op, but QtProperty still checks the whole subtree.
+   * @param pParent The new parent.
+   * @param pProperty The property added.
+   */
+  void addSubProperty(QtProperty* pParent, QtProperty* pProperty);
+
+  /**
+   * Removes a property from its parent.
+   * @param pParent The parent.
+   * @param pProperty The property removed.
+   */
+  void removeSubProperty(QtProperty* pParent, QtProperty* pProperty);
+
   /**
    * Determines whether the property should be expanded.
    * @param property The property in question.
@@ -36,7 +36,7 @@ void PropertyTreeCreator::outUInt(unsigned int value)
   {
     e.property = view.getProperty(e.path, TypeDescriptor::getGroupType(), e.name.c_str(), e.parent);
     while(value < static_cast<unsigned>(e.property->subProperties().size()))
-      e.property->removeSubProperty(e.property->subProperties().last());
+      view.removeSubProperty(e.property, e.property->subProperties().last());
   }
 }
 
@@ -74,7 +74,7 @@ void PropertyTreeCreator::deselect()
   QtVariantProperty* property = stack.back().property;
   stack.pop_back();
   if(!stack.empty())
-    stack.back().property->addSubProperty(property);
+    view.addSubProperty(stack.back().property, property);
   else
     root = property;
 }
@@ -8,6 +8,7 @@
 
 #include <QPinchGesture>
 #include <QSettings>
+#include <string_view>
 #include "DrawingView.h"
 #include "SimulatedNao/ConsoleRoboCupCtrl.h"
 #include "SimulatedNao/Visualization/PaintMethods.h"
@@ -222,6 +223,9 @@ void DrawingWidget::paintDrawings(QPainter& painter)
 {
   const QTransform baseTrans(painter.transform());
   std::unordered_map<std::string, QTransform> transforms;
+  for(auto& [_, cachedDrawing] : cachedDrawings)
+    cachedDrawing.used = false;
+
   for(const std::string& drawing : drawings)
     for(auto& [threadName, debugDrawing] : getDrawings(drawing))
     {
@@ -232,15 +236,54 @@ void DrawingWidget::paintDrawings(QPainter& painter)
         transform = transforms.find(threadName);
       }
       painter.setTransform(transform->second);
-      PaintMethods::paintDebugDrawing(painter, *debugDrawing, baseTrans);
+      if(debugDrawing->getSize() >= minCachedSize)
+        paintCachedDrawing(painter, drawing + "@" + threadName, *debugDrawing, baseTrans);
+      else
+        PaintMethods::paintDebugDrawing(painter, *debugDrawing, baseTrans);
       transform->second = painter.transform();
       if(debugDrawing->timestamp > lastDrawingsTimestamp)
         lastDrawingsTimestamp = debugDrawing->timestamp;
     }
 
+  std::erase_if(cachedDrawings, [](const auto& entry) {return !entry.second.used;});
   painter.setTransform(baseTrans);
 }
 
+void DrawingWidget::paintCachedDrawing(QPainter& painter, const std::string& key, const DebugDrawing& debugDrawing, const QTransform& baseTrans)
+{
+  CachedDrawing& cachedDrawing = cachedDrawings[key];
+  cachedDrawing.used = true;
+
+  // The drawing is sent again in every frame, so its content decides whether it changed.
+  const std::size_t hash = std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char*>(debugDrawing.getFirst()),
+                                                                          debugDrawing.getSize()));
+  const QPaintDevice& device = *painter.device();
+  const qreal ratio = device.devicePixelRatioF();
+  const QSize size(static_cast<int>(device.width() * ratio), static_cast<int>(device.height() * ratio));
+  if(hash != cachedDrawing.hash || painter.transform() != cachedDrawing.before || cachedDrawing.image.size() != size)
+  {
+    cachedDrawing.hash = hash;
+    cachedDrawing.before = painter.transform();
+    if(cachedDrawing.image.size() != size)
+    {
+      cachedDrawing.image = QImage(size, QImage::Format_ARGB32_Premultiplied);
+      cachedDrawing.image.setDevicePixelRatio(ratio);
+    }
+    cachedDrawing.image.fill(Qt::transparent);
+
+    QPainter imagePainter(&cachedDrawing.image);
+    imagePainter.setRenderHints(painter.renderHints());
+    imagePainter.setFont(painter.font());
+    imagePainter.setTransform(cachedDrawing.before);
+    PaintMethods::paintDebugDrawing(imagePainter, debugDrawing, baseTrans);
+    cachedDrawing.after = imagePainter.transform();
+  }
+
+  painter.resetTransform();
+  painter.drawImage(QPointF(0, 0), cachedDrawing.image);
+  painter.setTransform(cachedDrawing.after);
+}
+
 bool DrawingWidget::needsRepaint() const
 {
   SYNC_WITH(view.console);
@@ -9,12 +9,14 @@
 #pragma once
 
 #include <QIcon>
+#include <QImage>
 #include <QMouseEvent>
 #include <QPainter>
 #include <QString>
 #include <QWidget>
 #include <SimRobot.h>
 #include <functional>
+#include <unordered_map>
 #include "SimulatedNao/RobotConsole.h"
 
 /** The view as it is maintained by SimRobot. */
@@ -135,6 +137,17 @@ protected:
    */
   void paintDrawings(QPainter& painter);
 
+  /**
+   * Paints a drawing through an image that is only rendered again if the
+   * drawing's elements, the transform, or the size of the paint device changed.
+   * @param painter The graphics context to paint to. Its transform is updated
+   *                as if the drawing was painted directly.
+   * @param key The name under which the rendered drawing is cached.
+   * @param debugDrawing The drawing to paint.
+   * @param baseTrans The transform without any origins set by drawings.
+   */
+  void paintCachedDrawing(QPainter& painter, const std::string& key, const DebugDrawing& debugDrawing, const QTransform& baseTrans);
+
   /** @return Is it necessary to repaint this view? */
   virtual bool needsRepaint() const;
 
@@ -178,6 +191,19 @@ protected:
   QPointF offset; /**< The offset of the content relative to the window in logical coordinates. */
 
 private:
+  /** A drawing rendered into an image. */
+  struct CachedDrawing
+  {
+    QImage image; /**< The rendered drawing. */
+    std::size_t hash = 0; /**< A hash of the elements of the drawing. */
+    QTransform before; /**< The transform the drawing was rendered with. */
+    QTransform after; /**< The transform after rendering the drawing, which might have set an origin. */
+    bool used = false; /**< Was the drawing painted the last time the drawings were painted? */
+  };
+
+  std::unordered_map<std::string, CachedDrawing> cachedDrawings; /**< Large drawings rendered into images, indexed by drawing and thread name. */
+
+  static constexpr int minCachedSize = 65536; /**< Drawings with elements of at least this size (in bytes) are cached. */
   static constexpr Rangef zoomRange{0.1f, 500.f}; /**< The range to which \c zoom is clamped. */
   static constexpr float offsetStepRatio = 0.02f; /**< The step size for moving the content using the cursor key relative to the size of the view. */
 };
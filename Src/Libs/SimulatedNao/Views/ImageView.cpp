@@ -91,7 +91,6 @@ void ImageWidget::paint(QPainter& painter)
 
 void ImageWidget::copyImage(const DebugImage& srcImage)
 {
-  int width = srcImage.width;
   int height = srcImage.height;
 
   const QImage::Format desiredFormat =  QImage::Format::Format_RGB32;
@@ -110,19 +109,21 @@ void ImageWidget::copyImage(const DebugImage& srcImage)
 
   if(static_cast<ImageView&>(view).gain != 1.f)
   {
-    unsigned* p = reinterpret_cast<unsigned*>(imageData->scanLine(0));
-    float gain = static_cast<ImageView&>(view).gain;
-    for(unsigned* pEnd = p + width * height; p < pEnd; ++p)
+    // All channels are scaled the same way, so the results are looked up in a table.
+    const float gain = static_cast<ImageView&>(view).gain;
+    unsigned char scaled[256];
+    for(int i = 0; i < 256; ++i)
     {
-      int r = static_cast<int>(gain * static_cast<float>((*p >> 16) & 0xff));
-      int g = static_cast<int>(gain * static_cast<float>((*p >> 8) & 0xff));
-      int b = static_cast<int>(gain * static_cast<float>((*p) & 0xff));
+      const int value = static_cast<int>(gain * static_cast<float>(i));
+      scaled[i] = static_cast<unsigned char>(value < 0 ? 0 : value > 255 ? 255 : value);
+    }
 
-      *p = (r < 0 ? 0 : r > 255 ? 255 : r) << 16 |
-           (g < 0 ? 0 : g > 255 ? 255 : g) << 8 |
-           (b < 0 ? 0 : b > 255 ? 255 : b) |
+    unsigned* p = reinterpret_cast<unsigned*>(imageData->scanLine(0));
+    for(unsigned* pEnd = p + srcImage.getImageWidth() * height; p < pEnd; ++p)
+      *p = scaled[(*p >> 16) & 0xff] << 16 |
+           scaled[(*p >> 8) & 0xff] << 8 |
+           scaled[*p & 0xff] |
            0xff000000;
-    }
   }
 }
 
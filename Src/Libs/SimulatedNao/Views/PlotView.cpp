@@ -251,9 +251,32 @@ void PlotWidget::paint(QPainter& painter)
         size_t numOfPoints = std::min(plot->points.size(), static_cast<size_t>(view.plotSize));
         if(numOfPoints > 1)
         {
-          std::list<float>::const_iterator k = plot->points.end();
-          for(size_t i = 0; i < numOfPoints; ++i)
-            view.points[i].ry() = *(--k);
+          const size_t columns = static_cast<size_t>(plotRect.width());
+          if(numOfPoints > columns * 2)
+          {
+            // More than two values per pixel column: only draw the minimum and maximum of each column.
+            const float valuesPerColumn = plotSizeF / static_cast<float>(columns);
+            size_t begin = 0;
+            size_t count = 0;
+            for(size_t column = 1; begin < numOfPoints; ++column)
+            {
+              const size_t end = std::min(std::max(begin + 1, static_cast<size_t>(static_cast<float>(column) * valuesPerColumn)), numOfPoints);
+              size_t min = begin;
+              size_t max = begin;
+              for(size_t i = begin + 1; i < end; ++i)
+                if(plot->points[i] < plot->points[min])
+                  min = i;
+                else if(plot->points[i] > plot->points[max])
+                  max = i;
+              view.points[count++] = QPointF(static_cast<qreal>(std::min(min, max)), plot->points[std::min(min, max)]);
+              view.points[count++] = QPointF(static_cast<qreal>(std::max(min, max)), plot->points[std::max(min, max)]);
+              begin = end;
+            }
+            numOfPoints = count;
+          }
+          else
+            for(size_t i = 0; i < numOfPoints; ++i)
+              view.points[i] = QPointF(static_cast<qreal>(i), plot->points[i]);
 
           const ColorRGBA& color = layer.color;
           QPen pen = color == ColorRGBA::black ? blackPen : QPen(QColor(color.r, color.g, color.b));
@@ -317,10 +340,9 @@ void PlotWidget::determineMinMaxValue()
         int numOfPoints = std::min(static_cast<int>(plot->points.size()), static_cast<int>(view.plotSize));
         if(numOfPoints > 1)
         {
-          std::list<float>::const_iterator k = plot->points.begin();
-          for(int j = view.plotSize - numOfPoints; j < static_cast<int>(view.plotSize); ++j)
+          for(int j = 0; j < numOfPoints; ++j)
           {
-            const float& value(*(k++));
+            const float value = plot->points[j];
             if(started)
             {
               if(value < view.minValue)
@@ -411,9 +433,8 @@ void PlotWidget::exportAsGnuplot()
     for(const RobotConsole::Layer& layer : plotList)
       for(const RobotConsole::Plot* plot : getPlots(layer.layer))
       {
-        std::list<float>::const_reverse_iterator k = plot->points.rbegin();
         for(int j = numOfPoints - 1; j >= 0; --j)
-          data[j][currentPlot] = *(k++);
+          data[j][currentPlot] = plot->points[numOfPoints - 1 - j];
         ++currentPlot;
       }
   }
@@ -39,6 +39,10 @@ struct Row
   NumberTableWidgetItem* min;
   NumberTableWidgetItem* max;
   NumberTableWidgetItem* avg;
+  NumberTableWidgetItem* median;
+  NumberTableWidgetItem* p95;
+  NumberTableWidgetItem* p99;
+  NumberTableWidgetItem* longest;
 };
 
 TimeWidget::TimeWidget(TimeView& timeView) : timeView(timeView)
@@ -46,14 +50,14 @@ TimeWidget::TimeWidget(TimeView& timeView) : timeView(timeView)
   setFocusPolicy(Qt::StrongFocus);
 
   table = new QTableWidget();
-  table->setColumnCount(4);
+  table->setColumnCount(8);
   QStringList headerNames;
-  headerNames << "Stopwatch" << "Min" << "Max" << "Avg";
+  headerNames << "Stopwatch" << "Min" << "Max" << "Avg" << "P50" << "P95" << "P99" << "Longest";
   table->setHorizontalHeaderLabels(headerNames);
   table->verticalHeader()->setVisible(false);
   table->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
   table->verticalHeader()->setDefaultSectionSize(15);
-  table->horizontalHeader()->setSectionResizeMode(3, QHeaderView::Stretch);
+  table->horizontalHeader()->setSectionResizeMode(7, QHeaderView::Stretch);
   table->setEditTriggers(QAbstractItemView::NoEditTriggers);
   table->setAlternatingRowColors(true);
   table->setSortingEnabled(true);
@@ -149,6 +153,10 @@ void TimeWidget::update()
         currentRow->avg = new NumberTableWidgetItem();
         currentRow->max = new NumberTableWidgetItem();
         currentRow->min = new NumberTableWidgetItem();
+        currentRow->median = new NumberTableWidgetItem();
+        currentRow->p95 = new NumberTableWidgetItem();
+        currentRow->p99 = new NumberTableWidgetItem();
+        currentRow->longest = new NumberTableWidgetItem();
         currentRow->name = new QTableWidgetItem();
         const int rowCount = table->rowCount();
         table->setRowCount(rowCount + 1);
@@ -156,6 +164,10 @@ void TimeWidget::update()
         table->setItem(rowCount, 1, currentRow->min);
         table->setItem(rowCount, 2, currentRow->max);
         table->setItem(rowCount, 3, currentRow->avg);
+        table->setItem(rowCount, 4, currentRow->median);
+        table->setItem(rowCount, 5, currentRow->p95);
+        table->setItem(rowCount, 6, currentRow->p99);
+        table->setItem(rowCount, 7, currentRow->longest);
         items[id] = currentRow;
       }
       float minTime = -1, maxTime = -1, avgTime = -1;
@@ -166,6 +178,12 @@ void TimeWidget::update()
       currentRow->avg->setText(QString::number(avgTime));
       currentRow->min->setText(QString::number(minTime));
       currentRow->max->setText(QString::number(maxTime));
+      float median = 0, p95 = 0, p99 = 0, longest = 0;
+      timeView.info.getDistribution(info, median, p95, p99, longest);
+      currentRow->median->setText(QString::number(median));
+      currentRow->p95->setText(QString::number(p95));
+      currentRow->p99->setText(QString::number(p99));
+      currentRow->longest->setText(QString::number(longest));
       currentRow->name->setText(QString(name.c_str())); //refresh name every time to eliminate unknown
     }
   }
@@ -435,6 +435,25 @@ bool DebugDrawing::addShapeFromQueue(In& stream, Drawings::ShapeType shapeType)
       delete[] points;
       break;
     }
+    case Drawings::binaryPolygon:
+    {
+      int numberOfPoints;
+      stream >> numberOfPoints;
+      std::vector<Vector2i> points(numberOfPoints);
+      for(Vector2i& point : points)
+        stream >> point.x() >> point.y();
+      char penWidth, penStyle, brushStyle;
+      ColorRGBA brushColor, penColor;
+      stream >> penWidth;
+      stream >> penStyle;
+      stream >> penColor;
+      stream >> brushStyle;
+      stream >> brushColor;
+      this->polygon(points.data(), numberOfPoints, penWidth,
+                    static_cast<Drawings::PenStyle>(penStyle), penColor,
+                    static_cast<Drawings::BrushStyle>(brushStyle), brushColor);
+      break;
+    }
     case Drawings::line:
     {
       float x1, y1, x2, y2, penWidth;
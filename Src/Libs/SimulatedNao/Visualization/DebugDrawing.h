@@ -324,6 +324,12 @@ public:
    */
   const Element* getNext(const Element* element) const;
 
+  /**
+   * The function returns the size of all elements of this drawing.
+   * @return The size in bytes. The elements start at \c getFirst().
+   */
+  int getSize() const {return usedSize;}
+
 private:
   int usedSize; /**< The size of the element buffer actually used. */
   int reservedSize; /**< The reserved size of the element buffer. */
@@ -550,49 +550,70 @@ void PaintMethods3DOpenGL::draw(const DebugDrawing3D& drawing)
     f->glUseProgram(data->ldqProgram);
     f->glUniformMatrix4fv(data->ldqPVMLocation, 1, GL_FALSE, transformation.data());
 
-    // Draw all lines.
+    // Draw all lines. Consecutive lines with the same alpha are drawn together.
     if(!drawing.lines.empty() && draw)
     {
-      for(const DebugDrawing3D::Line& l : drawing.lines)
+      for(auto l = drawing.lines.begin(); l != drawing.lines.end();)
       {
+        auto end = l + 1;
+        while(end != drawing.lines.end() && end->color.a == l->color.a)
+          ++end;
         // TODO: My OpenGL driver doesn't support wide lines with OpenGL 3.3.
         // f->glLineWidth(l.width);
-        Alpha alpha(*f, l.color.a);
-        f->glDrawArrays(GL_LINES, ldqFirst, 2);
-        ldqFirst += 2;
+        Alpha alpha(*f, l->color.a);
+        const GLsizei count = 2 * static_cast<GLsizei>(end - l);
+        f->glDrawArrays(GL_LINES, ldqFirst, count);
+        ldqFirst += count;
+        l = end;
       }
     }
     else
-      ldqFirst += 2 * static_cast<GLint>(2 * drawing.lines.size());
+      ldqFirst += 2 * static_cast<GLint>(drawing.lines.size());
 
-    // Draw all dots.
+    // Draw all dots. Consecutive dots with the same size and alpha are drawn together.
     if(!drawing.dots.empty() && draw)
     {
       GLfloat oldPointSize = 1.f;
       f->glGetFloatv(GL_POINT_SIZE, &oldPointSize);
-      for(const DebugDrawing3D::Dot& d : drawing.dots)
+      for(auto d = drawing.dots.begin(); d != drawing.dots.end();)
       {
-        f->glPointSize(d.size);
-        Alpha alpha(*f, d.color.a);
-        f->glDrawArrays(GL_POINTS, ldqFirst, 1);
-        ++ldqFirst;
+        auto end = d + 1;
+        while(end != drawing.dots.end() && end->size == d->size && end->color.a == d->color.a)
+          ++end;
+        f->glPointSize(d->size);
+        Alpha alpha(*f, d->color.a);
+        const GLsizei count = static_cast<GLsizei>(end - d);
+        f->glDrawArrays(GL_POINTS, ldqFirst, count);
+        ldqFirst += count;
+        d = end;
       }
       f->glPointSize(oldPointSize);
     }
     else
-      ldqFirst += 2 * static_cast<GLint>(drawing.dots.size());
+      ldqFirst += static_cast<GLint>(drawing.dots.size());
 
-    // Draw all quads.
+    // Draw all quads. Consecutive quads with the same alpha are drawn with a single call.
     if(draw)
-      for(const DebugDrawing3D::Quad& q : drawing.quads)
+      for(auto q = drawing.quads.begin(); q != drawing.quads.end();)
       {
-        Alpha alpha(*f, q.color.a);
-        f->glDrawArrays(GL_TRIANGLE_STRIP, ldqFirst, 4);
-        ldqFirst += 4;
+        auto end = q + 1;
+        while(end != drawing.quads.end() && end->color.a == q->color.a)
+          ++end;
+        const GLsizei count = static_cast<GLsizei>(end - q);
+        quadFirsts.resize(count);
+        quadCounts.resize(count, 4);
+        for(GLint& first : quadFirsts)
+        {
+          first = ldqFirst;
+          ldqFirst += 4;
+        }
+        Alpha alpha(*f, q->color.a);
+        f->glMultiDrawArrays(GL_TRIANGLE_STRIP, quadFirsts.data(), quadCounts.data(), count);
+        q = end;
       }
     else
       ldqFirst += 4 * static_cast<GLint>(drawing.quads.size());
-}
+  }
 
   if(!drawing.spheres.empty() || !drawing.ellipsoids.empty() || !drawing.cylinders.empty())
   {
@@ -152,6 +152,8 @@ private:
   GLint secBaseVertex = 0; /**< Base vertex for the next draw call of cylinders (the unit sphere is always at 0). */
   GLsizeiptr secIndexOffset = 0; /**< Index offset for the next draw call of cylinders (the units sphere is always at 0). */
   bool includeSphere = false; /**< Whether the sphere must be part of the vertex buffer. */
+  std::vector<GLint> quadFirsts; /**< The first vertices of quads drawn with a single call. */
+  std::vector<GLsizei> quadCounts; /**< The numbers of vertices of quads drawn with a single call (always 4). */
   std::vector<GLuint> textures; /**< The textures (in order) for 3D images. */
   unsigned int textureIndex = 0; /**< The texture index for the next image draw call. */
 };
@@ -9,6 +9,12 @@
  * The macro also ensures that the blackboard is able to identify representations that
  * contains functions. Thereby, it can reset these representations when their provider
  * changes.
+ * Instead of assigning a lambda, a provider can also bind one of its methods, e.g.
+ * representation.fn.bind<&Provider::fn>(this). Calling a bound method only costs a
+ * call through a plain function pointer, which directly calls the method. Functions
+ * that are called very often per frame should also be offered in a variant that
+ * processes a whole batch of arguments, i.e. it gets a vector of arguments and fills
+ * a vector of results.
  *
  * @author Thomas Röfer
  */
@@ -16,6 +22,7 @@
 #pragma once
 
 #include <functional>
+#include <type_traits>
 #include <utility>
 
 namespace FunctionImpl
@@ -25,6 +32,11 @@ namespace FunctionImpl
   template<typename R, typename... A> class Function<R(A...)> : public std::function<R(A...)>
   {
   private:
+    using Base = std::function<R(A...)>;
+
+    void* object = nullptr; /**< The object a bound method is called for. */
+    R (*call)(void*, A...) = nullptr; /**< Calls the bound method for the object. nullptr if no method is bound. */
+
     /**
      * Returns the result of Zero() if a class has such a method, otherwise a default
      * object of the class is returned.
@@ -36,10 +48,44 @@ namespace FunctionImpl
   public:
     using std::function<R(A...)>::function;
 
+    /**
+     * Assigns a callable object. This replaces a bound method.
+     * @param f The callable object.
+     * @return This object.
+     */
+    template<typename F> requires(!std::is_same_v<std::decay_t<F>, Function>)
+    Function& operator=(F&& f)
+    {
+      Base::operator=(std::forward<F>(f));
+      call = nullptr;
+      return *this;
+    }
+
+    /**
+     * Binds a method of an object. This replaces a callable object assigned before.
+     * @tparam method The method, e.g. &Provider::fn. Its parameters must match the
+     *                ones of this function.
+     * @param object The object the method is called for. It must outlive the binding.
+     */
+    template<auto method, typename C> void bind(C* object)
+    {
+      Base::operator=(nullptr);
+      this->object = object;
+      call = [](void* object, A... args) -> R {return (static_cast<C*>(object)->*method)(std::forward<A>(args)...);};
+    }
+
+    /**
+     * Is a function assigned or a method bound?
+     * @return Whether calling this object does something.
+     */
+    explicit operator bool() const {return call || static_cast<const Base&>(*this);}
+
     R operator()(A... args) const
     {
-      if(*this)
-        return std::function<R(A...)>::operator()(std::forward<A>(args)...);
+      if(call)
+        return call(object, std::forward<A>(args)...);
+      else if(static_cast<const Base&>(*this))
+        return Base::operator()(std::forward<A>(args)...);
       else
         return zero(static_cast<R*>(nullptr), static_cast<R*>(nullptr));
     }
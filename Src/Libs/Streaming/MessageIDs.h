@@ -40,6 +40,7 @@ ENUM(MessageID,
   idArmMotionRequest,
   idAudioData,
   idBallModel,
+  idBallPatches,
   idBallPercept,
   idBallSpots,
   idBehaviorStatus,
@@ -73,6 +74,7 @@ ENUM(MessageID,
   idInertialData,
   idInertialSensorData,
   idInitialToReady,
+  idIntersectionPatches,
   idJointAnglePred,
   idJointAngles,
   idJointLimits,
@@ -95,6 +97,7 @@ ENUM(MessageID,
   idRefereePercept,
   idRobotDimensions,
   idRobotHealth,
+  idRobotPatches,
   idRobotPose,
   idRobotStableState,
   idSelfLocalizationHypotheses,
@@ -126,6 +129,7 @@ ENUM(MessageID,
   idDrawingManager3D,
   idLogResponse,
   idModuleRequest,
+  idModuleSnapshot,
   idModuleTable,
   idPlot,
   idRobotName,
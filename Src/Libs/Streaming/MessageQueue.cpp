@@ -14,15 +14,24 @@ void MessageQueue::OutQueue::open(MessageID id, MessageQueue& queue)
   if(queue.ensureCapacity(queue.used + sizeof(MessageHeader), maxCapacity))
   {
     this->queue = &queue;
-    originalSize = queue.used;
-    const MessageHeader header = {{{id, 0}}};
-    *reinterpret_cast<MessageHeader*>(queue.buffer + originalSize) = header;
+    header = originalSize = queue.lastMessage = queue.used;
+    const MessageHeader messageHeader = {{{id, 0}}};
+    *reinterpret_cast<MessageHeader*>(queue.buffer + originalSize) = messageHeader;
     queue.used += sizeof(MessageHeader);
   }
   else
     this->queue = nullptr;
 }
 
+void MessageQueue::OutQueue::reopen(MessageQueue& queue)
+{
+  ASSERT(queue.lastMessage != noMessage);
+  this->queue = &queue;
+  header = queue.lastMessage;
+  originalSize = queue.used;
+  maxCapacity = queue.calcMaxCapacity(reinterpret_cast<const MessageHeader*>(queue.buffer + header)->id);
+}
+
 void MessageQueue::OutQueue::writeToStream(const void* p, size_t size)
 {
   if(queue)
@@ -31,10 +40,15 @@ void MessageQueue::OutQueue::writeToStream(const void* p, size_t size)
     {
       std::memcpy(queue->buffer + queue->used, p, size);
       queue->used += size;
-      reinterpret_cast<MessageHeader*>(queue->buffer + originalSize)->size += static_cast<unsigned>(size);
+      reinterpret_cast<MessageHeader*>(queue->buffer + header)->size += static_cast<unsigned>(size);
     }
     else
     {
+      // Only revert what this stream has written. A message that was continued keeps its previous content.
+      if(originalSize > header)
+        reinterpret_cast<MessageHeader*>(queue->buffer + header)->size = static_cast<unsigned>(originalSize - header - sizeof(MessageHeader));
+      else
+        queue->lastMessage = noMessage;
       queue->used = originalSize;
       queue = nullptr;
     }
@@ -78,25 +92,6 @@ bool MessageQueue::ensureCapacity(size_t capacity, size_t maxCapacity)
   return false;
 }
 
-void MessageQueue::copyMessages(size_t size, const std::function<void(void*, size_t)>& copy)
-{
-  MessageHeader header;
-  while(size > 0)
-  {
-    copy(&header, sizeof(header));
-    if(ensureCapacity(used + sizeof(MessageHeader) + header.size, calcMaxCapacity(header.id)))
-    {
-      *reinterpret_cast<MessageHeader*>(buffer + used) = header;
-      used += sizeof(MessageHeader);
-      copy(buffer + used, header.size);
-      used += header.size;
-    }
-    else
-      copy(nullptr, header.size);
-    size -= sizeof(MessageHeader) + header.size;
-  }
-}
-
 void MessageQueue::read(In& stream)
 {
   QueueHeader header;
@@ -150,6 +145,7 @@ MessageQueue& MessageQueue::operator=(const MessageQueue& other)
   ownBuffer = true;
   used = capacity = other.used;
   maxCapacity = other.maxCapacity;
+  lastMessage = noMessage;
   buffer = static_cast<char*>(malloc(capacity));
   std::memcpy(buffer, other.buffer, used);
   return *this;
@@ -158,6 +154,7 @@ MessageQueue& MessageQueue::operator=(const MessageQueue& other)
 MessageQueue& MessageQueue::operator<<(const std::pair<const_iterator, const_iterator>& range)
 {
   size_t srcSize = range.second - range.first;
+  lastMessage = noMessage;
   if(ensureCapacity(used + srcSize, maxCapacity - protectedCapacity))
   {
     std::memcpy(buffer + used, range.first.current, srcSize);
@@ -179,6 +176,7 @@ MessageQueue& MessageQueue::operator<<(const std::pair<const_iterator, const_ite
 void MessageQueue::clear()
 {
   used = 0;
+  lastMessage = noMessage;
   if(!ownBuffer && !capacity)
   {
     capacity = 16384;
@@ -191,6 +189,7 @@ void MessageQueue::resize(size_t size)
 {
   ASSERT(used >= size);
   used = size;
+  lastMessage = noMessage;
 }
 
 void MessageQueue::reserve(size_t capacity, size_t protectedCapacity)
@@ -223,6 +222,7 @@ void MessageQueue::setBuffer(char* buffer, size_t size, size_t capacity)
     free(this->buffer);
   this->buffer = buffer;
   used = size;
+  lastMessage = noMessage;
   this->capacity = capacity;
   if(capacity)
     maxCapacity = capacity;
@@ -50,6 +50,7 @@ class MessageQueue : public Streamable
   class OutQueue : public PhysicalOutStream
   {
     MessageQueue* queue = nullptr; /**< The message queue this stream is attached to. Is \c nullptr if writing is forbidden (e.g. because the queue is full). */
+    size_t header; /**< The position of the header of the message written. */
     size_t originalSize; /**< The size of the queue before the first write operation. Is used to be able to revert write operations in case the queue is full. */
     size_t maxCapacity; /**< The maximum capacity of the queue for the current message. It depends on the type of message that is written. */
 
@@ -61,6 +62,13 @@ class MessageQueue : public Streamable
      */
     void open(MessageID id, MessageQueue& queue);
 
+    /**
+     * Opens this stream for appending to the last message of the queue.
+     * @param queue The message queue that is written to. Its last message
+     *              must have been written through an \c OutQueue .
+     */
+    void reopen(MessageQueue& queue);
+
     /**
      * Writes data to the queue.
      * @param p The address of the data to be written.
@@ -82,6 +90,9 @@ class MessageQueue : public Streamable
   size_t protectedCapacity = 0; /**< A part of the maximum capacity that is reserved for certain message types (in bytes). */
   char* buffer = nullptr; /**< The memory block of size \c capacity containing the messages. */
   bool ownBuffer = true; /**< Is the memory block maintained by this class? */
+  size_t lastMessage = noMessage; /**< The position of the last message if it was written through an \c OutQueue . Otherwise \c noMessage . */
+
+  static constexpr size_t noMessage = static_cast<size_t>(-1); /**< Marks that \c lastMessage is unknown. */
 
   /**
    * Determines the maximum capacity applicable for a specific message type.
@@ -104,9 +115,27 @@ class MessageQueue : public Streamable
    * @param copy A function that actually copies a single message. The first parameter
    *             is the target address the message should be copied to. If it is
    *             \c nullptr , the message should be skipped. The second parameter
-   *             is the size of the message to be copied or skipped.
+   *             is the size of the message to be copied or skipped. It is a template
+   *             parameter, so the copy can be inlined.
    */
-  void copyMessages(size_t size, const std::function<void(void*, size_t)>& copy);
+  template<typename Copy> void copyMessages(size_t size, Copy&& copy)
+  {
+    MessageHeader header;
+    while(size > 0)
+    {
+      copy(&header, sizeof(header));
+      if(ensureCapacity(used + sizeof(MessageHeader) + header.size, calcMaxCapacity(header.id)))
+      {
+        *reinterpret_cast<MessageHeader*>(buffer + used) = header;
+        used += sizeof(MessageHeader);
+        copy(buffer + used, header.size);
+        used += header.size;
+      }
+      else
+        copy(nullptr, header.size);
+      size -= sizeof(MessageHeader) + header.size;
+    }
+  }
 
 protected:
   /**
@@ -175,6 +204,12 @@ public:
      */
     size_t size() const {return reinterpret_cast<const MessageHeader*>(buffer)->size;}
 
+    /**
+     * Returns the message's data, i.e. the bytes following its header.
+     * @return The address of the data. It contains \c size() bytes.
+     */
+    const char* data() const {return buffer + sizeof(MessageHeader);}
+
     /**
      * Returns a stream that allows reading the message in binary format.
      * @return The binary stream.
@@ -192,6 +227,13 @@ public:
   struct OutBinary : public OutStream<OutQueue, ::OutBinary>
   {
     OutBinary(MessageID id, MessageQueue& queue) {open(id, queue);}
+    OutBinary(MessageQueue& queue) {reopen(queue);}
+
+    /**
+     * The function returns whether this is a binary stream.
+     * @return Does it output data in binary format?
+     */
+    bool isBinary() const override {return true;}
   };
 
   /** Stream for adding a message in textual format. */
@@ -375,6 +417,28 @@ public:
    */
   OutBinary bin(MessageID id) {return OutBinary(id, *this);}
 
+  /**
+   * Returns a binary stream that appends to the last message in the queue if
+   * it has the same type and the same byte at a certain position. Otherwise,
+   * a new message is started. This allows to batch many small entries that
+   * are written one after another into a single message.
+   * @param id The type of the message.
+   * @param offset The position of the byte in the message that is compared.
+   * @param key The value this byte must have.
+   * @return A binary stream.
+   */
+  OutBinary bin(MessageID id, size_t offset, char key)
+  {
+    if(lastMessage != noMessage)
+    {
+      const MessageHeader& header = *reinterpret_cast<const MessageHeader*>(buffer + lastMessage);
+      if(header.id == id && header.size > offset && lastMessage + sizeof(MessageHeader) + header.size == used
+         && buffer[lastMessage + sizeof(MessageHeader) + offset] == key)
+        return OutBinary(*this);
+    }
+    return OutBinary(id, *this);
+  }
+
   /**
    * Returns a textual stream that allows to append a new message.
    * @param id The type of the new message.
@@ -753,6 +753,16 @@ public:
    */
   const char* data() const { return buffer; }
 
+  /**
+   * Returns the number of bytes currently reserved for the buffer.
+   */
+  size_t capacity() const { return reserved; }
+
+  /**
+   * Forgets all data written so far, but keeps the buffer.
+   */
+  void clear() { bytes = 0; }
+
   /**
    * Obtain ownership of the memory. The caller must free the memory.
    * This stream looses access to the memory.
@@ -772,12 +782,15 @@ protected:
    *               passed, it must be at least of the size of the
    *               given capacity. It will not grow. The caller must free it
    *               after the destruction of this stream.
+   * @param adopt If a buffer is passed, it was allocated with std::malloc and
+   *              this stream takes ownership of it, i.e. it behaves as if it
+   *              had allocated the buffer itself. It will grow if necessary.
    */
-  void open(size_t capacity, char* buffer)
+  void open(size_t capacity, char* buffer, bool adopt = false)
   {
     reserved = capacity;
-    dynamic = !buffer;
-    this->buffer = dynamic ? reinterpret_cast<char*>(std::malloc(capacity)) : buffer;
+    dynamic = !buffer || adopt;
+    this->buffer = buffer ? buffer : reinterpret_cast<char*>(std::malloc(capacity));
   }
 
   /**
@@ -788,6 +801,30 @@ protected:
   void writeToStream(const void* p, size_t size) override;
 };
 
+/**
+ * @class OutSize
+ *
+ * A PhysicalOutStream that only counts the bytes written.
+ */
+class OutSize : public PhysicalOutStream
+{
+private:
+  size_t bytes = 0; /**< The number of bytes written so far. */
+
+public:
+  /**
+   * Returns the number of written bytes.
+   */
+  size_t size() const { return bytes; }
+
+protected:
+  /**
+   * The function only counts the bytes.
+   * @param size The number of bytes to be written.
+   */
+  void writeToStream(const void*, size_t size) override { bytes += size; }
+};
+
 /**
  * Special memory stream that terminates the data in memory with a zero byte.
  */
@@ -887,10 +924,13 @@ public:
    *               passed, it must be at least of the size of the
    *               given capacity. It will not grow. The caller must free it
    *               after the destruction of this stream.
+   * @param adopt If a buffer is passed, it was allocated with std::malloc and
+   *              this stream takes ownership of it, i.e. it behaves as if it
+   *              had allocated the buffer itself. It will grow if necessary.
    */
-  OutBinaryMemory(size_t capacity = 1024, char* buffer = nullptr)
+  OutBinaryMemory(size_t capacity = 1024, char* buffer = nullptr, bool adopt = false)
   {
-    open(capacity, buffer);
+    open(capacity, buffer, adopt);
   }
 
   /**
@@ -900,6 +940,21 @@ public:
   bool isBinary() const override {return true;}
 };
 
+/**
+ * @class OutBinarySize
+ *
+ * A binary stream that only determines the size of the data written to it.
+ */
+class OutBinarySize : public OutStream<OutSize, OutBinary>
+{
+public:
+  /**
+   * The function returns whether this is a binary stream.
+   * @return Does it output data in binary format?
+   */
+  bool isBinary() const override {return true;}
+};
+
 /**
  * @class OutTextFile
  *
@@ -14,8 +14,10 @@
 #include "Streaming/InOut.h"
 #include "Streaming/TypeRegistry.h"
 #include <array>
+#include <bit>
 #include <list>
 #include <optional>
+#include <type_traits>
 #include <vector>
 
 /** Register the class that is specified as parameter. */
@@ -134,6 +136,19 @@ public:
 
 namespace Streaming
 {
+  static_assert(std::endian::native == std::endian::little,
+                "Binary streams copy memory representations, which requires a little-endian platform");
+
+  /**
+   * Determines whether binary streams store a type in its memory representation.
+   * Fields and arrays of such types are directly copied from and to binary streams,
+   * bypassing the field selection and the formatting. This is the case for basic
+   * types except bool, because reading it requires a conversion. Other types can
+   * specialize this template if their binary format equals their memory layout.
+   * @tparam S The type.
+   */
+  template<typename S> struct IsRawBinary : std::bool_constant<std::is_arithmetic_v<S> && !std::is_same_v<S, bool>> {};
+
   template<typename T>
   In& streamComplexStaticArray(In& in, T inArray[], size_t size, const char* enumType)
   {
@@ -203,9 +218,21 @@ namespace Streaming
   In& streamStaticArray(In& in, double inArray[], size_t size, const char* enumType);
   Out& streamStaticArray(Out& out, double outArray[], size_t size, const char* enumType) ;
   template<typename T>
-  In& streamStaticArray(In& in, T inArray[], size_t size, const char* enumType) {return streamComplexStaticArray(in, inArray, size, enumType);}
+  In& streamStaticArray(In& in, T inArray[], size_t size, const char* enumType)
+  {
+    if constexpr(IsRawBinary<T>::value)
+      return streamBasicStaticArray(in, inArray, size, enumType);
+    else
+      return streamComplexStaticArray(in, inArray, size, enumType);
+  }
   template<typename T>
-  Out& streamStaticArray(Out& out, T outArray[], size_t size, const char* enumType) {return streamComplexStaticArray(out, outArray, size, enumType);}
+  Out& streamStaticArray(Out& out, T outArray[], size_t size, const char* enumType)
+  {
+    if constexpr(IsRawBinary<T>::value)
+      return streamBasicStaticArray(out, outArray, size, enumType);
+    else
+      return streamComplexStaticArray(out, outArray, size, enumType);
+  }
 
   template<typename T, typename U> void cast(T& t, const U& u) {t = static_cast<T>(u);}
 
@@ -215,6 +242,12 @@ namespace Streaming
   {
     static void read(In& stream, const char* name, S& s)
     {
+      if constexpr(IsRawBinary<S>::value)
+        if(stream.isBinary())
+        {
+          stream.read(&s, sizeof(S));
+          return;
+        }
       const char* enumType = std::is_enum<S>::value ? typeid(S).name() : nullptr;
       stream.select(name, -2, enumType);
       stream >> s;
@@ -223,6 +256,12 @@ namespace Streaming
 
     static void write(Out& stream, const char* name, const S& s)
     {
+      if constexpr(IsRawBinary<S>::value)
+        if(stream.isBinary())
+        {
+          stream.write(&s, sizeof(S));
+          return;
+        }
       const char* enumType = std::is_enum<S>::value ? typeid(S).name() : nullptr;
       stream.select(name, -2, enumType);
       stream << s;
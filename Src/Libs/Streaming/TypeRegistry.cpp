@@ -127,7 +127,7 @@ const char* TypeRegistry::getEnumName(const char* enumeration, int value)
   }
   else // This entry was created by the DebugDataStreamer
   {
-    const std::vector<std::string>* constants = reinterpret_cast<const std::vector<std::string>* const*>(enumeration)[1];
+    const std::vector<std::string>* constants = reinterpret_cast<const DynamicEnum*>(enumeration)->byOrder;
     if(value >= 0 && value < static_cast<int>(constants->size()))
       return (*constants)[value].c_str();
   }
@@ -146,9 +146,17 @@ int TypeRegistry::getEnumValue(const char* enumeration, const std::string& name)
   }
   else // This entry was created by the DebugDataStreamer
   {
-    for(int i = 0; getEnumName(enumeration, i); ++i)
-      if(getEnumName(enumeration, i) == name)
-        return i;
+    const DynamicEnum& e = *reinterpret_cast<const DynamicEnum*>(enumeration);
+    if(e.byName)
+    {
+      auto c = e.byName->find(name);
+      if(c != e.byName->end())
+        return c->second;
+    }
+    else
+      for(int i = 0; i < static_cast<int>(e.byOrder->size()); ++i)
+        if((*e.byOrder)[i] == name)
+          return i;
   }
   return -1;
 }
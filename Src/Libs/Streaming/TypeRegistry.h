@@ -14,12 +14,27 @@
 
 #include <string>
 #include <typeinfo>
+#include <unordered_map>
+#include <vector>
 
 struct TypeInfo;
 
 class TypeRegistry
 {
 public:
+  /**
+   * An enumeration type that is not registered, but created at runtime, e.g. by the
+   * DebugDataSchema. A pointer to such an object can be passed as enumeration name to
+   * getEnumName and getEnumValue. Since it starts with a null pointer, the "name" is
+   * an empty string, which distinguishes it from real type names.
+   */
+  struct DynamicEnum
+  {
+    const char* marker = nullptr; /**< Must be nullptr. */
+    const std::vector<std::string>* byOrder = nullptr; /**< The constants in the sequence of their values. */
+    const std::unordered_map<std::string, int>* byName = nullptr; /**< The values indexed by the names of the constants. If nullptr, the constants are searched. */
+  };
+
   /**
    * Add the name of an enumeration to the registry.
    * Must only be called once for each enumeration type.
@@ -7,6 +7,7 @@
  */
 
 #include "ClearTargetProvider.h"
+#include "Tools/BehaviorControl/TaskPool.h"
 #include <map>
 
 MAKE_MODULE(ClearTargetProvider);
@@ -49,7 +50,7 @@ void ClearTargetProvider::update(ClearTarget& theClearTarget)
   };
 }
 
-bool ClearTargetProvider::isNotNearLine(const Vector2f targetPosition)
+void ClearTargetProvider::drawBorders()
 {
   COMPLEX_DRAWING("option:ClearBall:borders")
   {
@@ -58,6 +59,10 @@ bool ClearTargetProvider::isNotNearLine(const Vector2f targetPosition)
     LINE("option:ClearBall:borders", theFieldDimensions.xPosOwnGoalLine, theFieldDimensions.yPosLeftFieldBorder - minDistanceToYLine, theFieldDimensions.xPosOpponentGoalLine, theFieldDimensions.yPosLeftFieldBorder - minDistanceToYLine, 20, Drawings::PenStyle::solidPen, ColorRGBA::blue);
     LINE("option:ClearBall:borders", theFieldDimensions.xPosOwnGoalLine, theFieldDimensions.yPosRightFieldBorder + minDistanceToYLine, theFieldDimensions.xPosOpponentGoalLine, theFieldDimensions.yPosRightFieldBorder + minDistanceToYLine, 20, Drawings::PenStyle::solidPen, ColorRGBA::yellow);
   }
+}
+
+bool ClearTargetProvider::isNotNearLine(const Vector2f targetPosition) const
+{
   if(targetPosition.x() > theFieldDimensions.xPosOwnGoalLine + minDistanceToXLine
      && targetPosition.x() < theFieldDimensions.xPosOpponentGoalLine - minDistanceToXLine
      && targetPosition.y() < theFieldDimensions.yPosLeftFieldBorder - minDistanceToYLine
@@ -69,7 +74,15 @@ bool ClearTargetProvider::isNotNearLine(const Vector2f targetPosition)
 }
 
 float ClearTargetProvider::getAngleRating(const Angle candidateAngle, const Vector2f basePosition, const float targetDistance,
-                                          [[maybe_unused]] int number)
+                                          int number)
+{
+  drawBorders();
+  const float rating = calcAngleRating(candidateAngle, basePosition, targetDistance);
+  drawAngleRating(candidateAngle, basePosition, targetDistance, rating, number);
+  return rating;
+}
+
+float ClearTargetProvider::calcAngleRating(const Angle candidateAngle, const Vector2f basePosition, const float targetDistance) const
 {
   //calculate xG-value for target position
   const Vector2f targetPosition = basePosition + Vector2f::polar(targetDistance, candidateAngle);
@@ -88,8 +101,19 @@ float ClearTargetProvider::getAngleRating(const Angle candidateAngle, const Vect
     fieldFactor = 1.f;
   }
 
+  //return xG-value of the target position times field factor of the current position
+  return goalRating * fieldFactor;
+}
+
+void ClearTargetProvider::drawAngleRating([[maybe_unused]] const Angle candidateAngle, [[maybe_unused]] const Vector2f basePosition,
+                                          [[maybe_unused]] const float targetDistance, float rating, [[maybe_unused]] int number)
+{
+  if(rating < 0.f)
+    return;
+
   COMPLEX_DRAWING("option:ClearBall:evaluation")
   {
+    const Vector2f targetPosition = basePosition + Vector2f::polar(targetDistance, candidateAngle);
     std::string closer = "";
     if(isTeammateCloseToBall(candidateAngle, basePosition, targetDistance))
     {
@@ -97,13 +121,11 @@ float ClearTargetProvider::getAngleRating(const Angle candidateAngle, const Vect
     }
     const Vector2f& ballPositionOnField = theFieldInterceptBall.interceptedEndPositionOnField;
     LINE("option:ClearBall:evaluation", ballPositionOnField.x(), ballPositionOnField.y(), targetPosition.x(), targetPosition.y(), 20, Drawings::PenStyle::solidPen, ColorRGBA::violet);
-    DRAW_TEXT("option:ClearBall:evaluation", targetPosition.x(), targetPosition.y() - 250, 200, ColorRGBA::violet, number << ": " << goalRating * fieldFactor << closer);
+    DRAW_TEXT("option:ClearBall:evaluation", targetPosition.x(), targetPosition.y() - 250, 200, ColorRGBA::violet, number << ": " << rating << closer);
   }
-  //return xG-value of the target position times field factor of the current position
-  return goalRating * fieldFactor;
 }
 
-bool ClearTargetProvider::isTeammateCloseToBall(const Angle candidateAngle, const Vector2f basePosition, const float targetDistance)
+bool ClearTargetProvider::isTeammateCloseToBall(const Angle candidateAngle, const Vector2f basePosition, const float targetDistance) const
 {
   const Vector2f targetPosition = basePosition + Vector2f::polar(targetDistance, candidateAngle);
   float teammateDistance = std::numeric_limits<float>::max();
@@ -249,6 +271,22 @@ void ClearTargetProvider::calcBestKick()
     sectors.push_back(item);
   sectors.remove_if([](SectorWheel::Sector item) { return item.angleRange.getSize() >= 30_deg; });
 
+  // Rate all kicks into all free sectors first. This is independent for each
+  // candidate and is therefore distributed across the shared task pool.
+  candidates.clear();
+  for(const SectorWheel::Sector& sector : sectors)
+    if(sector.type == SectorWheel::Sector::free && sector.angleRange.getSize() > smallSector)
+      for(KickInfo::KickType kickType : kickTypes)
+        candidates.push_back({sector.angleRange.getCenter(), theKickInfo[kickType].range.max, 0.f, false});
+  TaskPool::execute(candidates.size(), [this](std::size_t index)
+  {
+    Candidate& candidate = candidates[index];
+    candidate.rating = calcAngleRating(candidate.angle, theFieldBall.positionOnField, candidate.distance);
+    candidate.teammateIsCloser = isTeammateCloseToBall(candidate.angle, theFieldBall.positionOnField, candidate.distance);
+  }, rateInParallel);
+  drawBorders();
+  auto candidate = candidates.begin();
+
   float bestXG = 0.f;//best xG of all sectors and kicktypes
   float leftTeammateBonus = 0.0f; //when the current sector is obstacle or teammate we add or sub a bonus to the next sector if it is a free one
   bool applyRightTeamMateBonus = false;//when the current sector is free, we let the next sector know, that it has to add or sub a bonus to the current sector if next sector is obstacle/teammate
@@ -280,8 +318,9 @@ void ClearTargetProvider::calcBestKick()
         //check best kick for the current sector
         for(KickInfo::KickType kickType : kickTypes)
         {
-          const Angle center = sector.angleRange.getCenter();
-          goalRating = getAngleRating(center, theFieldBall.positionOnField, theKickInfo[kickType].range.max, i);
+          const Candidate& rated = *candidate++;
+          goalRating = rated.rating;
+          drawAngleRating(rated.angle, theFieldBall.positionOnField, rated.distance, goalRating, i);
           if(goalRating < 0.f)
           {
             continue;
@@ -299,7 +338,7 @@ void ClearTargetProvider::calcBestKick()
             bestXGOfSector = goalRating;
           }
           //check if clearTarget is useful
-          close = isTeammateCloseToBall(sector.angleRange.getCenter(), theFieldBall.positionOnField, theKickInfo[kickType].range.max);
+          close = rated.teammateIsCloser;
           if(goalRating > bestXG && close)
           {
             bestXG = goalRating;
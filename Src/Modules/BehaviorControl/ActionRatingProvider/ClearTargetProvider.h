@@ -55,6 +55,7 @@ MODULE(ClearTargetProvider,
     (std::vector<KickInfo::KickType>)({KickInfo::forwardFastRightLong, KickInfo::forwardFastLeftLong, KickInfo::forwardFastLeftPass, KickInfo::forwardFastRightPass}) extraKicksSetPieces,  /**< The kicks that may be add during setPieces.*/
     (KickInfo::KickType)(KickInfo::numOfKickTypes) lastKickType, /**< TODO (Also, why is this a parameter?) */
     (SectorWheel::Sector)({}) lastSector, /**< The sector that has been selected in the previous frame. */
+    (bool)(true) rateInParallel, /**< Rate the candidate targets using the shared task pool? */
   }),
 });
 
@@ -75,18 +76,40 @@ private:
    */
   float getAngleRating(const Angle candidateAngle, const Vector2f basePosition, const float targetDistance, int number = 0);
 
+  /**
+   * Rates a target like getAngleRating, but without drawing anything.
+   * It can therefore be called from the threads of the task pool.
+   */
+  float calcAngleRating(const Angle candidateAngle, const Vector2f basePosition, const float targetDistance) const;
+
+  /** Draws the rating of a target computed by calcAngleRating. */
+  void drawAngleRating(const Angle candidateAngle, const Vector2f basePosition, const float targetDistance, float rating, int number);
+
+  /** Draws the lines near which no targets are selected. */
+  void drawBorders();
+
   /**
    * TODO
    */
-  bool isNotNearLine(const Vector2f targetPosition);
+  bool isNotNearLine(const Vector2f targetPosition) const;
 
   /**
    * TODO
    */
-  bool isTeammateCloseToBall(const Angle candidateAngle, const Vector2f basePosition, const float targetDistance);
+  bool isTeammateCloseToBall(const Angle candidateAngle, const Vector2f basePosition, const float targetDistance) const;
+
+  /** A target to rate, i.e. a kick into the center of a free sector. */
+  struct Candidate
+  {
+    Angle angle; /**< The direction of the kick. */
+    float distance; /**< The range of the kick. */
+    float rating; /**< The rating computed by calcAngleRating. */
+    bool teammateIsCloser; /**< The result of isTeammateCloseToBall. */
+  };
 
   KickInfo::KickType bestKick = KickInfo::numOfKickTypes; /**< The kick with which the ball should be cleared */
   SectorWheel::Sector bestSector; /**< The sector the ball should be cleared into */
   Pose2f bestKickPoseRelative; /**< The best pose of the bestKick */
   unsigned timeWhenBestKickWasUpdated = 0; /**< The last time when bestKick was computed. */
+  std::vector<Candidate> candidates; /**< The targets rated in calcBestKick. A member to avoid reallocations. */
 };
@@ -35,6 +35,9 @@ void BallSearchAreasProvider::initializeGrid()
   }
   ASSERT(!grid.empty());
   colorVector.reserve(cellCountX * cellCountY);
+  probabilities.assign(grid.size(), 1.f / static_cast<float>(grid.size()));
+  diffused.resize(grid.size());
+  lastProbabilityUpdate = 0;
 }
 
 void BallSearchAreasProvider::update(BallSearchAreas& theBallSearchAreas)
@@ -49,6 +52,8 @@ void BallSearchAreasProvider::update(BallSearchAreas& theBallSearchAreas)
   reset();
   STOPWATCH("module:BallSearchAreasProvider:updateCells")
     updateCells();
+  STOPWATCH("module:BallSearchAreasProvider:updateProbabilities")
+    updateProbabilities();
   STOPWATCH("module:BallSearchAreasProvider:draw")
     draw();
   theBallSearchAreas.cellToSearchNext = [this](const Agent& agent) { return positionCellToSearchNext(getVoronoiGrid(agent)); };
@@ -148,6 +153,13 @@ const Vector2f BallSearchAreasProvider::positionCellToSearchNext(const std::vect
 
   for(const auto& cell : gridToSearch)
   {
+    if(searchByProbability)
+    {
+      if(cell.probability * static_cast<float>(cell.priority) > nextSearchCell.probability * static_cast<float>(nextSearchCell.priority))
+        nextSearchCell = cell;
+      continue;
+    }
+
     // Saves the cell with the highest search score, which is calculatet by: If the difference between the timestamp of the cell and the timestamp of the cameraframe multiplied by the priority (evaluation of how long a cell has not been seen multiplied by the importance of the cell in the current gamestate) is higher than the stored value, replace the stored cell.
     if(((theFrameInfo.time - cell.timestamp) + 1) * cell.priority > ((theFrameInfo.time - nextSearchCell.timestamp) + 1) * nextSearchCell.priority)
     {
@@ -242,3 +254,58 @@ void BallSearchAreasProvider::updateCells()
     }
   }
 }
+
+void BallSearchAreasProvider::updateProbabilities()
+{
+  const float deltaTime = lastProbabilityUpdate ? std::min(static_cast<float>(theFrameInfo.getTimeSince(lastProbabilityUpdate)) / 1000.f, 1.f) : 0.f;
+  lastProbabilityUpdate = theFrameInfo.time;
+
+  if(theFrameInfo.getTimeSince(theBallModel.timeWhenLastSeen) < ballSeenTimeout)
+  {
+    // The ball is known, so all probability is concentrated in its cell.
+    const Vector2f ballOnField = theRobotPose * theBallModel.estimate.position;
+    const int x = clip(static_cast<int>(std::round((ballOnField.x() - theFieldDimensions.xPosOwnGoalLine) / static_cast<float>(cellWidth))), 0, static_cast<int>(cellCountX) - 1);
+    const int y = clip(static_cast<int>(std::round((ballOnField.y() - theFieldDimensions.yPosRightTouchline) / static_cast<float>(cellHeight))), 0, static_cast<int>(cellCountY) - 1);
+    std::fill(probabilities.begin(), probabilities.end(), 0.f);
+    probabilities[y * cellCountX + x] = 1.f;
+  }
+  else
+  {
+    // Diffusion with a five-point stencil. Cells at the border are their own missing neighbors, which preserves the sum.
+    const float k = std::min(diffusionRate * deltaTime, 0.25f);
+    for(unsigned y = 0; y < cellCountY; ++y)
+    {
+      const float* row = &probabilities[y * cellCountX];
+      const float* above = y > 0 ? row - cellCountX : row;
+      const float* below = y < cellCountY - 1 ? row + cellCountX : row;
+      float* out = &diffused[y * cellCountX];
+      out[0] = row[0] + k * (above[0] + below[0] + row[1] - 3.f * row[0]);
+      for(unsigned x = 1; x < cellCountX - 1; ++x)
+        out[x] = row[x] + k * (above[x] + below[x] + row[x - 1] + row[x + 1] - 4.f * row[x]);
+      const unsigned last = cellCountX - 1;
+      out[last] = row[last] + k * (above[last] + below[last] + row[last - 1] - 3.f * row[last]);
+    }
+
+    // Decay towards an even distribution and clear the cells that were seen in this frame.
+    const float decay = std::min(decayRate * deltaTime, 1.f);
+    const float evenShare = decay / static_cast<float>(probabilities.size());
+    const float notDetected = 1.f - detectionProbability;
+    for(std::size_t i = 0; i < probabilities.size(); ++i)
+      probabilities[i] = ((1.f - decay) * diffused[i] + evenShare) * (grid[i].timestamp == theFrameInfo.time ? notDetected : 1.f);
+  }
+
+  float sum = 0.f;
+  for(const float probability : probabilities)
+    sum += probability;
+  if(sum > 0.f)
+  {
+    const float normalizer = 1.f / sum;
+    for(float& probability : probabilities)
+      probability *= normalizer;
+  }
+  else
+    std::fill(probabilities.begin(), probabilities.end(), 1.f / static_cast<float>(probabilities.size()));
+
+  for(std::size_t i = 0; i < probabilities.size(); ++i)
+    grid[i].probability = probabilities[i];
+}
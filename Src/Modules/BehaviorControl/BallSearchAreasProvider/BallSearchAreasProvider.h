@@ -11,6 +11,7 @@
 #include "Framework/Module.h"
 #include "Math/Geometry.h"
 #include "Representations/Modeling/BallDropInModel.h"
+#include "Representations/Modeling/BallModel.h"
 #include "Representations/Modeling/ObstacleModel.h"
 #include "Representations/Modeling/RobotPose.h"
 #include "Representations/Perception/ImagePreprocessing/CameraMatrix.h"
@@ -25,6 +26,7 @@
 MODULE(BallSearchAreasProvider,
 {,
   REQUIRES(BallDropInModel),
+  REQUIRES(BallModel),
   REQUIRES(FieldDimensions),
   REQUIRES(FrameInfo),
   REQUIRES(GameState),
@@ -41,6 +43,11 @@ MODULE(BallSearchAreasProvider,
     (unsigned)(200) obstacleOffset, /**< offset to be added to the obstacle width in the sector wheel*/
     (unsigned char)(90) heatmapAlpha, /**< Transparency of the heatmap between 0 (invisible) and 255 (opaque) */
     (float)(6000.f) heatmapMaxTime, /**< The max time for the liniear interpolation of the heatmap. */
+    (bool)(false) searchByProbability, /**< Search the cell with the highest ball probability instead of the one not seen for the longest time. */
+    (float)(0.5f) diffusionRate, /**< The share of the probability per second that spreads to each neighboring cell (at most 0.25 per frame). */
+    (float)(0.02f) decayRate, /**< The share of the probability per second that is redistributed evenly over the field. */
+    (float)(0.8f) detectionProbability, /**< The probability to see the ball in a cell that is in view. */
+    (int)(100) ballSeenTimeout, /**< The ball model is used to reset the probabilities if the ball was seen within this time. */
   }),
 });
 
@@ -53,6 +60,9 @@ private:
   unsigned cellCountX; /**< the number of the cells on field in x direction*/
   unsigned cellCountY; /**< the number of the cells on field in y direction*/
   std::vector<BallSearchAreas::Cell> grid; /**< the grid for the complete field*/
+  std::vector<float> probabilities; /**< the probabilities that the ball is in the cells of the grid, in the same order */
+  std::vector<float> diffused; /**< buffer for the diffusion step of the probabilities */
+  unsigned lastProbabilityUpdate = 0; /**< the time when the probabilities were updated the last time */
 
   const Geometry::Rect rectLeftOpponentCorner = Geometry::Rect(Vector2f(theFieldDimensions.xPosOpponentGoalArea, theFieldDimensions.yPosLeftGoalArea), Vector2f(theFieldDimensions.xPosOpponentFieldBorder, theFieldDimensions.yPosLeftTouchline)); /**< the rectangle for the left opponent corner*/
   const Geometry::Rect rectRightOpponentCorner = Geometry::Rect(Vector2f(theFieldDimensions.xPosOpponentFieldBorder, theFieldDimensions.yPosRightTouchline), Vector2f(theFieldDimensions.xPosOpponentGoalArea, theFieldDimensions.yPosRightGoalArea)); /**< the rectangle for the right opponent corner*/
@@ -130,4 +140,12 @@ private:
    * If the type is obstacle, the section between the robot and the obstacle will be updated.
    */
   void updateCells();
+
+  /**
+   * This method updates the probabilities of the cells incrementally. If the ball is seen, the
+   * probability is concentrated in its cell. Otherwise, it diffuses to the neighboring cells and
+   * decays towards an even distribution. Cells that were seen in this frame are cleared by the
+   * detection probability. Must be called after updateCells().
+   */
+  void updateProbabilities();
 };
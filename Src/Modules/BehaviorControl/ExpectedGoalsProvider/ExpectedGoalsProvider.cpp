@@ -21,25 +21,18 @@ ExpectedGoalsProvider::ExpectedGoalsProvider()
 
 void ExpectedGoalsProvider::update(ExpectedGoals& theExpectedGoals)
 {
-  theExpectedGoals.xG = [this](const Vector2f& pointOnField) -> float
-  {
-    return xG(pointOnField);
-  };
-
-  theExpectedGoals.xGA = [this](const Vector2f& pointOnField) -> float
-  {
-    return xGA(pointOnField);
-  };
-
-  theExpectedGoals.getRating = [this](const Vector2f& pointOnField, const bool isPositioning) -> float
-  {
-    return getRating(pointOnField, isPositioning);
-  };
+  // Everything about the opponents that does not depend on the point queried is only computed once per frame.
+  opponents.clear();
+  for(const auto& obstacle : theGlobalOpponentsModel.opponents)
+    // Skip opponents inside of their goal (behind the goal line)
+    if(obstacle.position.x() <= (theFieldDimensions.xPosOpponentGoalLine + theFieldDimensions.xPosOpponentGoal) * 0.5f)
+      opponents.push_back({obstacle.position, (obstacle.left - obstacle.right).norm() + 4.f * theBallSpecification.radius});
 
-  theExpectedGoals.getOpponentRating = [this](const Vector2f& pointOnField) -> float
-  {
-    return getOpponentRating(pointOnField);
-  };
+  theExpectedGoals.xG.bind<&ExpectedGoalsProvider::xG>(this);
+  theExpectedGoals.xGA.bind<&ExpectedGoalsProvider::xGA>(this);
+  theExpectedGoals.getRating.bind<&ExpectedGoalsProvider::getRating>(this);
+  theExpectedGoals.getRatings.bind<&ExpectedGoalsProvider::getRatings>(this);
+  theExpectedGoals.getOpponentRating.bind<&ExpectedGoalsProvider::getOpponentRating>(this);
 
   DECLARE_DEBUG_DRAWING("module:ExpectedGoalsProvider:heatmap", "drawingOnField");
   MODIFY_ONCE("module:ExpectedGoalsProvider:calcOpeningAngle", calcOpeningAngle);
@@ -61,15 +54,15 @@ float ExpectedGoalsProvider::xG(const Vector2f& pointOnField) const
   const float minBallGoalPostOffset = theFieldDimensions.goalPostRadius + theBallSpecification.radius;
   const Angle leftAngleOffset = std::asin(std::min(1.f, minBallGoalPostOffset / (leftGoalPost - pointOnField).norm()));
   const Angle rightAngleOffset = std::asin(std::min(1.f, minBallGoalPostOffset / (rightGoalPost - pointOnField).norm()));
-  const Angle angleToLeftPost = (leftGoalPost - pointOnField).angle() - leftAngleOffset;
-  const Angle angleToRightPost = (rightGoalPost - pointOnField).angle() + rightAngleOffset;
+  const Angle angleToLeftPost = angle(leftGoalPost - pointOnField) - leftAngleOffset;
+  const Angle angleToRightPost = angle(rightGoalPost - pointOnField) + rightAngleOffset;
   features[1] = angleToLeftPost - angleToRightPost;
 
   std::array<float, 2> hidden{};
   hidden[0] = std::tanh(-0.0182828f + 0.0995936f * features[0] + -2.10128f * features[1]);
   hidden[1] = std::tanh(-0.137664f + 0.903687f * features[0] + -2.10898f * features[1]);
 
-  return 1.f / (1.f + std::exp(-(0.153333f + hidden[0] * -2.7232f + hidden[1] * -1.07426f)));
+  return 1.f / (1.f + exp(-(0.153333f + hidden[0] * -2.7232f + hidden[1] * -1.07426f)));
 }
 
 float ExpectedGoalsProvider::xGA(const Vector2f& pointOnField) const
@@ -87,6 +80,13 @@ float ExpectedGoalsProvider::getRating(const Vector2f& pointOnField, const bool
   return std::max(minValue, openingAngleCriterion * shotDistanceCriterion);
 }
 
+void ExpectedGoalsProvider::getRatings(const std::vector<Vector2f>& pointsOnField, const bool isPositioning, std::vector<float>& ratings) const
+{
+  ratings.resize(pointsOnField.size());
+  for(std::size_t i = 0; i < pointsOnField.size(); ++i)
+    ratings[i] = getRating(pointsOnField[i], isPositioning);
+}
+
 float ExpectedGoalsProvider::getOpponentRating(const Vector2f& pointOnField) const
 {
   // Estimated probability that the goal shot would not be successful based on the opening angle on the own goal
@@ -98,8 +98,8 @@ Angle ExpectedGoalsProvider::getOpeningAngle(const Vector2f& pointOnField, const
   const float minBallGoalPostOffset = theFieldDimensions.goalPostRadius + theBallSpecification.radius;
   const Angle leftAngleOffset = std::asin(std::min(1.f, minBallGoalPostOffset / (leftGoalPost - pointOnField).norm()));
   const Angle rightAngleOffset = std::asin(std::min(1.f, minBallGoalPostOffset / (rightGoalPost - pointOnField).norm()));
-  const Angle angleToLeftPost = (leftGoalPost - pointOnField).angle() - leftAngleOffset;
-  const Angle angleToRightPost = (rightGoalPost - pointOnField).angle() + rightAngleOffset;
+  const Angle angleToLeftPost = angle(leftGoalPost - pointOnField) - leftAngleOffset;
+  const Angle angleToRightPost = angle(rightGoalPost - pointOnField) + rightAngleOffset;
 
   // Handle cases where the position is behind the opponent's goalposts (in regard to the x-coordinates)
   if(angleToLeftPost < angleToRightPost)
@@ -110,39 +110,45 @@ Angle ExpectedGoalsProvider::getOpeningAngle(const Vector2f& pointOnField, const
   ASSERT(std::abs(angleToLeftPost) <= pi_2);
   ASSERT(std::abs(angleToRightPost) <= pi_2);
 
-  // Construct a sector wheel relative to the position and add the goal sector between the two goal posts
+  // The sector wheel relative to the position is only constructed if an opponent
+  // is inside of the goal sector. Otherwise, the whole goal sector is free.
   SectorWheel wheel;
-  std::list<SectorWheel::Sector> sectors;
-  Angle openingAngle = 0_deg;
-  wheel.begin(pointOnField);
-  wheel.addSector(Rangea(angleToRightPost, angleToLeftPost), std::numeric_limits<float>::max(), SectorWheel::Sector::goal);
+  bool wheelStarted = false;
 
-  for(const auto& obstacle : theGlobalOpponentsModel.opponents)
+  for(const Opponent& opponent : opponents)
   {
-    const Vector2f& obstacleOnField = obstacle.position;
-    // Skip opponents inside of their goal (behind the goal line)
-    if(obstacleOnField.x() > (theFieldDimensions.xPosOpponentGoalLine + theFieldDimensions.xPosOpponentGoal) * 0.5f)
-      continue;
+    const Vector2f& obstacleOnField = opponent.position;
 
     // Check if the opponent is inside of the goal sector
-    const float width = (obstacle.left - obstacle.right).norm() + 4.f * theBallSpecification.radius;
+    const float width = opponent.width;
     const float distance = std::sqrt(std::max((obstacleOnField - pointOnField).squaredNorm() - sqr(width / 2.f), 1.f));
     const float ratio = !isPositioning ? 1.f : mapToRange(distance, 300.f, 1500.f, 1.f, 0.f);
-    const float radius = ratio * std::atan(width / (2.f * distance));
+    const float radius = ratio * atan(width / (2.f * distance));
 
-    const Angle direction = (obstacleOnField - pointOnField).angle();
+    const Angle direction = angle(obstacleOnField - pointOnField);
     if(direction - radius > angleToLeftPost ||
        direction + radius < angleToRightPost ||
        radius == 0.f)
       continue;
 
+    // Add the goal sector between the two goal posts before the first opponent
+    if(!wheelStarted)
+    {
+      wheel.begin(pointOnField);
+      wheel.addSector(Rangea(angleToRightPost, angleToLeftPost), std::numeric_limits<float>::max(), SectorWheel::Sector::goal);
+      wheelStarted = true;
+    }
+
     // Add the opponent to the sector wheel
     wheel.addSector(Rangea(Angle::normalize(direction - radius), Angle::normalize(direction + radius)), distance, SectorWheel::Sector::obstacle);
   }
 
-  sectors = wheel.finish();
+  if(!wheelStarted)
+    return angleToLeftPost - angleToRightPost;
+
   // Find the maximum opening angle i.e. the free sector with the largest size
-  for(const SectorWheel::Sector& sector : sectors)
+  Angle openingAngle = 0_deg;
+  for(const SectorWheel::Sector& sector : wheel.finish())
     if(sector.type == SectorWheel::Sector::goal &&
        sector.angleRange.getSize() >= openingAngle)
       openingAngle = sector.angleRange.getSize();
@@ -155,8 +161,8 @@ Angle ExpectedGoalsProvider::getOpponentOpeningAngle(const Vector2f& pointOnFiel
   const float minBallGoalPostOffset = theFieldDimensions.goalPostRadius + theBallSpecification.radius;
   const Angle leftAngleOffset = std::asin(std::min(1.f, minBallGoalPostOffset / (leftGoalPost - pointOnField).norm()));
   const Angle rightAngleOffset = std::asin(std::min(1.f, minBallGoalPostOffset / (rightGoalPost - pointOnField).norm()));
-  const Angle angleToLeftPost = (leftGoalPost - pointOnField).angle() - leftAngleOffset;
-  const Angle angleToRightPost = (rightGoalPost - pointOnField).angle() + rightAngleOffset;
+  const Angle angleToLeftPost = angle(leftGoalPost - pointOnField) - leftAngleOffset;
+  const Angle angleToRightPost = angle(rightGoalPost - pointOnField) + rightAngleOffset;
 
   // Handle cases where the position is behind the opponent's goalposts (in regard to the x-coordinates)
   if(angleToLeftPost < angleToRightPost)
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "Framework/Module.h"
+#include "Math/FastMath.h"
 #include "Representations/BehaviorControl/ExpectedGoals.h"
 #include "Representations/Configuration/BallSpecification.h"
 #include "Representations/Configuration/FieldDimensions.h"
@@ -32,6 +33,7 @@ MODULE(ExpectedGoalsProvider,
     (unsigned char)(255) heatmapAlpha, /**< Transparency of the heatmap between 0 (invisible) and 255 (opaque) */
     (ColorRGBA)(213, 17, 48) worstRatingColor, /**< Red color in RGB corresponding to a pass rating value of 0 in the heatmap */
     (ColorRGBA)(0, 104, 180) bestRatingColor, /**< Blue color in RGB corresponding to a pass rating value of 1 in the heatmap */
+    (bool)(false) useFastMath, /**< Use approximations of atan, atan2, and exp (max. error 1.2e-5 rad, 4e-6 relative) for the ratings? */
   }),
 });
 
@@ -49,6 +51,14 @@ private:
   Vector2i cellsNumber; /**< Resolution for the heatmap i.e. number of grid cells on the corresponding axis */
   std::vector<ColorRGBA> cellColors;
 
+  /** An opponent that might block a goal shot. */
+  struct Opponent
+  {
+    Vector2f position; /**< The position of the opponent on the field. */
+    float width; /**< The width of the opponent, widened by two ball diameters. */
+  };
+  std::vector<Opponent> opponents; /**< The opponents in front of their goal line that were known in this frame. */
+
   const Vector2f goalCenter = Vector2f(theFieldDimensions.xPosOpponentGoalLine, 0.f);
   const Vector2f leftGoalPost = Vector2f(theFieldDimensions.xPosOpponentGoalPost, theFieldDimensions.yPosLeftGoal);
   const Vector2f rightGoalPost = Vector2f(theFieldDimensions.xPosOpponentGoalPost, theFieldDimensions.yPosRightGoal);
@@ -77,6 +87,14 @@ private:
    */
   float getRating(const Vector2f& pointOnField, const bool isPositioning) const;
 
+  /**
+   * Computes the ratings of a batch of positions (see getRating).
+   * @param pointsOnField The positions to shoot from.
+   * @param isPositioning Is the rating for the positioning role?
+   * @param ratings The estimated probabilities of scoring a goal in the order of the positions.
+   */
+  void getRatings(const std::vector<Vector2f>& pointsOnField, const bool isPositioning, std::vector<float>& ratings) const;
+
   /**
    * Estimates the probability that a given position does not have a wide enough opening angle on the own goal for an opponent to score a goal against, not taking into account the known obstacles.
    * @param pointOnField The position to shoot from.
@@ -99,5 +117,26 @@ private:
    */
   Angle getOpponentOpeningAngle(const Vector2f& pointOnField) const;
 
+  /**
+   * Calculates the arc tangent, approximated if selected by the parameter useFastMath.
+   * @param x The argument.
+   * @return The arc tangent of x.
+   */
+  float atan(float x) const {return useFastMath ? FastMath::atan(x) : std::atan(x);}
+
+  /**
+   * Calculates the direction of a vector, approximated if selected by the parameter useFastMath.
+   * @param vector The vector.
+   * @return The angle of the vector relative to the x axis.
+   */
+  Angle angle(const Vector2f& vector) const {return useFastMath ? FastMath::atan2(vector.y(), vector.x()) : vector.angle();}
+
+  /**
+   * Calculates the exponential function, approximated if selected by the parameter useFastMath.
+   * @param x The exponent.
+   * @return e^x.
+   */
+  float exp(float x) const {return useFastMath ? FastMath::exp(x) : std::exp(x);}
+
   void draw();
 };
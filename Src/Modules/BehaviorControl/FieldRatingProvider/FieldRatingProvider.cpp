@@ -55,14 +55,11 @@ void FieldRatingProvider::update(FieldRating& fieldRating)
 {
   ASSERT(interpolationZoneInOwnHalf > 0.f);
 
-  fieldRating.potentialFieldOnly = [this](const float x, const float y, const bool calculateFieldDirection)
-  {
-    PotentialValue pv;
-    pv += getFieldBorderPotential(x, y, calculateFieldDirection);
-    pv += getGoalPotential(x, y, calculateFieldDirection);
-    pv += getGoalAnglePotential(x, y, calculateFieldDirection);
-    return pv;
-  };
+  if(useFieldOnlyRaster && (rasterNodes.empty() || rasterCellSize != fieldOnlyRasterCellSize
+                             || rasterAllowDirectKick != theIndirectKick.allowDirectKick))
+    resetFieldOnlyRaster();
+
+  fieldRating.potentialFieldOnly.bind<&FieldRatingProvider::getFieldOnlyPotential>(this);
 
   fieldRating.getObstaclePotential = [this](PotentialValue& pv, const float x, const float y, const bool calculateFieldDirection)
   {
@@ -88,10 +85,7 @@ void FieldRatingProvider::update(FieldRating& fieldRating)
       pv.value -= std::max(0.f, ballNear.value);
   };
 
-  fieldRating.getPossiblePassTargets = [this]()
-  {
-    return getPossiblePassTargets();
-  };
+  fieldRating.getPossiblePassTargets.bind<&FieldRatingProvider::getPossiblePassTargets>(this);
 
   DECLARE_DEBUG_DRAWING("module:FieldRatingProvider:potentialField", "drawingOnField");
 
@@ -110,7 +104,80 @@ void FieldRatingProvider::update(FieldRating& fieldRating)
   DEBUG_RESPONSE("module:FieldRatingProvider:potentialField")
     draw();
   DEBUG_RESPONSE("module:FieldRatingProvider:updateParameters")
+  {
     updateParameters();
+    rasterNodes.clear();
+  }
+}
+
+void FieldRatingProvider::resetFieldOnlyRaster()
+{
+  ASSERT(fieldOnlyRasterCellSize > 0.f);
+  rasterCellSize = fieldOnlyRasterCellSize;
+  rasterAllowDirectKick = theIndirectKick.allowDirectKick;
+  rasterOrigin = Vector2f(theFieldDimensions.xPosOwnFieldBorder, theFieldDimensions.yPosRightFieldBorder);
+  rasterWidth = static_cast<int>(std::ceil((theFieldDimensions.xPosOpponentFieldBorder - theFieldDimensions.xPosOwnFieldBorder) / rasterCellSize)) + 1;
+  rasterHeight = static_cast<int>(std::ceil((theFieldDimensions.yPosLeftFieldBorder - theFieldDimensions.yPosRightFieldBorder) / rasterCellSize)) + 1;
+  rasterTilesPerRow = (rasterWidth + rasterTileSize - 1) / rasterTileSize;
+  rasterNodes.resize(rasterWidth * rasterHeight);
+  rasterTilesFilled.assign(rasterTilesPerRow * ((rasterHeight + rasterTileSize - 1) / rasterTileSize), false);
+}
+
+const PotentialValue& FieldRatingProvider::getFieldOnlyRasterNode(const int x, const int y)
+{
+  const int tileX = x / rasterTileSize;
+  const int tileY = y / rasterTileSize;
+  const int tile = tileY * rasterTilesPerRow + tileX;
+  if(!rasterTilesFilled[tile])
+  {
+    rasterTilesFilled[tile] = true;
+    const int maxY = std::min((tileY + 1) * rasterTileSize, rasterHeight);
+    const int maxX = std::min((tileX + 1) * rasterTileSize, rasterWidth);
+    for(int nodeY = tileY * rasterTileSize; nodeY < maxY; ++nodeY)
+      for(int nodeX = tileX * rasterTileSize; nodeX < maxX; ++nodeX)
+        rasterNodes[nodeY * rasterWidth + nodeX] = computeFieldOnlyPotential(rasterOrigin.x() + static_cast<float>(nodeX) * rasterCellSize,
+                                                                             rasterOrigin.y() + static_cast<float>(nodeY) * rasterCellSize, true);
+  }
+  return rasterNodes[y * rasterWidth + x];
+}
+
+PotentialValue FieldRatingProvider::getFieldOnlyPotential(const float x, const float y, const bool calculateFieldDirection)
+{
+  if(!useFieldOnlyRaster || rasterNodes.empty())
+    return computeFieldOnlyPotential(x, y, calculateFieldDirection);
+
+  const float rasterX = (x - rasterOrigin.x()) / rasterCellSize;
+  const float rasterY = (y - rasterOrigin.y()) / rasterCellSize;
+  const int x0 = static_cast<int>(std::floor(rasterX));
+  const int y0 = static_cast<int>(std::floor(rasterY));
+  if(x0 < 0 || y0 < 0 || x0 >= rasterWidth - 1 || y0 >= rasterHeight - 1)
+    return computeFieldOnlyPotential(x, y, calculateFieldDirection);
+
+  const float ratioX = rasterX - static_cast<float>(x0);
+  const float ratioY = rasterY - static_cast<float>(y0);
+  const PotentialValue& pv00 = getFieldOnlyRasterNode(x0, y0);
+  const PotentialValue& pv10 = getFieldOnlyRasterNode(x0 + 1, y0);
+  const PotentialValue& pv01 = getFieldOnlyRasterNode(x0, y0 + 1);
+  const PotentialValue& pv11 = getFieldOnlyRasterNode(x0 + 1, y0 + 1);
+  const float w00 = (1.f - ratioX) * (1.f - ratioY);
+  const float w10 = ratioX * (1.f - ratioY);
+  const float w01 = (1.f - ratioX) * ratioY;
+  const float w11 = ratioX * ratioY;
+
+  PotentialValue pv;
+  pv.value = pv00.value * w00 + pv10.value * w10 + pv01.value * w01 + pv11.value * w11;
+  if(calculateFieldDirection)
+    pv.direction = pv00.direction * w00 + pv10.direction * w10 + pv01.direction * w01 + pv11.direction * w11;
+  return pv;
+}
+
+PotentialValue FieldRatingProvider::computeFieldOnlyPotential(const float x, const float y, const bool calculateFieldDirection)
+{
+  PotentialValue pv;
+  pv += getFieldBorderPotential(x, y, calculateFieldDirection);
+  pv += getGoalPotential(x, y, calculateFieldDirection);
+  pv += getGoalAnglePotential(x, y, calculateFieldDirection);
+  return pv;
 }
 
 float FieldRatingProvider::functionLinear(const float distance, const float radius, const float radiusTimesValue)
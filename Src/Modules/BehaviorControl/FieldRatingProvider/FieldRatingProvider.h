@@ -82,6 +82,10 @@ MODULE(FieldRatingProvider,
     (Angle)(110_deg) ballGoalSectorWidth, // Only direction from the ball to the goal +- 110 degrees are allowed
     (Angle)(10_deg) ballGoalSectorBorderWidth,
 
+    // raster of the field only potential
+    (bool)(false) useFieldOnlyRaster, // Interpolate the field only potential from a lazily filled raster instead of computing it for each query
+    (float)(50.f) fieldOnlyRasterCellSize, // The distance between two nodes of the raster (in mm)
+
     // drawing
     (ColorRGBA)(213, 17, 48, 125) badRatingColor,
     (ColorRGBA)(0, 140, 0, 125) middleRatingColor,
@@ -167,6 +171,16 @@ private:
 
   Rangef drawMinMax = Rangef(-1.f, 1.f);
 
+  static constexpr int rasterTileSize = 8; /**< The edge length of the tiles of the raster that are filled at once (in nodes). */
+  Vector2f rasterOrigin = Vector2f::Zero(); /**< The field position of the first node of the raster. */
+  float rasterCellSize = 0.f; /**< The distance between two nodes of the raster (in mm). */
+  int rasterWidth = 0; /**< The number of nodes of the raster in x direction. */
+  int rasterHeight = 0; /**< The number of nodes of the raster in y direction. */
+  int rasterTilesPerRow = 0; /**< The number of tiles of the raster in x direction. */
+  bool rasterAllowDirectKick = true; /**< The state of the indirect kick for which the raster was computed. */
+  std::vector<PotentialValue> rasterNodes; /**< The field only potential at all nodes of the raster. */
+  std::vector<bool> rasterTilesFilled; /**< Which tiles of the raster were already computed? */
+
   float functionLinear(const float distance, const float radius, const float radiusTimesValue);
   Vector2f functionLinearDer(const Vector2f& distanceVector, const float distance, const float valueSign);
 
@@ -177,6 +191,26 @@ private:
 
   void updateParameters();
 
+  /** Clears the raster of the field only potential and adapts it to the current parameters. */
+  void resetFieldOnlyRaster();
+
+  /**
+   * Returns a node of the raster of the field only potential, computing its whole tile if necessary.
+   * @param x The index of the node in x direction.
+   * @param y The index of the node in y direction.
+   * @return The potential at the node including its direction.
+   */
+  const PotentialValue& getFieldOnlyRasterNode(const int x, const int y);
+
+  /**
+   * Computes the field only potential, i.e. the sum of the field border, goal and goal angle potentials.
+   * If enabled, it is interpolated bilinearly from the raster inside the field border.
+   */
+  PotentialValue getFieldOnlyPotential(const float x, const float y, const bool calculateFieldDirection);
+
+  /** Computes the field only potential without using the raster. */
+  PotentialValue computeFieldOnlyPotential(const float x, const float y, const bool calculateFieldDirection);
+
   PotentialValue getFieldBorderPotential(const float x, const float y, const bool calculateFieldDirection);
 
   PotentialValue getObstaclePotential(const float x, const float y, const bool calculateFieldDirection);
@@ -85,10 +85,7 @@ void FieldRatingProviderSAC::update(FieldRating& fieldRating)
       pv.value -= std::max(0.f, ballNear.value);
   };
 
-  fieldRating.getPossiblePassTargets = [this]()
-  {
-    return getPossiblePassTargets();
-  };
+  fieldRating.getPossiblePassTargets.bind<&FieldRatingProviderSAC::getPossiblePassTargets>(this);
 
   DECLARE_DEBUG_DRAWING("module:FieldRatingProviderSAC:potentialField", "drawingOnField");
 
@@ -55,9 +55,14 @@ HeadTarget LibLookActiveProvider::calculateHeadTarget(const bool withBall, const
   calculateSpeedFactors();
   const bool forceBall = !ignoreBall && !ballPositionUnknown(onlyOwnBall) && (withBall || shouldLookAtBall()) && ballAnglesReachable();
 
-  const Angle pan = calculatePan(forceBall);
+  const bool search = searchBallSearchAreas && !ignoreBall && !forceBall && ballPositionUnknown(onlyOwnBall);
+  if(!search)
+    searchGazeValid = false;
+  const VisibilityTable::Gaze* searchTarget = search ? selectSearchGaze() : nullptr;
+
+  const Angle pan = searchTarget ? searchTarget->pan : calculatePan(forceBall);
   PLOT("module:LibLookActiveProvider:pan", pan.toDegrees());
-  const Angle tilt = fixTilt ? Angle(0.38f) : calculateTilt(forceBall, onlyOwnBall);
+  const Angle tilt = fixTilt ? Angle(0.38f) : searchTarget ? searchTarget->tilt : calculateTilt(forceBall, onlyOwnBall);
   PLOT("module:LibLookActiveProvider:tilt", tilt.toDegrees());
   const Angle speed = calculateSpeed(forceBall, pan, slowdownFactor);
   PLOT("module:LibLookActiveProvider:speed", speed.toDegrees());
@@ -241,6 +246,34 @@ bool LibLookActiveProvider::ballPositionUnknown(const bool onlyOwnBall) const
          (notSeen && globalNotSeen); // We and our team did not see the ball for a long time
 }
 
+const VisibilityTable::Gaze* LibLookActiveProvider::selectSearchGaze()
+{
+  if(visibilityTable.empty() || std::abs(theTorsoMatrix.translation.z() - visibilityTable.torsoHeight) > visibilityRecomputeHeightDeviation)
+  {
+    visibilityTable.compute(theTorsoMatrix, theRobotDimensions, theCameraCalibration, theCameraInfo, theFieldDimensions, theHeadLimits,
+                            visibilityPanStep, visibilityTilts, visibilityDirectionStep, visibilityDistanceStep, visibilityMaxDistance);
+    searchGazeValid = false;
+  }
+  if(visibilityTable.empty())
+    return nullptr;
+
+  if(!searchGazeValid || panReached(visibilityTable.gazes[searchGaze].pan))
+  {
+    const Pose2f robotPoseInverse = theRobotPose.inverse();
+    std::vector<VisibilityTable::WeightedCell> cells;
+    cells.reserve(theBallSearchAreas.grid.size());
+    for(const BallSearchAreas::Cell& cell : theBallSearchAreas.grid)
+    {
+      const std::size_t index = visibilityTable.getCell(robotPoseInverse * cell.positionOnField);
+      if(index != VisibilityTable::noCell)
+        cells.push_back({index, static_cast<float>(theFrameInfo.getTimeSince(cell.timestamp) + 1) * static_cast<float>(cell.priority)});
+    }
+    searchGaze = visibilityTable.getBestGaze(cells);
+    searchGazeValid = true;
+  }
+  return &visibilityTable.gazes[searchGaze];
+}
+
 void LibLookActiveProvider::calculateSpeedFactors()
 {
   if(translationSpeedBuffer.full())
@@ -8,9 +8,11 @@
 #include "Debugging/Debugging.h"
 #include "Debugging/DebugDrawings.h"
 #include "Representations/BehaviorControl/AgentStates.h"
+#include "Representations/BehaviorControl/BallSearchAreas.h"
 #include "Representations/BehaviorControl/Libraries/LibLookActive.h"
 #include "Representations/Configuration/CameraCalibration.h"
 #include "Representations/Configuration/BallSpecification.h"
+#include "Representations/Configuration/FieldDimensions.h"
 #include "Representations/Configuration/HeadLimits.h"
 #include "Representations/Configuration/RobotDimensions.h"
 #include "Representations/Infrastructure/CameraInfo.h"
@@ -25,14 +27,17 @@
 #include "Representations/MotionControl/MotionInfo.h"
 #include "Representations/Sensing/TorsoMatrix.h"
 #include "Math/RingBufferWithSum.h"
+#include "Tools/BehaviorControl/VisibilityTable.h"
 
 MODULE(LibLookActiveProvider,
 {,
   REQUIRES(AgentStates),
   REQUIRES(BallModel),
+  REQUIRES(BallSearchAreas),
   REQUIRES(BallSpecification),
   USES(CameraCalibration),
   REQUIRES(CameraInfo),
+  REQUIRES(FieldDimensions),
   REQUIRES(FrameInfo),
   REQUIRES(HeadLimits),
   REQUIRES(GameState),
@@ -66,6 +71,13 @@ MODULE(LibLookActiveProvider,
     (int) maxObstacleAgeToBeLookedAt,
     (Angle) cameraChoiceHysteresis,
     (float) teammatesBallModelError, /**< estimation of the worst-case TeammatesBallModel error */
+    (bool) searchBallSearchAreas, /**< Look at the ball search cells not seen for the longest time if the ball position is unknown. */
+    (Angle) visibilityPanStep, /**< The distance between the pan angles of the visibility table. */
+    (std::vector<Angle>) visibilityTilts, /**< The tilt angles of the visibility table. */
+    (Angle) visibilityDirectionStep, /**< The angular size of the cells of the visibility table. */
+    (float) visibilityDistanceStep, /**< The radial size of the cells of the visibility table. */
+    (float) visibilityMaxDistance, /**< The maximum distance of ball search cells considered. */
+    (float) visibilityRecomputeHeightDeviation, /**< Recompute the visibility table if the camera height differs more than this. */
   }),
 });
 
@@ -82,6 +94,10 @@ private:
 
   int basePanAngleIndex = 0;
 
+  VisibilityTable visibilityTable; /**< Which cells around the robot the upper camera sees for different head orientations. */
+  std::size_t searchGaze = 0; /**< The index of the gaze in the visibility table that is currently used for the search. */
+  bool searchGazeValid = false; /**< Was a gaze selected for searching the ball? */
+
   Angle calculatePan(const bool forceBall);
   Angle calculateTilt(const bool forceBall, const bool onlyOwnBall) const;
   Angle calculateSpeed(const bool forceBall, const float targetPan, const float slowdownFactor) const;
@@ -99,6 +115,14 @@ private:
 
   float getTranslationOffset(float x) const;
 
+  /**
+   * Selects the head orientation that sees the ball search cells that were not
+   * seen for the longest time, weighted by their priorities. A new orientation
+   * is only selected when the previous one was reached.
+   * @return The head orientation or nullptr if the visibility table is empty.
+   */
+  const VisibilityTable::Gaze* selectSearchGaze();
+
   RingBufferWithSum<float, 180> translationSpeedBuffer;
   RingBufferWithSum<Angle, 120> rotationSpeedBuffer;
   void calculateSpeedFactors();
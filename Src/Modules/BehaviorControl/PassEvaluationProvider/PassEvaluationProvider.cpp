@@ -48,29 +48,49 @@ float PassEvaluationProvider::getRating(const Vector2f& baseOnField, const Vecto
     lastUpdateParameters = theFrameInfo.time;
     updateParameters();
   }
-  // Calculate the minimum distance from the opponents and teammates (separately) to the target itself as well as the line from the base to the target
-  float minOpponentDistToTarget = std::numeric_limits<float>::max();
-  float minOpponentDistToLine = std::numeric_limits<float>::max();
-  for(const Vector2f& opponentOnField : opponentsOnField)
-    updateMinDistances(baseOnField, targetOnField, opponentOnField, minOpponentDistToTarget, minOpponentDistToLine);
-
-  // Estimated probability that no opponent would be at the pass target
-  const float passTargetFree = calcPassTargetFree ? mapToRange(minOpponentDistToTarget, 0.f, opponentDistToTargetThreshold, 0.f, 1.f) : 1.f;
-
-  // Estimated probability that no opponent would intercept the pass
-  const float passLineFree = !isPositioning && calcPassLineFree ? mapToRange(minOpponentDistToLine, obstacleBlockingRadius, opponentDistToLineThreshold, 0.f, 1.f) : 1.f;
-
   // Estimated probability that the pass would be within the field and not go out of its boundary
   const float passTargetInField = calcPassTargetInField ? mapToRange(getDistanceToFieldBorder(targetOnField), 0.f, distToBoundaryThreshold, 0.f, 1.f) : 1.f;
 
-  // Estimated probability that no teammate's direct shot towards the opponent's goal would be blocked
-  const float shotLineFree = calcShotLineFree ? 1.f - ((1.f - isShotLineFree(baseOnField, targetOnField)) * theExpectedGoals.xG(baseOnField)) : 1.f;
-
   // Estimated probability that the target is within the kick range
   const float targetInRange = calcShotDistance ? isTargetInRange(baseOnField, targetOnField) : 1.f;
 
+  // The remaining factors are more expensive, so they are skipped if the result is already zero.
+  float combinedValue = passTargetInField * targetInRange;
+  if(combinedValue == 0.f)
+    return minValue;
+
+  // Calculate the minimum distance from the opponents to the target itself as well as the line from the base to the target
+  const bool checkPassLine = !isPositioning && calcPassLineFree;
+  if(calcPassTargetFree || checkPassLine)
+  {
+    float minOpponentDistToTargetSquared = std::numeric_limits<float>::max();
+    float minOpponentDistToLineSquared = std::numeric_limits<float>::max();
+    const Vector2f passDirection = targetOnField - baseOnField;
+    const float passLengthSquared = passDirection.squaredNorm();
+    for(const Vector2f& opponentOnField : opponentsOnField)
+      updateMinDistances(baseOnField, passDirection, passLengthSquared, opponentOnField, minOpponentDistToTargetSquared, minOpponentDistToLineSquared);
+
+    // Estimated probability that no opponent would be at the pass target
+    if(calcPassTargetFree)
+      combinedValue *= mapToRange(std::sqrt(minOpponentDistToTargetSquared), 0.f, opponentDistToTargetThreshold, 0.f, 1.f);
+
+    // Estimated probability that no opponent would intercept the pass
+    if(checkPassLine)
+      combinedValue *= mapToRange(std::sqrt(minOpponentDistToLineSquared), obstacleBlockingRadius, opponentDistToLineThreshold, 0.f, 1.f);
+
+    if(combinedValue == 0.f)
+      return minValue;
+  }
+
+  // Estimated probability that no teammate's direct shot towards the opponent's goal would be blocked
+  if(calcShotLineFree)
+  {
+    const float shotLineBlocked = 1.f - isShotLineFree(baseOnField, targetOnField);
+    if(shotLineBlocked != 0.f)
+      combinedValue *= 1.f - shotLineBlocked * theExpectedGoals.xG(baseOnField);
+  }
+
   // Estimated probability that the pass would be successful based on the above combined conditions
-  const float combinedValue = passTargetFree * passLineFree * passTargetInField * shotLineFree * targetInRange;
   return std::max(minValue, combinedValue);
 }
 
@@ -87,14 +107,19 @@ void PassEvaluationProvider::updateParameters()
   }
 }
 
-void PassEvaluationProvider::updateMinDistances(const Vector2f& baseOnField, const Vector2f& targetOnField, const Vector2f& obstacleOnField, float& minDistToTarget, float& minDistToLine) const
+void PassEvaluationProvider::updateMinDistances(const Vector2f& baseOnField, const Vector2f& passDirection, float passLengthSquared, const Vector2f& obstacleOnField,
+                                                float& minDistToTargetSquared, float& minDistToLineSquared) const
 {
-  const float distToTarget = (targetOnField - obstacleOnField).norm();
-  if(distToTarget < minDistToTarget)
-    minDistToTarget = distToTarget;
-  const float distToLine = Geometry::getDistanceToEdge(Geometry::Line(baseOnField, (targetOnField - baseOnField)), obstacleOnField);
-  if(distToLine < minDistToLine)
-    minDistToLine = distToLine;
+  const Vector2f baseToObstacle = obstacleOnField - baseOnField;
+  const float distToTargetSquared = (baseToObstacle - passDirection).squaredNorm();
+  if(distToTargetSquared < minDistToTargetSquared)
+    minDistToTargetSquared = distToTargetSquared;
+
+  // Same as Geometry::getDistanceToEdge, but without the square root.
+  const float projection = passLengthSquared > 0.f ? clip(baseToObstacle.dot(passDirection) / passLengthSquared, 0.f, 1.f) : 0.f;
+  const float distToLineSquared = (baseToObstacle - passDirection * projection).squaredNorm();
+  if(distToLineSquared < minDistToLineSquared)
+    minDistToLineSquared = distToLineSquared;
 }
 
 float PassEvaluationProvider::isShotLineFree(const Vector2f& baseOnField, const Vector2f& targetOnField) const
@@ -63,7 +63,7 @@ private:
   bool calcShotLineFree = true;
   bool calcShotDistance = true;
   bool isPositioningDrawing = false;
-  unsigned int lastUpdateParameters;
+  unsigned int lastUpdateParameters = 0;
   Vector2f leftGoalPost = Vector2f(theFieldDimensions.xPosOpponentGoalPost, theFieldDimensions.yPosLeftGoal - theBallSpecification.radius * 2.f);
   Vector2f rightGoalPost = Vector2f(theFieldDimensions.xPosOpponentGoalPost, theFieldDimensions.yPosRightGoal + theBallSpecification.radius * 2.f);
   Vector2f opponentFieldCorner = Vector2f(theFieldDimensions.xPosOpponentGoalLine, theFieldDimensions.yPosLeftTouchline);
@@ -87,14 +87,16 @@ private:
   void updateParameters();
 
   /**
-   * Updates minimum distance of the obstacles to the target itself as well as the line from the ball to the target.
+   * Updates the minimum squared distances of the obstacles to the target itself as well as the line from the ball to the target.
    * @param baseOnField The start position to pass from.
-   * @param targetOnField The target position to pass to.
+   * @param passDirection The vector from the start position to the target position.
+   * @param passLengthSquared The squared length of \c passDirection.
    * @param obstacleOnField The obstacle to check the distance for.
-   * @param minDistToTarget The distance of the closest obstacle to the target position (could be updated by reference).
-   * @param minDistToLine The distance of the closest obstacle to the line from the ball to the target position (could be updated by reference).
+   * @param minDistToTargetSquared The squared distance of the closest obstacle to the target position (could be updated by reference).
+   * @param minDistToLineSquared The squared distance of the closest obstacle to the line from the ball to the target position (could be updated by reference).
    */
-  void updateMinDistances(const Vector2f& baseOnField, const Vector2f& targetOnField, const Vector2f& obstacleOnField, float& minDistToTarget, float& minDistToLine) const;
+  void updateMinDistances(const Vector2f& baseOnField, const Vector2f& passDirection, float passLengthSquared, const Vector2f& obstacleOnField,
+                          float& minDistToTargetSquared, float& minDistToLineSquared) const;
 
   /**
    * Estimates the probability that the position is not blocking a teammate's direct shot at the opponent's goal.
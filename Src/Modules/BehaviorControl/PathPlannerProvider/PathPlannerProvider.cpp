@@ -88,8 +88,10 @@ void PathPlannerProvider::update(PathPlanner& pathPlanner)
     const bool excludeOwnPenaltyArea = theIllegalAreas.illegal & bit(IllegalAreas::ownPenaltyArea);
     const bool excludeOpponentPenaltyArea = theIllegalAreas.illegal & bit(IllegalAreas::opponentPenaltyArea);
     pathPlannerWasActive = true;
-    createBarriers(target, excludeOwnPenaltyArea, excludeOpponentPenaltyArea);
-    createNodes(target, excludeOwnPenaltyArea, excludeOpponentPenaltyArea);
+    startPose = theRobotPose;
+    targetPositions.assign(1, target.translation);
+    createBarriers(excludeOwnPenaltyArea, excludeOpponentPenaltyArea);
+    createNodes(excludeOwnPenaltyArea, excludeOpponentPenaltyArea);
     plan(nodes[0], nodes[1], speed.translation.x() / speed.rotation);
 
     bool foundPath = false;
@@ -130,13 +132,40 @@ void PathPlannerProvider::update(PathPlanner& pathPlanner)
     return obstacleAvoidance;
   };
 
+  pathPlanner.getPathLengths = [this](const Pose2f& start, const std::vector<Vector2f>& targets, const Pose2f& speed) -> std::vector<float>
+  {
+    const bool excludeOwnPenaltyArea = theIllegalAreas.illegal & bit(IllegalAreas::ownPenaltyArea);
+    const bool excludeOpponentPenaltyArea = theIllegalAreas.illegal & bit(IllegalAreas::opponentPenaltyArea);
+    std::vector<float> pathLengths(targets.size(), std::numeric_limits<float>::infinity());
+    if(targets.empty())
+      return pathLengths;
+
+    startPose = start;
+    targetPositions = targets;
+    createBarriers(excludeOwnPenaltyArea, excludeOpponentPenaltyArea);
+    createNodes(excludeOwnPenaltyArea, excludeOpponentPenaltyArea);
+    planToAll(nodes[0], speed.translation.x() / speed.rotation);
+
+    for(std::size_t i = 0; i < targets.size(); ++i)
+    {
+      const Node& node = nodes[i + 1];
+      if(node.center == start.translation)
+        pathLengths[i] = 0.f;
+      else
+        FOREACH_ENUM(Rotation, rotation)
+          if(node.fromEdge[rotation])
+            pathLengths[i] = std::min(pathLengths[i], node.fromEdge[rotation]->pathLength);
+    }
+    return pathLengths;
+  };
+
   if(!pathPlannerWasActive)
     lastDir = numOfRotations;
   else
     pathPlannerWasActive = false;
 }
 
-void PathPlannerProvider::createBarriers(const Pose2f& target, bool excludeOwnPenaltyArea, bool excludeOpponentPenaltyArea)
+void PathPlannerProvider::createBarriers(bool excludeOwnPenaltyArea, bool excludeOpponentPenaltyArea)
 {
   barriers.clear();
   barriers.reserve(8);
@@ -157,8 +186,9 @@ void PathPlannerProvider::createBarriers(const Pose2f& target, bool excludeOwnPe
     float right = theFieldDimensions.yPosRightPenaltyArea - penaltyAreaRadius + radiusControlOffset;
     float front = theFieldDimensions.xPosOwnPenaltyArea + penaltyAreaRadius - radiusControlOffset;
 
-    clipPenaltyArea(theRobotPose.translation, left, right, front);
-    clipPenaltyArea(target.translation, left, right, front);
+    clipPenaltyArea(startPose.translation, left, right, front);
+    for(const Vector2f& target : targetPositions)
+      clipPenaltyArea(target, left, right, front);
 
     barriers.emplace_back(theFieldDimensions.xPosOwnPenaltyArea, left,
                           theFieldDimensions.xPosOwnGoalLine, left);
@@ -174,8 +204,9 @@ void PathPlannerProvider::createBarriers(const Pose2f& target, bool excludeOwnPe
     float right = theFieldDimensions.yPosRightPenaltyArea - penaltyAreaRadius + radiusControlOffset;
     float front = theFieldDimensions.xPosOpponentPenaltyArea + penaltyAreaRadius - radiusControlOffset;
 
-    clipPenaltyArea(theRobotPose.translation, left, right, front);
-    clipPenaltyArea(target.translation, left, right, front);
+    clipPenaltyArea(startPose.translation, left, right, front);
+    for(const Vector2f& target : targetPositions)
+      clipPenaltyArea(target, left, right, front);
 
     barriers.emplace_back(theFieldDimensions.xPosOpponentPenaltyArea, left,
                           theFieldDimensions.xPosOpponentGoalLine, left);
@@ -188,7 +219,7 @@ void PathPlannerProvider::createBarriers(const Pose2f& target, bool excludeOwnPe
   if(theGameState.isPlaying() && wrongBallSideCostFactor > 0.f)
   {
     const Vector2f& ballPosition = theStrategyStatus.role == ActiveRole::toRole(ActiveRole::playBall) ? theFieldBall.recentBallEndPositionOnField() : theFieldBall.recentBallPositionOnField();
-    if((ballPosition - target.translation).norm() >= 1.f)
+    if(!isTarget(ballPosition))
     {
       Vector2f end = ballPosition + (ballPosition - Vector2f(theFieldDimensions.xPosOwnGoal, 0)).normalized(wrongBallSideRadius);
       barriers.emplace_back(ballPosition.x(), ballPosition.y(), end.x(), end.y(), ballRadius * pi2 * wrongBallSideCostFactor);
@@ -213,19 +244,19 @@ void PathPlannerProvider::clipPenaltyArea(const Vector2f& position, float& left,
   }
 }
 
-void PathPlannerProvider::createNodes(const Pose2f& target, bool excludeOwnPenaltyArea, bool excludeOpponentPenaltyArea)
+void PathPlannerProvider::createNodes(bool excludeOwnPenaltyArea, bool excludeOpponentPenaltyArea)
 {
   nodes.clear();
 
   // Reserve enough space that prevents any reallocation, because the addresses of entries are used.
   nodes.reserve(sqr((excludeOwnPenaltyArea ? 8 : 6) + (excludeOpponentPenaltyArea ? 2 : 0) +
-                    theObstacleModel.obstacles.size()));
+                    theObstacleModel.obstacles.size() + targetPositions.size() - 1));
 
-  // Insert start and target
-  nodes.emplace_back(theRobotPose.translation, 0.f);
-  nodes.emplace_back(target.translation, 0.f);
-  Node& from(nodes.front());
-  Node& to(nodes.back());
+  // Insert start and targets
+  nodes.emplace_back(startPose.translation, 0.f);
+  for(const Vector2f& target : targetPositions)
+    nodes.emplace_back(target, 0.f);
+  const std::size_t firstObstacle = nodes.size();
 
   // Insert goalposts
   nodes.emplace_back(Vector2f(theFieldDimensions.xPosOpponentGoalPost, theFieldDimensions.yPosLeftGoal), goalPostRadius - radiusControlOffset);
@@ -271,16 +302,16 @@ void PathPlannerProvider::createNodes(const Pose2f& target, bool excludeOwnPenal
     const Vector2f& ballPosition = theStrategyStatus.role == ActiveRole::toRole(ActiveRole::playBall) ? theFieldBall.recentBallEndPositionOnField() : theFieldBall.recentBallPositionOnField();
     if(theGameState.isFreeKick() && theGameState.isForOpponentTeam())
       addObstacle(ballPosition, freeKickRadius);
-    else if((ballPosition - to.center).norm() >= 1.f)
+    else if(!isTarget(ballPosition))
       addObstacle(ballPosition, ballRadius);
   }
 
   if(centerCircleRadius != 0.f && theGameState.state == GameState::setupOpponentKickOff)
     addObstacle(Vector2f::Zero(), centerCircleRadius);
 
-  // If other nodes surround start or target, shrink them.
-  for(auto node = nodes.begin(); node != nodes.begin() + 2; ++node)
-    for(auto other = nodes.begin() + 2; other != nodes.end(); ++other)
+  // If other nodes surround start or targets, shrink them.
+  for(auto node = nodes.begin(); node != nodes.begin() + firstObstacle; ++node)
+    for(auto other = nodes.begin() + firstObstacle; other != nodes.end(); ++other)
     {
       if((other->center - node->center).squaredNorm() <= sqr(other->radius))
       {
@@ -292,14 +323,14 @@ void PathPlannerProvider::createNodes(const Pose2f& target, bool excludeOwnPenal
       }
     }
 
-  // If start and target are both inside the field, prevent passing obstacles outside the field.
+  // If start and targets are all inside the field, prevent passing obstacles outside the field.
   Boundaryf border(Rangef(borders[1].base.x(), borders[0].base.x()),
                    Rangef(borders[3].base.y(), borders[2].base.y()));
-  if(border.isInside(from.center) && border.isInside(to.center))
+  if(std::all_of(nodes.begin(), nodes.begin() + firstObstacle, [&border](const Node& node) {return border.isInside(node.center);}))
   {
     Vector2f p1;
     Vector2f p2;
-    for(auto node = nodes.begin() + 2; node != nodes.end(); ++node)
+    for(auto node = nodes.begin() + firstObstacle; node != nodes.end(); ++node)
       for(const auto& border : borders)
         if(Geometry::getIntersectionOfLineAndCircle(border, *node, p1, p2) == 2)
           node->blockedSectors.emplace_back((p1 - node->center).angle(), (p2 - node->center).angle());
@@ -356,13 +387,18 @@ void PathPlannerProvider::addObstacle(const Vector2f& center, float radius)
     nodes.emplace_back(center, radius);
 }
 
+bool PathPlannerProvider::isTarget(const Vector2f& position) const
+{
+  return std::any_of(targetPositions.begin(), targetPositions.end(), [&position](const Vector2f& target) {return (position - target).norm() < 1.f;});
+}
+
 void PathPlannerProvider::plan(Node& from, Node& to, float speedRatio)
 {
   candidates.clear();
   candidates.reserve(nodes.size() * nodes.size() * 4);
 
-  expand(from, to, cw, speedRatio);
-  expand(from, to, ccw, speedRatio);
+  expand(from, &to, cw, speedRatio);
+  expand(from, &to, ccw, speedRatio);
 
   // Do A* search
   while(!candidates.empty())
@@ -386,12 +422,52 @@ void PathPlannerProvider::plan(Node& from, Node& to, float speedRatio)
       if(candidate.edge->toNode == &to)
         break;
       else
-        expand(*candidate.edge->toNode, to, candidate.edge->toRotation, speedRatio);
+        expand(*candidate.edge->toNode, &to, candidate.edge->toRotation, speedRatio);
     }
   }
 }
 
-void PathPlannerProvider::expand(Node& node, const Node& to, Rotation rotation, float speedRatio)
+void PathPlannerProvider::planToAll(Node& from, float speedRatio)
+{
+  candidates.clear();
+  candidates.reserve(nodes.size() * nodes.size() * 4);
+
+  expand(from, nullptr, cw, speedRatio);
+  expand(from, nullptr, ccw, speedRatio);
+
+  // Do Dijkstra search until all targets were reached. Targets are never cloned and are not expanded further.
+  const Node* const firstTarget = &nodes[1];
+  const Node* const lastTarget = &nodes[targetPositions.size()];
+  std::size_t numOfTargetsReached = 0;
+  while(!candidates.empty() && numOfTargetsReached < targetPositions.size())
+  {
+    Candidate candidate = candidates.front();
+
+    std::pop_heap(candidates.begin(), candidates.end());
+    candidates.pop_back();
+
+    // Clone target node if it was already reached and clones are allowed.
+    if(candidate.edge->toNode->fromEdge[candidate.edge->toRotation] &&
+       candidate.edge->toNode->allowedClones > 0)
+    {
+      nodes.emplace_back(*candidate.edge->toNode);
+      --candidate.edge->toNode->allowedClones;
+      candidate.edge->toNode = &nodes.back();
+    }
+    Node& node = *candidate.edge->toNode;
+    if(!node.fromEdge[candidate.edge->toRotation])
+    {
+      const bool isFirstArrival = !node.fromEdge[cw] && !node.fromEdge[ccw];
+      node.fromEdge[candidate.edge->toRotation] = candidate.edge;
+      if(&node >= firstTarget && &node <= lastTarget)
+        numOfTargetsReached += isFirstArrival ? 1 : 0;
+      else
+        expand(node, nullptr, candidate.edge->toRotation, speedRatio);
+    }
+  }
+}
+
+void PathPlannerProvider::expand(Node& node, const Node* to, Rotation rotation, float speedRatio)
 {
   if(!node.expanded)
   {
@@ -445,14 +521,14 @@ void PathPlannerProvider::expand(Node& node, const Node& to, Rotation rotation,
     else
     {
       // This is the first node. Add penalty for rotating to outgoing edge.
-      const float toRotate = std::abs((theRobotPose.translation - edge.toNode->center).norm() > edge.toNode->radius
-                                      ? (Pose2f(edge.toPoint) - theRobotPose).translation.angle()
-                                      : Angle::normalize((edge.toPoint - edge.toNode->center).angle() + (edge.toRotation == cw ? -pi_2 : pi_2) - theRobotPose.rotation));
+      const float toRotate = std::abs((startPose.translation - edge.toNode->center).norm() > edge.toNode->radius
+                                      ? (Pose2f(edge.toPoint) - startPose).translation.angle()
+                                      : Angle::normalize((edge.toPoint - edge.toNode->center).angle() + (edge.toRotation == cw ? -pi_2 : pi_2) - startPose.rotation));
       const float distanceRatio = toRotate * speedRatio;
       edge.pathLength += distanceRatio * rotationPenalty + (lastDir == edge.toRotation ? 0.f : switchPenalty);
     }
 
-    candidates.emplace_back(&edge, (to.center - edge.toPoint).norm());
+    candidates.emplace_back(&edge, to ? (to->center - edge.toPoint).norm() : 0.f);
     std::push_heap(candidates.begin(), candidates.end());
 
   continueOuterLoop:
@@ -462,9 +538,10 @@ void PathPlannerProvider::expand(Node& node, const Node& to, Rotation rotation,
 
 void PathPlannerProvider::findNeighbors(Node& node)
 {
-  Tangents tangents;
-  createTangents(node, tangents);
-  addNeighborsFromTangents(node, tangents);
+  for(auto& t : nodeTangents)
+    t.clear();
+  createTangents(node, nodeTangents);
+  addNeighborsFromTangents(node, nodeTangents);
 }
 
 void PathPlannerProvider::createTangents(Node& node, Tangents& tangents)
@@ -641,23 +718,24 @@ void PathPlannerProvider::addNeighborsFromTangents(Node& node, Tangents& tangent
     // Create index for tangents sorted by angle.
     // Since indices are used to reference between tangents,
     // the original vector of tangents must stay unchanged.
-    std::vector<Tangent*> index;
-    index.reserve(t.size());
+    sortedTangents.clear();
     for(auto& tangent : t)
-      index.push_back(&tangent);
-    std::sort(index.begin(), index.end(), [](const Tangent* t1, const Tangent* t2) -> bool
+      sortedTangents.push_back(&tangent);
+    std::sort(sortedTangents.begin(), sortedTangents.end(), [](const Tangent* t1, const Tangent* t2) -> bool
     {
       return t1->fromAngle < t2->fromAngle;
     });
 
+    // There cannot be more edges than tangents. Reserving them at once avoids reallocations while they are added.
+    node.edges[rotation].reserve(t.size());
+
     // Sweep through all tangents, managing a set of current nodes sorted by their distance.
-    std::vector<Tangent*> sweepLine;
-    sweepLine.reserve(t.size());
+    sweepLine.clear();
     const auto byDistance = [](const Tangent* t1, const Tangent* t2) -> bool
     {
       return t1->circleDistance > t2->circleDistance;
     };
-    for(auto& tangent : index)
+    for(auto& tangent : sortedTangents)
     {
       // In general, if the node of the current tangent is not further away than the closest node
       // in the sweep line, it is a neighbor. However, since the obstacles are modeled as circles,
@@ -735,7 +813,7 @@ Vector2f PathPlannerProvider::calcAvoidanceVector(const Node* nextNode) const
   bool closeToNextNode = false;
   bool closeToOtherNode = false;
   bool inFront = false;
-  for(auto node = nodes.begin() + 2; node != nodes.end(); ++node)
+  for(auto node = nodes.begin() + 1 + targetPositions.size(); node != nodes.end(); ++node)
   {
     const Vector2f offset = node->center - theRobotPose.translation;
     if(offset.squaredNorm() < sqr(node->originalRadius + radiusControlOffset))
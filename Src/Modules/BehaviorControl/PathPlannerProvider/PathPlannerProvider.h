@@ -220,10 +220,15 @@ class PathPlannerProvider : public PathPlannerProviderBase
 
   using Tangents = std::array<std::vector<Tangent>, numOfRotations>;
 
-  std::vector<Node> nodes; /**< All nodes of the visibility graph, i.e. all obstacles, and starting point (1st entry) and target (2nd entry). */
+  std::vector<Node> nodes; /**< All nodes of the visibility graph, i.e. starting point (1st entry), targets (following entries), and all obstacles. */
   std::vector<Candidate> candidates; /**< All open edges during the A* search. */
   std::vector<Barrier> barriers; /**< Barrier lines that cannot be crossed during planning. */
+  Tangents nodeTangents; /**< The tangents of the node currently expanded. Kept as member to reuse their memory. */
+  std::vector<Tangent*> sortedTangents; /**< The tangents of one rotation sorted by their angle. Kept as member to reuse its memory. */
+  std::vector<Tangent*> sweepLine; /**< The sweep line used when adding neighbors. Kept as member to reuse its memory. */
   const std::vector<Geometry::Line> borders; /**< The border of the field plus a tolerance. */
+  Pose2f startPose; /**< The pose from which the current query starts. */
+  std::vector<Vector2f> targetPositions; /**< The targets of the current query. */
   Rotation lastDir = cw; /**< Last direction selected when walking around first obstacle. */
   unsigned timeWhenLastPlayedSound = 0; /**< Used to limit frequency of sound playback. */
   bool pathPlannerWasActive = false; /**< Was the path planner active in previous frame? */
@@ -235,12 +240,11 @@ class PathPlannerProvider : public PathPlannerProviderBase
   void update(PathPlanner& pathPlanner) override;
 
   /**
-   * Compute barrier lines that cannot be crossed during planning.
-   * @param target The target the robot tries to reach.
+   * Compute barrier lines that cannot be crossed during planning between the start pose and the targets.
    * @param excludeOwnPenaltyArea Also generate barriers for the own penalty area.
    * @param excludeOpponentPenaltyArea Also generate barriers for the opponent penalty area.
    */
-  void createBarriers(const Pose2f& target, bool excludeOwnPenaltyArea, bool excludeOpponentPenaltyArea);
+  void createBarriers(bool excludeOwnPenaltyArea, bool excludeOpponentPenaltyArea);
 
   /**
    * Clip penalty area barriers to make a position reachable.
@@ -252,12 +256,18 @@ class PathPlannerProvider : public PathPlannerProviderBase
   void clipPenaltyArea(const Vector2f& position, float& left, float& right, float& front) const;
 
   /**
-   * Create the nodes from obstacles.
-   * @param target The target the robot tries to reach.
+   * Create the nodes from the start pose, the targets and the obstacles.
    * @param excludeOwnPenaltyArea Filter out obstacles inside the own penalty area and the own goal.
    * @param excludeOpponentPenaltyArea Filter out obstacles inside the opponents penalty area and the own goal.
    */
-  void createNodes(const Pose2f& target, bool excludeOwnPenaltyArea, bool excludeOpponentPenaltyArea);
+  void createNodes(bool excludeOwnPenaltyArea, bool excludeOpponentPenaltyArea);
+
+  /**
+   * Is a position one of the targets of the current query?
+   * @param position The position in field coordinates.
+   * @return Is it closer than 1 mm to one of the targets?
+   */
+  bool isTarget(const Vector2f& position) const;
 
   /**
    * Determine the radius of an obstacle.
@@ -281,14 +291,21 @@ class PathPlannerProvider : public PathPlannerProviderBase
    */
   void plan(Node& from, Node& to, float speedRatio);
 
+  /**
+   * Plan shortest paths to all targets in a single Dijkstra search. The results can be tracked backwards from the target nodes.
+   * @param from The starting node. It is implicitly assumed that this is also the first entry in the vector "nodes".
+   * @param speedRatio The ratio between forward speed and turn speed.
+   */
+  void planToAll(Node& from, float speedRatio);
+
   /**
    * Expand a node during the A* search and add all suitable outgoing edges to the set of open edges.
    * @param node The node that is expanded.
-   * @param to The overall target node. Required to calculate the heuristic.
+   * @param to The overall target node. Required to calculate the heuristic. If nullptr, no heuristic is used.
    * @param rotation Only the outgoing edges with the same rotation are expanded.
    * @param speedRatio The ratio between forward speed and turn speed.
    */
-  void expand(Node& node, const Node& to, Rotation rotation, float speedRatio);
+  void expand(Node& node, const Node* to, Rotation rotation, float speedRatio);
 
   /**
    * Find all nodes reachable from this node without intersecting with other nodes, i.e. determine the outgoing edges.
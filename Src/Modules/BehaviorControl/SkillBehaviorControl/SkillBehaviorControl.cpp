@@ -55,6 +55,14 @@ void SkillBehaviorControl::update(ActivationGraph&)
   DECLARE_DEBUG_DRAWING("option:Zweikampf:sidewardRange", "drawingOnField");
   DECLARE_DEBUG_DRAWING("option:Zweikampf:sideSteal", "drawingOnField");
 
+  DEBUG_RESPONSE_ONCE("module:SkillBehaviorControl:memos")
+  {
+    const auto print = [](const auto& memo) {OUTPUT_TEXT(memo.name << ": " << memo.hits << " hits, " << memo.misses << " misses");};
+    print(opponentSectors);
+    print(passRatings);
+    print(goalRatings);
+  }
+
   theBehaviorStatus.calibrationFinished = false;
   theBehaviorStatus.passTarget = -1;
   theBehaviorStatus.passOrigin = -1;
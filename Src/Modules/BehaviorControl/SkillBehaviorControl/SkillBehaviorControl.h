@@ -71,7 +71,9 @@
 #include "Representations/Sensing/FallDownState.h"
 #include "Representations/Sensing/FootBumperState.h"
 #include "Representations/Sensing/IMUValueState.h"
+#include "Tools/BehaviorControl/FrameMemo.h"
 #include "Tools/BehaviorControl/HeadOrientation.h"
+#include "Tools/BehaviorControl/SectorWheel.h"
 #include "Tools/BehaviorControl/Strategy/PositionRole.h"
 #include "Tools/Motion/ReduceWalkSpeedType.h"
 #include "Debugging/Annotation.h"
@@ -228,6 +230,10 @@ protected:
   MotionRequest theMotionRequest; /**< The motion request that is modified by the behavior. */
   OptionalImageRequest theOptionalImageRequest; /**< The request that decides whether an optional image should be send or not */
 
+  FrameMemo<Vector2f, std::list<SectorWheel::Sector>> opponentSectors{"opponentSectors"}; /**< The sectors blocked by opponents as seen from a ball position. */
+  FrameMemo<std::pair<Vector2f, Vector2f>, float> passRatings{"passRatings"}; /**< The pass ratings (see PassEvaluation, not positioning) of origins and targets. */
+  FrameMemo<Vector2f, float> goalRatings{"goalRatings"}; /**< The goal ratings (see ExpectedGoals, not positioning) of positions. */
+
 #include "Options/Options.h"
 #include "Skills/Arms/Arms.h"
 #include "Skills/Ball/Ball.h"
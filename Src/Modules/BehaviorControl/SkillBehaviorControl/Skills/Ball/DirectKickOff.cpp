@@ -81,26 +81,30 @@ option((SkillBehaviorControl) DirectKickOff,
         // Sort obstacles according to their absolute x coordinate (to ease culling later on).
         std::sort(obstacleSectors.begin(), obstacleSectors.end(), [](const ObstacleSector& s1, const ObstacleSector& s2) { return s1.x < s2.x; });
 
-        SectorWheel wheel;
-        std::list<SectorWheel::Sector> sectors;
-        bool isLargeEnough = false;
-        do
+        const auto isLargeEnough = [&](const std::list<SectorWheel::Sector>& sectors)
         {
-          wheel.begin(theFieldBall.positionOnField);
-          wheel.addSector(Rangea(-halfGoalSectorAngle, halfGoalSectorAngle), 2.f * theKickInfo[KickInfo::walkForwardsLeftAlternative].range.max, SectorWheel::Sector::goal);
-          for(const ObstacleSector& obstacleSector : obstacleSectors)
-            wheel.addSector(obstacleSector.sector, obstacleSector.distance, SectorWheel::Sector::obstacle);
-          sectors = wheel.finish();
-
           for(const SectorWheel::Sector& sector : sectors)
             if(sector.type == SectorWheel::Sector::goal &&
                sector.angleRange.getSize() >= ((wasActive && sector.angleRange.isInside(targetAngle)) ? Angle(minOpeningAngle * 0.5f) : minOpeningAngle))
-            {
-              isLargeEnough = true;
+              return true;
+          return false;
+        };
+
+        // Obstacles are only added as long as the goal sector stays open enough. Since adding an obstacle can only
+        // shrink goal sectors, the wheel is extended incrementally instead of being rebuilt for each number of culled obstacles.
+        SectorWheel wheel;
+        wheel.begin(theFieldBall.positionOnField);
+        wheel.addSector(Rangea(-halfGoalSectorAngle, halfGoalSectorAngle), 2.f * theKickInfo[KickInfo::walkForwardsLeftAlternative].range.max, SectorWheel::Sector::goal);
+        std::list<SectorWheel::Sector> sectors = SectorWheel(wheel).finish();
+        if(isLargeEnough(sectors))
+          for(const ObstacleSector& obstacleSector : obstacleSectors)
+          {
+            wheel.addSector(obstacleSector.sector, obstacleSector.distance, SectorWheel::Sector::obstacle);
+            std::list<SectorWheel::Sector> extendedSectors = SectorWheel(wheel).finish();
+            if(!isLargeEnough(extendedSectors))
               break;
-            }
-        }
-        while(!isLargeEnough && !obstacleSectors.empty() && (obstacleSectors.pop_back(), true));
+            sectors = std::move(extendedSectors);
+          }
 
         DRAW_SECTOR_WHEEL("option:DirectKickOff:wheel", sectors, theFieldBall.endPositionOnField);
 
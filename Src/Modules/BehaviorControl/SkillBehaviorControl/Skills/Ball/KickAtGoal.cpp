@@ -207,26 +207,34 @@ option((SkillBehaviorControl) KickAtGoal,
                                 (1.f - cullFactor) * theFieldDimensions.xPosOpponentPenaltyMark;
       LINE("option:KickAtGoal:cullLine", cullBeyondX, theFieldDimensions.yPosLeftTouchline, cullBeyondX, theFieldDimensions.yPosRightTouchline, 10, Drawings::solidPen, ColorRGBA::black);
 
-      SectorWheel wheel;
-      std::list<SectorWheel::Sector> sectors;
-      bool isLargeEnough = false;
-      do
+      const auto isLargeEnough = [&](const std::list<SectorWheel::Sector>& sectors)
       {
-        wheel.begin(theFieldInterceptBall.interceptedEndPositionOnField);
-        wheel.addSector(Rangea(angleToRightPost, angleToLeftPost), std::numeric_limits<float>::max(), SectorWheel::Sector::goal);
-        for(const ObstacleSector& obstacleSector : obstacleSectors)
-          wheel.addSector(obstacleSector.sector, obstacleSector.distance, SectorWheel::Sector::obstacle);
-        sectors = wheel.finish();
-
         for(const SectorWheel::Sector& sector : sectors)
           if(sector.type == SectorWheel::Sector::goal &&
              sector.angleRange.getSize() >= ((lastAimingAtGoal && sector.angleRange.isInside(lastTargetAngleOnField)) ? Angle(minOpeningAngle * 0.5f) : minOpeningAngle))
-          {
-            isLargeEnough = true;
+            return true;
+        return false;
+      };
+
+      // Obstacles up to cullBeyondX are always considered. The others are only added as long as the goal stays open
+      // enough. Since adding an obstacle can only shrink goal sectors, the wheel is extended incrementally instead of
+      // being rebuilt for each number of culled obstacles.
+      SectorWheel wheel;
+      wheel.begin(theFieldInterceptBall.interceptedEndPositionOnField);
+      wheel.addSector(Rangea(angleToRightPost, angleToLeftPost), std::numeric_limits<float>::max(), SectorWheel::Sector::goal);
+      auto obstacleSector = obstacleSectors.begin();
+      for(; obstacleSector != obstacleSectors.end() && obstacleSector->x <= cullBeyondX; ++obstacleSector)
+        wheel.addSector(obstacleSector->sector, obstacleSector->distance, SectorWheel::Sector::obstacle);
+      std::list<SectorWheel::Sector> sectors = SectorWheel(wheel).finish();
+      if(isLargeEnough(sectors))
+        for(; obstacleSector != obstacleSectors.end(); ++obstacleSector)
+        {
+          wheel.addSector(obstacleSector->sector, obstacleSector->distance, SectorWheel::Sector::obstacle);
+          std::list<SectorWheel::Sector> extendedSectors = SectorWheel(wheel).finish();
+          if(!isLargeEnough(extendedSectors))
             break;
-          }
-      }
-      while(!isLargeEnough && !obstacleSectors.empty() && obstacleSectors.back().x > cullBeyondX && (obstacleSectors.pop_back(), true));
+          sectors = std::move(extendedSectors);
+        }
 
       DRAW_SECTOR_WHEEL("option:KickAtGoal:wheel", sectors, theFieldInterceptBall.interceptedEndPositionOnField);
 
@@ -135,24 +135,27 @@ option((SkillBehaviorControl) PassToTeammate,
   };
 
   // Calculates the angular sectors of the known opponents from the obstacle model.
-  const auto calculateObstacleSectors = [&](const Vector2f& ballPositionOnField) -> std::list<SectorWheel::Sector>
+  const auto calculateObstacleSectors = [&](const Vector2f& ballPositionOnField) -> const std::list<SectorWheel::Sector>&
   {
-    SectorWheel sectorWheel;
-    sectorWheel.begin(ballPositionOnField);
-    for(const auto& obstacle : theGlobalOpponentsModel.opponents)
+    return opponentSectors.get(theFrameInfo.time, ballPositionOnField, [&]
     {
-      const Vector2f& obstacleOnField = obstacle.position;
-      if(obstacleOnField.x() > (theFieldDimensions.xPosOpponentGoalLine + theFieldDimensions.xPosOpponentGoal) * 0.5f)
-        continue;
-      const float obstacleWidth = (obstacle.left - obstacle.right).norm() + 4.f * theBallSpecification.radius;
-      const float obstacleDistance = std::sqrt(std::max((obstacleOnField - ballPositionOnField).squaredNorm() - sqr(obstacleWidth / 2.f), 1.f));
-      if(obstacleDistance < theBallSpecification.radius)
-        continue;
-      const float obstacleRadius = std::atan(obstacleWidth / (2.f * obstacleDistance));
-      const Angle obstacleDirection = (obstacleOnField - ballPositionOnField).angle();
-      sectorWheel.addSector(Rangea(Angle::normalize(obstacleDirection - obstacleRadius), Angle::normalize(obstacleDirection + obstacleRadius)), obstacleDistance, SectorWheel::Sector::obstacle);
-    }
-    return sectorWheel.finish();
+      SectorWheel sectorWheel;
+      sectorWheel.begin(ballPositionOnField);
+      for(const auto& obstacle : theGlobalOpponentsModel.opponents)
+      {
+        const Vector2f& obstacleOnField = obstacle.position;
+        if(obstacleOnField.x() > (theFieldDimensions.xPosOpponentGoalLine + theFieldDimensions.xPosOpponentGoal) * 0.5f)
+          continue;
+        const float obstacleWidth = (obstacle.left - obstacle.right).norm() + 4.f * theBallSpecification.radius;
+        const float obstacleDistance = std::sqrt(std::max((obstacleOnField - ballPositionOnField).squaredNorm() - sqr(obstacleWidth / 2.f), 1.f));
+        if(obstacleDistance < theBallSpecification.radius)
+          continue;
+        const float obstacleRadius = std::atan(obstacleWidth / (2.f * obstacleDistance));
+        const Angle obstacleDirection = (obstacleOnField - ballPositionOnField).angle();
+        sectorWheel.addSector(Rangea(Angle::normalize(obstacleDirection - obstacleRadius), Angle::normalize(obstacleDirection + obstacleRadius)), obstacleDistance, SectorWheel::Sector::obstacle);
+      }
+      return sectorWheel.finish();
+    });
   };
 
   // Calculates the angle inside a range that is closest in the (counter)clockwise direction. If the angle range is too small, its center is used.
@@ -250,8 +253,10 @@ option((SkillBehaviorControl) PassToTeammate,
     // Rating of deviation of new angle to the original angle.
     const Angle maxAngleDeviation = isIdealSide ? maxAngleOffset : maxAngleOffsetBehind;
     const float offsetRating = mapToRange(targetAngle.diffAbs(candidateAngle), 0_deg, maxAngleDeviation, isIdealSide ? Angle(1.f) : Angle(0.6f), 0_deg);
-    const float positionRating = thePassEvaluation.getRating(theFieldBall.recentBallPositionOnField(), targetPosition, false);
-    const float goalRating = theExpectedGoals.getRating(targetPosition, false);
+    const Vector2f recentBallPositionOnField = theFieldBall.recentBallPositionOnField();
+    const float positionRating = passRatings.get(theFrameInfo.time, {recentBallPositionOnField, targetPosition},
+                                                 [&] {return thePassEvaluation.getRating(recentBallPositionOnField, targetPosition, false);});
+    const float goalRating = goalRatings.get(theFrameInfo.time, targetPosition, [&] {return theExpectedGoals.getRating(targetPosition, false);});
     const float combinedRating = offsetRating * positionRating * goalRating;
     COMPLEX_DRAWING("option:PassToTeammate:evaluation")
     {
@@ -342,7 +347,9 @@ option((SkillBehaviorControl) PassToTeammate,
       const float stateProgress = static_cast<float>(timeInState) / static_cast<float>(totalStateTime);
       interpolatedRatingThreshold *= (1.f - clip(stateProgress, 0.f, 1.f));
     }
-    isTargetFree = thePassEvaluation.getRating(theFieldBall.recentBallPositionOnField(), kickTarget, false) > std::max(interpolatedRatingThreshold, minRating);
+    const Vector2f recentBallPositionOnField = theFieldBall.recentBallPositionOnField();
+    isTargetFree = passRatings.get(theFrameInfo.time, {recentBallPositionOnField, kickTarget},
+                                   [&] {return thePassEvaluation.getRating(recentBallPositionOnField, kickTarget, false);}) > std::max(interpolatedRatingThreshold, minRating);
   };
 
   const auto updateKickParameters = [&]
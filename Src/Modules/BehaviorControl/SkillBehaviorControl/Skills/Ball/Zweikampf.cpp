@@ -20,6 +20,7 @@
  */
 
 #include "SkillBehaviorControl.h"
+#include "Framework/FrameArena.h"
 #include "Framework/ModuleGraphRunner.h"
 #include "Platform/SystemCall.h"
 #include "Tools/BehaviorControl/SectorWheel.h"
@@ -709,6 +710,18 @@ option((SkillBehaviorControl) Zweikampf,
 
     const float rangeHysteresis = !isGoalAngle || theDuelPose.kickType != kickType || theKickInfo[theDuelPose.kickType].walkKickType == WalkKicks::forwardSteal ? 0.f : lastKickHysteresis.kickLengthHysteresis * (1.f - Rangef::ZeroOneRange().limit(std::abs(Angle::normalize(theDuelPose.kickAngle - kickAngle)) / lastKickHysteresis.kickDirectionHysteresis));
 
+    // 8.4.5. Skip kicks that cannot reach the type of the best kick found so far before rating them
+    // The type is already known here, except whether the kick becomes a pass or not, which needs the rating (see 8.4.9 and 8.4.12)
+    const float goalShotHysteresis = theDuelPose.type == TargetType::goalShot ? rangeHysteresis : 0.f;
+    const bool reachesGoal = isGoalAngle && rangeForGoal < dribbleRange + useKickRange.max + goalShotHysteresis;
+    if(reachesGoal && !theIndirectKick.allowDirectKick)
+      return false;
+    const TargetType bestPossibleType = kickType == KickInfo::walkForwardStealBallLeft || kickType == KickInfo::walkForwardStealBallRight ? TargetType::stealBall :
+                                        !reachesGoal ? TargetType::pass :
+                                        rangeForGoal > useKickRange.max + goalShotHysteresis ? TargetType::goalDribbleShot : TargetType::goalShot;
+    if(bestPossibleType > highestTargetType)
+      return false;
+
     // 8.4.7. The robot needs to turn too much
     // Add range minmax, to prevent robot doing stupid kick angles when chasing opponent
     // needs to be in relative rotation, but based on world rotation
@@ -1004,7 +1017,7 @@ option((SkillBehaviorControl) Zweikampf,
   /**
    * Draw the ratings of the best types
    */
-  const auto drawRating = [&](std::vector<DuelPose>& duelPoses)
+  const auto drawRating = [&](FrameVector<DuelPose>& duelPoses)
   {
     Rangef minMaxDrawRatings(-1.f, 1.f); // Reset
     for(DuelPose& pose : duelPoses)
@@ -1270,7 +1283,7 @@ option((SkillBehaviorControl) Zweikampf,
     DuelPose lastDuelPose = theDuelPose;
     std::vector<Angle> directionPossibilities;
     Angle minMaxAngle;
-    std::vector<std::vector<DuelPose>> duelPoses;
+    FrameVector<FrameVector<DuelPose>> duelPoses;
     for(std::size_t i = 0; i < TargetType::numOfTargetTypes; i++)
       duelPoses.emplace_back();
 
@@ -1433,7 +1446,8 @@ option((SkillBehaviorControl) Zweikampf,
     }
 
     // 5. Calculate the sector wheel. This is used to help to rate the different kickangles and kick ranges
-    calculateSectorWheel();
+    STOPWATCH("option:Zweikampf:sectorWheel")
+      calculateSectorWheel();
 
     // 5.1 compute whether opponent is part of an obstacle wall
     bool obstacleWallBehindBall = false;
@@ -1531,109 +1545,114 @@ option((SkillBehaviorControl) Zweikampf,
     const float extraGoalRange = (std::abs(dribbleAngle) < 45_deg + (shouldDribble ? 10_deg : 0_deg)) ? 1000.f : 0.f;
 
     // 8. Check every kick angle with every kick
-    for(const Angle& kickAngle : directionPossibilities)
-    {
-      ASSERT(!std::isnan(kickAngle));
-      // 8.1. Get max allowed kick range, before hitting an obstacle or the goal
-      float maxKickRange = std::numeric_limits<float>::max();
-      bool isGoalAngle = false;
-      for(const SectorWheel::Sector& sector : kickAngles)
+    STOPWATCH("option:Zweikampf:rating")
+      for(const Angle& kickAngle : directionPossibilities)
       {
-        if(sector.angleRange.isInside(kickAngle))
+        ASSERT(!std::isnan(kickAngle));
+        // 8.1. Get max allowed kick range, before hitting an obstacle or the goal
+        float maxKickRange = std::numeric_limits<float>::max();
+        bool isGoalAngle = false;
+        for(const SectorWheel::Sector& sector : kickAngles)
         {
-          if(sector.type == SectorWheel::Sector::goal && sector.angleRange.getSize() > searchParameters.goalSectorWidth)
-            isGoalAngle = true;
-          else if(sector.type == SectorWheel::Sector::obstacle)
-            maxKickRange = sector.distance;
-          break;
+          if(sector.angleRange.isInside(kickAngle))
+          {
+            if(sector.type == SectorWheel::Sector::goal && sector.angleRange.getSize() > searchParameters.goalSectorWidth)
+              isGoalAngle = true;
+            else if(sector.type == SectorWheel::Sector::obstacle)
+              maxKickRange = sector.distance;
+            break;
+          }
         }
-      }
 
-      // 8.2. Calculate distance for out of field, if in opponent half
-      float distanceToFieldBorderSquared = std::numeric_limits<float>::max();
+        // Only goal kicks can compete with a goal kick that was already found (see 8.4.5)
+        if(highestPriority <= TargetType::goalDribbleShot && !isGoalAngle)
+          continue;
 
-      if(!isGoalAngle)
-      {
-        Vector2f i1(0.f, 0.f);
-        Vector2f i2(0.f, 0.f);
-        VERIFY(Geometry::getIntersectionPointsOfLineAndRectangle(-opponentHalfFrontLeft, opponentHalfFrontLeft, Geometry::Line(useBallPositionInField, Vector2f(1.f, 0.f).rotated(kickAngle + theRobotPose.rotation)), i1, i2));
-        const Vector2f ballToIntersection1 = i1 - useBallPositionInField;
-        const Vector2f ballToIntersection2 = i2 - useBallPositionInField;
-        // the 5_degs is just a arbitrary number, because the angle to the intersection point is only for a small fraction different to the original kickAngle, resulting from rounding errors.
-        if(std::abs(ballToIntersection1.angle() - (kickAngle + theRobotPose.rotation)) < 5_deg)
-          distanceToFieldBorderSquared = ballToIntersection1.squaredNorm() - sqr(100.f); // 100.f safe distance
-        else if(std::abs(ballToIntersection2.angle() - (kickAngle + theRobotPose.rotation)) < 5_deg)
-          distanceToFieldBorderSquared = ballToIntersection2.squaredNorm() - sqr(100.f); // 100.f safe distance
-      }
+        // 8.2. Calculate distance for out of field, if in opponent half
+        float distanceToFieldBorderSquared = std::numeric_limits<float>::max();
 
-      // 8.2.1 also calculate goal kick range
-      // get the range for a goal kick
-      // otherwise a long kick might overshoot the goal and gets a really bad rating
-      float rangeForGoal = std::numeric_limits<float>::max();
-      if(isGoalAngle && rangeForGoal == std::numeric_limits<float>::max())   // only when goal kick and only check once
-      {
-        Vector2f intersectionPoint;
-        VERIFY(Geometry::getIntersectionOfLines(Geometry::Line(useBallPositionInField, Vector2f::polar(1.f, kickAngle + theRobotPose.rotation)), Geometry::Line(Vector2f(theFieldDimensions.xPosOpponentGoalLine, theFieldDimensions.yPosRightGoal), Vector2f(0.f, 1.f)), intersectionPoint));
-        rangeForGoal = (intersectionPoint - useBallPositionInField).norm() + 0.01f;
-      }
+        if(!isGoalAngle)
+        {
+          Vector2f i1(0.f, 0.f);
+          Vector2f i2(0.f, 0.f);
+          VERIFY(Geometry::getIntersectionPointsOfLineAndRectangle(-opponentHalfFrontLeft, opponentHalfFrontLeft, Geometry::Line(useBallPositionInField, Vector2f(1.f, 0.f).rotated(kickAngle + theRobotPose.rotation)), i1, i2));
+          const Vector2f ballToIntersection1 = i1 - useBallPositionInField;
+          const Vector2f ballToIntersection2 = i2 - useBallPositionInField;
+          // the 5_degs is just a arbitrary number, because the angle to the intersection point is only for a small fraction different to the original kickAngle, resulting from rounding errors.
+          if(std::abs(ballToIntersection1.angle() - (kickAngle + theRobotPose.rotation)) < 5_deg)
+            distanceToFieldBorderSquared = ballToIntersection1.squaredNorm() - sqr(100.f); // 100.f safe distance
+          else if(std::abs(ballToIntersection2.angle() - (kickAngle + theRobotPose.rotation)) < 5_deg)
+            distanceToFieldBorderSquared = ballToIntersection2.squaredNorm() - sqr(100.f); // 100.f safe distance
+        }
 
-      // Check if the kickAngle is inside the side area, used to modify the rating from the potential field
-      const bool isInsideStealBallRange = stealBallMin.contains(kickAngle) || stealBallMax.contains(kickAngle);
-      const bool isTypeStealBall = (stealBallMin != stealBallMax &&
-                                    (isInsideStealBallRange ||  // normal case, kickAngle is/is not in range. Special case: robot is so much rotated, that the ranges are not inside the -180_deg 180_deg range
-                                     (!boundaryCheck.isInside(stealBallMin.min) && (stealBallMin.contains(Angle(kickAngle + 360_deg)) || stealBallMin.contains(Angle(kickAngle - 360_deg)))) ||
-                                     (!boundaryCheck.isInside(stealBallMax.max) && (stealBallMax.contains(Angle(kickAngle + 360_deg)) || stealBallMax.contains(Angle(kickAngle - 360_deg))))));
+        // 8.2.1 also calculate goal kick range
+        // get the range for a goal kick
+        // otherwise a long kick might overshoot the goal and gets a really bad rating
+        float rangeForGoal = std::numeric_limits<float>::max();
+        if(isGoalAngle && rangeForGoal == std::numeric_limits<float>::max())   // only when goal kick and only check once
+        {
+          Vector2f intersectionPoint;
+          VERIFY(Geometry::getIntersectionOfLines(Geometry::Line(useBallPositionInField, Vector2f::polar(1.f, kickAngle + theRobotPose.rotation)), Geometry::Line(Vector2f(theFieldDimensions.xPosOpponentGoalLine, theFieldDimensions.yPosRightGoal), Vector2f(0.f, 1.f)), intersectionPoint));
+          rangeForGoal = (intersectionPoint - useBallPositionInField).norm() + 0.01f;
+        }
 
-      // 8.3. calculate the fieldRating once before hand to save computation time
-      const Vector2f direction = Vector2f::polar(1.f, kickAngle + theRobotPose.rotation);
-      RatingMapVector rangeRatingVector(isTypeStealBall, direction, rangeForGoal, theSkillRequestPose.passTarget, useBallPositionInField);
+        // Check if the kickAngle is inside the side area, used to modify the rating from the potential field
+        const bool isInsideStealBallRange = stealBallMin.contains(kickAngle) || stealBallMax.contains(kickAngle);
+        const bool isTypeStealBall = (stealBallMin != stealBallMax &&
+                                      (isInsideStealBallRange ||  // normal case, kickAngle is/is not in range. Special case: robot is so much rotated, that the ranges are not inside the -180_deg 180_deg range
+                                       (!boundaryCheck.isInside(stealBallMin.min) && (stealBallMin.contains(Angle(kickAngle + 360_deg)) || stealBallMin.contains(Angle(kickAngle - 360_deg)))) ||
+                                       (!boundaryCheck.isInside(stealBallMax.max) && (stealBallMax.contains(Angle(kickAngle + 360_deg)) || stealBallMax.contains(Angle(kickAngle - 360_deg))))));
 
-      // Prepare rating map
-      for(const float range : checkKickDistancesForFR)
-      {
-        if(range > maxKickRange || sqr(range) > distanceToFieldBorderSquared) // every range above will not get executed anyway
-          break;
-        rangeRatingVector.ratingMap.emplace_back();
-        rangeRatingVector.ratingMap.back().range = range;
-      }
-      if(rangeRatingVector.ratingMap.size() == 0)
-        continue;
+        // 8.3. calculate the fieldRating once before hand to save computation time
+        const Vector2f direction = Vector2f::polar(1.f, kickAngle + theRobotPose.rotation);
+        RatingMapVector rangeRatingVector(isTypeStealBall, direction, rangeForGoal, theSkillRequestPose.passTarget, useBallPositionInField);
 
-      // 8.4. check every InWalkKick
-      for(KickInfo::KickType kickType : allowedKicks)
-      {
-        // side kick is not allowed
-        if((kickType == KickInfo::walkSidewardsLeftFootToLeft || kickType == KickInfo::walkSidewardsRightFootToRight) &&
-           ((opponentAndSelfDistanceToBallDiff < 100.f) ||
-            !(forbiddingKickAngle.isInside(kickAngle) || forbiddingKickAngleExtra.isInside(kickAngle))))
+        // Prepare rating map
+        for(const float range : checkKickDistancesForFR)
+        {
+          if(range > maxKickRange || sqr(range) > distanceToFieldBorderSquared) // every range above will not get executed anyway
+            break;
+          rangeRatingVector.ratingMap.emplace_back();
+          rangeRatingVector.ratingMap.back().range = range;
+        }
+        if(rangeRatingVector.ratingMap.size() == 0)
           continue;
 
-        // forwardsteal is not allowed
-        if((kickType == KickInfo::walkForwardStealBallLeft || kickType == KickInfo::walkForwardStealBallRight) &&
-           (stealBallMin != stealBallMax || // we are not on front of the opponent, therefore the walkSteal kick would not work in time
-            (!leftAngleRangeBallToOpponent.isInside(angleFromBallToOpponent) && !obstacleWallBehindBall) || // only if the opponent is standing behind the ball
-            !(rightForwardStealRange.isInside(Angle::normalize(kickAngle + theRobotPose.rotation)) || // only for kicks going to the side
-              leftForwardStealRange.isInside(Angle::normalize(kickAngle + theRobotPose.rotation))) || // only for kicks going to the side
-            opponentAndSelfDistanceToBallDiff > obstacleHandling.maxObstacleDistanceForWalkStealBallKick)) // only if the opponent is closer to the ball
-          continue;
-        DuelPose pose;
-        const bool possible = getDuelRating(kickType, kickAngle, pose,
-                                            minMaxAngle, isGoalAngle,
-                                            maxKickRange, distanceToFieldBorderSquared,
-                                            stealBallMin, stealBallMax,
-                                            angleFromBallToOpponent,
-                                            rangeRatingVector, rangeForGoal,
-                                            angleFromGoalToBall, isTypeStealBall, highestPriority,
-                                            nearOwnGoalScaling, forbiddingKickAngle, extraGoalRange);
-        if(!possible)
-          continue;
-        duelPoses[pose.type].push_back(pose);
-        highestPriority = std::min(highestPriority, pose.type);
+        // 8.4. check every InWalkKick
+        for(KickInfo::KickType kickType : allowedKicks)
+        {
+          // side kick is not allowed
+          if((kickType == KickInfo::walkSidewardsLeftFootToLeft || kickType == KickInfo::walkSidewardsRightFootToRight) &&
+             ((opponentAndSelfDistanceToBallDiff < 100.f) ||
+              !(forbiddingKickAngle.isInside(kickAngle) || forbiddingKickAngleExtra.isInside(kickAngle))))
+            continue;
+
+          // forwardsteal is not allowed
+          if((kickType == KickInfo::walkForwardStealBallLeft || kickType == KickInfo::walkForwardStealBallRight) &&
+             (stealBallMin != stealBallMax || // we are not on front of the opponent, therefore the walkSteal kick would not work in time
+              (!leftAngleRangeBallToOpponent.isInside(angleFromBallToOpponent) && !obstacleWallBehindBall) || // only if the opponent is standing behind the ball
+              !(rightForwardStealRange.isInside(Angle::normalize(kickAngle + theRobotPose.rotation)) || // only for kicks going to the side
+                leftForwardStealRange.isInside(Angle::normalize(kickAngle + theRobotPose.rotation))) || // only for kicks going to the side
+              opponentAndSelfDistanceToBallDiff > obstacleHandling.maxObstacleDistanceForWalkStealBallKick)) // only if the opponent is closer to the ball
+            continue;
+          DuelPose pose;
+          const bool possible = getDuelRating(kickType, kickAngle, pose,
+                                              minMaxAngle, isGoalAngle,
+                                              maxKickRange, distanceToFieldBorderSquared,
+                                              stealBallMin, stealBallMax,
+                                              angleFromBallToOpponent,
+                                              rangeRatingVector, rangeForGoal,
+                                              angleFromGoalToBall, isTypeStealBall, highestPriority,
+                                              nearOwnGoalScaling, forbiddingKickAngle, extraGoalRange);
+          if(!possible)
+            continue;
+          duelPoses[pose.type].push_back(pose);
+          highestPriority = std::min(highestPriority, pose.type);
+        }
       }
-    }
 
     // Find duelPose list with highest priority. GoalShots > StealBall > Pass > Others
-    std::vector<DuelPose>* toBeCheckDuelPoses = nullptr;
+    FrameVector<DuelPose>* toBeCheckDuelPoses = nullptr;
     TargetType targetType = static_cast<TargetType>(0);
     for(auto& vec : duelPoses)
     {
@@ -1695,72 +1714,75 @@ option((SkillBehaviorControl) Zweikampf,
       if(theKickInfo[theDuelPose.kickType].walkKickType == WalkKicks::forwardSteal)
         lastForwardSteal = theFrameInfo.time;
 
-      // 11.2 filter the sector wheel and ignore all obstacles, that are further away than the kick range
-      const SectorWheel::Sector* sectorRef = nullptr;
-      SectorWheel filteredWheel;
-      filteredWheel.begin(useBallPositionInField);
-      std::vector<Rangea> goalSectors;
-      Vector2f intersectionPoint;
-      VERIFY(Geometry::getIntersectionOfLines(Geometry::Line(useBallPositionInField, Vector2f::polar(1.f, (Vector2f(theFieldDimensions.xPosOpponentGoal, 0.f) - useBallPositionInField).angle())), Geometry::Line(Vector2f(theFieldDimensions.xPosOpponentGoalLine, theFieldDimensions.yPosRightGoal), Vector2f(0.f, 1.f)), intersectionPoint));
-      const float rangeForGoal = (intersectionPoint - useBallPositionInField).norm() + 0.01f;
-      for(const SectorWheel::Sector& sector : kickAngles)
-      {
-        if((sector.type == SectorWheel::Sector::obstacle && sector.distance - 500.f < theDuelPose.range) ||
-           (sector.type == SectorWheel::Sector::goal && theDuelPose.type == TargetType::goalShot) || // only add goal sector if we have a goalShot. Otherwise the goal sector does not matter
-           (sector.type == SectorWheel::Sector::goal && !theIndirectKick.allowDirectKick && theDuelPose.range + 1000.f > rangeForGoal))
-          filteredWheel.addSector(sector.angleRange, sector.distance, sector.type);
-        if(sector.type == SectorWheel::Sector::goal)
-          goalSectors.push_back(sector.angleRange);
-      }
-      std::list<SectorWheel::Sector> filteredSectors = filteredWheel.finish();
-
-      for(const SectorWheel::Sector& sector : filteredSectors)
+      STOPWATCH("option:Zweikampf:precision")
       {
-        if(sector.angleRange.isInside(theDuelPose.kickAngle))
+        // 11.2 filter the sector wheel and ignore all obstacles, that are further away than the kick range
+        const SectorWheel::Sector* sectorRef = nullptr;
+        SectorWheel filteredWheel;
+        filteredWheel.begin(useBallPositionInField);
+        std::vector<Rangea> goalSectors;
+        Vector2f intersectionPoint;
+        VERIFY(Geometry::getIntersectionOfLines(Geometry::Line(useBallPositionInField, Vector2f::polar(1.f, (Vector2f(theFieldDimensions.xPosOpponentGoal, 0.f) - useBallPositionInField).angle())), Geometry::Line(Vector2f(theFieldDimensions.xPosOpponentGoalLine, theFieldDimensions.yPosRightGoal), Vector2f(0.f, 1.f)), intersectionPoint));
+        const float rangeForGoal = (intersectionPoint - useBallPositionInField).norm() + 0.01f;
+        for(const SectorWheel::Sector& sector : kickAngles)
         {
-          sectorRef = &sector;
-          break;
+          if((sector.type == SectorWheel::Sector::obstacle && sector.distance - 500.f < theDuelPose.range) ||
+             (sector.type == SectorWheel::Sector::goal && theDuelPose.type == TargetType::goalShot) || // only add goal sector if we have a goalShot. Otherwise the goal sector does not matter
+             (sector.type == SectorWheel::Sector::goal && !theIndirectKick.allowDirectKick && theDuelPose.range + 1000.f > rangeForGoal))
+            filteredWheel.addSector(sector.angleRange, sector.distance, sector.type);
+          if(sector.type == SectorWheel::Sector::goal)
+            goalSectors.push_back(sector.angleRange);
         }
-      }
-      Rangea precision(0_deg, 0_deg);
-      // 11.3. Calculate the precision range
-      if(sectorRef != nullptr)
-      {
-        precision = sectorRef->angleRange;
-        Rangea borderToMinMax = precision;
-
-        borderToMinMax.min = borderToMinMax.min + 5_deg;
-        borderToMinMax.max = borderToMinMax.max - 5_deg;
+        std::list<SectorWheel::Sector> filteredSectors = filteredWheel.finish();
 
-        if(precision.max < precision.min)
+        for(const SectorWheel::Sector& sector : filteredSectors)
         {
-          if(theDuelPose.kickAngle > precision.min)
-            borderToMinMax.max = 180_deg;
-          else
-            borderToMinMax.min = -180_deg;
+          if(sector.angleRange.isInside(theDuelPose.kickAngle))
+          {
+            sectorRef = &sector;
+            break;
+          }
         }
-        borderToMinMax = Rangea(std::min(theDuelPose.kickAngle, borderToMinMax.min),
-                                std::max(theDuelPose.kickAngle, borderToMinMax.max));
-        const Angle searchOffset = theKickInfo[theDuelPose.kickType].walkKickType != WalkKicks::forwardSteal && soonCloseRangeDuel ? 90_deg : 5_deg;
-        precision.max = std::max(0.f, borderToMinMax.limit(theDuelPose.kickAngle + searchOffset) - theDuelPose.kickAngle);
-        precision.min = std::min(0.f, borderToMinMax.limit(theDuelPose.kickAngle - searchOffset) - theDuelPose.kickAngle);
-      }
-
-      if(bonusForStealBall)
-      {
-        if((duelObstacle.center - useBallPositionRelative).angle() < 0)
+        Rangea precision(0_deg, 0_deg);
+        // 11.3. Calculate the precision range
+        if(sectorRef != nullptr)
         {
-          const Angle minAngle = 90_deg - theRobotPose.rotation;
-          precision.min = std::min(Angle(minAngle - theDuelPose.kickAngle), precision.min);
+          precision = sectorRef->angleRange;
+          Rangea borderToMinMax = precision;
+
+          borderToMinMax.min = borderToMinMax.min + 5_deg;
+          borderToMinMax.max = borderToMinMax.max - 5_deg;
+
+          if(precision.max < precision.min)
+          {
+            if(theDuelPose.kickAngle > precision.min)
+              borderToMinMax.max = 180_deg;
+            else
+              borderToMinMax.min = -180_deg;
+          }
+          borderToMinMax = Rangea(std::min(theDuelPose.kickAngle, borderToMinMax.min),
+                                  std::max(theDuelPose.kickAngle, borderToMinMax.max));
+          const Angle searchOffset = theKickInfo[theDuelPose.kickType].walkKickType != WalkKicks::forwardSteal && soonCloseRangeDuel ? 90_deg : 5_deg;
+          precision.max = std::max(0.f, borderToMinMax.limit(theDuelPose.kickAngle + searchOffset) - theDuelPose.kickAngle);
+          precision.min = std::min(0.f, borderToMinMax.limit(theDuelPose.kickAngle - searchOffset) - theDuelPose.kickAngle);
         }
-        else
+
+        if(bonusForStealBall)
         {
-          const Angle maxAngle = -90_deg - theRobotPose.rotation;
-          precision.max = std::max(Angle(maxAngle - theDuelPose.kickAngle), precision.max);
+          if((duelObstacle.center - useBallPositionRelative).angle() < 0)
+          {
+            const Angle minAngle = 90_deg - theRobotPose.rotation;
+            precision.min = std::min(Angle(minAngle - theDuelPose.kickAngle), precision.min);
+          }
+          else
+          {
+            const Angle maxAngle = -90_deg - theRobotPose.rotation;
+            precision.max = std::max(Angle(maxAngle - theDuelPose.kickAngle), precision.max);
+          }
         }
+        calculateSectorUntilFieldBorder(precision, theDuelPose.kickAngle, theDuelPose.range, useBallPositionInField, goalSectors);
+        theDuelPose.precision = precision;
       }
-      calculateSectorUntilFieldBorder(precision, theDuelPose.kickAngle, theDuelPose.range, useBallPositionInField, goalSectors);
-      theDuelPose.precision = precision;
     }
     else
     {
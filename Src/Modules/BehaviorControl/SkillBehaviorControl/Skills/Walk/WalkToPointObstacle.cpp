@@ -43,17 +43,20 @@ option((SkillBehaviorControl) WalkToPointObstacle,
     evalPoints.push_back(circle.center - relativeObstacleShiftVector.rotated(90_deg));
     evalPoints.push_back(circle.center - relativeObstacleShiftVector.rotated(-90_deg));
 
+    std::vector<Vector2f> evalPointsOnField;
+    for(const auto& vec : evalPoints)
+      evalPointsOnField.push_back(theRobotPose * vec);
+    std::vector<float> ratings;
+    theExpectedGoals.getRatings(evalPointsOnField, false, ratings);
+
     shiftedTarget = target;
     float bestRating = -1;
-    for(const auto& vec : evalPoints)
-    {
-      const float rating = theExpectedGoals.getRating(theRobotPose * vec, false);
-      if(rating > bestRating)
+    for(std::size_t i = 0; i < evalPoints.size(); ++i)
+      if(ratings[i] > bestRating)
       {
-        shiftedTarget->translation = vec;
-        bestRating = rating;
+        shiftedTarget->translation = evalPoints[i];
+        bestRating = ratings[i];
       }
-    }
     shiftedTarget->translation = theRobotPose * shiftedTarget->translation;
     shiftedTarget->rotation += theRobotPose.rotation;
   };
@@ -9,7 +9,11 @@
 #include "BallSearch.h"
 
 BallSearch::BallSearch() :
+#if !defined TARGET_ROBOT || !defined NDEBUG
   Cabsl(&activationGraph)
+#else
+  Cabsl(nullptr) // The graph could not be inspected anyway, because MODIFY is disabled.
+#endif
 {
 }
 
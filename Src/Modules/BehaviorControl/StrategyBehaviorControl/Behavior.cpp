@@ -662,6 +662,7 @@ void Behavior::assignPositions(Tactic::Type tactic, SetPlay::Type setPlay, std::
 
     std::array<std::vector<std::size_t>, 2> bestAssignment;
     std::array<std::vector<float>, 2> bestAssignmentCost;
+    std::vector<float> assignmentCost;
     // In some cases, we could already know that one of the mirror variants is not going to be used.
     // But you know what they say about premature optimization...
     for(bool mirrored : {false, true})
@@ -700,7 +701,22 @@ void Behavior::assignPositions(Tactic::Type tactic, SetPlay::Type setPlay, std::
             if(startPositionAgent != assignment.end() && costMatrix(startPositionAgent - assignment.begin(), startPositionIndex) > startPositionCost)
               continue;
           }
-          const std::vector<float> assignmentCost = getAssignmentCost(costMatrix, assignment);
+          if(!bestAssignmentCost[mirrored].empty())
+          {
+            // The cost vectors are sorted in descending order. Therefore, an assignment in which any agent has a higher cost
+            // than the maximum cost of the best assignment so far cannot be better. This also holds for all other orderings
+            // that share the prefix up to that agent, so they are skipped by arranging the rest as the last of them.
+            const float maxCost = bestAssignmentCost[mirrored].front();
+            std::size_t i = 0;
+            while(i < assignment.size() && costMatrix(i, assignment[i]) <= maxCost)
+              ++i;
+            if(i < assignment.size())
+            {
+              std::sort(assignment.begin() + i + 1, assignment.end(), std::greater<>());
+              continue;
+            }
+          }
+          getAssignmentCost(costMatrix, assignment, assignmentCost);
           if(bestAssignmentCost[mirrored].empty() ||
              std::lexicographical_compare(assignmentCost.begin(), assignmentCost.end(), bestAssignmentCost[mirrored].begin(), bestAssignmentCost[mirrored].end()))
           {
@@ -945,14 +961,13 @@ void Behavior::updateBallXTimestamps()
       ballXTimestamp.second.lastTimeWhenNotAhead = ballXTimestamp.second.lastTimeWhenNotBehind = theFrameInfo.time;
 }
 
-std::vector<float> Behavior::getAssignmentCost(const Eigen::MatrixXf& costMatrix, const std::vector<std::size_t>& positionIndices)
+void Behavior::getAssignmentCost(const Eigen::MatrixXf& costMatrix, const std::vector<std::size_t>& positionIndices, std::vector<float>& result)
 {
-  std::vector<float> result(positionIndices.size());
+  result.resize(positionIndices.size());
   ASSERT(positionIndices.size() == static_cast<std::size_t>(costMatrix.rows()));
   for(std::size_t i = 0; i < result.size(); ++i)
     result[i] = costMatrix(i, positionIndices[i]);
   std::sort(result.begin(), result.end(), std::greater<>());
-  return result;
 }
 
 const Agent* Behavior::determineActiveAgent(Agent& self, const std::vector<const Agent*>& otherAgents, bool assign) const
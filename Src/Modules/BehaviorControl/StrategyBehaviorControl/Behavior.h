@@ -118,9 +118,9 @@ private:
    * Calculates the cost vector of assigning agent i to position positionIndices[i] with a given cost matrix.
    * @param costMatrix A matrix where the rows are agents and the columns are positions.
    * @param positionIndices The position indices per agent which represent the assignment to test.
-   * @return The cost vector for this assignment.
+   * @param result The cost vector for this assignment (sorted in descending order).
    */
-  static std::vector<float> getAssignmentCost(const Eigen::MatrixXf& costMatrix, const std::vector<std::size_t>& positionIndices);
+  static void getAssignmentCost(const Eigen::MatrixXf& costMatrix, const std::vector<std::size_t>& positionIndices, std::vector<float>& result);
 
   /**
    * Determines the agent which should have an active role.
@@ -39,14 +39,24 @@ Pose2f RatingRole::position(Side, const Pose2f& basePose, const std::vector<Vect
   Geometry::clipPointInsideConvexPolygon(region, randomPos);
 
   // Get pos with best rating
-  const float oldPosRating = rating(pos) * p.lastPosBonus;
+  const float oldPosRating = rating(pos);
   const float robotPoseRating = rating(theRobotPose.translation);
   const float randomPoseRating = rating(randomPos);
-  pos = oldPosRating > robotPoseRating && oldPosRating > randomPoseRating ?
-        pos :
-        (robotPoseRating > randomPoseRating ? theRobotPose.translation : randomPos);
+  float posRating;
+  if(oldPosRating * p.lastPosBonus > robotPoseRating && oldPosRating * p.lastPosBonus > randomPoseRating)
+    posRating = oldPosRating;
+  else if(robotPoseRating > randomPoseRating)
+  {
+    pos = theRobotPose.translation;
+    posRating = robotPoseRating;
+  }
+  else
+  {
+    pos = randomPos;
+    posRating = randomPoseRating;
+  }
 
-  gradientAscent(pos, p.numIterations);
+  gradientAscent(pos, p.numIterations, posRating);
 
   const Angle rotation = KickSelection::calculateTargetRotation(ball, pos, opponentGoal);
   positionBuffer.push_front(pos);
@@ -113,20 +123,21 @@ void RatingRole::reset()
   positionBuffer.clear();
 }
 
-void RatingRole::gradientAscent(Vector2f& pos, int numIterations) const
+void RatingRole::gradientAscent(Vector2f& pos, int numIterations, float value) const
 {
   const Vector2f originalPos = pos;
   float ratio = 1.f;
   float d = p.delta;
   const float ratioReduction = 1.f / numIterations;
   CROSS("behavior:RatingRole:ascent", pos.x(), pos.y(), 20, 5, Drawings::solidPen, ColorRGBA::gray);
+
+  //if position is outside the Voronoi region clip it
+  if(Geometry::clipPointInsideConvexPolygon(region, pos))
+    value = rating(pos);
+
   for(int i = 0; i < numIterations; i++)
   {
     const float drawRatio = 1.f - (i + 1) / static_cast<float>(numIterations) * 0.5f;
-    //if position is outside the Voronoi region clip it
-    Geometry::clipPointInsideConvexPolygon(region, pos);
-
-    const float value = rating(pos);
 
     //sample points in the direction of the base pose to make sure they are inside the Voronoi region
     const bool sampleUp = pos.x() < base.x();
@@ -157,6 +168,20 @@ void RatingRole::gradientAscent(Vector2f& pos, int numIterations) const
     LINE("behavior:RatingRole:ascent", oldP.x(), oldP.y(), pos.x(), pos.y(), 5, Drawings::solidPen, ColorRGBA(255, static_cast<unsigned char>(drawRatio * 255), 0));
     ratio -= ratioReduction;
     d = p.delta * ratio;
+
+    //the rating at the new position is needed by the next iteration anyway, so it is also used to check for convergence
+    if(i + 1 < numIterations || p.minRatingGain > 0.f)
+    {
+      Geometry::clipPointInsideConvexPolygon(region, pos);
+      const float newValue = rating(pos);
+      if(p.minRatingGain > 0.f && newValue - value < p.minRatingGain)
+      {
+        if(newValue < value)
+          pos = oldP;
+        break;
+      }
+      value = newValue;
+    }
   }
 
   //outside the Voronoi region, return original pos
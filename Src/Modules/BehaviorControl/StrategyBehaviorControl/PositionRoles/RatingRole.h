@@ -22,6 +22,7 @@ class RatingRole : public PositionRole
     (float)(100.f) step, /**< step size for gradient ascend */
     (float)(100.f) cellSize, /**< Size of each grid cell in mm on the field, lower number results in higher resolution for the heatmap */
     (int)(10) numIterations, /**< how many iterations the gradient ascend does each cycle, does not need to be high as we start at the position computed in the previous cycle */
+    (float)(0.f) minRatingGain, /**< the gradient ascend stops early if a step improves the rating by less than this. Only used if positive, as the value is heavily dependent on the rating function */
     (unsigned char)(150) heatmapAlpha, /**< Transparency of the heatmap between 0 (invisible) and 255 (opaque) */
     (ColorRGBA)(213, 17, 48) worstEvaluationColor, /**< Red color in RGB corresponding to a pass evaluation value of 0 in the heatmap */
     (ColorRGBA)(0, 104, 180) bestEvaluationColor, /**< Blue color in RGB corresponding to a pass evaluation value of 1 in the heatmap */
@@ -54,7 +55,8 @@ class RatingRole : public PositionRole
   ///
   /// <param name="pos">: position from which to start and which will be moved</param>
   /// <param name="numIterations">: how many iteration should be done</param>
-  void gradientAscent(Vector2f& pos, const int numIterations) const;
+  /// <param name="value">: the rating at the start position</param>
+  void gradientAscent(Vector2f& pos, const int numIterations, float value) const;
 
   //computes the rating for a given point
   virtual float rating(const Vector2f& pos) const = 0;
@@ -32,26 +32,40 @@ GameControllerDataProvider::GameControllerDataProvider()
 
 void GameControllerDataProvider::update(GameControllerData& theGameControllerData)
 {
-  int size;
-  RoboCup::RoboCupGameControlData buffer;
-  unsigned from;
-  while((size = socket.read(reinterpret_cast<char*>(&buffer), sizeof(buffer), from)) > 0)
+  // All pending packets are fetched in batches, each with a single system call.
+  constexpr int numOfBuffers = 4;
+  RoboCup::RoboCupGameControlData buffers[numOfBuffers];
+  UdpComm::Packet packets[numOfBuffers];
+  int received;
+  do
   {
-    if(size == sizeof(buffer) &&
-       !std::memcmp(&buffer, GAMECONTROLLER_STRUCT_HEADER, 4) &&
-       buffer.version == GAMECONTROLLER_STRUCT_VERSION &&
-       (buffer.teams[0].teamNumber == Global::getSettings().teamNumber ||
-        buffer.teams[1].teamNumber == Global::getSettings().teamNumber))
+    for(int i = 0; i < numOfBuffers; ++i)
     {
-      unsigned ip = htonl(from);
-      char addressBuffer[INET_ADDRSTRLEN];
-      VERIFY(inet_ntop(AF_INET, &ip, addressBuffer, INET_ADDRSTRLEN) == addressBuffer);
-      socket.setTarget(addressBuffer, GAMECONTROLLER_RETURN_PORT);
-      static_cast<RoboCup::RoboCupGameControlData&>(theGameControllerData) = buffer;
-      theGameControllerData.timeLastPacketReceived = socket.getLastReadTimestamp();
-      theGameControllerData.isTrueData = false;
+      packets[i].data = reinterpret_cast<char*>(&buffers[i]);
+      packets[i].size = sizeof(buffers[i]);
+    }
+    received = socket.read(packets, numOfBuffers);
+    for(int i = 0; i < received; ++i)
+    {
+      const RoboCup::RoboCupGameControlData& buffer = buffers[i];
+      if(packets[i].size == sizeof(buffer) &&
+         !std::memcmp(&buffer, GAMECONTROLLER_STRUCT_HEADER, 4) &&
+         buffer.version == GAMECONTROLLER_STRUCT_VERSION &&
+         (buffer.teams[0].teamNumber == Global::getSettings().teamNumber ||
+          buffer.teams[1].teamNumber == Global::getSettings().teamNumber))
+      {
+        unsigned ip = htonl(packets[i].ip);
+        char addressBuffer[INET_ADDRSTRLEN];
+        VERIFY(inet_ntop(AF_INET, &ip, addressBuffer, INET_ADDRSTRLEN) == addressBuffer);
+        socket.setTarget(addressBuffer, GAMECONTROLLER_RETURN_PORT);
+        static_cast<RoboCup::RoboCupGameControlData&>(theGameControllerData) = buffer;
+        theGameControllerData.timeLastPacketReceived = packets[i].timestamp;
+        theGameControllerData.timeLastPacketReceivedUs = static_cast<unsigned short>(packets[i].timestampNs / 1000ull % 1000ull);
+        theGameControllerData.isTrueData = false;
+      }
     }
   }
+  while(received == numOfBuffers);
 
   if(theFrameInfo.getTimeSince(theGameControllerData.timeLastPacketReceived) < gameControllerTimeout &&
      theFrameInfo.getTimeSince(whenPacketWasSent) >= aliveDelay &&
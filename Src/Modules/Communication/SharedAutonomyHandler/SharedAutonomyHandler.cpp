@@ -9,7 +9,10 @@
 
 #include "SharedAutonomyHandler.h"
 #include "Framework/Settings.h"
+#include "Platform/Time.h"
 #include "Streaming/Global.h"
+#include <algorithm>
+#include <cmath>
 
 MAKE_MODULE(SharedAutonomyHandler);
 
@@ -17,6 +20,8 @@ SharedAutonomyHandler::SharedAutonomyHandler()
   : buffer(new char[bufferSize])
 {
   queue.setBuffer(buffer, 0, bufferSize);
+  joystickState.axes.fill(0.f);
+  axisSpeeds.fill(0.f);
 
   if(!(theGameState.playerNumber & 1))
   {
@@ -43,8 +48,11 @@ void SharedAutonomyHandler::update(JoystickState& theJoystickState)
   for(;;)
   {
     const int size = sharedAutonomyChannel->receive(buffer, bufferSize);
+    SharedAutonomyChannel::JoystickPacket packet;
     if(size <= 0)  // no packet available -> stop
       break;
+    else if(packet.read(buffer, size))
+      receive(packet);
     else if(static_cast<unsigned>(size) < bufferSize)
     {
       MessageQueue queue;
@@ -55,13 +63,25 @@ void SharedAutonomyHandler::update(JoystickState& theJoystickState)
           {
             case idSharedAutonomyRequest:
               m.bin() >> sharedAutonomyRequest;
-              break;
-            case idJoystickState:
-              m.bin() >> theJoystickState;
           }
     }
   }
 
+  // Extrapolate the operator's input between packets. Release everything if packets stopped arriving.
+  theJoystickState = joystickState;
+  if(joystickState.timeWhenReceived)
+  {
+    const int age = Time::getRealTimeSince(joystickState.timeWhenReceived);
+    if(age > joystickTimeout)
+    {
+      theJoystickState.axes.fill(0.f);
+      theJoystickState.buttons = 0;
+    }
+    else
+      for(std::size_t i = 0; i < theJoystickState.axes.size(); ++i)
+        theJoystickState.axes[i] = std::clamp(joystickState.axes[i] + axisSpeeds[i] * static_cast<float>(std::min(age, maxPredictionTime)), -1.f, 1.f);
+  }
+
   if(theGameState.playerState == GameState::unstiff)
   {
     sharedAutonomyRequest.isValid = false;
@@ -91,3 +111,42 @@ void SharedAutonomyHandler::update(JoystickState& theJoystickState)
     sharedAutonomyChannel->send(buffer, static_cast<int>(queue.end() - queue.begin()));
   }
 }
+
+void SharedAutonomyHandler::receive(const SharedAutonomyChannel::JoystickPacket& packet)
+{
+  // The remote PC might have been restarted if no packet was received for a while.
+  const unsigned now = Time::getRealSystemTime();
+  const bool continued = joystickState.timeWhenReceived && Time::getRealTimeSince(joystickState.timeWhenReceived) <= joystickTimeout;
+  if(continued && static_cast<int>(packet.sequenceNumber - joystickState.sequenceNumber) <= 0)
+    return; // Copy or outdated
+
+  SharedAutonomyChannel::AckPacket ack;
+  ack.sequenceNumber = packet.sequenceNumber;
+  ack.sendTime = packet.sendTime;
+  char data[SharedAutonomyChannel::AckPacket::size];
+  ack.write(data);
+  sharedAutonomyChannel->send(data, SharedAutonomyChannel::AckPacket::size);
+
+  if(continued)
+  {
+    joystickState.packetsLost += packet.sequenceNumber - joystickState.sequenceNumber - 1;
+
+    // The jitter is estimated as in RFC 3550 from the differences between send and receive intervals.
+    const int sendInterval = static_cast<int>(packet.sendTime - lastSendTime);
+    const int receiveInterval = static_cast<int>(now - joystickState.timeWhenReceived);
+    joystickState.jitter += (static_cast<float>(std::abs(receiveInterval - sendInterval)) - joystickState.jitter) / 16.f;
+
+    if(sendInterval > 0)
+      for(std::size_t i = 0; i < axisSpeeds.size(); ++i)
+        axisSpeeds[i] = (packet.axes[i] - joystickState.axes[i]) / static_cast<float>(sendInterval);
+  }
+  else
+    axisSpeeds.fill(0.f);
+
+  joystickState.axes = packet.axes;
+  joystickState.buttons = packet.buttons;
+  joystickState.sequenceNumber = packet.sequenceNumber;
+  joystickState.timeWhenReceived = now;
+  joystickState.latency = packet.latency;
+  lastSendTime = packet.sendTime;
+}
@@ -40,7 +40,6 @@ MODULE(SharedAutonomyHandler,
   REQUIRES(RobotPose),
   REQUIRES(TeamData),
   REQUIRES(TeammatesBallModel),
-  REQUIRES(JoystickState),
   PROVIDES(JoystickState),
   PROVIDES(SharedAutonomyRequest),
   PROVIDES(SharedAutonomyRequest2),
@@ -50,6 +49,8 @@ MODULE(SharedAutonomyHandler,
     (int)(100) offsetToTeamPort, /**< The offset of the port used to the team port. */
     (unsigned)(25000) bufferSize, /**< The maximum size of a message sent. */
     (unsigned)(3) sendNthFrame, /**< Send every nth frame (per camera). */
+    (int)(60) maxPredictionTime, /**< The joystick axes are extrapolated for at most this long after a packet was received (in ms). */
+    (int)(500) joystickTimeout, /**< The joystick is considered released if no packet was received for this long (in ms). */
   }),
 });
 
@@ -61,6 +62,16 @@ class SharedAutonomyHandler : public SharedAutonomyHandlerBase
   MessageQueue queue; /**< The queue that writes to the buffer. */
   unsigned frames[CameraInfo::numOfCameras] = {0, 0}; /**< Count frames per camera. */
   SharedAutonomyRequest sharedAutonomyRequest; /**< The last request received. */
+  JoystickState joystickState; /**< The joystick state last received, i.e. without extrapolation. */
+  unsigned lastSendTime = 0; /**< The send time of the last joystick packet received (remote time in ms). */
+  std::array<float, 8> axisSpeeds; /**< The change rates of the joystick axes between the last two packets (per ms). */
+
+  /**
+   * Handles a joystick packet. Outdated packets and copies are ignored.
+   * New packets are acknowledged.
+   * @param packet The packet received.
+   */
+  void receive(const SharedAutonomyChannel::JoystickPacket& packet);
 
   /**
    * This method is called when the representation provided needs to be updated.
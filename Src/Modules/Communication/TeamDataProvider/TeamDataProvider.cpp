@@ -42,6 +42,8 @@ Teammate& TeamDataProvider::getTeammate(TeamData& teamData, int number) const
 void TeamDataProvider::handleMessage(Teammate& teammate, const ReceivedTeamMessage& teamMessage) const
 {
   teammate.number = teamMessage.number;
+  teammate.timeOffsetUncertainty = teamMessage.timeOffsetUncertainty;
+  teammate.timeOffsetConfidence = teamMessage.timeOffsetConfidence;
   teammate.theRobotStatus = teamMessage.theRobotStatus;
   teammate.theRobotPose = teamMessage.theRobotPose;
   teammate.theBallModel = teamMessage.theBallModel;
@@ -77,15 +77,7 @@ void TeamMessageHandler::update(BHumanMessageOutputGenerator& outputGenerator)
   DECLARE_DEBUG_RESPONSE("module:TeamMessageHandler:statistics");
   MODIFY("module:TeamMessageHandler:statistics", statistics);
 
-  DEBUG_RESPONSE("module:TeamMessageHandler:budgetLimit")
-  {
-    const int timeRemainingInCurrentHalf = std::max(0, -theFrameInfo.getTimeSince(theGameState.timeWhenPhaseEnds));
-    const int timeInNextHalf = theGameState.phase == GameState::firstHalf ? durationOfHalf : 0;
-    const int remainingTime = std::max(0, timeRemainingInCurrentHalf - lookahead) + timeInNextHalf;
-    const float ratio = Rangef::ZeroOneRange().limit(remainingTime / (durationOfHalf * 2.f));
-
-    PLOT("module:TeamMessageHandler:budgetLimit", overallMessageBudget * ratio + normalMessageReserve * (1.f - ratio));
-  }
+  PLOT("module:TeamMessageHandler:budgetLimit", budgetLimit());
 
   PLOT("module:TeamMessageHandler:previewMessageBudget", ownModeledBudget);
 
@@ -320,10 +312,13 @@ bool TeamMessageHandler::readTeamMessage(const TeamMessageChannel::Container* co
 void TeamMessageHandler::parseMessage(ReceivedTeamMessage& teamMessage)
 {
   teamMessage.number = receivedMessageContainer.playerNumber;
+  const SynchronizationMeasurementsBuffer* smb = theGameControllerRBS[teamMessage.number];
+  teamMessage.timeOffsetUncertainty = smb->getUncertainty(theFrameInfo.time);
+  teamMessage.timeOffsetConfidence = smb->getConfidence(theFrameInfo.time);
 
   CompressedTeamCommunicationIn stream(receivedMessageContainer.compressedContainer,
                                        receivedMessageContainer.timestamp, teamMessageType,
-                                       [smb = theGameControllerRBS[teamMessage.number]](unsigned u) { return smb->getRemoteTimeInLocalTime(u); });
+                                       [smb](unsigned u) { return smb->getRemoteTimeInLocalTime(u); });
   receivedMessageContainer.in = &stream;
 
   RECEIVE_PARTICLE(RobotPose);
@@ -408,13 +403,13 @@ bool TeamMessageHandler::checkTimeDelay() const
 {
   // When switching to striker, sending is allowed without delay
   // Otherwise wait 0.6 to 1.2 seconds to allow other robots to send important information
-  // TODO determine better parameters
-  // TODO 600 ms min delay, because we currently do not have a preview of the message budget.
-  // If we have -> could go down to 200 ms? But max should remain at 1200 ms?
+  // The more messages are left above the budget limit, the shorter the delay becomes.
+  if(Role::isActiveRole(theStrategyStatus.role) && !Role::isActiveRole(lastSent.theStrategyStatus.role))
+    return theFrameInfo.getTimeSince(timeWhenLastSendTryStarted) > sendDelayPlayBall;
+  const int ballDelay = mapToRange(static_cast<int>(theBallModel.estimate.position.norm()), ballDistanceRangeForDelay.min, ballDistanceRangeForDelay.max, sendDelayRange.min, sendDelayRange.max);
+  const int budgetSurplus = static_cast<int>(static_cast<float>(ownModeledBudget) - budgetLimit());
   return theFrameInfo.getTimeSince(timeWhenLastSendTryStarted) >
-         (Role::isActiveRole(theStrategyStatus.role) && !Role::isActiveRole(lastSent.theStrategyStatus.role) ?
-          sendDelayPlayBall :
-          mapToRange(static_cast<int>(theBallModel.estimate.position.norm()), ballDistanceRangeForDelay.min, ballDistanceRangeForDelay.max, sendDelayRange.min, sendDelayRange.max));
+         mapToRange(budgetSurplus, 0, budgetSurplusForMinDelay, ballDelay, sendDelayRange.min);
 }
 
 void TeamMessageHandler::setTimeDelay()
@@ -422,13 +417,18 @@ void TeamMessageHandler::setTimeDelay()
   timeWhenLastSendTryStarted = theFrameInfo.time;
 }
 
-bool TeamMessageHandler::withinNormalBudget() const
+float TeamMessageHandler::budgetLimit() const
 {
   const int timeRemainingInCurrentHalf = std::max(0, -theFrameInfo.getTimeSince(theGameState.timeWhenPhaseEnds));
   const int timeInNextHalf = theGameState.phase == GameState::firstHalf ? durationOfHalf : 0;
   const int remainingTime = std::max(0, timeRemainingInCurrentHalf - lookahead) + timeInNextHalf;
-  return (static_cast<int>(ownModeledBudget - normalMessageReserve) * durationOfHalf * 2 >
-          static_cast<int>(overallMessageBudget - normalMessageReserve) * remainingTime);
+  const float ratio = Rangef::ZeroOneRange().limit(remainingTime / (durationOfHalf * 2.f));
+  return normalMessageReserve + (static_cast<float>(overallMessageBudget) - static_cast<float>(normalMessageReserve)) * ratio;
+}
+
+bool TeamMessageHandler::withinNormalBudget() const
+{
+  return static_cast<float>(ownModeledBudget) > budgetLimit();
 }
 
 bool TeamMessageHandler::withinPriorityBudget() const
@@ -88,6 +88,7 @@ MODULE(TeamMessageHandler,
     (Rangei) sendDelayRange, /**< Delay sending messages between those time windows. */
     (int) sendDelayPlayBall, /**< Delay sending messages when sending because of striker switch. */
     (Rangei) ballDistanceRangeForDelay, /**< Interpolate the delay of sending messages based on the distance to the ball. */
+    (int) budgetSurplusForMinDelay, /**< With this many messages above the budget limit, the delay of sending messages is reduced to the minimum of sendDelayRange. */
     (bool) sendMirroredRobotPose, /**< Whether to send the robot pose mirrored (useful for one vs one demos such that keeper and striker can share their ball positions). */
     (bool) dropUnsynchronizedMessages, /**< Whether messages in which timestamps cannot be converted should be dropped. */
     (bool) alwaysSend, /**< Send every second. */
@@ -272,6 +273,14 @@ private:
    */
   bool notInPlayDead() const;
 
+  /**
+   * Returns the number of messages that should at least be left of the message
+   * budget at the current time. It decreases linearly over the game from the
+   * overall budget to the "normalMessageReserve", but is always "lookahead" ms ahead.
+   * @return The number of messages.
+   */
+  float budgetLimit() const;
+
   /**
    * Checks whether a normal message could be sent without violating
    * the floating message budget. This check targets to keep the
@@ -34,41 +34,25 @@ void AutoExposureWeightTableProvider::update(AutoExposureWeightTable& theAutoExp
     return;
   }
 
-  // Use static table or reset all weights to 0.
+  // Use static table or determine the weights.
   if(useStaticTables[theCameraInfo.camera])
     table = staticTables[theCameraInfo.camera];
   else
   {
-    table = AutoExposureWeightTable::Table::Zero();
     if(theCameraInfo.width <= 0 || theCameraInfo.height <= 0)
+    {
+      table = AutoExposureWeightTable::Table::Zero();
       return;
+    }
     ASSERT(theCameraInfo.width % table.cols() == 0);
     ASSERT(theCameraInfo.height % table.rows() == 0);
     const int cellWidth = static_cast<int>(theCameraInfo.width / table.cols());
     const int cellHeight = static_cast<int>(theCameraInfo.height / table.rows());
-    std::vector<int> rows(table.cols());
-    int numOfFieldCells = 0;
 
     // Set weights above body contour and below distance threshold to 1.
-    for(int col = 0; col < table.cols(); ++col)
-    {
-      int y = theCameraInfo.height;
-      theBodyContour.clipBottom(col * cellWidth, y);
-      theBodyContour.clipBottom((col + 1) * cellWidth - 1, y);
-
-      int& row = rows[col];
-      row = y / cellHeight - 1;
-      Vector2f onField;
-      while(row >= 0
-            && Transformation::imageToRobot(col * cellWidth, row * cellHeight, theCameraMatrix, theCameraInfo, onField)
-            && onField.norm() <= distanceThreshold
-            && Transformation::imageToRobot((col + 1) * cellWidth - 1, row * cellHeight, theCameraMatrix, theCameraInfo, onField)
-            && onField.norm() <= distanceThreshold)
-      {
-        table(row--, col) = 1;
-        ++numOfFieldCells;
-      }
-    }
+    updateFieldCells(cellWidth, cellHeight);
+    table = fieldCells.table;
+    int numOfFieldCells = static_cast<int>((table.array() != 0).count());
 
     // Prioritize area including the ball if its detection is not too old
     if(theFrameInfo.getTimeSince(theWorldModelPrediction.timeWhenBallLastSeen) <= ballValidDelay)
@@ -133,7 +117,44 @@ void AutoExposureWeightTableProvider::update(AutoExposureWeightTable& theAutoExp
     if(numOfFieldCells == 0)
     {
       for(int col = 0; col < table.cols(); ++col)
-        table(std::max(rows[col], 0), col) = 1;
+        table(std::max(fieldCells.rows[col], 0), col) = 1;
     }
   }
 }
+
+void AutoExposureWeightTableProvider::updateFieldCells(int cellWidth, int cellHeight)
+{
+  // All columns must be determined again if the perspective changed noticeably.
+  const bool perspectiveChanged = fieldCells.width != theCameraInfo.width || fieldCells.height != theCameraInfo.height
+                                  || (fieldCells.cameraMatrix.translation - theCameraMatrix.translation).norm() > maxTranslationChange
+                                  || Eigen::AngleAxisf(fieldCells.cameraMatrix.rotation.transpose() * theCameraMatrix.rotation).angle() > maxRotationChange;
+  if(perspectiveChanged)
+  {
+    fieldCells.cameraMatrix = theCameraMatrix;
+    fieldCells.width = theCameraInfo.width;
+    fieldCells.height = theCameraInfo.height;
+  }
+
+  for(int col = 0; col < fieldCells.table.cols(); ++col)
+  {
+    int y = theCameraInfo.height;
+    theBodyContour.clipBottom(col * cellWidth, y);
+    theBodyContour.clipBottom((col + 1) * cellWidth - 1, y);
+
+    // Otherwise, only the columns in which the body contour moved are updated.
+    if(!perspectiveChanged && fieldCells.bodyY[col] == y)
+      continue;
+    fieldCells.bodyY[col] = y;
+
+    fieldCells.table.col(col).setZero();
+    int& row = fieldCells.rows[col];
+    row = y / cellHeight - 1;
+    Vector2f onField;
+    while(row >= 0
+          && Transformation::imageToRobot(col * cellWidth, row * cellHeight, theCameraMatrix, theCameraInfo, onField)
+          && onField.norm() <= distanceThreshold
+          && Transformation::imageToRobot((col + 1) * cellWidth - 1, row * cellHeight, theCameraMatrix, theCameraInfo, onField)
+          && onField.norm() <= distanceThreshold)
+      fieldCells.table(row--, col) = 1;
+  }
+}
@@ -6,7 +6,8 @@
  * weights for corresponding image areas. The module limits the area considered to a
  * definable distance from the robots. In addition, the robot's body is excluded. If the ball
  * is expected to be in the image, it will influence the exposure computation with a
- * configurable ratio.
+ * configurable ratio. The cells showing the field are only determined again for the
+ * columns in which the body contour moved or if the camera perspective changed noticeably.
  *
  * @author Thomas Röfer
  */
@@ -22,6 +23,7 @@
 #include "Representations/Perception/ImagePreprocessing/BodyContour.h"
 #include "Representations/Perception/ImagePreprocessing/CameraMatrix.h"
 #include "Streaming/EnumIndexedArray.h"
+#include <array>
 
 MODULE(AutoExposureWeightTableProvider,
 {,
@@ -37,6 +39,8 @@ MODULE(AutoExposureWeightTableProvider,
     (float) distanceThreshold, /**< The maximum field distance of areas considered (in mm). */
     (int) ballValidDelay, /**< How long is the ball prioritized after its last detection (in ms)? */
     (float) ballWeightRatio, /**< The ratio between the summed up weights of ball areas and other areas. */
+    (Angle) maxRotationChange, /**< The camera may rotate by this angle before all field cells are determined again. */
+    (float) maxTranslationChange, /**< The camera may move by this distance before all field cells are determined again (in mm). */
     (ENUM_INDEXED_ARRAY(bool, CameraInfo::Camera)) useStaticTables, /**< Only provide the static tables defined below? */
     (AutoExposureWeightTable::Table[CameraInfo::numOfCameras]) staticTables, /**< Static weights each in the range [0 .. AutoExposureWeightTable::maxWeight]. */
   }),
@@ -44,9 +48,29 @@ MODULE(AutoExposureWeightTableProvider,
 
 class AutoExposureWeightTableProvider : public AutoExposureWeightTableProviderBase
 {
+  /** The cells that are weighted because they show the field close to the robot. */
+  struct FieldCells
+  {
+    Pose3f cameraMatrix; /**< The camera matrix the cells were determined for. */
+    int width = 0; /**< The image width the cells were determined for. */
+    int height = 0; /**< The image height the cells were determined for. */
+    std::array<int, AutoExposureWeightTable::width> bodyY; /**< The lowest image row per column that is not hidden by the body. */
+    std::array<int, AutoExposureWeightTable::width> rows; /**< The row above the field cells per column (-1 if there is none). */
+    AutoExposureWeightTable::Table table = AutoExposureWeightTable::Table::Zero(); /**< The field cells have the weight 1, all others 0. */
+  };
+
+  FieldCells fieldCells; /**< The field cells determined so far. */
+
   /**
    * This method is called when the representation provided needs to be updated.
    * @param theAutoExposureWeightTable The representation updated.
    */
   void update(AutoExposureWeightTable& theAutoExposureWeightTable) override;
+
+  /**
+   * Updates the columns of the field cells whose inputs changed.
+   * @param cellWidth The width of a cell in pixels.
+   * @param cellHeight The height of a cell in pixels.
+   */
+  void updateFieldCells(int cellWidth, int cellHeight);
 };
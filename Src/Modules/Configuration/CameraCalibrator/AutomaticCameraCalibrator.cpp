@@ -521,7 +521,7 @@ void AutomaticCameraCalibrator::optimize()
 {
   if(!optimizer)
   {
-    optimizer = std::make_unique<GaussNewtonOptimizer<numOfParameterTranslations>>(functor);
+    optimizer = std::make_unique<GaussNewtonOptimizer<numOfParameterTranslations>>(functor, levenbergMarquardtDamping);
     optimizationParameters = pack(theCameraCalibration);
     successiveConvergences = 0;
   }
@@ -757,6 +757,22 @@ float AutomaticCameraCalibrator::Functor::operator()(const Parameters& params, s
   return calibrator.samples[measurement]->computeError(cameraCalibration);
 }
 
+bool AutomaticCameraCalibrator::Functor::dependsOn(size_t measurement, size_t parameter) const
+{
+  const CameraInfo::Camera camera = calibrator.samples[measurement]->cameraInfo.camera;
+  switch(parameter)
+  {
+    case lowerCameraRollCorrection:
+    case lowerCameraTiltCorrection:
+      return camera == CameraInfo::lower;
+    case upperCameraRollCorrection:
+    case upperCameraTiltCorrection:
+      return camera == CameraInfo::upper;
+    default:
+      return true;
+  }
+}
+
 bool AutomaticCameraCalibrator::SampleConfiguration::needToRecord(const std::vector<std::unique_ptr<Sample>>& samples, SampleType sampleType) const
 {
   if(!(sampleTypes & bit(sampleType)))
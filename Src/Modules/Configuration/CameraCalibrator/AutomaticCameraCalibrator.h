@@ -54,6 +54,7 @@ MODULE(AutomaticCameraCalibrator,
   DEFINES_PARAMETERS(
   {,
     (ENUM_INDEXED_ARRAY(CameraResolutionRequest::Resolutions, CameraInfo::Camera))({CameraResolutionRequest::CameraResolutionRequest::Resolutions::w640h480, CameraResolutionRequest::CameraResolutionRequest::Resolutions::w640h480}) resRequest, /**< Last camera resolution requested. */
+    (float)(0.f) levenbergMarquardtDamping, /**< The initial damping of the Levenberg-Marquardt algorithm. 0 uses Gauss-Newton steps. */
     (float)(0.001f) terminationCriterion, /**< If the norm of the parameter vector update is less than this in an optimization step, it is counted as termination step. */
     (unsigned)(3) minSuccessiveConvergences, /**< The number of successive steps the termination criterion must be fulfilled. */
     (float)(10000.f) notValidError, /**< The error that results from parameters that result in a sample that cannot be projected. */
@@ -243,6 +244,15 @@ private:
      */
     size_t getNumOfMeasurements() const override { return calibrator.samples.size(); }
 
+    /**
+     * Returns whether a parameter influences the residual of a measurement. The
+     * rotation corrections of a camera only influence the samples taken with it.
+     * @param measurement The component index of the residual.
+     * @param parameter The index of the parameter.
+     * @return Can the residual change with the parameter?
+     */
+    bool dependsOn(size_t measurement, size_t parameter) const override;
+
     AutomaticCameraCalibrator& calibrator; /**< The owning module. */
   };
   friend struct Functor;
@@ -0,0 +1,72 @@
+/**
+ * @file FieldGeometryProvider.cpp
+ *
+ * This file implements a module that derives lookup structures for queries about
+ * the field geometry from the field dimensions.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "FieldGeometryProvider.h"
+#include "Debugging/DebugDrawings.h"
+#include <cmath>
+
+MAKE_MODULE(FieldGeometryProvider);
+
+void FieldGeometryProvider::update(FieldGeometry& fieldGeometry)
+{
+  bool recompute = !fieldGeometry.isValid();
+  DEBUG_RESPONSE_ONCE("module:FieldGeometryProvider:recompute")
+    recompute = true;
+  if(!recompute)
+    return;
+
+  fieldGeometry.cellSize = cellSize;
+  fieldGeometry.carpet = theFieldDimensions.boundary;
+  fieldGeometry.fieldOfPlayBoundary = Boundaryf(Rangef(theFieldDimensions.xPosOwnGoalLine, theFieldDimensions.xPosOpponentGoalLine),
+                                                Rangef(theFieldDimensions.yPosRightTouchline, theFieldDimensions.yPosLeftTouchline));
+
+  // The distances to the field lines (including the center circle)
+  std::vector<LineLikelihoodField::Segment> segments;
+  for(const FieldDimensions::LinesTable::Line& line : theFieldDimensions.fieldLines.lines)
+    segments.push_back({line.from, line.to});
+  fieldGeometry.lineDistances.build(fieldGeometry.carpet, cellSize, segments);
+
+  // The areas at the centers of all cells
+  fieldGeometry.width = static_cast<int>(std::ceil((fieldGeometry.carpet.x.max - fieldGeometry.carpet.x.min) / cellSize));
+  fieldGeometry.height = static_cast<int>(std::ceil((fieldGeometry.carpet.y.max - fieldGeometry.carpet.y.min) / cellSize));
+  fieldGeometry.areas.resize(fieldGeometry.width * fieldGeometry.height);
+  for(int y = 0; y < fieldGeometry.height; ++y)
+    for(int x = 0; x < fieldGeometry.width; ++x)
+      fieldGeometry.areas[y * fieldGeometry.width + x] = static_cast<unsigned char>(
+        getAreas(Vector2f(fieldGeometry.carpet.x.min + (static_cast<float>(x) + 0.5f) * cellSize,
+                          fieldGeometry.carpet.y.min + (static_cast<float>(y) + 0.5f) * cellSize)));
+}
+
+unsigned FieldGeometryProvider::getAreas(const Vector2f& point) const
+{
+  unsigned areas = 0;
+  if(theFieldDimensions.isInsideField(point))
+  {
+    areas |= bit(FieldGeometry::fieldOfPlay);
+    if(point.x() <= theFieldDimensions.xPosHalfwayLine)
+      areas |= bit(FieldGeometry::ownHalf);
+  }
+  if(point.squaredNorm() <= sqr(theFieldDimensions.centerCircleRadius))
+    areas |= bit(FieldGeometry::centerCircle);
+  if(std::abs(point.y()) <= theFieldDimensions.yPosLeftPenaltyArea)
+  {
+    if(point.x() >= theFieldDimensions.xPosOwnGoalLine && point.x() <= theFieldDimensions.xPosOwnPenaltyArea)
+      areas |= bit(FieldGeometry::ownPenaltyArea);
+    if(point.x() <= theFieldDimensions.xPosOpponentGoalLine && point.x() >= theFieldDimensions.xPosOpponentPenaltyArea)
+      areas |= bit(FieldGeometry::opponentPenaltyArea);
+  }
+  if(std::abs(point.y()) <= theFieldDimensions.yPosLeftGoalArea)
+  {
+    if(point.x() >= theFieldDimensions.xPosOwnGoalLine && point.x() <= theFieldDimensions.xPosOwnGoalArea)
+      areas |= bit(FieldGeometry::ownGoalArea);
+    if(point.x() <= theFieldDimensions.xPosOpponentGoalLine && point.x() >= theFieldDimensions.xPosOpponentGoalArea)
+      areas |= bit(FieldGeometry::opponentGoalArea);
+  }
+  return areas;
+}
@@ -0,0 +1,41 @@
+/**
+ * @file FieldGeometryProvider.h
+ *
+ * This file declares a module that derives lookup structures for queries about
+ * the field geometry from the field dimensions. They are only computed once.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Framework/Module.h"
+#include "Representations/Configuration/FieldDimensions.h"
+#include "Representations/Configuration/FieldGeometry.h"
+
+MODULE(FieldGeometryProvider,
+{,
+  REQUIRES(FieldDimensions),
+  PROVIDES_WITHOUT_MODIFY(FieldGeometry),
+  DEFINES_PARAMETERS(
+  {,
+    (float)(50.f) cellSize, /**< The edge length of the square cells of the lookup structures (in mm). */
+  }),
+});
+
+class FieldGeometryProvider : public FieldGeometryProviderBase
+{
+  /**
+   * This method is called when the representation provided needs to be updated.
+   * It only computes the geometry if it was not computed yet.
+   * @param fieldGeometry The representation updated.
+   */
+  void update(FieldGeometry& fieldGeometry) override;
+
+  /**
+   * Computes the areas a point is located in.
+   * @param point The point (in field coordinates).
+   * @return A bit set of \c FieldGeometry::Area.
+   */
+  unsigned getAreas(const Vector2f& point) const;
+};
@@ -22,6 +22,8 @@
 #include <MD5.h>
 #endif
 #include <cstdio>
+#include <cstring>
+#include <utility>
 
 MAKE_MODULE(CameraProvider);
 
@@ -52,6 +54,13 @@ CameraProvider::CameraProvider()
 
 CameraProvider::~CameraProvider()
 {
+  if(jpegThread.isRunning())
+  {
+    jpegThread.announceStop();
+    encodeJPEG.post();
+    jpegThread.stop();
+  }
+
 #ifdef TARGET_ROBOT
   thread.announceStop();
   takeNextImage.post();
@@ -66,8 +75,8 @@ CameraProvider::~CameraProvider()
 void CameraProvider::update(CameraImage& theCameraImage)
 {
 #ifdef TARGET_ROBOT
-  unsigned timestamp = static_cast<long long>(camera->getTimestamp() / 1000) > static_cast<long long>(Time::getSystemTimeBase())
-                       ? static_cast<unsigned>(camera->getTimestamp() / 1000 - Time::getSystemTimeBase()) : 100000;
+  const unsigned long long timestampNs = Time::fromMonotonicTimeNs(camera->getTimestamp() * 1000);
+  const unsigned timestamp = timestampNs ? static_cast<unsigned>(timestampNs / 1000000) : 100000;
   if(camera->hasImage())
   {
     theCameraImage.setReference(cameraInfo.width / 2, cameraInfo.height, const_cast<unsigned char*>(camera->getImage()), std::max(lastImageTimestamp + 1, timestamp));
@@ -112,17 +121,83 @@ void CameraProvider::update(CameraImage& theCameraImage)
   }
   lastImageTimestampLL = camera->getTimestamp();
 
+  // The fraction is only kept if the timestamp was not modified to keep it increasing.
+  theCameraImage.timestampFraction = theCameraImage.timestamp == timestamp ? static_cast<unsigned>(timestampNs % 1000000) : 0;
+
   ASSERT(theCameraImage.timestamp >= lastImageTimestamp);
   lastImageTimestamp = theCameraImage.timestamp;
 #else
   theCameraImage.setResolution(cameraInfo.width / 2, cameraInfo.height);
-  theCameraImage.timestamp = Time::getCurrentSystemTime();
+  const unsigned long long timestampNs = Time::getCurrentSystemTimeNs();
+  theCameraImage.timestamp = static_cast<unsigned>(timestampNs / 1000000);
+  theCameraImage.timestampFraction = static_cast<unsigned>(timestampNs % 1000000);
 #endif // TARGET_ROBOT
 }
 
 void CameraProvider::update(JPEGImage& jpegImage)
 {
-  jpegImage.fromCameraImage(theCameraImage, jpegQuality);
+  if(!encodeJPEGInBackground && !jpegEncoderBusy)
+    jpegImage.fromCameraImage(theCameraImage, jpegQuality);
+  else
+  {
+    if(!jpegThread.isRunning())
+      jpegThread.start(this, &CameraProvider::encodeJPEGImages);
+
+    // Fetch the image compressed since the last frame.
+    if(jpegEncoderBusy && (dropJPEGIfBusy ? jpegEncoded.tryWait() : jpegEncoded.wait()))
+    {
+      std::swap(jpegImage, encodedJPEG);
+      jpegEncoderBusy = false;
+    }
+
+    // Hand the current image to the encoder. If it is still busy, the image is dropped.
+    if(!jpegEncoderBusy && encodeJPEGInBackground)
+    {
+#ifdef TARGET_ROBOT
+      // Hold the camera's frame buffer instead of copying the image.
+      const int heldBuffer = theCameraImage.isReference() ? camera->holdImage() : -1;
+      if(heldBuffer >= 0)
+      {
+        jpegSource.setReference(theCameraImage.width, theCameraImage.height,
+                                const_cast<unsigned char*>(camera->getHeldImage(heldBuffer)), theCameraImage.timestamp);
+        jpegSourceCamera = camera;
+        jpegSourceBuffer = heldBuffer;
+      }
+      else
+#endif
+      {
+        jpegSource.setResolution(theCameraImage.width, theCameraImage.height);
+        std::memcpy(jpegSource[0], theCameraImage[0], theCameraImage.width * theCameraImage.height * sizeof(CameraImage::PixelType));
+        jpegSource.timestamp = theCameraImage.timestamp;
+      }
+      jpegEncoderQuality = jpegQuality;
+      jpegEncoderBusy = true;
+      encodeJPEG.post();
+    }
+  }
+}
+
+void CameraProvider::encodeJPEGImages()
+{
+  Thread::nameCurrentThread("JPEGEncoder");
+  while(true)
+  {
+    encodeJPEG.wait();
+    const bool running = jpegThread.isRunning();
+    if(running)
+      encodedJPEG.fromCameraImage(jpegSource, jpegEncoderQuality);
+#ifdef TARGET_ROBOT
+    // The frame buffer must also be released when stopping, because the camera waits for it.
+    if(jpegSourceCamera)
+    {
+      jpegSourceCamera->releaseHeldImage(jpegSourceBuffer);
+      jpegSourceCamera = nullptr;
+    }
+#endif
+    if(!running)
+      break;
+    jpegEncoded.post();
+  }
 }
 
 void CameraProvider::update(CameraInfo& cameraInfo)
@@ -238,7 +313,7 @@ void CameraProvider::setupCamera()
   camera = new NaoCamera(whichCamera == CameraInfo::upper ?
                          "/dev/video-top" : "/dev/video-bottom",
                          cameraInfo.camera,
-                         cameraInfo.width, cameraInfo.height, whichCamera == CameraInfo::upper,
+                         cameraInfo.width, cameraInfo.height, whichCamera == CameraInfo::upper, numOfFrameBuffers,
                          theCameraSettings.cameras[whichCamera], theAutoExposureWeightTable.tables[whichCamera]);
 #else
   camera = nullptr;
@@ -317,7 +392,7 @@ void CameraProvider::takeImages()
       camera = new NaoCamera(whichCamera == CameraInfo::upper ?
                              "/dev/video-top" : "/dev/video-bottom",
                              cameraInfo.camera,
-                             cameraInfo.width, cameraInfo.height, whichCamera == CameraInfo::upper,
+                             cameraInfo.width, cameraInfo.height, whichCamera == CameraInfo::upper, numOfFrameBuffers,
                              theCameraSettings.cameras[whichCamera], theAutoExposureWeightTable.tables[whichCamera]);
       imageReceived = Time::getRealSystemTime();
     }
@@ -328,7 +403,7 @@ void CameraProvider::takeImages()
     imageTaken.post();
 
     if(camera->hasImage())
-      camera->writeCameraSettings();
+      camera->writeCameraSettings(minAutoExposureWeightTablePeriod, minAutoExposureWeightTableChange);
   }
 #endif
 }
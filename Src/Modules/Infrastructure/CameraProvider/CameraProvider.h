@@ -45,7 +45,12 @@ MODULE(CameraProvider,
   {,
     (unsigned) maxWaitForImage, /**< Timeout in ms for waiting for new images. */
     (int) resetDelay, /**< Timeout in ms for resetting camera without image. */
+    (unsigned) numOfFrameBuffers, /**< The number of frame buffers requested from the camera driver (2 .. 8). */
     (int) jpegQuality, /**< The quality of the JPEG compressing (0 = bad ... 100 = very good). */
+    (bool) encodeJPEGInBackground, /**< Compress JPEG images in a separate thread? They are provided one frame later then. On the robot, this holds one frame buffer. */
+    (bool) dropJPEGIfBusy, /**< Skip an image if the background encoder is still busy? Otherwise, wait for it. */
+    (unsigned) minAutoExposureWeightTablePeriod, /**< The minimum time between two writes of the auto exposure weight table to the camera (in ms). */
+    (int) minAutoExposureWeightTableChange, /**< The minimum sum of absolute weight changes before the auto exposure weight table is written. */
   }),
 });
 
@@ -74,6 +79,16 @@ class CameraProvider : public CameraProviderBase
   Semaphore takeNextImage;
   Semaphore imageTaken;
 
+  Thread jpegThread; /**< The thread that compresses JPEG images in the background. */
+  Semaphore encodeJPEG; /**< Signals the encoder that \c jpegSource contains a new image. */
+  Semaphore jpegEncoded; /**< Signals that \c encodedJPEG contains the compressed image. */
+  CameraImage jpegSource; /**< The camera image that is compressed in the background (a copy or a held frame buffer). */
+  NaoCamera* jpegSourceCamera = nullptr; /**< The camera holding the frame buffer referenced by \c jpegSource or nullptr if it is a copy. */
+  int jpegSourceBuffer = -1; /**< The index of the frame buffer held for \c jpegSource. */
+  JPEGImage encodedJPEG; /**< The image compressed in the background. */
+  int jpegEncoderQuality = 75; /**< The quality used by the background encoder. */
+  bool jpegEncoderBusy = false; /**< Is the background encoder compressing an image? */
+
   /**
    * This method is called when the representation provided needs to be updated.
    * @param theCameraImage The representation updated.
@@ -83,7 +98,11 @@ class CameraProvider : public CameraProviderBase
   void update(CameraInfo& cameraInfo) override;
   void update(CameraIntrinsics& cameraIntrinsics) override {cameraIntrinsics = this->cameraIntrinsics;}
   void update(CameraStatus& cameraStatus) override;
-  void update(FrameInfo& frameInfo) override {frameInfo.time = theCameraImage.timestamp;}
+  void update(FrameInfo& frameInfo) override
+  {
+    frameInfo.time = theCameraImage.timestamp;
+    frameInfo.timeFraction = theCameraImage.timestampFraction;
+  }
   void update(JPEGImage& jpegImage) override;
 
   bool readCameraIntrinsics();
@@ -95,6 +114,9 @@ class CameraProvider : public CameraProviderBase
 
   void takeImages();
 
+  /** The main function of the thread that compresses JPEG images in the background. */
+  void encodeJPEGImages();
+
 public:
   CameraProvider();
   ~CameraProvider();
@@ -6,8 +6,10 @@
  */
 
 #ifdef TARGET_ROBOT
+#include <algorithm>
 #include <cstring>
 #include <cstdio>
+#include <cstdlib>
 #include <unistd.h>
 #include <fcntl.h>
 #include <sys/ioctl.h>
@@ -24,12 +26,13 @@
 #include "Platform/SystemCall.h"
 #include "Platform/Time.h"
 
-NaoCamera::NaoCamera(const char* device, CameraInfo::Camera camera, int width, int height, bool flip,
+NaoCamera::NaoCamera(const char* device, CameraInfo::Camera camera, int width, int height, bool flip, unsigned numOfFrameBuffers,
                      const CameraSettings::Collection& settings,
                      const AutoExposureWeightTable::Table& autoExposureWeightTable) :
   camera(camera),
   WIDTH(width),
-  HEIGHT(height)
+  HEIGHT(height),
+  frameBufferCount(std::clamp(numOfFrameBuffers, 2u, maxFrameBufferCount))
 {
   resetRequired = (fd = open(device, O_RDWR | O_NONBLOCK)) == -1;
   usleep(30000); // Experimental: Add delay between opening and using camera device
@@ -130,7 +133,7 @@ bool NaoCamera::captureNew(int timeout)
   if(currentBuf)
   {
     BH_TRACE;
-    if(ioctl(fd, VIDIOC_QBUF, currentBuf) == -1)
+    if(!requeueBuffer(currentBuf->index))
       return false;
   }
   BH_TRACE;
@@ -197,7 +200,7 @@ void NaoCamera::releaseImage()
 {
   if(currentBuf)
   {
-    if(ioctl(fd, VIDIOC_QBUF, currentBuf) == -1)
+    if(!requeueBuffer(currentBuf->index))
     {
       OUTPUT_ERROR("Releasing image failed!");
       resetRequired = true;
@@ -206,6 +209,54 @@ void NaoCamera::releaseImage()
   }
 }
 
+int NaoCamera::holdImage()
+{
+  if(!currentBuf)
+    return -1;
+  std::lock_guard<std::mutex> lock(holdMutex);
+  ++holders[currentBuf->index];
+  return static_cast<int>(currentBuf->index);
+}
+
+void NaoCamera::releaseHeldImage(int index)
+{
+  std::lock_guard<std::mutex> lock(holdMutex);
+  ASSERT(index >= 0 && index < static_cast<int>(frameBufferCount) && holders[index] > 0);
+  if(--holders[index] == 0 && requeuePending[index])
+  {
+    requeuePending[index] = false;
+    if(!queueBuffer(index))
+    {
+      OUTPUT_ERROR("Releasing held image failed!");
+      resetRequired = true;
+    }
+  }
+  heldImageReleased.notify_all();
+}
+
+bool NaoCamera::requeueBuffer(unsigned index)
+{
+  {
+    std::lock_guard<std::mutex> lock(holdMutex);
+    if(holders[index])
+    {
+      requeuePending[index] = true;
+      return true;
+    }
+  }
+  return queueBuffer(index);
+}
+
+bool NaoCamera::queueBuffer(unsigned index) const
+{
+  v4l2_buffer queueBuf;
+  memset(&queueBuf, 0, sizeof(v4l2_buffer));
+  queueBuf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+  queueBuf.memory = V4L2_MEMORY_MMAP;
+  queueBuf.index = index;
+  return ioctl(fd, VIDIOC_QBUF, &queueBuf) != -1;
+}
+
 const unsigned char* NaoCamera::getImage() const
 {
   return currentBuf ? static_cast<unsigned char*>(mem[currentBuf->index]) : nullptr;
@@ -339,7 +390,7 @@ void NaoCamera::setSettings(const CameraSettings::Collection& cameraSettingColle
     }
 }
 
-void NaoCamera::writeCameraSettings()
+void NaoCamera::writeCameraSettings(unsigned minWeightTablePeriod, int minWeightTableChange)
 {
   const auto oldSettings = appliedSettings.settings;
   FOREACH_ENUM(CameraSettings::Collection::CameraSetting, settingName)
@@ -377,13 +428,23 @@ void NaoCamera::writeCameraSettings()
     }
   }
 
+  // Determine how much the weight table changed and whether cells were turned on or off.
+  int weightTableChange = 0;
+  bool weightTableAreaChanged = false;
   for(size_t i = 0; i < CameraSettingsCollection::sizeOfAutoExposureWeightTable; ++i)
   {
     V4L2Setting& currentTableEntry = settings.autoExposureWeightTable[i];
-    V4L2Setting& appliedTableEntry = appliedSettings.autoExposureWeightTable[i];
-    if(timestamp != 0 && currentTableEntry.value == appliedTableEntry.value)
-      continue;
+    currentTableEntry.enforceBounds();
+    const int appliedValue = appliedSettings.autoExposureWeightTable[i].value;
+    weightTableChange += std::abs(currentTableEntry.value - appliedValue);
+    weightTableAreaChanged |= (currentTableEntry.value == 0) != (appliedValue == 0);
+  }
 
+  if(timestamp == 0
+     || (weightTableChange > 0
+         && (weightTableAreaChanged || weightTableChange >= minWeightTableChange)
+         && timestamp - weightTableTimestamp >= minWeightTablePeriod * 1000ull))
+  {
     // Set all weights at once
     unsigned char value[17] =
     {
@@ -395,19 +456,18 @@ void NaoCamera::writeCameraSettings()
     // Set weights in value to set
     for(size_t i = 0; i < CameraSettingsCollection::sizeOfAutoExposureWeightTable; ++i)
     {
-      V4L2Setting& currentTableEntry = settings.autoExposureWeightTable[i];
-      currentTableEntry.enforceBounds();
       ASSERT(9 + i / 2 < sizeof(value));
-      value[9 + i / 2] |= currentTableEntry.value << (i & 1) * 4;
+      value[9 + i / 2] |= settings.autoExposureWeightTable[i].value << (i & 1) * 4;
     }
 
     // Use extension unit to set exposure weight table
     if(setXU(9, value))
+    {
       appliedSettings.autoExposureWeightTable = settings.autoExposureWeightTable;
+      weightTableTimestamp = timestamp;
+    }
     else
       OUTPUT_ERROR("NaoCamera: setting auto exposure weight table failed");
-
-    break; // All weights were set, no need to search for more differences
   }
 }
 
@@ -606,9 +666,11 @@ bool NaoCamera::mapBuffers()
   rb.count = frameBufferCount;
   rb.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
   rb.memory = V4L2_MEMORY_MMAP;
-  if(ioctl(fd, VIDIOC_REQBUFS, &rb) == -1)
+  if(ioctl(fd, VIDIOC_REQBUFS, &rb) == -1 || rb.count < 2)
     return false;
-  ASSERT(rb.count == frameBufferCount);
+
+  // The driver might provide fewer buffers than requested.
+  frameBufferCount = std::min(rb.count, maxFrameBufferCount);
 
   // map or prepare the buffers
   ASSERT(!buf);
@@ -629,6 +691,14 @@ bool NaoCamera::mapBuffers()
 
 void NaoCamera::unmapBuffers()
 {
+  // wait until no image is held anymore. Held buffers are not requeued.
+  {
+    std::unique_lock<std::mutex> lock(holdMutex);
+    for(bool& pending : requeuePending)
+      pending = false;
+    heldImageReleased.wait(lock, [this] {return std::all_of(std::begin(holders), std::end(holders), [](unsigned h) {return h == 0;});});
+  }
+
   // unmap buffers
   for(unsigned i = 0; i < frameBufferCount; ++i)
   {
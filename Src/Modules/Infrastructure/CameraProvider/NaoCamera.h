@@ -13,6 +13,8 @@
 
 #include <linux/i2c.h>
 #include <linux/i2c-dev.h>
+#include <condition_variable>
+#include <mutex>
 
 /**
  * @class NaoCamera
@@ -30,13 +32,15 @@ public:
    * @param width The width of the camera image in pixels. V4L only allows certain values (e.g. 320 or 640).
    * @param height The height of the camera image in pixels. V4L only allows certain values (e.g. 240 or 480).
    * @param flip Whether the image should be flipped, i.e. rotated by 180°.
+   * @param numOfFrameBuffers The number of frame buffers requested from the driver. Images that are
+   *                          held (see \c holdImage) are not available for capturing.
    * @param settings The initial camera settings.
    * @param autoExposureWeightTable The initial auto exposure weight table. The table contains 5x5 values in
    *                                the range [0 .. 100] that weight the influence the corresponding area of
    *                                the image (rows top to bottom, columns left to right) on the auto exposure
    *                                computation. If the table does only contains zeros, the image will be black.
    */
-  NaoCamera(const char* device, CameraInfo::Camera camera, int width, int height, bool flip,
+  NaoCamera(const char* device, CameraInfo::Camera camera, int width, int height, bool flip, unsigned numOfFrameBuffers,
             const CameraSettings::Collection& settings,
             const AutoExposureWeightTable::Table& autoExposureWeightTable);
 
@@ -66,6 +70,30 @@ public:
    */
   void releaseImage();
 
+  /**
+   * Keeps the buffer of the last captured image from being requeued when the
+   * image is released, so it can still be accessed without copying it. The
+   * buffer is requeued after the last holder called \c releaseHeldImage.
+   * It must be called before the image is released, but \c releaseHeldImage
+   * may be called from a different thread.
+   * @return The index of the buffer held or -1 if there is no image.
+   */
+  int holdImage();
+
+  /**
+   * Releases a buffer held by \c holdImage. If the image itself was already
+   * released, the buffer is requeued to capture another image.
+   * @param index The index returned by \c holdImage.
+   */
+  void releaseHeldImage(int index);
+
+  /**
+   * Returns the data of an image held.
+   * @param index The index returned by \c holdImage.
+   * @return The image data buffer.
+   */
+  const unsigned char* getHeldImage(int index) const {return static_cast<const unsigned char*>(mem[index]);}
+
   /**
    * The last captured image.
    * @return The image data buffer.
@@ -101,9 +129,17 @@ public:
   void setSettings(const CameraSettings::Collection& settings, const AutoExposureWeightTable::Table& autoExposureWeightTable);
 
   /**
-   * Unconditional write of the camera settings
+   * Writes the camera settings that differ from the ones applied. Since each
+   * write can stall capturing images, small changes of the auto exposure
+   * weight table are delayed until they sum up. Changes that turn the weight
+   * of a cell on or off are always written, but not more often than the
+   * minimum period allows.
+   * @param minWeightTablePeriod The minimum time between two writes of the
+   *                             auto exposure weight table (in ms).
+   * @param minWeightTableChange The minimum sum of absolute weight changes
+   *                             required to write the table.
    */
-  void writeCameraSettings();
+  void writeCameraSettings(unsigned minWeightTablePeriod = 0, int minWeightTableChange = 1);
 
   void readCameraSettings();
 
@@ -185,19 +221,40 @@ private:
   CameraSettingsCollection appliedSettings; /**< The camera settings that are known to be applied. */
   CameraSettingsSpecial specialSettings; /**< Special settings that are only set */
 
-  static constexpr unsigned frameBufferCount = 3; /**< Amount of available frame buffers. */
+  static constexpr unsigned maxFrameBufferCount = 8; /**< Maximum amount of frame buffers. */
 
   unsigned WIDTH; /**< The width of the yuv 422 image */
   unsigned HEIGHT; /**< The height of the yuv 422 image */
   int fd; /**< The file descriptor for the video device. */
-  void* mem[frameBufferCount]; /**< Frame buffer addresses. */
-  int memLength[frameBufferCount]; /**< The length of each frame buffer. */
+  unsigned frameBufferCount; /**< Amount of available frame buffers. */
+  void* mem[maxFrameBufferCount]; /**< Frame buffer addresses. */
+  int memLength[maxFrameBufferCount]; /**< The length of each frame buffer. */
+  unsigned holders[maxFrameBufferCount] = {0}; /**< The number of holders of each frame buffer. */
+  bool requeuePending[maxFrameBufferCount] = {false}; /**< Must the frame buffer be requeued when its last holder releases it? */
+  std::mutex holdMutex; /**< Protects \c holders and \c requeuePending. */
+  std::condition_variable heldImageReleased; /**< Signals that a held frame buffer was released. */
   struct v4l2_buffer* buf = nullptr; /**< Reusable parameter struct for some ioctl calls. */
   struct v4l2_buffer* currentBuf = nullptr; /**< The last dequeued frame buffer. */
   bool first = true; /**< First image grabbed? */
   unsigned long long timestamp = 0; /**< Timestamp of the last captured image in microseconds. */
+  unsigned long long weightTableTimestamp = 0; /**< Timestamp of the image when the auto exposure weight table was written the last time in microseconds. */
   bool pollTimedOut = false; /**< Did poll timeout recently? */
 
+  /**
+   * Requeues a frame buffer unless it is held. In that case, it is requeued
+   * when the last holder releases it.
+   * @param index The index of the frame buffer.
+   * @return Was requeuing successful?
+   */
+  bool requeueBuffer(unsigned index);
+
+  /**
+   * Queues a frame buffer, so the driver can capture an image into it.
+   * @param index The index of the frame buffer.
+   * @return Was queuing successful?
+   */
+  bool queueBuffer(unsigned index) const;
+
   bool checkSettingsAvailability();
 
   bool checkV4L2Setting(V4L2Setting& setting) const;
@@ -13,6 +13,7 @@
 #include "Debugging/DebugImages.h"
 #include "Debugging/Plot.h"
 #include "Framework/ModuleContainer.h"
+#include "ImageProcessing/AVX.h"
 #include "Streaming/Global.h"
 #include "Streaming/Streamable.h"
 
@@ -37,6 +38,8 @@ LogDataProvider::LogDataProvider() :
 
 LogDataProvider::~LogDataProvider()
 {
+  if(logSchema)
+    delete logSchema;
   if(logTypeInfo)
     delete logTypeInfo;
 
@@ -45,6 +48,11 @@ LogDataProvider::~LogDataProvider()
 
 void LogDataProvider::update(CameraImage& cameraImage)
 {
+  // A reference from a previous packet points to memory that was already overwritten.
+  if(cameraImage.isReference() && !cameraImageReferenced)
+    cameraImage.setResolution(0, 0);
+  cameraImageReferenced = false;
+
   if(SystemCall::getMode() == SystemCall::logFileReplay)
   {
     if(theCameraInfo.width / 2 != static_cast<int>(cameraImage.width) || theCameraInfo.height != static_cast<int>(cameraImage.height))
@@ -81,7 +89,12 @@ bool LogDataProvider::handle(MessageQueue::Message message)
   if(message.id() == idTypeInfo)
   {
     if(!logTypeInfo)
+    {
       logTypeInfo = new TypeInfo(false);
+      logSchema = new DebugDataSchema(*logTypeInfo);
+    }
+    else
+      logSchema->clear();
     message.bin() >> *logTypeInfo;
     return true;
   }
@@ -111,7 +124,10 @@ bool LogDataProvider::handle(MessageQueue::Message message)
 void LogDataProvider::readMessage(MessageQueue::Message message, Streamable& representation)
 {
   if(states[message.id()] != convert)
-    message.bin() >> representation;
+  {
+    if(message.id() != idCameraImage || !referenceCameraImage(message, static_cast<CameraImage&>(representation)))
+      message.bin() >> representation;
+  }
   else
   {
     ASSERT(logTypeInfo);
@@ -120,7 +136,7 @@ void LogDataProvider::readMessage(MessageQueue::Message message, Streamable& rep
     // Stream into textual representation in memory using type specification of log file.
     OutMapMemory outMap(true, 16384);
     auto stream = message.bin();
-    DebugDataStreamer streamer(*logTypeInfo, stream, type);
+    DebugDataStreamer streamer(*logSchema, stream, type);
     outMap << streamer;
 
     // Read from textual representation. Errors are suppressed.
@@ -137,6 +153,40 @@ void LogDataProvider::readMessage(MessageQueue::Message message, Streamable& rep
   }
 }
 
+bool LogDataProvider::referenceCameraImage(MessageQueue::Message message, CameraImage& cameraImage) const
+{
+  unsigned width;
+  unsigned height;
+  unsigned timestamp;
+  InBinaryMemory stream = message.bin();
+  stream >> width >> height >> timestamp;
+  if(timestamp & (1 << 31))
+  {
+    height *= 2;
+    timestamp &= ~(1 << 31);
+  }
+
+  const char* pixels = message.data() + sizeof(width) + sizeof(height) + sizeof(timestamp);
+  if(!simdAligned<_supportsAVX2>(pixels)
+     || message.size() != sizeof(width) + sizeof(height) + sizeof(timestamp) + width * height * sizeof(CameraImage::PixelType))
+    return false;
+
+  // The messages received are not modified before the next packet arrives.
+  cameraImage.setReference(width, height, const_cast<char*>(pixels), timestamp);
+  return true;
+}
+
+void LogDataProvider::detachCameraImage(CameraImage& cameraImage)
+{
+  if(cameraImage.isReference())
+  {
+    const CameraImage::PixelType* pixels = cameraImage[0];
+    cameraImage.setResolution(cameraImage.width, cameraImage.height);
+    std::memcpy(cameraImage[0], pixels, cameraImage.width * cameraImage.height * sizeof(CameraImage::PixelType));
+  }
+  cameraImageReferenced = false;
+}
+
 bool LogDataProvider::handleMessage(MessageQueue::Message message)
 {
   return theInstance && theInstance->handleMessage2(message);
@@ -159,7 +209,12 @@ bool LogDataProvider::isFrameDataComplete(bool ack)
     return true;
   }
   else
+  {
+    // The frame continues in the next packet, which will overwrite the current one.
+    if(theInstance->cameraImageReferenced)
+      theInstance->detachCameraImage(static_cast<CameraImage&>(Blackboard::getInstance()["CameraImage"]));
     return false;
+  }
 }
 
 bool LogDataProvider::handleMessage2(MessageQueue::Message message)
@@ -170,6 +225,8 @@ bool LogDataProvider::handleMessage2(MessageQueue::Message message)
       handle<CameraImage, FrameInfo>(message, "CameraImage", "FrameInfo",
                                      [&](CameraImage& source, FrameInfo& target)
                                      {target.time = source.timestamp;});
+      if(ModuleGraphRunner::getInstance().getProvider("CameraImage") == "LogDataProvider")
+        cameraImageReferenced = static_cast<const CameraImage&>(Blackboard::getInstance()["CameraImage"]).isReference();
       return true;
 
     case idCameraInfo:
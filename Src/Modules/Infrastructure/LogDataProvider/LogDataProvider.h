@@ -66,6 +66,7 @@
 #include "Representations/Perception/ImagePreprocessing/ECImage.h"
 #include "Representations/Perception/ImagePreprocessing/FieldBoundary.h"
 #include "Representations/Perception/ImagePreprocessing/ImageCoordinateSystem.h"
+#include "Representations/Perception/ImagePreprocessing/ImagePatches.h"
 #include "Representations/Perception/ObstaclesPercepts/ObstaclesFieldPercept.h"
 #include "Representations/Perception/ObstaclesPercepts/ObstaclesImagePercept.h"
 #include "Representations/Perception/RefereePercept/Keypoints.h"
@@ -81,6 +82,7 @@
 #include "Representations/Sensing/JointAnglePred.h"
 #include "Representations/Sensing/JointPlay.h"
 #include "Representations/Sensing/RobotStableState.h"
+#include "Debugging/DebugDataSchema.h"
 #include "ImageProcessing/Image.h"
 #include "ImageProcessing/PixelTypes.h"
 #include "Streaming/MessageIDs.h"
@@ -107,6 +109,7 @@ MODULE(LogDataProvider,
   PROVIDES(ArmMotionRequest),
   PROVIDES(AudioData),
   PROVIDES(BallModel),
+  PROVIDES(BallPatches),
   PROVIDES(BallPercept),
   PROVIDES(BallSpots),
   PROVIDES(BehaviorStatus),
@@ -143,6 +146,7 @@ MODULE(LogDataProvider,
   PROVIDES(InertialData),
   PROVIDES(InertialSensorData),
   PROVIDES(InitialToReady),
+  PROVIDES(IntersectionPatches),
   PROVIDES(IntersectionsPercept),
   PROVIDES(JointAnglePred),
   PROVIDES(JointAngles),
@@ -168,6 +172,7 @@ MODULE(LogDataProvider,
   PROVIDES(ReceivedTeamMessages),
   PROVIDES(RefereePercept),
   PROVIDES(RobotHealth),
+  PROVIDES(RobotPatches),
   PROVIDES(RobotPose),
   PROVIDES(RobotStableState),
   PROVIDES(SelfLocalizationHypotheses),
@@ -197,7 +202,9 @@ private:
 
   std::array<State, numOfDataMessageIDs> states; /**< Should the corresponding message ids be replayed? */
   TypeInfo* logTypeInfo = nullptr; /**< The specifications of all the types from the log file. */
+  DebugDataSchema* logSchema = nullptr; /**< The types from the log file compiled for converting them. */
   bool frameDataComplete; /**< Were all messages of the current frame received? */
+  bool cameraImageReferenced = false; /**< Does the camera image reference a message received with the current packet? */
   OdometryData lastOdometryData; /**< The last odometry data that was provided. Used for computing offset. */
 
   // No-op update stubs
@@ -207,6 +214,7 @@ private:
   void update(ArmMotionRequest&) override {}
   void update(AudioData&) override {}
   void update(BallModel&) override {}
+  void update(BallPatches&) override {}
   void update(BallPercept&) override {}
   void update(BallSpots&) override {}
   void update(BehaviorStatus&) override {}
@@ -242,6 +250,7 @@ private:
   void update(IndirectKick&) override {}
   void update(InertialSensorData&) override {}
   void update(InitialToReady&) override {}
+  void update(IntersectionPatches&) override {}
   void update(IntersectionsPercept&) override {}
   void update(JointAnglePred&) override {}
   void update(JointAngles&) override {}
@@ -269,6 +278,7 @@ private:
   void update(ReceivedTeamMessages&) override {}
   void update(RefereePercept&) override {}
   void update(RobotHealth&) override {}
+  void update(RobotPatches&) override {}
   void update(RobotPose&) override {}
   void update(RobotStableState&) override {}
   void update(SelfLocalizationHypotheses&) override {}
@@ -301,6 +311,23 @@ private:
    */
   void readMessage(MessageQueue::Message message, Streamable& representation);
 
+  /**
+   * Lets a camera image reference the pixels in a message instead of copying
+   * them. This is only possible if the pixels are suitably aligned for SIMD
+   * access. The reference is only valid until the next packet is received.
+   * @param message The message containing the camera image.
+   * @param cameraImage The camera image that will reference the message.
+   * @return Could the image be referenced? Otherwise, it must be read normally.
+   */
+  bool referenceCameraImage(MessageQueue::Message message, CameraImage& cameraImage) const;
+
+  /**
+   * Copies the pixels of the camera image if it still references a message,
+   * because that message will not survive receiving the next packet.
+   * @param cameraImage The camera image that might reference a message.
+   */
+  void detachCameraImage(CameraImage& cameraImage);
+
   /**
    * The method is called for every incoming debug message by handleMessage.
    * @param message An interface to read the message from the queue.
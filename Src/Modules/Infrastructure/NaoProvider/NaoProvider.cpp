@@ -11,6 +11,7 @@
 #include "Platform/File.h"
 #include "Platform/Thread.h"
 #include "Platform/Time.h"
+#include "Debugging/TimingManager.h"
 #include "Tools/Communication/MsgPack.h"
 #include "Streaming/Global.h"
 #include "Framework/Settings.h"
@@ -267,6 +268,7 @@ NaoProvider::~NaoProvider()
 void NaoProvider::update(FrameInfo& theFrameInfo)
 {
   theFrameInfo.time = timeWhenPacketReceived;
+  theFrameInfo.timeFraction = timeFractionWhenPacketReceived;
 }
 
 void NaoProvider::update(FsrSensorData& theFsrSensorData)
@@ -359,11 +361,26 @@ void NaoProvider::receivePacket()
     OUTPUT_ERROR("Could not receive packet from NAO");
   else
   {
-    timeWhenPacketReceived = std::max(Time::getCurrentSystemTime(), timeWhenPacketReceived + 1);
+    packetReceived = std::chrono::steady_clock::now();
+    const unsigned long long now = Time::getCurrentSystemTimeNs();
+    if(static_cast<unsigned>(now / 1000000) > timeWhenPacketReceived)
+    {
+      timeWhenPacketReceived = static_cast<unsigned>(now / 1000000);
+      timeFractionWhenPacketReceived = static_cast<unsigned>(now % 1000000);
+    }
+    else
+    {
+      ++timeWhenPacketReceived;
+      timeFractionWhenPacketReceived = 0;
+    }
 
-    // Initialize tables if they have not been so far
-    if(!batteryLevel)
+    // Initialize tables if they have not been so far. All values in the packet have a fixed size,
+    // so a packet of a different size has a different layout and the tables must be set up again.
+    if(!batteryLevel || static_cast<int>(bytesRead) != receivedPacketSize)
     {
+      if(batteryLevel)
+        OUTPUT_WARNING("Size of LoLA packets changed from " << receivedPacketSize << " to " << static_cast<int>(bytesRead) << " bytes");
+      receivedPacketSize = static_cast<int>(bytesRead);
       MsgPack::parse(receivedPacket, bytesRead,
 
         // Most data is encoded as float 32
@@ -492,7 +509,14 @@ void NaoProvider::sendPacket()
                         : state == LEDRequest::half ? 0.5f : 0.0f, leds[led]);
   }
 
+  // The latencies from receiving the sensor data to sending the joint request are shown with the stopwatches.
+  const auto latencySince = [this]
+  {
+    return static_cast<unsigned>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - packetReceived).count());
+  };
+  Global::getTimingManager().addTiming("module:NaoProvider:latency:request", latencySince());
   VERIFY(send(socket, reinterpret_cast<char*>(packetToSend), packetToSendSize, 0) == static_cast<ssize_t>(packetToSendSize));
+  Global::getTimingManager().addTiming("module:NaoProvider:latency:sent", latencySince());
 }
 
 void NaoProvider::waitForFrameData()
@@ -18,6 +18,7 @@
 #include "Representations/Infrastructure/SensorData/RawInertialSensorData.h"
 #include "Representations/Infrastructure/SensorData/SystemSensorData.h"
 #include "Framework/Module.h"
+#include <chrono>
 
 MODULE(NaoProvider,
 {,
@@ -62,6 +63,7 @@ class NaoProvider : public NaoProviderBase
 
   int socket; /**< Socket to connect to LoLA. */
   unsigned char receivedPacket[896]; /**< The last packet received from LoLA. */
+  int receivedPacketSize = 0; /**< The size of the packet the addresses into receivedPacket were determined for. */
   unsigned char packetToSend[1000]; /**< The packet to send to LoLA. */
   size_t packetToSendSize; /**< The size of the packet to send. */
 
@@ -82,6 +84,8 @@ class NaoProvider : public NaoProviderBase
   std::array<unsigned char*, Joints::numOfJoints> jointStiffnesses; /**< The addresses of joint stiffness data inside packetToSend. */
   std::array<unsigned char*, LEDRequest::numOfLEDs> leds; /**< The addresses of led data inside packetToSend. */
   unsigned timeWhenPacketReceived = 0; /**< The time when the last packet was received. */
+  unsigned timeFractionWhenPacketReceived = 0; /**< The nanoseconds within the millisecond when the last packet was received. */
+  std::chrono::steady_clock::time_point packetReceived; /**< The real time when the last packet was received (for measuring the latency). */
   unsigned timeWhenChestButtonUnpressed = 0; /**< The last time the chest button was not pressed. */
   unsigned timeWhenBatteryLevelWritten = 0; /**< The last time the battery level was written to a file. */
   unsigned timeWhenCPUTemperatureRead = 0; /**< The last time the CPU temperature was read. */
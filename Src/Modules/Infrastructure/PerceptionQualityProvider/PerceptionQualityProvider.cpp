@@ -0,0 +1,70 @@
+/**
+ * @file PerceptionQualityProvider.cpp
+ *
+ * This file implements a module that selects how much detail the perception
+ * modules provide based on the health of the robot.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "PerceptionQualityProvider.h"
+#include "Debugging/Annotation.h"
+#include "Debugging/Plot.h"
+#include "Platform/SystemCall.h"
+#include <algorithm>
+
+MAKE_MODULE(PerceptionQualityProvider);
+
+void PerceptionQualityProvider::update(PerceptionQuality& thePerceptionQuality)
+{
+  DECLARE_PLOT("module:PerceptionQualityProvider:level");
+
+  if(SystemCall::getMode() != SystemCall::physicalRobot && !adaptInSimulation)
+    thePerceptionQuality.level = PerceptionQuality::full;
+  else
+  {
+    const PerceptionQuality::Level previousLevel = thePerceptionQuality.level;
+    if(!timeWhenLevelWasRequired)
+      timeWhenLevelWasRequired = timeWhenHigherLevelWasImpossible = theFrameInfo.time; // The delays start with the first frame.
+
+    // Degrade immediately to the required level after it was required for a while.
+    if(getRequiredLevel(0.f) <= thePerceptionQuality.level)
+      timeWhenLevelWasRequired = theFrameInfo.time;
+    else if(theFrameInfo.getTimeSince(timeWhenLevelWasRequired) >= degradeDelay)
+      thePerceptionQuality.level = getRequiredLevel(0.f);
+
+    // Recover one level at a time after a better level was possible for a while.
+    if(thePerceptionQuality.level == PerceptionQuality::full || getRequiredLevel(1.f) >= thePerceptionQuality.level)
+      timeWhenHigherLevelWasImpossible = theFrameInfo.time;
+    else if(theFrameInfo.getTimeSince(timeWhenHigherLevelWasImpossible) >= recoverDelay)
+    {
+      thePerceptionQuality.level = static_cast<PerceptionQuality::Level>(thePerceptionQuality.level - 1);
+      timeWhenHigherLevelWasImpossible = theFrameInfo.time;
+    }
+
+    if(thePerceptionQuality.level != previousLevel)
+    {
+      thePerceptionQuality.timeWhenLevelChanged = theFrameInfo.time;
+      timeWhenLevelWasRequired = theFrameInfo.time;
+      ANNOTATION("PerceptionQualityProvider", "Perception quality " << TypeRegistry::getEnumName(thePerceptionQuality.level)
+                 << " (CPU " << static_cast<int>(theRobotHealth.cpuTemperature) << " °C, cognition "
+                 << theRobotHealth.cognitionFrameRate << " Hz, motion " << theRobotHealth.maxMotionTime << " ms)");
+      OUTPUT_TEXT("Perception quality changed to " << TypeRegistry::getEnumName(thePerceptionQuality.level));
+    }
+  }
+
+  PLOT("module:PerceptionQualityProvider:level", static_cast<int>(thePerceptionQuality.level));
+}
+
+PerceptionQuality::Level PerceptionQualityProvider::getRequiredLevel(float margin) const
+{
+  PerceptionQuality::Level required = PerceptionQuality::full;
+  FOREACH_ENUM(PerceptionQuality::Level, level)
+    if(level != PerceptionQuality::full
+       && (theRobotHealth.cpuTemperature + margin * static_cast<float>(cpuTemperatureHysteresis) >= static_cast<float>(cpuTemperatures[level])
+           || (theRobotHealth.cognitionFrameRate > 0.f
+               && theRobotHealth.cognitionFrameRate - margin * cognitionFrameRateHysteresis < cognitionFrameRates[level])
+           || theRobotHealth.maxMotionTime + margin * maxMotionTimeHysteresis > maxMotionTimes[level]))
+      required = level;
+  return required;
+}
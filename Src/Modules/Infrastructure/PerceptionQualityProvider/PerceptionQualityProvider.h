@@ -0,0 +1,57 @@
+/**
+ * @file PerceptionQualityProvider.h
+ *
+ * This file declares a module that selects how much detail the perception
+ * modules provide based on the health of the robot. The quality is decreased
+ * if the CPU gets hot, the cognition thread does not reach its frame rate, or
+ * the motion thread comes close to missing its deadlines. It is only increased
+ * again after the situation has been relaxed for a while.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Framework/Module.h"
+#include "Representations/Infrastructure/FrameInfo.h"
+#include "Representations/Infrastructure/PerceptionQuality.h"
+#include "Representations/Infrastructure/RobotHealth.h"
+
+MODULE(PerceptionQualityProvider,
+{,
+  REQUIRES(FrameInfo),
+  REQUIRES(RobotHealth),
+  PROVIDES(PerceptionQuality),
+  LOADS_PARAMETERS(
+  {,
+    (bool) adaptInSimulation, /**< Is the quality also adapted if not running on a real robot? */
+    (ENUM_INDEXED_ARRAY(int, PerceptionQuality::Level)) cpuTemperatures, /**< The CPU temperature that requires each level (in °C). */
+    (ENUM_INDEXED_ARRAY(float, PerceptionQuality::Level)) cognitionFrameRates, /**< Cognition frame rates below these values require each level (in Hz). */
+    (ENUM_INDEXED_ARRAY(float, PerceptionQuality::Level)) maxMotionTimes, /**< Motion execution times above these values require each level (in ms). */
+    (int) cpuTemperatureHysteresis, /**< The CPU must be that much cooler than a threshold to recover from a level (in °C). */
+    (float) cognitionFrameRateHysteresis, /**< The frame rate must be that much higher than a threshold to recover from a level (in Hz). */
+    (float) maxMotionTimeHysteresis, /**< The motion time must be that much shorter than a threshold to recover from a level (in ms). */
+    (int) degradeDelay, /**< How long must a lower level be required before switching to it (in ms)? */
+    (int) recoverDelay, /**< How long must a higher level be possible before switching to it (in ms)? */
+  }),
+});
+
+class PerceptionQualityProvider : public PerceptionQualityProviderBase
+{
+  unsigned timeWhenLevelWasRequired = 0; /**< When did the current level fit the last time? */
+  unsigned timeWhenHigherLevelWasImpossible = 0; /**< When was a higher level not possible the last time? */
+
+  /**
+   * This method is called when the representation provided needs to be updated.
+   * @param thePerceptionQuality The representation updated.
+   */
+  void update(PerceptionQuality& thePerceptionQuality) override;
+
+  /**
+   * Determines the lowest level the current health of the robot requires.
+   * @param margin The ratio of the hysteresis that is added to the thresholds
+   *               (0 when degrading, 1 when recovering).
+   * @return The level required.
+   */
+  PerceptionQuality::Level getRequiredLevel(float margin) const;
+};
@@ -6,9 +6,12 @@
  */
 
 #include "Debugging/Annotation.h"
+#include "Debugging/TimingManager.h"
 #include "MotionRobotHealthProvider.h"
 #include "Platform/SystemCall.h"
 #include "Platform/Time.h"
+#include <algorithm>
+#include <string>
 
 MAKE_MODULE(MotionRobotHealthProvider);
 
@@ -46,6 +49,7 @@ void MotionRobotHealthProvider::update(MotionRobotHealth& motionRobotHealth)
     motionRobotHealth.motionFramesDropped = numOfDroppedFrames *
                                             (frameDroppedDueToSensorData || frameDroppedDueToTime); // Multiplication to get zero in case no frame was dropped
 
+    motionRobotHealth.totalMotionFramesDropped += motionRobotHealth.motionFramesDropped;
     motionRobotHealth.frameLostStatus = MotionRobotHealth::noFrameLost;
 
     if(motionRobotHealth.motionFramesDropped)
@@ -53,6 +57,8 @@ void MotionRobotHealthProvider::update(MotionRobotHealth& motionRobotHealth)
       motionRobotHealth.frameLostStatus = MotionRobotHealth::oneFrameLost;
       if(motionRobotHealth.motionFramesDropped >= multipleFramesDroppedThreshold)
         motionRobotHealth.frameLostStatus = MotionRobotHealth::multipleFramesLost;
+      if(motionRobotHealth.motionFramesDropped * Constants::motionCycleTime <= bodyDisconnectThreshold)
+        annotateSlowestStopwatches(motionRobotHealth.motionFramesDropped);
       if(motionRobotHealth.motionFramesDropped * Constants::motionCycleTime > bodyDisconnectThreshold)
       {
         motionRobotHealth.frameLostStatus = MotionRobotHealth::bodyDisconnect;
@@ -73,3 +79,16 @@ void MotionRobotHealthProvider::update(MotionRobotHealth& motionRobotHealth)
   lastFrameTime = theFrameInfo.time;
   executionTimes += !(executionTimes > executionTimesThreshold);
 }
+
+void MotionRobotHealthProvider::annotateSlowestStopwatches(unsigned numOfDroppedFrames)
+{
+  // The previous frame is the one that took too long. Its measurements are still available.
+  slowestStopwatches = Global::getTimingManager().getLastFrameTimings();
+  const std::size_t numOfReported = std::min(static_cast<std::size_t>(numOfReportedStopwatches), slowestStopwatches.size());
+  std::partial_sort(slowestStopwatches.begin(), slowestStopwatches.begin() + numOfReported, slowestStopwatches.end(),
+                    [](const std::pair<const char*, unsigned>& a, const std::pair<const char*, unsigned>& b) {return a.second > b.second;});
+  std::string slowest;
+  for(std::size_t i = 0; i < numOfReported; ++i)
+    slowest += (i ? ", " : "") + std::string(slowestStopwatches[i].first) + " " + std::to_string(slowestStopwatches[i].second / 1000.f) + "ms";
+  ANNOTATION("MotionRobotHealthProvider", numOfDroppedFrames << " motion frame(s) dropped, slowest in previous frame: " << slowest);
+}
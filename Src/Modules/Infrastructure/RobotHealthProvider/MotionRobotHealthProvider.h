@@ -27,6 +27,7 @@ MODULE(MotionRobotHealthProvider,
     (unsigned)(3) multipleFramesDroppedThreshold, /**< Number of frames that must be dropped in a row to consider it as multiple frames. */
     (float)(0.1) bodyDisconnectThreshold, /**< If the time between the last motion frame and the current is more then this (in seconds) we consider it a body disconnect. 100ms*/
     (unsigned)(1) executionTimesThreshold, /**< Only after this number of executions body disconnect will be detected. */
+    (unsigned)(3) numOfReportedStopwatches, /**< The number of the slowest stopwatches of the previous frame that are annotated when frames were dropped. */
   }),
 });
 
@@ -42,6 +43,12 @@ private:
    */
   void update(MotionRobotHealth& motionRobotHealth) override;
 
+  /**
+   * Annotates the stopwatches that took the longest in the previous frame.
+   * @param numOfDroppedFrames The number of motion frames dropped after the previous frame.
+   */
+  void annotateSlowestStopwatches(unsigned numOfDroppedFrames);
+
   RingBufferWithSum<unsigned, 30> timeBuffer; /**< Buffered timestamps of previous executions */
   unsigned lastExecutionTime;
   unsigned lastFrameTime;
@@ -51,6 +58,8 @@ private:
 
   RawInertialSensorData lastInertialSensorData;
 
+  std::vector<std::pair<const char*, unsigned>> slowestStopwatches; /**< Buffer for sorting the measurements of the previous frame. */
+
 public:
   /** Constructor. */
   MotionRobotHealthProvider() : lastExecutionTime(0), lastFrameTime(0), executionTimes(0) {}
@@ -88,7 +88,7 @@ public:
  * State estimation for a stationary / lying ball.
  * Based on a standard Kalman filter
  */
-class StationaryBallKalmanFilter : public BallStateEstimate
+class StationaryBallKalmanFilter final : public BallStateEstimate
 {
 public:
   Vector2f x = Vector2f::Zero();       /**< Mean of the estimated stationary ball */
@@ -148,7 +148,7 @@ public:
  * State estimation for a rolling ball.
  * Based on a standard Kalman filter
  */
-class RollingBallKalmanFilter : public BallStateEstimate
+class RollingBallKalmanFilter final : public BallStateEstimate
 {
 public:
   Vector4f x = Vector4f::Zero();           /**< Mean of the estimated rolling ball */
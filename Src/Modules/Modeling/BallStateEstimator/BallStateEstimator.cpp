@@ -50,6 +50,10 @@ void BallStateEstimator::reset()
 {
   stationaryBalls.clear();
   rollingBalls.clear();
+  // Both buffers are pruned to maxNumberOfHypotheses - 1 entries before at most one new
+  // filter is added to each of them. Conversions only move filters between the buffers.
+  // Therefore, the total number of filters never exceeds 2 * maxNumberOfHypotheses and
+  // no allocations happen after this point.
   stationaryBalls.reserve(maxNumberOfHypotheses * 2);
   rollingBalls.reserve(maxNumberOfHypotheses * 2);
   bestState = nullptr;
@@ -227,20 +231,24 @@ void BallStateEstimator::motionUpdate(BallModel& ballModel)
   // Check, if some of the rolling balls have stopped and move them to the buffer
   // that contains the stationary balls. They are added to the end of the list, which
   // now might temporarily exceed its limit.
-  auto rBall = rollingBalls.begin();
-  while(rBall != rollingBalls.end())
+  // The remaining rolling balls are compacted in a single pass instead of erasing
+  // each stopped ball individually.
+  auto remainingRollingBall = rollingBalls.begin();
+  for(RollingBallKalmanFilter& rBall : rollingBalls)
   {
-    if(rBall->getVelocity().norm() < minSpeed)
+    if(rBall.getVelocity().norm() < minSpeed)
     {
-      stationaryBalls.push_back(rBall->toStationaryBallKalmanFilter());
-      rBall = rollingBalls.erase(rBall);
+      stationaryBalls.push_back(rBall.toStationaryBallKalmanFilter());
       recomputeBestState = true;  // as pointer bestState might be incorrect after this operation
     }
     else
     {
-      ++rBall;
+      if(&*remainingRollingBall != &rBall)
+        *remainingRollingBall = rBall;
+      ++remainingRollingBall;
     }
   }
+  rollingBalls.erase(remainingRollingBall, rollingBalls.end());
 }
 
 void BallStateEstimator::normalizeMeasurementLikelihoods()
@@ -469,30 +477,29 @@ void BallStateEstimator::integrateCollisionWithFeet()
       state.timeOfLastCollision = theFrameInfo.time;
     }
   }
-  auto sBall = stationaryBalls.begin();
-  while(sBall != stationaryBalls.end())
+  auto remainingStationaryBall = stationaryBalls.begin();
+  for(StationaryBallKalmanFilter& sBall : stationaryBalls)
   {
-    if(theBallContactChecker.collide(sBall->getPosition(), sBall->getVelocity(), sBall->lastPosition, contactInfo))
+    if(theBallContactChecker.collide(sBall.getPosition(), sBall.getVelocity(), sBall.lastPosition, contactInfo))
     {
       if(contactInfo.newVelocity.norm() < minSpeed) // Ball does not start moving
       {
-        sBall->x = contactInfo.newPosition;
-        sBall->timeOfLastCollision = theFrameInfo.time;
-        ++sBall;
+        sBall.x = contactInfo.newPosition;
+        sBall.timeOfLastCollision = theFrameInfo.time;
       }
       else // Ball is rolling after collision -> Create a rolling ball and delete stationary ball
       {
-        rollingBalls.emplace_back(*sBall, contactInfo.newPosition, contactInfo.newVelocity, contactInfo.addVelocityCov);
+        rollingBalls.emplace_back(sBall, contactInfo.newPosition, contactInfo.newVelocity, contactInfo.addVelocityCov);
         rollingBalls.back().timeOfLastCollision = theFrameInfo.time;
-        sBall = stationaryBalls.erase(sBall);
         recomputeBestState = true;  // as pointer bestState might be incorrect after this operation
+        continue;
       }
     }
-    else
-    {
-      ++sBall;
-    }
+    if(&*remainingStationaryBall != &sBall)
+      *remainingStationaryBall = sBall;
+    ++remainingStationaryBall;
   }
+  stationaryBalls.erase(remainingStationaryBall, stationaryBalls.end());
 }
 
 void BallStateEstimator::plotAndDraw()
@@ -11,6 +11,7 @@
 
 #include "GlobalOpponentsTracker.h"
 #include "Debugging/DebugDrawings.h"
+#include "Tools/Math/Assignment.h"
 
 MAKE_MODULE(GlobalOpponentsTracker);
 
@@ -227,6 +228,7 @@ void GlobalOpponentsTracker::addPlayerPercepts()
 
   merged.clear();
   merged.resize(obstacleHypotheses.size(), false);
+  measurements.clear();
 
   for(const ObstaclesFieldPercept::Obstacle& percept : theObstaclesFieldPercept.obstacles)
   {
@@ -246,8 +248,14 @@ void GlobalOpponentsTracker::addPlayerPercepts()
     // Obstacles have a minimum size
     if((obstacle.left - obstacle.right).squaredNorm() < sqr(2 * Obstacle::getRobotDepth()))
       obstacle.setLeftRight(Obstacle::getRobotDepth());
-    tryToMerge(obstacle);
+    if(useOptimalAssignment)
+      measurements.emplace_back(obstacle);
+    else
+      tryToMerge(obstacle);
   }
+
+  if(!measurements.empty())
+    assignAndMerge(measurements);
 }
 
 void GlobalOpponentsTracker::tryToMerge(const GlobalOpponentsHypothesis& measurement)
@@ -281,16 +289,7 @@ void GlobalOpponentsTracker::tryToMerge(const GlobalOpponentsHypothesis& measure
   // Merge
   if(possibleMergeDistSquared < std::numeric_limits<float>::max())
   {
-    LINE("module:ObstacleModelProvider:merge", measurement.center.x(), measurement.center.y(),
-      obstacleHypotheses[atMerge].center.x(), obstacleHypotheses[atMerge].center.y(), 10, Drawings::dashedPen, ColorRGBA::red);
-
-    obstacleHypotheses[atMerge].lastSeen = measurement.lastSeen;
-
-    obstacleHypotheses[atMerge].measurement(measurement, modelWidthWeighting); // EKF
-    obstacleHypotheses[atMerge].determineAndSetType(measurement, teamThreshold, uprightThreshold);
-    obstacleHypotheses[atMerge].seenCount += measurement.seenCount;
-    obstacleHypotheses[atMerge].notSeenButShouldSeenCount = 0; // Reset that counter.
-    merged[atMerge] = true;
+    merge(atMerge, measurement);
     return;
   }
 
@@ -299,6 +298,58 @@ void GlobalOpponentsTracker::tryToMerge(const GlobalOpponentsHypothesis& measure
   merged.push_back(true);
 }
 
+void GlobalOpponentsTracker::assignAndMerge(const std::vector<GlobalOpponentsHypothesis, Eigen::aligned_allocator<GlobalOpponentsHypothesis>>& measurements)
+{
+  // Each measurement can either be assigned to an existing hypothesis within its merge
+  // radius (cost: squared distance relative to the squared radius, i.e. at most 1) or
+  // create a new hypothesis (cost: 1). Each measurement has its own column for creating
+  // a new hypothesis, so a pair that is not allowed is never part of the optimal solution.
+  constexpr float notAllowed = 2.f;
+  const std::size_t numOfHypotheses = obstacleHypotheses.size();
+  const std::size_t columns = numOfHypotheses + measurements.size();
+  assignmentCosts.assign(measurements.size() * columns, notAllowed);
+  for(std::size_t i = 0; i < measurements.size(); ++i)
+  {
+    const GlobalOpponentsHypothesis& measurement = measurements[i];
+    float* costs = assignmentCosts.data() + i * columns;
+    const float mergeDistanceSquared = sqr(calculateMergeRadius(measurement.center));
+    for(std::size_t j = 0; j < numOfHypotheses; ++j)
+      if(!merged[j])
+      {
+        const float distanceSquared = (measurement.center - obstacleHypotheses[j].center).squaredNorm();
+        if(distanceSquared <= mergeDistanceSquared)
+          costs[j] = distanceSquared / mergeDistanceSquared;
+      }
+    costs[numOfHypotheses + i] = 1.f;
+  }
+
+  Assignment::solve(assignmentCosts, measurements.size(), columns, assignment);
+
+  for(std::size_t i = 0; i < measurements.size(); ++i)
+    if(assignment[i] < numOfHypotheses && assignmentCosts[i * columns + assignment[i]] < notAllowed)
+      merge(assignment[i], measurements[i]);
+    else
+    {
+      obstacleHypotheses.emplace_back(measurements[i]);
+      merged.push_back(true);
+    }
+}
+
+void GlobalOpponentsTracker::merge(std::size_t index, const GlobalOpponentsHypothesis& measurement)
+{
+  GlobalOpponentsHypothesis& obstacle = obstacleHypotheses[index];
+  LINE("module:ObstacleModelProvider:merge", measurement.center.x(), measurement.center.y(),
+    obstacle.center.x(), obstacle.center.y(), 10, Drawings::dashedPen, ColorRGBA::red);
+
+  obstacle.lastSeen = measurement.lastSeen;
+
+  obstacle.measurement(measurement, modelWidthWeighting); // EKF
+  obstacle.determineAndSetType(measurement, teamThreshold, uprightThreshold);
+  obstacle.seenCount += measurement.seenCount;
+  obstacle.notSeenButShouldSeenCount = 0; // Reset that counter.
+  merged[index] = true;
+}
+
 void GlobalOpponentsTracker::mergeOverlapping()
 {
   // TODO The merge with velocity is still missing here. The reason for this is that tests are necessary to see how precise it is.
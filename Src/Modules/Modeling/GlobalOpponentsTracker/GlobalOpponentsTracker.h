@@ -75,6 +75,7 @@ MODULE(GlobalOpponentsTracker,
     // tryToMerge()
     (float) modelWidthWeighting,               /**< Factor for weighted sum for calculating the width of an obstacle. Currently modeled width is weighted by this factor, measured width is weighted with 1. */
     (float) maxMergeRadius,                    /**< Maximal radius of an obstacle to be considered as nearby. */
+    (bool) useOptimalAssignment,               /**< Assign all percepts of a frame jointly to the hypotheses instead of one after another to the closest one. */
     // mergeOverlapping()
     (unsigned) mergeOverlapTimeDiff,           /**< Merge overlapping models if they are measured. Avoid merging of oscillating obstacles. */
     (float) minMahalanobisDistance,            /**< The minimum Mahalanobis distance to merge obstacles. */
@@ -103,6 +104,9 @@ public:
   GlobalOpponentsTracker();
   std::vector<GlobalOpponentsHypothesis, Eigen::aligned_allocator<GlobalOpponentsHypothesis>> obstacleHypotheses; /**< List of obstacles. */
   std::vector<bool> merged; /**< This is to merge obstacles once for every "percept" per frame. */
+  std::vector<GlobalOpponentsHypothesis, Eigen::aligned_allocator<GlobalOpponentsHypothesis>> measurements; /**< The measurements of the current frame if they are assigned jointly. */
+  std::vector<float> assignmentCosts; /**< The costs of all pairs of measurements and hypotheses (including new ones). */
+  std::vector<std::size_t> assignment; /**< The hypothesis assigned to each measurement. */
   // Used for writing annotations only once per contact.
   bool armContact[Arms::numOfArms] = { false, false }, footContact[Legs::numOfLegs] = { false, false };
 
@@ -161,6 +165,21 @@ private:
    */
   void tryToMerge(const GlobalOpponentsHypothesis& measurement);
 
+  /**
+   * The function assigns all measurements to existing hypotheses such that the sum of
+   * their normalized squared distances is minimal. Measurements that are not assigned
+   * to a hypothesis within their merge radius create new hypotheses.
+   * @param measurements The measurements to merge.
+   */
+  void assignAndMerge(const std::vector<GlobalOpponentsHypothesis, Eigen::aligned_allocator<GlobalOpponentsHypothesis>>& measurements);
+
+  /**
+   * The function integrates a measurement into an existing hypothesis.
+   * @param index The index of the hypothesis in the list obstacleHypotheses.
+   * @param measurement The measurement to integrate.
+   */
+  void merge(std::size_t index, const GlobalOpponentsHypothesis& measurement);
+
   /** The function will merge overlapping hypotheses to one hypotheses. */
   void mergeOverlapping();
   /** The function increases the attribute notSeenButShouldSeenCount of obstacles that should be seen but wasn't seen recently. */
@@ -353,17 +353,21 @@ void ObstacleModelProvider::mergeOverlapping()
       if(std::max(actual.lastSeen, other.lastSeen) - std::min(actual.lastSeen, other.lastSeen) < mergeOverlapTimeDiff)
         continue;
 
+      // Continue if their types are known and different. This is checked first, because it is the cheapest test.
+      if(!(actual.isUnknown() || actual.isSomeRobot() || other.isUnknown() || other.isSomeRobot()
+           || actual.type == other.type))
+        continue;
+
       // The sum of the radius of the obstacles.
       const float overlap = ((actual.left - actual.right).norm() + (other.left - other.right).norm()) * .5f;
-      // The distance of the centers
-      const float distanceOfCenters = (other.center - actual.center).norm();
-
-      // Merge the obstacles.
-      if(((distanceOfCenters <= overlap || distanceOfCenters < 2 * Obstacle::getRobotDepth()) // The obstacles are overlapping
-          || (actual.squaredMahalanobis(other) < sqr(minMahalanobisDistance)
-              && (actual.seenCount >= minPercepts && other.seenCount >= minPercepts))) // they were seen at least minPercepts times
-         && (actual.isUnknown() || actual.isSomeRobot() || other.isUnknown() || other.isSomeRobot()
-             || actual.type == other.type)) // Their type is unknown, someRobot or fallenSomeRobot or their type is equal
+      // The squared distance of the centers
+      const float distanceOfCentersSquared = (other.center - actual.center).squaredNorm();
+
+      // Merge the obstacles if they are overlapping or if they were seen at least minPercepts times and
+      // are close w.r.t. their covariances. The latter is only computed if the former does not hold.
+      if(distanceOfCentersSquared <= sqr(overlap) || distanceOfCentersSquared < sqr(2 * Obstacle::getRobotDepth())
+         || (actual.seenCount >= minPercepts && other.seenCount >= minPercepts
+             && actual.squaredMahalanobis(other) < sqr(minMahalanobisDistance)))
       {
         Obstacle::fusion2D(actual, other);
         // Since fusion2D makes all previous positions unusable for a correct calculation.
@@ -399,16 +403,22 @@ void ObstacleModelProvider::shouldBeSeen()
     LINE("module:ObstacleModelProvider:cameraAngle", 0, 0, camRight.x(), camRight.y(), 10, Drawings::solidPen, cameraColor);
   }
 
+  // Check for all obstacle hypotheses at once whether they could be seen in the image,
+  // because this is needed again for each pair of hypotheses in isAnyObstacleInShadow.
+  inSight.resize(obstacleHypotheses.size());
+  centersInImage.resize(obstacleHypotheses.size());
+  for(std::size_t i = 0; i < obstacleHypotheses.size(); ++i)
+    inSight[i] = obstacleHypotheses[i].isBetween(cameraAngleLeft, cameraAngleRight)
+                 && obstacleHypotheses[i].isInImage(centersInImage[i], theCameraInfo, theCameraMatrix);
+
   // Iterate over the obstacle hypotheses
   for(std::size_t i = 0; i < obstacleHypotheses.size(); ++i)
   {
-    // check whether the obstacle could be seen in the image
     ObstacleHypothesis* closer = &(obstacleHypotheses[i]);
-    Vector2f centerInImage;
+    const Vector2f& centerInImage = centersInImage[i];
 
     // Continue with next obstacle if obstacle was seen in the last 300ms or is not in sight
-    if(theFrameInfo.getTimeSince(closer->lastSeen) < recentlySeenTime || !closer->isBetween(cameraAngleLeft, cameraAngleRight) ||
-       !closer->isInImage(centerInImage, theCameraInfo, theCameraMatrix))
+    if(theFrameInfo.getTimeSince(closer->lastSeen) < recentlySeenTime || !inSight[i])
       continue;
 
     COMPLEX_DRAWING("module:ObstacleModelProvider:obstacleNotSeen")
@@ -423,7 +433,7 @@ void ObstacleModelProvider::shouldBeSeen()
 
     // Increase notSeenButShouldSeen and continue with next obstacle if any other obstacle is in the shadow of the obstacle
     // or the field boundary is further as the obstacle
-    if(isAnyObstacleInShadow(closer, i, cameraAngleLeft, cameraAngleRight) || (theFieldBoundary.isValid &&
+    if(isAnyObstacleInShadow(closer, i) || (theFieldBoundary.isValid &&
         closer->isFieldBoundaryFurtherAsObstacle(theCameraInfo, theCameraMatrix, theImageCoordinateSystem, theFieldBoundary)))
     {
       closer->notSeenButShouldSeenCount += std::max(1u, notSeenThreshold / 10);
@@ -435,17 +445,14 @@ void ObstacleModelProvider::shouldBeSeen()
   }
 }
 
-bool ObstacleModelProvider::isAnyObstacleInShadow(ObstacleHypothesis* closer, const std::size_t i, const float cameraAngleLeft, const float cameraAngleRight)
+bool ObstacleModelProvider::isAnyObstacleInShadow(ObstacleHypothesis* closer, const std::size_t i)
 {
   for(std::size_t j = obstacleHypotheses.size() - 1; j > i; --j)
   {
     ObstacleHypothesis* further = &(obstacleHypotheses[j]);
 
     // If the further obstacle was not seen, but is in sight.
-    Vector2f centerInImage;
-    if(further->lastSeen != theFrameInfo.time
-       && further->isBetween(cameraAngleLeft, cameraAngleRight)
-       && further->isInImage(centerInImage, theCameraInfo, theCameraMatrix))
+    if(further->lastSeen != theFrameInfo.time && inSight[j])
     {
       // Swap further and closer if further obstacle is closer than closer obstacle
       if(further->center.squaredNorm() < closer->center.squaredNorm())
@@ -130,6 +130,8 @@ class ObstacleModelProvider : public ObstacleModelProviderBase
 
   std::vector<ObstacleHypothesis, Eigen::aligned_allocator<ObstacleHypothesis>> obstacleHypotheses; /**< List of obstacles. */
   std::vector<bool> merged; /**< This is to merge obstacles once for every "percept" per frame. */
+  std::vector<bool> inSight; /**< Whether each hypothesis is inside the camera's opening angle and its center is in the image. */
+  std::vector<Vector2f> centersInImage; /**< The centers of all hypotheses in image coordinates (only valid if in sight). */
   std::vector<TeammateMeasurement> teammateMeasurements; /**< Pseudo-measurements from team messages from the last frame. */
 
   /** The function is called when the representation provided needs to be updated. */
@@ -173,10 +175,8 @@ class ObstacleModelProvider : public ObstacleModelProviderBase
    * The function checks if any other obstacle is in the shadow of the obstacle closer.
    * @param closer The obstacle that may shadow other obstacles.
    * @param i The index of the obstacle closer in the list obstacleHypotheses.
-   * @param cameraAngleLeft The left camera angle.
-   * @param cameraAngleRight The right camera angle.
    */
-  bool isAnyObstacleInShadow(ObstacleHypothesis* closer, const std::size_t i, const float cameraAngleLeft, const float cameraAngleRight);
+  bool isAnyObstacleInShadow(ObstacleHypothesis* closer, const std::size_t i);
 
   float calculateMergeRadius(const Vector2f center, const unsigned maxRadius) const
   {
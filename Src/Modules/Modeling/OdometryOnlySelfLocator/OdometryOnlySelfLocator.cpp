@@ -34,4 +34,14 @@ void OdometryOnlySelfLocator::update(RobotPose& robotPose)
   }
 }
 
+void OdometryOnlySelfLocator::writeSnapshot(Out& stream) const
+{
+  stream << base << referenceOdometry;
+}
+
+void OdometryOnlySelfLocator::readSnapshot(In& stream)
+{
+  stream >> base >> referenceOdometry;
+}
+
 MAKE_MODULE(OdometryOnlySelfLocator);
@@ -26,7 +26,7 @@ MODULE(OdometryOnlySelfLocator,
  *
  * A new module for self-localization
  */
-class OdometryOnlySelfLocator : public OdometryOnlySelfLocatorBase
+class OdometryOnlySelfLocator : public OdometryOnlySelfLocatorBase, public ModuleSnapshot
 {
 private:
   Pose2f base;
@@ -38,4 +38,16 @@ private:
    * @param robotPose The robot pose representation that is updated by this module.
    */
   void update(RobotPose& robotPose) override;
+
+  /**
+   * Writes the poses the robot pose is computed from.
+   * @param stream The stream to write to.
+   */
+  void writeSnapshot(Out& stream) const override;
+
+  /**
+   * Restores the poses the robot pose is computed from.
+   * @param stream The stream to read from.
+   */
+  void readSnapshot(In& stream) override;
 };
@@ -17,6 +17,7 @@
  */
 
 #include "PerceptRegistrationProvider.h"
+#include <limits>
 
 MAKE_MODULE(PerceptRegistrationProvider);
 
@@ -99,6 +100,7 @@ PerceptRegistrationProvider::PerceptRegistrationProvider()
 
 void PerceptRegistrationProvider::update(PerceptRegistration& perceptRegistration)
 {
+  updateGrids();
   preprocessMeasurements(perceptRegistration);
   perceptRegistration.registerAbsolutePoseMeasurements = [this, &perceptRegistration](const Pose2f& pose, std::vector<RegisteredAbsolutePoseMeasurement>& absolutePoseMeasurements) -> void
   {
@@ -124,6 +126,41 @@ void PerceptRegistrationProvider::update(PerceptRegistration& perceptRegistratio
   };
 }
 
+void PerceptRegistrationProvider::updateGrids()
+{
+  if(lineAssociationCorridor != gridLineAssociationCorridor)
+  {
+    const auto buildLinesGrid = [this](FieldModelGrid& grid, const std::vector<WorldModelFieldLine>& lines)
+    {
+      grid.build(theFieldDimensions.boundary, gridCellSize, lines.size(), lineAssociationCorridor,
+                 [this, &lines](std::size_t index, const Vector2f& point)
+      {
+        const WorldModelFieldLine& line = lines[index];
+        return std::sqrt(getSqrDistanceToLineSegment(line.start, line.dir, line.length, point));
+      });
+    };
+    buildLinesGrid(verticalLinesGrid, verticalLinesWorldModel);
+    buildLinesGrid(horizontalLinesGrid, horizontalLinesWorldModel);
+    gridLineAssociationCorridor = lineAssociationCorridor;
+  }
+
+  if(maxIntersectionDeviation != gridMaxIntersectionDeviation)
+  {
+    FOREACH_ENUM(FieldDimensions::CornerClass, cornerClass)
+      buildIntersectionsGrid(cornerGrids[cornerClass], theFieldDimensions.corners[cornerClass]);
+    buildIntersectionsGrid(xIntersectionsGrid, xIntersectionsWorld);
+    buildIntersectionsGrid(tIntersectionsGrid, tIntersectionsWorld);
+    buildIntersectionsGrid(lIntersectionsGrid, lIntersectionsWorld);
+    gridMaxIntersectionDeviation = maxIntersectionDeviation;
+  }
+}
+
+void PerceptRegistrationProvider::buildIntersectionsGrid(FieldModelGrid& grid, const std::vector<Vector2f>& intersections) const
+{
+  grid.build(theFieldDimensions.boundary, gridCellSize, intersections.size(), maxIntersectionDeviation,
+             [&intersections](std::size_t index, const Vector2f& point) {return (intersections[index] - point).norm();});
+}
+
 void PerceptRegistrationProvider::preprocessMeasurements(PerceptRegistration& perceptRegistration)
 {
   // Reset counters:
@@ -327,10 +364,10 @@ bool PerceptRegistrationProvider::getCorrespondingGoalPost(const Pose2f& pose, c
 
 bool PerceptRegistrationProvider::getCorrespondingIntersection(const Pose2f& pose, const FieldLineIntersections::Intersection& intersectionPercept, Vector2f& intersectionWorldModel) const
 {
-  const std::vector< Vector2f >* intersectionList = 0;
+  FieldDimensions::CornerClass cornerClass = FieldDimensions::numOfCornerClasss;
   if(intersectionPercept.type == FieldLineIntersections::Intersection::X)
   {
-    intersectionList = &theFieldDimensions.corners[FieldDimensions::xCorner];
+    cornerClass = FieldDimensions::xCorner;
   }
   else if(intersectionPercept.type == FieldLineIntersections::Intersection::T)
   {
@@ -338,16 +375,16 @@ bool PerceptRegistrationProvider::getCorrespondingIntersection(const Pose2f& pos
     switch(section)
     {
       case 0:
-        intersectionList = &theFieldDimensions.corners[FieldDimensions::tCorner0];
+        cornerClass = FieldDimensions::tCorner0;
         break;
       case 90:
-        intersectionList = &theFieldDimensions.corners[FieldDimensions::tCorner90];
+        cornerClass = FieldDimensions::tCorner90;
         break;
       case 180:
-        intersectionList = &theFieldDimensions.corners[FieldDimensions::tCorner180];
+        cornerClass = FieldDimensions::tCorner180;
         break;
       default:
-        intersectionList = &theFieldDimensions.corners[FieldDimensions::tCorner270];
+        cornerClass = FieldDimensions::tCorner270;
         break;
     }
   }
@@ -357,86 +394,64 @@ bool PerceptRegistrationProvider::getCorrespondingIntersection(const Pose2f& pos
     switch(section)
     {
       case 0:
-        intersectionList = &theFieldDimensions.corners[FieldDimensions::lCorner0];
+        cornerClass = FieldDimensions::lCorner0;
         break;
       case 90:
-        intersectionList = &theFieldDimensions.corners[FieldDimensions::lCorner90];
+        cornerClass = FieldDimensions::lCorner90;
         break;
       case 180:
-        intersectionList = &theFieldDimensions.corners[FieldDimensions::lCorner180];
+        cornerClass = FieldDimensions::lCorner180;
         break;
       default:
-        intersectionList = &theFieldDimensions.corners[FieldDimensions::lCorner270];
+        cornerClass = FieldDimensions::lCorner270;
         break;
     }
   }
-  if(intersectionList != 0)
-  {
-    // Check for empty list. This might happen for special configurations of demo fields.
-    if(intersectionList->size() == 0)
-      return false;
-    // Initialize variables to store the real world intersection that is closest to the percept:
-    const Vector2f perceptWorld = pose * intersectionPercept.pos;
-    Vector2f closestIntersectionWorld = intersectionList->at(0);
-    float sqrDistanceToClosestIntersectionWorld = (perceptWorld - closestIntersectionWorld).squaredNorm();
-    // Iterate over list to find the closest intersection:
-    for(unsigned int i = 1; i < intersectionList->size(); ++i)
-    {
-      const Vector2f& intersection = intersectionList->at(i);
-      const float sqrDistance = (perceptWorld - intersection).squaredNorm();
-      if(sqrDistance < sqrDistanceToClosestIntersectionWorld)
-      {
-        sqrDistanceToClosestIntersectionWorld = sqrDistance;
-        closestIntersectionWorld = intersection;
-      }
-    }
-    // Check, if closest intersection is close enough:
-    if(sqrDistanceToClosestIntersectionWorld < maxIntersectionDeviation * maxIntersectionDeviation)
-    {
-      intersectionWorldModel = closestIntersectionWorld;
-      return true;
-    }
-  }
-  return false;
+  if(cornerClass == FieldDimensions::numOfCornerClasss)
+    return false;
+  return getClosestIntersection(theFieldDimensions.corners[cornerClass], cornerGrids[cornerClass],
+                                pose * intersectionPercept.pos, intersectionWorldModel);
 }
 
 bool PerceptRegistrationProvider::getCorrespondingIntersectionNoDirections(const Pose2f& pose, const FieldLineIntersections::Intersection& intersectionPercept, Vector2f& intersectionWorldModel) const
 {
-  const std::vector< Vector2f >* intersectionList = 0;
+  const Vector2f perceptWorld = pose * intersectionPercept.pos;
   if(intersectionPercept.type == FieldLineIntersections::Intersection::L)
-    intersectionList = &lIntersectionsWorld;
+    return getClosestIntersection(lIntersectionsWorld, lIntersectionsGrid, perceptWorld, intersectionWorldModel);
   else if(intersectionPercept.type == FieldLineIntersections::Intersection::T)
-    intersectionList = &tIntersectionsWorld;
+    return getClosestIntersection(tIntersectionsWorld, tIntersectionsGrid, perceptWorld, intersectionWorldModel);
   else if(intersectionPercept.type == FieldLineIntersections::Intersection::X)
-    intersectionList = &xIntersectionsWorld;
+    return getClosestIntersection(xIntersectionsWorld, xIntersectionsGrid, perceptWorld, intersectionWorldModel);
+  else
+    return false;
+}
 
-  if(intersectionList != 0)
+bool PerceptRegistrationProvider::getClosestIntersection(const std::vector<Vector2f>& intersections, const FieldModelGrid& grid,
+                                                         const Vector2f& perceptWorld, Vector2f& intersectionWorldModel) const
+{
+  // Only the intersections the grid lists for the percept's position can be close enough.
+  // As they are visited in the order of the list, ties are resolved as in a search over the whole list.
+  const unsigned short* candidate;
+  const unsigned short* candidatesEnd;
+  grid.getCandidates(perceptWorld, candidate, candidatesEnd);
+  const Vector2f* closestIntersectionWorld = nullptr;
+  float sqrDistanceToClosestIntersectionWorld = std::numeric_limits<float>::max();
+  for(; candidate < candidatesEnd; ++candidate)
   {
-    // Check for empty list. This might happen for special configurations of demo fields.
-    if(intersectionList->size() == 0)
-      return false;
-    // Initialize variables to store the real world intersection that is closest to the percept:
-    const Vector2f perceptWorld = pose * intersectionPercept.pos;
-    Vector2f closestIntersectionWorld = intersectionList->at(0);
-    float sqrDistanceToClosestIntersectionWorld = (perceptWorld - closestIntersectionWorld).squaredNorm();
-    // Iterate over list to find the closest intersection:
-    for(unsigned int i = 1; i < intersectionList->size(); ++i)
+    const Vector2f& intersection = intersections[*candidate];
+    const float sqrDistance = (perceptWorld - intersection).squaredNorm();
+    if(sqrDistance < sqrDistanceToClosestIntersectionWorld)
     {
-      const Vector2f& intersection = intersectionList->at(i);
-      const float sqrDistance = (perceptWorld - intersection).squaredNorm();
-      if(sqrDistance < sqrDistanceToClosestIntersectionWorld)
-      {
-        sqrDistanceToClosestIntersectionWorld = sqrDistance;
-        closestIntersectionWorld = intersection;
-      }
-    }
-    // Check, if closest intersection is close enough:
-    if(sqrDistanceToClosestIntersectionWorld < maxIntersectionDeviation * maxIntersectionDeviation)
-    {
-      intersectionWorldModel = closestIntersectionWorld;
-      return true;
+      sqrDistanceToClosestIntersectionWorld = sqrDistance;
+      closestIntersectionWorld = &intersection;
     }
   }
+  // Check, if closest intersection is close enough:
+  if(closestIntersectionWorld && sqrDistanceToClosestIntersectionWorld < maxIntersectionDeviation * maxIntersectionDeviation)
+  {
+    intersectionWorldModel = *closestIntersectionWorld;
+    return true;
+  }
   return false;
 }
 
@@ -475,10 +490,14 @@ PerceptRegistrationProvider::getPointerToCorrespondingLineInWorldModel(const Pos
   }
   isPartOfCenterCircle = false;
   // If this point is reached, the line is matched against the "normal" field lines:
+  // Only lines the grid lists for the start of the perceived line can be close enough to it.
   const std::vector<WorldModelFieldLine>& worldModelLines = isVertical ? verticalLinesWorldModel : horizontalLinesWorldModel;
-  for(unsigned int i = 0; i < worldModelLines.size(); ++i)
+  const unsigned short* candidate;
+  const unsigned short* candidatesEnd;
+  (isVertical ? verticalLinesGrid : horizontalLinesGrid).getCandidates(startOnField, candidate, candidatesEnd);
+  for(; candidate < candidatesEnd; ++candidate)
   {
-    const WorldModelFieldLine& worldModelLine = worldModelLines[i];
+    const WorldModelFieldLine& worldModelLine = worldModelLines[*candidate];
     // A perceived line cannot be longer than the original line:
     if(lineLength > 1.25f * worldModelLine.length)
       continue;
@@ -500,7 +519,7 @@ PerceptRegistrationProvider::getPointerToCorrespondingLineInWorldModel(const Pos
     {
       return nullptr;
     }
-    return &(worldModelLines[i]);
+    return &worldModelLine;
   }
   // Hmmm, no matching line has been found ...
   return nullptr;
@@ -22,6 +22,7 @@
 #include "Representations/Perception/FieldFeatures/PenaltyMarkWithPenaltyAreaLine.h"
 #include "Representations/Perception/FieldFeatures/PenaltyAreaAndGoalArea.h"
 #include "Representations/Perception/GoalPercepts/GoalPostsPercept.h"
+#include "Tools/Modeling/FieldModelGrid.h"
 #include "Framework/Module.h"
 
 MODULE(PerceptRegistrationProvider,
@@ -103,6 +104,16 @@ private:
   std::vector<Vector2f> tIntersectionsWorld;                  /**< List of all t intersections in global field coordinates (used when direction checking is off). Contains all x intersections, too. */
   std::vector<Vector2f> lIntersectionsWorld;                  /**< List of all l intersections in global field coordinates (used when direction checking is off). Contains all x and t intersections, too. */
 
+  static constexpr float gridCellSize = 250.f;                /**< The edge length of the cells of the lookup grids (in mm). */
+  FieldModelGrid verticalLinesGrid;                           /**< Lookup grid for verticalLinesWorldModel. */
+  FieldModelGrid horizontalLinesGrid;                         /**< Lookup grid for horizontalLinesWorldModel. */
+  FieldModelGrid cornerGrids[FieldDimensions::numOfCornerClasses]; /**< Lookup grids for the corner classes of the field dimensions. */
+  FieldModelGrid xIntersectionsGrid;                          /**< Lookup grid for xIntersectionsWorld. */
+  FieldModelGrid tIntersectionsGrid;                          /**< Lookup grid for tIntersectionsWorld. */
+  FieldModelGrid lIntersectionsGrid;                          /**< Lookup grid for lIntersectionsWorld. */
+  float gridLineAssociationCorridor = -1.f;                   /**< The line association corridor the line grids were built for. */
+  float gridMaxIntersectionDeviation = -1.f;                  /**< The maximum intersection deviation the intersection grids were built for. */
+
   float maxCenterCircleDeviation;                             /**< The maximum distance (in mm) between model and perception for registering a center circle percept */
   float maxGoalPostDeviation;                                 /**< The maximum distance (in mm) between model and perception for registering a goal post percept */
 
@@ -113,6 +124,27 @@ private:
    */
   void update(PerceptRegistration& perceptRegistration);
 
+  /** (Re)builds the lookup grids if the parameters they depend on have changed. */
+  void updateGrids();
+
+  /**
+   * Builds a lookup grid for a list of intersections.
+   * @param grid The grid that is built.
+   * @param intersections The intersections in global field coordinates.
+   */
+  void buildIntersectionsGrid(FieldModelGrid& grid, const std::vector<Vector2f>& intersections) const;
+
+  /**
+   * Determines the intersection of a list that is closest to a perceived one, if it is close enough.
+   * @param intersections The intersections in global field coordinates.
+   * @param grid The lookup grid for the list.
+   * @param perceptWorld The position of the perceived intersection (in global field coordinates).
+   * @param intersectionWorldModel The position of the closest intersection (in field coordinates)
+   * @return true, if an intersection closer than maxIntersectionDeviation was found
+   */
+  bool getClosestIntersection(const std::vector<Vector2f>& intersections, const FieldModelGrid& grid,
+                              const Vector2f& perceptWorld, Vector2f& intersectionWorldModel) const;
+
   /**
    * Makes some checks and precomputes values that are the same for
    * all later calls (within one frame) of the registration functions.
@@ -22,6 +22,7 @@ SelfLocator::SelfLocator() : lastTimeJumpSound(0),
 {
   // Create sample set with samples at the typical walk-in positions
   samples = new SampleSet<UKFRobotPoseHypothesis>(numberOfSamples);
+  activeSamples = numberOfSamples;
   for(int i = 0; i < samples->size(); ++i)
     samples->at(i).init(getNewPoseAtWalkInPosition(), walkInPoseDeviation, nextSampleNumber++, 0.5f);
   lastGroundTruthRobotPose = theGroundTruthRobotPose;
@@ -74,7 +75,7 @@ void SelfLocator::update(RobotPose& robotPose)
   float minWeighting = 2.f;
   float maxWeighting = -1.f;
   float weightingSum = 0.f;
-  for(int i = 0; i < numberOfSamples; ++i)
+  for(int i = 0; i < activeSamples; ++i)
   {
     samples->at(i).computeWeightingBasedOnValidity(baseValidityWeighting);
     const float w = samples->at(i).weighting;
@@ -84,7 +85,7 @@ void SelfLocator::update(RobotPose& robotPose)
     if(w < minWeighting)
       minWeighting = w;
   }
-  averageWeighting = weightingSum / numberOfSamples;
+  averageWeighting = weightingSum / activeSamples;
   PLOT("module:SelfLocator:minWeighting", minWeighting);
   PLOT("module:SelfLocator:maxWeighting", maxWeighting);
   PLOT("module:SelfLocator:averageWeighting", averageWeighting);
@@ -107,6 +108,10 @@ void SelfLocator::update(RobotPose& robotPose)
    */
   computeModel(robotPose);
 
+  /* Use fewer samples while the localization is superb and all of them otherwise.
+   */
+  adaptNumberOfSamples(robotPose);
+
   /* Replace a sample, if necessary
    *   This step is done at the end to make sure that the new sample
    *   gets the full motion and sensor update steps before being involved
@@ -134,7 +139,7 @@ void SelfLocator::update(RobotPose& robotPose)
   {
     if(theAlternativeRobotPoseHypothesis.isValid)
     {
-      for(int i = 0; i < numberOfSamples; ++i)
+      for(int i = 0; i < activeSamples; ++i)
       {
         UKFRobotPoseHypothesis newSample;
         if(theSideInformation.robotMustBeInOwnHalf)
@@ -195,8 +200,8 @@ void SelfLocator::update(RobotPose& robotPose)
 
 void SelfLocator::update(SelfLocalizationHypotheses& selfLocalizationHypotheses)
 {
-  selfLocalizationHypotheses.hypotheses.resize(numberOfSamples);
-  for(int i = 0; i < numberOfSamples; ++i)
+  selfLocalizationHypotheses.hypotheses.resize(activeSamples);
+  for(int i = 0; i < activeSamples; ++i)
   {
     SelfLocalizationHypotheses::Hypothesis& h = selfLocalizationHypotheses.hypotheses[i];
     h.pose = samples->at(i).getPose();
@@ -257,7 +262,7 @@ bool SelfLocator::sampleSetIsUnimodal(const RobotPose& robotPose)
   const Angle maxRotationDeviation(84_deg);
   const Angle robotPoseRotation(robotPose.rotation);
   const float sqrMaxDistanceDeviation = maxDistanceDeviation * maxDistanceDeviation;
-  for(int i = 0; i < numberOfSamples; ++i)
+  for(int i = 0; i < activeSamples; ++i)
   {
     const Pose2f& p = samples->at(i).getPose();
     if((robotPose.translation - p.translation).squaredNorm() > sqrMaxDistanceDeviation)
@@ -268,6 +273,22 @@ bool SelfLocator::sampleSetIsUnimodal(const RobotPose& robotPose)
   return true;
 }
 
+int SelfLocator::countLinesInLikelihoodField(const Pose2f& pose) const
+{
+  int count = 0;
+  for(const FieldLines::Line& line : theFieldLines.lines)
+  {
+    const Vector2f first = pose * line.first;
+    const Vector2f last = pose * line.last;
+    const Vector2f dir = last - first;
+    const bool parallelToX = std::abs(dir.x()) > std::abs(dir.y());
+    if(theFieldGeometry.getLineDistance(first, parallelToX) <= lineLikelihoodFieldCorridor
+       && theFieldGeometry.getLineDistance(last, parallelToX) <= lineLikelihoodFieldCorridor)
+      ++count;
+  }
+  return count;
+}
+
 void SelfLocator::motionUpdate()
 {
   // This is a nasty workaround but should help us in cases of bad/slow assistant referees:
@@ -294,14 +315,16 @@ void SelfLocator::motionUpdate()
   const float transYError = std::max(std::abs(transY * majorDirTransWeight), std::abs(transX * minorDirTransWeight));
 
   // update samples
-  for(int i = 0; i < numberOfSamples; ++i)
+  odometryOffsets.resize(activeSamples);
+  for(int i = 0; i < activeSamples; ++i)
   {
     const Vector2f transOffset((transX - transXError) + (2 * transXError) * Random::uniform(),
                                (transY - transYError) + (2 * transYError) * Random::uniform());
     const float rotationOffset = odometryRotation + Random::uniform(-rotError, rotError);
-
-    samples->at(i).motionUpdate(Pose2f(rotationOffset, transOffset), filterProcessDeviation, odometryDeviation, odometryRotationDeviation);
+    odometryOffsets[i] = Pose2f(rotationOffset, transOffset);
   }
+  motionUpdateBatch.motionUpdate(&samples->at(0), activeSamples, odometryOffsets,
+                                 filterProcessDeviation, odometryDeviation, odometryRotationDeviation);
 }
 
 void SelfLocator::sensorUpdate()
@@ -326,7 +349,7 @@ void SelfLocator::sensorUpdate()
   std::vector<RegisteredAbsolutePoseMeasurement> absolutePoseMeasurements;
   std::vector<RegisteredLandmark> landmarks;
   std::vector<RegisteredLine> lines;
-  for(int i = 0; i < numberOfSamples; ++i)
+  for(int i = 0; i < activeSamples; ++i)
   {
     float numerator = 0.f;
     float denominator = 0.f;
@@ -350,7 +373,12 @@ void SelfLocator::sensorUpdate()
     }
     if(useLines && thePerceptRegistration.totalNumberOfAvailableLines > 0)
     {
-      thePerceptRegistration.registerLines(samplePose, lines);
+      // In the likelihood field mode, samples that none of the perceived lines fits to skip the registration.
+      const int linesInLikelihoodField = useLineLikelihoodField ? countLinesInLikelihoodField(samplePose) : -1;
+      if(linesInLikelihoodField != 0)
+        thePerceptRegistration.registerLines(samplePose, lines);
+      else
+        lines.clear();
       usedLines += static_cast<unsigned int>(lines.size());
       for(const auto& line : lines)
       {
@@ -364,7 +392,8 @@ void SelfLocator::sensorUpdate()
         int numberOfLinesForValidityComputation = thePerceptRegistration.totalNumberOfAvailableLines - thePerceptRegistration.totalNumberOfIgnoredLines;
         if(numberOfLinesForValidityComputation > 0)
         {
-          numerator += validityFactorLineMeasurement * static_cast<float>(lines.size()) / numberOfLinesForValidityComputation;
+          const int matchedLines = useLineLikelihoodField ? std::min(linesInLikelihoodField, numberOfLinesForValidityComputation) : static_cast<int>(lines.size());
+          numerator += validityFactorLineMeasurement * static_cast<float>(matchedLines) / numberOfLinesForValidityComputation;
           denominator += validityFactorLineMeasurement;
         }
       }
@@ -381,7 +410,7 @@ void SelfLocator::sensorUpdate()
   // Apply side information:
   if(!theGameState.isPenaltyShootout())
   {
-    for(int i = 0; i < numberOfSamples; ++i)
+    for(int i = 0; i < activeSamples; ++i)
     {
       if(samples->at(i).getPose().translation.x() > theSideInformation.largestXCoordinatePossible)
         samples->at(i).invalidate();
@@ -389,7 +418,7 @@ void SelfLocator::sensorUpdate()
   }
 
   // Check, if sample is still on the carpet
-  for(int i = 0; i < numberOfSamples; ++i)
+  for(int i = 0; i < activeSamples; ++i)
   {
     const Vector2f& position = samples->at(i).getPose().translation;
     if(!theFieldDimensions.isInsideCarpet(position))
@@ -399,8 +428,8 @@ void SelfLocator::sensorUpdate()
   // Statistics
   sumOfPerceivedLines += thePerceptRegistration.totalNumberOfAvailableLines;
   sumOfPerceivedLandmarks += thePerceptRegistration.totalNumberOfAvailableLandmarks;
-  sumOfUsedLines += static_cast<float>(usedLines) / numberOfSamples;
-  sumOfUsedLandmarks += static_cast<float>(usedLandmarks) / numberOfSamples;
+  sumOfUsedLines += static_cast<float>(usedLines) / activeSamples;
+  sumOfUsedLandmarks += static_cast<float>(usedLandmarks) / activeSamples;
 }
 
 bool SelfLocator::currentMotionIsUnsafe()
@@ -450,7 +479,7 @@ bool SelfLocator::sensorResetting(const RobotPose& robotPose)
     float resettingValidity = std::max(0.5f, averageWeighting); // TODO: Recompute?
     int worstSampleIdx = 0;
     float worstSampleValidity = samples->at(0).validity;
-    for(int i = 1; i < numberOfSamples; ++i)
+    for(int i = 1; i < activeSamples; ++i)
     {
       if(samples->at(i).validity < worstSampleValidity)
       {
@@ -483,6 +512,7 @@ void SelfLocator::resetSamplesToGroundTruth()
       samples->at(i).init(theGroundTruthRobotPose, penaltyShootoutPoseDeviation, nextSampleNumber++, 0.9f);
     sampleSetHasBeenReset = true;
     idOfLastBestSample = -1;
+    activeSamples = numberOfSamples;
   }
 }
 
@@ -508,11 +538,11 @@ void SelfLocator::resampling()
   // resample:
   int replacements(0);
   int j(0);
-  for(int i = 0; i < numberOfSamples; ++i)
+  for(int i = 0; i < activeSamples; ++i)
   {
     currentSum += oldSet[i].weighting;
     int replicationCount(0);
-    while(currentSum > nextPos && j < numberOfSamples)
+    while(currentSum > nextPos && j < activeSamples)
     {
       samples->at(j) = oldSet[i];
       if(replicationCount) // An old sample becomes copied multiple times: we need new identifier for the new instances
@@ -525,9 +555,9 @@ void SelfLocator::resampling()
       nextPos += weightingBetweenTwoDrawnSamples;
     }
   }
-  int missingSamples = numberOfSamples - j;
+  int missingSamples = activeSamples - j;
   // fill up missing samples (could happen in rare cases due to numerical imprecision / rounding / whatever) with new poses:
-  for(; j < numberOfSamples; ++j)
+  for(; j < activeSamples; ++j)
   {
     if(theAlternativeRobotPoseHypothesis.isValid) // Try to use the currently best available alternative
     {
@@ -551,6 +581,36 @@ void SelfLocator::resampling()
   PLOT("module:SelfLocator:sampleReplacements", replacements);
 }
 
+void SelfLocator::adaptNumberOfSamples(const RobotPose& robotPose)
+{
+  const int minSamples = std::clamp(minNumberOfSamples, 1, numberOfSamples);
+  if(robotPose.quality == RobotPose::superb && activeSamples > minSamples)
+  {
+    // Keep the most valid samples. The best sample of this frame is always kept, even if it only won because of the stability bonus.
+    UKFRobotPoseHypothesis* first = &samples->at(0);
+    std::partial_sort(first, first + minSamples, first + activeSamples,
+                      [this](const UKFRobotPoseHypothesis& a, const UKFRobotPoseHypothesis& b)
+    {
+      return a.id == idOfLastBestSample || (b.id != idOfLastBestSample && a.validity > b.validity);
+    });
+    activeSamples = minSamples;
+  }
+  else if(robotPose.quality != RobotPose::superb && activeSamples < numberOfSamples)
+  {
+    // Add new samples like missing samples are added in the resampling step.
+    for(int j = activeSamples; j < numberOfSamples; ++j)
+      if(theAlternativeRobotPoseHypothesis.isValid)
+        samples->at(j).init(getNewPoseBasedOnObservations(false, theWorldModelPrediction.robotPose), defaultPoseDeviation, nextSampleNumber++, averageWeighting);
+      else
+      {
+        samples->at(j) = samples->at(j % activeSamples);
+        samples->at(j).id = nextSampleNumber++;
+      }
+    activeSamples = numberOfSamples;
+  }
+  PLOT("module:SelfLocator:numberOfSamples", activeSamples);
+}
+
 void SelfLocator::handleGameStateChanges()
 {
   if(theGameState.isPenaltyShootout())
@@ -610,6 +670,7 @@ void SelfLocator::handleGameStateChanges()
   if(sampleSetHasBeenReset)
   {
     idOfLastBestSample = -1;
+    activeSamples = numberOfSamples;
   }
 }
 
@@ -619,7 +680,7 @@ UKFRobotPoseHypothesis& SelfLocator::getMostValidSample()
   UKFRobotPoseHypothesis* lastBestSample = 0;
   if(idOfLastBestSample != -1)
   {
-    for(int i = 0; i < numberOfSamples; ++i)
+    for(int i = 0; i < activeSamples; ++i)
     {
       if(samples->at(i).id == idOfLastBestSample)
       {
@@ -632,7 +693,7 @@ UKFRobotPoseHypothesis& SelfLocator::getMostValidSample()
   UKFRobotPoseHypothesis* returnSample = &(samples->at(0));
   float maxValidity = -1.f;
   float minVariance = 0.f; // Initial value does not matter
-  for(int i = 0; i < numberOfSamples; ++i)
+  for(int i = 0; i < activeSamples; ++i)
   {
     const float val = samples->at(i).validity;
     if(val > maxValidity)
@@ -743,9 +804,9 @@ void SelfLocator::draw(const RobotPose& robotPose)
 
 bool SelfLocator::allSamplesIDsAreUnique()
 {
-  for(int i = 0; i < numberOfSamples - 1; ++i)
+  for(int i = 0; i < activeSamples - 1; ++i)
   {
-    for(int j = i + 1; j < numberOfSamples; ++j)
+    for(int j = i + 1; j < activeSamples; ++j)
     {
       if(samples->at(i).id == samples->at(j).id)
         return false;
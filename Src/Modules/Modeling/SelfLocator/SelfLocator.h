@@ -11,6 +11,7 @@
 #include "UKFRobotPoseHypothesis.h"
 #include "Representations/BehaviorControl/Libraries/LibDemo.h"
 #include "Representations/Configuration/FieldDimensions.h"
+#include "Representations/Configuration/FieldGeometry.h"
 #include "Representations/Infrastructure/CameraInfo.h"
 #include "Representations/Infrastructure/FrameInfo.h"
 #include "Representations/Infrastructure/GameState.h"
@@ -23,12 +24,14 @@
 #include "Representations/Modeling/WorldModelPrediction.h"
 #include "Representations/MotionControl/MotionInfo.h"
 #include "Representations/MotionControl/OdometryData.h"
+#include "Representations/Perception/FieldPercepts/FieldLines.h"
 #include "Representations/Perception/ImagePreprocessing/CameraMatrix.h"
 #include "Representations/Sensing/FallDownState.h"
 #include "Representations/Sensing/IMUValueState.h"
 #include "Representations/Configuration/SetupPoses.h"
 #include "Representations/Configuration/StaticInitialPose.h"
 #include "Tools/Modeling/SampleSet.h"
+#include "Tools/Modeling/UKFPose2DBatch.h"
 #include "Framework/Module.h"
 
 MODULE(SelfLocator,
@@ -41,6 +44,8 @@ MODULE(SelfLocator,
   REQUIRES(GameState),
   REQUIRES(IMUValueState),
   REQUIRES(FieldDimensions),
+  REQUIRES(FieldGeometry),
+  REQUIRES(FieldLines),
   REQUIRES(FrameInfo),
   REQUIRES(LibDemo),
   REQUIRES(MotionInfo),
@@ -57,6 +62,7 @@ MODULE(SelfLocator,
   LOADS_PARAMETERS(
   {,
     (int)      numberOfSamples,                      /**< The number of samples used by the self-locator */
+    (int)      minNumberOfSamples,                   /**< The number of samples used while the localization quality is superb */
     (Pose2f)   defaultPoseDeviation,                 /**< Standard deviation used for creating new hypotheses */
     (Pose2f)   walkInPoseDeviation,                  /**< Standard deviation used for creating new hypotheses at walk in positions */
     (Pose2f)   returnFromPenaltyPoseDeviation,       /**< Standard deviation used for creating new hypotheses when returning from a penalty */
@@ -79,6 +85,8 @@ MODULE(SelfLocator,
     (float)  validityFactorPoseMeasurement,          /**< Indicates how strongly a perceived pose influences a sample's validity. Higher value means stronger influence */
     (float)  validityFactorLandmarkMeasurement,      /**< Indicates how strongly a perceived landmark influences a sample's validity. Higher value means stronger influence */
     (float)  validityFactorLineMeasurement,          /**< Indicates how strongly a perceived line influences a sample's validity. Higher value means stronger influence */
+    (bool)   useLineLikelihoodField,                 /**< Compute the line part of the validity from a precomputed distance field and do not register lines for samples none of them fits to. */
+    (float)  lineLikelihoodFieldCorridor,            /**< Maximum distance between the ends of a perceived line and the closest field line in the distance field (in mm). */
     (float)  positionJumpNotificationDistance,       /**< Threshold, min position change (distance) to give a notification. */
     (int)    minNumberOfObservationsForResetting,    /**< To accept an alternative robot pose, it must be based on at least this many observations of field features. */
     (float)  translationalDeviationForResetting,     /**< To insert a new particle, the current alternative pose must be farther away from the current robot pose than this threshold. */
@@ -108,11 +116,14 @@ private:
   unsigned timeOfLastReturnFromPenalty;         /**< Point of time when the last penalty of this robot was over */
   bool sampleSetHasBeenReset;                   /**< Flag indicating that all samples have been replaced in the current frame */
   int nextSampleNumber;                         /**< Unique sample identifiers */
+  int activeSamples;                            /**< The number of samples currently used (between minNumberOfSamples and numberOfSamples) */
   int idOfLastBestSample;                       /**< Identifier of the best sample of the last frame */
   float averageWeighting;                       /**< The average of the weightings of all samples in the sample set */
   unsigned lastAlternativePoseTimestamp;        /**< Last time an alternative pose was valid */
   bool validitiesHaveBeenUpdated;               /**< Flag that indicates that the validities of the samples have been changed this frame */
   Pose2f lastGroundTruthRobotPose;              /**< Remember ground truth of last frame */
+  UKFPose2DBatch motionUpdateBatch;             /**< Performs the motion update of all samples at once */
+  std::vector<Pose2f> odometryOffsets;          /**< The noisy odometry offsets of all samples in the current frame */
 
   int sumOfPerceivedLandmarks;                  /**< Statistics: Sum up number of all perceived landmarks */
   int sumOfPerceivedLines;                      /**< Statistics: Sum up number of all perceived lines */
@@ -133,6 +144,13 @@ private:
    */
   void update(SelfLocalizationHypotheses& selfLocalizationHypotheses) override;
 
+  /**
+   * Counts the perceived lines that fit to the field lines in the likelihood field.
+   * @param pose The assumed robot pose
+   * @return The number of perceived lines whose ends are both close to a field line with a similar orientation.
+   */
+  int countLinesInLikelihoodField(const Pose2f& pose) const;
+
   /** Integrate odometry offset into hypotheses */
   void motionUpdate();
 
@@ -142,6 +160,13 @@ private:
   /** Particle filter resampling step */
   void resampling();
 
+  /**
+   * Reduces the number of samples to the most valid ones while the localization
+   * quality is superb and uses all samples again otherwise.
+   * @param robotPose The current robot pose estimate
+   */
+  void adaptNumberOfSamples(const RobotPose& robotPose);
+
   /** Tries to replace a sample, if current robot pose is much different from the alternative hypothesis
    * @param robotPose The current robot pose estimate
    * @return true, if a sample has been replaced
@@ -39,7 +39,7 @@ void TeammatesBallModelProvider::update(TeammatesBallModel& teammatesBallModel)
       if(balls[robot].time > 0 && balls[robot].valid)
       {
         const TeammatesBallModelProvider::BufferedBall& ball = balls[robot];
-        Vector2f absPos = ball.robotPose * ball.pos;
+        const Vector2f& absPos = ball.positionOnField;
         CIRCLE("module:TeammatesBallModelProvider:bufferedBalls", absPos.x(), absPos.y(), 150, 20, Drawings::solidPen, bufferedBallColor, Drawings::solidBrush, bufferedBallColor);
       }
     }
@@ -131,7 +131,13 @@ void TeammatesBallModelProvider::updateInternalBallBuffers()
       newBall.time                   = message.theBallModel.timeWhenLastSeen;
       newBall.valid = true;
       if(newBall.poseQualityModifier > 0.f) // If the value is zero, the final weighting would be 0, too.
+      {
+        // Everything that only depends on the message is computed once here and not in every frame.
+        newBall.positionOnField = newBall.robotPose * newBall.pos;
+        newBall.velocityOnField = Vector2f(newBall.vel).rotate(newBall.robotPose.rotation);
+        newBall.distanceWeighting = computeDistanceWeighting(newBall);
         balls[n] = newBall;
+      }
     }
   }
   // There are penalties with a high probability that the robot was delocalized or chasing a false ball.
@@ -155,9 +161,8 @@ void TeammatesBallModelProvider::findAvailableBalls()
       const float weighting = computeWeighting(ball);
       if(weighting != 0.f)
       {
-        Vector2f absPos = ball.robotPose * ball.pos;
-        Vector2f absVel = ball.vel;
-        absVel.rotate(ball.robotPose.rotation);
+        Vector2f absPos = ball.positionOnField;
+        Vector2f absVel = ball.velocityOnField;
         if(ball.time < theFrameInfo.time)
         {
           const float t = (theFrameInfo.time - ball.time) / 1000.f;
@@ -232,6 +237,12 @@ float TeammatesBallModelProvider::computeWeighting(const TeammatesBallModelProvi
   // - the ball weight is close to 0, if the maximum time is almost over
   float ballAgeWeight = 1.f - std::tanh(ballAgeRelativeToTimeout * 2.f);
 
+  // Parts 2 and 3 were computed when the ball was buffered
+  return ballAgeWeight * ball.distanceWeighting;
+}
+
+float TeammatesBallModelProvider::computeDistanceWeighting(const TeammatesBallModelProvider::BufferedBall& ball) const
+{
   // Part 2: Angular distance *****
   const float camHeight = 550.f;
   const float angleOfCamera = std::atan(ball.pos.norm() / camHeight); // angle of camera when looking at the ball
@@ -240,8 +251,7 @@ float TeammatesBallModelProvider::computeWeighting(const TeammatesBallModelProvi
   const float ballDeviation = (ballPositionWithPositiveDeviation - ballPositionWithNegativeDeviation) / 2; // averaged deviation of the ball position
 
   // Part 3: Combination with validity *****
-  const float weighting = (ballAgeWeight / ballDeviation) * ball.poseQualityModifier;
-  return std::abs(weighting);
+  return std::abs(ball.poseQualityModifier / ballDeviation);
 }
 
 bool TeammatesBallModelProvider::checkForResetByGameSituation()
@@ -52,6 +52,9 @@ public:
     Vector2f vel = Vector2f::Zero();   /**< Velocity of the ball (relative to the observer) */
     unsigned time = 0;                 /**< Point of time (in ms) of the observation */
     bool valid = false;                /**< This observation can be considered */
+    Vector2f positionOnField = Vector2f::Zero(); /**< Position of the ball in field coordinates at the time of the observation */
+    Vector2f velocityOnField = Vector2f::Zero(); /**< Velocity of the ball in field coordinates at the time of the observation */
+    float distanceWeighting = 0.f;     /**< The part of the weighting that does not change over time */
   };
 
   /** A ball that is a candidate for becoming (a part of the) team ball */
@@ -101,6 +104,14 @@ private:
    */
   float computeWeighting(const BufferedBall& ball) const;
 
+  /** Computes the part of the weighting of a ball observation that does not depend on its age,
+   *  i.e. the one based on the distance to the observer and the quality of the observer's pose.
+   *  It is only computed once when a new observation is buffered.
+   * @param ball The ball observation
+   * @return The time-independent part of the weighting
+   */
+  float computeDistanceWeighting(const BufferedBall& ball) const;
+
   /** In some situations (game is not in PLAY or ball was out), the ball
    *  becomes replaced by humans. Thus, we should reset all stored information then.
    *  @return true, if all buffers have been reset.
@@ -18,6 +18,7 @@
 #include "Platform/File.h"
 #include "Platform/SystemCall.h"
 #include "Platform/Thread.h"
+#include "Tools/NeuralNetworks/ModelRegistry.h"
 #include <algorithm>
 
 MAKE_MODULE(WhistleDetector);
@@ -29,7 +30,7 @@ WhistleDetector::WhistleDetector()
     detector(&Global::getAsmjitRuntime())
 {
   // Load the model.
-  model = std::make_unique<NeuralNetworkONNX::Model>(std::string(File::getBHDir()) + "/" + whistleNetPath);
+  model = ModelRegistry::getONNX(std::string(File::getBHDir()) + "/" + whistleNetPath);
   detector.compile(*model);
 
   ASSERT(detector.numOfInputs() == 1);
@@ -45,12 +46,24 @@ WhistleDetector::WhistleDetector()
   pmConfidenceBuffer.reserve(useAdaptiveThreshold ? adaptiveWindowSize / 2 : 1);
 
   // Init FFT.
-  in = fftw_alloc_real(samples.capacity());
-  std::memset(in, 0, sizeof(double) * samples.capacity());
-  out = fftw_alloc_complex(amplitudes.size());
+  in = fftwf_alloc_real(samples.capacity());
+  std::memset(in, 0, sizeof(float) * samples.capacity());
+  out = fftwf_alloc_complex(amplitudes.size());
   {
     SYNC;
-    fft = fftw_plan_dft_r2c_1d(static_cast<int>(samples.capacity()), in, out, FFTW_MEASURE);
+    fft = fftwf_plan_dft_r2c_1d(static_cast<int>(samples.capacity()), in, out, FFTW_MEASURE);
+  }
+
+  // Precompute the windowing function.
+  window.resize(samples.capacity());
+  for(size_t i = 0; i < window.size(); ++i)
+  {
+    const float phase = static_cast<float>(pi * i / window.size());
+    window[i] = windowing == hann ? sqr(std::sin(phase))
+                : windowing == nuttall ? 0.355768f - 0.487396f * std::sin(phase)
+                                         + 0.144232f * std::sin(2.f * phase)
+                                         - 0.012604f * std::sin(3.f * phase)
+                : 0.54f - 0.46f * std::cos(2.f * phase);
   }
 
   chroma.setResolution(500, static_cast<unsigned>(amplitudes.size()));
@@ -59,9 +72,9 @@ WhistleDetector::WhistleDetector()
 WhistleDetector::~WhistleDetector()
 {
   SYNC;
-  fftw_destroy_plan(fft);
-  fftw_free(out);
-  fftw_free(in);
+  fftwf_destroy_plan(fft);
+  fftwf_free(out);
+  fftwf_free(in);
 }
 
 void WhistleDetector::update(Whistle& theWhistle)
@@ -136,19 +149,11 @@ void WhistleDetector::detect(Whistle& theWhistle)
   STOPWATCH("module:WhistleDetector:samples")
   {
     for(size_t i = 0; i < samples.size(); ++i)
-    {
-      const float phase = static_cast<float>(pi * i / samples.capacity());
-      in[i] = samples[samples.size() - 1 - i]
-              * (windowing == hann ? sqr(std::sin(phase))
-                 : windowing == nuttall ? 0.355768f - 0.487396f * std::sin(phase)
-                                         + 0.144232f * std::sin(2.f * phase)
-                                         - 0.012604f * std::sin(3.f * phase)
-                 : 0.54f - 0.46f * std::cos(2.f * phase));
-    }
+      in[i] = samples[samples.size() - 1 - i] * window[i];
   }
 
   // Run FFT.
-  STOPWATCH("module:WhistleDetector:FFT") fftw_execute(fft);
+  STOPWATCH("module:WhistleDetector:FFT") fftwf_execute(fft);
 
   // These variables are set inside the STOPWATCH, but are also needed outside.
   float relLimitCount;
@@ -163,8 +168,7 @@ void WhistleDetector::detect(Whistle& theWhistle)
     float limitCount = 0;
     for(size_t i = 0; i < amplitudes.size(); ++i)
     {
-      const float amp = static_cast<float>(std::sqrt(sqr(out[i][0]) + sqr(out[i][1])));
-      detector.input(0)[i] = 20.f * std::log10(amp);
+      const float amp = std::sqrt(sqr(out[i][0]) + sqr(out[i][1]));
       amplitudes[i] = amp;
       currentMaxAmp = std::max(currentMaxAmp, amp);
       if(amp > limit)
@@ -228,11 +232,25 @@ void WhistleDetector::detect(Whistle& theWhistle)
         pmConfidence = std::max(grad.min, grad.max) * ampWeight;
     }
 
-    //do WhistleDetection NN
-    detector.apply();
   }
 
-  const float nnConfidence = detector.output(0)[0]; // linear
+  // The weighted confidence of the physical model must exceed the averaged
+  // threshold times thresholdRatio for a detection. Since the threshold is
+  // never lowered by adaptive thresholding, the network is skipped if the
+  // confidence does not even reach the base threshold times that ratio.
+  const float weightedPMConfidence = pmWeight * pmConfidence / (nnWeight + pmWeight) * (1 - limitWeight * relLimitCount);
+  float nnConfidence = 0.f;
+  if(!skipNetworkIfPMTooLow || weightedPMConfidence > threshold * thresholdRatio)
+  {
+    STOPWATCH("module:WhistleDetector:network")
+    {
+      //do WhistleDetection NN
+      for(size_t i = 0; i < amplitudes.size(); ++i)
+        detector.input(0)[i] = 20.f * std::log10(amplitudes[i]);
+      detector.apply();
+      nnConfidence = detector.output(0)[0]; // linear
+    }
+  }
 
   //Merge NN, PM and limit information
   if(useAdaptiveThreshold)
@@ -241,7 +259,7 @@ void WhistleDetector::detect(Whistle& theWhistle)
     thresholdBuffer.push_front(threshold);
 
   nnConfidenceBuffer.push_front(nnWeight * nnConfidence / (nnWeight + pmWeight) * (1 - limitWeight * relLimitCount));
-  pmConfidenceBuffer.push_front(pmWeight * pmConfidence / (nnWeight + pmWeight) * (1 - limitWeight * relLimitCount));
+  pmConfidenceBuffer.push_front(weightedPMConfidence);
   const float confidence = nnConfidenceBuffer.back() + pmConfidenceBuffer.back();
   const float averageThreshold = thresholdBuffer.average();
   if(thresholdBuffer.full() && confidence > averageThreshold
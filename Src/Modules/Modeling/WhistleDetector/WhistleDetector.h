@@ -57,6 +57,7 @@ MODULE(WhistleDetector,
     (unsigned) minDetections, /**< The minimum number of detections to accept the whistle. */
     (int) minTimeBetweenWhistles, /**< Minimum time after a whistle was detected to accept the next one (in ms). */
     (unsigned char) numOfChannelsReported, /**< The number of channels reported when listening. */
+    (bool) skipNetworkIfPMTooLow, /**< Do not run the network if the physical model's confidence is too low for a detection anyway. */
   }),
 });
 
@@ -65,9 +66,10 @@ class WhistleDetector : public WhistleDetectorBase
   unsigned channel = 0; /**< The channel, i.e. the microphone, that is used for whistle detection. */
   RingBuffer<float> samples; /**< The audio samples of that channel to process. */
 
-  fftw_plan fft; /**< The plan to compute the FFT. */
-  double* in = nullptr; /**< The input of the FFT. */
-  fftw_complex* out = nullptr; /**< The output of the FFT. */
+  fftwf_plan fft; /**< The plan to compute the FFT. */
+  float* in = nullptr; /**< The input of the FFT. */
+  fftwf_complex* out = nullptr; /**< The output of the FFT. */
+  std::vector<float> window; /**< The windowing function applied to the samples. */
 
   std::vector<float> amplitudes; /**< The amplitudes of the different frequencies. */
   RingBufferWithSum<float, 200> maxAmpHist; /**< The maximum amplitudes of the last 200 FFTs. */
@@ -76,7 +78,7 @@ class WhistleDetector : public WhistleDetectorBase
 
   Range<unsigned> currentFreq; /**< The frequency window in which it is searched for the whistle. */
   NeuralNetworkONNX::CompiledNN detector; /**< The neural whistle detector. */
-  std::unique_ptr<NeuralNetworkONNX::Model> model; /**< The model loaded into the detector. */
+  std::shared_ptr<const NeuralNetworkONNX::Model> model; /**< The model loaded into the detector. */
 
   unsigned lastTimeCandidateDetected = 0; /**< The last time an individual detection had a sufficient confidence. */
   unsigned detectionCount = 0; /**< The number of detections that a sufficient confidence for a single whistle. */
@@ -13,6 +13,7 @@
 #include "Math/Range.h"
 #include "Math/BHMath.h"
 #include "Tools/Motion/InverseKinematic.h"
+#include "Modules/Infrastructure/InterThreadProviders/PerceptionProviders.h"
 #include "Representations/Perception/ImagePreprocessing/CameraMatrix.h"
 #include <algorithm>
 #include <cmath>
@@ -78,7 +79,7 @@ void HeadMotionEngine::update(HeadMotionGenerator& headMotionGenerator)
     const float maxSpeedForDistance = std::sqrt(2.f * distanceToTarget * maxAcc * 0.8f);
 
     const float requestedSpeed = theHeadAngleRequest.stopAndGoMode
-                                 ? theHeadAngleRequest.speed * (std::cos(pi2 / stopAndGoModeFrequency * theFrameInfo.time) / 2.f + .5f)
+                                 ? theHeadAngleRequest.speed * getStopAndGoSpeedRatio()
                                  : static_cast<float>(theHeadAngleRequest.speed);
 
     const float maxSpeed = std::min(maxSpeedForDistance, requestedSpeed);
@@ -121,6 +122,17 @@ void HeadMotionEngine::update(HeadMotionGenerator& headMotionGenerator)
   };
 }
 
+float HeadMotionEngine::getStopAndGoSpeedRatio() const
+{
+  if(!syncStopAndGoWithCamera)
+    return std::cos(pi2 / stopAndGoModeFrequency * theFrameInfo.time) / 2.f + .5f;
+
+  // The speed is zero when the phase is zero, i.e. in the middle of an exposure.
+  const float period = std::max(1.f, std::round(stopAndGoModeFrequency / cameraFramePeriod)) * cameraFramePeriod;
+  const float timeSinceExposure = static_cast<float>(theFrameInfo.getTimeSince(theUpperFrameInfo.time)) - exposureOffset;
+  return .5f - std::cos(pi2 / period * timeSinceExposure) / 2.f;
+}
+
 void HeadMotionEngine::updateHeadAngleRequest(HeadAngleRequest& headAngleRequest, bool& lastWasLower) const
 {
   Vector2a panTiltUpperCam;
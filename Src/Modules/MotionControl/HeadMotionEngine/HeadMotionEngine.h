@@ -27,6 +27,8 @@
 #include "Math/Range.h"
 #include "Framework/Module.h"
 
+struct UpperFrameInfo;
+
 MODULE(HeadMotionEngine,
 {,
   REQUIRES(CameraIntrinsics),
@@ -41,6 +43,7 @@ MODULE(HeadMotionEngine,
   REQUIRES(RobotDimensions),
   REQUIRES(RobotModel),
   REQUIRES(TorsoMatrix),
+  REQUIRES(UpperFrameInfo),
   PROVIDES(HeadMotionGenerator),
   DEFINES_PARAMETERS(
   {,
@@ -48,6 +51,9 @@ MODULE(HeadMotionEngine,
     (float)(20.f) maxAcceleration, /**< Maximum angle acceleration (rad/s^2). */
     (float)(1.f) maxAccelerationNoGroundContact, /**< Maximum angle acceleration (rad/s^2) when not having ground contact. */
     (int)(800) stopAndGoModeFrequency, /**< Milliseconds between 2 stops in stopAndGoMode. */
+    (bool)(true) syncStopAndGoWithCamera, /**< Align the stops in stopAndGoMode with the exposures of the upper camera? */
+    (float)(1000.f / 30.f) cameraFramePeriod, /**< The time between two images of the upper camera (in ms). */
+    (float)(0.f) exposureOffset, /**< The time from the timestamp of an image to the middle of its exposure (in ms). */
     (Rangea)(5_deg, -10_deg) lowerCamThreshold,
   }),
 });
@@ -75,6 +81,15 @@ private:
 
   void adjustTiltBoundToShoulder(Angle pan, CameraInfo::Camera camera, Rangea& tiltBound) const;
 
+  /**
+   * Returns the ratio of the requested speed used in stopAndGoMode. The speed follows a
+   * cosine profile that is zero at the stops. If syncStopAndGoWithCamera is set, the
+   * period is rounded to a multiple of the camera frame period and the stops are placed
+   * in the middle of the exposures of the upper camera, so these images are not blurred.
+   * @return The ratio in the range [0 .. 1].
+   */
+  float getStopAndGoSpeedRatio() const;
+
   Rangea panBounds;
   HeadAngleRequest theHeadAngleRequest;
   Vector2f lastSpeed = Vector2f::Zero();
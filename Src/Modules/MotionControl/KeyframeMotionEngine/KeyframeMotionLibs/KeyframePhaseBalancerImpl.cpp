@@ -93,7 +93,7 @@ void KeyframePhaseBase::addBalanceFactor(const float factorY, const float factor
 {
   auto applyBalance = [this](const std::vector<JointPair>& jointFactorList, const float balanceValue, const bool forwardTiltCase)
   {
-    for(JointPair jointList : jointFactorList)
+    for(const JointPair& jointList : jointFactorList)
     {
       Joints::Joint joint = jointList.joint;
       float factor = jointList.scaling;
@@ -126,13 +126,15 @@ void KeyframePhaseBase::addBalanceFactor(const float factorY, const float factor
 void KeyframePhaseBase::calculateCOMInSupportPolygon()
 {
   // The feet edge points
-  std::vector<Vector3f> supportPolygon;
   const Pose3f leftFoot = engine.theTorsoMatrix * engine.theRobotModel.soleLeft;
   const Pose3f rightFoot = engine.theTorsoMatrix * engine.theRobotModel.soleRight;
-  supportPolygon.push_back(((leftFoot * Vector3f(engine.supportPolygonOffsets.x(), -engine.supportPolygonOffsets.y(), 0.f))));
-  supportPolygon.push_back(((rightFoot * Vector3f(engine.supportPolygonOffsets.x(), engine.supportPolygonOffsets.y(), 0.f))));
-  supportPolygon.push_back(((rightFoot * Vector3f(-engine.theFootOffset.backward, engine.supportPolygonOffsets.x(), 0.f))));
-  supportPolygon.push_back(((leftFoot * Vector3f(-engine.theFootOffset.backward, -engine.supportPolygonOffsets.x(), 0.f))));
+  const std::array<Vector3f, 4> supportPolygon =
+  {
+    leftFoot * Vector3f(engine.supportPolygonOffsets.x(), -engine.supportPolygonOffsets.y(), 0.f),
+    rightFoot * Vector3f(engine.supportPolygonOffsets.x(), engine.supportPolygonOffsets.y(), 0.f),
+    rightFoot * Vector3f(-engine.theFootOffset.backward, engine.supportPolygonOffsets.x(), 0.f),
+    leftFoot * Vector3f(-engine.theFootOffset.backward, -engine.supportPolygonOffsets.x(), 0.f)
+  };
   // TODO check if the used polygon parameters were 2021 also wrong. (x is used, were y should be used. z is intentionally not used)
 
   // Calc the upper left and lower right edge
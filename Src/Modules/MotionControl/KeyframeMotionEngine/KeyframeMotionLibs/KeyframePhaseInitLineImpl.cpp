@@ -205,7 +205,7 @@ void KeyframePhaseBase::initCurrentLine(const bool safeLastKeyframeInfo)
     if(newKeyframeBlock)
       setJointStiffnessBase();
     ASSERT(!currentMotionBlock.empty() && !currentMotionBlock[0].keyframes.empty());
-    currentKeyframe = currentMotionBlock[0].keyframes[0];
+    currentKeyframe = std::move(currentMotionBlock[0].keyframes[0]);
     currentMotionBlock[0].keyframes.erase(currentMotionBlock[0].keyframes.begin());
     if(!checkEarlyBranch())
     {
@@ -13,6 +13,7 @@
 #include "Debugging/Modify.h"
 #include "Math/Pose3f.h"
 #include "Math/RotationMatrix.h"
+#include "Tools/Motion/ForwardKinematic.h"
 #include "Tools/Motion/InverseKinematic.h"
 #include "Platform/SystemCall.h"
 #include "MathBase/Rotation.h"
@@ -282,15 +283,16 @@ void KickEngineData::simpleCalcArmJoints(const Joints::Joint& joint, JointReques
 
 void KickEngineData::balanceCOM(JointRequest& joints, const RobotDimensions& rd, const MassCalibration& mc)
 {
-  const Pose3f& torso = toLeftSupport ? comRobotModel.limbs[Limbs::footLeft] : comRobotModel.limbs[Limbs::footRight];
-  comRobotModel.setJointData(joints, rd, mc);
-  const Vector3f com = torso.rotation.inverse() * comRobotModel.centerOfMass;
+  // Only the poses are needed, so the joint variances are not propagated.
+  const Pose3f& torso = toLeftSupport ? comLimbs[Limbs::footLeft] : comLimbs[Limbs::footRight];
+  requestedCom = ForwardKinematic::calculateCenterOfMass(joints, rd, mc, comLimbs);
+  const Vector3f com = torso.rotation.inverse() * requestedCom;
 
   actualDiff = com - ref;
 
   balanceSum += actualDiff.head<2>();
 
-  float height = comRobotModel.centerOfMass.z() - ref.z();
+  float height = requestedCom.z() - ref.z();
 
   const Vector2f balance(
     currentParameters.kpy * (actualDiff.x()) + currentParameters.kiy * balanceSum.x(),
@@ -637,13 +639,13 @@ void KickEngineData::initData(const FrameInfo& frame, const KickRequest& kr, con
 
   bodyAngle = Vector2f(angleX, angleY);
   calcJoints(jointRequest, rd, theDamageConfigurationBody);
-  comRobotModel.setJointData(jointRequest, rd, mc);
-  const Pose3f& torso = toLeftSupport ? comRobotModel.limbs[Limbs::footLeft] : comRobotModel.limbs[Limbs::footRight];
-  const Vector3f com = torso.rotation.inverse() * comRobotModel.centerOfMass;
+  requestedCom = ForwardKinematic::calculateCenterOfMass(jointRequest, rd, mc, comLimbs);
+  const Pose3f& torso = toLeftSupport ? comLimbs[Limbs::footLeft] : comLimbs[Limbs::footRight];
+  const Vector3f com = torso.rotation.inverse() * requestedCom;
 
   //this calculates inverse of pid com control -> getting com to max pos at start -> being rotated as before engine
   float foot = toLeftSupport ? origins[Phase::leftFootTra].z() : origins[Phase::rightFootTra].z();
-  float height = comRobotModel.centerOfMass.z() - foot;
+  float height = requestedCom.z() - foot;
 
   balanceSum.x() = std::tan(angleY - Constants::pi) * height;
   balanceSum.x() /= currentParameters.kiy;
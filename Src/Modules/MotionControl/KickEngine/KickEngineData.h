@@ -77,7 +77,8 @@ private:
   Vector3f ref = Vector3f::Zero();
   Vector3f actualDiff = Vector3f::Zero();
 
-  RobotModel comRobotModel;
+  ENUM_INDEXED_ARRAY(Pose3f, Limbs::Limb) comLimbs; /**< The poses of the limbs for the joint request balanced. */
+  Vector3f requestedCom = Vector3f::Zero(); /**< The center of mass for the joint request balanced. */
 
   JointRequest lastBalancedJointRequest;
   JointRequest compenJoints;
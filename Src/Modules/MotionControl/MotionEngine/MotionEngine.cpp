@@ -232,6 +232,10 @@ void MotionEngine::update(JointRequest& jointRequest)
   }
 #endif
 
+  // Limit the stiffness of joints that would overheat otherwise.
+  FOREACH_ENUM(Joints::Joint, joint)
+    jointRequest.stiffnessData.stiffnesses[joint] = std::min(jointRequest.stiffnessData.stiffnesses[joint], theJointThermalModel.maxStiffnesses[joint]);
+
   // Set stiffness of broken joints to 0.
   for(const Joints::Joint joint : theDamageConfigurationBody.jointsToEraseStiffness)
     jointRequest.stiffnessData.stiffnesses[joint] = 0;
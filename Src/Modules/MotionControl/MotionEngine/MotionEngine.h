@@ -57,6 +57,7 @@
 #include "Representations/Sensing/GyroOffset.h"
 #include "Representations/Sensing/InertialData.h"
 #include "Representations/Sensing/JointPlay.h"
+#include "Representations/Sensing/JointThermalModel.h"
 #include "Framework/Module.h"
 #include "Tools/Motion/MotionGenerator.h"
 #include "Tools/Motion/MotionPhase.h"
@@ -88,6 +89,7 @@ MODULE(MotionEngine,
   REQUIRES(JointAngles),
   REQUIRES(JointLimits),
   REQUIRES(JointPlay),
+  REQUIRES(JointThermalModel),
   REQUIRES(KeyframeMotionGenerator),
   REQUIRES(MotionRequest),
   REQUIRES(OdometryDataPreview),
@@ -10,6 +10,7 @@
 #include "Debugging/DebugDrawings3D.h"
 #include "Debugging/Plot.h"
 #include "Modules/MotionControl/WalkingEngine/WalkingEngine.h"
+#include "Tools/Motion/ForwardKinematic.h"
 #include "Tools/Motion/Transformation.h"
 
 using namespace Motion::Transformation;
@@ -341,10 +342,10 @@ void WalkPhaseBase::constructorAfterKickOrGetUpCase(const MotionPhase& lastPhase
   constructorInitWithJointRequest(Pose2f(0.f, 0.f, 0.f), WalkKickStep::OverrideFoot::request, WalkKickStep::OverrideFoot::request);
 
   armCompensationAfterKick = 1.f;
-  const RobotModel lastRobotModel(engine.theJointRequest, engine.theRobotDimensions, engine.theMassCalibration);
+  const Pose3f lastSole = ForwardKinematic::calculateSole(isLeftPhase ? Legs::right : Legs::left, engine.theJointRequest, engine.theRobotDimensions);
 
   forwardStep = 0.f;
-  sideStep = -(isLeftPhase ? lastRobotModel.soleRight.translation.y() + 50.f : lastRobotModel.soleLeft.translation.y() - 50.f);
+  sideStep = -(isLeftPhase ? lastSole.translation.y() + 50.f : lastSole.translation.y() - 50.f);
   sideStep = Rangef(isLeftPhase ? 0.f : -1000.f, isLeftPhase ? 1000.f : 0.f).limit(sideStep);
 
   const Vector2f target(forwardStep, sideStep);
@@ -656,8 +657,6 @@ void WalkPhaseBase::calcJointsHelperFootSoleRotations(const JointRequest& jointR
     const float sideStart = isLeftPhase ? sideL0 : sideR0;
     const float sideChangeSigned = (sideStep * (1.f - engine.kinematicParameters.sidewaysHipShiftFactor) - sideStart) * (isLeftPhase ? 1.f : -1.f);
 
-    // get predicted torsorot
-    const RobotModel balanced(jointRequest, engine.theRobotDimensions, engine.theMassCalibration);
     walkStepAdjustment.modifySwingFootRotation(isLeftPhase ? soleRotationYL : soleRotationYR,
                                                isLeftPhase ? soleYLOld : soleYROld,
                                                isLeftPhase ? soleRotationXL : soleRotationXR,
@@ -1007,9 +1006,8 @@ void WalkPhaseBase::calculateBallPosition(const bool isLeftPhase)
 
 void WalkPhaseBase::constructorArmCompensation(const JointAngles& jointAngles, const Angle theArmCompensation)
 {
-  const RobotModel model(jointAngles, engine.theRobotDimensions, engine.theMassCalibration);
-  Pose3f leftSole = model.soleLeft;
-  Pose3f rightSole = model.soleRight;
+  Pose3f leftSole = ForwardKinematic::calculateSole(Legs::left, jointAngles, engine.theRobotDimensions);
+  Pose3f rightSole = ForwardKinematic::calculateSole(Legs::right, jointAngles, engine.theRobotDimensions);
 
   Pose3f rot(Rotation::aroundY(-theArmCompensation));
 
@@ -36,6 +36,25 @@ WalkStepAdjustment::WalkStepAdjustment() :
     kneeBalanceFilter.update(0.01_deg * (i + 1)); // set up buffer to ensure it can move knee as fast as possible
 }
 
+float WalkStepAdjustment::predictCom(const float comX, const float supportX, const WalkStepAdjustmentParams& walkStepParams)
+{
+  if(lastLeft == Pose3f())
+    lastComX = comX;
+  comVelocityX = walkStepParams.comVelocityLowPassRatio * comVelocityX + (1.f - walkStepParams.comVelocityLowPassRatio) * (comX - lastComX) / Constants::motionCycleTime;
+  lastComX = comX;
+
+  // x(t) = cosh(t / T) * x(0) + T * sinh(t / T) * v(0) with T = sqrt(h / g)
+  if(predictionGainsHorizon != walkStepParams.predictionHorizon || predictionGainsHeight != walkStepParams.pendulumHeight)
+  {
+    predictionGainsHorizon = walkStepParams.predictionHorizon;
+    predictionGainsHeight = walkStepParams.pendulumHeight;
+    const float timeConstant = std::sqrt(walkStepParams.pendulumHeight / Constants::g);
+    predictionGains = Vector2f(std::cosh(walkStepParams.predictionHorizon / timeConstant),
+                               timeConstant * std::sinh(walkStepParams.predictionHorizon / timeConstant));
+  }
+  return supportX + predictionGains.dot(Vector2f(comX - supportX, comVelocityX));
+}
+
 void WalkStepAdjustment::addBalance(Pose3f& left, Pose3f& right, const float stepTime, const Vector2f& com, const FootOffset& footOffset,
                                     const Rangef& clipForwardPosition, const bool isLeftPhase, const FootSupport& footSupport,
                                     const FsrData& fsrData, const FrameInfo& frameInfo, const Angle hipRot, const bool isStepAdjustmentAllowed,
@@ -54,7 +73,7 @@ void WalkStepAdjustment::addBalance(Pose3f& left, Pose3f& right, const float ste
   // 1. Set allowed movement speed //
   ///////////////////////////////////
   // const float stepTimeClipped = Rangef::ZeroOneRange().limit(stepTime);
-  const float comX = com.x();
+  const float comX = walkStepParams.usePrediction ? predictCom(com.x(), (!isLeftPhase ? left : right).translation.x(), walkStepParams) : com.x();
   float useMaxVelX = walkStepParams.maxVelX * Constants::motionCycleTime;
   float useMinVelX = walkStepParams.minVelX * Constants::motionCycleTime;
   float useRemoveSpeedX = walkStepParams.removeSpeedX * Constants::motionCycleTime;
@@ -399,6 +418,11 @@ void WalkStepAdjustment::init(const WalkStepAdjustment& walkData, const bool res
   lastLeft = walkData.lastLeft;
   lastRight = walkData.lastRight;
   lowPassFilteredComX = walkData.lowPassFilteredComX;
+  lastComX = walkData.lastComX;
+  comVelocityX = walkData.comVelocityX;
+  predictionGains = walkData.predictionGains;
+  predictionGainsHorizon = walkData.predictionGainsHorizon;
+  predictionGainsHeight = walkData.predictionGainsHeight;
   previousHighestAdjustmentX = walkData.highestAdjustmentX;
   kneeHipBalanceCounter = walkData.kneeHipBalanceCounter;
   isForwardBalance = walkData.isForwardBalance;
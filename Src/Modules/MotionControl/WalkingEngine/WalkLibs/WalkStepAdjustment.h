@@ -58,6 +58,10 @@ STREAMABLE(WalkStepAdjustmentParams,
   (float) hipBalanceBackwardFootArea, /**< In which area of the feet can the com move, while the hip pitch is used to balancing when walking unstable. */
   (float) unstableWalkThreshold, /**< Thresholds for the lastLeftAdjustment and lastRightAdjustment values to trigger unstable sound. */
   (float) reduceWalkingSpeedTimeWindow, /**< If the step adjustment adjusted the feet too much two separate times in this time duration, then reduce the walking speed. */
+  (bool) usePrediction, /**< Use the com predicted by a linear inverted pendulum instead of the measured one? */
+  (float) predictionHorizon, /**< How far is the com predicted into the future (in s)? */
+  (float) pendulumHeight, /**< The height of the com above the support foot assumed for the prediction (in mm). */
+  (float) comVelocityLowPassRatio, /**< To which ratio keep the old com velocity for the prediction? */
 });
 
 class WalkStepAdjustment
@@ -75,6 +79,14 @@ private:
   bool kneeBalanceActive = false;
   float kneeBalanceFactor = 0.f;
 
+  float lastComX = 0.f; // com in x axis from previous motion frame
+  float comVelocityX = 0.f; // low pass filtered com velocity in x axis
+  // The gains of the linear inverted pendulum that map the com position and velocity relative to the support foot to the predicted com position.
+  // They are only recalculated when the parameters they depend on change.
+  Vector2f predictionGains = Vector2f(1.f, 0.f);
+  float predictionGainsHorizon = 0.f; // horizon the predictionGains were calculated for
+  float predictionGainsHeight = 0.f; // pendulum height the predictionGains were calculated for
+
   RingBuffer<Angle, 3> lastLeftPitchRequest;
   RingBuffer<Angle, 3> lastLeftRollRequest;
   RingBuffer<Angle, 3> lastRightPitchRequest;
@@ -118,6 +130,16 @@ public:
 
   WalkStepAdjustment();
 
+  /**
+   * Predict the com position with a linear inverted pendulum over the support foot.
+   * The com velocity is estimated from the com positions of consecutive motion frames.
+   * @param comX The measured com position in x axis
+   * @param supportX The position of the support foot in x axis
+   * @param walkStepParams the parameters for the walk step adjustment
+   * @return The predicted com position in x axis
+   */
+  float predictCom(const float comX, const float supportX, const WalkStepAdjustmentParams& walkStepParams);
+
   /*
    * Adjust the position of the feet, to ensure that the robot does not fall.
    * If the com is too far to the front, adjust the foot that is more to the front (most of the time it will be the support foot)
@@ -434,14 +434,12 @@ void WalkingEngine::update(WalkGenerator& walkGenerator)
     return Rangea(isLeftPhase ? maxAllowedRotation.limit(-innerTurn) : maxAllowedRotation.limit(-outerTurn), isLeftPhase ? maxAllowedRotation.limit(outerTurn) : maxAllowedRotation.limit(innerTurn));
   };
 
-  walkGenerator.getStepRotationRange = [&walkGenerator](const bool isLeftPhase, const Pose2f& walkSpeedRatio, Vector2f step,
-                                                        const bool isFastWalk, const MotionPhase& lastPhase, const bool ignoreXTranslation, const bool clipTranslation)
+  walkGenerator.getStepRotationRange = [this, &walkGenerator](const bool isLeftPhase, const Pose2f& walkSpeedRatio, Vector2f step,
+                                                              const bool isFastWalk, const MotionPhase& lastPhase, const bool ignoreXTranslation, const bool clipTranslation)
   {
-    std::vector<Vector2f> translationPolygon;
-    std::vector<Vector2f> translationPolygonNoCenter;
-    walkGenerator.getTranslationPolygon(isLeftPhase, 0, lastPhase, walkSpeedRatio, translationPolygon, translationPolygonNoCenter, isFastWalk, false);
+    walkGenerator.getTranslationPolygon(isLeftPhase, 0, lastPhase, walkSpeedRatio, stepRotationRangePolygon, stepRotationRangePolygonNoCenter, isFastWalk, false);
 
-    return walkGenerator.getStepRotationRangeOther(isLeftPhase, walkSpeedRatio, step, isFastWalk, translationPolygon, ignoreXTranslation, clipTranslation);
+    return walkGenerator.getStepRotationRangeOther(isLeftPhase, walkSpeedRatio, step, isFastWalk, stepRotationRangePolygon, ignoreXTranslation, clipTranslation);
   };
 
   walkGenerator.getTranslationPolygon = [this](const bool isLeftPhase, float rotation, const MotionPhase& lastPhase, const Pose2f& walkSpeedRatio, std::vector<Vector2f>& translationPolygon, std::vector<Vector2f>& translationPolygonNoCenter, const bool fastWalk, const bool useMaxPossibleStepSize)
@@ -560,9 +558,10 @@ void WalkingEngine::update(WalkGenerator& walkGenerator)
     }
     else
     {
-      const RobotModel lastRobotModel(theJointRequest, theRobotDimensions, theMassCalibration);
-      left.translate(lastRobotModel.soleLeft.translation.head<2>() + Vector2f(0.f, kinematicParameters.torsoOffset)).rotate(lastRobotModel.soleLeft.rotation.getZAngle());
-      right.translate(lastRobotModel.soleRight.translation.head<2>() + Vector2f(0.f, kinematicParameters.torsoOffset)).rotate(lastRobotModel.soleRight.rotation.getZAngle());
+      const Pose3f lastSoleLeft = ForwardKinematic::calculateSole(Legs::left, theJointRequest, theRobotDimensions);
+      const Pose3f lastSoleRight = ForwardKinematic::calculateSole(Legs::right, theJointRequest, theRobotDimensions);
+      left.translate(lastSoleLeft.translation.head<2>() + Vector2f(0.f, kinematicParameters.torsoOffset)).rotate(lastSoleLeft.rotation.getZAngle());
+      right.translate(lastSoleRight.translation.head<2>() + Vector2f(0.f, kinematicParameters.torsoOffset)).rotate(lastSoleRight.rotation.getZAngle());
     }
     return std::make_tuple(left, right, lastStep);
   };
@@ -655,7 +654,8 @@ void WalkingEngine::generateTranslationPolygon(std::vector<Vector2f>& polygon, c
   ASSERT(!translationPolygonBig.empty());
   const std::vector<Vector2f>& original = !useMaxPossibleStepSize ? translationPolygon : translationPolygonBig;
   ASSERT(original.size() == 8);
-  std::vector<Vector2f> translationPolygonTemp = original;
+  std::vector<Vector2f>& translationPolygonTemp = clippedTranslationPolygon;
+  translationPolygonTemp = original; // reuses the capacity of the buffer
   for(Vector2f& edge : translationPolygonTemp)
   {
     // x
@@ -1186,12 +1186,11 @@ void WalkPhase::calcJoints(const MotionRequest& motionRequest, JointRequest& joi
 
     if(!Approx::isZero(kneeBalance, 0.1_deg))
     {
-      const RobotModel model(jointRequest, engine.theRobotDimensions, engine.theMassCalibration);
-      Pose3f leftFoot = model.soleLeft;
-      Pose3f rightFoot = model.soleRight;
-      Pose3f tibia = model.limbs[isLeftPhase ? Limbs::tibiaLeft : Limbs::tibiaRight];
+      Pose3f tibia;
+      Pose3f leftFoot = ForwardKinematic::calculateSole(Legs::left, jointRequest, engine.theRobotDimensions, isLeftPhase ? &tibia : nullptr);
+      Pose3f rightFoot = ForwardKinematic::calculateSole(Legs::right, jointRequest, engine.theRobotDimensions, isLeftPhase ? nullptr : &tibia);
 
-      Pose3f sole = isLeftPhase ? model.soleLeft : model.soleRight;
+      Pose3f sole = isLeftPhase ? leftFoot : rightFoot;
       const Pose3f diff = tibia.inverse() * sole;
       sole = tibia.rotateY(kneeBalance) * diff;
       if(isLeftPhase)
@@ -1243,10 +1242,9 @@ void WalkPhase::calcJoints(const MotionRequest& motionRequest, JointRequest& joi
   }
 
   {
-    const RobotModel model(jointRequest, engine.theRobotDimensions, engine.theMassCalibration);
     const Pose3f rot(Rotation::aroundY(-armCompensationTilt[0]));
-    armPitchShift[Legs::left] = (rot * model.soleLeft).translation.x() - leftFootForArms.translation.x();
-    armPitchShift[Legs::right] = (rot * model.soleRight).translation.x() - rightFootForArms.translation.x();
+    armPitchShift[Legs::left] = (rot * ForwardKinematic::calculateSole(Legs::left, jointRequest, engine.theRobotDimensions)).translation.x() - leftFootForArms.translation.x();
+    armPitchShift[Legs::right] = (rot * ForwardKinematic::calculateSole(Legs::right, jointRequest, engine.theRobotDimensions)).translation.x() - rightFootForArms.translation.x();
   }
 
   // Apply dynamic stiffness
@@ -1533,18 +1531,15 @@ void WalkPhase::compensateArms(Pose3f& leftFoot, Pose3f& rightFoot, JointRequest
   for(int joint = 0; joint < Joints::firstArmJoint; ++joint) // head
     temp.angles[joint] = temp.angles[joint] != JointRequest::off && temp.angles[joint] != JointRequest::ignore
                          ? temp.angles[joint] : engine.theJointAngles.angles[joint];
-  const RobotModel withWalkGeneratorArms(temp, engine.theRobotDimensions, engine.theMassCalibration); // walk arms
+  const Vector3f withWalkGeneratorArms = ForwardKinematic::calculateCenterOfMass(temp, engine.theRobotDimensions, engine.theMassCalibration); // walk arms
   for(int joint = Joints::firstArmJoint; joint < Joints::firstLegJoint; ++joint) // with arm engine request
     temp.angles[joint] = jointRequest.angles[joint] != JointRequest::off
                          ? jointRequest.angles[joint] : engine.theJointAngles.angles[joint];
-  RobotModel balanced(temp, engine.theRobotDimensions, engine.theMassCalibration);
 
   VERIFY(InverseKinematic::calcLegJoints(leftFoot, rightFoot, Vector2f(0.f, 0.f), temp, engine.theRobotDimensions, increaseInverseKinematicClipThreshold ? engine.kinematicParameters.legLengthClipThreshold : 0.f) || SystemCall::getMode() == SystemCall::logFileReplay);
-  ForwardKinematic::calculateLegChain(Legs::left, temp, engine.theRobotDimensions, balanced.limbs);
-  ForwardKinematic::calculateLegChain(Legs::right, temp, engine.theRobotDimensions, balanced.limbs);
-  balanced.updateCenterOfMass(engine.theMassCalibration);
+  const Vector3f balanced = ForwardKinematic::calculateCenterOfMass(temp, engine.theRobotDimensions, engine.theMassCalibration);
   armCompensationAfterKick = std::max(0.f, armCompensationAfterKick - Constants::motionCycleTime * 1000.f / engine.kinematicParameters.baseWalkPeriod);
-  armCompensationTilt.push_front((balanced.centerOfMass.x() - withWalkGeneratorArms.centerOfMass.x()) * (1.f - armCompensationAfterKick) * engine.armParameters.comTiltFactor);
+  armCompensationTilt.push_front((balanced.x() - withWalkGeneratorArms.x()) * (1.f - armCompensationAfterKick) * engine.armParameters.comTiltFactor);
 
   PLOT("module:WalkingEngine:armCompensation", armCompensationTilt[0].toDegrees());
 }
@@ -356,6 +356,10 @@ public:
   std::vector<Vector2f> translationPolygonBigNotClipped; /**< The polygon that defines the max allowed translation for the step size with much higher values without clipping. DO NOT use for walking. */
   std::vector<Vector2f> translationPolygonAfterKick; /**< The polygon that defines the max allowed translation after a kick from the KickEngine. */
 
+  std::vector<Vector2f> clippedTranslationPolygon; /**< Buffer for the polygon clipped in \c generateTranslationPolygon. Avoids allocations in each call. */
+  std::vector<Vector2f> stepRotationRangePolygon; /**< Buffer for the translation polygon in \c getStepRotationRange. Avoids allocations in each call. */
+  std::vector<Vector2f> stepRotationRangePolygonNoCenter; /**< Buffer for the unused translation polygon in \c getStepRotationRange. */
+
   /** The constructor loads the common parameters. */
   WalkingEngine();
 
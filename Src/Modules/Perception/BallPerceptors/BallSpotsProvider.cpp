@@ -219,21 +219,11 @@ bool BallSpotsProvider::checkGreenAround(const Vector2i& spot, const float radiu
   const int y2 = spot.y() + useRadius;
   const int y22 = spot.y() + useRadius + 1;
 
-  for(int x = spot.x() - useRadius + 1; x <= lastX; x++)
-    if(theRelativeFieldColors.isFieldNearWhite(theECImage.grayscaled[y1][x], theECImage.saturated[y1][x], luminanceRef, saturationRef))
-      count++;
-
-  for(int x = spot.x() - useRadius + 1; x <= lastX; x++)
-    if(theRelativeFieldColors.isFieldNearWhite(theECImage.grayscaled[y12][x], theECImage.saturated[y12][x], luminanceRef, saturationRef))
-      count++;
-
-  for(int x = spot.x() - useRadius + 1; x <= lastX; x++)
-    if(theRelativeFieldColors.isFieldNearWhite(theECImage.grayscaled[y2][x], theECImage.saturated[y2][x], luminanceRef, saturationRef))
-      count++;
-
-  for(int x = spot.x() - useRadius + 1; x <= lastX; x++)
-    if(theRelativeFieldColors.isFieldNearWhite(theECImage.grayscaled[y22][x], theECImage.saturated[y22][x], luminanceRef, saturationRef))
-      count++;
+  const int firstX = spot.x() - useRadius + 1;
+  const unsigned numOfPixels = static_cast<unsigned>(std::max(0, lastX - firstX + 1));
+  for(const int y : {y1, y12, y2, y22})
+    count += static_cast<int>(theRelativeFieldColors.countFieldNearWhite(&theECImage.grayscaled[y][firstX], &theECImage.saturated[y][firstX],
+                                                                         numOfPixels, luminanceRef, saturationRef));
 
   const int lastY = spot.y() + useRadius - 1;
 
@@ -61,23 +61,36 @@ void CNSBallSpotsProvider::update(BallSpots& ballSpots)
   if(theCameraMatrix.isValid)
   {
     updateSearchSpace();
+    detector.setSearchSpecification(spec);
 
-    for(const Boundaryi& region : theBallRegions.regions)
+    const std::size_t numOfRegions = theBallRegions.regions.size();
+    objectsPerRegion.resize(numOfRegions);
+    if(numOfWorkers && numOfRegions > 1)
     {
-      spec.blockX = region.x.getSize();
-      spec.blockY = region.y.getSize();
-      detector.setSearchSpecification(spec);
-      ObjectCNSStereoDetector::IsometryWithResponses newObjects;
-      detector.searchBlockAllPoses(newObjects, theCNSImage, region.x.min, region.y.min);
-
-      if(spec.nRefineIterations > 0)
-        for(IsometryWithResponse& object : newObjects)
-          detector.refine(theCNSImage, object, spec.nRefineIterations);
+      if(!executor || executorWorkers != numOfWorkers)
+      {
+        executor.reset(); // Stop the old workers first
+        executor = std::make_unique<ParallelExecutor>("CNSBallSpotsProvider", numOfWorkers, 0, [](std::size_t) {});
+        executorWorkers = numOfWorkers;
+      }
+      numOfPredecessors.assign(numOfRegions, 0);
+      successors.resize(numOfRegions);
+      executor->execute(numOfPredecessors, successors, [this](std::size_t index)
+      {
+        searchRegion(theBallRegions.regions[index], objectsPerRegion[index]);
+      });
+    }
+    else
+    {
+      executor.reset();
+      for(std::size_t i = 0; i < numOfRegions; ++i)
+        searchRegion(theBallRegions.regions[i], objectsPerRegion[i]);
+    }
 
+    for(const ObjectCNSStereoDetector::IsometryWithResponses& newObjects : objectsPerRegion)
       for(const IsometryWithResponse& object : newObjects)
         if(object.response >= minResponse)
           objects.emplace_back(object);
-    }
 
     std::sort(objects.begin(), objects.end(), MoreOnResponse());
     for(IsometryWithResponse& ballSpot : objects)
@@ -91,6 +104,16 @@ void CNSBallSpotsProvider::update(BallSpots& ballSpots)
   draw();
 }
 
+void CNSBallSpotsProvider::searchRegion(const Boundaryi& region, ObjectCNSStereoDetector::IsometryWithResponses& objects) const
+{
+  objects.clear();
+  detector.searchBlockAllPoses(objects, theCNSImage, region.x.min, region.y.min, region.x.getSize(), region.y.getSize());
+
+  if(spec.nRefineIterations > 0)
+    for(IsometryWithResponse& object : objects)
+      detector.refine(theCNSImage, object, spec.nRefineIterations);
+}
+
 void CNSBallSpotsProvider::updateSearchSpace()
 {
   Matrix4d cameraInImage;
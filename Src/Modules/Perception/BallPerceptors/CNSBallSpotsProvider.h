@@ -20,6 +20,8 @@
 #include "ImageProcessing/CNS/ObjectCNSStereoDetector.h"
 #include "Math/Eigen.h"
 #include "Framework/Module.h"
+#include "Framework/ParallelExecutor.h"
+#include <memory>
 
 MODULE(CNSBallSpotsProvider,
 {,
@@ -44,6 +46,7 @@ MODULE(CNSBallSpotsProvider,
     (int) refineIterations, /**< The number of refinements performed after the global search. */
     (float) refineStepSize, /**< The step size during refinement (in pixels). */
     (float) minResponse, /**< The minimum response returned by the contour detector required for a ball candidate. */
+    (unsigned) numOfWorkers, /**< The number of additional threads searching the ball regions in parallel (0: search them sequentially). */
   }),
 });
 
@@ -53,6 +56,11 @@ private:
   ObjectCNSStereoDetector detector; /**< The detector. */
   ObjectCNSStereoDetector::IsometryWithResponses objects; /**< The poses of the detected objects in the coordinate system of the camera and the responses. */
   SearchSpecification spec; /**< The current search specification. */
+  std::unique_ptr<ParallelExecutor> executor; /**< Searches the ball regions in parallel. nullptr if they are searched sequentially. */
+  std::size_t executorWorkers = 0; /**< The number of workers the executor was created with. */
+  std::vector<ObjectCNSStereoDetector::IsometryWithResponses> objectsPerRegion; /**< The objects found in each ball region. */
+  std::vector<unsigned> numOfPredecessors; /**< The number of predecessors of each region search (always 0). */
+  std::vector<std::vector<std::size_t>> successors; /**< The successors of each region search (always none). */
 
   /**
    * Searches the image for potential balls that need a final validation.
@@ -65,6 +73,15 @@ private:
    */
   void updateSearchSpace();
 
+  /**
+   * Searches a single ball region for balls and refines the results.
+   * This method only reads the state of the detector, so it can be executed
+   * for different regions in parallel.
+   * @param region The region to search.
+   * @param objects The objects found.
+   */
+  void searchRegion(const Boundaryi& region, ObjectCNSStereoDetector::IsometryWithResponses& objects) const;
+
   // Drawing methods for debugging
   void draw();
   void drawRasteredContour(const Contour& contour, const ColorRGBA& color) const;
@@ -158,24 +158,11 @@ bool IntersectionsCandidatesProvider::generatePatch(const Vector2f interImg, con
   ASSERT(maxCutoutFactor >= stretchingFactor);
   const unsigned int inputResize = std::clamp(static_cast<unsigned>(ceilf(normFactor / distanceToIntersection)), stretchingFactor, maxCutoutFactor);
   const unsigned int inputSize = patchSize * inputResize; // This is so that distant intersections do not appear too small in the patch
-  const unsigned int tempOutputSize = patchSize * stretchingFactor; // Size of the patch that gets stretched
   const Vector2f center(interImg.x(), interImg.y());
 
-  Image<PixelTypes::GrayscaledPixel> firstPatch(tempOutputSize, tempOutputSize);
-
-  // extract patch
-  PatchUtilities::extractPatch(center.cast<int>(), Vector2i(inputSize, inputSize), Vector2i(tempOutputSize, tempOutputSize), theECImage.grayscaled, firstPatch);
-
-  // The patch height is 64p. But we need a 32x32 patch. So we cut off the first and last 16 pixels to get the center.
-  const unsigned int pixelToCutOff = (tempOutputSize - patchSize) / 2;
-  for(unsigned int i = pixelToCutOff; i < firstPatch.height - pixelToCutOff; i++)
-  {
-    for(unsigned int j = 0; j < firstPatch.width; j += stretchingFactor)
-    {
-      // Corrected indices for resizedPatch because we only take half of the height and every other value of the width.
-      patch[i - pixelToCutOff][j - j / stretchingFactor] = firstPatch[i][j];
-    }
-  }
+  // Extract the patch in a single pass. The cutout is squeezed horizontally by the stretching factor,
+  // i.e. only the vertical center of a patch that was magnified by this factor is sampled.
+  PatchUtilities::extractPatch(center.cast<int>(), Vector2i(inputSize, inputSize / stretchingFactor), Vector2i(patchSize, patchSize), theECImage.grayscaled, patch);
   return true;
 }
 
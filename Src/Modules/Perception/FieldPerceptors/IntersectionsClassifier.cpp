@@ -9,18 +9,21 @@
 
 #include "IntersectionsClassifier.h"
 #include "Platform/File.h"
+#include "Tools/NeuralNetworks/ModelRegistry.h"
 
 MAKE_MODULE(IntersectionsClassifier);
 
 IntersectionsClassifier::IntersectionsClassifier() : network(&Global::getAsmjitRuntime())
 {
   // Initialize model for the neural net
-  model = std::make_unique<NeuralNetwork::Model>(std::string(File::getBHDir()) + "/Config/NeuralNets/IntersectionsClassifier/distanceUpdatedModel.h5");
+  model = ModelRegistry::get(std::string(File::getBHDir()) + "/Config/NeuralNets/IntersectionsClassifier/distanceUpdatedModel.h5");
   network.compile(*model);
 }
 
 void IntersectionsClassifier::update(IntersectionsPercept& theIntersectionsPercept)
 {
+  patchOutputs.clear();
+
   // check whether network has been successfully compiled
   if(!network.valid())
     return;
@@ -28,11 +31,18 @@ void IntersectionsClassifier::update(IntersectionsPercept& theIntersectionsPerce
   DECLARE_DEBUG_DRAWING("module:IntersectionsClassifier:field", "drawingOnField");
   theIntersectionsPercept.intersections.clear();
 
-  for(IntersectionCandidates::IntersectionCandidate intersection : theIntersectionCandidates.intersections)
+  // Classify all candidates of this frame before any of them is added to the percept.
+  std::vector<IntersectionCandidates::IntersectionCandidate> intersections(theIntersectionCandidates.intersections);
+  std::vector<bool> accepted;
+  classifyIntersections(intersections, accepted);
+
+  for(std::size_t i = 0; i < intersections.size(); ++i)
   {
-    if(!classifyIntersection(intersection))
+    if(!accepted[i])
       continue;
 
+    IntersectionCandidates::IntersectionCandidate& intersection = intersections[i];
+
     // change attributes dependent on intersection type
     switch(intersection.type)
     {
@@ -73,6 +83,26 @@ void IntersectionsClassifier::update(IntersectionsPercept& theIntersectionsPerce
   }
 }
 
+void IntersectionsClassifier::update(IntersectionPatches& theIntersectionPatches)
+{
+  theIntersectionPatches.patches.clear();
+  const std::vector<IntersectionCandidates::IntersectionCandidate>& intersections = theIntersectionCandidates.intersections;
+  if(patchOutputs.empty() || intersections.empty())
+    return;
+
+  const std::size_t outputsPerPatch = patchOutputs.size() / intersections.size();
+  theIntersectionPatches.patchSize = Vector2i(intersections.front().imagePatch.width, intersections.front().imagePatch.height);
+  theIntersectionPatches.patches.resize(intersections.size());
+  for(std::size_t i = 0; i < intersections.size(); ++i)
+  {
+    const Image<PixelTypes::GrayscaledPixel>& imagePatch = intersections[i].imagePatch;
+    ImagePatches::Patch& patch = theIntersectionPatches.patches[i];
+    patch.position = intersections[i].pos;
+    patch.pixels.assign(imagePatch[0], imagePatch[0] + imagePatch.width * imagePatch.height);
+    patch.outputs.assign(patchOutputs.begin() + i * outputsPerPatch, patchOutputs.begin() + (i + 1) * outputsPerPatch);
+  }
+}
+
 void IntersectionsClassifier::enforceTIntersectionDirections(const Vector2f& vertical, Vector2f& horizontal) const
 {
   Vector2f vertical90 = vertical;
@@ -93,39 +123,63 @@ void IntersectionsClassifier::addIntersection(IntersectionsPercept& theIntersect
   }
 }
 
-bool IntersectionsClassifier::classifyIntersection(IntersectionCandidates::IntersectionCandidate& intersection)
+void IntersectionsClassifier::classifyIntersections(std::vector<IntersectionCandidates::IntersectionCandidate>& intersections, std::vector<bool>& accepted)
 {
-  STOPWATCH("module:IntersectionsClassifier:network") {
-    const unsigned patchSize = intersection.imagePatch.height;
-    PatchUtilities::extractPatch(Vector2i(patchSize/2, patchSize/2), Vector2i(patchSize, patchSize), Vector2i(patchSize, patchSize), intersection.imagePatch, network.input(0).data());
-    *(network.input(1).data()) = intersection.distance;
-    ASSERT(network.input(1).rank() == 1);
+  accepted.assign(intersections.size(), true);
+  if(intersections.empty())
+    return;
 
-    network.apply();
-    float l = network.output(0)[0];
-    float none = network.output(0)[1];
-    float t = network.output(0)[2];
-    float x = network.output(0)[3];
+  STOPWATCH("module:IntersectionsClassifier:network")
+  {
+    ASSERT(network.input(1).rank() == 1);
 
-    if(none >= threshold + 0.1f)
-      return false;
-    if(l >= threshold)
+    // Convert the patches of all candidates into one contiguous buffer first,
+    // so that the network is afterwards fed from consecutive memory.
+    const std::size_t patchPixels = network.input(0).size();
+    patchData.resize(intersections.size() * patchPixels);
+    for(std::size_t i = 0; i < intersections.size(); ++i)
     {
-      intersection.type = IntersectionsPercept::Intersection::L;
-      return true;
+      const Image<PixelTypes::GrayscaledPixel>& patch = intersections[i].imagePatch;
+      ASSERT(patch.width * patch.height == patchPixels);
+      std::copy(patch[0], patch[0] + patchPixels, patchData.data() + i * patchPixels);
     }
-    if(t >= threshold)
-    {
-      intersection.type = IntersectionsPercept::Intersection::T;
-      return true;
-    }
-    // We want to be especially sure before we classify an intersection as x.
-    if(x >= threshold + 0.1f)
+
+    for(std::size_t i = 0; i < intersections.size(); ++i)
     {
-      intersection.type = IntersectionsPercept::Intersection::X;
-      return true;
+      std::copy(patchData.data() + i * patchPixels, patchData.data() + (i + 1) * patchPixels, network.input(0).data());
+      *(network.input(1).data()) = intersections[i].distance;
+      network.apply();
+      patchOutputs.insert(patchOutputs.end(), network.output(0).data(), network.output(0).data() + network.output(0).size());
+      accepted[i] = classifyIntersection(intersections[i]);
     }
   }
+}
+
+bool IntersectionsClassifier::classifyIntersection(IntersectionCandidates::IntersectionCandidate& intersection)
+{
+  const float l = network.output(0)[0];
+  const float none = network.output(0)[1];
+  const float t = network.output(0)[2];
+  const float x = network.output(0)[3];
+
+  if(none >= threshold + 0.1f)
+    return false;
+  if(l >= threshold)
+  {
+    intersection.type = IntersectionsPercept::Intersection::L;
+    return true;
+  }
+  if(t >= threshold)
+  {
+    intersection.type = IntersectionsPercept::Intersection::T;
+    return true;
+  }
+  // We want to be especially sure before we classify an intersection as x.
+  if(x >= threshold + 0.1f)
+  {
+    intersection.type = IntersectionsPercept::Intersection::X;
+    return true;
+  }
   // If no prediction passes the threshold, take the original prediction by the IntersectionsCandidatesProvider.
   return true;
 }
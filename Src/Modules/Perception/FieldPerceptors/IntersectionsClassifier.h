@@ -15,6 +15,7 @@
 #include "Representations/Modeling/RobotPose.h"
 #include "Representations/Perception/FieldPercepts/IntersectionCandidates.h"
 #include "Representations/Perception/FieldPercepts/IntersectionsPercept.h"
+#include "Representations/Perception/ImagePreprocessing/ImagePatches.h"
 #include <CompiledNN/CompiledNN.h>
 #include <CompiledNN/Model.h>
 
@@ -24,6 +25,8 @@ MODULE(IntersectionsClassifier,
   REQUIRES(IntersectionCandidates),
   REQUIRES(RobotPose),
   PROVIDES(IntersectionsPercept),
+  REQUIRES(IntersectionsPercept),
+  PROVIDES_LAZY(IntersectionPatches),
   LOADS_PARAMETERS(
   {,
     (float) threshold,  /**< threshold value for the confidence value of the neural net. If 0, neural net is not used. */
@@ -43,6 +46,12 @@ private:
    */
   void update(IntersectionsPercept& theIntersectionsPercept) override;
 
+  /**
+   * Provides the patches of the intersection candidates classified in the current frame.
+   * @param theIntersectionPatches The representation updated.
+   */
+  void update(IntersectionPatches& theIntersectionPatches) override;
+
   /**
    * Validates the intersection type and emplaces the newly found intersection into the IntersectionsPercept.
    * @param intersectionsPercept the IntersectionsPercept the intersection is added to.
@@ -50,7 +59,15 @@ private:
    */
   void addIntersection(IntersectionsPercept& intersectionsPercept, IntersectionCandidates::IntersectionCandidate& intersection);
 
-  /** Classifies the intersection candidate with a neural net and returns the predicted type.
+  /**
+   * Classifies all intersection candidates of the current frame with the neural net.
+   * The patches are gathered in a contiguous buffer before the net is applied to them.
+   * @param intersections The candidates. Their types are replaced by the predicted ones.
+   * @param accepted For each candidate, whether it was not rejected by the neural net.
+   */
+  void classifyIntersections(std::vector<IntersectionCandidates::IntersectionCandidate>& intersections, std::vector<bool>& accepted);
+
+  /** Interprets the output of the neural net for an intersection candidate and sets the predicted type.
    * @param intersection the intersection to be classified.
    * @return False if the neural net predicted the given candidate not to be an intersection. True otherwise.
    */
@@ -60,5 +77,7 @@ private:
   void enforceTIntersectionDirections(const Vector2f& vertical, Vector2f& horizontal) const;
 
   NeuralNetwork::CompiledNN network;
-  std::unique_ptr<NeuralNetwork::Model> model;
+  std::shared_ptr<const NeuralNetwork::Model> model;
+  std::vector<float> patchData; /**< The patches of all candidates of the current frame. */
+  std::vector<float> patchOutputs; /**< The outputs of the neural net for all candidates of the current frame, one after another. */
 };
@@ -28,6 +28,7 @@ void LinePerceptor::update(LinesPercept& linesPercept)
   circleCandidates.clear();
   scanHorizontalScanLines(linesPercept);
   scanVerticalScanLines(linesPercept);
+  candidates.clear(); // Their spots were allocated from the frame arena.
   extendLines(linesPercept);
 }
 
@@ -117,6 +118,8 @@ void LinePerceptor::scanHorizontalScanLines(LinesPercept& linesPercept)
   if(!theFieldBoundary.isValid)
     return;
 
+  const Transformation::ImageToRobotProjection projection(theCameraMatrix, theCameraInfo, theImageCoordinateSystem);
+
   unsigned int scanLineId = 0;
   for(const ColorScanLineRegionsHorizontal::ScanLine& scanLine : theColorScanLineRegionsHorizontal.scanLines)
   {
@@ -146,9 +149,9 @@ void LinePerceptor::scanHorizontalScanLines(LinesPercept& linesPercept)
             }
             spotsH[scanLineId].emplace_back(static_cast<float>((region->range.left + region->range.right)) / 2.f, scanLine.y);
             Spot& thisSpot = spotsH[scanLineId].back();
-            Vector2f corrected(theImageCoordinateSystem.toCorrected(thisSpot.image));
+            Vector2f corrected;
             Vector2f otherImage;
-            if(Transformation::imageToRobot(corrected, theCameraMatrix, theCameraInfo, thisSpot.field) &&
+            if(projection.imageToRobot(thisSpot.image, corrected, thisSpot.field) &&
                Transformation::robotToImage(Vector2f(thisSpot.field + thisSpot.field.normalized(theFieldDimensions.fieldLinesWidth).rotateLeft()), theCameraMatrix, theCameraInfo, otherImage))
             {
               float expectedWidth = (otherImage - corrected).norm();
@@ -198,8 +201,7 @@ void LinePerceptor::scanHorizontalScanLines(LinesPercept& linesPercept)
                   if(!lineFitted)
                   {
                     thisSpot.candidate = candidate.spots.front()->candidate;
-                    candidate.spots.emplace_back(&thisSpot);
-                    candidate.fitLine();
+                    candidate.addSpot(&thisSpot);
                     if(circleFitted)
                       goto hEndAdjacentSearch;
                     lineFitted = true;
@@ -216,8 +218,7 @@ void LinePerceptor::scanHorizontalScanLines(LinesPercept& linesPercept)
                    isSegmentValid(thisSpot, spot, candidate))
                 {
                   thisSpot.candidate = candidate.spots.front()->candidate;
-                  candidate.spots.emplace_back(&thisSpot);
-                  candidate.fitLine();
+                  candidate.addSpot(&thisSpot);
                   goto hEndAdjacentSearch;
                 }
               }
@@ -293,6 +294,8 @@ void LinePerceptor::scanVerticalScanLines(LinesPercept& linesPercept)
   spotsV.resize(theColorScanLineRegionsVerticalClipped.scanLines.size());
   candidates.clear();
 
+  const Transformation::ImageToRobotProjection projection(theCameraMatrix, theCameraInfo, theImageCoordinateSystem);
+
   unsigned int scanLineId = 0;
   unsigned int startIndex = highResolutionScan ? 0 : theColorScanLineRegionsVerticalClipped.lowResStart;
   unsigned int stepSize = highResolutionScan ? 1 : theColorScanLineRegionsVerticalClipped.lowResStep;
@@ -321,9 +324,9 @@ void LinePerceptor::scanVerticalScanLines(LinesPercept& linesPercept)
           {
             spotsV[scanLineId].emplace_back(theColorScanLineRegionsVerticalClipped.scanLines[scanLineIndex].x, static_cast<float>(region->range.upper + region->range.lower) / 2.f);
             Spot& thisSpot = spotsV[scanLineId].back();
-            Vector2f corrected = theImageCoordinateSystem.toCorrected(thisSpot.image);
+            Vector2f corrected;
             Vector2f otherImage;
-            if(Transformation::imageToRobot(corrected, theCameraMatrix, theCameraInfo, thisSpot.field) &&
+            if(projection.imageToRobot(thisSpot.image, corrected, thisSpot.field) &&
                Transformation::robotToImage(Vector2f(thisSpot.field + thisSpot.field.normalized(theFieldDimensions.fieldLinesWidth)), theCameraMatrix, theCameraInfo, otherImage))
             {
               float expectedHeight = (corrected - otherImage).norm();
@@ -372,8 +375,7 @@ void LinePerceptor::scanVerticalScanLines(LinesPercept& linesPercept)
                   if(!lineFitted)
                   {
                     thisSpot.candidate = candidate.spots.front()->candidate;
-                    candidate.spots.emplace_back(&thisSpot);
-                    candidate.fitLine();
+                    candidate.addSpot(&thisSpot);
                     if(circleFitted)
                       goto vEndAdjacentSearch;
                     lineFitted = true;
@@ -390,8 +392,7 @@ void LinePerceptor::scanVerticalScanLines(LinesPercept& linesPercept)
                    isSegmentValid(thisSpot, spot, candidate))
                 {
                   thisSpot.candidate = candidate.spots.front()->candidate;
-                  candidate.spots.emplace_back(&thisSpot);
-                  candidate.fitLine();
+                  candidate.addSpot(&thisSpot);
                   goto vEndAdjacentSearch;
                 }
               }
@@ -632,9 +633,9 @@ void LinePerceptor::trimLine(LinesPercept::Line& line) const
 
   if(start != line.firstImg || end != line.lastImg)
   {
-    std::vector<Vector2i> spotsInImgTrimmed;
+    FrameVector<Vector2i> spotsInImgTrimmed;
     spotsInImgTrimmed.reserve(line.spotsInImg.size());
-    std::vector<Vector2f> spotsInFieldTrimmed;
+    FrameVector<Vector2f> spotsInFieldTrimmed;
     spotsInFieldTrimmed.reserve(line.spotsInField.size());
     for(unsigned int i = 0; i < line.spotsInImg.size(); ++i)
     {
@@ -645,8 +646,8 @@ void LinePerceptor::trimLine(LinesPercept::Line& line) const
         spotsInFieldTrimmed.emplace_back(line.spotsInField.at(i));
       }
     }
-    line.spotsInImg = spotsInImgTrimmed;
-    line.spotsInField = spotsInFieldTrimmed;
+    line.spotsInImg.assign(spotsInImgTrimmed.begin(), spotsInImgTrimmed.end());
+    line.spotsInField.assign(spotsInFieldTrimmed.begin(), spotsInFieldTrimmed.end());
   }
 }
 
@@ -24,6 +24,7 @@
 #include "Representations/Perception/ObstaclesPercepts/ObstaclesImagePercept.h"
 #include "Math/Eigen.h"
 #include "Math/LeastSquares.h"
+#include "Framework/FrameArena.h"
 #include "Framework/Module.h"
 
 #include <limits>
@@ -103,11 +104,13 @@ private:
   {
     Vector2f n0;
     float d;
-    std::vector<const Spot*> spots;
+    FrameVector<const Spot*> spots; /**< Allocated from the frame arena, so the candidate must not survive the frame. */
+    LeastSquares::LineFitter fitter; /**< Running sums over the field positions of all spots. */
 
     Candidate(const Spot* anchor) : spots()
     {
       spots.emplace_back(anchor);
+      fitter.add(anchor->field);
     }
 
     /**
@@ -121,14 +124,16 @@ private:
     }
 
     /**
-     * Recalculates n0 and d.
+     * Adds a spot to this candidate and recalculates n0 and d.
+     * Only the new spot is added to the running sums, so the cost does not
+     * grow with the number of spots.
+     *
+     * @param spot The spot to add
      */
-    void fitLine()
+    void addSpot(const Spot* spot)
     {
-      LeastSquares::LineFitter fitter;
-      for(const Spot* spot : spots)
-        fitter.add(spot->field);
-
+      spots.emplace_back(spot);
+      fitter.add(spot->field);
       VERIFY(fitter.fit(n0, d));
     }
   };
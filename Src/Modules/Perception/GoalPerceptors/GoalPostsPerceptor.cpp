@@ -14,7 +14,9 @@
 #include "Libs/ImageProcessing/Image.h"
 #include "Math/Geometry.h"
 #include "Platform/File.h"
+#include "Platform/Time.h"
 #include "Tools/Math/Transformation.h"
+#include "Tools/NeuralNetworks/ModelRegistry.h"
 
 MAKE_MODULE(GoalPostsPerceptor);
 
@@ -23,12 +25,12 @@ GoalPostsPerceptor::GoalPostsPerceptor() :
   detector(&Global::getAsmjitRuntime())
 {
   // Initialize models for the neural net
-  classifier_model = std::make_unique<NeuralNetwork::Model>(std::string(File::getBHDir())
-                                                            + "/Config/NeuralNets/GoalPostsPerceptor/classifier_model.h5");
+  classifier_model = ModelRegistry::get(std::string(File::getBHDir())
+                                        + "/Config/NeuralNets/GoalPostsPerceptor/classifier_model.h5");
   classifier.compile(*classifier_model);
 
-  detector_model = std::make_unique<NeuralNetwork::Model>(std::string(File::getBHDir())
-                                                          + "/Config/NeuralNets/GoalPostsPerceptor/detector_model.h5");
+  detector_model = ModelRegistry::get(std::string(File::getBHDir())
+                                      + "/Config/NeuralNets/GoalPostsPerceptor/detector_model.h5");
   detector.compile(*detector_model);
 
   ASSERT(classifier.numOfInputs() == 1);
@@ -168,20 +170,17 @@ std::vector<Vector2f> GoalPostsPerceptor::generatePatch(const std::vector<GoalPo
 {
   const bool writeFiles = false;
 
-  // Center of GoalPostRegion
-  Vector2f pInImg;
-  Vector2f pInImgRelative;
   Image<PixelTypes::GrayscaledPixel> patch(patchSize, patchSize);
   // Vector of all found goalPostBases
   std::vector<Vector2f> foundGoalPostBases;
 
-  for(int i = 0; i < candidateLimit; i++)
+  // Collect all candidates first, so that the closest ones can be classified first.
+  std::vector<Candidate> candidates;
+  for(const GoalPostRegion& region : regionList)
   {
-    if((int)regionList.size() <= i) break;
-
     // center of the patch to extract. The patch is a square of which the edge length is the same as the horizontal edge of the GoalPostRegion
-    pInImg = Vector2f(regionList[i].upperLeft.x() + (regionList[i].lowerRight.x() - regionList[i].upperLeft.x()) / 2,
-                      regionList[i].lowerRight.y() - (regionList[i].lowerRight.x() - regionList[i].upperLeft.x()) / 2);
+    const Vector2f pInImg(region.upperLeft.x() + (region.lowerRight.x() - region.upperLeft.x()) / 2,
+                          region.lowerRight.y() - (region.lowerRight.x() - region.upperLeft.x()) / 2);
 
     // Check whether the center of the patch would even be within the bounds of the camera image.
     if(!isWithinBounds(pInImg, patchSize))
@@ -189,6 +188,7 @@ std::vector<Vector2f> GoalPostsPerceptor::generatePatch(const std::vector<GoalPo
 
     CROSS("module:GoalPostsPerceptor:centerOfPatch", pInImg.x(), pInImg.y(), 4, 4, Drawings::solidPen, ColorRGBA::orange);
 
+    Vector2f pInImgRelative;
     if(Transformation::imageToRobot(theImageCoordinateSystem.toCorrected(pInImg), theCameraMatrix, theCameraInfo, pInImgRelative))
     {
       // distance from robot to center of patch (in mm)
@@ -197,6 +197,30 @@ std::vector<Vector2f> GoalPostsPerceptor::generatePatch(const std::vector<GoalPo
       if(distanceToGoalPost > sqr(maxDistanceToCandidate))
         continue;
 
+      // Capture the whole width of GoalPostRegion
+      candidates.push_back({pInImg, theRobotPose * pInImgRelative, std::sqrt(distanceToGoalPost),
+                            static_cast<int>(std::round(region.lowerRight.x() - region.upperLeft.x()))});
+    }
+  }
+  std::sort(candidates.begin(), candidates.end(), [](const Candidate& c1, const Candidate& c2) {return c1.distance < c2.distance;});
+
+  // Classifications of the previous frame can be reused if they were computed by the network.
+  const bool reusable = theFrameInfo.getTimeSince(classificationTime) <= maxReuseAge;
+  std::vector<Classification> newClassifications;
+
+  const unsigned long long startTime = Time::getCurrentThreadTime();
+  for(std::size_t i = 0; i < candidates.size() && static_cast<int>(i) < candidateLimit; ++i)
+  {
+    // Stop classifying when the runtime budget of this frame is spent. The closest candidate is always processed.
+    if(i > 0 && Time::getCurrentThreadTime() - startTime > classificationBudget)
+      break;
+
+    const Candidate& candidate = candidates[i];
+    const Vector2f& pInImg = candidate.positionInImage;
+    const int inputSize = candidate.inputSize;
+
+    if(writeFiles)
+    {
       // Directory to save patches to
       const std::string target_dir = ""; // < Absolute path
 
@@ -207,45 +231,58 @@ std::vector<Vector2f> GoalPostsPerceptor::generatePatch(const std::vector<GoalPo
       const std::string half = ""; // < Can be 1st or 2nd
       const std::string robot = ""; // < IP of playing robot
       const std::string camera = theCameraInfo.camera == CameraInfo::lower ? "lower" : "upper";
-      const Vector2f center(pInImg.x(), pInImg.y());
-
-      // Capture the whole width of GoalPostRegion
-      const int inputSize = (int)round(regionList[i].lowerRight.x() - regionList[i].upperLeft.x());
-
-      const std::string fileName = competition + "-" + opponent + "-" + half + "-" + robot + "-" + time + "-" + camera + "-" + std::to_string((int)round(distanceToGoalPost));
-
-      PatchUtilities::extractPatch(center.cast<int>(), Vector2i(inputSize, inputSize), Vector2i(patchSize, patchSize), theECImage.grayscaled, patch);
-
-      RECTANGLE("module:GoalPostsPerceptor:candidatePatch", pInImg.x() - inputSize / 2, pInImg.y() - inputSize / 2, pInImg.x() + inputSize / 2, pInImg.y() + inputSize / 2, 4, Drawings::solidPen, ColorRGBA::yellow);
-
+      const std::string fileName = competition + "-" + opponent + "-" + half + "-" + robot + "-" + time + "-" + camera + "-" + std::to_string((int)round(candidate.distance * candidate.distance));
       const std::string file = target_dir + fileName + ".bin";
 
+      PatchUtilities::extractPatch(pInImg.cast<int>(), Vector2i(inputSize, inputSize), Vector2i(patchSize, patchSize), theECImage.grayscaled, patch);
+
       // Put patch into file
-      if(writeFiles)
+      OutBinaryFile stream(file);
+      for(unsigned int i = 0; i < patch.height; i++)
       {
-        OutBinaryFile stream(file);
-        for(unsigned int i = 0; i < patch.height; i++)
+        for(unsigned int j = 0; j < patch.width; j++)
         {
-          for(unsigned int j = 0; j < patch.width; j++)
-          {
-            stream << patch[i][j];
-          }
+          stream << patch[i][j];
         }
       }
-      // Use neural networks to classify candidate and detect goal post base.
-      else
-      {
-        Vector2f goalPostBase;
-        if(classifyGoalPost(patch))
-        {
-          RECTANGLE("module:GoalPostsPerceptor:classifiedGoalPosts", pInImg.x() - inputSize / 2, pInImg.y() - inputSize / 2, pInImg.x() + inputSize / 2, pInImg.y() + inputSize / 2, 4, Drawings::solidPen, ColorRGBA::green);
+      continue;
+    }
+
+    RECTANGLE("module:GoalPostsPerceptor:candidatePatch", pInImg.x() - inputSize / 2, pInImg.y() - inputSize / 2, pInImg.x() + inputSize / 2, pInImg.y() + inputSize / 2, 4, Drawings::solidPen, ColorRGBA::yellow);
 
-          goalPostBase = getGoalPostBase(patch, pInImg, inputSize);
-          foundGoalPostBases.emplace_back(goalPostBase);
+    // Use neural networks to classify candidate and detect goal post base.
+    const Classification* previous = nullptr;
+    if(reusable)
+      for(const Classification& classification : classifications)
+        if(classification.computed && (classification.positionOnField - candidate.positionOnField).squaredNorm() <= sqr(maxReuseDistance))
+        {
+          previous = &classification;
+          break;
         }
-      }
+
+    bool isGoalPost;
+    if(previous)
+      isGoalPost = previous->isGoalPost;
+    else
+    {
+      PatchUtilities::extractPatch(pInImg.cast<int>(), Vector2i(inputSize, inputSize), Vector2i(patchSize, patchSize), theECImage.grayscaled, patch);
+      isGoalPost = classifyGoalPost(patch);
+    }
+    newClassifications.push_back({candidate.positionOnField, isGoalPost, !previous});
+
+    if(isGoalPost)
+    {
+      RECTANGLE("module:GoalPostsPerceptor:classifiedGoalPosts", pInImg.x() - inputSize / 2, pInImg.y() - inputSize / 2, pInImg.x() + inputSize / 2, pInImg.y() + inputSize / 2, 4, Drawings::solidPen, ColorRGBA::green);
+
+      // The detector needs the patch of the current image even if the classification was reused.
+      if(previous)
+        PatchUtilities::extractPatch(pInImg.cast<int>(), Vector2i(inputSize, inputSize), Vector2i(patchSize, patchSize), theECImage.grayscaled, patch);
+      foundGoalPostBases.emplace_back(getGoalPostBase(patch, pInImg, inputSize));
     }
   }
+
+  classifications.swap(newClassifications);
+  classificationTime = theFrameInfo.time;
   return foundGoalPostBases;
 }
 
@@ -73,6 +73,15 @@ MODULE(GoalPostsPerceptor,
 
     /** Maximum number of candidates that can be classfied in a single frame. (to limit runtime in case of disaster) */
     (int)(15) candidateLimit,
+
+    /** Thread time in microseconds after which no further candidates are classified in a frame. The closest candidates are classified first. */
+    (unsigned)(4000) classificationBudget,
+
+    /** Maximum distance on the field between a candidate and one classified in the previous frame to reuse its classification. */
+    (float)(150.f) maxReuseDistance,
+
+    /** Maximum age of the classifications of the previous frame to reuse them (in ms). */
+    (int)(100) maxReuseAge,
   }),
 });
 
@@ -91,8 +100,8 @@ private:
 
   NeuralNetwork::CompiledNN classifier;
   NeuralNetwork::CompiledNN detector;
-  std::unique_ptr<NeuralNetwork::Model> classifier_model;
-  std::unique_ptr<NeuralNetwork::Model> detector_model;
+  std::shared_ptr<const NeuralNetwork::Model> classifier_model;
+  std::shared_ptr<const NeuralNetwork::Model> detector_model;
 
   /** Struct that represents a goal post candidate as a rectangle inside the image. */
   struct GoalPostRegion
@@ -104,6 +113,26 @@ private:
     GoalPostRegion(const float x1, const float y1, const float x2, const float y2) : upperLeft(x1, y1), lowerRight(x2, y2) {}
   };
 
+  /** A goal post candidate that can be classified. */
+  struct Candidate
+  {
+    Vector2f positionInImage; /**< The center of the patch in the image. */
+    Vector2f positionOnField; /**< The center of the patch projected to the field (in field coordinates). */
+    float distance; /**< The distance of the center from the robot (in mm). */
+    int inputSize; /**< The edge length of the patch in the image (in pixels). */
+  };
+
+  /** The classification of a candidate. */
+  struct Classification
+  {
+    Vector2f positionOnField; /**< The position of the candidate on the field (in field coordinates). */
+    bool isGoalPost; /**< Was the candidate classified as a goal post? */
+    bool computed; /**< Was the classification computed by the network rather than reused? Only these are reused in the next frame. */
+  };
+
+  std::vector<Classification> classifications; /**< The classifications of the previous frame. */
+  unsigned classificationTime = 0; /**< The time of the frame the classifications stem from. */
+
   /**
    * Struct that holds a scan line region and it's x-position
    * in the image as that information is not part of ScanLineRegion.
@@ -30,6 +30,8 @@ void CoordinateSystemProvider::update(ImageCoordinateSystem& imageCoordinateSyst
 
   calcScaleFactors(imageCoordinateSystem.a, imageCoordinateSystem.b, theJointSensorData.timestamp - prevTimestamp);
   prevTimestamp = theJointSensorData.timestamp;
+
+  imageCoordinateSystem.updateRowCorrections();
 }
 
 void CoordinateSystemProvider::calcOffset(const Pose3f& prevPose, const Pose3f& currentPose, Vector2f& prevOffset, Vector2f& offset)
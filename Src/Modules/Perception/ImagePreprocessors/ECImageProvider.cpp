@@ -5,8 +5,8 @@
  */
 
 #include "ECImageProvider.h"
-#include "Streaming/Global.h"
 #include <asmjit/asmjit.h>
+#include <mutex>
 
 MAKE_MODULE(ECImageProvider);
 
@@ -43,13 +43,40 @@ void ECImageProvider::update(ECImage& ecImage)
 
 using namespace asmjit;
 
+/**
+ * The kernels are shared by all instances of this module in all threads.
+ * The generated code neither depends on the image size nor on the parameters,
+ * so each kernel is only compiled once per process.
+ */
+struct ECImageProvider::Kernels
+{
+  JitRuntime runtime; /**< The runtime owning the code of the kernels. */
+  std::mutex mutex; /**< Protects compiling the kernels. */
+  EFunc eFunc = nullptr; /**< The kernel that only extracts the grayscale image. */
+  EcFunc ecFunc = nullptr; /**< The kernel that extracts the grayscale, saturation, and hue images. */
+};
+
+ECImageProvider::Kernels& ECImageProvider::getKernels()
+{
+  static Kernels kernels;
+  return kernels;
+}
+
 void ECImageProvider::compileE()
 {
   ASSERT(!eFunc);
 
+  Kernels& kernels = getKernels();
+  std::lock_guard<std::mutex> lock(kernels.mutex);
+  if(kernels.eFunc)
+  {
+    eFunc = kernels.eFunc;
+    return;
+  }
+
   // Initialize assembler
   CodeHolder code;
-  code.init(Global::getAsmjitRuntime().environment());
+  code.init(kernels.runtime.environment());
   x86::Assembler a(&code);
 
   // Emit prolog
@@ -96,21 +123,30 @@ void ECImageProvider::compileE()
   a.embedUInt16(0x00FF, 8);
 
   // Bind function
-  const Error err = Global::getAsmjitRuntime().add<EFunc>(&eFunc, &code);
+  const Error err = kernels.runtime.add<EFunc>(&kernels.eFunc, &code);
   if(err)
   {
     OUTPUT_ERROR(err);
-    eFunc = nullptr;
+    kernels.eFunc = nullptr;
   }
+  eFunc = kernels.eFunc;
 }
 
 void ECImageProvider::compileEC()
 {
   ASSERT(!ecFunc);
 
+  Kernels& kernels = getKernels();
+  std::lock_guard<std::mutex> lock(kernels.mutex);
+  if(kernels.ecFunc)
+  {
+    ecFunc = kernels.ecFunc;
+    return;
+  }
+
   // Initialize assembler
   CodeHolder code;
-  code.init(Global::getAsmjitRuntime().environment());
+  code.init(kernels.runtime.environment());
   x86::Assembler a(&code);
 
   // Define argument registers
@@ -306,21 +342,13 @@ void ECImageProvider::compileEC()
   a.embedUInt16(11039, 8);      // 8: c16_11039
 
   // Bind function
-  const Error err = Global::getAsmjitRuntime().add<EcFunc>(&ecFunc, &code);
+  const Error err = kernels.runtime.add<EcFunc>(&kernels.ecFunc, &code);
   if(err)
   {
     OUTPUT_ERROR(err);
-    ecFunc = nullptr;
-    return;
+    kernels.ecFunc = nullptr;
   }
-}
-
-ECImageProvider::~ECImageProvider()
-{
-  if(eFunc)
-    Global::getAsmjitRuntime().release(eFunc);
-  if(ecFunc)
-    Global::getAsmjitRuntime().release(ecFunc);
+  ecFunc = kernels.ecFunc;
 }
 
 #else
@@ -407,8 +435,6 @@ void ECImageProvider::update(ECImage& ecImage)
   }
 }
 
-ECImageProvider::~ECImageProvider() {}
-
 #endif
 
 void ECImageProvider::extractChromaticity(ECImage& eCImage)
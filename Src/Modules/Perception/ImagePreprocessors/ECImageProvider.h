@@ -36,8 +36,16 @@ private:
   using EcFunc = void (*)(unsigned int, const void*, void*, void*, void*);
   using EFunc = void (*)(unsigned int, const void*, void*);
 
-  EcFunc ecFunc = nullptr;
-  EFunc eFunc = nullptr;
+  struct Kernels;
+
+  EcFunc ecFunc = nullptr; /**< The kernel used by this instance. Owned by the process-wide kernel cache. */
+  EFunc eFunc = nullptr; /**< The kernel used by this instance. Owned by the process-wide kernel cache. */
+
+  /**
+   * Returns the process-wide cache of kernels.
+   * @return The kernels shared by all instances of this module.
+   */
+  static Kernels& getKernels();
 
   void update(ECImage& ecImage) override;
   void update(OptionalECImage& theOptionalECImage) override;
@@ -51,7 +59,4 @@ private:
    * @param eCImage
    */
   void extractChromaticity(ECImage& eCImage);
-
-public:
-  ~ECImageProvider();
 };
@@ -14,17 +14,20 @@
 #include "Platform/BHAssert.h"
 #include "Platform/File.h"
 #include "Debugging/DebugDrawings.h"
+#include "Debugging/Plot.h"
+#include "Framework/FrameArena.h"
 #include "Streaming/Global.h"
 #include "ImageProcessing/PatchUtilities.h"
 #include "Tools/Math/Transformation.h"
+#include "Tools/NeuralNetworks/ModelRegistry.h"
+#include <limits>
 
 MAKE_MODULE(FieldBoundaryProvider);
 
 FieldBoundaryProvider::FieldBoundaryProvider() :
   network(&Global::getAsmjitRuntime())
 {
-  model = std::make_unique<NeuralNetwork::Model>(std::string(File::getBHDir()) + ((theCameraInfo.camera == CameraInfo::upper) ? "/Config/NeuralNets/FieldBoundary/net.h5" : "/Config/NeuralNets/FieldBoundary/net-uncertainty.h5"));
-  model->setInputUInt8(0);
+  model = ModelRegistry::get(std::string(File::getBHDir()) + ((theCameraInfo.camera == CameraInfo::upper) ? "/Config/NeuralNets/FieldBoundary/net.h5" : "/Config/NeuralNets/FieldBoundary/net-uncertainty.h5"), {0});
 
   network.compile(*model);
 
@@ -47,6 +50,7 @@ void FieldBoundaryProvider::update(FieldBoundary& fieldBoundary)
 {
   DECLARE_DEBUG_DRAWING("module:FieldBoundaryProvider:prediction", "drawingOnImage");
   DECLARE_DEBUG_RESPONSE("module:FieldBoundaryProvider:debugPrints");
+  DECLARE_PLOT("module:FieldBoundaryProvider:networkApplied");
 
   fieldBoundary.boundaryInImage.clear();
   fieldBoundary.boundaryOnField.clear();
@@ -55,13 +59,13 @@ void FieldBoundaryProvider::update(FieldBoundary& fieldBoundary)
     if(!fieldBoundary.isValid)
     {
       std::vector<Spot> spots;
-      predictSpots(spots);
+      getSpots(spots);
       validatePrediction(fieldBoundary, spots);
     }
     else if(theCameraInfo.camera == CameraInfo::upper)
     {
       std::vector<Spot> spots;
-      predictSpots(spots);
+      getSpots(spots);
       bool odd = boundaryIsOdd(spots);
       (odd && ! theOtherFieldBoundary.extrapolated) ? projectPrevious(fieldBoundary) : validatePrediction(fieldBoundary, spots);
       fieldBoundary.odd = odd;
@@ -71,7 +75,7 @@ void FieldBoundaryProvider::update(FieldBoundary& fieldBoundary)
       if(theOtherFieldBoundary.odd || theOtherFieldBoundary.extrapolated || theOtherFieldBoundary.boundaryInImage.empty())
       {
         std::vector<Spot> spots;
-        predictSpots(spots);
+        getSpots(spots);
 
         theOtherFieldBoundary.boundaryInImage.size() > 1 && boundaryIsOdd(spots) ? projectPrevious(fieldBoundary) : validatePrediction(fieldBoundary, spots);
       }
@@ -142,6 +146,83 @@ void FieldBoundaryProvider::projectPrevious(FieldBoundary& fieldBoundary)
   fieldBoundary.extrapolated = true;
 }
 
+void FieldBoundaryProvider::getSpots(std::vector<Spot>& spots)
+{
+  if(maxNetworkPeriod > 1 && predictionReliable && framesSinceNetwork + 1 < maxNetworkPeriod
+     && (cameraMatrixAtNetwork.rotation.inverse() * theCameraMatrix.rotation).getAngleAxis().angle() <= maxPredictionRotation)
+  {
+    predictNetworkSpots(spots);
+    if(spots.size() >= minNumberOfSpots)
+    {
+      ++framesSinceNetwork;
+      PLOT("module:FieldBoundaryProvider:networkApplied", 0);
+      return;
+    }
+    spots.clear();
+  }
+
+  predictSpots(spots);
+  PLOT("module:FieldBoundaryProvider:networkApplied", 1);
+
+  if(maxNetworkPeriod > 1)
+  {
+    // Check how well the spots would have been predicted to decide whether predicting is allowed next time.
+    std::vector<Spot> predicted;
+    if(!networkSpots.empty())
+      predictNetworkSpots(predicted);
+    predictionReliable = predictionResidual(predicted, spots) <= maxPredictionResidual;
+    networkSpots = spots;
+    odometryAtNetwork = theOdometryData;
+    cameraMatrixAtNetwork = theCameraMatrix;
+    framesSinceNetwork = 0;
+  }
+}
+
+void FieldBoundaryProvider::predictNetworkSpots(std::vector<Spot>& spots) const
+{
+  const Pose2f odometryOffset = theOdometryData.inverse() * odometryAtNetwork;
+  for(const Spot& spot : networkSpots)
+  {
+    const Vector2f spotOnField = odometryOffset * spot.onField;
+    Vector2f spotInImage;
+    if(Transformation::robotToImage(spotOnField, theCameraMatrix, theCameraInfo, spotInImage))
+    {
+      spotInImage = theImageCoordinateSystem.fromCorrected(spotInImage);
+      if(spotInImage.x() >= 0.f && spotInImage.x() < static_cast<float>(theCameraInfo.width))
+      {
+        spotInImage.y() = std::max(0.f, std::min(spotInImage.y(), static_cast<float>(theCameraInfo.height - 1)));
+        DOT("module:FieldBoundaryProvider:prediction", spotInImage.x(), spotInImage.y(), ColorRGBA::yellow, ColorRGBA::yellow);
+        spots.emplace_back(spotInImage.cast<int>(), spotOnField, spot.uncertainty);
+      }
+    }
+  }
+}
+
+float FieldBoundaryProvider::predictionResidual(const std::vector<Spot>& predicted, const std::vector<Spot>& measured)
+{
+  float sum = 0.f;
+  int count = 0;
+  if(predicted.size() > 1)
+  {
+    auto next = predicted.begin() + 1;
+    for(const Spot& spot : measured)
+    {
+      const int x = spot.inImage.x();
+      if(x < predicted.front().inImage.x() || x > predicted.back().inImage.x())
+        continue;
+      while(next != predicted.end() - 1 && next->inImage.x() < x)
+        ++next;
+      const Spot& prev = *(next - 1);
+      const int dx = next->inImage.x() - prev.inImage.x();
+      const float y = dx > 0 ? static_cast<float>(prev.inImage.y()) + static_cast<float>((x - prev.inImage.x()) * (next->inImage.y() - prev.inImage.y())) / static_cast<float>(dx)
+                             : static_cast<float>(prev.inImage.y());
+      sum += std::abs(y - static_cast<float>(spot.inImage.y()));
+      ++count;
+    }
+  }
+  return count ? sum / static_cast<float>(count) : std::numeric_limits<float>::infinity();
+}
+
 void FieldBoundaryProvider::predictSpots(std::vector<Spot>& spots)
 {
   unsigned char* input = reinterpret_cast<std::uint8_t*>(network.input(0).data());
@@ -156,23 +237,33 @@ void FieldBoundaryProvider::predictSpots(std::vector<Spot>& spots)
 
   const unsigned int xScale = theCameraInfo.width / patchSize(0);
   const unsigned int stepSize = network.output(0).rank() == 2 ? 2 : 1;
-  for(int x = 0, idx = 0; x < patchSize(0); ++x, idx += static_cast<int>(stepSize))
+  const std::size_t numOfSpots = static_cast<std::size_t>(patchSize(0));
+  FrameVector<float> x(numOfSpots);
+  FrameVector<float> y(numOfSpots);
+  FrameVector<float> uncertainties(numOfSpots, 0.f);
+  for(int i = 0, idx = 0; i < patchSize(0); ++i, idx += static_cast<int>(stepSize))
   {
-    const Vector2f spotInImage(x * xScale + xScale / 2, std::max(0.f, std::min(output[idx], 1.f)) * static_cast<float>(theCameraInfo.height - 1));
-    DOT("module:FieldBoundaryProvider:prediction", spotInImage.x(), spotInImage.y(), ColorRGBA::orange, ColorRGBA::orange);
-    float uncertainty = 0;
+    x[i] = static_cast<float>(i * xScale + xScale / 2);
+    y[i] = std::max(0.f, std::min(output[idx], 1.f)) * static_cast<float>(theCameraInfo.height - 1);
+    DOT("module:FieldBoundaryProvider:prediction", x[i], y[i], ColorRGBA::orange, ColorRGBA::orange);
 
     if(network.output(0).rank() == 2)
     {
-      uncertainty = 1.f / (output[idx + 1] * output[idx + 1]) * static_cast<float>(theCameraInfo.height - 1);
-      DOT("module:FieldBoundaryProvider:prediction", spotInImage.x(), spotInImage.y() + uncertainty, ColorRGBA::blue, ColorRGBA::blue);
-      DOT("module:FieldBoundaryProvider:prediction", spotInImage.x(), spotInImage.y() - uncertainty, ColorRGBA::blue, ColorRGBA::blue);
+      uncertainties[i] = 1.f / (output[idx + 1] * output[idx + 1]) * static_cast<float>(theCameraInfo.height - 1);
+      DOT("module:FieldBoundaryProvider:prediction", x[i], y[i] + uncertainties[i], ColorRGBA::blue, ColorRGBA::blue);
+      DOT("module:FieldBoundaryProvider:prediction", x[i], y[i] - uncertainties[i], ColorRGBA::blue, ColorRGBA::blue);
     }
-
-    Vector2f spotOnField;
-    if(Transformation::imageToRobot(theImageCoordinateSystem.toCorrected(spotInImage), theCameraMatrix, theCameraInfo, spotOnField) && spotOnField.squaredNorm() >= sqr(minDistance))
-      spots.emplace_back(spotInImage.cast<int>(), spotOnField, uncertainty);
   }
+
+  // All spots are projected onto the field at once.
+  FrameVector<float> robotX(numOfSpots);
+  FrameVector<float> robotY(numOfSpots);
+  std::unique_ptr<bool[]> valid = std::make_unique<bool[]>(numOfSpots);
+  Transformation::ImageToRobotProjection(theCameraMatrix, theCameraInfo, theImageCoordinateSystem)
+    .imageToRobot(numOfSpots, x.data(), y.data(), robotX.data(), robotY.data(), valid.get());
+  for(std::size_t i = 0; i < numOfSpots; ++i)
+    if(valid[i] && sqr(robotX[i]) + sqr(robotY[i]) >= sqr(minDistance))
+      spots.emplace_back(Vector2i(static_cast<int>(x[i]), static_cast<int>(y[i])), Vector2f(robotX[i], robotY[i]), uncertainties[i]);
 }
 
 bool FieldBoundaryProvider::boundaryIsOdd(const std::vector<Spot>& spots) const
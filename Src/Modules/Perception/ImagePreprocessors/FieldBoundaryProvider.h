@@ -53,6 +53,9 @@ MODULE(FieldBoundaryProvider,
     (int)(4) top, /**< to which pixel points are considered as at the top*/
     (float)(6) uncertaintyLimit, /**< maximum average uncertainty of the non top spots to be not considered as odd */
     (int)(2) maxPointsUnderBorder, /**< how much the points are allowed to be below the lower end on average*/
+    (unsigned)(1) maxNetworkPeriod, /**< The network is applied at least every that many frames. In between, its spots may be predicted (1: every frame). */
+    (Angle)(2_deg) maxPredictionRotation, /**< The network is applied if the camera rotated more than this since it was applied the last time. */
+    (float)(8.f) maxPredictionResidual, /**< Spots are only predicted if the last prediction deviated less than this from the network on average (in pixels). */
   }),
 });
 
@@ -115,8 +118,31 @@ private:
    */
   void projectPrevious(FieldBoundary& fieldBoundary);
 
+  /**
+   * Determines the boundary spots, either by applying the network or by predicting
+   * the spots it found recently. The latter is only done if the camera barely
+   * rotated and the previous prediction matched the network well enough.
+   * @param spots The spots that are filled.
+   */
+  void getSpots(std::vector<Spot>& spots);
+
   void predictSpots(std::vector<Spot>& spots);
 
+  /**
+   * Predict where the spots found by the network the last time are in the current image.
+   * @param spots The spots that are filled.
+   */
+  void predictNetworkSpots(std::vector<Spot>& spots) const;
+
+  /**
+   * Determines the average vertical deviation between predicted spots and spots found by
+   * the network. The predicted boundary is interpolated at the x coordinates of the latter.
+   * @param predicted The predicted spots.
+   * @param measured The spots found by the network.
+   * @return The average deviation in pixels or infinity if no spots could be compared.
+   */
+  static float predictionResidual(const std::vector<Spot>& predicted, const std::vector<Spot>& measured);
+
   /**
    * Checks if the calculated boundary spots is odd/not good.
    * @param spots The spots that are validated.
@@ -146,7 +172,13 @@ private:
 
   void fitBoundaryNotRansac(const std::vector<Spot>& spots, FieldBoundary& fieldBoundary);
 
-  std::unique_ptr<NeuralNetwork::Model> model; /**< The model of the neural network. */
+  std::shared_ptr<const NeuralNetwork::Model> model; /**< The model of the neural network. */
   NeuralNetwork::CompiledNN network; /**< The compiled neural network. */
   Vector2i patchSize;  /**< The width and height of the neural network input image. */
+
+  std::vector<Spot> networkSpots; /**< The spots found by the network the last time it was applied. */
+  Pose2f odometryAtNetwork; /**< The odometry when the network was applied the last time. */
+  CameraMatrix cameraMatrixAtNetwork; /**< The camera matrix when the network was applied the last time. */
+  unsigned framesSinceNetwork = 0; /**< The number of frames the spots were predicted since the network was applied. */
+  bool predictionReliable = false; /**< Did the last prediction match the network well enough? */
 };
@@ -0,0 +1,44 @@
+/**
+ * @file ImagePyramidProvider.cpp
+ *
+ * This file implements a module that computes downscaled versions of the
+ * grayscale and chromaticity images once per frame.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "ImagePyramidProvider.h"
+#include "Debugging/Stopwatch.h"
+#include "ImageProcessing/Resize.h"
+
+MAKE_MODULE(ImagePyramidProvider);
+
+void ImagePyramidProvider::update(ImagePyramid& theImagePyramid)
+{
+  STOPWATCH("module:ImagePyramidProvider:grayscaled")
+    computeLevels(theECImage.grayscaled, grayscaledLevels[theCameraInfo.camera], theImagePyramid.grayscaled);
+
+  // The chromaticity images are only available if the ECImageProvider extracts them.
+  const unsigned numOfChromaticityLevels = theECImage.blueChromaticity.width == theECImage.grayscaled.width
+                                           && theECImage.redChromaticity.width == theECImage.grayscaled.width
+                                           ? chromaticityLevels[theCameraInfo.camera] : 0;
+  STOPWATCH("module:ImagePyramidProvider:chromaticity")
+  {
+    computeLevels(theECImage.blueChromaticity, numOfChromaticityLevels, theImagePyramid.blueChromaticity);
+    computeLevels(theECImage.redChromaticity, numOfChromaticityLevels, theImagePyramid.redChromaticity);
+  }
+}
+
+void ImagePyramidProvider::computeLevels(const Image<PixelTypes::GrayscaledPixel>& image, unsigned numOfLevels,
+                                         std::vector<Image<PixelTypes::GrayscaledPixel>>& levels)
+{
+  levels.resize(numOfLevels);
+  const Image<PixelTypes::GrayscaledPixel>* previous = &image;
+  for(Image<PixelTypes::GrayscaledPixel>& level : levels)
+  {
+    // Resize::shrinkY processes blocks of 64 pixels.
+    ASSERT(previous->width * previous->height % 64 == 0);
+    Resize::shrinkY(1, *previous, level);
+    previous = &level;
+  }
+}
@@ -0,0 +1,48 @@
+/**
+ * @file ImagePyramidProvider.h
+ *
+ * This file declares a module that computes downscaled versions of the
+ * grayscale and chromaticity images once per frame, so that the modules that
+ * need them do not have to shrink the images themselves.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Framework/Module.h"
+#include "Representations/Infrastructure/CameraInfo.h"
+#include "Representations/Perception/ImagePreprocessing/ECImage.h"
+#include "Representations/Perception/ImagePreprocessing/ImagePyramid.h"
+#include "Streaming/EnumIndexedArray.h"
+
+MODULE(ImagePyramidProvider,
+{,
+  REQUIRES(CameraInfo),
+  REQUIRES(ECImage),
+  PROVIDES(ImagePyramid),
+  LOADS_PARAMETERS(
+  {,
+    (ENUM_INDEXED_ARRAY(unsigned, CameraInfo::Camera)) grayscaledLevels, /**< The number of levels computed from the grayscale image. */
+    (ENUM_INDEXED_ARRAY(unsigned, CameraInfo::Camera)) chromaticityLevels, /**< The number of levels computed from the chromaticity images. */
+  }),
+});
+
+class ImagePyramidProvider : public ImagePyramidProviderBase
+{
+  /**
+   * This method is called when the representation provided needs to be updated.
+   * @param theImagePyramid The representation updated.
+   */
+  void update(ImagePyramid& theImagePyramid) override;
+
+  /**
+   * Computes the levels of a pyramid. Each level is computed from the
+   * previous one, so the full resolution image is only read once.
+   * @param image The full resolution image.
+   * @param numOfLevels The number of levels to compute.
+   * @param levels The levels computed.
+   */
+  static void computeLevels(const Image<PixelTypes::GrayscaledPixel>& image, unsigned numOfLevels,
+                            std::vector<Image<PixelTypes::GrayscaledPixel>>& levels);
+};
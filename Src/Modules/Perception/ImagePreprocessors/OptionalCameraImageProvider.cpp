@@ -14,8 +14,32 @@ MAKE_MODULE(OptionalCameraImageProvider);
 
 void OptionalCameraImageProvider::update(OptionalCameraImage& theOptionalCameraImage)
 {
-  if(theOptionalImageRequest.sendImage)
-    theOptionalCameraImage.image = theCameraImage;
-  else
-    theOptionalCameraImage.image.reset();
+  theOptionalCameraImage.image.reset();
+  theOptionalCameraImage.deadline = 0;
+  if(!theOptionalImageRequest.sendImage)
+  {
+    imagesSkipped = imagePeriod; // Send the first image when requested again.
+    return;
+  }
+  else if(++imagesSkipped < imagePeriod)
+    return;
+  imagesSkipped = 0;
+
+  // Find a buffer that is not referenced by any other thread anymore. Only this thread
+  // creates new references, so a buffer that is only referenced here stays unused.
+  std::shared_ptr<CameraImage>* buffer = nullptr;
+  for(std::shared_ptr<CameraImage>& b : buffers)
+    if(b.use_count() == 1)
+    {
+      buffer = &b;
+      break;
+    }
+  if(!buffer)
+    buffer = &buffers.emplace_back(std::make_shared<CameraImage>());
+
+  // This is the only copy of the image. The other threads share it.
+  **buffer = theCameraImage;
+  theOptionalCameraImage.image = *buffer;
+  if(maxProcessingDelay)
+    theOptionalCameraImage.deadline = theCameraImage.timestamp + maxProcessingDelay;
 }
@@ -13,16 +13,26 @@
 #include "Framework/Module.h"
 #include "Representations/Perception/ImagePreprocessing/OptionalCameraImage.h"
 #include "Representations/Perception/RefereePercept/OptionalImageRequest.h"
+#include <memory>
+#include <vector>
 
 MODULE(OptionalCameraImageProvider,
 {,
   REQUIRES(CameraImage),
   REQUIRES(OptionalImageRequest),
   PROVIDES(OptionalCameraImage),
+  DEFINES_PARAMETERS(
+  {,
+    (unsigned)(2) imagePeriod, /**< Only every that many images are sent (1: every image). */
+    (unsigned)(100) maxProcessingDelay, /**< The referee thread skips an image if it did not start processing it within this time after it was taken (in ms, 0: never). */
+  }),
 });
 
 class OptionalCameraImageProvider : public OptionalCameraImageProviderBase
 {
+  std::vector<std::shared_ptr<CameraImage>> buffers; /**< The copies of the camera image that were provided. A buffer is reused when no other thread references it anymore. */
+  unsigned imagesSkipped = 0; /**< The number of images not sent since the last one that was sent. */
+
   /**
    * This method is called when the representation provided needs to be updated.
    * @param theOptionalCameraImage The representation updated.
@@ -0,0 +1,52 @@
+/**
+ * @file PerceptionAttentionProvider.cpp
+ *
+ * This file implements a module that determines where the ball is expected in
+ * the current image and which expensive perception modules should run in the
+ * current frame.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "PerceptionAttentionProvider.h"
+#include "Math/BHMath.h"
+#include "Math/Geometry.h"
+#include "Tools/Math/Projection.h"
+#include <algorithm>
+
+MAKE_MODULE(PerceptionAttentionProvider);
+
+void PerceptionAttentionProvider::update(PerceptionAttention& thePerceptionAttention)
+{
+  thePerceptionAttention.ballPredicted = false;
+  thePerceptionAttention.ballNear = false;
+
+  if(theFrameInfo.getTimeSince(theWorldModelPrediction.timeWhenBallLastSeen) <= ballValidDelay)
+  {
+    thePerceptionAttention.ballNear = theWorldModelPrediction.ballPosition.squaredNorm() < sqr(nearBallDistance);
+
+    Geometry::Circle ball;
+    if(Projection::calculateBallInImage(theWorldModelPrediction.ballPosition, theCameraMatrix, theCameraInfo, theBallSpecification.radius, ball)
+       && ball.center.x() + ball.radius >= 0.f && ball.center.x() - ball.radius < static_cast<float>(theCameraInfo.width)
+       && ball.center.y() + ball.radius >= 0.f && ball.center.y() - ball.radius < static_cast<float>(theCameraInfo.height))
+    {
+      thePerceptionAttention.ballPredicted = true;
+      thePerceptionAttention.ballInImage = ball.center;
+      thePerceptionAttention.ballRadiusInImage = ball.radius;
+    }
+  }
+
+  // Skip robot detection in all but every n-th frame while the ball is near or computing time is short.
+  const unsigned robotDetectionPeriod = std::max(thePerceptionAttention.ballNear ? robotDetectionPeriodWhenBallNear[theCameraInfo.camera] : 1u,
+                                                 robotDetectionPeriods[thePerceptionQuality.level]);
+  if(framesWithoutRobotDetection + 1 < robotDetectionPeriod)
+  {
+    ++framesWithoutRobotDetection;
+    thePerceptionAttention.detectRobots = false;
+  }
+  else
+  {
+    framesWithoutRobotDetection = 0;
+    thePerceptionAttention.detectRobots = true;
+  }
+}
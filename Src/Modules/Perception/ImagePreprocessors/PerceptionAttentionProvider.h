@@ -0,0 +1,51 @@
+/**
+ * @file PerceptionAttentionProvider.h
+ *
+ * This file declares a module that determines where the ball is expected in
+ * the current image and which expensive perception modules should run in the
+ * current frame. The robot detection network is only run every few frames if
+ * the ball is close, leaving more time to the modules that detect it. It is
+ * also run less often if the perception quality is reduced.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Framework/Module.h"
+#include "Representations/Configuration/BallSpecification.h"
+#include "Representations/Infrastructure/CameraInfo.h"
+#include "Representations/Infrastructure/FrameInfo.h"
+#include "Representations/Infrastructure/PerceptionQuality.h"
+#include "Representations/Modeling/WorldModelPrediction.h"
+#include "Representations/Perception/ImagePreprocessing/CameraMatrix.h"
+#include "Representations/Perception/ImagePreprocessing/PerceptionAttention.h"
+
+MODULE(PerceptionAttentionProvider,
+{,
+  REQUIRES(BallSpecification),
+  REQUIRES(CameraInfo),
+  REQUIRES(CameraMatrix),
+  REQUIRES(FrameInfo),
+  REQUIRES(PerceptionQuality),
+  REQUIRES(WorldModelPrediction),
+  PROVIDES(PerceptionAttention),
+  LOADS_PARAMETERS(
+  {,
+    (int) ballValidDelay, /**< How long is the predicted ball position trusted after the ball was seen (in ms)? */
+    (float) nearBallDistance, /**< Up to which distance is the ball considered to be near (in mm)? */
+    (ENUM_INDEXED_ARRAY(unsigned, CameraInfo::Camera)) robotDetectionPeriodWhenBallNear, /**< Robots are detected every that many frames if the ball is near. */
+    (ENUM_INDEXED_ARRAY(unsigned, PerceptionQuality::Level)) robotDetectionPeriods, /**< Robots are detected at least every that many frames for each perception quality. */
+  }),
+});
+
+class PerceptionAttentionProvider : public PerceptionAttentionProviderBase
+{
+  unsigned framesWithoutRobotDetection = 0; /**< The number of frames in a row in which robot detection was skipped. */
+
+  /**
+   * This method is called when the representation provided needs to be updated.
+   * @param thePerceptionAttention The representation updated.
+   */
+  void update(PerceptionAttention& thePerceptionAttention) override;
+};
@@ -15,6 +15,7 @@
 #include "ImageProcessing/Image.h"
 #include "Tools/Math/InImageSizeCalculations.h"
 #include "Tools/Math/Transformation.h"
+#include "Tools/NeuralNetworks/ModelRegistry.h"
 #include <algorithm>
 #include <cstring>
 #include <type_traits>
@@ -24,8 +25,7 @@ MAKE_MODULE(BOPPerceptor);
 BOPPerceptor::BOPPerceptor() :
   network(&Global::getAsmjitRuntime())
 {
-  model = std::make_unique<NeuralNetwork::Model>(std::string(File::getBHDir()) + "/Config/NeuralNets/BOP/net.h5");
-  model->setInputUInt8(0);
+  model = ModelRegistry::get(std::string(File::getBHDir()) + "/Config/NeuralNets/BOP/net.h5", {0});
   NeuralNetwork::CompilationSettings settings;
 #if defined MACOS && defined __arm64__
   settings.useCoreML = true;
@@ -47,7 +47,7 @@ BOPPerceptor::BOPPerceptor() :
 
   ASSERT(inputSize.x() % outputSize.x() == 0);
   ASSERT(inputSize.y() % outputSize.y() == 0);
-  scale = Vector2i(inputSize.x() / outputSize.x(), inputSize.y() / outputSize.y());
+  ASSERT(inputSize.x() % 2 == 0);
 }
 
 bool BOPPerceptor::apply()
@@ -59,13 +59,30 @@ bool BOPPerceptor::apply()
   if(lastPrediction == theCameraImage.timestamp)
     return true;
 
-  if(theCameraInfo.width != inputSize.x() || theCameraInfo.height != inputSize.y())
+  const bool halfResolution = theCameraInfo.width == inputSize.x() * 2 && theCameraInfo.height == inputSize.y() * 2;
+  if(!halfResolution && (theCameraInfo.width != inputSize.x() || theCameraInfo.height != inputSize.y()))
     return false;
+  scale = Vector2i(theCameraInfo.width / outputSize.x(), theCameraInfo.height / outputSize.y());
 
   static_assert(std::is_same<CameraImage::PixelType, PixelTypes::YUYVPixel>::value);
+#if defined MACOS && defined __arm64__
+  // The ONNX wrapper reads the camera image directly.
+  if(halfResolution)
+  {
+    downscaledImage.setResolution(inputSize.x() / 2, inputSize.y());
+    downscale(downscaledImage[0]);
+    network.setInput(0, downscaledImage[0]);
+  }
+  else
+    network.setInput(0, theCameraImage[0]);
+#else
   // TODO: CompiledNN should be able to take an external buffer as input (but this is more complicated than one could think).
   // In the meantime, one could directly convert to float in this copy operation using SSE.
-  std::memcpy(reinterpret_cast<std::uint8_t*>(network.input(0).data()), theCameraImage[0], inputSize.x() * inputSize.y() * 2);
+  if(halfResolution)
+    downscale(reinterpret_cast<PixelTypes::YUYVPixel*>(network.input(0).data()));
+  else
+    std::memcpy(reinterpret_cast<std::uint8_t*>(network.input(0).data()), theCameraImage[0], inputSize.x() * inputSize.y() * 2);
+#endif
   STOPWATCH("module:BOPPerceptor:apply")
     network.apply();
 
@@ -104,6 +121,17 @@ bool BOPPerceptor::apply()
   return true;
 }
 
+void BOPPerceptor::downscale(PixelTypes::YUYVPixel* dest) const
+{
+  // Every second row is skipped. Each pair of YUYV pixels is combined to a single one.
+  for(int y = 0; y < inputSize.y(); ++y)
+  {
+    const PixelTypes::YUYVPixel* src = theCameraImage[y * 2];
+    for(const PixelTypes::YUYVPixel* const end = src + inputSize.x(); src < end; src += 2)
+      *dest++ = PixelTypes::YUYVPixel(src[0].y0, src[0].u, src[1].y0, src[1].v);
+  }
+}
+
 void BOPPerceptor::update(BallSpots& ballSpots)
 {
   ballSpots.ballSpots.clear();
@@ -2,7 +2,10 @@
  * @file BOPPerceptor.h
  *
  * This file declares a module that runs a neural network on a full image
- * to detect balls, obstacles and penalty marks.
+ * to detect balls, obstacles and penalty marks. The network is only run once
+ * per image, no matter which of its outputs are used. Which of them are
+ * used is selected by choosing this module as their provider. Images that
+ * have twice the resolution of the network input are downscaled.
  *
  * @author Arne Hasselbring
  */
@@ -18,6 +21,7 @@
 #include "Representations/Perception/ImagePreprocessing/ImageRegions.h"
 #include "Representations/Perception/ImagePreprocessing/SegmentedObstacleImage.h"
 #include "Representations/Perception/ObstaclesPercepts/ObstacleScan.h"
+#include "ImageProcessing/Image.h"
 #include "Math/Boundary.h"
 #include "Math/Eigen.h"
 #include "Framework/Module.h"
@@ -57,6 +61,12 @@ private:
    */
   bool apply();
 
+  /**
+   * Downscales the camera image to half its resolution.
+   * @param dest The downscaled image. Its size is the input size of the network.
+   */
+  void downscale(PixelTypes::YUYVPixel* dest) const;
+
   void update(BallSpots& ballSpots) override;
 
   void update(PenaltyMarkRegions& penaltyMarkRegions) override;
@@ -70,11 +80,12 @@ private:
   static constexpr std::size_t obstaclesIndex = 2; /**< Index of the obstacles channel. */
   static constexpr std::size_t numOfChannels = 4; /**< Number of channels per neural network output pixel. */
 
-  std::unique_ptr<NeuralNetwork::Model> model; /**< The model of the neural network. */
+  std::shared_ptr<const NeuralNetwork::Model> model; /**< The model of the neural network. */
   NeuralNetwork::CompiledNN network; /**< The compiled neural network. */
   Vector2i inputSize; /**< Input size of the neural network. */
   Vector2i outputSize; /**< Output size of the neural network. */
-  Vector2i scale; /**< Scale of the neural network (input size / output size). */
+  Vector2i scale; /**< Scale of the neural network outputs in the camera image (image size / output size). */
+  Image<PixelTypes::YUYVPixel> downscaledImage; /**< The downscaled camera image if it is larger than the network input. */
 
   unsigned lastPrediction = 0; /**< Timestamp of the last image on which the network has been run. */
 };
@@ -14,16 +14,21 @@
 #include "Platform/File.h"
 #include "Platform/SystemCall.h"
 #include "Debugging/DebugDrawings.h"
+#include "Debugging/Plot.h"
 #include "Debugging/Stopwatch.h"
 #include "Streaming/Global.h"
 #include "Tools/Math/Projection.h"
 #include "Tools/Math/Transformation.h"
+#include "Tools/NeuralNetworks/ModelRegistry.h"
+#include <algorithm>
+#include <cstring>
 #include <filesystem>
 
 MAKE_MODULE(BallAndPenaltyMarkPerceptor);
 
 BallAndPenaltyMarkPerceptor::BallAndPenaltyMarkPerceptor() :
-  multihead(&Global::getAsmjitRuntime())
+  multihead(&Global::getAsmjitRuntime()),
+  variant(&Global::getAsmjitRuntime())
 {
   compile();
 }
@@ -107,6 +112,8 @@ void BallAndPenaltyMarkPerceptor::update(BallPercept& theBallPercept)
 void BallAndPenaltyMarkPerceptor::updateBallAndPenaltyMarkPerceptor()
 {
   DECLARE_DEBUG_DRAWING("module:BallAndPenaltyMarkPerceptor:spots", "drawingOnImage");
+  DECLARE_PLOT("module:BallAndPenaltyMarkPerceptor:variantMaxDifference");
+  DECLARE_PLOT("module:BallAndPenaltyMarkPerceptor:variantDecisionChanges");
 
   if(lastFrameTime == theFrameInfo.time)
     return;
@@ -114,10 +121,18 @@ void BallAndPenaltyMarkPerceptor::updateBallAndPenaltyMarkPerceptor()
 
   bestProbBall = 0.f;
   bestProbPenalty = 0.f;
+  patches.clear();
+  patchOutputs.clear();
 
   if(!multihead.valid())
     return;
 
+  compileVariant();
+  NeuralNetwork::CompiledNN& network = useVariant && variant.valid() ? variant : multihead;
+  NeuralNetwork::CompiledNN* other = compareVariant && variant.valid() ? (&network == &variant ? &multihead : &variant) : nullptr;
+  float maxDifference = 0.f;
+  int decisionChanges = 0;
+
   std::vector<Vector2i> ballSpots = theBallSpots.ballSpots;
   for(const Boundaryi& region : thePenaltyMarkRegions.regions)
   {
@@ -128,24 +143,55 @@ void BallAndPenaltyMarkPerceptor::updateBallAndPenaltyMarkPerceptor()
   if(ballSpots.empty())
     return;
 
+  // Extract the patches of all candidates into one contiguous buffer first.
+  // Candidates at the same position are only classified once. If computing
+  // time is short, only the first candidates are classified, i.e. ball spots
+  // are preferred over penalty mark regions.
+  const std::size_t patchBytes = patchSize * patchSize * (useFloat ? sizeof(float) : sizeof(unsigned char));
+  const std::size_t numOfPatches = std::min(ballSpots.size(), static_cast<std::size_t>(maxPatches[thePerceptionQuality.level]));
+  patchData.resize(numOfPatches * patchBytes);
+  STOPWATCH("module:BallAndPenaltyMarkPerceptor:getImageSection")
+    for(const Vector2i& ballSpot : ballSpots)
+    {
+      if(patches.size() == numOfPatches)
+        break;
+      float stepSize;
+      if(std::none_of(patches.begin(), patches.end(), [&](const Patch& patch) {return patch.spot == ballSpot;})
+         && extractPatch(ballSpot, patchData.data() + patches.size() * patchBytes, stepSize))
+        patches.push_back({ballSpot, stepSize});
+    }
+
   float probBall, probPenalty;
   Vector2f ballPosition, penaltyPosition;
 
   float radius;
   std::pair<float, float> prob;
 
-  // iterates over all ball spots in a frame and calculates the probability for ball, penalty or none
-  for(std::size_t i = 0; i < ballSpots.size(); ++i)
+  // iterates over all patches in a frame and calculates the probability for ball, penalty or none
+  for(std::size_t i = 0; i < patches.size(); ++i)
   {
-    prob = apply(ballSpots[i], ballPosition, penaltyPosition, radius);
+    std::memcpy(network.input(0).data(), patchData.data() + i * patchBytes, patchBytes);
+    prob = classify(network, patches[i], ballPosition, penaltyPosition, radius);
+    patchOutputs.insert(patchOutputs.end(), network.output(0).data(), network.output(0).data() + network.output(0).size());
     probBall = prob.first;
     probPenalty = prob.second;
 
+    if(other)
+    {
+      // Compare the class probabilities and the decisions based on them.
+      std::memcpy(other->input(0).data(), patchData.data() + i * patchBytes, patchBytes);
+      other->apply();
+      for(std::size_t j = 0; j < 3; ++j)
+        maxDifference = std::max(maxDifference, std::abs(network.output(0)[j] - other->output(0)[j]));
+      decisionChanges += (probBall >= acceptThreshold) != (other->output(0)[2] >= acceptThreshold) ? 1 : 0;
+      decisionChanges += (probPenalty >= penaltyThreshold) != (other->output(0)[1] >= penaltyThreshold) ? 1 : 0;
+    }
+
     COMPLEX_DRAWING("module:BallAndPenaltyMarkPerceptor:spots")
     {
       std::stringstream ss;
       ss << i << ": " << static_cast<int>(probBall * 100);
-      DRAW_TEXT("module:BallAndPenaltyMarkPerceptor:spots", ballSpots[i].x(), ballSpots[i].y(), 15, ColorRGBA::red, ss.str());
+      DRAW_TEXT("module:BallAndPenaltyMarkPerceptor:spots", patches[i].spot.x(), patches[i].spot.y(), 15, ColorRGBA::red, ss.str());
     }
 
     if(probBall > bestProbBall)
@@ -163,68 +209,100 @@ void BallAndPenaltyMarkPerceptor::updateBallAndPenaltyMarkPerceptor()
       bestPenaltyPosition = penaltyPosition;
     }
   }
+
+  if(other)
+  {
+    PLOT("module:BallAndPenaltyMarkPerceptor:variantMaxDifference", maxDifference);
+    PLOT("module:BallAndPenaltyMarkPerceptor:variantDecisionChanges", decisionChanges);
+  }
 }
 
-std::pair<float, float> BallAndPenaltyMarkPerceptor::apply(const Vector2i& ballSpot, Vector2f& ballPosition, Vector2f& penaltyPosition, float& predRadius)
+void BallAndPenaltyMarkPerceptor::update(BallPatches& theBallPatches)
+{
+  updateBallAndPenaltyMarkPerceptor();
+  theBallPatches.patchSize = Vector2i(patchSize, patchSize);
+  theBallPatches.patches.clear();
+  if(patches.empty())
+    return;
+
+  // Only the patches classified have outputs.
+  const std::size_t outputsPerPatch = multihead.output(0).size();
+  const std::size_t classified = std::min(patches.size(), patchOutputs.size() / outputsPerPatch);
+  theBallPatches.patches.resize(classified);
+  for(std::size_t i = 0; i < classified; ++i)
+  {
+    ImagePatches::Patch& patch = theBallPatches.patches[i];
+    const int area = static_cast<int>(patches[i].stepSize * static_cast<float>(patchSize) + 0.5f);
+    patch.position = patches[i].spot.cast<float>();
+    patch.area = Vector2i(area, area);
+    patch.pixels.resize(patchSize * patchSize);
+    PatchUtilities::extractPatch(patches[i].spot, patch.area, theBallPatches.patchSize, theECImage.grayscaled, patch.pixels.data(), extractionMode);
+    patch.outputs.assign(patchOutputs.begin() + i * outputsPerPatch, patchOutputs.begin() + (i + 1) * outputsPerPatch);
+  }
+}
+
+bool BallAndPenaltyMarkPerceptor::extractPatch(const Vector2i& ballSpot, unsigned char* data, float& stepSize)
 {
   Vector2f relativePoint;
   Geometry::Circle ball;
   if(!(Transformation::imageToRobotHorizontalPlane(ballSpot.cast<float>(), theBallSpecification.radius, theCameraMatrix, theCameraInfo, relativePoint)
        && Projection::calculateBallInImage(relativePoint, theCameraMatrix, theCameraInfo, theBallSpecification.radius, ball)))
-    return std::make_pair(-1.f, -1.f);
+    return false;
 
   int ballArea = static_cast<int>(ball.radius * ballAreaFactor);
   ballArea += 4 - (ballArea % 4);
 
   RECTANGLE("module:BallAndPenaltyMarkPerceptor:spots", static_cast<int>(ballSpot.x() - ballArea / 2), static_cast<int>(ballSpot.y() - ballArea / 2), static_cast<int>(ballSpot.x() + ballArea / 2), static_cast<int>(ballSpot.y() + ballArea / 2), 2, Drawings::PenStyle::solidPen, ColorRGBA::black);
-  std::vector<float> patchWithoutNormalization;
-  STOPWATCH("module:BallAndPenaltyMarkPerceptor:getImageSection")
   if(useFloat)
   {
-    PatchUtilities::extractPatch(ballSpot, Vector2i(ballArea, ballArea), Vector2i(patchSize, patchSize), theECImage.grayscaled, multihead.input(0).data(), extractionMode);
+    float* patch = reinterpret_cast<float*>(data);
+    PatchUtilities::extractPatch(ballSpot, Vector2i(ballArea, ballArea), Vector2i(patchSize, patchSize), theECImage.grayscaled, patch, extractionMode);
     switch(normalizationMode)
     {
       case normalizeContrast:
-        PatchUtilities::normalizeContrast(multihead.input(0).data(), Vector2i(patchSize, patchSize), normalizationOutlierRatio);
+        PatchUtilities::normalizeContrast(patch, Vector2i(patchSize, patchSize), normalizationOutlierRatio);
         break;
       case normalizeBrightness:
-        PatchUtilities::normalizeBrightness(multihead.input(0).data(), Vector2i(patchSize, patchSize), normalizationOutlierRatio);
+        PatchUtilities::normalizeBrightness(patch, Vector2i(patchSize, patchSize), normalizationOutlierRatio);
     }
   }
   else
   {
-    PatchUtilities::extractPatch(ballSpot, Vector2i(ballArea, ballArea), Vector2i(patchSize, patchSize), theECImage.grayscaled, reinterpret_cast<unsigned char*>(multihead.input(0).data()), extractionMode);
+    PatchUtilities::extractPatch(ballSpot, Vector2i(ballArea, ballArea), Vector2i(patchSize, patchSize), theECImage.grayscaled, data, extractionMode);
     switch(normalizationMode)
     {
       case normalizeContrast:
-        PatchUtilities::normalizeContrast(reinterpret_cast<unsigned char*>(multihead.input(0).data()), Vector2i(patchSize, patchSize), normalizationOutlierRatio);
+        PatchUtilities::normalizeContrast(data, Vector2i(patchSize, patchSize), normalizationOutlierRatio);
         break;
       case normalizeBrightness:
-        PatchUtilities::normalizeBrightness(reinterpret_cast<unsigned char*>(multihead.input(0).data()), Vector2i(patchSize, patchSize), normalizationOutlierRatio);
+        PatchUtilities::normalizeBrightness(data, Vector2i(patchSize, patchSize), normalizationOutlierRatio);
     }
   }
-  const float stepSize = static_cast<float>(ballArea) / static_cast<float>(patchSize);
-
-  std::vector<float> patchWithNormalization;
+  stepSize = static_cast<float>(ballArea) / static_cast<float>(patchSize);
+  return true;
+}
 
-  multihead.apply();
-  const float predNegatives = multihead.output(0)[0];
-  const float predPenalty = multihead.output(0)[1];
-  const float predBall = multihead.output(0)[2];
+std::pair<float, float> BallAndPenaltyMarkPerceptor::classify(NeuralNetwork::CompiledNN& network, const Patch& patch, Vector2f& ballPosition, Vector2f& penaltyPosition, float& predRadius)
+{
+  STOPWATCH("module:BallAndPenaltyMarkPerceptor:apply")
+    network.apply();
+  const float predNegatives = network.output(0)[0];
+  const float predPenalty = network.output(0)[1];
+  const float predBall = network.output(0)[2];
 
   // predict ball position if poss for ball is high enough
   if(predBall >= guessedThreshold && predBall - predNegatives >= 0)
   {
-    ballPosition.x() = (multihead.output(0)[3] - patchSize / 2) * stepSize + ballSpot.x();
-    ballPosition.y() = (multihead.output(0)[4] - patchSize / 2) * stepSize + ballSpot.y();
-    predRadius = (multihead.output(0)[5] * stepSize);
+    ballPosition.x() = (network.output(0)[3] - patchSize / 2) * patch.stepSize + patch.spot.x();
+    ballPosition.y() = (network.output(0)[4] - patchSize / 2) * patch.stepSize + patch.spot.y();
+    predRadius = (network.output(0)[5] * patch.stepSize);
     ASSERT(predRadius > 0.f);
   }
   // ballspot position is penalty position if poss for penalty is high enough
   else if(predPenalty >= penaltyThreshold)
   {
-    penaltyPosition.x() = static_cast<float>(ballSpot.x());
-    penaltyPosition.y() = static_cast<float>(ballSpot.y());
+    penaltyPosition.x() = static_cast<float>(patch.spot.x());
+    penaltyPosition.y() = static_cast<float>(patch.spot.y());
     ASSERT(penaltyPosition.x() >= 0.f || penaltyPosition.y() >= 0.f);
   }
   return std::make_pair(predBall, predPenalty);
@@ -251,12 +329,7 @@ void BallAndPenaltyMarkPerceptor::savePatch(std::vector<float> data, const std::
 void BallAndPenaltyMarkPerceptor::compile()
 {
   const std::string baseDir = std::string(File::getBHDir()) + "/Config/NeuralNets/BallAndPenaltyMarkPerceptor/";
-  multiheadModel = std::make_unique<NeuralNetwork::Model>(baseDir + multiheadName);
-
-  if(!useFloat)
-  {
-    multiheadModel->setInputUInt8(0);
-  }
+  multiheadModel = useFloat ? ModelRegistry::get(baseDir + multiheadName) : ModelRegistry::get(baseDir + multiheadName, {0});
 
   multihead.compile(*multiheadModel);
 
@@ -264,3 +337,25 @@ void BallAndPenaltyMarkPerceptor::compile()
 
   patchSize = 32;
 }
+
+void BallAndPenaltyMarkPerceptor::compileVariant()
+{
+  if(!(useVariant || compareVariant) || variantName.empty() || variantName == compiledVariantName)
+    return;
+
+  const std::string filename = std::string(File::getBHDir()) + "/Config/NeuralNets/BallAndPenaltyMarkPerceptor/" + variantName;
+  compiledVariantName = variantName;
+  if(!File(filename, "rb", false).exists())
+  {
+    OUTPUT_ERROR("BallAndPenaltyMarkPerceptor: variant " << variantName << " not found.");
+    return;
+  }
+
+  variantModel = useFloat ? ModelRegistry::get(filename) : ModelRegistry::get(filename, {0});
+  variant.compile(*variantModel);
+
+  // The variant must be a drop-in replacement for the main network.
+  ASSERT(variant.numOfInputs() == 1);
+  ASSERT(variant.input(0).size() == multihead.input(0).size());
+  ASSERT(variant.output(0).size() == multihead.output(0).size());
+}
@@ -17,6 +17,7 @@
 #include "Representations/Infrastructure/CameraInfo.h"
 #include "Representations/Infrastructure/FrameInfo.h"
 #include "Representations/Infrastructure/GameState.h"
+#include "Representations/Infrastructure/PerceptionQuality.h"
 #include "Representations/Modeling/RobotPose.h"
 #include "Representations/MotionControl/MotionInfo.h"
 #include "Representations/Perception/MeasurementCovariance.h"
@@ -25,6 +26,7 @@
 #include "Representations/Perception/ImagePreprocessing/BodyContour.h"
 #include "Representations/Perception/ImagePreprocessing/CameraMatrix.h"
 #include "Representations/Perception/ImagePreprocessing/ECImage.h"
+#include "Representations/Perception/ImagePreprocessing/ImagePatches.h"
 #include "Representations/Perception/ImagePreprocessing/ImageRegions.h"
 #include "Representations/Perception/FieldPercepts/PenaltyMarkPercept.h"
 #include "ImageProcessing/PatchUtilities.h"
@@ -46,11 +48,14 @@ MODULE(BallAndPenaltyMarkPerceptor,
   REQUIRES(GameState),
   REQUIRES(MeasurementCovariance),
   REQUIRES(MotionInfo),
+  REQUIRES(PerceptionQuality),
   REQUIRES(RobotPose),
   PROVIDES(BallPercept),
   REQUIRES(BallPercept),
   REQUIRES(PenaltyMarkRegions),
   PROVIDES(PenaltyMarkPercept),
+  REQUIRES(PenaltyMarkPercept),
+  PROVIDES_LAZY(BallPatches),
   LOADS_PARAMETERS(
   {
     ENUM(NormalizationMode,
@@ -71,6 +76,10 @@ MODULE(BallAndPenaltyMarkPerceptor,
     (bool) useFloat,
     (PatchUtilities::ExtractionMode) extractionMode,
     (float) penaltyThreshold, /**< Limit from which a penalty mark is accepted. */
+    (std::string) variantName, /**< The file name of an alternative variant of the model with the same inputs and outputs, e.g. a quantized one (empty: none). */
+    (bool) useVariant, /**< Use the variant instead of the main model? */
+    (bool) compareVariant, /**< Apply both models to all patches and plot how much they disagree? */
+    (ENUM_INDEXED_ARRAY(unsigned, PerceptionQuality::Level)) maxPatches, /**< The maximum number of patches classified per frame for each perception quality. */
   }),
 });
 
@@ -80,9 +89,19 @@ public:
   BallAndPenaltyMarkPerceptor();
 
 private:
+  /** A candidate patch that was extracted from the image. */
+  struct Patch
+  {
+    Vector2i spot; /**< The center of the patch in the image. */
+    float stepSize; /**< The size of a patch pixel in image pixels. */
+  };
+
   NeuralNetwork::CompiledNN multihead;
+  NeuralNetwork::CompiledNN variant; /**< The alternative variant of the network. */
 
-  std::unique_ptr<NeuralNetwork::Model> multiheadModel;
+  std::shared_ptr<const NeuralNetwork::Model> multiheadModel;
+  std::shared_ptr<const NeuralNetwork::Model> variantModel; /**< The model of the alternative variant. */
+  std::string compiledVariantName; /**< The file name of the variant compiled. */
 
   std::size_t patchSize = 0;
 
@@ -90,11 +109,42 @@ private:
   Vector2f bestBallPosition;
   Vector2f bestPenaltyPosition;
   unsigned lastFrameTime = 0;
+  std::vector<Patch> patches; /**< The patches extracted in the current frame. */
+  std::vector<unsigned char> patchData; /**< The pixels of all patches extracted, one after another. */
+  std::vector<float> patchOutputs; /**< The outputs of the network for the patches classified, one after another. */
 
   void update(BallPercept& theBallPercept) override;
   void update(PenaltyMarkPercept& thePenaltyMarkPercept) override;
+
+  /**
+   * Provides the patches classified in the current frame without normalization.
+   * @param theBallPatches The representation updated.
+   */
+  void update(BallPatches& theBallPatches) override;
   void updateBallAndPenaltyMarkPerceptor();
-  std::pair<float, float> apply(const Vector2i& ballSpot, Vector2f& ballPosition, Vector2f& penaltyPosition, float& predRadius);
+
+  /**
+   * Extracts and normalizes the patch around a candidate spot.
+   * @param ballSpot The center of the patch in the image.
+   * @param data The buffer the patch is written to in the format of the network input.
+   * @param stepSize The size of a patch pixel in image pixels is returned here.
+   * @return Was the patch extracted? This fails if the spot cannot be projected to the field.
+   */
+  bool extractPatch(const Vector2i& ballSpot, unsigned char* data, float& stepSize);
+
+  /**
+   * Classifies a patch that was already copied into the input of the network.
+   * @param network The network applied.
+   * @param patch The patch.
+   * @param ballPosition The position of the ball in the image if the patch shows a ball.
+   * @param penaltyPosition The position of the penalty mark if the patch shows one.
+   * @param predRadius The radius of the ball in the image if the patch shows a ball.
+   * @return The probabilities of a ball and a penalty mark.
+   */
+  std::pair<float, float> classify(NeuralNetwork::CompiledNN& network, const Patch& patch, Vector2f& ballPosition, Vector2f& penaltyPosition, float& predRadius);
   void compile();
+
+  /** Compiles the alternative variant of the network if it is needed and has changed. */
+  void compileVariant();
   void savePatch(std::vector<float> data, const std::string filename);
 };
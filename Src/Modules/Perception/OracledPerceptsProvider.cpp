@@ -149,6 +149,7 @@ OracledPerceptsProvider::OracledPerceptsProvider()
 
 void OracledPerceptsProvider::update(BallPercept& ballPercept)
 {
+  prepareFrame();
   ballPercept.status = BallPercept::notSeen;
   if(!theCameraMatrix.isValid || theGroundTruthWorldState.balls.size() == 0)
     return;
@@ -162,7 +163,7 @@ void OracledPerceptsProvider::update(BallPercept& ballPercept)
 void OracledPerceptsProvider::trueBallPercept(BallPercept& ballPercept)
 {
   const Vector2f ballOnField = theGroundTruthWorldState.balls[0].position.head<2>();
-  Vector2f ballOffset = theGroundTruthWorldState.ownPose.inverse() * ballOnField;
+  Vector2f ballOffset = robotPoseInv * ballOnField;
   if(ballOffset.norm() > ballMaxVisibleDistance || isPointBehindObstacle(ballOnField))
     return;
   if(Random::bernoulli(1. - ballRecognitionRate))
@@ -197,7 +198,6 @@ void OracledPerceptsProvider::trueBallPercept(BallPercept& ballPercept)
 void OracledPerceptsProvider::falseBallPercept(BallPercept& ballPercept)
 {
   std::vector<BallPercept> possiblePercepts;
-  const Pose2f robotPoseInv = theGroundTruthWorldState.ownPose.inverse();
 
   auto addPercept = [&](const Vector2f& positionOnField)
   {
@@ -244,10 +244,10 @@ void OracledPerceptsProvider::falseBallPercept(BallPercept& ballPercept)
 
 void OracledPerceptsProvider::update(GoalPostsPercept& goalPostsPercept)
 {
+  prepareFrame();
   goalPostsPercept.goalPosts.clear();
   if(!theCameraMatrix.isValid)
     return;
-  const Pose2f robotPoseInv = theGroundTruthWorldState.ownPose.inverse();
   for(unsigned int i = 0; i < goalPosts.size(); i++)
   {
     const Vector2f relativePostPos = robotPoseInv * goalPosts[i];
@@ -279,13 +279,13 @@ void OracledPerceptsProvider::update(GoalPostsPercept& goalPostsPercept)
 
 void OracledPerceptsProvider::update(LinesPercept& linesPercept)
 {
+  prepareFrame();
   // Initialize percept and local data:
   linesPercept.lines.clear();
 
   if(!theCameraMatrix.isValid)
     return;
   updateViewPolygon();
-  const Pose2f robotPoseInv = theGroundTruthWorldState.ownPose.inverse();
 
   // Find lines:
   for(unsigned int i = 0; i < lines.size(); i++)
@@ -334,12 +334,12 @@ void OracledPerceptsProvider::update(LinesPercept& linesPercept)
 
 void OracledPerceptsProvider::update(CirclePercept& circlePercept)
 {
+  prepareFrame();
   circlePercept.wasSeen = false;
   if(!theCameraMatrix.isValid)
     return;
 
   // Find center circle (at least one out of five center circle points must be inside the current image)
-  const Pose2f robotPoseInv = theGroundTruthWorldState.ownPose.inverse();
   bool pointFound = false;
   if((theGroundTruthWorldState.ownPose.translation.norm() <= centerCircleMaxVisibleDistance) &&
      Random::bernoulli(centerCircleRecognitionRate))
@@ -380,10 +380,10 @@ void OracledPerceptsProvider::update(CirclePercept& circlePercept)
 
 void OracledPerceptsProvider::update(PenaltyMarkPercept& penaltyMarkPercept)
 {
+  prepareFrame();
   penaltyMarkPercept.wasSeen = false;
   if(!theCameraMatrix.isValid)
     return;
-  const Pose2f robotPoseInv = theGroundTruthWorldState.ownPose.inverse();
   for(auto& pos : penaltyMarks)
   {
     Vector2f relativeMarkPos = robotPoseInv * pos;
@@ -414,7 +414,7 @@ void OracledPerceptsProvider::update(PenaltyMarkPercept& penaltyMarkPercept)
 
 void OracledPerceptsProvider::falsePenaltyMarkPercept(PenaltyMarkPercept& penaltyMarkPercept)
 {
-  Vector2f falseMarkPos = theGroundTruthWorldState.ownPose.inverse() * penaltyMarks[0];
+  Vector2f falseMarkPos = robotPoseInv * penaltyMarks[0];
   falseMarkPos.y() *= Random::bernoulli(0.5) ? -penaltyMarkFalseDeviationFactor : penaltyMarkFalseDeviationFactor;
   if(Random::bernoulli(0.5))
     falseMarkPos.x() *= penaltyMarkFalseDeviationFactor;
@@ -429,6 +429,7 @@ void OracledPerceptsProvider::falsePenaltyMarkPercept(PenaltyMarkPercept& penalt
 
 void OracledPerceptsProvider::update(ObstaclesImagePercept& obstaclesImagePercept)
 {
+  prepareFrame();
   obstaclesImagePercept.obstacles.clear();
   if(!theCameraMatrix.isValid || !Global::settingsExist())
     return;
@@ -443,6 +444,7 @@ void OracledPerceptsProvider::update(ObstaclesImagePercept& obstaclesImagePercep
 
 void OracledPerceptsProvider::update(ObstaclesFieldPercept& obstaclesFieldPercept)
 {
+  prepareFrame();
   obstaclesFieldPercept.obstacles.clear();
   if(!theCameraMatrix.isValid || !Global::settingsExist())
     return;
@@ -457,6 +459,7 @@ void OracledPerceptsProvider::update(ObstaclesFieldPercept& obstaclesFieldPercep
 
 void OracledPerceptsProvider::update(FieldBoundary& fieldBoundary)
 {
+  prepareFrame();
   // Initialize percept and local data:
   fieldBoundary.boundaryInImage.clear();
   fieldBoundary.boundaryOnField.clear();
@@ -470,7 +473,6 @@ void OracledPerceptsProvider::update(FieldBoundary& fieldBoundary)
     return;
   }
   updateViewPolygon();
-  const Pose2f robotPoseInv = theGroundTruthWorldState.ownPose.inverse();
 
   // Find boundary lines:
   for(unsigned int i = 0; i < fieldBoundaryLines.size(); i++)
@@ -502,7 +504,6 @@ void OracledPerceptsProvider::update(FieldBoundary& fieldBoundary)
 
 void OracledPerceptsProvider::createPlayerBox(const GroundTruthWorldState::GroundTruthPlayer& player, ObstaclesImagePercept& obstaclesImagePercept)
 {
-  const Pose2f robotPoseInv = theGroundTruthWorldState.ownPose.inverse();
   Vector2f relativePlayerPos = robotPoseInv * player.pose.translation;
   if(relativePlayerPos.norm() > playerMaxVisibleDistance)
     return;
@@ -531,7 +532,6 @@ void OracledPerceptsProvider::createPlayerBox(const GroundTruthWorldState::Groun
 
 void OracledPerceptsProvider::createPlayerOnField(const GroundTruthWorldState::GroundTruthPlayer& player, bool isOpponent, ObstaclesFieldPercept& obstaclesFieldPercept)
 {
-  const Pose2f robotPoseInv = theGroundTruthWorldState.ownPose.inverse();
   Vector2f relativePlayerPos = robotPoseInv * player.pose.translation;
   if(relativePlayerPos.norm() > playerMaxVisibleDistance)
     return;
@@ -589,8 +589,39 @@ bool OracledPerceptsProvider::pointIsInImage(const Vector2f& p, Vector2f& pImg)
   return false;
 }
 
+void OracledPerceptsProvider::prepareFrame()
+{
+  // A frame time of 0 cannot be distinguished from the initial state.
+  if(theFrameInfo.time == timeOfLastPreparation && theFrameInfo.time != 0)
+    return;
+  timeOfLastPreparation = theFrameInfo.time;
+  viewPolygonIsValid = false;
+  robotPoseInv = theGroundTruthWorldState.ownPose.inverse();
+
+  occluders.clear();
+  auto addOccluder = [&](const GroundTruthWorldState::GroundTruthPlayer& player)
+  {
+    const float sqrDistToObstacle = (player.pose.translation - theGroundTruthWorldState.ownPose.translation).squaredNorm();
+    if(!player.upright || sqrDistToObstacle < 10)
+      return;
+
+    const Vector2f obstacleRel = robotPoseInv * player.pose.translation;
+    const Vector2f obstacleThickness = obstacleRel.normalized(obstacleCoverageThickness).rotate(pi_2);
+    occluders.push_back({sqrDistToObstacle, (obstacleRel + obstacleThickness).angle(), (obstacleRel - obstacleThickness).angle()});
+  };
+
+  for(const GroundTruthWorldState::GroundTruthPlayer& player : theGroundTruthWorldState.ownTeamPlayers)
+    addOccluder(player);
+  for(const GroundTruthWorldState::GroundTruthPlayer& player : theGroundTruthWorldState.opponentTeamPlayers)
+    addOccluder(player);
+}
+
 void OracledPerceptsProvider::updateViewPolygon()
 {
+  if(viewPolygonIsValid)
+    return;
+  viewPolygonIsValid = true;
+
   const Vector3f vectorToCenter(1, 0, 0);
 
   RotationMatrix r = theCameraMatrix.rotation;
@@ -665,17 +696,18 @@ void OracledPerceptsProvider::updateViewPolygon()
 
 bool OracledPerceptsProvider::partOfLineIsVisible(const std::pair<Vector2f, Vector2f>& line, Vector2f& start, Vector2f& end) const
 {
+  const bool firstIsInside = Geometry::isPointInsideConvexPolygon(viewPolygon, 4, line.first);
+  const bool secondIsInside = Geometry::isPointInsideConvexPolygon(viewPolygon, 4, line.second);
+
   // First case: both points are inside:
-  if(Geometry::isPointInsideConvexPolygon(viewPolygon, 4, line.first) &&
-     Geometry::isPointInsideConvexPolygon(viewPolygon, 4, line.second))
+  if(firstIsInside && secondIsInside)
   {
     start = line.first;
     end = line.second;
     return true;
   }
   // Second case: start is inside but end is outside
-  if(Geometry::isPointInsideConvexPolygon(viewPolygon, 4, line.first) &&
-     !Geometry::isPointInsideConvexPolygon(viewPolygon, 4, line.second))
+  if(firstIsInside && !secondIsInside)
   {
     start = line.first;
     for(int i = 0; i < 4; i++)
@@ -692,8 +724,7 @@ bool OracledPerceptsProvider::partOfLineIsVisible(const std::pair<Vector2f, Vect
     return false; // should not happen ...
   }
   // Third case: end is inside but start is outside
-  if(!Geometry::isPointInsideConvexPolygon(viewPolygon, 4, line.first) &&
-     Geometry::isPointInsideConvexPolygon(viewPolygon, 4, line.second))
+  if(!firstIsInside && secondIsInside)
   {
     start = line.second;
     for(int i = 0; i < 4; i++)
@@ -757,31 +788,11 @@ void OracledPerceptsProvider::applyNoise(float standardDeviation, float& angle)
 
 bool OracledPerceptsProvider::isPointBehindObstacle(const Vector2f& pointGlo) const
 {
-  const Pose2f robotPoseInv = theGroundTruthWorldState.ownPose.inverse();
-  const float sqrDistTopoint = (pointGlo - theGroundTruthWorldState.ownPose.translation).squaredNorm();
+  const float sqrDistToPoint = (pointGlo - theGroundTruthWorldState.ownPose.translation).squaredNorm();
   const Angle pointAngle = (robotPoseInv * pointGlo).angle();
 
-  auto isBehind = [&](const Vector2f& obstacle)
-  {
-    const float sqrDistToObstacle = (obstacle - theGroundTruthWorldState.ownPose.translation).squaredNorm();
-    if(sqrDistToObstacle < 10 || sqrDistTopoint <= sqrDistToObstacle)
-      return false;
-
-    const Vector2f obstacleRel = robotPoseInv * obstacle;
-    const Vector2f obstacleThickness = obstacleRel.normalized(obstacleCoverageThickness).rotate(pi_2);
-
-    const Angle leftPointAngle = (obstacleRel + obstacleThickness).angle();
-    const Angle rightPointAngle = (obstacleRel - obstacleThickness).angle();
-
-    return pointAngle < leftPointAngle && pointAngle > rightPointAngle; //would not work on behind the robot, but we can not see anything there too
-  };
-
-  for(const GroundTruthWorldState::GroundTruthPlayer& player : theGroundTruthWorldState.ownTeamPlayers)
-    if(player.upright && isBehind(player.pose.translation))
-      return true;
-
-  for(const GroundTruthWorldState::GroundTruthPlayer& player : theGroundTruthWorldState.opponentTeamPlayers)
-    if(player.upright && isBehind(player.pose.translation))
+  for(const Occluder& occluder : occluders)
+    if(sqrDistToPoint > occluder.sqrDistance && pointAngle < occluder.leftAngle && pointAngle > occluder.rightAngle) //would not work on behind the robot, but we can not see anything there too
       return true;
 
   return false;
@@ -12,6 +12,7 @@
 #include "Representations/Configuration/BallSpecification.h"
 #include "Representations/Configuration/FieldDimensions.h"
 #include "Representations/Infrastructure/CameraInfo.h"
+#include "Representations/Infrastructure/FrameInfo.h"
 #include "Representations/Infrastructure/GroundTruthWorldState.h"
 #include "Representations/Perception/MeasurementCovariance.h"
 #include "Representations/Perception/BallPercepts/BallPercept.h"
@@ -32,6 +33,7 @@ MODULE(OracledPerceptsProvider,
   REQUIRES(CameraMatrix),
   REQUIRES(CameraInfo),
   REQUIRES(FieldDimensions),
+  REQUIRES(FrameInfo),
   REQUIRES(MeasurementCovariance),
   PROVIDES(BallPercept),
   PROVIDES(CirclePercept),
@@ -94,6 +96,19 @@ private:
   std::vector<std::pair<Vector2f, Vector2f>> fieldBoundaryLines; /**< The boundary of the field */
   Vector2f viewPolygon[4];                                       /**< A polygon that describes the currently visible area */
 
+  /** An upright player that might hide objects behind it, as seen from this robot. */
+  struct Occluder
+  {
+    float sqrDistance; /**< The squared distance to the player. */
+    Angle leftAngle;   /**< The relative angle to the left edge of the covered area. */
+    Angle rightAngle;  /**< The relative angle to the right edge of the covered area. */
+  };
+
+  unsigned timeOfLastPreparation = 0;                            /**< The frame time prepareFrame() was last executed for. */
+  bool viewPolygonIsValid = false;                               /**< Was the view polygon already computed in the current frame? */
+  Pose2f robotPoseInv;                                           /**< The inverse of the ground truth pose of this robot in the current frame. */
+  std::vector<Occluder> occluders;                               /**< The players that might hide other objects in the current frame. */
+
   /** One main function, might be called every cycle
    * @param ballPercept The data struct to be filled
    */
@@ -175,7 +190,14 @@ private:
    */
   void applyNoise(float standardDeviation, float& angle) const;
 
-  /** Updates viewPolygon member */
+  /**
+   * Computes the data shared by all percepts once per frame, i.e. the inverse
+   * robot pose and the areas covered by other players. The view polygon is
+   * invalidated and only recomputed when it is needed.
+   */
+  void prepareFrame();
+
+  /** Updates viewPolygon member if it was not computed in the current frame yet */
   void updateViewPolygon();
 
   /** Checks if a line (or parts of it) is inside the view polygon
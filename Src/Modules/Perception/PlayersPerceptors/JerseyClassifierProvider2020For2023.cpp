@@ -26,6 +26,18 @@ void JerseyClassifierProvider2020For2023::update(JerseyClassifier& jerseyClassif
   DECLARE_DEBUG_DRAWING("module:JerseyClassifierProvider2020For2023:jerseyWeights", "drawingOnImage");
   DECLARE_DEBUG_DRAWING("module:JerseyClassifierProvider2020For2023:jerseyClassification", "drawingOnImage");
 
+  // The classifiers only depend on the jersey colors, so they are only set up again if these change.
+  const std::array<GameState::Team::Color, 4> colors = {theGameState.ownTeam.fieldPlayerColor, theGameState.opponentTeam.fieldPlayerColor,
+                                                        theGameState.ownTeam.goalkeeperColor, theGameState.opponentTeam.goalkeeperColor};
+  if(colors != classifierColors)
+  {
+    classifierColors = colors;
+    setupPixelClassifier(theGameState.ownTeam.fieldPlayerColor, theGameState.opponentTeam.fieldPlayerColor, theGameState.opponentTeam.goalkeeperColor, theGameState.ownTeam.goalkeeperColor, isOwnFieldPlayer);
+    setupPixelClassifier(theGameState.opponentTeam.fieldPlayerColor, theGameState.ownTeam.fieldPlayerColor, theGameState.opponentTeam.goalkeeperColor, theGameState.ownTeam.goalkeeperColor, isOpponentFieldPlayer);
+    setupPixelClassifier(theGameState.ownTeam.goalkeeperColor, theGameState.ownTeam.fieldPlayerColor, theGameState.opponentTeam.fieldPlayerColor, theGameState.opponentTeam.goalkeeperColor, isOwnGoalkeeper);
+    setupPixelClassifier(theGameState.opponentTeam.goalkeeperColor, theGameState.opponentTeam.fieldPlayerColor, theGameState.ownTeam.fieldPlayerColor, theGameState.ownTeam.goalkeeperColor, isOpponentGoalkeeper);
+  }
+
   jerseyClassifier.detectJersey = [this](const ObstaclesImagePercept::Obstacle& obstacleInImage, ObstaclesFieldPercept::Obstacle& obstacleOnField)
   {
     return detectJersey(obstacleInImage, obstacleOnField);
@@ -119,11 +131,8 @@ void JerseyClassifierProvider2020For2023::detectJersey(const ObstaclesImagePerce
             maxBrightness = std::max(theECImage.grayscaled[static_cast<int>(centerInImage.y()) + whiteScanOffSet * yOffset][static_cast<int>(x)], maxBrightness);
       }
 
-      // Get pixel classifier
-      const std::function<bool(int, int)>& isOwnFieldPlayer = getPixelClassifier(theGameState.ownTeam.fieldPlayerColor, theGameState.opponentTeam.fieldPlayerColor, theGameState.opponentTeam.goalkeeperColor, theGameState.ownTeam.goalkeeperColor, maxBrightness);
-      const std::function<bool(int, int)>& isOpponentFieldPlayer = getPixelClassifier(theGameState.opponentTeam.fieldPlayerColor, theGameState.ownTeam.fieldPlayerColor, theGameState.opponentTeam.goalkeeperColor, theGameState.ownTeam.goalkeeperColor, maxBrightness);
-      const std::function<bool(int, int)>& isOwnGoalkeeper = getPixelClassifier(theGameState.ownTeam.goalkeeperColor, theGameState.ownTeam.fieldPlayerColor, theGameState.opponentTeam.fieldPlayerColor, theGameState.opponentTeam.goalkeeperColor, maxBrightness);
-      const std::function<bool(int, int)>& isOpponentGoalkeeper = getPixelClassifier(theGameState.opponentTeam.goalkeeperColor, theGameState.opponentTeam.fieldPlayerColor, theGameState.ownTeam.fieldPlayerColor, theGameState.ownTeam.goalkeeperColor, maxBrightness);
+      // Black is relative to the maximum brightness below the jersey.
+      const int maxBlack = static_cast<int>(maxBrightness * grayRange.min);
 
       float ownFieldPlayerPixels = 0;
       float opponentFieldPlayerPixels = 0;
@@ -149,22 +158,27 @@ void JerseyClassifierProvider2020For2023::detectJersey(const ObstaclesImagePerce
           DOT("module:JerseyClassifierProvider2020For2023:jerseyWeights", static_cast<int>(x), static_cast<int>(y),
               ColorRGBA(static_cast<unsigned  char>(240 - 240 * weight), static_cast<unsigned  char>(240 * weight), static_cast<unsigned  char>(240 * weight), 220),
               ColorRGBA(static_cast<unsigned  char>(240 - 240 * weight), static_cast<unsigned  char>(240 * weight), static_cast<unsigned  char>(240 * weight), 220));
-          if(isOwnFieldPlayer(static_cast<int>(x), static_cast<int>(y)))
+          const int xImage = static_cast<int>(x);
+          const int yImage = static_cast<int>(y);
+          const unsigned char hue = theECImage.hued[yImage][xImage];
+          const unsigned char saturation = theECImage.saturated[yImage][xImage];
+          const unsigned char brightness = theECImage.grayscaled[yImage][xImage];
+          if(isOwnFieldPlayer(hue, saturation, brightness, maxBlack))
           {
             ownFieldPlayerPixels += weight;
             DOT("module:JerseyClassifierProvider2020For2023:jersey", static_cast<int>(x), static_cast<int>(y), ColorRGBA::yellow, ColorRGBA::yellow);
           }
-          else if(isOpponentFieldPlayer(static_cast<int>(x), static_cast<int>(y)))
+          else if(isOpponentFieldPlayer(hue, saturation, brightness, maxBlack))
           {
             opponentFieldPlayerPixels += weight;
             DOT("module:JerseyClassifierProvider2020For2023:jersey", static_cast<int>(x), static_cast<int>(y), ColorRGBA::blue, ColorRGBA::blue);
           }
-          else if(isOpponentGoalkeeper(static_cast<int>(x), static_cast<int>(y)))
+          else if(isOpponentGoalkeeper(hue, saturation, brightness, maxBlack))
           {
             opponentGoalkeeperPixels += weight;
             DOT("module:JerseyClassifierProvider2020For2023:jersey", static_cast<int>(x), static_cast<int>(y), ColorRGBA::blue, ColorRGBA::blue);
           }
-          else if(isOwnGoalkeeper(static_cast<int>(x), static_cast<int>(y)))
+          else if(isOwnGoalkeeper(hue, saturation, brightness, maxBlack))
           {
             ownGoalkeeperPixels += weight;
             DOT("module:JerseyClassifierProvider2020For2023:jersey", static_cast<int>(x), static_cast<int>(y), ColorRGBA::yellow, ColorRGBA::yellow);
@@ -219,100 +233,51 @@ void JerseyClassifierProvider2020For2023::detectJersey(const ObstaclesImagePerce
   }
 }
 
-std::function<bool(int, int)> JerseyClassifierProvider2020For2023::getPixelClassifier(const GameState::Team::Color checkColor,
-                                                                                      const GameState::Team::Color o1,
-                                                                                      const GameState::Team::Color o2,
-                                                                                      const GameState::Team::Color o3,
-                                                                                      const int maxBrightness) const
+void JerseyClassifierProvider2020For2023::setupPixelClassifier(const GameState::Team::Color checkColor,
+                                                               const GameState::Team::Color o1,
+                                                               const GameState::Team::Color o2,
+                                                               const GameState::Team::Color o3,
+                                                               PixelClassifier& classifier) const
 {
-  const int checkHue = jerseyHues[checkColor];
-  const int o1Hue = jerseyHues[o1];
-  const int o2Hue = jerseyHues[o2];
-  const int o3Hue = jerseyHues[o3];
-  const Rangei grayRange = Rangei(static_cast<int>(maxBrightness * this->grayRange.min),
-                                  static_cast<int>(maxBrightness * this->grayRange.max));
-
-  bool checkIsBlack = checkColor == GameState::Team::Color::black;
-  bool othersAreAllColorful = o1 != GameState::Team::Color::black && o1 != GameState::Team::Color::gray && o1 != GameState::Team::Color::white &&
-                              o2 != GameState::Team::Color::black && o2 != GameState::Team::Color::gray && o2 != GameState::Team::Color::white &&
-                              o3 != GameState::Team::Color::black && o3 != GameState::Team::Color::gray && o3 != GameState::Team::Color::white;
-
-  // Black jersey is compared to colorful options:
-  if(checkIsBlack && othersAreAllColorful)
-    return [this, grayRange, o1Hue, o2Hue, o3Hue](const int x, const int y)
-    {
-      return theECImage.saturated[y][x] < satThreshold && theECImage.grayscaled[y][x] <= grayRange.min &&
-             std::abs(static_cast<signed char>(theECImage.hued[y][x] - o1Hue)) > hueSimilarityThreshold &&
-             std::abs(static_cast<signed char>(theECImage.hued[y][x] - o2Hue)) > hueSimilarityThreshold &&
-             std::abs(static_cast<signed char>(theECImage.hued[y][x] - o3Hue)) > hueSimilarityThreshold;
-    };
-  // All jerseys are colorful, no black/gray/white involved at all:
-  else if(!checkIsBlack && othersAreAllColorful)
-    return [this, checkHue, o1Hue, o2Hue, o3Hue](const int x, const int y)
-    {
-      const int hue = theECImage.hued[y][x];
-      return std::abs(static_cast<signed char>(hue - checkHue)) < std::min(std::abs(static_cast<signed char>(hue - o1Hue)), hueSimilarityThreshold) &&
-             std::abs(static_cast<signed char>(hue - checkHue)) < std::min(std::abs(static_cast<signed char>(hue - o2Hue)), hueSimilarityThreshold) &&
-             std::abs(static_cast<signed char>(hue - checkHue)) < std::min(std::abs(static_cast<signed char>(hue - o3Hue)), hueSimilarityThreshold);
-    };
-  // We check the black jersey against a set of others that contain at least once white or gray
-  else if(checkIsBlack && !othersAreAllColorful)
-    return [this, o1Hue, o2Hue, o3Hue, o1, o2, o3, grayRange](const int x, const int y)
-    {
-      bool checkO1 = false;
-      if(o1 == GameState::Team::Color::gray || o1 == GameState::Team::Color::white)
-        checkO1 = theECImage.saturated[y][x] < colorDelimiter && theECImage.grayscaled[y][x] < grayRange.min;
-      else
-        checkO1 = theECImage.saturated[y][x] < satThreshold && theECImage.grayscaled[y][x] <= grayRange.min &&
-                    std::abs(static_cast<signed char>(theECImage.hued[y][x] - o1Hue)) > hueSimilarityThreshold;
-      if(!checkO1)
-        return false;
-
-      bool checkO2 = false;
-      if(o2 == GameState::Team::Color::gray || o2 == GameState::Team::Color::white)
-        checkO2 = theECImage.saturated[y][x] < colorDelimiter && theECImage.grayscaled[y][x] < grayRange.min;
-      else
-        checkO2 = theECImage.saturated[y][x] < satThreshold && theECImage.grayscaled[y][x] <= grayRange.min &&
-                    std::abs(static_cast<signed char>(theECImage.hued[y][x] - o2Hue)) > hueSimilarityThreshold;
-      if(!checkO2)
-        return false;
+  const auto isUncolored = [](const GameState::Team::Color color)
+  {
+    return color == GameState::Team::Color::black || color == GameState::Team::Color::gray || color == GameState::Team::Color::white;
+  };
+  const auto hueDistance = [](const int hue1, const int hue2)
+  {
+    return std::abs(static_cast<signed char>(hue1 - hue2));
+  };
 
-      bool checkO3 = false;
-      if(o3 == GameState::Team::Color::gray || o3 == GameState::Team::Color::white)
-        checkO3 = theECImage.saturated[y][x] < colorDelimiter && theECImage.grayscaled[y][x] < grayRange.min;
-      else
-        checkO3 = theECImage.saturated[y][x] < satThreshold && theECImage.grayscaled[y][x] <= grayRange.min &&
-                    std::abs(static_cast<signed char>(theECImage.hued[y][x] - o3Hue)) > hueSimilarityThreshold;
+  const int checkHue = jerseyHues[checkColor];
+  classifier.dark = checkColor == GameState::Team::Color::black;
+  classifier.strictlyDarker = false;
+  classifier.maxSaturation = 256;
+  classifier.hues.fill(true);
 
-      return checkO3;
-    };
-  // We check a colored jersey against a set of others that contain at least once white or gray or black
-  else //if(!checkIsBlack && !othersAreAllColorful)
-    return [this, checkHue, grayRange, o1Hue, o2Hue, o3Hue, o1, o2, o3](const int x, const int y)
+  for(const GameState::Team::Color other : {o1, o2, o3})
+  {
+    const int otherHue = jerseyHues[other];
+    if(classifier.dark)
     {
-      const int hue = theECImage.hued[y][x];
-      bool checkO1 = false;
-      if(o1 == GameState::Team::Color::black || o1 == GameState::Team::Color::gray || o1 == GameState::Team::Color::white)
-        checkO1 = std::abs(static_cast<signed char>(theECImage.hued[y][x] - checkHue)) <= hueSimilarityThreshold;
-      else
-        checkO1 = std::abs(static_cast<signed char>(hue - checkHue)) < std::min(std::abs(static_cast<signed char>(hue - o1Hue)), hueSimilarityThreshold);
-      if(!checkO1)
-        return false;
-
-      bool checkO2 = false;
-      if(o2 == GameState::Team::Color::black || o2 == GameState::Team::Color::gray || o2 == GameState::Team::Color::white)
-        checkO2 = std::abs(static_cast<signed char>(theECImage.hued[y][x] - checkHue)) <= hueSimilarityThreshold;
-      else
-        checkO2 = std::abs(static_cast<signed char>(hue - checkHue)) < std::min(std::abs(static_cast<signed char>(hue - o2Hue)), hueSimilarityThreshold);
-      if(!checkO2)
-        return false;
-
-      bool checkO3 = false;
-      if(o3 == GameState::Team::Color::black || o3 == GameState::Team::Color::gray || o3 == GameState::Team::Color::white)
-        checkO3 = std::abs(static_cast<signed char>(theECImage.hued[y][x] - checkHue)) <= hueSimilarityThreshold;
+      // A black jersey is distinguished from white and gray ones by brightness and
+      // from all others by being unsaturated and having a different hue.
+      if(other == GameState::Team::Color::gray || other == GameState::Team::Color::white)
+      {
+        classifier.strictlyDarker = true;
+        classifier.maxSaturation = std::min(classifier.maxSaturation, static_cast<int>(colorDelimiter));
+      }
       else
-        checkO3 = std::abs(static_cast<signed char>(hue - checkHue)) < std::min(std::abs(static_cast<signed char>(hue - o3Hue)), hueSimilarityThreshold);
-
-      return checkO3;
-    };
+      {
+        classifier.maxSaturation = std::min(classifier.maxSaturation, static_cast<int>(satThreshold));
+        for(int hue = 0; hue < 256; ++hue)
+          classifier.hues[hue] = classifier.hues[hue] && hueDistance(hue, otherHue) > hueSimilarityThreshold;
+      }
+    }
+    else
+      // A colored jersey must be close to its hue and, compared to other colored jerseys, closer to its own hue.
+      for(int hue = 0; hue < 256; ++hue)
+        classifier.hues[hue] = classifier.hues[hue] && (isUncolored(other)
+                                                        ? hueDistance(hue, checkHue) <= hueSimilarityThreshold
+                                                        : hueDistance(hue, checkHue) < std::min(hueDistance(hue, otherHue), static_cast<int>(hueSimilarityThreshold)));
+  }
 }
@@ -20,7 +20,7 @@
 #include "Representations/Perception/ObstaclesPercepts/JerseyClassifier.h"
 #include "Framework/Module.h"
 #include "Math/Range.h"
-#include <functional>
+#include <array>
 
 MODULE(JerseyClassifierProvider2020For2023,
 {,
@@ -52,6 +52,39 @@ MODULE(JerseyClassifierProvider2020For2023,
 
 class JerseyClassifierProvider2020For2023 : public JerseyClassifierProvider2020For2023Base
 {
+  /**
+   * Detects whether a pixel belongs to a jersey color. The comparisons of its hue
+   * with all jersey colors on the pitch are precomputed for all possible hues.
+   */
+  struct PixelClassifier
+  {
+    std::array<bool, 256> hues; /**< Which hues can belong to the jersey color? */
+    bool dark = false; /**< Is the jersey color black, i.e. must the pixels also be dark and unsaturated? */
+    bool strictlyDarker = false; /**< Must dark pixels be darker than the upper end of the black range, because white or gray jerseys are on the pitch? */
+    int maxSaturation = 256; /**< Dark pixels must be less saturated than this. */
+
+    /**
+     * Does a pixel belong to the jersey color?
+     * @param hue The hue of the pixel.
+     * @param saturation The saturation of the pixel.
+     * @param brightness The brightness of the pixel.
+     * @param maxBlack The upper end of the brightness range of black pixels. It depends on
+     *                 the maximum brightness below the jersey.
+     * @return Does it belong to the jersey color?
+     */
+    bool operator()(const unsigned char hue, const unsigned char saturation, const unsigned char brightness, const int maxBlack) const
+    {
+      return hues[hue] && (!dark || (saturation < maxSaturation && (strictlyDarker ? brightness < maxBlack : brightness <= maxBlack)));
+    }
+  };
+
+  std::array<GameState::Team::Color, 4> classifierColors = {GameState::Team::Color::numOfTeamColors, GameState::Team::Color::numOfTeamColors,
+                                                            GameState::Team::Color::numOfTeamColors, GameState::Team::Color::numOfTeamColors}; /**< The jersey colors the classifiers were set up for (own and opponent field players and goalkeepers). */
+  PixelClassifier isOwnFieldPlayer; /**< Detects pixels of the jersey color of the own field players. */
+  PixelClassifier isOpponentFieldPlayer; /**< Detects pixels of the jersey color of the opponent field players. */
+  PixelClassifier isOwnGoalkeeper; /**< Detects pixels of the jersey color of the own goalkeeper. */
+  PixelClassifier isOpponentGoalkeeper; /**< Detects pixels of the jersey color of the opponent goalkeeper. */
+
   /**
    * Updates the jersey classifier.
    * @param jerseyClassifier The updated representation.
@@ -78,15 +111,11 @@ class JerseyClassifierProvider2020For2023 : public JerseyClassifierProvider2020F
    * @param o1 A team color index of another color on the pitch.
    * @param o2 A team color index of another color on the pitch.
    * @param o3 A team color index of another color on the pitch.
-   * @param maxBrightness The intensity of the brightest pixel below the jersey. This
-   *                     functions as a reference if one of the two teams uses the
-   *                     jersey color gray.
-   * @return The classifier that detects whether the pixel at (x, y) (the two parameters)
-   *         belongs to the jersey color of teamColor.
+   * @param classifier The classifier that is set up to detect the jersey color.
    */
-  std::function<bool(const int, const int)> getPixelClassifier(const GameState::Team::Color checkColor,
-                                                               const GameState::Team::Color o1,
-                                                               const GameState::Team::Color o2,
-                                                               const GameState::Team::Color o3,
-                                                               const int maxBrightness) const;
+  void setupPixelClassifier(const GameState::Team::Color checkColor,
+                            const GameState::Team::Color o1,
+                            const GameState::Team::Color o2,
+                            const GameState::Team::Color o3,
+                            PixelClassifier& classifier) const;
 };
@@ -12,14 +12,15 @@
 
 #include "CompiledNN/Model.h"
 #include "Debugging/DebugDrawings.h"
+#include "Debugging/Plot.h"
 #include "Debugging/Stopwatch.h"
 #include "ImageProcessing/PatchUtilities.h"
-#include "ImageProcessing/Resize.h"
 #include "Math/BHMath.h"
 #include "Math/Eigen.h"
 #include "Platform/File.h"
 #include "RobotDetector.h"
 #include "Streaming/Global.h"
+#include "Tools/NeuralNetworks/ModelRegistry.h"
 #include "Tools/Math/Projection.h"
 #include "Tools/Math/Transformation.h"
 
@@ -50,21 +51,20 @@ RobotDetector::RobotDetector() :
     // Model initialization
     if(useOnnx)
     {
-      onnxModel = std::make_unique<NeuralNetworkONNX::Model>(std::string(File::getBHDir()) + model_path);
+      onnxModel = ModelRegistry::getONNX(std::string(File::getBHDir()) + model_path, {0}); // This converts the uint8 image to floats for the model
       initializeModel(onnxModel, onnxConvModel, onnxSettings);
     }
     else
     {
-      cnnModel = std::make_unique<NeuralNetwork::Model>(std::string(File::getBHDir()) + model_path);
+      cnnModel = ModelRegistry::get(std::string(File::getBHDir()) + model_path, {0}); // This converts the uint8 image to floats for the model
       initializeModel(cnnModel, cnnConvModel, settings);
     }
   }
 }
 
 template<typename Model, typename ConvModel, typename CompilationSettings>
-void RobotDetector::initializeModel(const std::unique_ptr<Model>& model, ConvModel& convModel, const CompilationSettings& settings)
+void RobotDetector::initializeModel(const std::shared_ptr<const Model>& model, ConvModel& convModel, const CompilationSettings& settings)
 {
-  model->setInputUInt8(0); // This converts the uint8 image to floats for the model
   convModel.compile(*model, settings);
   ASSERT(convModel.numOfInputs() == 1);
   ASSERT(convModel.input(0).rank() == 3);
@@ -88,6 +88,7 @@ void RobotDetector::update(ObstaclesImagePercept& theObstaclesImagePercept)
 void RobotDetector::update(ObstaclesFieldPercept& theObstaclesFieldPercept)
 {
   DECLARE_DEBUG_DRAWING("module:RobotDetector:image", "drawingOnImage");
+  DECLARE_PLOT("module:RobotDetector:networkApplied");
 
   std::vector<ObstaclesImagePercept::Obstacle>& obstacles = theCameraInfo.camera == CameraInfo::upper ? obstaclesUpper : obstaclesLower;
   obstacles.clear();
@@ -99,7 +100,18 @@ void RobotDetector::update(ObstaclesFieldPercept& theObstaclesFieldPercept)
 
   if(theCameraInfo.camera == CameraInfo::upper)
   {
-    extractImageObstaclesFromNetwork(obstacles);
+    if(thePerceptionAttention.detectRobots && ++framesSinceNetwork >= networkPeriod)
+    {
+      framesSinceNetwork = 0;
+      extractImageObstaclesFromNetwork(obstacles);
+      trackObstacles(obstacles);
+      PLOT("module:RobotDetector:networkApplied", 1);
+    }
+    else
+    {
+      predictObstacles(obstacles);
+      PLOT("module:RobotDetector:networkApplied", 0);
+    }
   }
   else
   {
@@ -122,6 +134,25 @@ void RobotDetector::update(ObstaclesPerceptorData& theObstaclesPerceptorData)
   theObstaclesPerceptorData.imageCoordinateSystem = theImageCoordinateSystem;
 }
 
+void RobotDetector::update(RobotPatches& theRobotPatches)
+{
+  const std::vector<ObstaclesImagePercept::Obstacle>& obstacles = theCameraInfo.camera == CameraInfo::upper ? obstaclesUpper : obstaclesLower;
+  theRobotPatches.patchSize = Vector2i(robotPatchSize, robotPatchSize);
+  theRobotPatches.patches.resize(obstacles.size());
+  for(std::size_t i = 0; i < obstacles.size(); ++i)
+  {
+    const ObstaclesImagePercept::Obstacle& obstacle = obstacles[i];
+    ImagePatches::Patch& patch = theRobotPatches.patches[i];
+    const Vector2i center((obstacle.left + obstacle.right) / 2, (obstacle.top + obstacle.bottom) / 2);
+    const int area = std::max(std::max(obstacle.right - obstacle.left, obstacle.bottom - obstacle.top), 1);
+    patch.position = center.cast<float>();
+    patch.area = Vector2i(area, area);
+    patch.pixels.resize(robotPatchSize * robotPatchSize);
+    PatchUtilities::extractPatch(center, patch.area, theRobotPatches.patchSize, theECImage.grayscaled, patch.pixels.data());
+    patch.outputs = {obstacle.confidence, obstacle.fallen ? 1.f : 0.f, obstacle.distance};
+  }
+}
+
 void RobotDetector::extractImageObstaclesFromNetwork(std::vector<ObstaclesImagePercept::Obstacle>& obstacles)
 {
   if(useOnnx ? !onnxConvModel.valid() : !cnnConvModel.valid())
@@ -139,7 +170,10 @@ void RobotDetector::extractImageObstaclesFromNetwork(std::vector<ObstaclesImageP
   else
     STOPWATCH("module:RobotDetector:boundingBoxes") boundingBoxes(labelImage, cnnConvModel);
 
-  STOPWATCH("module:RobotDetector:nonMaximumSuppression") labelImage.nonMaximumSuppression(nonMaximumSuppressionIoUThreshold);
+  if(useSoftNonMaximumSuppression)
+    STOPWATCH("module:RobotDetector:nonMaximumSuppression") labelImage.softNonMaximumSuppression(softNonMaximumSuppressionSigma, objectThres);
+  else
+    STOPWATCH("module:RobotDetector:nonMaximumSuppression") labelImage.nonMaximumSuppression(nonMaximumSuppressionIoUThreshold);
   STOPWATCH("module:RobotDetector:bigBoxSuppression") labelImage.bigBoxSuppression();
 
   for(const LabelImage::Annotation& box : labelImage.annotations)
@@ -158,74 +192,112 @@ void RobotDetector::extractImageObstaclesFromNetwork(std::vector<ObstaclesImageP
   }
 }
 
-void RobotDetector::fillGrayscaleThumbnail()
+void RobotDetector::trackObstacles(const std::vector<ObstaclesImagePercept::Obstacle>& obstacles)
 {
-  const auto scale = static_cast<unsigned int>(std::round(std::log2(theECImage.grayscaled.width / networkParameters.inputWidth)));
-  ASSERT(theECImage.grayscaled.width == static_cast<unsigned>(networkParameters.inputWidth) << scale);
-  ASSERT(theECImage.grayscaled.height == static_cast<unsigned>(networkParameters.inputHeight) << scale);
+  trackedObstacles.clear();
+  odometryAtDetection = theOdometryData;
+  for(const ObstaclesImagePercept::Obstacle& obstacle : obstacles)
+  {
+    TrackedObstacle tracked;
+    tracked.obstacle = obstacle;
+    if(obstacle.bottomFound
+       && Transformation::imageToRobot(obstacle.left, obstacle.bottom, theCameraMatrix, theCameraInfo, tracked.leftOnField)
+       && Transformation::imageToRobot(obstacle.right, obstacle.bottom, theCameraMatrix, theCameraInfo, tracked.rightOnField))
+      trackedObstacles.emplace_back(tracked);
+  }
+}
 
-  // Can't shrink directly to NN input because it needs a larger buffer :-(
-  STOPWATCH("module:RobotDetector:shrinkY") Resize::shrinkY(scale, theECImage.grayscaled, grayscaleThumbnail);
-  ASSERT(networkParameters.inputWidth == grayscaleThumbnail.width);
-  ASSERT(networkParameters.inputHeight == grayscaleThumbnail.height);
-  SEND_DEBUG_IMAGE("GrayscaleThumbnail", grayscaleThumbnail);
+void RobotDetector::predictObstacles(std::vector<ObstaclesImagePercept::Obstacle>& obstacles) const
+{
+  const Pose2f odometryOffset = theOdometryData.inverse() * odometryAtDetection;
+  for(const TrackedObstacle& tracked : trackedObstacles)
+  {
+    const Vector2f leftOnField = odometryOffset * tracked.leftOnField;
+    const Vector2f rightOnField = odometryOffset * tracked.rightOnField;
+    Vector2f leftInImage;
+    Vector2f rightInImage;
+    if(!Transformation::robotToImage(leftOnField, theCameraMatrix, theCameraInfo, leftInImage)
+       || !Transformation::robotToImage(rightOnField, theCameraMatrix, theCameraInfo, rightInImage))
+      continue;
+
+    const float oldDistance = (tracked.leftOnField + tracked.rightOnField).norm();
+    const float newDistance = (leftOnField + rightOnField).norm();
+    if(newDistance == 0.f)
+      continue;
+
+    ObstaclesImagePercept::Obstacle obstacle = tracked.obstacle;
+    obstacle.left = static_cast<int>(std::min(leftInImage.x(), rightInImage.x()));
+    obstacle.right = static_cast<int>(std::max(leftInImage.x(), rightInImage.x()));
+    obstacle.bottom = static_cast<int>((leftInImage.y() + rightInImage.y()) * 0.5f);
+    obstacle.top = obstacle.bottom - static_cast<int>(static_cast<float>(tracked.obstacle.bottom - tracked.obstacle.top) * oldDistance / newDistance);
+    if(obstacle.right < 0 || obstacle.left >= theCameraInfo.width || obstacle.bottom < 0 || obstacle.top >= theCameraInfo.height)
+      continue;
+    obstacle.bottomFound = obstacle.bottom < theCameraInfo.height;
+    obstacle.bottom = std::min(obstacle.bottom, theCameraInfo.height - 1);
+    if(obstacle.distance >= 0.f)
+      obstacle.distance *= newDistance / oldDistance;
+    obstacles.emplace_back(obstacle);
+  }
 }
 
-void RobotDetector::fillChromaThumbnails()
+unsigned RobotDetector::getThumbnailScale() const
 {
-  const auto scale = static_cast<unsigned int>(std::round(std::log2(theECImage.blueChromaticity.width / networkParameters.inputWidth)));
-  ASSERT(scale == static_cast<unsigned int>(std::round(std::log2(theECImage.redChromaticity.width / networkParameters.inputWidth))));
-  ASSERT(theECImage.blueChromaticity.width == theECImage.redChromaticity.width);
-  ASSERT(theECImage.blueChromaticity.width == static_cast<unsigned>(networkParameters.inputWidth) << scale);
-  ASSERT(theECImage.blueChromaticity.height == theECImage.redChromaticity.height);
-  ASSERT(theECImage.blueChromaticity.height == static_cast<unsigned>(networkParameters.inputHeight) << scale);
-  STOPWATCH("module:RobotDetector:shrinkBlueChroma") Resize::shrinkY(scale, theECImage.blueChromaticity, redChromaThumbnail);
-  STOPWATCH("module:RobotDetector:shrinkRedChroma") Resize::shrinkY(scale, theECImage.redChromaticity, blueChromaThumbnail);
-  ASSERT(networkParameters.inputWidth == redChromaThumbnail.width);
-  ASSERT(networkParameters.inputWidth == blueChromaThumbnail.width);
-  ASSERT(networkParameters.inputHeight == redChromaThumbnail.height);
-  ASSERT(networkParameters.inputHeight == blueChromaThumbnail.height);
-  SEND_DEBUG_IMAGE("RedChromaThumbnail", redChromaThumbnail);
-  SEND_DEBUG_IMAGE("BlueChromaThumbnail", blueChromaThumbnail);
+  const auto scale = static_cast<unsigned int>(std::round(std::log2(theECImage.grayscaled.width / networkParameters.inputWidth)));
+  ASSERT(theECImage.grayscaled.width == static_cast<unsigned>(networkParameters.inputWidth) << scale);
+  ASSERT(theECImage.grayscaled.height == static_cast<unsigned>(networkParameters.inputHeight) << scale);
+  ASSERT(theImagePyramid.hasLevel(scale, networkParameters.inputChannels == 3));
+  return scale;
 }
 
 void RobotDetector::applyGrayscaleNetwork()
 {
   ASSERT(networkParameters.inputChannels == 1);
-  fillGrayscaleThumbnail();
+  const Image<PixelTypes::GrayscaledPixel>& grayscaleThumbnail = theImagePyramid.getGrayscaled(getThumbnailScale());
+  ASSERT(networkParameters.inputWidth == grayscaleThumbnail.width);
+  ASSERT(networkParameters.inputHeight == grayscaleThumbnail.height);
+  SEND_DEBUG_IMAGE("GrayscaleThumbnail", grayscaleThumbnail);
 
+  // Copy image into input of the model, because it is normalized in place
+  unsigned char* input;
   if(useOnnx)
   {
-    // Copy image into input of the model
-    std::memcpy(reinterpret_cast<unsigned char*>(onnxConvModel.input(0).data()), grayscaleThumbnail[0], grayscaleThumbnail.width * grayscaleThumbnail.height * sizeof(unsigned char));
-
-    STOPWATCH("module:RobotDetector:normalizeContrast") PatchUtilities::normalizeContrast<unsigned char>(
-          reinterpret_cast<unsigned char*>(onnxConvModel.input(0).data()), inputImageSize, 0.02f);
-    STOPWATCH("module:RobotDetector:apply") onnxConvModel.apply();
+    onnxConvModel.setInput(0, nullptr);
+    input = reinterpret_cast<unsigned char*>(onnxConvModel.input(0).data());
   }
   else
-  {
-    // Copy image into input of the model
-    std::memcpy(reinterpret_cast<unsigned char*>(cnnConvModel.input(0).data()), grayscaleThumbnail[0], grayscaleThumbnail.width * grayscaleThumbnail.height * sizeof(unsigned char));
+    input = reinterpret_cast<unsigned char*>(cnnConvModel.input(0).data());
+  std::memcpy(input, grayscaleThumbnail[0], grayscaleThumbnail.width * grayscaleThumbnail.height * sizeof(unsigned char));
 
-    STOPWATCH("module:RobotDetector:normalizeContrast") PatchUtilities::normalizeContrast<unsigned char>(
-          reinterpret_cast<unsigned char*>(cnnConvModel.input(0).data()), inputImageSize, 0.02f);
+  STOPWATCH("module:RobotDetector:normalizeContrast") PatchUtilities::normalizeContrast<unsigned char>(input, inputImageSize, 0.02f);
+  if(useOnnx)
+    STOPWATCH("module:RobotDetector:apply") onnxConvModel.apply();
+  else
     STOPWATCH("module:RobotDetector:apply") cnnConvModel.apply();
-  }
 }
 
 void RobotDetector::applyColorNetwork()
 {
   ASSERT(networkParameters.inputChannels == 3);
-  fillGrayscaleThumbnail();
-  fillChromaThumbnails();
+  const unsigned scale = getThumbnailScale();
+  const Image<PixelTypes::GrayscaledPixel>& grayscaleThumbnail = theImagePyramid.getGrayscaled(scale);
+  const Image<PixelTypes::GrayscaledPixel>& blueChromaThumbnail = theImagePyramid.getBlueChromaticity(scale);
+  const Image<PixelTypes::GrayscaledPixel>& redChromaThumbnail = theImagePyramid.getRedChromaticity(scale);
+  ASSERT(networkParameters.inputWidth == grayscaleThumbnail.width);
+  ASSERT(networkParameters.inputHeight == grayscaleThumbnail.height);
+  SEND_DEBUG_IMAGE("GrayscaleThumbnail", grayscaleThumbnail);
+  SEND_DEBUG_IMAGE("BlueChromaThumbnail", blueChromaThumbnail);
+  SEND_DEBUG_IMAGE("RedChromaThumbnail", redChromaThumbnail);
 
-  PixelTypes::GrayscaledPixel* yPos = grayscaleThumbnail[0];
-  PixelTypes::GrayscaledPixel* uPos = redChromaThumbnail[0];
-  PixelTypes::GrayscaledPixel* vPos = blueChromaThumbnail[0];
+  // The network was trained with the blue chromaticity as second and the red chromaticity as third channel.
+  const PixelTypes::GrayscaledPixel* yPos = grayscaleThumbnail[0];
+  const PixelTypes::GrayscaledPixel* uPos = blueChromaThumbnail[0];
+  const PixelTypes::GrayscaledPixel* vPos = redChromaThumbnail[0];
   PixelTypes::GrayscaledPixel* inputPos;
   if(useOnnx)
+  {
+    onnxConvModel.setInput(0, nullptr);
     inputPos = reinterpret_cast<PixelTypes::GrayscaledPixel*>(onnxConvModel.input(0).data());
+  }
   else
     inputPos = reinterpret_cast<PixelTypes::GrayscaledPixel*>(cnnConvModel.input(0).data());
 
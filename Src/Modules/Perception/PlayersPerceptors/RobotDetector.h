@@ -22,6 +22,9 @@
 #include "Representations/Perception/ImagePreprocessing/ECImage.h"
 #include "Representations/Perception/ImagePreprocessing/FieldBoundary.h"
 #include "Representations/Perception/ImagePreprocessing/ImageCoordinateSystem.h"
+#include "Representations/Perception/ImagePreprocessing/ImagePatches.h"
+#include "Representations/Perception/ImagePreprocessing/ImagePyramid.h"
+#include "Representations/Perception/ImagePreprocessing/PerceptionAttention.h"
 #include "Representations/Perception/ObstaclesPercepts/JerseyClassifier.h"
 #include "Representations/Perception/ObstaclesPercepts/ObstaclesFieldPercept.h"
 #include "Representations/Perception/ObstaclesPercepts/ObstaclesImagePercept.h"
@@ -73,6 +76,7 @@ MODULE(RobotDetector,
   REQUIRES(ECImage),
   REQUIRES(FieldBoundary),
   REQUIRES(ImageCoordinateSystem),
+  REQUIRES(ImagePyramid),
   REQUIRES(JerseyClassifier),
   REQUIRES(MeasurementCovariance),
   REQUIRES(MotionInfo),
@@ -81,15 +85,19 @@ MODULE(RobotDetector,
   REQUIRES(OptionalImageRequest),
   REQUIRES(OtherObstaclesPerceptorData),
   REQUIRES(OtherOdometryData),
+  REQUIRES(PerceptionAttention),
   PROVIDES(ObstaclesFieldPercept),
   PROVIDES(ObstaclesImagePercept),
   USES(ObstaclesPerceptorData),
   PROVIDES(ObstaclesPerceptorData),
+  PROVIDES_LAZY(RobotPatches),
   DEFINES_PARAMETERS(
   {,
     (float)(0.6f) objectThres, /**< Limit from which a robot is accepted. */
     (float)(0.55f) fallenThres, /**< Confidence threshold for a robot to be predicted as lying on the ground */
     (float)(0.3f) nonMaximumSuppressionIoUThreshold, /**< Suppress non-maximal robot predictions with intersection over union above this threshold */
+    (bool)(false) useSoftNonMaximumSuppression, /**< Reduce the confidences of overlapping robot predictions instead of suppressing them. */
+    (float)(0.5f) softNonMaximumSuppressionSigma, /**< The variance of the Gaussian of the intersection over union by which soft non-maximum suppression reduces the confidences. */
     (unsigned int)(2) xyStep, /**< Step size in x/y direction for scanning the image. */
     (unsigned int)(16) xyRegions, /**< Number of regions in x/y direction. */
     (short)(40) minContrastDiff, /**< Minimal contrast difference to consider a spot. */
@@ -105,6 +113,8 @@ MODULE(RobotDetector,
     (bool)(true) mergeLowerObstacles, /**< Whether overlapping obstacles should be merged (only for the lower camera). */
     (Vector2f)(0.02f, 0.04f) pRobotRotationDeviationInStand, /**< Deviation of the rotation of the robot's torso while standing. */
     (Vector2f)(0.04f, 0.04f) pRobotRotationDeviation,        /**< Deviation of the rotation of the robot's torso. */
+    (unsigned)(1) networkPeriod, /**< The network is applied every that many frames. In between, its detections are predicted using odometry (1: every frame). */
+    (int)(32) robotPatchSize, /**< The width and height of the patches of the robots detected that are provided for logging. */
   }),
 });
 
@@ -116,18 +126,24 @@ public:
 private:
   Vector2i inputImageSize;
   // Double structure to allow switching between CompiledNN- and ONNX models. Only one of each set will be used at a time.
-  std::unique_ptr<NeuralNetwork::Model> cnnModel;
+  std::shared_ptr<const NeuralNetwork::Model> cnnModel;
   NeuralNetwork::CompiledNN cnnConvModel;
-  std::unique_ptr<NeuralNetworkONNX::Model> onnxModel;
+  std::shared_ptr<const NeuralNetworkONNX::Model> onnxModel;
   NeuralNetworkONNX::CompiledNN onnxConvModel;
   bool useOnnx;
-  Image<PixelTypes::GrayscaledPixel> grayscaleThumbnail;
-  // Splitting into three images and recombining them into one is probably a performance issue
-  // We need to optimize this later
-  Image<PixelTypes::GrayscaledPixel> redChromaThumbnail;
-  Image<PixelTypes::GrayscaledPixel> blueChromaThumbnail;
   std::vector<ObstaclesImagePercept::Obstacle> obstaclesUpper, obstaclesLower;
 
+  /** A robot detected by the network, stored to predict it in frames in which the network is not applied. */
+  struct TrackedObstacle
+  {
+    ObstaclesImagePercept::Obstacle obstacle; /**< The obstacle as detected by the network. */
+    Vector2f leftOnField; /**< The lower left corner relative to the robot when it was detected. */
+    Vector2f rightOnField; /**< The lower right corner relative to the robot when it was detected. */
+  };
+  std::vector<TrackedObstacle> trackedObstacles; /**< The obstacles found the last time the network was applied. */
+  Pose2f odometryAtDetection; /**< The odometry when the network was applied the last time. */
+  unsigned framesSinceNetwork = 0; /**< The number of frames since the network was applied the last time. */
+
   // todo: move model_path into the config or extract config_path from model_path
   const std::string model_path = "/Config/NeuralNets/RobotDetector/4_anchor_boxes_model_no_activation_20230629-220730.hdf5";
   const std::string model_config_path = "NeuralNets/RobotDetector/4_anchor_boxes_20230629-220730.cfg";
@@ -172,7 +188,7 @@ private:
    * @param settings settings for inference
    */
   template<typename Model, typename ConvModel, typename CompilationSettings>
-  void initializeModel(const std::unique_ptr<Model>& model, ConvModel& convModel, const CompilationSettings& settings);
+  void initializeModel(const std::shared_ptr<const Model>& model, ConvModel& convModel, const CompilationSettings& settings);
 
   /**
    * This method is called when the representation provided needs to be updated.
@@ -192,6 +208,12 @@ private:
    */
   void update(ObstaclesPerceptorData& theObstaclesPerceptorData) override;
 
+  /**
+   * Provides the patches of the robots detected in the current image.
+   * @param theRobotPatches The representation updated.
+   */
+  void update(RobotPatches& theRobotPatches) override;
+
   /**
    * Apply a network to extract obstacles from the image.
    * @param obstacles list of obstacle percepts to be updated
@@ -199,16 +221,24 @@ private:
   void extractImageObstaclesFromNetwork(std::vector<ObstaclesImagePercept::Obstacle>& obstacles);
 
   /**
-   * Fill the Y-Thumbnail image with a downscaled grayscale image.
+   * Stores the obstacles detected by the network together with their positions on the field.
+   * @param obstacles The obstacles detected in the current image.
+   */
+  void trackObstacles(const std::vector<ObstaclesImagePercept::Obstacle>& obstacles);
+
+  /**
+   * Predicts where the obstacles found by the network the last time appear in the current image.
+   * Their positions on the field are moved by the odometry since then and projected into the image.
+   * Their height in the image is scaled by the ratio of the old and the new distance.
+   * @param obstacles The list the predicted obstacles are added to.
+   */
+  void predictObstacles(std::vector<ObstaclesImagePercept::Obstacle>& obstacles) const;
+
+  /**
+   * Determines the level of the image pyramid that matches the input size of the network.
+   * @return How often the ECImage must be halved to obtain the network input size.
    */
-   void fillGrayscaleThumbnail();
-
-   /**
-    * Fill the redChroma- and V-Thumbnail images with downscale images of the same size as the grayscale thumbnail.
-    * First subsamples from the CameraImage to obtain the same resolution vertically and horizontally.
-    * Then downscales to the expected input size.
-    */
-   void fillChromaThumbnails();
+  unsigned getThumbnailScale() const;
 
   /**
    * Applies the cnnConvModel on the downscaled grayscale image.
@@ -33,7 +33,7 @@ void KeypointsProvider::update(Keypoints& theKeypoints)
   DECLARE_DEBUG_DRAWING("module:KeypointsProvider:mask:rows", "drawingOnImage");
   DECLARE_DEBUG_RESPONSE("debug images:module:KeypointsProvider:patch");
 
-  if(!theOptionalCameraImage.image.has_value())
+  if(!theOptionalCameraImage.image)
   {
     FOREACH_ENUM(Keypoints::Keypoint, keypoint)
       theKeypoints.points[keypoint].valid = false;
@@ -47,11 +47,12 @@ void KeypointsProvider::update(Keypoints& theKeypoints)
 #endif
   }
 
-  const CameraImage& theCameraImage = theOptionalCameraImage.image.value();
+  const CameraImage& theCameraImage = *theOptionalCameraImage.image;
   const unsigned centerX = theCameraImage.width;
   const unsigned centerY = patchAtTop ? patchSize / 2 : theCameraImage.height / 2;
 
-  if(mask.empty() || (theRobotPose.translation - lastRobotPosition).norm() > maskRecomputeThreshold)
+  const bool recomputeMask = mask.empty() || (theRobotPose.translation - lastRobotPosition).norm() > maskRecomputeThreshold;
+  if(recomputeMask)
   {
     createMask(centerX, centerY, patchSize, patchSize, detector.input(0).dims(0), detector.input(0).dims(1));
     lastRobotPosition = theRobotPose.translation;
@@ -67,6 +68,20 @@ void KeypointsProvider::update(Keypoints& theKeypoints)
   theKeypoints.patchBoundary = Boundaryi(Rangei(centerX - width / 2, centerX + width / 2),
                                          Rangei(centerY - height / 2, centerY + height / 2));
 
+  // The referee hardly moves during standby. Therefore, the network is only run every
+  // standbyNetworkPeriod frames and the keypoints are extrapolated in between, as long
+  // as neither the patch nor its mask changed.
+  if(framesSinceNetwork >= 0)
+    ++framesSinceNetwork;
+  if(theGameState.state == GameState::standby && !recomputeMask
+     && framesSinceNetwork > 0 && framesSinceNetwork < standbyNetworkPeriod)
+  {
+    extrapolateKeypoints(theKeypoints);
+    return;
+  }
+  framesBetweenNetworkRuns = framesSinceNetwork;
+  framesSinceNetwork = 0;
+
   STOPWATCH("module:KeypointsProvider:extractPatch")
   {
     // Extract image data from a centered patch and copy it to network input.
@@ -113,6 +128,8 @@ void KeypointsProvider::update(Keypoints& theKeypoints)
                               centerY + (output.y - 0.5f) * height);
     point.valid = output.confidence >= minConfidence;
   }
+  previousNetworkPoints = networkPoints;
+  networkPoints = theKeypoints.points;
 
   // The image mask.
   COMPLEX_DRAWING("module:KeypointsProvider:mask")
@@ -144,6 +161,19 @@ void KeypointsProvider::update(Keypoints& theKeypoints)
   }
 }
 
+void KeypointsProvider::extrapolateKeypoints(Keypoints& theKeypoints) const
+{
+  const float factor = framesBetweenNetworkRuns > 0 ? static_cast<float>(framesSinceNetwork) / static_cast<float>(framesBetweenNetworkRuns) : 0.f;
+  FOREACH_ENUM(Keypoints::Keypoint, keypoint)
+  {
+    const Keypoints::Point& point = networkPoints[keypoint];
+    const Keypoints::Point& previousPoint = previousNetworkPoints[keypoint];
+    theKeypoints.points[keypoint] = point;
+    if(point.valid && previousPoint.valid)
+      theKeypoints.points[keypoint].position += (point.position - previousPoint.position) * factor;
+  }
+}
+
 void KeypointsProvider::compileNetwork()
 {
   NeuralNetworkONNX::CompilationSettings settings;
@@ -156,7 +186,7 @@ void KeypointsProvider::compileNetwork()
 void KeypointsProvider::createMask(const unsigned centerX, const unsigned centerY,
                                    const int height, const int width, const int patchHeight, const int patchWidth)
 {
-  const CameraImage& theCameraImage = theOptionalCameraImage.image.value();
+  const CameraImage& theCameraImage = *theOptionalCameraImage.image;
   const Vector2f refereeOnField(theFieldDimensions.xPosHalfwayLine,
                                 (theFieldDimensions.yPosLeftTouchline + theFieldDimensions.yPosLeftFieldBorder) / 2.f
                                 * (theGameState.leftHandTeam ? 1 : -1));
@@ -211,7 +241,7 @@ void KeypointsProvider::applyMask(const int patchHeight, const int patchWidth, f
 void KeypointsProvider::extractPatch1to1(const unsigned centerX, const unsigned centerY,
                                          const int height, const int width, float* channel) const
 {
-  const CameraImage& theCameraImage = theOptionalCameraImage.image.value();
+  const CameraImage& theCameraImage = *theOptionalCameraImage.image;
   for(unsigned y = centerY - height / 2; y < centerY + height / 2; ++y)
     for(const CameraImage::PixelType* pixel = &theCameraImage[y][centerX / 2 - width / 4],
         *pixelEnd = pixel + width / 2; pixel < pixelEnd; ++pixel)
@@ -232,7 +262,7 @@ void KeypointsProvider::extractPatch1to1(const unsigned centerX, const unsigned
 void KeypointsProvider::extractPatch2to1(const unsigned centerX, const unsigned centerY,
                                          const int height, const int width, float* channel) const
 {
-  const CameraImage& theCameraImage = theOptionalCameraImage.image.value();
+  const CameraImage& theCameraImage = *theOptionalCameraImage.image;
   for(unsigned y = centerY - height / 2; y < centerY + height / 2; y += 2)
     for(const CameraImage::PixelType* pixel = &theCameraImage[y][centerX / 2 - width / 4],
         *pixelEnd = pixel + width / 2; pixel < pixelEnd; ++pixel)
@@ -248,7 +278,7 @@ void KeypointsProvider::extractPatch2to1(const unsigned centerX, const unsigned
 void KeypointsProvider::extractPatch3to2(const unsigned centerX, const unsigned centerY,
                                          const int height, const int width, float* channel) const
 {
-  const CameraImage& theCameraImage = theOptionalCameraImage.image.value();
+  const CameraImage& theCameraImage = *theOptionalCameraImage.image;
   for(unsigned y = centerY - height / 2; y < centerY + height / 2; y += 3)
   {
     for(const CameraImage::PixelType* pixel = &theCameraImage[y][centerX / 2 - width / 4],
@@ -36,6 +36,7 @@ MODULE(KeypointsProvider,
     (int) maskWidth, /**< Width of a centered column in the image not to mask out (for observer distance of 3 m ). */
     (float) maskRecomputeThreshold, /**< If the robot's position changed more than this threshold, the masks is recomputed (in mm). */
     (float) minConfidence, /**< Minimum confidence required to accept a keypoint as valid. */
+    (int) standbyNetworkPeriod, /**< During standby, the network is only run every this many frames. */
   }),
 });
 
@@ -52,6 +53,10 @@ class KeypointsProvider : public KeypointsProviderBase
   NeuralNetworkONNX::CompiledNN detector; /**< The network that detects keypoints. */
   std::vector<Rangei> mask; /**< The x ranges to keep (max exclusive) per network input row. */
   Vector2f lastRobotPosition = Vector2f::Zero(); /**< The last position of the robot when this module was used. */
+  int framesSinceNetwork = -1; /**< The number of frames since the network was run the last time (-1: never). */
+  int framesBetweenNetworkRuns = -1; /**< The number of frames between the last two network runs (-1: unknown). */
+  ENUM_INDEXED_ARRAY(Keypoints::Point, Keypoints::Keypoint) networkPoints; /**< The keypoints detected by the last network run. */
+  ENUM_INDEXED_ARRAY(Keypoints::Point, Keypoints::Keypoint) previousNetworkPoints; /**< The keypoints detected by the network run before. */
 
   /**
    * This method is called when the representation provided needs to be updated.
@@ -59,6 +64,13 @@ class KeypointsProvider : public KeypointsProviderBase
    */
   void update(Keypoints& theKeypoints) override;
 
+  /**
+   * Extrapolates the keypoints of the last two network runs linearly to the
+   * current frame. Keypoints only detected in the last run are kept as they are.
+   * @param theKeypoints The representation updated.
+   */
+  void extrapolateKeypoints(Keypoints& theKeypoints) const;
+
   /** Compiles the neural network. */
   void compileNetwork();
 
@@ -31,7 +31,7 @@ void RefereeGestureDetection::update(RefereePercept& theRefereePercept)
   DEBUG(DECLARE_DEBUG_RESPONSE("debug data:module:RefereeGestureDetection:checks");
         DECLARE_DEBUG_RESPONSE("debug data:module:RefereeGestureDetection:history"));
 
-  if(!theOptionalCameraImage.image.has_value())
+  if(!theOptionalCameraImage.image)
   {
     theRefereePercept.gesture = RefereePercept::none;
     history.clear();
@@ -68,8 +68,8 @@ bool RefereeGestureDetection::crossesMiddle() const
   FOREACH_ENUM(Keypoints::Keypoint, keypoint)
     if(theKeypoints.points[keypoint].valid)
     {
-      isLeft |= theKeypoints.points[keypoint].position.x() < theOptionalCameraImage.image.value().width;
-      isRight |= theKeypoints.points[keypoint].position.x() >= theOptionalCameraImage.image.value().width;
+      isLeft |= theKeypoints.points[keypoint].position.x() < theOptionalCameraImage.image->width;
+      isRight |= theKeypoints.points[keypoint].position.x() >= theOptionalCameraImage.image->width;
     }
   return isLeft && isRight;
 }
@@ -1,38 +1,83 @@
 /**
  * The file implements a module that provides the description of a grid for scanning
- * the image. The grid resolution adapts to the camera perspective.
+ * the image. The grid resolution adapts to the camera perspective and to where
+ * the ball is expected.
  * @author Thomas Röfer
  * @author Lukas Malte Monnerjahn
  */
 
 #include "ScanGridProvider.h"
+#include "Debugging/Plot.h"
 #include "Tools/Math/Projection.h"
 #include "Tools/Math/Transformation.h"
 #include <algorithm>
 #include <cmath>
+#include <numeric>
 
 MAKE_MODULE(ScanGridProvider);
 
 void ScanGridProvider::update(ScanGrid& scanGrid)
 {
+  DECLARE_PLOT("module:ScanGridProvider:scannedPixels");
+
   scanGrid.clear();
 
   if(!theCameraMatrix.isValid || !theFieldBoundary.isValid)
     return; // Cannot compute grid without camera matrix
 
-  scanGrid.fieldLimit = calcFieldLimit();
-  if(scanGrid.fieldLimit < 0)
+  if(!isGeometryValid())
+    calcGeometry();
+  if(!geometry.valid)
+    return;
+
+  scanGrid.fieldLimit = geometry.fieldLimit;
+  scanGrid.fullResY = geometry.fullResY;
+  setLowResHorizontalLines(scanGrid);
+  setVerticalLines(scanGrid);
+
+  PLOT("module:ScanGridProvider:scannedPixels", std::accumulate(scanGrid.verticalLines.begin(), scanGrid.verticalLines.end(), 0,
+                                                                [](int sum, const ScanGrid::Line& line) {return sum + line.yMax - line.yMin;}));
+}
+
+bool ScanGridProvider::isGeometryValid() const
+{
+  return geometry.width == theCameraInfo.width && geometry.height == theCameraInfo.height
+         && geometry.level == thePerceptionQuality.level
+         && (geometry.cameraMatrix.translation - theCameraMatrix.translation).norm() <= maxTranslationChange
+         && Eigen::AngleAxisf(geometry.cameraMatrix.rotation.transpose() * theCameraMatrix.rotation).angle() <= maxRotationChange;
+}
+
+void ScanGridProvider::calcGeometry()
+{
+  geometry.cameraMatrix = theCameraMatrix;
+  geometry.width = theCameraInfo.width;
+  geometry.height = theCameraInfo.height;
+  geometry.level = thePerceptionQuality.level;
+  geometry.valid = false;
+  geometry.fullResY.clear();
+  geometry.lowResY.clear();
+  geometry.x.clear();
+  geometry.yMax.clear();
+  geometry.onlyForDistantBalls.clear();
+
+  // Scan less densely if computing time is short.
+  verticalStepSize = static_cast<int>(static_cast<float>(minVerticalStepSize) * stepSizeFactors[thePerceptionQuality.level]);
+  horizontalLowResStepSize = static_cast<int>(static_cast<float>(minHorizontalLowResStepSize) * stepSizeFactors[thePerceptionQuality.level]);
+
+  geometry.fieldLimit = calcFieldLimit();
+  if(geometry.fieldLimit < 0)
     return;
 
   ImageCornersOnField lowerImageCornersOnField = calcImageCornersOnField(VerticalBoundary::LOWER);
   if(!lowerImageCornersOnField.valid)
     return; // Cannot project lower image border to field -> no grid
 
-  setFullResY(scanGrid, lowerImageCornersOnField);
-  if(!scanGrid.fullResY.empty())
+  setFullResY(lowerImageCornersOnField);
+  if(!geometry.fullResY.empty())
   {
-    setLowResHorizontalLines(scanGrid);
-    setVerticalLines(scanGrid, lowerImageCornersOnField);
+    setLowResY();
+    setVerticalLinesGeometry(lowerImageCornersOnField);
+    geometry.valid = true;
   }
 }
 
@@ -66,16 +111,16 @@ ScanGridProvider::ImageCornersOnField ScanGridProvider::calcImageCornersOnField(
   return imageCornersOnField;
 }
 
-void ScanGridProvider::setFullResY(ScanGrid& scanGrid, ScanGridProvider::ImageCornersOnField& lowerImageCornersOnField) const
+void ScanGridProvider::setFullResY(ScanGridProvider::ImageCornersOnField& lowerImageCornersOnField)
 {
   Vector2f verticalViewCenterPointOnField = (lowerImageCornersOnField.leftOnField + lowerImageCornersOnField.rightOnField) / 2.f;
-  scanGrid.fullResY.reserve(theCameraInfo.height);
+  geometry.fullResY.reserve(theCameraInfo.height);
   const float fieldStep = theFieldDimensions.fieldLinesWidth * lineWidthRatio;
   bool singleSteps = false;
   int y;
-  for(y = theCameraInfo.height - 1; y > scanGrid.fieldLimit;)
+  for(y = theCameraInfo.height - 1; y > geometry.fieldLimit;)
   {
-    scanGrid.fullResY.emplace_back(y);
+    geometry.fullResY.emplace_back(y);
     if(singleSteps)
       --y;
     else
@@ -89,42 +134,42 @@ void ScanGridProvider::setFullResY(ScanGrid& scanGrid, ScanGridProvider::ImageCo
       singleSteps = y2 - 1 == y;
     }
   }
-  if(y < 0 && !scanGrid.fullResY.empty() && scanGrid.fullResY.back() != 0)
-    scanGrid.fullResY.emplace_back(0);
+  if(y < 0 && !geometry.fullResY.empty() && geometry.fullResY.back() != 0)
+    geometry.fullResY.emplace_back(0);
 }
 
-void ScanGridProvider::setLowResHorizontalLines(ScanGrid& scanGrid) const
+void ScanGridProvider::setLowResY()
 {
-  scanGrid.lowResHorizontalLines.reserve((theCameraInfo.height / minHorizontalLowResStepSize) + 1);
+  geometry.lowResY.reserve((theCameraInfo.height / horizontalLowResStepSize) + 1);
   bool minSteps = false;
   size_t fullResIndex = 0;
-  for(int y = scanGrid.fullResY[fullResIndex]; y > scanGrid.fieldLimit;)
+  for(int y = geometry.fullResY[fullResIndex]; y > geometry.fieldLimit;)
   {
-    addLowResHorizontalLine(scanGrid, y);
+    geometry.lowResY.emplace_back(y);
     if(minSteps)
-      y -= minHorizontalLowResStepSize;
+      y -= horizontalLowResStepSize;
     else
     {
       ++fullResIndex;
-      if(fullResIndex >= scanGrid.fullResY.size())
+      if(fullResIndex >= geometry.fullResY.size())
         break;
       const int y2 = y;
-      y = std::min(y2 - minHorizontalLowResStepSize, scanGrid.fullResY[fullResIndex]);
-      minSteps = y2 - minHorizontalLowResStepSize == y;
+      y = std::min(y2 - horizontalLowResStepSize, geometry.fullResY[fullResIndex]);
+      minSteps = y2 - horizontalLowResStepSize == y;
     }
   }
 }
 
-void ScanGridProvider::setVerticalLines(ScanGrid& scanGrid, ImageCornersOnField& lowerImageCornersOnField) const
+void ScanGridProvider::setVerticalLinesGeometry(ImageCornersOnField& lowerImageCornersOnField)
 {
   // Determine the maximum distance between scan lines at the bottom of the image not to miss the ball.
-  const int xStepUpperBound = theCameraInfo.width / minNumOfLowResScanLines;
+  const int xStepUpperBound = static_cast<int>(static_cast<float>(theCameraInfo.width / minNumOfLowResScanLines) * stepSizeFactors[thePerceptionQuality.level]);
   const int maxXStep = std::min(xStepUpperBound,
                                 static_cast<int>(static_cast<float>(theCameraInfo.width) * theBallSpecification.radius * 2.f *
                                                  ballWidthRatio / (lowerImageCornersOnField.leftOnField - lowerImageCornersOnField.rightOnField).norm()));
 
-  // Determine the maximum distance between scan lines at the top of the image not to miss the ball. Do not go below minVerticalStepSize.
-  int minXStep = minVerticalStepSize;
+  // Determine the maximum distance between scan lines at the top of the image not to miss the ball. Do not go below verticalStepSize.
+  int minXStep = verticalStepSize;
   ImageCornersOnField upperImageCornersOnField = calcImageCornersOnField(VerticalBoundary::UPPER);
   if(upperImageCornersOnField.valid)
   {
@@ -158,18 +203,53 @@ void ScanGridProvider::setVerticalLines(ScanGrid& scanGrid, ImageCornersOnField&
     for(size_t j = 0; j < yStarts2.size(); j += step)
       yStarts2[j] = yStarts[i];
 
-  // Initialize the scan states and the regions.
+  // Initialize the scan lines. Every second line in the pattern (if there are several
+  // lengths) only has the shortest length, i.e. it is only needed for distant balls.
   const int xStart = theCameraInfo.width % (theCameraInfo.width / minXStep - 1) / 2;
-  scanGrid.verticalLines.reserve((theCameraInfo.width - xStart) / minXStep);
+  const std::size_t numOfLines = (theCameraInfo.width - xStart + minXStep - 1) / minXStep;
+  geometry.x.reserve(numOfLines);
+  geometry.yMax.reserve(numOfLines);
+  geometry.onlyForDistantBalls.reserve(numOfLines);
   size_t i = yStarts2.size() / 2; // Start with the second-longest scan line.
   for(int x = xStart; x < theCameraInfo.width; x += minXStep)
   {
+    geometry.x.emplace_back(x);
+    geometry.yMax.emplace_back(std::min(yStarts2[i], theCameraInfo.height));
+    geometry.onlyForDistantBalls.emplace_back(yStarts2.size() > 1 && i % 2 == 1);
+    ++i;
+    i %= yStarts2.size();
+  }
+
+  // Set low resolution scan line info
+  geometry.lowResStep = maxXStep2 / minXStep;
+}
+
+void ScanGridProvider::setLowResHorizontalLines(ScanGrid& scanGrid) const
+{
+  scanGrid.lowResHorizontalLines.reserve(geometry.lowResY.size());
+  for(int y : geometry.lowResY)
+    addLowResHorizontalLine(scanGrid, y);
+}
+
+void ScanGridProvider::setVerticalLines(ScanGrid& scanGrid) const
+{
+  // If the ball is expected in the image, the lines only needed for distant balls are only scanned around it.
+  const bool focusOnBall = focusOnPredictedBall && thePerceptionAttention.ballPredicted;
+  const float ballSurrounding = thePerceptionAttention.ballRadiusInImage * ballSurroundingRatio;
+  const int ballBottom = static_cast<int>(thePerceptionAttention.ballInImage.y() + ballSurrounding);
+
+  scanGrid.verticalLines.reserve(geometry.x.size());
+  for(size_t i = 0; i < geometry.x.size(); ++i)
+  {
+    const int x = geometry.x[i];
+    const bool nearBall = focusOnBall && std::abs(static_cast<float>(x) - thePerceptionAttention.ballInImage.x()) <= ballSurrounding;
     int yMin = std::max(scanGrid.fieldLimit, theFieldBoundary.getBoundaryY(x));
-    int yMax = std::min(yStarts2[i++], theCameraInfo.height);
+    int yMax = nearBall ? std::min(std::max(geometry.yMax[i], ballBottom), theCameraInfo.height) : geometry.yMax[i];
     theBodyContour.clipBottom(x, yMax);
     yMax = std::max(1, yMax);
     yMin = std::min(yMin, yMax - 1);
-    i %= yStarts2.size();
+    if(focusOnBall && !nearBall && geometry.onlyForDistantBalls[i])
+      yMax = yMin + 1;
     const size_t yMaxIndexUpperBound = std::upper_bound(scanGrid.fullResY.cbegin(), scanGrid.fullResY.cend(), yMax, std::greater_equal<>())
         - scanGrid.fullResY.cbegin();
     const size_t yMaxIndex = std::min(yMaxIndexUpperBound, scanGrid.fullResY.size() - 1);
@@ -182,7 +262,7 @@ void ScanGridProvider::setVerticalLines(ScanGrid& scanGrid, ImageCornersOnField&
   }
 
   // Set low resolution scan line info
-  scanGrid.lowResStep = maxXStep2 / minXStep;
+  scanGrid.lowResStep = geometry.lowResStep;
   scanGrid.lowResStart = scanGrid.lowResStep / 2;
 }
 
@@ -1,6 +1,9 @@
 /**
  * The file declares a module that provides the description of a grid for scanning
- * the image. The grid resolution adapts to the camera perspective.
+ * the image. The grid resolution adapts to the camera perspective. The parts of the
+ * grid that only depend on the perspective are reused as long as the camera matrix
+ * does not change noticeably. If the ball is expected in the image, the scan lines
+ * that only exist to find distant balls are only scanned close to the ball.
  * @author Thomas Röfer
  */
 
@@ -10,9 +13,11 @@
 #include "Representations/Configuration/BallSpecification.h"
 #include "Representations/Configuration/FieldDimensions.h"
 #include "Representations/Infrastructure/CameraInfo.h"
+#include "Representations/Infrastructure/PerceptionQuality.h"
 #include "Representations/Perception/ImagePreprocessing/BodyContour.h"
 #include "Representations/Perception/ImagePreprocessing/CameraMatrix.h"
 #include "Representations/Perception/ImagePreprocessing/FieldBoundary.h"
+#include "Representations/Perception/ImagePreprocessing/PerceptionAttention.h"
 #include "Representations/Perception/ImagePreprocessing/ScanGrid.h"
 
 MODULE(ScanGridProvider,
@@ -23,6 +28,8 @@ MODULE(ScanGridProvider,
   REQUIRES(CameraMatrix),
   REQUIRES(FieldDimensions),
   REQUIRES(FieldBoundary),
+  REQUIRES(PerceptionAttention),
+  REQUIRES(PerceptionQuality),
   PROVIDES(ScanGrid),
   DEFINES_PARAMETERS(
   {,
@@ -31,6 +38,11 @@ MODULE(ScanGridProvider,
     (int)(25) minNumOfLowResScanLines, /**< The minimum number of scan lines for low resolution. */
     (float)(0.9f) lineWidthRatio, /**< The ratio of field line width that is sampled when scanning the image. */
     (float)(0.8f) ballWidthRatio, /**< The ratio of ball width that is sampled when scanning the image. */
+    (ENUM_INDEXED_ARRAY(float, PerceptionQuality::Level))({1.f, 1.5f, 2.f}) stepSizeFactors, /**< The minimum step sizes are multiplied by these factors for each perception quality. */
+    (float)(0.001f) maxRotationChange, /**< The camera may rotate by this angle before the grid geometry is recomputed (in radians). */
+    (float)(2.f) maxTranslationChange, /**< The camera may move by this distance before the grid geometry is recomputed (in mm). */
+    (bool)(true) focusOnPredictedBall, /**< Only scan the lines for distant balls near the ball if it is expected in the image? */
+    (float)(3.f) ballSurroundingRatio, /**< The half width of the area around the expected ball that is fully scanned relative to the ball radius. */
   }),
 });
 
@@ -47,8 +59,38 @@ class ScanGridProvider : public ScanGridProviderBase
     LOWER
   };
 
+  /** The parts of the grid that only depend on the camera perspective. */
+  struct Geometry
+  {
+    Pose3f cameraMatrix; /**< The camera matrix the geometry was computed for. */
+    int width = 0; /**< The image width the geometry was computed for. */
+    int height = 0; /**< The image height the geometry was computed for. */
+    PerceptionQuality::Level level = PerceptionQuality::full; /**< The perception quality the geometry was computed for. */
+    bool valid = false; /**< Is there a grid for this perspective? */
+    int fieldLimit = 0; /**< Upper bound for all scan lines (exclusive). */
+    std::vector<int> fullResY; /**< All heights for a full resolution scan. */
+    std::vector<int> lowResY; /**< The heights of the low resolution horizontal scan lines. */
+    std::vector<int> x; /**< The x coordinates of the vertical scan lines. */
+    std::vector<int> yMax; /**< The lower ends of the vertical scan lines according to the perspective (exclusive). */
+    std::vector<bool> onlyForDistantBalls; /**< Are the vertical scan lines only needed to find distant balls? */
+    unsigned lowResStep = 1; /**< Steps between low resolution vertical scan lines. */
+  };
+
+  Geometry geometry; /**< The geometry of the grid of the previous frame. */
+  int verticalStepSize; /**< The minimum pixel distance between two neighboring vertical scan lines in the current frame. */
+  int horizontalLowResStepSize; /**< The minimum pixel distance between two neighboring horizontal scan lines in the current frame. */
+
   void update(ScanGrid& scanGrid) override;
 
+  /**
+   * Can the geometry of the grid of the previous frame be used in this frame?
+   * @return Is the perspective of the camera still similar enough?
+   */
+  bool isGeometryValid() const;
+
+  /** Computes the parts of the grid that only depend on the camera perspective. */
+  void calcGeometry();
+
   /**
    * Compute the furthest point away that could be part of the field given an unknown own position.
    * @return
@@ -57,16 +99,12 @@ class ScanGridProvider : public ScanGridProviderBase
 
   /**
    * Determine vertical sampling points of the grid.
-   * @param scanGrid
    * @param lowerImageCornersOnField
    */
-  void setFullResY(ScanGrid& scanGrid, ImageCornersOnField& lowerImageCornersOnField) const;
+  void setFullResY(ImageCornersOnField& lowerImageCornersOnField);
 
-  /**
-   * Determine vertical sampling points of the grid.
-   * @param scanGrid
-   */
-  void setLowResHorizontalLines(ScanGrid& scanGrid) const;
+  /** Determine the heights of the low resolution horizontal lines of the grid. */
+  void setLowResY();
 
   /**
    *
@@ -76,11 +114,22 @@ class ScanGridProvider : public ScanGridProviderBase
   ImageCornersOnField calcImageCornersOnField(VerticalBoundary boundary) const;
 
   /**
-   *
-   * @param scanGrid
+   * Determine the x coordinates and lengths of the vertical lines of the grid.
    * @param lowerImageCornersOnField
    */
-  void setVerticalLines(ScanGrid& scanGrid, ImageCornersOnField& lowerImageCornersOnField) const;
+  void setVerticalLinesGeometry(ImageCornersOnField& lowerImageCornersOnField);
+
+  /**
+   * Determine the horizontal lines of the grid for the current frame.
+   * @param scanGrid
+   */
+  void setLowResHorizontalLines(ScanGrid& scanGrid) const;
+
+  /**
+   * Determine the vertical lines of the grid for the current frame.
+   * @param scanGrid
+   */
+  void setVerticalLines(ScanGrid& scanGrid) const;
 
   /**
    *
@@ -13,7 +13,10 @@
 #include "Debugging/DebugDrawings.h"
 #include "Tools/Math/Transformation.h"
 #include "Debugging/Annotation.h"
+#include "ImageProcessing/ScanLineSmoothing.h"
 
+#include <algorithm>
+#include <array>
 #include <functional>
 #include <list>
 #include <vector>
@@ -27,18 +30,20 @@ void ScanLineRegionizer::update(ColorScanLineRegionsHorizontal& colorScanLineReg
   DECLARE_DEBUG_DRAWING("module:ScanLineRegionizer:fieldColorRangeHorizontal", "drawingOnImage");
   DECLARE_DEBUG_DRAWING("module:ScanLineRegionizer:whiteRange", "drawingOnImage");
 
-  colorScanLineRegionsHorizontal.scanLines.clear();
-
   if(!theScanGrid.isValid() || !theFieldBoundary.isValid)
+  {
+    colorScanLineRegionsHorizontal.scanLines.clear();
     return;
+  }
 
   // 0. Preprocess
   approximateBaseLuminance();
   approximateBaseSaturation();
 
-  // 1. Define scan-lines
-  std::vector<unsigned short> yPerScanLine;  // heights of the scan-lines in the image
-  std::vector<std::vector<InternalRegion>> regionsPerScanLine;
+  // 1. Define scan-lines. The buffers are kept between frames to avoid allocations.
+  std::vector<unsigned short>& yPerScanLine = horizontalPositions;  // heights of the scan-lines in the image
+  std::vector<std::vector<InternalRegion>>& regionsPerScanLine = horizontalRegions;
+  resetRegions(yPerScanLine, regionsPerScanLine, theScanGrid.lowResHorizontalLines.size());
 
   // find height in image up to which additional smoothing (5x5 filter) will be applied.
   // compute by projecting on-field distance into image
@@ -48,19 +53,19 @@ void ScanLineRegionizer::update(ColorScanLineRegionsHorizontal& colorScanLineReg
                      static_cast<const int>(pointInImage.y()) : theCameraInfo.height - 1;
   LINE("module:ScanLineRegionizer:horizontalRegionSplit", 0, middle, theECImage.grayscaled.width, middle, 3, Drawings::PenStyle::dottedPen, ColorRGBA(80, 6, 80));
 
-  for(const ScanGrid::HorizontalLine& horizontalLine : theScanGrid.lowResHorizontalLines)
+  for(std::size_t i = 0; i < theScanGrid.lowResHorizontalLines.size(); ++i)
   {
-    yPerScanLine.emplace_back(horizontalLine.y);
-    regionsPerScanLine.emplace_back();
+    const ScanGrid::HorizontalLine& horizontalLine = theScanGrid.lowResHorizontalLines[i];
+    yPerScanLine[i] = static_cast<unsigned short>(horizontalLine.y);
 
     // 2. Detect edges and create temporary regions in between including a representative YHS triple.
     if(theCameraInfo.camera == CameraInfo::lower || middle < horizontalLine.y)
     {
-      scanHorizontalAdditionalSmoothing(horizontalLine.y, regionsPerScanLine.back(), horizontalLine.left, horizontalLine.right);
+      scanHorizontalAdditionalSmoothing(horizontalLine.y, regionsPerScanLine[i], horizontalLine.left, horizontalLine.right);
     }
     else
     {
-      scanHorizontal(horizontalLine.y, regionsPerScanLine.back(), horizontalLine.left, horizontalLine.right);
+      scanHorizontal(horizontalLine.y, regionsPerScanLine[i], horizontalLine.left, horizontalLine.right);
     }
   }
 
@@ -85,10 +90,11 @@ void ScanLineRegionizer::update(ColorScanLineRegionsVerticalClipped& colorScanLi
   DECLARE_DEBUG_DRAWING("module:ScanLineRegionizer:fieldColorRangeVertical", "drawingOnImage");
   DECLARE_DEBUG_DRAWING("module:ScanLineRegionizer:whiteRange", "drawingOnImage");
 
-  colorScanLineRegionsVerticalClipped.scanLines.clear();
-
   if(theScanGrid.verticalLines.empty() || theScanGrid.lowResHorizontalLines.empty() || !theFieldBoundary.isValid)
+  {
+    colorScanLineRegionsVerticalClipped.scanLines.clear();
     return;
+  }
 
   colorScanLineRegionsVerticalClipped.lowResStart = theScanGrid.lowResStart;
   colorScanLineRegionsVerticalClipped.lowResStep = theScanGrid.lowResStep;
@@ -98,9 +104,10 @@ void ScanLineRegionizer::update(ColorScanLineRegionsVerticalClipped& colorScanLi
   approximateBaseSaturation();
 
   // 1. Define scan-lines and limit scan-line ranges by field boundary (body contour is already excluded by ScanGrid)
-  const std::size_t numOfScanLines = theScanGrid.verticalLines.size();
-  std::vector<unsigned short> xPerScanLine(numOfScanLines);
-  std::vector<std::vector<InternalRegion>> regionsPerScanLine(numOfScanLines);
+  // The buffers are kept between frames to avoid allocations.
+  std::vector<unsigned short>& xPerScanLine = verticalPositions;
+  std::vector<std::vector<InternalRegion>>& regionsPerScanLine = verticalRegions;
+  resetRegions(xPerScanLine, regionsPerScanLine, theScanGrid.verticalLines.size());
 
   // find height in image up to which additional smoothing (5x5 filter) will be applied.
   // compute by projecting on-field distance into image
@@ -524,11 +531,15 @@ void ScanLineRegionizer::findEdgeInSubLineHorizontal(
 {
   unsigned int edgeXMax = startPos;
   int sobelMax = scanRun.gradient(scanRun.leftGaussBuffer, (filterSize - 1) / 2);
-  const PixelTypes::GrayscaledPixel* luminance = &theECImage.grayscaled[scanRun.scanLinePosition][startPos + 1];
+  std::array<int, 64> smoothed; // Vertically smoothed pixels of the sub line, computed in chunks with SIMD.
   int gaussBufferIndex = 0;
-  for(unsigned int x = startPos + 1; x < stopPos; ++x, ++luminance, ++gaussBufferIndex)
+  for(unsigned int x = startPos + 1; x < stopPos; ++x, ++gaussBufferIndex)
   {
-    scanRun.leftGaussBuffer[gaussBufferIndex % filterSize] = scanRun.gaussV(luminance, theECImage.grayscaled.width);
+    const std::size_t smoothedIndex = (x - startPos - 1) % smoothed.size();
+    if(!smoothedIndex)
+      ScanLineSmoothing::smoothVertically<filterSize>(theECImage.grayscaled, x, scanRun.scanLinePosition,
+                                                      std::min(static_cast<unsigned int>(smoothed.size()), stopPos - x), smoothed.data());
+    scanRun.leftGaussBuffer[gaussBufferIndex % filterSize] = smoothed[smoothedIndex];
     int sobelL = scanRun.gradient(scanRun.leftGaussBuffer, gaussBufferIndex + (filterSize + 1) / 2);
     if((maxEdge && sobelL > sobelMax) || (!maxEdge && sobelL < sobelMax))
     {
@@ -974,12 +985,14 @@ void ScanLineRegionizer::emplaceInScanLineRegionsHorizontal(ColorScanLineRegions
 {
   ASSERT(yPerScanLine.size() == regionsPerScanLine.size());
   const std::size_t numOfScanLines = yPerScanLine.size();
-  colorScanLineRegionsHorizontal.scanLines.reserve(numOfScanLines);
+  // Existing scan lines are reused to keep the memory allocated for their regions.
+  colorScanLineRegionsHorizontal.scanLines.resize(numOfScanLines);
   for(std::size_t i = 0; i < numOfScanLines; ++i)
   {
-    colorScanLineRegionsHorizontal.scanLines.emplace_back(yPerScanLine[i]);
+    colorScanLineRegionsHorizontal.scanLines[i].y = yPerScanLine[i];
     const std::vector<InternalRegion>& regions = regionsPerScanLine[i];
     std::vector<ScanLineRegion>& newRegions = colorScanLineRegionsHorizontal.scanLines[i].regions;
+    newRegions.clear();
     for(std::size_t j = 0; j < regions.size(); ++j)
     {
       // Merge adjacent regions of the same color.
@@ -997,12 +1010,14 @@ void ScanLineRegionizer::emplaceInScanLineRegionsVertical(ColorScanLineRegionsVe
 {
   ASSERT(xPerScanLine.size() == regionsPerScanLine.size());
   std::size_t numOfScanLines = xPerScanLine.size();
-  colorScanLineRegionsVerticalClipped.scanLines.reserve(numOfScanLines);
+  // Existing scan lines are reused to keep the memory allocated for their regions.
+  colorScanLineRegionsVerticalClipped.scanLines.resize(numOfScanLines);
   for(std::size_t i = 0; i < numOfScanLines; ++i)
   {
-    colorScanLineRegionsVerticalClipped.scanLines.emplace_back(xPerScanLine[i]);
+    colorScanLineRegionsVerticalClipped.scanLines[i].x = xPerScanLine[i];
     const std::vector<InternalRegion>& regions = regionsPerScanLine[i];
     std::vector<ScanLineRegion>& newRegions = colorScanLineRegionsVerticalClipped.scanLines[i].regions;
+    newRegions.clear();
     for(std::size_t j = 0; j < regions.size(); ++j)
     {
       // Merge adjacent regions of the same color.
@@ -1014,6 +1029,15 @@ void ScanLineRegionizer::emplaceInScanLineRegionsVertical(ColorScanLineRegionsVe
   }
 }
 
+void ScanLineRegionizer::resetRegions(std::vector<unsigned short>& positions, std::vector<std::vector<InternalRegion>>& regionsPerScanLine,
+                                      std::size_t numOfScanLines)
+{
+  positions.resize(numOfScanLines);
+  regionsPerScanLine.resize(numOfScanLines);
+  for(std::vector<InternalRegion>& regions : regionsPerScanLine)
+    regions.clear();
+}
+
 bool ScanLineRegionizer::isEstimatedFieldColorValid() const
 {
   return theFrameInfo.getTimeSince(estimatedFieldColor.lastSet) <= estimatedFieldColorInvalidationTime;
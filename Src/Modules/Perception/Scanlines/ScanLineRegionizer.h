@@ -411,6 +411,16 @@ class ScanLineRegionizer : public ScanLineRegionizerBase
                                                  const std::vector<unsigned short>& xPerScanLine,
                                                  const std::vector<std::vector<InternalRegion>>& regionsPerScanLine);
 
+  /**
+   * Prepares the buffers of scan line positions and regions for a new frame.
+   * The regions are cleared, but their memory is kept.
+   * @param positions The positions of the scan lines, resized to the number of scan lines.
+   * @param regionsPerScanLine The regions per scan line, resized to the number of scan lines.
+   * @param numOfScanLines The number of scan lines in the current frame.
+   */
+  static void resetRegions(std::vector<unsigned short>& positions, std::vector<std::vector<InternalRegion>>& regionsPerScanLine,
+                           std::size_t numOfScanLines);
+
   /**
    * Checks by timestamp if the EstimatedFieldColor is still presumed valid.
    * @return True, if the EstimatedFieldColor is valid.
@@ -491,4 +501,8 @@ private:
   PixelTypes::GrayscaledPixel baseSaturation; /**< heuristically approximated average saturation of the image.
   * Used as a min luminance threshold for filtering out irrelevant edges and noise */
   EstimatedFieldColor estimatedFieldColor; /**< Field color range estimated for the current image */
+  std::vector<unsigned short> horizontalPositions; /**< The heights of the horizontal scan lines, kept between frames. */
+  std::vector<std::vector<InternalRegion>> horizontalRegions; /**< The regions on the horizontal scan lines, kept between frames. */
+  std::vector<unsigned short> verticalPositions; /**< The x coordinates of the vertical scan lines, kept between frames. */
+  std::vector<std::vector<InternalRegion>> verticalRegions; /**< The regions on the vertical scan lines, kept between frames. */
 };
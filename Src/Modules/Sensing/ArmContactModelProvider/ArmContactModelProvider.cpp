@@ -11,6 +11,7 @@
 #include "Debugging/DebugDrawings.h"
 #include "Debugging/Plot.h"
 #include "Math/Constants.h"
+#include "Tools/Motion/ForwardKinematic.h"
 #include <algorithm>
 #include <cmath>
 
@@ -125,7 +126,7 @@ void ArmContactModelProvider::calculateForce()
 
 Vector3f ArmContactModelProvider::calculateRequestedHandPosition(Arms::Arm arm) const
 {
-  return requestedRobotModel.limbs[arm == Arms::left ? Limbs::wristLeft : Limbs::wristRight].translation;
+  return requestedLimbs[arm == Arms::left ? Limbs::wristLeft : Limbs::wristRight].translation;
 }
 
 void ArmContactModelProvider::update(ArmContactModel& model)
@@ -154,7 +155,8 @@ void ArmContactModelProvider::update(ArmContactModel& model)
   model.status[Arms::left].armOnBack = theArmMotionRequest.armKeyFrameRequest.arms[Arms::left].motion == ArmKeyFrameRequest::ArmKeyFrameId::back && theArmMotionRequest.armMotion[Arms::left] == ArmMotionRequest::ArmRequest::keyFrame;
   model.status[Arms::right].armOnBack = theArmMotionRequest.armKeyFrameRequest.arms[Arms::right].motion == ArmKeyFrameRequest::ArmKeyFrameId::back && theArmMotionRequest.armMotion[Arms::right] == ArmMotionRequest::ArmRequest::keyFrame;
 
-  requestedRobotModel.setJointData(theJointRequest, theRobotDimensions, theMassCalibration);
+  ForwardKinematic::calculateArmChain(Arms::left, theJointRequest, theRobotDimensions, requestedLimbs);
+  ForwardKinematic::calculateArmChain(Arms::right, theJointRequest, theRobotDimensions, requestedLimbs);
 
   angleBuffer[Arms::left].push_front(calculateRequestedHandPosition(Arms::left));
   angleBuffer[Arms::right].push_front(calculateRequestedHandPosition(Arms::right));
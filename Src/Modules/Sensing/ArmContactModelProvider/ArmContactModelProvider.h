@@ -76,7 +76,7 @@ class ArmContactModelProvider: public ArmContactModelProviderBase
   //Timestamp when the arm sound was played last.
   unsigned int lastArmSoundTimestamp = 0;
 
-  RobotModel requestedRobotModel;
+  ENUM_INDEXED_ARRAY(Pose3f, Limbs::Limb) requestedLimbs; /**< The poses of the limbs for the joint request. Only the arm chains are calculated. */
 
   //Buffer of the requested hand positions
   RingBuffer<Vector3f, frameBufferSize> angleBuffer[Arms::numOfArms];
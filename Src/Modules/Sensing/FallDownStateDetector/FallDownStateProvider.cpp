@@ -56,7 +56,14 @@ void FallDownStateProvider::update(FallDownState& fallDownState)
   const Vector3f& comInOrigin = ukf.mean.head<3>();
   torsoUpright = (comInOrigin.head<2>() - supportFootCenter.head<2>()).norm() <= 0.7f * (-supportFootCenter.head<2>()).norm();
   torsoAboveGround = comInOrigin.z();
-  falling = isFalling();
+  timeToFall = predictTimeToFall();
+  fallDownState.timeToFall = timeToFall;
+  const bool wasFallPredicted = fallPredicted;
+  fallPredicted = !torsoUpright && timeToFall >= 0.f && timeToFall < maxTimeToFall
+                  && (fallDownState.state == FallDownState::upright || fallDownState.state == FallDownState::staggering);
+  if(fallPredicted && !wasFallPredicted)
+    ANNOTATION("FallDownStateProvider", "Fall predicted in " << static_cast<int>(timeToFall * 1000.f) << " ms");
+  falling = fallPredicted || isFalling();
 
   stable = std::abs(theSensorData->gyro.x()) <= maxGyroToRegainStableState
            && std::abs(theSensorData->gyro.y()) <= maxGyroToRegainStableState;
@@ -77,6 +84,34 @@ void FallDownStateProvider::update(FallDownState& fallDownState)
   draw();
 }
 
+float FallDownStateProvider::predictTimeToFall() const
+{
+  // Angle and angular velocity of the pendulum in the direction away from the support foot
+  const Vector3f& com = ukf.mean.head<3>();
+  const Vector2f direction = (com.head<2>() - supportFootCenter.head<2>()).normalized();
+  const Vector2f vel(ukf.mean.tail<2>().y(), -ukf.mean.tail<2>().x());
+  const float length = com.norm();
+  if(length <= 0.f || com.z() <= 0.f)
+    return -1.f;
+  const float angle = std::atan2(direction.dot(com.head<2>()), com.z());
+  const float angularVelocity = direction.dot(vel);
+  if(angle >= fallAngle)
+    return 0.f;
+
+  // angle(t) = a * e^(w * t) + b * e^(-w * t) with w = sqrt(g / length)
+  const float w = std::sqrt(Constants::g / length);
+  const float a = (angle + angularVelocity / w) / 2.f;
+  const float b = (angle - angularVelocity / w) / 2.f;
+  if(a <= 0.f)
+    return -1.f;
+
+  // Solve a * y^2 - fallAngle * y + b = 0 for y = e^(w * t). Since angle(0) < fallAngle, the larger root is the crossing.
+  const float discriminant = sqr(static_cast<float>(fallAngle)) - 4.f * a * b;
+  if(discriminant < 0.f)
+    return -1.f;
+  return std::log((fallAngle + std::sqrt(discriminant)) / (2.f * a)) / w;
+}
+
 bool FallDownStateProvider::isFalling() const
 {
   //if the com is within the subSupportPolygon the robot is in a stable position
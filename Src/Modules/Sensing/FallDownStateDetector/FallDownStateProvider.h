@@ -51,6 +51,8 @@ MODULE(FallDownStateProvider,
     (int)(0) minTimeWithoutGroundContactToAssumePickup,
     (Vector2a)(55_deg, 55_deg) minTorsoOrientationToDetermineDirection,
     (int)(5000) maxTimeStaggering, /**< If the robot stays this long staggering, something is wrong and the filter is reset. */
+    (Angle)(20_deg) fallAngle, /**< The angle of the com behind the tilting edge, after which a fall cannot be stopped anymore. */
+    (float)(0.1f) maxTimeToFall, /**< A fall is detected if the predicted time to fall is shorter than this (in s). 0 disables the prediction. */
 
     (Vector3f)(16.f, 16.f, 16.f) positionProcessDeviation, //  dynamic noise density of the com-position
     (Vector2a)(Vector2a::Constant(22_deg)) velocityProcessDeviation, // dynamic noise density of the velocity
@@ -76,6 +78,8 @@ private:
   FallDownState* theFallDownState; /**< Pointer to the fall down state updated.*/
   FallDownState::Direction direction; /**< The fall direction. Always computed, even if not falling. */
   float torsoAboveGround; /**< The distance of the torso above the ground (in mm). */
+  float timeToFall = -1.f; /**< The predicted time until the fall cannot be stopped anymore (in s). Negative if no fall is predicted. */
+  bool fallPredicted = false; /**< Was a fall detected because of the predicted time to fall? */
 
   UKF<5> ukf = UKF<5>(Vector5f::Zero()); // The statevector of the ukf is composed of: com, velocity;
   Vector5f dynamicNoise;
@@ -116,6 +120,15 @@ private:
    */
   std::vector<Vector3f> getConvexHull(std::vector<Vector3f>& polygon) const;
 
+  /**
+   * Predicts the time until the com reaches the fallAngle behind the tilting edge.
+   * The robot is modeled as a linear inverted pendulum rotating around the tilting
+   * edge, for which this time has a closed form solution.
+   * @return The time to fall (in s) or a negative value if the pendulum does not reach
+   *         the fallAngle.
+   */
+  float predictTimeToFall() const;
+
   /**
    * Check if center of mass is outside of the support polygon.
    * @return true, if the robot is falling.
@@ -9,17 +9,6 @@
 
 MAKE_MODULE(IMUValueStateProvider);
 
-IMUValueStateProvider::IMUValueStateProvider()
-{
-  gyroValuesX.clear();
-  gyroValuesY.clear();
-  gyroValuesZ.clear();
-
-  accValuesX.clear();
-  accValuesY.clear();
-  accValuesZ.clear();
-}
-
 void IMUValueStateProvider::update(IMUValueState& imuValueState)
 {
   DECLARE_PLOT("module:IMUValueStateProvider:gyro:deviation:x");
@@ -29,41 +18,17 @@ void IMUValueStateProvider::update(IMUValueState& imuValueState)
   DECLARE_PLOT("module:IMUValueStateProvider:acc:deviation:y");
   DECLARE_PLOT("module:IMUValueStateProvider:acc:deviation:z");
 
-  imuValueState.filterTimeWindow = static_cast<int>(gyroValuesX.capacity() * Constants::motionCycleTime * 1000.f);
+  imuValueState.filterTimeWindow = static_cast<int>(gyroValues.values.capacity() * Constants::motionCycleTime * 1000.f);
 
   // Sampling
-  gyroValuesX.push_front(theRawInertialSensorData.gyro.x());
-  gyroValuesY.push_front(theRawInertialSensorData.gyro.y());
-  gyroValuesZ.push_front(theRawInertialSensorData.gyro.z());
-
-  accValuesX.push_front(theRawInertialSensorData.acc.x());
-  accValuesY.push_front(theRawInertialSensorData.acc.y());
-  accValuesZ.push_front(theRawInertialSensorData.acc.z());
+  gyroValues.push_front(theRawInertialSensorData.gyro.cast<float>());
+  accValues.push_front(theRawInertialSensorData.acc);
 
   // We did enough sampling
-  if(gyroValuesX.full())
+  if(gyroValues.values.full())
   {
-    // calc gyro values
-    // calc for x gyro
-    imuValueState.gyroValues.mean.x() = gyroValuesX.average();
-    imuValueState.gyroValues.deviation.x() = calcDeviation(imuValueState.gyroValues.mean.x(), gyroValuesX);
-    // calc for y gyro
-    imuValueState.gyroValues.mean.y() = gyroValuesY.average();
-    imuValueState.gyroValues.deviation.y() = calcDeviation(imuValueState.gyroValues.mean.y(), gyroValuesY);
-    // calc for z gyro
-    imuValueState.gyroValues.mean.z() = gyroValuesZ.average();
-    imuValueState.gyroValues.deviation.z() = calcDeviation(imuValueState.gyroValues.mean.z(), gyroValuesZ);
-
-    // calc acc values
-    // calc for x acc
-    imuValueState.accValues.mean.x() = accValuesX.average();
-    imuValueState.accValues.deviation.x() = calcDeviation(imuValueState.accValues.mean.x(), accValuesX);
-    // calc for y acc
-    imuValueState.accValues.mean.y() = accValuesY.average();
-    imuValueState.accValues.deviation.y() = calcDeviation(imuValueState.accValues.mean.y(), accValuesY);
-    // calc for z acc
-    imuValueState.accValues.mean.z() = accValuesZ.average();
-    imuValueState.accValues.deviation.z() = calcDeviation(imuValueState.accValues.mean.z(), accValuesZ);
+    gyroValues.getStatistics(imuValueState.gyroValues);
+    accValues.getStatistics(imuValueState.accValues);
 
     imuValueState.timestamp = theFrameInfo.time;
 
@@ -139,15 +104,3 @@ void IMUValueStateProvider::update(IMUValueState& imuValueState)
     imuValueState.accValues.deviationNotChangingSinceTimestamp = theFrameInfo.time;
   }
 }
-
-float IMUValueStateProvider::calcDeviation(const float mean, const RingBufferWithSum<float, 27>& buffer)
-{
-  float deviation = 0;
-  for(const float angle : buffer)
-  {
-    deviation += sqr(angle - mean);
-  }
-  deviation /= static_cast<float>(buffer.size());
-  deviation = std::sqrt(deviation);
-  return deviation;
-}
@@ -32,21 +32,44 @@ MODULE(IMUValueStateProvider,
 
 class IMUValueStateProvider : public IMUValueStateProviderBase
 {
-public:
-  IMUValueStateProvider();
-private:
-  //RingBuffer for the last 27 gyro and acc values. So many values can be sampled in 333ms with the current motion time of 0.012ms.
-  RingBufferWithSum<float, 27> gyroValuesX;
-  RingBufferWithSum<float, 27> gyroValuesY;
-  RingBufferWithSum<float, 27> gyroValuesZ;
-
-  RingBufferWithSum<float, 27> accValuesX;
-  RingBufferWithSum<float, 27> accValuesY;
-  RingBufferWithSum<float, 27> accValuesZ;
+  /**
+   * The last 27 values of a 3-D sensor. So many values can be sampled in 333ms with the current motion time of 0.012ms.
+   * The sums of the values and of their squares are maintained, so that the mean and the deviation are computed in
+   * constant time. They are accumulated in double precision, because the variance is the difference of two large
+   * numbers for the accelerometer.
+   */
+  struct History
+  {
+    RingBufferWithSum<Vector3d, 27> values{Vector3d::Zero()}; /**< The values. */
+    RingBufferWithSum<Vector3d, 27> squares{Vector3d::Zero()}; /**< The squares of the values. */
+
+    /**
+     * Adds a new measurement.
+     * @param value The measurement.
+     */
+    void push_front(const Vector3f& value)
+    {
+      const Vector3d v = value.cast<double>();
+      values.push_front(v);
+      squares.push_front(v.cwiseAbs2());
+    }
+
+    /**
+     * Computes the mean and the deviation of the values.
+     * @param valueState The object the results are written to.
+     */
+    void getStatistics(IMUValueState::ValueState& valueState) const
+    {
+      const Vector3d mean = values.average();
+      valueState.mean = mean.cast<float>();
+      valueState.deviation = (squares.average() - mean.cwiseAbs2()).cwiseMax(0.0).cwiseSqrt().cast<float>();
+    }
+  };
+
+  History gyroValues; /**< The recent gyro measurements. */
+  History accValues; /**< The recent accelerometer measurements. */
 
   RingBufferWithSum<float, 50> accelerometerLengths;
 
   void update(IMUValueState& imuValueState) override;
-
-  float calcDeviation(const float mean, const RingBufferWithSum<float, 27>& buffer);
 };
@@ -33,10 +33,6 @@ void InertialDataProvider::update(InertialData& inertialData)
 {
   DECLARE_PLOT("module:InertialDataProvider:diffToAngle");
 
-  DECLARE_PLOT("module:InertialDataProvider:dev1");
-  DECLARE_PLOT("module:InertialDataProvider:dev10");
-  DECLARE_PLOT("module:InertialDataProvider:dev50");
-
   bool ignoreAccUpdate = false;
   MODIFY("module:InertialDataProvider:ignoreAccUpdate", ignoreAccUpdate);
 
@@ -9,7 +9,6 @@
 #include "Representations/Sensing/InertialData.h"
 #include "Math/UnscentedKalmanFilter.h"
 #include "Framework/Module.h"
-#include "Math/RingBufferWithSum.h"
 
 MODULE(InertialDataProvider,
 {,
@@ -48,9 +47,6 @@ private:
     Vectorf operator-(const State& other) const;
   };
 
-  RingBufferWithSum<float, 10> deviation10;
-  RingBufferWithSum<float, 50> deviation50;
-
   UKFM<State> ukf = UKFM<State>(State());
 
   Vector2a lastRawAngle = Vector2a::Zero();
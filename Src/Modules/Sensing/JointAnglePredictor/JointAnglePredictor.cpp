@@ -9,7 +9,9 @@
 #include "JointAnglePredictor.h"
 #include "Debugging/Annotation.h"
 #include "Platform/SystemCall.h"
+#include "Tools/NeuralNetworks/ModelRegistry.h"
 
+#include <algorithm>
 #include <filesystem>
 
 MAKE_MODULE(JointAnglePredictor);
@@ -33,10 +35,17 @@ void JointAnglePredictor::update(JointAnglePred& theJointAnglePred)
     theJointAnglePred.modelName = modelName;
   }
 
-  // Add the data from this frame.
-  jointSensorAngles.push_front(theJointSensorData.angles);
-  // Add Request from last frame. == USES(JointRequest)
-  jointRequestAngles.push_front(theJointRequest.angles);
+  // Add the request from last frame (== USES(JointRequest)) and the data from this frame.
+  // Skip lHipYawPitch and use hipYawPitch==rHipYawPitch.
+  float* const frame = history.data() + nextFrame * numOfFeatures;
+  float* features = frame;
+  for(std::size_t joint = Joints::firstLegJoint + 1; joint < Joints::numOfJoints; joint++)
+    *features++ = theJointRequest.angles[joint];
+  for(std::size_t joint = Joints::firstLegJoint + 1; joint < Joints::numOfJoints; joint++)
+    *features++ = theJointSensorData.angles[joint];
+  std::copy(frame, features, frame + historyLength * numOfFeatures);
+  nextFrame = (nextFrame + 1) % historyLength;
+  numOfFrames = std::min(numOfFrames + 1, historyLength);
 
   // Fill all joints with ignore values.
   theJointAnglePred.angles.fill(SensorData::ignore);
@@ -45,23 +54,15 @@ void JointAnglePredictor::update(JointAnglePred& theJointAnglePred)
   theJointAnglePred.isValid = theMotionInfo.isMotion(MotionPhase::walk);
 
   // Do noting until data is present and only calculate the predictions if the results are valid.
-  if(!jointSensorAngles.full() || !jointRequestAngles.full() || !theJointAnglePred.isValid)
+  if(numOfFrames < historyLength || !theJointAnglePred.isValid)
   {
     theJointAnglePred.isValid = false;
     return;
   }
 
-  // Add input to model.
-  float* input = network.input(0).data();
-  // Add values from old to new and first requests and then the sensor values.
-  for(int i = historyLength - 1; i >= 0; i--)
-  {
-    // Skip lHipYawPitch and use hipYawPitch==rHipYawPitch.
-    for(std::size_t joint = Joints::firstLegJoint + 1; joint < Joints::numOfJoints; joint++)
-      *input++ = jointRequestAngles[i][joint];
-    for(std::size_t joint = Joints::firstLegJoint + 1; joint < Joints::numOfJoints; joint++)
-      *input++ = jointSensorAngles[i][joint];
-  }
+  // Add input to model. The oldest frame is the one that is overwritten next.
+  const float* input = history.data() + nextFrame * numOfFeatures;
+  std::copy(input, input + historyLength * numOfFeatures, network.input(0).data());
 
   // Run network.
   STOPWATCH("module:JointAnglePredictor:apply")
@@ -87,14 +88,15 @@ void JointAnglePredictor::compile(bool output)
   else
     ASSERT(std::filesystem::exists(modelPath + modelName));
 
-  network.compile(Model(modelPath + modelName));
+  model = ModelRegistry::getONNX(modelPath + modelName);
+  network.compile(*model);
   ASSERT(network.valid());
 
   // Input shape: (historyLength, 22)
   ASSERT(network.numOfInputs() == 1);
   ASSERT(network.input(0).rank() == 2); // (Batch, Time, Features)
   ASSERT(network.input(0).dims(0) == historyLength);
-  ASSERT(network.input(0).dims(1) == 22); // == Request + Sensor
+  ASSERT(network.input(0).dims(1) == numOfFeatures); // == Request + Sensor
 
   // Output shape: (1, 11)
   ASSERT(network.numOfOutputs() == 1);
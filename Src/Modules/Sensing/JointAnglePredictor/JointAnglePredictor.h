@@ -9,7 +9,6 @@
 #pragma once
 
 #include "Framework/Module.h"
-#include "MathBase/RingBuffer.h"
 #include "Platform/File.h"
 #include "Representations/Infrastructure/JointRequest.h"
 #include "Representations/Infrastructure/SensorData/JointSensorData.h"
@@ -18,6 +17,8 @@
 
 //#include <CompiledNN/CompiledNN.h>
 #include <CompiledNN2ONNX/CompiledNN.h>
+#include <memory>
+#include <vector>
 
 using namespace NeuralNetworkONNX;
 
@@ -40,12 +41,17 @@ public:
   JointAnglePredictor() : network(&Global::getAsmjitRuntime()) { compile(false); }
 
 private:
-  // Save input data from old to new.
-  RingBuffer<ENUM_INDEXED_ARRAY(Angle, Joints::Joint)> jointSensorAngles{ historyLength }; // ..., -2, -1, -0
-  RingBuffer<ENUM_INDEXED_ARRAY(Angle, Joints::Joint)> jointRequestAngles{ historyLength }; // ...,-3, -2, -1
+  static constexpr std::size_t numOfFeatures = 2 * (Joints::numOfJoints - Joints::firstLegJoint - 1); /**< Request + sensor angles of the legs without lHipYawPitch. */
+
+  // The inputs of the last frames in the layout of the network input. Each frame is stored twice,
+  // historyLength frames apart, so that the whole history is always a contiguous block from old to new.
+  std::vector<float> history = std::vector<float>(2 * historyLength * numOfFeatures);
+  unsigned nextFrame = 0; /**< The index of the frame in the history that is written next. */
+  unsigned numOfFrames = 0; /**< The number of frames in the history (at most historyLength). */
 
   // Model.
   const std::string modelPath = std::string(File::getBHDir()) + "/Config/NeuralNets/JointAngle/";
+  std::shared_ptr<const Model> model; /**< The model of the neural network. It is shared with other robots in the simulator. */
   CompiledNN network; /**< The compiled neural network. */
 
   /**
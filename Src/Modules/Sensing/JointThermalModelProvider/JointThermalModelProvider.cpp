@@ -0,0 +1,52 @@
+/**
+ * @file JointThermalModelProvider.cpp
+ * This file implements a module that estimates and predicts the temperatures of the joints.
+ * @author Thomas Röfer
+ */
+
+#include "JointThermalModelProvider.h"
+#include "Debugging/Plot.h"
+#include <algorithm>
+#include <cmath>
+
+MAKE_MODULE(JointThermalModelProvider);
+
+void JointThermalModelProvider::update(JointThermalModel& theJointThermalModel)
+{
+  DECLARE_PLOT("module:JointThermalModelProvider:lKneePitch");
+  DECLARE_PLOT("module:JointThermalModelProvider:rKneePitch");
+
+  const bool initialize = lastTime == 0;
+  const float timeDelta = initialize ? 0.f : theFrameInfo.getTimeSince(lastTime) / 1000.f;
+  lastTime = theFrameInfo.time;
+
+  // The temperatures converge exponentially towards the one the current would result in.
+  const float predictionDecay = std::exp(-coolingFactor * predictionHorizon);
+  const bool fullTorque = theMotionInfo.isKicking()
+                          || std::find(fullTorqueMotions.begin(), fullTorqueMotions.end(), theMotionInfo.executedPhase) != fullTorqueMotions.end();
+
+  FOREACH_ENUM(Joints::Joint, joint)
+  {
+    const float measured = theJointSensorData.temperatures[joint];
+    float& temperature = theJointThermalModel.temperatures[joint];
+    const float current = theJointSensorData.currents[joint] == SensorData::off ? 0.f : static_cast<float>(theJointSensorData.currents[joint]);
+    const float heating = heatingFactor * sqr(current);
+
+    if(initialize)
+      temperature = measured;
+    else
+    {
+      temperature += (heating - coolingFactor * (temperature - ambientTemperature)) * timeDelta;
+      temperature += measurementWeight * (measured - temperature);
+    }
+
+    const float steadyTemperature = ambientTemperature + heating / coolingFactor;
+    const float predicted = steadyTemperature + (temperature - steadyTemperature) * predictionDecay;
+    theJointThermalModel.predictedTemperatures[joint] = predicted;
+    theJointThermalModel.maxStiffnesses[joint] = fullTorque ? 100
+                                                 : static_cast<int>(mapToRange(predicted, temperatureLimits.min, temperatureLimits.max, 100.f, static_cast<float>(minStiffness)));
+  }
+
+  PLOT("module:JointThermalModelProvider:lKneePitch", theJointThermalModel.predictedTemperatures[Joints::lKneePitch]);
+  PLOT("module:JointThermalModelProvider:rKneePitch", theJointThermalModel.predictedTemperatures[Joints::rKneePitch]);
+}
@@ -0,0 +1,49 @@
+/**
+ * @file JointThermalModelProvider.h
+ * This module estimates the temperatures of the joints with a first order thermal model
+ * that is heated by the squared current and cools down towards the ambient temperature.
+ * The coarse measured temperatures correct the estimate. From the temperatures predicted
+ * for the near future, it determines the maximum stiffnesses of the joints, which the
+ * MotionEngine applies to the joint requests of all motion engines. Motions that need the
+ * full torque, e.g. kicks and getting up, are not limited.
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Representations/Infrastructure/FrameInfo.h"
+#include "Representations/Infrastructure/SensorData/JointSensorData.h"
+#include "Representations/MotionControl/MotionInfo.h"
+#include "Representations/Sensing/JointThermalModel.h"
+#include "Framework/Module.h"
+#include "Math/Range.h"
+
+MODULE(JointThermalModelProvider,
+{,
+  REQUIRES(FrameInfo),
+  REQUIRES(JointSensorData),
+  USES(MotionInfo),
+  PROVIDES(JointThermalModel),
+  DEFINES_PARAMETERS(
+  {,
+    (float)(30.f) ambientTemperature, /**< The temperature the joints cool down to without current (in °C). */
+    (float)(2e-7f) heatingFactor, /**< The temperature increase per squared current (in °C / (mA² * s)). */
+    (float)(0.005f) coolingFactor, /**< The ratio of the difference to the ambient temperature that is lost per second. */
+    (float)(0.01f) measurementWeight, /**< How much is the estimate corrected towards the measured temperature per frame? */
+    (float)(60.f) predictionHorizon, /**< How far are the temperatures predicted into the future (in s)? */
+    (Rangef)(70.f, 85.f) temperatureLimits, /**< Above the lower predicted temperature, the stiffness is reduced. It reaches minStiffness at the upper one (in °C). */
+    (int)(50) minStiffness, /**< The lowest stiffness the joints are limited to (in %). */
+    (std::vector<MotionPhase::Type>)({MotionPhase::kick, MotionPhase::getUp}) fullTorqueMotions, /**< The stiffnesses are not limited while these motions are executed. */
+  }),
+});
+
+class JointThermalModelProvider : public JointThermalModelProviderBase
+{
+  unsigned lastTime = 0; /**< The time of the previous update (in ms). 0 if not initialized yet. */
+
+  /**
+   * This method is called when the representation provided needs to be updated.
+   * @param theJointThermalModel The representation updated.
+   */
+  void update(JointThermalModel& theJointThermalModel) override;
+};
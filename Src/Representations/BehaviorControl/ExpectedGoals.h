@@ -9,13 +9,16 @@
 
 #pragma once
 
+#include "Math/Eigen.h"
 #include "Streaming/AutoStreamable.h"
 #include "Streaming/Function.h"
+#include <vector>
 
 STREAMABLE(ExpectedGoals,
 {
   FUNCTION(float(const Vector2f& pointOnField)) xG; /**< Estimates the probability of scoring a goal when shooting from a given position, not taking into account the known obstacles. */
   FUNCTION(float(const Vector2f& pointOnField)) xGA; /**< Estimates the probability of an opponent missing the goal when shooting from a given position, not taking into account the known obstacles. */
   FUNCTION(float(const Vector2f& pointOnField, const bool isPositioning)) getRating; /**< Estimates the probability that a given position has a wide enough opening angle on the opponent's goal to score a goal, taking into account the known obstacles. */
+  FUNCTION(void(const std::vector<Vector2f>& pointsOnField, const bool isPositioning, std::vector<float>& ratings)) getRatings; /**< Same as getRating, but for a batch of positions. The ratings are returned in the same order. */
   FUNCTION(float(const Vector2f& pointOnField)) getOpponentRating, /**< Estimates the probability that a given position does not have a wide enough opening angle on the own goal for an opponent to score a goal against, not taking into account the known obstacles. */
 });
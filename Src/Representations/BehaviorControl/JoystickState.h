@@ -15,6 +15,11 @@ STREAMABLE(JoystickState,
 {
   bool pressed(int button) const {return (buttons & 1 << button) != 0;},
 
-  (std::array<float, 8>) axes, /**< The up to 8 axes, each in the range -1 .. 1. */
+  (std::array<float, 8>) axes, /**< The up to 8 axes, each in the range -1 .. 1. Between packets, they are extrapolated. */
   (unsigned)(0) buttons, /**< The state of up to 32 buttons (bit set means pressed). */
+  (unsigned)(0) sequenceNumber, /**< The sequence number of the last packet received. */
+  (unsigned)(0) timeWhenReceived, /**< When was the last packet received (real time in ms)? */
+  (unsigned)(0) packetsLost, /**< The number of packets missed so far. */
+  (float)(0.f) latency, /**< The one-way latency between the remote PC and the robot (in ms). */
+  (float)(0.f) jitter, /**< The variation of the transmission delay (in ms). */
 });
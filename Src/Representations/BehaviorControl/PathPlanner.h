@@ -11,6 +11,7 @@
 
 #include "Representations/MotionControl/MotionRequest.h"
 #include "Streaming/Function.h"
+#include <vector>
 
 STREAMABLE(PathPlanner,
 {
@@ -21,5 +22,16 @@ STREAMABLE(PathPlanner,
    * speed The speed to walk with in ratios of the maximum speeds.
    * The function returns the obstacle avoidance information.
    */
-  FUNCTION(MotionRequest::ObstacleAvoidance(const Pose2f& target, const Pose2f& speed)) plan,
+  FUNCTION(MotionRequest::ObstacleAvoidance(const Pose2f& target, const Pose2f& speed)) plan;
+
+  /**
+   * The function determines the costs of the shortest paths from a start pose to several targets
+   * with a single search. The costs are the path lengths plus the penalties also used by "plan".
+   * The parameters of the function are:
+   * start The pose to start from in field coordinates.
+   * targets The targets to reach in field coordinates.
+   * speed The speed to walk with in ratios of the maximum speeds.
+   * The function returns the costs per target (in mm). Unreachable targets have infinite costs.
+   */
+  FUNCTION(std::vector<float>(const Pose2f& start, const std::vector<Vector2f>& targets, const Pose2f& speed)) getPathLengths,
 });
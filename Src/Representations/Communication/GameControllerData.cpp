@@ -131,6 +131,7 @@ void GameControllerData::read(In& stream)
   STREAM(secondaryTime);
   STREAM(teams);
   STREAM(timeLastPacketReceived);
+  STREAM(timeLastPacketReceivedUs);
   STREAM(isTrueData);
 }
 
@@ -150,6 +151,7 @@ void GameControllerData::write(Out& stream) const
   STREAM(secondaryTime);
   STREAM(teams);
   STREAM(timeLastPacketReceived);
+  STREAM(timeLastPacketReceivedUs);
   STREAM(isTrueData);
 }
 
@@ -170,5 +172,6 @@ void GameControllerData::reg()
   REG(secondaryTime);
   REG(TeamInfo(&)[2], teams);
   REG(timeLastPacketReceived);
+  REG(timeLastPacketReceivedUs);
   REG(isTrueData);
 }
@@ -18,6 +18,7 @@ struct GameControllerData : public RoboCup::RoboCupGameControlData, public Strea
   GameControllerData();
 
   unsigned timeLastPacketReceived = 0; /**< Time when the last GameController packet has been received. */
+  unsigned short timeLastPacketReceivedUs = 0; /**< The sub-millisecond part of \c timeLastPacketReceived (in µs). */
   bool isTrueData = false; /**< Whether the GameController packet does not delay some transitions that are normally signaled by a whistle. */
 
 protected:
@@ -21,6 +21,8 @@
 STREAMABLE(ReceivedTeamMessage,
 {,
   (int)(-1) number,
+  (float)(0.f) timeOffsetUncertainty, /**< The standard deviation of the clock offset to the sender when the message was received (in ms). */
+  (float)(1.f) timeOffsetConfidence, /**< How much the timestamps of the message can be trusted (0 = not at all ... 1 = fully). */
 
   (RobotStatus) theRobotStatus,
   (RobotPose) theRobotPose,
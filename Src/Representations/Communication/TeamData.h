@@ -29,6 +29,8 @@ STREAMABLE(Teammate,
 
   (int)(-1) number,
   (bool)(false) isGoalkeeper, /**< This is for a teammate what \c theGameState.isGoalkeeper() is for the player itself. */
+  (float)(0.f) timeOffsetUncertainty, /**< The standard deviation of the clock offset to the sender when the message was received (in ms). */
+  (float)(1.f) timeOffsetConfidence, /**< How much the timestamps of the message can be trusted (0 = not at all ... 1 = fully). */
 
   (RobotStatus) theRobotStatus,
   (RobotPose) theRobotPose,
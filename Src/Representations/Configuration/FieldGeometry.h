@@ -0,0 +1,132 @@
+/**
+ * @file FieldGeometry.h
+ *
+ * This file declares a representation that contains lookup structures for
+ * frequent queries about the field geometry. They are derived once from the
+ * field dimensions, so that modules do not have to scan the field lines or
+ * test the field areas themselves.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Math/BHMath.h"
+#include "Math/Boundary.h"
+#include "Math/Eigen.h"
+#include "Streaming/AutoStreamable.h"
+#include "Streaming/Enum.h"
+#include "Tools/Modeling/LineLikelihoodField.h"
+#include <algorithm>
+#include <vector>
+
+STREAMABLE(FieldGeometry,
+{
+  ENUM(Area,
+  {,
+    fieldOfPlay, /**< The field inside the outer field lines (including them). */
+    ownHalf, /**< The own half of the field of play (including the halfway line). */
+    centerCircle, /**< The center circle (including its perimeter). */
+    ownPenaltyArea, /**< The own penalty area (including its bounding lines). */
+    opponentPenaltyArea, /**< The opponent penalty area (including its bounding lines). */
+    ownGoalArea, /**< The own goal area (including its bounding lines). */
+    opponentGoalArea, /**< The opponent goal area (including its bounding lines). */
+  });
+
+  /**
+   * Returns the distance between a point and the closest field line with a similar orientation.
+   * @param point The point (in field coordinates).
+   * @param parallelToX Are lines searched that are rather parallel to the x axis?
+   * @return The distance (in mm, quantized). A large value is returned for points outside the carpet.
+   */
+  float getLineDistance(const Vector2f& point, bool parallelToX) const
+  {
+    return lineDistances.getDistance(point, parallelToX);
+  }
+
+  /**
+   * Returns the distance between a point and the closest field line.
+   * @param point The point (in field coordinates).
+   * @return The distance (in mm, quantized). A large value is returned for points outside the carpet.
+   */
+  float getLineDistance(const Vector2f& point) const
+  {
+    return std::min(lineDistances.getDistance(point, true), lineDistances.getDistance(point, false));
+  }
+
+  /**
+   * Returns the areas a point is located in. The areas are sampled at the centers
+   * of the cells, i.e. the result can be wrong within half a cell of an area's border.
+   * @param point The point (in field coordinates).
+   * @return A bit set of \c Area. Empty for points outside the carpet.
+   */
+  unsigned getAreas(const Vector2f& point) const
+  {
+    const int x = static_cast<int>((point.x() - carpet.x.min) / cellSize);
+    const int y = static_cast<int>((point.y() - carpet.y.min) / cellSize);
+    if(point.x() < carpet.x.min || point.y() < carpet.y.min || x >= width || y >= height)
+      return 0;
+    return areas[y * width + x];
+  }
+
+  /**
+   * Is a point located in a certain area? See getAreas for the accuracy.
+   * @param point The point (in field coordinates).
+   * @param area The area.
+   * @return Is the point inside the area?
+   */
+  bool isInside(const Vector2f& point, Area area) const
+  {
+    return (getAreas(point) & bit(area)) != 0;
+  }
+
+  /**
+   * Returns the signed distance of a point to the outer field lines.
+   * @param point The point (in field coordinates).
+   * @return The distance (in mm). Positive inside the field of play, negative outside.
+   */
+  float getSignedDistanceToFieldOfPlay(const Vector2f& point) const
+  {
+    return getSignedDistance(fieldOfPlayBoundary, point);
+  }
+
+  /**
+   * Returns the signed distance of a point to the border of the carpet.
+   * @param point The point (in field coordinates).
+   * @return The distance (in mm). Positive on the carpet, negative outside.
+   */
+  float getSignedDistanceToFieldBorder(const Vector2f& point) const
+  {
+    return getSignedDistance(carpet, point);
+  }
+
+  /** Was the geometry computed? It is not streamed, i.e. it is missing after it was read from a stream. */
+  bool isValid() const {return !areas.empty();}
+
+  LineLikelihoodField lineDistances; /**< The distances to the field lines. */
+  Boundaryf carpet; /**< The area of the carpet. */
+  Boundaryf fieldOfPlayBoundary; /**< The area inside the outer field lines. */
+  std::vector<unsigned char> areas; /**< For each cell, a bit set of the areas its center is located in. */
+  int width = 0; /**< The number of cells of the area masks in x direction. */
+  int height = 0; /**< The number of cells of the area masks in y direction. */
+
+private:
+  /**
+   * Returns the signed distance of a point to the border of a rectangle.
+   * @param rectangle The rectangle.
+   * @param point The point.
+   * @return The distance. Positive inside, negative outside.
+   */
+  static float getSignedDistance(const Boundaryf& rectangle, const Vector2f& point)
+  {
+    const Vector2f outside(std::max(rectangle.x.min - point.x(), point.x() - rectangle.x.max),
+                           std::max(rectangle.y.min - point.y(), point.y() - rectangle.y.max));
+    if(outside.x() <= 0.f && outside.y() <= 0.f)
+      return -std::max(outside.x(), outside.y());
+    return -outside.cwiseMax(0.f).norm();
+  }
+
+public:,
+
+  (float)(50.f) cellSize, /**< The edge length of the square cells of the area masks (in mm). */
+});
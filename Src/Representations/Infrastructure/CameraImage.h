@@ -18,10 +18,17 @@ private:
 
 public:
   unsigned int timestamp = 0;
+  unsigned int timestampFraction = 0; /**< The nanoseconds that passed within the millisecond given by timestamp. Not streamed to keep the format of logs. */
 
   static constexpr unsigned int maxResolutionWidth = 1280;
   static constexpr unsigned int maxResolutionHeight = 960;
 
+  /** Returns the timestamp in nanoseconds. It has the same origin as timestamp. */
+  unsigned long long getTimestampNs() const
+  {
+    return timestamp * 1000000ull + timestampFraction;
+  }
+
   bool isReference() const
   {
     return reference;
@@ -40,6 +47,7 @@ public:
     this->width = width;
     this->height = height;
     this->timestamp = timestamp;
+    timestampFraction = 0;
     image = reinterpret_cast<PixelType*>(data);
   }
 
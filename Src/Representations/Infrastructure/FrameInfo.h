@@ -21,9 +21,17 @@ STREAMABLE(FrameInfo, COMMA public BHumanCompressedMessageParticle<FrameInfo>
    * @param timestamp A timestamp, usually in the past.
    * @return The number of ms passed since the given timestamp.
    */
-  int getTimeSince(unsigned timestamp) const,
+  int getTimeSince(unsigned timestamp) const;
+
+  /**
+   * The method returns the timestamp of the data processed in the current
+   * frame with sub-millisecond resolution.
+   * @return The timestamp in ns. It has the same origin as \c time .
+   */
+  unsigned long long getTimeNs() const {return time * 1000000ull + timeFraction;},
 
   (unsigned)(0) time, /**< The timestamp of the data processed in the current frame in ms. */
+  (unsigned)(0) timeFraction, /**< The nanoseconds that passed within the millisecond given by \c time . */
 });
 
 inline int FrameInfo::getTimeSince(unsigned timestamp) const
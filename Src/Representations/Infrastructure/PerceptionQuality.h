@@ -0,0 +1,28 @@
+/**
+ * @file PerceptionQuality.h
+ *
+ * This file declares a representation that tells the perception modules how
+ * much computing time they should spend. If the robot is running hot or the
+ * threads do not keep up with their frame rates, the perception is done in
+ * less detail, so that the motion thread keeps its deadlines.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Streaming/AutoStreamable.h"
+#include "Streaming/Enum.h"
+
+STREAMABLE(PerceptionQuality,
+{
+  ENUM(Level,
+  {,
+    full, /**< Everything is perceived in full detail. */
+    reduced, /**< The perception is done in less detail. */
+    minimal, /**< Only the minimum required is perceived. */
+  }),
+
+  (Level)(full) level, /**< The quality the perception modules should provide. */
+  (unsigned)(0) timeWhenLevelChanged, /**< When was the level changed the last time? */
+});
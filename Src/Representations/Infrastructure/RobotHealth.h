@@ -35,6 +35,7 @@ STREAMABLE(MotionRobotHealth,
   (float)(0) minMotionTime, /**< Minimum execution time */
 
   (unsigned)(0) motionFramesDropped, /**< Number of lost motion frames between the current and the last executed motion frame. */
+  (unsigned)(0) totalMotionFramesDropped, /**< Number of lost motion frames since the start. */
   (FrameLostStatus)(noFrameLost) frameLostStatus, /**< Discretized status of frames dropped */
 });
 
@@ -12,6 +12,7 @@
 #include "ImageProcessing/PixelTypes.h"
 #include "ImageProcessing/Image.h"
 #include "Framework/Blackboard.h"
+#include <algorithm>
 
 Vector2f ImageCoordinateSystem::fromCorrected(const Vector2f& correctedCoords, const Vector2f& offset) const
 {
@@ -34,6 +35,41 @@ Vector2f ImageCoordinateSystem::fromCorrected(const Vector2f& correctedCoords, c
   return Vector2f(cameraInfo.opticalCenter.x() - std::tan(std::atan((cameraInfo.opticalCenter.x() - correctedCoords.x()) / cameraInfo.focalLength) + factor * offset.x()) * cameraInfo.focalLength, y);
 }
 
+Vector2f ImageCoordinateSystem::fromCorrected(const Vector2f& correctedCoords) const
+{
+  if(correctedRows.empty() || !(correctedCoords.y() >= correctedRows.front() && correctedCoords.y() < correctedRows.back()))
+    return fromCorrected(correctedCoords, offset);
+
+  // Find the original row in the monotonic table of corrected rows.
+  const int row = static_cast<int>(std::upper_bound(correctedRows.begin(), correctedRows.end(), correctedCoords.y()) - correctedRows.begin()) - 1;
+  const float y = static_cast<float>(row) + (correctedCoords.y() - correctedRows[row]) / (correctedRows[row + 1] - correctedRows[row]);
+
+  // tan(atan(u) + d) = (u + tan(d)) / (1 - u * tan(d))
+  const float correctionX = getRowCorrection(y).x();
+  const float u = (cameraInfo.opticalCenter.x() - correctedCoords.x()) * cameraInfo.focalLengthInv;
+  return Vector2f(cameraInfo.opticalCenter.x() - (u + correctionX) / (1.f - u * correctionX) * cameraInfo.focalLength, y);
+}
+
+void ImageCoordinateSystem::updateRowCorrections()
+{
+  const std::size_t numOfRows = static_cast<std::size_t>(std::max(cameraInfo.height, 0)) + 1;
+  rowCorrections.resize(numOfRows);
+  correctedRows.resize(numOfRows);
+  bool monotonic = true;
+  for(std::size_t row = 0; row < numOfRows; ++row)
+  {
+    const float factor = a + static_cast<float>(row) * b;
+    rowCorrections[row] = Vector2f(std::tan(factor * offset.x()), std::tan(factor * offset.y()));
+    const float v = (static_cast<float>(row) - cameraInfo.opticalCenter.y()) * cameraInfo.focalLengthHeightInv;
+    correctedRows[row] = cameraInfo.opticalCenter.y() + (v - rowCorrections[row].y()) / (1.f + v * rowCorrections[row].y()) * cameraInfo.focalLengthHeight;
+    monotonic &= row == 0 || correctedRows[row] > correctedRows[row - 1];
+  }
+
+  // Without a monotonic mapping, the correction cannot be inverted by a lookup.
+  if(!monotonic)
+    correctedRows.clear();
+}
+
 void ImageCoordinateSystem::draw() const
 {
   DEBUG_DRAWING("horizon", "drawingOnImage") // displays the horizon
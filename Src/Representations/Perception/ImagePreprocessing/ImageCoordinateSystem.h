@@ -11,6 +11,7 @@
 #include "Math/BHMath.h"
 #include "Math/Eigen.h"
 #include "Streaming/AutoStreamable.h"
+#include <vector>
 
 /**
  * @struct ImageCoordinateSystem
@@ -43,6 +44,40 @@ private:
    */
   Vector2f fromCorrected(const Vector2f& correctedCoords, const Vector2f& offset) const;
 
+  /**
+   * The tangents of the horizontal and vertical angular corrections of each
+   * image row and of the row below the image. The rolling shutter only
+   * depends on the row, so that the correction is a table lookup followed by
+   * applying tan(atan(u) - d) = (u - tan(d)) / (1 + u * tan(d)). Not
+   * streamed. Empty if the table was not computed for the current values.
+   */
+  std::vector<Vector2f> rowCorrections;
+
+  /**
+   * The corrected y coordinate of each row in rowCorrections. It is used to
+   * invert the correction. Empty if the corrected rows are not monotonic.
+   */
+  std::vector<float> correctedRows;
+
+  /**
+   * Determines the interpolated tangents of the corrections of a row.
+   * @param y The y coordinate in the original image. It must be inside the image.
+   * @return The tangents of the horizontal and vertical corrections.
+   */
+  Vector2f getRowCorrection(float y) const
+  {
+    const int row = static_cast<int>(y);
+    const float t = y - static_cast<float>(row);
+    return rowCorrections[row] * (1.f - t) + rowCorrections[row + 1] * t;
+  }
+
+  /** Removes the tables, because they do not belong to streamed values. */
+  void onRead()
+  {
+    rowCorrections.clear();
+    correctedRows.clear();
+  }
+
 public:
   CameraInfo cameraInfo; /**< A copy of the camera information that is required for the methods to work. Isn't logged. */
 
@@ -55,7 +90,13 @@ public:
    */
   Vector2f toCorrected(const Vector2f& imageCoords) const
   {
-    return toCorrected(imageCoords, offset);
+    if(rowCorrections.empty() || !(imageCoords.y() >= 0.f && imageCoords.y() < static_cast<float>(cameraInfo.height)))
+      return toCorrected(imageCoords, offset);
+    const Vector2f correction = getRowCorrection(imageCoords.y());
+    const float u = (cameraInfo.opticalCenter.x() - imageCoords.x()) * cameraInfo.focalLengthInv;
+    const float v = (imageCoords.y() - cameraInfo.opticalCenter.y()) * cameraInfo.focalLengthHeightInv;
+    return Vector2f(cameraInfo.opticalCenter.x() - (u - correction.x()) / (1.f + u * correction.x()) * cameraInfo.focalLength,
+                    cameraInfo.opticalCenter.y() + (v - correction.y()) / (1.f + v * correction.y()) * cameraInfo.focalLengthHeight);
   }
 
   /**
@@ -76,10 +117,7 @@ public:
    * @param correctedCoords The corrected point in image coordinates.
    * @return The original point.
    */
-  Vector2f fromCorrected(const Vector2f& correctedCoords) const
-  {
-    return fromCorrected(correctedCoords, offset);
-  }
+  Vector2f fromCorrected(const Vector2f& correctedCoords) const;
 
   /**
    * Inverse of toCorrected.
@@ -138,6 +176,13 @@ public:
     return fromCorrectedRobot(Vector2f(correctedCoords.cast<float>()));
   }
 
+  /**
+   * Computes the tables that turn toCorrected and fromCorrected into lookups.
+   * It must be called after cameraInfo, offset, a, and b were set. Otherwise,
+   * both functions compute the correction analytically.
+   */
+  void updateRowCorrections();
+
   /**
    * Some coordinate system debug drawings.
    */
@@ -0,0 +1,58 @@
+/**
+ * @file ImagePatches.h
+ *
+ * This file declares representations that contain the image patches that
+ * perceptors extracted and classified with neural networks together with
+ * the outputs of the networks. They allow logging exactly the data needed
+ * for training these networks without logging complete images.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Math/Eigen.h"
+#include "Streaming/AutoStreamable.h"
+
+STREAMABLE(ImagePatches,
+{
+  /** A patch of the grayscale image. */
+  STREAMABLE(Patch,
+  {,
+    (Vector2f) position, /**< The position of the center of the patch. The coordinate system depends on the representation. */
+    (Vector2i)(Vector2i::Zero()) area, /**< The size of the area in the image the patch was extracted from (in pixels). Zero if unknown. */
+    (std::vector<unsigned char>) pixels, /**< The grayscale pixels of the patch, row by row. */
+    (std::vector<float>) outputs, /**< The outputs of the network for this patch. Their meaning depends on the representation. */
+  });
+  ,
+  (Vector2i)(Vector2i::Zero()) patchSize, /**< The width and height of all patches in pixels. */
+  (std::vector<Patch>) patches, /**< The patches of the current frame. */
+});
+
+/**
+ * The candidate patches of the BallAndPenaltyMarkPerceptor. The positions are
+ * in image coordinates. The outputs are the probabilities of none, a penalty
+ * mark, and a ball, followed by the position and radius of the ball in patch
+ * coordinates.
+ */
+STREAMABLE_WITH_BASE(BallPatches, ImagePatches,
+{,
+});
+
+/**
+ * The robots detected by the RobotDetector. The positions are in image
+ * coordinates. The outputs are the confidence, whether the robot is fallen
+ * (0 or 1), and its estimated distance.
+ */
+STREAMABLE_WITH_BASE(RobotPatches, ImagePatches,
+{,
+});
+
+/**
+ * The candidate patches of the IntersectionsClassifier. The positions are in
+ * field coordinates relative to the robot. The outputs are the probabilities
+ * of an L, none, a T, and an X intersection.
+ */
+STREAMABLE_WITH_BASE(IntersectionPatches, ImagePatches,
+{,
+});
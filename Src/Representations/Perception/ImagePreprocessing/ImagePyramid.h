@@ -0,0 +1,70 @@
+/**
+ * @file ImagePyramid.h
+ *
+ * This file declares a representation that contains downscaled versions of
+ * the grayscale and the chromaticity images of the ECImage. Each level has
+ * half the width and height of the previous one. It is computed once per
+ * frame for all modules that need the image in a lower resolution.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "ImageProcessing/Image.h"
+#include "ImageProcessing/PixelTypes.h"
+#include "Platform/BHAssert.h"
+#include "Streaming/AutoStreamable.h"
+#include <vector>
+
+STREAMABLE(ImagePyramid,
+{
+  /**
+   * Returns a level of the grayscale pyramid.
+   * @param downScales How often the ECImage was halved in both dimensions (>= 1).
+   * @return The image downscaled by a factor of 2^downScales.
+   */
+  const Image<PixelTypes::GrayscaledPixel>& getGrayscaled(unsigned downScales) const
+  {
+    ASSERT(downScales > 0 && downScales <= grayscaled.size());
+    return grayscaled[downScales - 1];
+  }
+
+  /**
+   * Returns a level of the blue chromaticity pyramid.
+   * @param downScales How often the ECImage was halved in both dimensions (>= 1).
+   * @return The image downscaled by a factor of 2^downScales.
+   */
+  const Image<PixelTypes::GrayscaledPixel>& getBlueChromaticity(unsigned downScales) const
+  {
+    ASSERT(downScales > 0 && downScales <= blueChromaticity.size());
+    return blueChromaticity[downScales - 1];
+  }
+
+  /**
+   * Returns a level of the red chromaticity pyramid.
+   * @param downScales How often the ECImage was halved in both dimensions (>= 1).
+   * @return The image downscaled by a factor of 2^downScales.
+   */
+  const Image<PixelTypes::GrayscaledPixel>& getRedChromaticity(unsigned downScales) const
+  {
+    ASSERT(downScales > 0 && downScales <= redChromaticity.size());
+    return redChromaticity[downScales - 1];
+  }
+
+  /**
+   * Checks whether a certain level exists.
+   * @param downScales How often the ECImage was halved in both dimensions (>= 1).
+   * @param withChromaticity Must the chromaticity images exist as well?
+   * @return Does the level exist?
+   */
+  bool hasLevel(unsigned downScales, bool withChromaticity = false) const
+  {
+    return downScales > 0 && downScales <= grayscaled.size()
+           && (!withChromaticity || (downScales <= blueChromaticity.size() && downScales <= redChromaticity.size()));
+  },
+
+  (std::vector<Image<PixelTypes::GrayscaledPixel>>) grayscaled, /**< Level i is the grayscale image downscaled by 2^(i+1). */
+  (std::vector<Image<PixelTypes::GrayscaledPixel>>) blueChromaticity, /**< Level i is the blue chromaticity image downscaled by 2^(i+1). */
+  (std::vector<Image<PixelTypes::GrayscaledPixel>>) redChromaticity, /**< Level i is the red chromaticity image downscaled by 2^(i+1). */
+});
@@ -2,7 +2,11 @@
  * @file OptionalCameraImage.h
  *
  * This file defines a representation that encapsulates a camera image
- * that can be provided or not.
+ * that can be provided or not. The image is referenced through a shared
+ * pointer, so that copying the representation to another thread (see
+ * sharedRepresentations in threads.cfg) does not copy the pixels. The image
+ * must not be changed after it was provided, because other threads might
+ * still use it.
  *
  * @author Ayleen Lührsen
  */
@@ -10,8 +14,59 @@
 #pragma once
 
 #include "Representations/Infrastructure/CameraImage.h"
+#include <memory>
 
-STREAMABLE(OptionalCameraImage,
-{,
-  (std::optional<CameraImage>) image,
-});
+struct OptionalCameraImage : public Streamable
+{
+  std::shared_ptr<const CameraImage> image; /**< The image or nullptr if none is provided. */
+  unsigned deadline = 0; /**< Processing the image can be skipped if it did not start before this time. 0 if there is no deadline. Not streamed to keep the format of logs. */
+
+protected:
+  /**
+   * Read this object from a stream. The format is the same as the one of \c std::optional<CameraImage>.
+   * @param stream The stream from which the object is read.
+   */
+  void read(In& stream) override
+  {
+    stream.select("image", -1);
+    unsigned size;
+    stream >> size;
+    if(size)
+    {
+      const std::shared_ptr<CameraImage> newImage = std::make_shared<CameraImage>();
+      stream.select(nullptr, 0);
+      stream >> *newImage;
+      stream.deselect();
+      image = newImage;
+    }
+    else
+      image.reset();
+    stream.deselect();
+    deadline = 0;
+  }
+
+  /**
+   * Write this object to a stream. The format is the same as the one of \c std::optional<CameraImage>.
+   * @param stream The stream to which the object is written.
+   */
+  void write(Out& stream) const override
+  {
+    stream.select("image", -1);
+    stream << static_cast<unsigned>(image != nullptr);
+    if(image)
+    {
+      stream.select(nullptr, 0);
+      stream << *image;
+      stream.deselect();
+    }
+    stream.deselect();
+  }
+
+private:
+  static void reg()
+  {
+    PUBLISH(reg);
+    REG_CLASS(OptionalCameraImage);
+    REG(std::optional<CameraImage>, image);
+  }
+};
@@ -0,0 +1,32 @@
+/**
+ * @file PerceptionAttention.h
+ *
+ * This file declares a representation that tells the expensive perception
+ * modules of a camera thread where the ball is expected and whether they
+ * should run in the current frame.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Debugging/DebugDrawings.h"
+#include "Math/Eigen.h"
+#include "Streaming/AutoStreamable.h"
+
+STREAMABLE(PerceptionAttention,
+{
+  void draw() const
+  {
+    DEBUG_DRAWING("representation:PerceptionAttention", "drawingOnImage")
+      if(ballPredicted)
+        CIRCLE("representation:PerceptionAttention", ballInImage.x(), ballInImage.y(), ballRadiusInImage, 1,
+               Drawings::dashedPen, ColorRGBA::orange, Drawings::noBrush, ColorRGBA::orange);
+  },
+
+  (bool)(false) ballPredicted, /**< Is the ball predicted to be visible in the current image? */
+  (Vector2f)(Vector2f::Zero()) ballInImage, /**< The predicted center of the ball in the image. Only valid if \c ballPredicted. */
+  (float)(0.f) ballRadiusInImage, /**< The predicted radius of the ball in the image. Only valid if \c ballPredicted. */
+  (bool)(false) ballNear, /**< Is the ball predicted to be close to the robot? */
+  (bool)(true) detectRobots, /**< Should the robot detection network run in the current frame? */
+});
@@ -0,0 +1,120 @@
+/**
+ * @file RelativeFieldColors.cpp
+ *
+ * This file implements the classification of consecutive pixels with the
+ * thresholds of the representation RelativeFieldColors.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "RelativeFieldColors.h"
+#include "ImageProcessing/SIMD.h"
+
+/**
+ * Classifies consecutive pixels by checking whether luminance <= maxLuminance and
+ * saturation >= minSaturation (field) or luminance >= minLuminance and
+ * saturation <= maxSaturation (white). Thresholds outside the range of a byte
+ * are handled by the caller.
+ * @tparam field Check for field (otherwise white)?
+ * @param luminance The luminances of the checked pixels.
+ * @param saturation The saturations of the checked pixels.
+ * @param count The number of pixels checked.
+ * @param luminanceThreshold The threshold for the luminance.
+ * @param saturationThreshold The threshold for the saturation.
+ * @param handle16 Is called for each block of 16 pixels with an SSE register that
+ *                 contains 0xff for each pixel that satisfies the thresholds and 0 otherwise.
+ * @param handle1 Is called for each remaining pixel.
+ */
+template<bool field, typename Handle16, typename Handle1>
+static void classify(const PixelTypes::GrayscaledPixel* luminance, const PixelTypes::GrayscaledPixel* saturation, unsigned count,
+                     unsigned char luminanceThreshold, unsigned char saturationThreshold, Handle16 handle16, Handle1 handle1)
+{
+  const __m128i lumThreshold = _mm_set1_epi8(static_cast<char>(luminanceThreshold));
+  const __m128i satThreshold = _mm_set1_epi8(static_cast<char>(saturationThreshold));
+  unsigned i = 0;
+  for(; i + 16 <= count; i += 16)
+  {
+    const __m128i lum = _mm_loadu_si128(reinterpret_cast<const __m128i*>(luminance + i));
+    const __m128i sat = _mm_loadu_si128(reinterpret_cast<const __m128i*>(saturation + i));
+
+    // a <= b is equivalent to min(a, b) == a for unsigned bytes.
+    const __m128i lumOk = field ? _mm_cmpeq_epi8(_mm_min_epu8(lum, lumThreshold), lum) : _mm_cmpeq_epi8(_mm_max_epu8(lum, lumThreshold), lum);
+    const __m128i satOk = field ? _mm_cmpeq_epi8(_mm_max_epu8(sat, satThreshold), sat) : _mm_cmpeq_epi8(_mm_min_epu8(sat, satThreshold), sat);
+    handle16(i, _mm_and_si128(lumOk, satOk));
+  }
+  for(; i < count; ++i)
+    handle1(i, field ? luminance[i] <= luminanceThreshold && saturation[i] >= saturationThreshold
+                     : luminance[i] >= luminanceThreshold && saturation[i] <= saturationThreshold);
+}
+
+/**
+ * Determines the thresholds used by \c RelativeFieldColors::isFieldNearWhite.
+ * @param colors The representation that provides the parameters.
+ * @param luminanceReference The luminance of a neighboring reference that is known to be white.
+ * @param saturationReference The saturation of a neighboring reference that is known to be white.
+ * @param maxLuminance The maximum luminance of field pixels.
+ * @param minSaturation The minimum saturation of field pixels.
+ * @return Can any pixel be field at all?
+ */
+static bool getFieldThresholds(const RelativeFieldColors& colors, unsigned char luminanceReference, unsigned char saturationReference,
+                               unsigned char& maxLuminance, unsigned char& minSaturation)
+{
+  const int maxLum = std::min<int>(luminanceReference - colors.rfcParameters.minWhiteToFieldLuminanceDifference, colors.rfcParameters.maxFieldLuminance);
+  const int minSat = std::max<int>(saturationReference + colors.rfcParameters.minWhiteToFieldSaturationDifference,
+                                   std::max(static_cast<unsigned char>(colors.averageSaturation / 2.f), colors.rfcParameters.minFieldSaturation));
+  maxLuminance = static_cast<unsigned char>(std::max(maxLum, 0));
+  minSaturation = static_cast<unsigned char>(std::min(minSat, 255));
+  return maxLum >= 0 && minSat <= 255;
+}
+
+void RelativeFieldColors::classifyFieldNearWhite(const PixelTypes::GrayscaledPixel* luminance, const PixelTypes::GrayscaledPixel* saturation, unsigned count,
+                                                 unsigned char luminanceReference, unsigned char saturationReference, bool* isField) const
+{
+  static_assert(sizeof(bool) == 1);
+  unsigned char maxLuminance, minSaturation;
+  if(!getFieldThresholds(*this, luminanceReference, saturationReference, maxLuminance, minSaturation))
+    std::fill(isField, isField + count, false);
+  else
+  {
+    const __m128i c_1 = _mm_set1_epi8(1);
+    classify<true>(luminance, saturation, count, maxLuminance, minSaturation,
+                   [&](unsigned i, __m128i mask) {_mm_storeu_si128(reinterpret_cast<__m128i*>(isField + i), _mm_and_si128(mask, c_1));},
+                   [&](unsigned i, bool result) {isField[i] = result;});
+  }
+}
+
+unsigned RelativeFieldColors::countFieldNearWhite(const PixelTypes::GrayscaledPixel* luminance, const PixelTypes::GrayscaledPixel* saturation, unsigned count,
+                                                  unsigned char luminanceReference, unsigned char saturationReference) const
+{
+  unsigned char maxLuminance, minSaturation;
+  if(!getFieldThresholds(*this, luminanceReference, saturationReference, maxLuminance, minSaturation))
+    return 0;
+
+  // Sums of absolute differences add up the bytes in both halves of the mask.
+  const __m128i c_1 = _mm_set1_epi8(1);
+  __m128i sums = _mm_setzero_si128();
+  unsigned result = 0;
+  classify<true>(luminance, saturation, count, maxLuminance, minSaturation,
+                 [&](unsigned, __m128i mask) {sums = _mm_add_epi64(sums, _mm_sad_epu8(_mm_and_si128(mask, c_1), _mm_setzero_si128()));},
+                 [&](unsigned, bool isField) {result += isField ? 1 : 0;});
+  return result + static_cast<unsigned>(_mm_cvtsi128_si32(sums) + _mm_cvtsi128_si32(_mm_unpackhi_epi64(sums, sums)));
+}
+
+void RelativeFieldColors::classifyWhiteNearField(const PixelTypes::GrayscaledPixel* luminance, const PixelTypes::GrayscaledPixel* saturation, unsigned count,
+                                                 unsigned char luminanceReference, unsigned char saturationReference, bool* isWhite) const
+{
+  static_assert(sizeof(bool) == 1);
+  const int minLum = std::max<int>(luminanceReference + rfcParameters.minWhiteToFieldLuminanceDifference,
+                                   std::max(averageLuminance, rfcParameters.minWhiteLuminance));
+  const int maxSat = std::min<int>(saturationReference - rfcParameters.minWhiteToFieldSaturationDifference,
+                                   std::min(averageSaturation, rfcParameters.maxWhiteSaturation));
+  if(minLum > 255 || maxSat < 0)
+    std::fill(isWhite, isWhite + count, false);
+  else
+  {
+    const __m128i c_1 = _mm_set1_epi8(1);
+    classify<false>(luminance, saturation, count, static_cast<unsigned char>(minLum), static_cast<unsigned char>(maxSat),
+                    [&](unsigned i, __m128i mask) {_mm_storeu_si128(reinterpret_cast<__m128i*>(isWhite + i), _mm_and_si128(mask, c_1));},
+                    [&](unsigned i, bool result) {isWhite[i] = result;});
+  }
+}
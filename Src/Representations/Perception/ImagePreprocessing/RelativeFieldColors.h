@@ -11,6 +11,7 @@
 #pragma once
 
 #include "Representations/Configuration/RelativeFieldColorsParameters.h"
+#include "ImageProcessing/PixelTypes.h"
 #include "Streaming/AutoStreamable.h"
 #include "Math/Range.h"
 #include <algorithm>
@@ -60,7 +61,46 @@ STREAMABLE(RelativeFieldColors,
                                      std::max(averageLuminance, rfcParameters.minWhiteLuminance)) &&
           saturation <= std::min<int>(saturationReference - rfcParameters.minWhiteToFieldSaturationDifference,
                                       std::min(averageSaturation, rfcParameters.maxWhiteSaturation));
-  },
+  }
+
+  /**
+  * Checks for consecutive pixels whether they can belong to the field (see \c isFieldNearWhite).
+  * The pixels are processed with SSE.
+  * @param luminance The luminances of the checked pixels.
+  * @param saturation The saturations of the checked pixels.
+  * @param count The number of pixels checked.
+  * @param luminanceReference The luminance of a neighboring reference that is known to be white.
+  * @param saturationReference The saturation of a neighboring reference that is known to be white.
+  * @param isField Whether each of the checked pixels is field. Must provide space for \c count entries.
+  */
+  void classifyFieldNearWhite(const PixelTypes::GrayscaledPixel* luminance, const PixelTypes::GrayscaledPixel* saturation, unsigned count,
+                              unsigned char luminanceReference, unsigned char saturationReference, bool* isField) const;
+
+  /**
+  * Counts how many of consecutive pixels can belong to the field (see \c isFieldNearWhite).
+  * The pixels are processed with SSE.
+  * @param luminance The luminances of the checked pixels.
+  * @param saturation The saturations of the checked pixels.
+  * @param count The number of pixels checked.
+  * @param luminanceReference The luminance of a neighboring reference that is known to be white.
+  * @param saturationReference The saturation of a neighboring reference that is known to be white.
+  * @return The number of pixels that are field.
+  */
+  unsigned countFieldNearWhite(const PixelTypes::GrayscaledPixel* luminance, const PixelTypes::GrayscaledPixel* saturation, unsigned count,
+                               unsigned char luminanceReference, unsigned char saturationReference) const;
+
+  /**
+  * Checks for consecutive pixels whether they can belong to a white object (see \c isWhiteNearField).
+  * The pixels are processed with SSE.
+  * @param luminance The luminances of the checked pixels.
+  * @param saturation The saturations of the checked pixels.
+  * @param count The number of pixels checked.
+  * @param luminanceReference The luminance of a neighboring reference that is known to be field.
+  * @param saturationReference The saturation of a neighboring reference that is known to be field.
+  * @param isWhite Whether each of the checked pixels is white. Must provide space for \c count entries.
+  */
+  void classifyWhiteNearField(const PixelTypes::GrayscaledPixel* luminance, const PixelTypes::GrayscaledPixel* saturation, unsigned count,
+                              unsigned char luminanceReference, unsigned char saturationReference, bool* isWhite) const,
 
   (RelativeFieldColorsParameters) rfcParameters,   /**< Constant parameters loaded from configuration file. */
   (PixelTypes::GrayscaledPixel) averageLuminance,  /**< Approximated average luminance in the current image. */
@@ -43,4 +43,5 @@ STREAMABLE(FallDownState,
   (State)(pickedUp) state, /**< Current state of the robot's body. */
   (Direction)(none) direction, /**< The robot is falling / fell into this direction. */
   (float)(0) odometryRotationOffset,
+  (float)(-1.f) timeToFall, /**< The predicted time until the fall cannot be stopped anymore (in s). Negative if no fall is predicted. */
 });
@@ -0,0 +1,28 @@
+/**
+ * @file JointThermalModel.h
+ * This representation contains the temperatures of the joints predicted from their currents
+ * and the stiffnesses the motion engines are allowed to use to keep them below their limits.
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Streaming/AutoStreamable.h"
+#include "Streaming/EnumIndexedArray.h"
+#include "RobotParts/Joints.h"
+
+STREAMABLE(JointThermalModel,
+{
+  JointThermalModel(),
+
+  (ENUM_INDEXED_ARRAY(float, Joints::Joint)) temperatures, /**< The estimated current temperatures of the joints (in °C). */
+  (ENUM_INDEXED_ARRAY(float, Joints::Joint)) predictedTemperatures, /**< The temperatures of the joints predicted for the prediction horizon if the currents stay the same (in °C). */
+  (ENUM_INDEXED_ARRAY(int, Joints::Joint)) maxStiffnesses, /**< The maximum stiffnesses the joints should be used with (in %). */
+});
+
+inline JointThermalModel::JointThermalModel()
+{
+  temperatures.fill(0.f);
+  predictedTemperatures.fill(0.f);
+  maxStiffnesses.fill(100);
+}
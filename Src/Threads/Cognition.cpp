@@ -42,11 +42,13 @@ bool Cognition::beforeFrame()
     return false;
   }
 
-  const FrameInfo* lowerFrameInfo = Blackboard::getInstance().exists("LowerFrameInfo")
-                                    ? static_cast<FrameInfo*>(const_cast<Streamable*>(&Blackboard::getInstance()["LowerFrameInfo"]))
+  static const Blackboard::Id idLowerFrameInfo = Blackboard::getId("LowerFrameInfo");
+  static const Blackboard::Id idUpperFrameInfo = Blackboard::getId("UpperFrameInfo");
+  const FrameInfo* lowerFrameInfo = Blackboard::getInstance().exists(idLowerFrameInfo)
+                                    ? static_cast<FrameInfo*>(const_cast<Streamable*>(&Blackboard::getInstance()[idLowerFrameInfo]))
                                     : nullptr;
-  const FrameInfo* upperFrameInfo = Blackboard::getInstance().exists("UpperFrameInfo")
-                                    ? static_cast<FrameInfo*>(const_cast<Streamable*>(&Blackboard::getInstance()["UpperFrameInfo"]))
+  const FrameInfo* upperFrameInfo = Blackboard::getInstance().exists(idUpperFrameInfo)
+                                    ? static_cast<FrameInfo*>(const_cast<Streamable*>(&Blackboard::getInstance()[idUpperFrameInfo]))
                                     : nullptr;
   unsigned lowerFrameTime = lowerFrameInfo ? lowerFrameInfo->time : 0;
   unsigned upperFrameTime = upperFrameInfo ? upperFrameInfo->time : 0;
@@ -130,13 +132,14 @@ void Cognition::beforeModules()
 
 void Cognition::afterModules()
 {
-  if(Blackboard::getInstance().exists("BHumanMessageOutputGenerator")
-     && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()["BHumanMessageOutputGenerator"]).send
-     && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()["BHumanMessageOutputGenerator"]).sendThisFrame
-     && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()["BHumanMessageOutputGenerator"]).sendThisFrame())
+  static const Blackboard::Id idBHumanMessageOutputGenerator = Blackboard::getId("BHumanMessageOutputGenerator");
+  if(Blackboard::getInstance().exists(idBHumanMessageOutputGenerator)
+     && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()[idBHumanMessageOutputGenerator]).send
+     && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()[idBHumanMessageOutputGenerator]).sendThisFrame
+     && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()[idBHumanMessageOutputGenerator]).sendThisFrame())
   {
     BH_TRACE_MSG("before BHumanMessageOutputGenerator::send()");
-    static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()["BHumanMessageOutputGenerator"]).send();
+    static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()[idBHumanMessageOutputGenerator]).send();
   }
 }
 
@@ -20,12 +20,13 @@ bool Cognition2D::beforeFrame()
 
 void Cognition2D::afterModules()
 {
-  if(Blackboard::getInstance().exists("BHumanMessageOutputGenerator")
-     && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()["BHumanMessageOutputGenerator"]).send
-     && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()["BHumanMessageOutputGenerator"]).sendThisFrame
-     && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()["BHumanMessageOutputGenerator"]).sendThisFrame())
+  static const Blackboard::Id idBHumanMessageOutputGenerator = Blackboard::getId("BHumanMessageOutputGenerator");
+  if(Blackboard::getInstance().exists(idBHumanMessageOutputGenerator)
+     && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()[idBHumanMessageOutputGenerator]).send
+     && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()[idBHumanMessageOutputGenerator]).sendThisFrame
+     && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()[idBHumanMessageOutputGenerator]).sendThisFrame())
   {
     BH_TRACE_MSG("before BHumanMessageOutputGenerator::send()");
-    static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()["BHumanMessageOutputGenerator"]).send();
+    static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()[idBHumanMessageOutputGenerator]).send();
   }
 }
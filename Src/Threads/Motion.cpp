@@ -28,7 +28,8 @@ void Motion::afterModules()
 
 bool Motion::afterFrame()
 {
-  if(Blackboard::getInstance().exists("JointSensorData"))
+  static const Blackboard::Id idJointSensorData = Blackboard::getId("JointSensorData");
+  if(Blackboard::getInstance().exists(idJointSensorData))
   {
     BH_TRACE_MSG("before waitForFrameData");
     NaoProvider::waitForFrameData();
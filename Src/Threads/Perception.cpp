@@ -29,7 +29,8 @@ void Perception::beforeModules()
 
 bool Perception::afterFrame()
 {
-  if(Blackboard::getInstance().exists("CameraImage"))
+  static const Blackboard::Id idCameraImage = Blackboard::getId("CameraImage");
+  if(Blackboard::getInstance().exists(idCameraImage))
   {
     if(SystemCall::getMode() == SystemCall::physicalRobot)
       Thread::getCurrentThread()->setPriority(10);
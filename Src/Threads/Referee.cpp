@@ -11,6 +11,7 @@
 #include "Framework/ModuleContainer.h"
 #include "Modules/Infrastructure/LogDataProvider/LogDataProvider.h"
 #include "Platform/Thread.h"
+#include "Platform/Time.h"
 #include "Representations/Perception/ImagePreprocessing/OptionalCameraImage.h"
 
 REGISTER_EXECUTION_UNIT(Referee)
@@ -37,12 +38,15 @@ bool Referee::beforeFrame()
                    || Global::getDebugRequestTable().pollCounter > 0;
   receivedDebugData = false;
 
-  // If a new image was received, the thread should run as well.
-  if(Blackboard::getInstance().exists("OptionalCameraImage"))
+  // If a new image was received, the thread should run as well, unless it is too late
+  // to process that image. Then, it waits for the next one.
+  static const Blackboard::Id idOptionalCameraImage = Blackboard::getId("OptionalCameraImage");
+  if(Blackboard::getInstance().exists(idOptionalCameraImage))
   {
-    const OptionalCameraImage& image = static_cast<OptionalCameraImage&>(Blackboard::getInstance()["OptionalCameraImage"]);
-    const unsigned currentTimeStamp = image.image.has_value() ? image.image.value().timestamp : 0;
-    shouldRun |= lastImageTimestamp != currentTimeStamp;
+    const OptionalCameraImage& image = static_cast<OptionalCameraImage&>(Blackboard::getInstance()[idOptionalCameraImage]);
+    const unsigned currentTimeStamp = image.image ? image.image->timestamp : 0;
+    shouldRun |= lastImageTimestamp != currentTimeStamp
+                 && (!image.deadline || Time::getTimeSince(image.deadline) <= 0);
     lastImageTimestamp = currentTimeStamp;
   }
 
@@ -304,6 +304,8 @@ namespace cabsl
        */
       template<typename U> typename std::enable_if<isStreamable<U>::value>::type addArgument(const char* name, const U& value) const
       {
+        if(!instance->recordActivationGraph)
+          return; // Do not format arguments that are never shown
         name += 1 + static_cast<int>(std::string(name).find_last_of(" )"));
         OutStringStream stream;
         stream << value;
@@ -319,7 +321,7 @@ namespace cabsl
        */
       void addToActivationGraph() const
       {
-        if(!context.addedToGraph && instance->activationGraph)
+        if(!context.addedToGraph && instance->recordActivationGraph)
         {
           instance->activationGraph->graph.emplace_back(optionName, instance->depth,
                                                         context.stateName,
@@ -484,6 +486,9 @@ namespace cabsl
     unsigned lastFrameTime = 0; /**< The timestamp of the last time the behavior was executed. */
     int depth = 0; /**< The depth level of the current option. Used for activation graph. */
     ActivationGraph* activationGraph; /**< The activation graph for debug output. Can be zero if not set. */
+    unsigned activationGraphInterval; /**< The activation graph is only recorded in every n-th frame. */
+    unsigned framesUntilActivationGraph = 0; /**< The number of frames until the activation graph is recorded again. */
+    bool recordActivationGraph = false; /**< Is the activation graph recorded in the current frame? */
 
   protected:
     static thread_local Cabsl* _theInstance; /**< The instance of this behavior used. */
@@ -493,9 +498,13 @@ namespace cabsl
      * Constructor.
      * @param activationGraph When set, the activation graph will be filled with the
      *                        options and states executed in each frame.
+     * @param activationGraphInterval The activation graph is only filled in every n-th
+     *                                frame. In all other frames, it keeps its previous
+     *                                content and the options do not format their arguments.
      */
-    Cabsl(ActivationGraph* activationGraph = nullptr) :
-      activationGraph(activationGraph)
+    Cabsl(ActivationGraph* activationGraph = nullptr, unsigned activationGraphInterval = 1) :
+      activationGraph(activationGraph),
+      activationGraphInterval(std::max(activationGraphInterval, 1u))
     {
       static_cast<void>(&collectOptions); // Enforce linking of this global object
     }
@@ -511,8 +520,14 @@ namespace cabsl
         _currentFrameTime = frameTime;
       else
         _currentFrameTime = std::max(frameTime, lastFrameTime + 1);
-      if(activationGraph)
+      recordActivationGraph = activationGraph && framesUntilActivationGraph == 0;
+      if(recordActivationGraph)
+      {
         activationGraph->graph.clear();
+        framesUntilActivationGraph = activationGraphInterval;
+      }
+      if(activationGraph)
+        --framesUntilActivationGraph;
       _theInstance = this;
       OptionInfos::executeInitHandlers();
     }
@@ -0,0 +1,60 @@
+/**
+ * @file FrameMemo.h
+ *
+ * This file declares a cache for the results of a computation that are only
+ * valid within a single frame. Behaviors evaluate the same helper functions
+ * with the same arguments several times per frame, e.g. when an option is
+ * evaluated to check whether it is applicable and is executed afterwards.
+ * The cache is searched linearly, because it is meant for computations
+ * that are only performed a few times per frame, but are costly.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include <deque>
+#include <utility>
+
+template<typename Key, typename Value> class FrameMemo
+{
+public:
+  const char* name; /**< The name of the cache (for debugging). */
+  unsigned hits = 0; /**< How often was a result reused? */
+  unsigned misses = 0; /**< How often was a result computed? */
+
+  /**
+   * Constructor.
+   * @param name The name of the cache (for debugging).
+   */
+  FrameMemo(const char* name) : name(name) {}
+
+  /**
+   * Returns the result for a key. It is only computed if it was not computed
+   * before in the same frame.
+   * @param time The time of the current frame. All results of other frames are removed.
+   * @param key The arguments of the computation. Must be comparable by ==.
+   * @param compute The computation. It is called without parameters.
+   * @return The result. The reference stays valid until the next frame.
+   */
+  template<typename Compute> const Value& get(unsigned time, const Key& key, Compute&& compute)
+  {
+    if(time != this->time)
+    {
+      entries.clear();
+      this->time = time;
+    }
+    for(const std::pair<Key, Value>& entry : entries)
+      if(entry.first == key)
+      {
+        ++hits;
+        return entry.second;
+      }
+    ++misses;
+    return entries.emplace_back(key, compute()).second;
+  }
+
+private:
+  unsigned time = 0; /**< The time of the frame the results were computed in. */
+  std::deque<std::pair<Key, Value>> entries; /**< The results of this frame. A deque does not move them when it grows. */
+};
@@ -13,6 +13,9 @@
 #include "Math/Eigen.h"
 #include "Math/Pose2f.h"
 #include "Math/Range.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 namespace KickSelection
 {
@@ -76,6 +79,38 @@ namespace KickSelection
     return ttrp;
   }
 
+  /**
+   * Estimates the times needed to reach several target poses by counting the steps the
+   * walking engine needs if every step is as large as possible. Sideways steps are only
+   * made with every second step. Since the robot does not turn towards the target first
+   * and translation and rotation are combined freely, this is a lower bound that is best
+   * suited for close target poses.
+   * @param posesRelative The target poses in robot-relative coordinates.
+   * @param maxStepSize The maximum step size of the walking engine (see \c WalkingEngineOutput).
+   * @param maxBackwardStepSize The maximum backward step size of the walking engine.
+   * @param walkStepDuration The duration of a single step (in seconds).
+   * @param ttrps The estimated times to reach the target poses (in milliseconds). Resized to the number of poses.
+   */
+  inline void calcStepTTRPs(const std::vector<Pose2f>& posesRelative, const Pose2f& maxStepSize, float maxBackwardStepSize,
+                            float walkStepDuration, std::vector<float>& ttrps)
+  {
+    const float forwardFactor = 1.f / maxStepSize.translation.x();
+    const float backwardFactor = -1.f / maxBackwardStepSize;
+    const float sideFactor = 2.f / maxStepSize.translation.y();
+    const float rotationFactor = 1.f / maxStepSize.rotation;
+    const float stepDuration = walkStepDuration * 1000.f;
+
+    ttrps.resize(posesRelative.size());
+    for(std::size_t i = 0; i < posesRelative.size(); ++i)
+    {
+      const Pose2f& pose = posesRelative[i];
+      const float forwardSteps = pose.translation.x() * (pose.translation.x() >= 0.f ? forwardFactor : backwardFactor);
+      const float sideSteps = std::abs(pose.translation.y()) * sideFactor;
+      const float rotationSteps = std::abs(pose.rotation) * rotationFactor;
+      ttrps[i] = std::ceil(std::max(std::max(forwardSteps, sideSteps), rotationSteps)) * stepDuration;
+    }
+  }
+
   /**
    * Calculates an absolute rotation for the robot at receiverPosition that allows it to receive a pass from ballPosition and redirect the ball to goalPosition if possible.
    * @param ballPosition The position of the ball on the field.
@@ -0,0 +1,43 @@
+/**
+ * @file TaskPool.cpp
+ *
+ * This file implements a pool of worker threads that is shared by all behavior
+ * computations that evaluate many independent candidates.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "TaskPool.h"
+#include "Framework/ParallelExecutor.h"
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+namespace TaskPool
+{
+  static std::mutex mutex; /**< Is locked while the pool is used. */
+  static std::unique_ptr<ParallelExecutor> executor; /**< The worker threads. Created when the pool is used for the first time. */
+  static std::vector<unsigned> numOfPredecessors; /**< No task depends on another one. */
+  static std::vector<std::vector<std::size_t>> successors; /**< No task depends on another one. */
+
+  void execute(std::size_t numOfTasks, const std::function<void(std::size_t)>& run, bool parallel)
+  {
+    std::unique_lock<std::mutex> lock(mutex, std::defer_lock);
+    if(parallel && numOfTasks > 1 && lock.try_lock())
+    {
+      if(!executor)
+      {
+        // The calling thread also works on the tasks. At most two additional
+        // cores are used, because other threads run at the same time.
+        const std::size_t numOfWorkers = std::min(2u, std::max(std::thread::hardware_concurrency(), 1u) - 1);
+        executor = std::make_unique<ParallelExecutor>("TaskPool", numOfWorkers, 0, [](std::size_t) {});
+      }
+      numOfPredecessors.assign(numOfTasks, 0);
+      successors.resize(numOfTasks);
+      executor->execute(numOfPredecessors, successors, run);
+    }
+    else
+      for(std::size_t i = 0; i < numOfTasks; ++i)
+        run(i);
+  }
+}
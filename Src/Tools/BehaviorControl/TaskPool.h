@@ -0,0 +1,32 @@
+/**
+ * @file TaskPool.h
+ *
+ * This file declares a pool of worker threads that is shared by all behavior
+ * computations that evaluate many independent candidates, e.g. possible kick
+ * targets. Only one caller can use the pool at a time. If it is busy, e.g.
+ * because several robots are simulated in the same process, the tasks are
+ * executed serially by the calling thread.
+ *
+ * The tasks are executed in threads that have no debugging infrastructure,
+ * i.e. they must neither draw, nor output text, nor modify shared state
+ * other than their own results.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace TaskPool
+{
+  /**
+   * Executes a number of independent tasks. Returns after all of them are finished.
+   * @param numOfTasks The number of tasks.
+   * @param run The function that executes the task with the index passed.
+   * @param parallel Should the tasks be distributed across the worker threads
+   *                 if the pool is not busy? Otherwise, they are executed serially.
+   */
+  void execute(std::size_t numOfTasks, const std::function<void(std::size_t)>& run, bool parallel = true);
+}
@@ -0,0 +1,84 @@
+/**
+ * @file VisibilityTable.cpp
+ *
+ * This file implements a table that stores which parts of the field around the
+ * robot are seen by the upper camera for a set of head orientations.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "VisibilityTable.h"
+#include "Representations/Configuration/HeadLimits.h"
+#include "Representations/Infrastructure/CameraInfo.h"
+#include "Representations/Modeling/RobotPose.h"
+#include "Representations/Perception/ImagePreprocessing/CameraMatrix.h"
+#include "Representations/Sensing/TorsoMatrix.h"
+#include "Tools/Math/Projection.h"
+#include <cmath>
+
+void VisibilityTable::compute(const TorsoMatrix& torsoMatrix, const RobotDimensions& robotDimensions,
+                              const CameraCalibration& cameraCalibration, const CameraInfo& cameraInfo,
+                              const FieldDimensions& fieldDimensions, const HeadLimits& headLimits, Angle panStep,
+                              const std::vector<Angle>& tilts, Angle directionStep, float distanceStep, float maxDistance)
+{
+  this->directionStep = directionStep;
+  this->distanceStep = distanceStep;
+  numOfDirections = static_cast<std::size_t>(std::ceil(pi2 / directionStep));
+  numOfDistances = static_cast<std::size_t>(std::ceil(maxDistance / distanceStep));
+  wordsPerGaze = (numOfDirections * numOfDistances + 63) / 64;
+
+  // The centers of all cells.
+  std::vector<Vector2f> centers;
+  centers.reserve(numOfDirections * numOfDistances);
+  for(std::size_t distance = 0; distance < numOfDistances; ++distance)
+    for(std::size_t direction = 0; direction < numOfDirections; ++direction)
+      centers.emplace_back(Vector2f((static_cast<float>(distance) + 0.5f) * distanceStep, 0.f)
+                           .rotate(-pi + (static_cast<float>(direction) + 0.5f) * directionStep));
+
+  torsoHeight = torsoMatrix.translation.z();
+  gazes.clear();
+  visibility.clear();
+  std::vector<Vector2f> fieldOfView;
+  for(Angle pan = headLimits.minPan(); pan <= headLimits.maxPan(); pan += panStep)
+    for(Angle tilt : tilts)
+      if(headLimits.getTiltBound(pan).isInside(tilt))
+      {
+        const CameraMatrix cameraMatrix(torsoMatrix, RobotCameraMatrix(robotDimensions, pan, tilt, cameraCalibration, CameraInfo::upper),
+                                        cameraCalibration);
+        Projection::computeFieldOfViewInFieldCoordinates(RobotPose(), cameraMatrix, cameraInfo, fieldDimensions, fieldOfView);
+        gazes.push_back({pan, tilt});
+        visibility.resize(visibility.size() + wordsPerGaze, 0);
+        std::uint64_t* bits = &visibility[visibility.size() - wordsPerGaze];
+        for(std::size_t cell = 0; cell < centers.size(); ++cell)
+          if(Geometry::isPointInsideConvexPolygon(fieldOfView.data(), static_cast<int>(fieldOfView.size()), centers[cell]))
+            bits[cell / 64] |= std::uint64_t(1) << (cell % 64);
+      }
+}
+
+std::size_t VisibilityTable::getCell(const Vector2f& pointRelative) const
+{
+  const std::size_t distance = static_cast<std::size_t>(pointRelative.norm() / distanceStep);
+  if(distance >= numOfDistances)
+    return noCell;
+  const std::size_t direction = std::min(static_cast<std::size_t>((pointRelative.angle() + pi) / directionStep), numOfDirections - 1);
+  return distance * numOfDirections + direction;
+}
+
+std::size_t VisibilityTable::getBestGaze(const std::vector<WeightedCell>& cells) const
+{
+  std::size_t bestGaze = 0;
+  float bestScore = 0.f;
+  for(std::size_t gaze = 0; gaze < gazes.size(); ++gaze)
+  {
+    float score = 0.f;
+    for(const WeightedCell& cell : cells)
+      if(isVisible(gaze, cell.cell))
+        score += cell.weight;
+    if(score > bestScore)
+    {
+      bestScore = score;
+      bestGaze = gaze;
+    }
+  }
+  return bestGaze;
+}
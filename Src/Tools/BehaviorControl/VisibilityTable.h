@@ -0,0 +1,106 @@
+/**
+ * @file VisibilityTable.h
+ *
+ * This file declares a table that stores which parts of the field around the
+ * robot are seen by the upper camera for a set of head orientations (gazes).
+ * The area around the robot is divided into polar cells, i.e. into rings of
+ * directions. Since these cells are relative to the robot, the table does not
+ * depend on the robot's pose on the field and only has to be recomputed if the
+ * height of the camera changes noticeably. Scoring a gaze against a set of
+ * points on the field is then reduced to table lookups.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Math/Angle.h"
+#include "Math/Eigen.h"
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+struct CameraCalibration;
+struct CameraInfo;
+struct FieldDimensions;
+struct HeadLimits;
+struct RobotDimensions;
+struct TorsoMatrix;
+
+class VisibilityTable
+{
+public:
+  static constexpr std::size_t noCell = std::numeric_limits<std::size_t>::max(); /**< The cell index of points outside the table. */
+
+  /** A head orientation. */
+  struct Gaze
+  {
+    Angle pan;
+    Angle tilt;
+  };
+
+  /** A cell with a weight, i.e. how interesting it is to look at that cell. */
+  struct WeightedCell
+  {
+    std::size_t cell; /**< The index of the cell. */
+    float weight; /**< The weight of the cell. Must not be negative. */
+  };
+
+  /**
+   * Fills the table. All gazes within the head limits are sampled.
+   * @param torsoMatrix The current pose of the torso relative to the ground.
+   * @param robotDimensions The dimensions of the robot.
+   * @param cameraCalibration The calibration of the cameras.
+   * @param cameraInfo The opening angles of the upper camera.
+   * @param fieldDimensions The dimensions of the field.
+   * @param headLimits The limits of the head joints.
+   * @param panStep The distance between two pan angles sampled.
+   * @param tilts The tilt angles sampled.
+   * @param directionStep The angular size of a cell.
+   * @param distanceStep The radial size of a cell.
+   * @param maxDistance The maximum distance of cells from the robot.
+   */
+  void compute(const TorsoMatrix& torsoMatrix, const RobotDimensions& robotDimensions,
+               const CameraCalibration& cameraCalibration, const CameraInfo& cameraInfo,
+               const FieldDimensions& fieldDimensions, const HeadLimits& headLimits, Angle panStep, const std::vector<Angle>& tilts,
+               Angle directionStep, float distanceStep, float maxDistance);
+
+  /**
+   * Returns the cell a point is located in.
+   * @param pointRelative The point relative to the robot.
+   * @return The index of the cell or \c noCell if the point is too far away.
+   */
+  std::size_t getCell(const Vector2f& pointRelative) const;
+
+  /**
+   * Returns the gaze that sees the highest sum of weights.
+   * @param cells The cells of interest with their weights.
+   * @return The index of the best gaze. 0 if none of the cells is seen by any gaze.
+   */
+  std::size_t getBestGaze(const std::vector<WeightedCell>& cells) const;
+
+  /**
+   * Is a cell seen when looking in a certain direction?
+   * @param gaze The index of the gaze.
+   * @param cell The index of the cell.
+   * @return Is it visible?
+   */
+  bool isVisible(std::size_t gaze, std::size_t cell) const
+  {
+    return (visibility[gaze * wordsPerGaze + cell / 64] >> (cell % 64)) & 1;
+  }
+
+  /** The table is empty before it was computed for the first time. */
+  bool empty() const {return gazes.empty();}
+
+  std::vector<Gaze> gazes; /**< The head orientations that were sampled. */
+  float torsoHeight = 0.f; /**< The height of the torso the table was computed for. */
+
+private:
+  Angle directionStep; /**< The angular size of a cell. */
+  float distanceStep; /**< The radial size of a cell. */
+  std::size_t numOfDirections; /**< The number of cells per ring. */
+  std::size_t numOfDistances; /**< The number of rings. */
+  std::size_t wordsPerGaze; /**< The number of bit vector entries per gaze. */
+  std::vector<std::uint64_t> visibility; /**< For each gaze, a bit per cell that states whether the cell is seen. */
+};
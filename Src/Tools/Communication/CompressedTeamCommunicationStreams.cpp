@@ -1134,12 +1134,20 @@ void CompressedTeamCommunication::Base::deselect()
 void CompressedTeamCommunicationIn::readBits(void* data, std::size_t bits)
 {
   std::uint8_t* cdata = reinterpret_cast<std::uint8_t*>(data);
-  for(std::size_t i = 0; i < bits; ++i, ++containerOffset)
+
+  // Copy chunks that end at the next byte boundary of the data, i.e. up to 8 bits at once.
+  for(std::size_t i = 0; i < bits;)
   {
-    if(container[containerOffset / 8] & (1 << (containerOffset % 8)))
-      cdata[i / 8] |= 1 << (i % 8);
-    else
-      cdata[i / 8] &= ~(1 << (i % 8));
+    const unsigned dataShift = static_cast<unsigned>(i % 8);
+    const unsigned containerShift = static_cast<unsigned>(containerOffset % 8);
+    const unsigned n = static_cast<unsigned>(std::min<std::size_t>(8 - dataShift, bits - i));
+    unsigned value = container[containerOffset / 8] >> containerShift;
+    if(containerShift + n > 8)
+      value |= container[containerOffset / 8 + 1] << (8 - containerShift);
+    const unsigned mask = ((1u << n) - 1) << dataShift;
+    cdata[i / 8] = static_cast<std::uint8_t>((cdata[i / 8] & ~mask) | ((value << dataShift) & mask));
+    i += n;
+    containerOffset += n;
   }
 }
 
@@ -1374,8 +1382,20 @@ void CompressedTeamCommunicationOut::writeBits(const void* data, std::size_t bit
 {
   const std::uint8_t* cdata = reinterpret_cast<const std::uint8_t*>(data);
   container.resize((containerOffset + bits + 7) / 8, 0);
-  for(std::size_t i = 0; i < bits; ++i, ++containerOffset)
-    container[containerOffset / 8] |= ((cdata[i / 8] >> (i % 8)) & 1) << (containerOffset % 8);
+
+  // Copy chunks that end at the next byte boundary of the container, i.e. up to 8 bits at once.
+  for(std::size_t i = 0; i < bits;)
+  {
+    const unsigned dataShift = static_cast<unsigned>(i % 8);
+    const unsigned containerShift = static_cast<unsigned>(containerOffset % 8);
+    const unsigned n = static_cast<unsigned>(std::min<std::size_t>(8 - containerShift, bits - i));
+    unsigned value = cdata[i / 8] >> dataShift;
+    if(dataShift + n > 8)
+      value |= cdata[i / 8 + 1] << (8 - dataShift);
+    container[containerOffset / 8] |= static_cast<std::uint8_t>((value & ((1u << n) - 1)) << containerShift);
+    i += n;
+    containerOffset += n;
+  }
 }
 
 template<typename Integer>
@@ -12,7 +12,9 @@
 
 #include "GameControllerRBS.h"
 #include "Debugging/Annotation.h"
+#include "MathBase/BHMath.h"
 #include "Platform/Time.h"
+#include <limits>
 
 void GameControllerRBS::operator>>(BHumanMessage& m) const
 {
@@ -98,21 +100,25 @@ void GameControllerRBS::operator<<(const BHumanMessage& m)
   if(m.referenceGameControllerPacketTimestampOffset == std::numeric_limits<decltype(m.referenceGameControllerPacketTimestampOffset)>::max())
     return;
 
-  const auto lookupGameControllerPacket = [this](unsigned number)
+  const auto lookupGameControllerPacket = [this](unsigned number) -> const GameControllerPacket*
   {
     for(const auto& packet : gameControllerPacketBuffer)
       if(packet.number == number)
-        return packet.timestamp;
-    return 0u;
+        return &packet;
+    return nullptr;
   };
 
-  const unsigned ownReferenceGameControllerPacketTimestamp = lookupGameControllerPacket(m.referenceGameControllerPacketNumber);
-  if(!ownReferenceGameControllerPacketTimestamp)
+  const GameControllerPacket* ownReferenceGameControllerPacket = lookupGameControllerPacket(m.referenceGameControllerPacketNumber);
+  if(!ownReferenceGameControllerPacket)
     return;
 
   // This offset is *subtracted* from the remote timestamp to get the local timestamp.
-  const int offset = m.timestamp + timestampOffset - m.referenceGameControllerPacketTimestampOffset - ownReferenceGameControllerPacketTimestamp;
-  remoteSMB.update(offset, ownReferenceGameControllerPacketTimestamp);
+  // The own receive timestamp was taken by the kernel with sub-millisecond resolution, but the
+  // remote one was truncated to milliseconds. Therefore, the remote receive time is on average
+  // half a millisecond later than transmitted.
+  const int offset = m.timestamp + timestampOffset - m.referenceGameControllerPacketTimestampOffset - ownReferenceGameControllerPacket->timestamp;
+  remoteSMB.update(static_cast<float>(offset) + 0.5f - static_cast<float>(ownReferenceGameControllerPacket->timestampUs) / 1000.f,
+                   ownReferenceGameControllerPacket->timestamp);
 }
 
 void GameControllerRBS::update()
@@ -132,13 +138,108 @@ void GameControllerRBS::update()
      (gameControllerPacketBuffer.empty() ||
       theGameControllerData.packetNumber != gameControllerPacketBuffer.front().number ||
       theGameControllerData.timeLastPacketReceived != gameControllerPacketBuffer.front().timestamp))
-    gameControllerPacketBuffer.push_front(GameControllerPacket(theGameControllerData.packetNumber, theGameControllerData.timeLastPacketReceived));
+    gameControllerPacketBuffer.push_front(GameControllerPacket(theGameControllerData.packetNumber, theGameControllerData.timeLastPacketReceived,
+                                                               theGameControllerData.timeLastPacketReceivedUs));
 }
 
-void SynchronizationMeasurementsBuffer::update(int newOffset, unsigned newTimestamp)
+void SynchronizationMeasurementsBuffer::update(float newOffset, unsigned newTimestamp)
 {
-  offset = newOffset;
-  timestamp = newTimestamp;
+  // Each team message references the newest GameController packet, i.e. several messages
+  // result in the same measurement. It must only be used once, or it would dominate the fit.
+  for(const Measurement& measurement : measurements)
+    if(measurement.timestamp == newTimestamp)
+      return;
+
+  measurements.push_front({newOffset, newTimestamp});
+  fit();
+}
+
+void SynchronizationMeasurementsBuffer::invalidate()
+{
+  measurements.clear();
+
+  // By default, an offset of 0 is set, so that robots that were started at the same time
+  // will still be approximately correct (if \c isValid is ignored).
+  offset = drift = offsetDeviation = driftDeviation = 0.f;
+  timestamp = 0;
+}
+
+void SynchronizationMeasurementsBuffer::fit()
+{
+  timestamp = 0;
+  for(const Measurement& measurement : measurements)
+    if(static_cast<int>(measurement.timestamp - timestamp) > 0)
+      timestamp = measurement.timestamp;
+
+  // Remove measurements that are too old. They are not necessarily at the end of the buffer,
+  // so the remaining ones are also checked below.
+  while(measurements.back().timestamp + maxMeasurementAge < timestamp)
+    measurements.pop_back();
+
+  // First fit all measurements, then only the ones close to the first fit.
+  float maxResidual = std::numeric_limits<float>::max();
+  for(int iteration = 0; iteration < 2; ++iteration)
+  {
+    // Sums relative to the newest measurement.
+    int n = 0;
+    float sumT = 0.f, sumO = 0.f;
+    unsigned minTimestamp = timestamp;
+    for(const Measurement& measurement : measurements)
+      if(measurement.timestamp + maxMeasurementAge >= timestamp
+         && std::abs(getOffset(measurement.timestamp) - measurement.offset) <= maxResidual)
+      {
+        ++n;
+        sumT += static_cast<float>(static_cast<int>(measurement.timestamp - timestamp));
+        sumO += measurement.offset;
+        minTimestamp = std::min(minTimestamp, measurement.timestamp);
+      }
+    if(n == 0)
+      break;
+
+    const float meanT = sumT / static_cast<float>(n);
+    const float meanO = sumO / static_cast<float>(n);
+    float sumTT = 0.f, sumTO = 0.f;
+    for(const Measurement& measurement : measurements)
+      if(measurement.timestamp + maxMeasurementAge >= timestamp
+         && std::abs(getOffset(measurement.timestamp) - measurement.offset) <= maxResidual)
+      {
+        const float t = static_cast<float>(static_cast<int>(measurement.timestamp - timestamp)) - meanT;
+        sumTT += t * t;
+        sumTO += t * (measurement.offset - meanO);
+      }
+
+    // The drift is only estimated if the measurements cover a sufficient period of time.
+    // Otherwise, the maximum drift is assumed for the uncertainty.
+    const bool estimateDrift = n >= 3 && timestamp - minTimestamp >= minDriftEstimationPeriod;
+    const float maxDrift = 2.f / static_cast<float>(clockDriftDivider);
+    const float newDrift = estimateDrift ? std::clamp(sumTO / sumTT, -maxDrift, maxDrift) : 0.f;
+    const float newOffset = meanO - newDrift * meanT;
+
+    float sumRR = 0.f;
+    for(const Measurement& measurement : measurements)
+      if(measurement.timestamp + maxMeasurementAge >= timestamp
+         && std::abs(getOffset(measurement.timestamp) - measurement.offset) <= maxResidual)
+        sumRR += sqr(newOffset + newDrift * static_cast<float>(static_cast<int>(measurement.timestamp - timestamp)) - measurement.offset);
+    const int degreesOfFreedom = n - (estimateDrift ? 2 : 1);
+    const float variance = std::max(degreesOfFreedom > 0 ? sumRR / static_cast<float>(degreesOfFreedom) : 0.f, sqr(quantizationDeviation));
+
+    offset = newOffset;
+    drift = newDrift;
+    offsetDeviation = std::sqrt(variance * (1.f / static_cast<float>(n) + (estimateDrift ? sqr(meanT) / sumTT : 0.f)));
+    driftDeviation = estimateDrift ? std::sqrt(variance / sumTT) : maxDrift;
+    maxResidual = maxOutlierDistance;
+  }
+}
+
+float SynchronizationMeasurementsBuffer::getUncertainty(unsigned localTime) const
+{
+#ifdef TARGET_ROBOT
+  const float timeSinceMeasurement = static_cast<float>(static_cast<int>(localTime - timestamp));
+  return std::sqrt(sqr(offsetDeviation) + sqr(driftDeviation * timeSinceMeasurement));
+#else
+  static_cast<void>(localTime);
+  return 0.f;
+#endif
 }
 
 void SynchronizationMeasurementsBuffer::validate(unsigned sendTimestamp, unsigned receiveTimestamp)
@@ -152,7 +253,7 @@ void SynchronizationMeasurementsBuffer::validate(unsigned sendTimestamp, unsigne
 
   // Given the previously known offset and the receive timestamp,
   // this is the expected send timestamp (in the sender's frame) if there was neither network delay nor clock drift:
-  const int expectedSendTimestamp = static_cast<int>(receiveTimestamp) + offset;
+  const int expectedSendTimestamp = static_cast<int>(receiveTimestamp) + static_cast<int>(std::round(getOffset(receiveTimestamp)));
 
   // maxGCPacketReceiveDelay basically bounds the difference between
   // \c GameController::timeLastPacketReceived of sender and receiver. It is the inherent error bound of
@@ -169,9 +270,7 @@ void SynchronizationMeasurementsBuffer::validate(unsigned sendTimestamp, unsigne
   const Range<unsigned> possibleSendTimestampRange(expectedSendTimestamp - errorBound - maxTeamMessageSendReceiveDelay, expectedSendTimestamp + errorBound);
   if(!possibleSendTimestampRange.isInside(sendTimestamp))
   {
-    // By default, an offset of 0 is set, so that robots that were started at the same time
-    // will still be approximately correct (if \c isValid is ignored).
-    update(0, 0);
+    invalidate();
 
     ANNOTATION("GameControllerRBS", "Invalidated synchronization; send timestamp expected to be in [" << possibleSendTimestampRange.min << ", " << possibleSendTimestampRange.max << "] but was " << sendTimestamp << ".");
   }
@@ -17,29 +17,56 @@
 #include "Tools/Communication/BHumanMessageParticle.h"
 #include "MathBase/RingBuffer.h"
 #include "Framework/Settings.h"
+#include <algorithm>
+#include <cmath>
 
 /**
  * @class SynchronizationMeasurementsBuffer
  *
- * A class for keeping a valid synchronization measurement.
+ * A class for keeping the recent synchronization measurements with another robot.
+ * The offset between the clocks is modeled as a linear function of the local
+ * time, i.e. the relative drift of the two clocks is estimated as well.
  */
 class SynchronizationMeasurementsBuffer
 {
 private:
-  int offset = 0; ///< Offset of the time of another robot relative to the own time.
-  unsigned timestamp = 0; ///< The time when this measurement has been made (used to calculate how much the clock may have drifted at a later point).
+  /** A single measurement of the clock offset. */
+  struct Measurement
+  {
+    float offset; ///< Offset of the time of another robot relative to the own time (in ms, with sub-millisecond resolution).
+    unsigned timestamp; ///< The (local) time when this measurement has been made.
+  };
+
+  RingBuffer<Measurement, 16> measurements; ///< The recent measurements, newest first.
+
+  float offset = 0.f; ///< The offset at \c timestamp according to the linear model.
+  float drift = 0.f; ///< How much the offset changes per ms of local time.
+  float offsetDeviation = 0.f; ///< The standard deviation of \c offset (in ms).
+  float driftDeviation = 0.f; ///< The standard deviation of \c drift. If the drift is not estimated, this is the maximum drift.
+  unsigned timestamp = 0; ///< The time of the newest measurement (used to calculate how much the clock may have drifted at a later point). 0 if invalid.
 
   static constexpr unsigned int clockDriftDivider = 5000; ///< The time it takes at least to accumulate a clock error of 1ms on a robot clock (with respect to "real" time). NOT EMPIRICALLY VALIDATED YET!
   static constexpr unsigned int maxTeamMessageSendReceiveDelay = 2000; ///< The maximum time that can pass between the send timestamp of a team message is taken at the sender and the receive timestamp is taken at the receiver. NOT EMPIRICALLY VALIDATED YET!
   static constexpr unsigned int maxGCPacketReceiveDelay = 5; ///< The maximum time that can pass after the arrival of a GameController packet at the NIC until its timestamp (\c GameControllerData::timeLastPacketReceived) is taken.
+  static constexpr unsigned int minDriftEstimationPeriod = 20000; ///< The minimum time span covered by the measurements before the drift is estimated (in ms).
+  static constexpr unsigned int maxMeasurementAge = 120000; ///< Measurements older than this relative to the newest one are ignored (in ms).
+  static constexpr float maxOutlierDistance = 2.f; ///< Measurements that differ more than this from the median offset are not used for the model (in ms).
+  static constexpr float quantizationDeviation = 0.29f; ///< The standard deviation caused by the millisecond timestamps of the other robot (1 / sqrt(12) ms).
+  static constexpr float maxUsefulUncertainty = 50.f; ///< An uncertainty of the offset (in ms) that results in a confidence of 0.
+
+  /** Fits the linear model to the measurements. */
+  void fit();
 
 public:
   /**
    * Adds a new measurement to the buffer.
-   * @param newOffset The measured clock offset.
+   * @param newOffset The measured clock offset (in ms).
    * @param newTimestamp The timestamp when the measurement has been completed.
    */
-  void update(int newOffset, unsigned newTimestamp);
+  void update(float newOffset, unsigned newTimestamp);
+
+  /** Removes all measurements, i.e. the buffer becomes invalid. */
+  void invalidate();
 
   /**
    * Checks whether a message is compatible with the current synchronization data and otherwise invalidates the buffer.
@@ -61,10 +88,43 @@ public:
 #endif
   }
 
+  /**
+   * Returns the offset at a certain local time according to the linear model.
+   * @param localTime The local time.
+   * @return The offset that has to be subtracted from a remote time to get the local time (in ms).
+   */
+  float getOffset(unsigned localTime) const
+  {
+    return offset + drift * static_cast<float>(static_cast<int>(localTime - timestamp));
+  }
+
+  /**
+   * Returns the standard deviation of the offset at a certain local time.
+   * It grows with the time since the last measurement.
+   * @param localTime The local time.
+   * @return The standard deviation (in ms). 0 if not running on a robot.
+   */
+  float getUncertainty(unsigned localTime) const;
+
+  /**
+   * Returns how much the offset at a certain local time can be trusted.
+   * @param localTime The local time.
+   * @return The confidence in [0, 1]. 0 if the buffer is invalid.
+   */
+  float getConfidence(unsigned localTime) const
+  {
+    return isValid() ? std::max(0.f, 1.f - getUncertainty(localTime) / maxUsefulUncertainty) : 0.f;
+  }
+
   unsigned getRemoteTimeInLocalTime(unsigned remoteTime) const
   {
 #ifdef TARGET_ROBOT
-    return remoteTime ? static_cast<unsigned>(std::max(0, static_cast<int>(remoteTime) - offset)) : 0u;
+    if(!remoteTime)
+      return 0u;
+
+    // remoteTime = localTime + offset + drift * (localTime - timestamp), solved for localTime
+    const float localTimeSinceTimestamp = (static_cast<float>(static_cast<int>(remoteTime - timestamp)) - offset) / (1.f + drift);
+    return static_cast<unsigned>(std::max(0, static_cast<int>(timestamp) + static_cast<int>(std::round(localTimeSinceTimestamp))));
 #else
     return remoteTime;
 #endif
@@ -92,8 +152,9 @@ public:
 private:
   struct GameControllerPacket
   {
-    GameControllerPacket(std::uint8_t number, unsigned timestamp) : number(number), timestamp(timestamp) {}
+    GameControllerPacket(std::uint8_t number, unsigned timestamp, unsigned short timestampUs) : number(number), timestampUs(timestampUs), timestamp(timestamp) {}
     std::uint8_t number; /**< The number of the packet. */
+    unsigned short timestampUs; /**< The sub-millisecond part of the receive timestamp (in µs). */
     unsigned timestamp; /**< The receive timestamp of the packet. */
   };
 
@@ -8,6 +8,9 @@
 #include "SharedAutonomyChannel.h"
 #include "Platform/BHAssert.h"
 #include "Platform/SystemCall.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
 #ifdef WINDOWS
 #define _WINSOCK_DEPRECATED_NO_WARNINGS
@@ -19,6 +22,83 @@
 #include <netinet/in.h>
 #endif
 
+namespace
+{
+  constexpr char joystickMagic[4] = {'B', 'H', 'J', 'S'}; /**< The first bytes of a joystick packet. */
+  constexpr char ackMagic[4] = {'B', 'H', 'J', 'A'}; /**< The first bytes of an acknowledgement packet. */
+
+  /**
+   * Writes a value in little endian byte order.
+   * @param data The position to write to. The pointer is advanced.
+   * @param value The value.
+   * @param bytes The number of bytes written.
+   */
+  void writeLE(char*& data, unsigned value, int bytes)
+  {
+    for(int i = 0; i < bytes; ++i)
+      *data++ = static_cast<char>(value >> (i * 8));
+  }
+
+  /**
+   * Reads a value in little endian byte order.
+   * @param data The position to read from. The pointer is advanced.
+   * @param bytes The number of bytes read.
+   * @return The value.
+   */
+  unsigned readLE(const char*& data, int bytes)
+  {
+    unsigned value = 0;
+    for(int i = 0; i < bytes; ++i)
+      value |= static_cast<unsigned>(static_cast<unsigned char>(*data++)) << (i * 8);
+    return value;
+  }
+}
+
+void SharedAutonomyChannel::JoystickPacket::write(char* data) const
+{
+  std::memcpy(data, joystickMagic, sizeof(joystickMagic));
+  data += sizeof(joystickMagic);
+  writeLE(data, sequenceNumber, 4);
+  writeLE(data, sendTime, 4);
+  for(float axis : axes)
+    writeLE(data, static_cast<unsigned short>(static_cast<short>(std::lround(std::clamp(axis, -1.f, 1.f) * 32767.f))), 2);
+  writeLE(data, buttons, 4);
+  writeLE(data, latency, 2);
+  writeLE(data, 0, 2); // padding
+}
+
+bool SharedAutonomyChannel::JoystickPacket::read(const char* data, int length)
+{
+  if(length != size || std::memcmp(data, joystickMagic, sizeof(joystickMagic)))
+    return false;
+  data += sizeof(joystickMagic);
+  sequenceNumber = readLE(data, 4);
+  sendTime = readLE(data, 4);
+  for(float& axis : axes)
+    axis = static_cast<float>(static_cast<short>(readLE(data, 2))) / 32767.f;
+  buttons = readLE(data, 4);
+  latency = static_cast<unsigned short>(readLE(data, 2));
+  return true;
+}
+
+void SharedAutonomyChannel::AckPacket::write(char* data) const
+{
+  std::memcpy(data, ackMagic, sizeof(ackMagic));
+  data += sizeof(ackMagic);
+  writeLE(data, sequenceNumber, 4);
+  writeLE(data, sendTime, 4);
+}
+
+bool SharedAutonomyChannel::AckPacket::read(const char* data, int length)
+{
+  if(length != size || std::memcmp(data, ackMagic, sizeof(ackMagic)))
+    return false;
+  data += sizeof(ackMagic);
+  sequenceNumber = readLE(data, 4);
+  sendTime = readLE(data, 4);
+  return true;
+}
+
 void SharedAutonomyChannel::startLocal(int port, unsigned localId)
 {
   ASSERT(!this->port);
@@ -10,12 +10,66 @@
 #pragma once
 
 #include "Network/UdpComm.h"
+#include <array>
 
 class SharedAutonomyChannel
 {
 public:
   static constexpr const char* sendBack = ""; /**< Unicast packets to sender. */
 
+  /**
+   * A packet with a fixed layout in which the remote PC sends the joystick
+   * state. It is much smaller than a message queue and can therefore be sent
+   * at a high rate and more than once.
+   */
+  struct JoystickPacket
+  {
+    static constexpr int size = 36; /**< The number of bytes of an encoded packet. */
+
+    unsigned sequenceNumber = 0; /**< Increases by one for every new joystick state sent. */
+    unsigned sendTime = 0; /**< The real time of the remote PC when the state was measured (in ms). */
+    std::array<float, 8> axes; /**< The axes, each in the range -1 .. 1. They are transmitted with 16 bits each. */
+    unsigned buttons = 0; /**< The state of up to 32 buttons (bit set means pressed). */
+    unsigned short latency = 0; /**< The one-way latency last measured by the remote PC (in ms). */
+
+    /**
+     * Encodes the packet.
+     * @param data A buffer of at least \c size bytes.
+     */
+    void write(char* data) const;
+
+    /**
+     * Decodes a packet.
+     * @param data The data received.
+     * @param length The number of bytes received.
+     * @return Was it a joystick packet?
+     */
+    bool read(const char* data, int length);
+  };
+
+  /** A packet with a fixed layout in which the robot acknowledges a joystick packet. */
+  struct AckPacket
+  {
+    static constexpr int size = 12; /**< The number of bytes of an encoded packet. */
+
+    unsigned sequenceNumber = 0; /**< The sequence number of the joystick packet acknowledged. */
+    unsigned sendTime = 0; /**< The send time of the joystick packet acknowledged. */
+
+    /**
+     * Encodes the packet.
+     * @param data A buffer of at least \c size bytes.
+     */
+    void write(char* data) const;
+
+    /**
+     * Decodes a packet.
+     * @param data The data received.
+     * @param length The number of bytes received.
+     * @return Was it an acknowledgement packet?
+     */
+    bool read(const char* data, int length);
+  };
+
   /**
    * The method starts the actual communication for local communication.
    * @param port The UDP port this handler is listening to.
@@ -10,6 +10,8 @@
 #include "TeamMessageChannel.h"
 #include "Platform/BHAssert.h"
 #include "Platform/SystemCall.h"
+#include <algorithm>
+#include <cstring>
 
 void TeamMessageChannel::startLocal(int port, unsigned localId)
 {
@@ -55,10 +57,28 @@ bool TeamMessageChannel::receive()
     return false; // not started yet
 
   int size;
-  unsigned remoteIp = 0;
-
-  size = localId ? socket.readLocal(reinterpret_cast<char*>(in.data), sizeof(in.data) + 1)
-                 : socket.read(reinterpret_cast<char*>(in.data), sizeof(in.data) + 1, remoteIp);
+  if(localId)
+    size = socket.readLocal(reinterpret_cast<char*>(in.data), sizeof(in.data) + 1);
+  else
+  {
+    // Fetch all pending packets at once if the previous ones were all returned.
+    if(nextPacket == numOfPackets)
+    {
+      for(int i = 0; i < UdpComm::maxPacketsPerRead; ++i)
+      {
+        packets[i].data = buffers[i];
+        packets[i].size = sizeof(buffers[i]);
+      }
+      nextPacket = 0;
+      numOfPackets = std::max(0, socket.read(packets, UdpComm::maxPacketsPerRead));
+      if(!numOfPackets)
+        return false;
+    }
+    const UdpComm::Packet& packet = packets[nextPacket++];
+    size = packet.size;
+    if(size > 0 && static_cast<size_t>(size) <= sizeof(in.data))
+      std::memcpy(in.data, packet.data, size);
+  }
   if(size < 1 || static_cast<size_t>(size) > sizeof(in.data))
     return false;
   else
@@ -64,4 +64,8 @@ private:
   UdpComm socket; /**< The socket used to communicate. */
   unsigned localId = 0; /**< The id of a local team communication participant or 0 for normal udp communication. */
   bool targetSet = false; /**< Whether the target of the socket has been set. */
+  char buffers[UdpComm::maxPacketsPerRead][sizeof(Container::data) + 1]; /**< Buffers for packets received, but not returned yet. One extra byte detects packets that are too large. */
+  UdpComm::Packet packets[UdpComm::maxPacketsPerRead]; /**< Packets received, but not returned yet. */
+  int numOfPackets = 0; /**< The number of entries in \c packets. */
+  int nextPacket = 0; /**< The index of the next entry in \c packets that is returned. */
 };
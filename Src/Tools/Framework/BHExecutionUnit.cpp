@@ -31,11 +31,21 @@ const LoggingController* BHExecutionUnit::initLogging(const Configuration& confi
   return nullptr;
 }
 
+const char* BHExecutionUnit::getState() const
+{
+  static const Blackboard::Id idGameState = Blackboard::getId("GameState");
+  if(Blackboard::getInstance().exists(idGameState))
+    return TypeRegistry::getEnumName(static_cast<const GameState&>(Blackboard::getInstance()[idGameState]).state);
+  else
+    return nullptr;
+}
+
 void BHExecutionUnit::beforeModules()
 {
-  if(Blackboard::getInstance().exists("GameState"))
+  static const Blackboard::Id idGameState = Blackboard::getId("GameState");
+  if(Blackboard::getInstance().exists(idGameState))
   {
-    const GameState& gameState = static_cast<const GameState&>(Blackboard::getInstance()["GameState"]);
+    const GameState& gameState = static_cast<const GameState&>(Blackboard::getInstance()[idGameState]);
     if(gameState.state != lastGameState)
       ANNOTATION("GameState", "Switched to " << TypeRegistry::getEnumName(gameState.state) << " state.");
     lastGameState = gameState.state;
@@ -15,6 +15,13 @@ class LoggingController;
 class BHExecutionUnit : public FrameExecutionUnit
 {
 protected:
+  /**
+   * Returns the name of the game state if the representation \c GameState is
+   * present in this thread. This allows to restrict modules to certain game states.
+   * @return The name of the game state or nullptr if it is not present.
+   */
+  const char* getState() const override;
+
   /**
    * This method creates an annotation if the representation \c GameState is present in this thread and the state changed.
    */
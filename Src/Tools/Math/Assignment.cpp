@@ -0,0 +1,85 @@
+/**
+ * @file Tools/Math/Assignment.cpp
+ *
+ * Implementation of a solver for the linear assignment problem.
+ * The algorithm maintains potentials for rows and columns and adds one row
+ * after another, each time searching a shortest augmenting path.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "Assignment.h"
+#include "Platform/BHAssert.h"
+#include <algorithm>
+#include <limits>
+
+void Assignment::solve(const std::vector<float>& costs, std::size_t rows, std::size_t columns, std::vector<std::size_t>& assignment)
+{
+  ASSERT(rows <= columns);
+  ASSERT(costs.size() >= rows * columns);
+
+  // All indices are shifted by one. Column 0 is a virtual column, row 0 means "not assigned".
+  std::vector<float> rowPotentials(rows + 1, 0.f);
+  std::vector<float> columnPotentials(columns + 1, 0.f);
+  std::vector<std::size_t> rowOfColumn(columns + 1, 0);
+  std::vector<std::size_t> previousColumn(columns + 1, 0);
+  std::vector<float> minSlack(columns + 1);
+  std::vector<bool> visited(columns + 1);
+
+  for(std::size_t row = 1; row <= rows; ++row)
+  {
+    rowOfColumn[0] = row;
+    std::size_t column = 0;
+    std::fill(minSlack.begin(), minSlack.end(), std::numeric_limits<float>::max());
+    std::fill(visited.begin(), visited.end(), false);
+
+    // Search a shortest path from the new row to an unassigned column.
+    do
+    {
+      visited[column] = true;
+      const std::size_t currentRow = rowOfColumn[column];
+      const float* rowCosts = costs.data() + (currentRow - 1) * columns;
+      float delta = std::numeric_limits<float>::max();
+      std::size_t nextColumn = 0;
+      for(std::size_t c = 1; c <= columns; ++c)
+        if(!visited[c])
+        {
+          const float slack = rowCosts[c - 1] - rowPotentials[currentRow] - columnPotentials[c];
+          if(slack < minSlack[c])
+          {
+            minSlack[c] = slack;
+            previousColumn[c] = column;
+          }
+          if(minSlack[c] < delta)
+          {
+            delta = minSlack[c];
+            nextColumn = c;
+          }
+        }
+      for(std::size_t c = 0; c <= columns; ++c)
+        if(visited[c])
+        {
+          rowPotentials[rowOfColumn[c]] += delta;
+          columnPotentials[c] -= delta;
+        }
+        else
+          minSlack[c] -= delta;
+      column = nextColumn;
+    }
+    while(rowOfColumn[column] != 0);
+
+    // Flip the assignments along the path.
+    do
+    {
+      const std::size_t c = previousColumn[column];
+      rowOfColumn[column] = rowOfColumn[c];
+      column = c;
+    }
+    while(column != 0);
+  }
+
+  assignment.resize(rows);
+  for(std::size_t column = 1; column <= columns; ++column)
+    if(rowOfColumn[column] != 0)
+      assignment[rowOfColumn[column] - 1] = column - 1;
+}
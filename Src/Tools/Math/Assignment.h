@@ -0,0 +1,30 @@
+/**
+ * @file Tools/Math/Assignment.h
+ *
+ * Declaration of a solver for the linear assignment problem.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * The namespace around the functions.
+ */
+namespace Assignment
+{
+  /**
+   * Computes an assignment of rows to columns that minimizes the sum of the costs
+   * using the Hungarian method. Each row is assigned to exactly one column and each
+   * column to at most one row. The runtime is in O(rows^2 * columns).
+   * @param costs The costs of all pairs, row by row, i.e. the cost of assigning row
+   *              r to column c is costs[r * columns + c].
+   * @param rows The number of rows. Must not be greater than the number of columns.
+   * @param columns The number of columns.
+   * @param assignment The column assigned to each row is returned here.
+   */
+  void solve(const std::vector<float>& costs, std::size_t rows, std::size_t columns, std::vector<std::size_t>& assignment);
+}
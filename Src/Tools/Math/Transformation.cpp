@@ -9,6 +9,7 @@
 #include "Transformation.h"
 #include "Math/Pose3f.h"
 #include "Representations/Perception/ImagePreprocessing/CameraMatrix.h"
+#include "Representations/Perception/ImagePreprocessing/ImageCoordinateSystem.h"
 #include "Representations/Infrastructure/CameraInfo.h"
 
 static constexpr float MAX_DIST_ON_FIELD = 142127.f; // Human soccer field diagonal
@@ -133,3 +134,60 @@ bool Transformation::imageToRobotWithCameraRotation(const Vector2i& pointInImage
   }
   return ret;
 }
+
+Transformation::ImageToRobotProjection::ImageToRobotProjection(const CameraMatrix& cameraMatrix, const CameraInfo& cameraInfo,
+                                                               const ImageCoordinateSystem& imageCoordinateSystem) :
+  rotation(cameraMatrix.rotation),
+  translation(cameraMatrix.translation),
+  opticalCenter(cameraInfo.opticalCenter),
+  focalLength(cameraInfo.focalLength, cameraInfo.focalLengthHeight),
+  focalLengthInv(cameraInfo.focalLengthInv, cameraInfo.focalLengthHeightInv),
+  offset(imageCoordinateSystem.offset),
+  a(imageCoordinateSystem.a),
+  b(imageCoordinateSystem.b)
+{}
+
+inline bool Transformation::ImageToRobotProjection::project(const float x, const float y, float& directionY, float& directionZ,
+                                                           float& robotX, float& robotY) const
+{
+  // The rolling shutter correction computes tan(atan(u) - d). This is (u - tan(d)) / (1 + u * tan(d)).
+  // The corrected direction to the point is directly used for the projection.
+  const float factor = a + y * b;
+  const float tanX = std::tan(factor * offset.x());
+  const float tanY = std::tan(factor * offset.y());
+  const float u = (opticalCenter.x() - x) * focalLengthInv.x();
+  const float v = (y - opticalCenter.y()) * focalLengthInv.y();
+  directionY = (u - tanX) / (1.f + u * tanX);
+  directionZ = -(v - tanY) / (1.f + v * tanY);
+
+  const float b1 = rotation(0, 0) + rotation(0, 1) * directionY + rotation(0, 2) * directionZ;
+  const float b2 = rotation(1, 0) + rotation(1, 1) * directionY + rotation(1, 2) * directionZ;
+  const float b3 = rotation(2, 0) + rotation(2, 1) * directionY + rotation(2, 2) * directionZ;
+  const float f = translation.z() / b3;
+  robotX = translation.x() - f * b1;
+  robotY = translation.y() - f * b2;
+  return b3 <= -5.f * focalLengthInv.y() && std::abs(robotX) < MAX_DIST_ON_FIELD && std::abs(robotY) < MAX_DIST_ON_FIELD;
+}
+
+bool Transformation::ImageToRobotProjection::imageToRobot(const Vector2f& pointInImage, Vector2f& corrected, Vector2f& relativePosition) const
+{
+  float directionY;
+  float directionZ;
+  const bool valid = project(pointInImage.x(), pointInImage.y(), directionY, directionZ, relativePosition.x(), relativePosition.y());
+  corrected = opticalCenter - Vector2f(directionY, directionZ).cwiseProduct(focalLength);
+  return valid;
+}
+
+std::size_t Transformation::ImageToRobotProjection::imageToRobot(std::size_t n, const float* x, const float* y,
+                                                                 float* robotX, float* robotY, bool* valid) const
+{
+  std::size_t numOfValid = 0;
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    float directionY;
+    float directionZ;
+    valid[i] = project(x[i], y[i], directionY, directionZ, robotX[i], robotY[i]);
+    numOfValid += valid[i];
+  }
+  return numOfValid;
+}
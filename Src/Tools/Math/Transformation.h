@@ -7,9 +7,11 @@
 #pragma once
 
 #include "Math/Eigen.h"
+#include <cstddef>
 
 struct CameraMatrix;
 struct CameraInfo;
+struct ImageCoordinateSystem;
 
 /**
  * The namespace Transformation defines methods for coordinate system transformations.
@@ -106,4 +108,80 @@ namespace Transformation
    */
   [[nodiscard]] bool imageToRobotWithCameraRotation(const Vector2i& pointInImage, const CameraMatrix& cameraMatrix,
                                                     const CameraInfo& cameraInfo, Vector2f& relativePosition);
+
+  /**
+   * The quantities required to correct the rolling shutter of points in an image
+   * and to project them onto the ground. They are computed once per image, so that
+   * projecting many points does not derive them again for each point. The
+   * results are the same as those of ImageCoordinateSystem::toCorrected followed
+   * by imageToRobot.
+   */
+  class ImageToRobotProjection
+  {
+    Matrix3f rotation; /**< The rotation of the camera. */
+    Vector3f translation; /**< The position of the camera relative to the robot. */
+    Vector2f opticalCenter; /**< The optical center of the camera in pixels. */
+    Vector2f focalLength; /**< The horizontal and vertical focal lengths in pixels. */
+    Vector2f focalLengthInv; /**< The inverses of the focal lengths. */
+    Vector2f offset; /**< The angular offset between the last camera poses. */
+    float a; /**< Constant part of equation to motion distortion. */
+    float b; /**< Linear part of equation to motion distortion. */
+
+    /**
+     * Corrects the rolling shutter of a point and projects it onto the ground.
+     * @param x The x coordinate of the point in the image.
+     * @param y The y coordinate of the point in the image.
+     * @param directionY The corrected horizontal direction to the point in camera coordinates (x = 1).
+     * @param directionZ The corrected vertical direction to the point in camera coordinates (x = 1).
+     * @param robotX The x coordinate of the resulting point relative to the robot.
+     * @param robotY The y coordinate of the resulting point relative to the robot.
+     * @return Is the point on the field?
+     */
+    bool project(float x, float y, float& directionY, float& directionZ, float& robotX, float& robotY) const;
+
+  public:
+    /**
+     * Constructor.
+     * @param cameraMatrix The extrinsic camera parameters.
+     * @param cameraInfo The intrinsic camera parameters.
+     * @param imageCoordinateSystem The rolling shutter correction of the image.
+     */
+    ImageToRobotProjection(const CameraMatrix& cameraMatrix, const CameraInfo& cameraInfo,
+                           const ImageCoordinateSystem& imageCoordinateSystem);
+
+    /**
+     * Corrects the rolling shutter of a point and projects it onto the ground.
+     * @param pointInImage The point in the image.
+     * @param corrected The point in the image after correcting the rolling shutter.
+     * @param relativePosition The resulting point relative to the robot.
+     * @return Is the point on the field?
+     */
+    [[nodiscard]] bool imageToRobot(const Vector2f& pointInImage, Vector2f& corrected, Vector2f& relativePosition) const;
+
+    /**
+     * Corrects the rolling shutter of a point and projects it onto the ground.
+     * @param pointInImage The point in the image.
+     * @param relativePosition The resulting point relative to the robot.
+     * @return Is the point on the field?
+     */
+    [[nodiscard]] bool imageToRobot(const Vector2f& pointInImage, Vector2f& relativePosition) const
+    {
+      Vector2f corrected;
+      return imageToRobot(pointInImage, corrected, relativePosition);
+    }
+
+    /**
+     * Corrects the rolling shutter of many points and projects them onto the
+     * ground. The coordinates are passed as separate arrays.
+     * @param n The number of points.
+     * @param x The x coordinates of the points in the image.
+     * @param y The y coordinates of the points in the image.
+     * @param robotX The x coordinates of the resulting points relative to the robot.
+     * @param robotY The y coordinates of the resulting points relative to the robot.
+     * @param valid Is the point on the field? Otherwise, its coordinates are undefined.
+     * @return The number of points that are on the field.
+     */
+    std::size_t imageToRobot(std::size_t n, const float* x, const float* y,
+                             float* robotX, float* robotY, bool* valid) const;
+  };
 };
@@ -15,50 +15,58 @@
 #include "Platform/BHAssert.h"
 #include <limits>
 
+// The functions below compute the speed only once. The time until the ball stops and the
+// acceleration are derived from it instead of calling the public functions, which would
+// each compute the norm of the velocity again.
+
 Vector2f BallPhysics::getEndPosition(const Vector2f& p, const Vector2f& v, float ballFriction)
 {
   ASSERT(ballFriction < 0.f);
-  const float tStop = computeTimeUntilBallStops(v, ballFriction);  // unit: seconds
-  return propagateBallPosition(p, v, tStop, ballFriction);
+  // As a * tStop = -v, the rolled distance v * tStop + 0.5 * a * tStop^2 is 0.5 * v * tStop.
+  const float tStop = v.norm() / (-1000.f * ballFriction);  // unit: seconds
+  return p + v * (0.5f * tStop);                             // unit: millimeter
 }
 
 Vector2f BallPhysics::propagateBallPosition(const Vector2f& p, const Vector2f& v, float t, float ballFriction)
 {
   ASSERT(ballFriction < 0.f);
-  if(v.norm() == 0.f)
+  const float speed = v.norm();                        // unit: millimeter / second
+  if(speed == 0.f)
     return p;
-  const float tStop = computeTimeUntilBallStops(v, ballFriction);        // unit: seconds
+  const float tStop = speed / (-1000.f * ballFriction); // unit: seconds
   if(tStop < t)
     t = tStop;
-  const Vector2f a = computeNegativeAccelerationVector(v, ballFriction); // unit: millimeter / second^2
-  return p + v * t + a * 0.5f * t * t;                                   // unit: millimeter
+  const Vector2f a = v * (1000.f * ballFriction / speed); // unit: millimeter / second^2
+  return p + v * t + a * 0.5f * t * t;                    // unit: millimeter
 }
 
 void BallPhysics::propagateBallPositionAndVelocity(Vector2f& p, Vector2f& v, float t, float ballFriction)
 {
   ASSERT(ballFriction < 0.f);
-  if(v.norm() == 0.f)
+  const float speed = v.norm();                        // unit: millimeter / second
+  if(speed == 0.f)
     return;
-  const float tStop = computeTimeUntilBallStops(v, ballFriction);        // unit: seconds
+  const float tStop = speed / (-1000.f * ballFriction); // unit: seconds
   if(tStop < t)
     t = tStop;
-  const Vector2f a = computeNegativeAccelerationVector(v, ballFriction); // unit: millimeter / second^2
-  p += v * t + a * 0.5f * t * t;                                         // unit: millimeter
+  const Vector2f a = v * (1000.f * ballFriction / speed); // unit: millimeter / second^2
+  p += v * t + a * 0.5f * t * t;                          // unit: millimeter
   if(t == tStop)
-    v = Vector2f::Zero();                                                // unit: millimeter / s
+    v = Vector2f::Zero();                                 // unit: millimeter / s
   else
-    v += a * t;                                                          // unit: millimeter / s
+    v += a * t;                                           // unit: millimeter / s
 }
 
 void BallPhysics::applyFrictionToPositionAndVelocity(Vector2f& p, Vector2f& v, float t, float ballFriction)
 {
   ASSERT(ballFriction < 0.f);
-  if(v.norm() == 0.f)
+  const float speed = v.norm();                        // unit: millimeter / second
+  if(speed == 0.f)
     return;
-  const float tStop = computeTimeUntilBallStops(v, ballFriction);        // unit: seconds
+  const float tStop = speed / (-1000.f * ballFriction); // unit: seconds
   if(tStop < t)
     t = tStop;
-  const Vector2f a = computeNegativeAccelerationVector(v, ballFriction); // unit: millimeter / second^2
+  const Vector2f a = v * (1000.f * ballFriction / speed); // unit: millimeter / second^2
   if(t == tStop)
     v = Vector2f::Zero();                                                // unit: millimeter / s
   else
@@ -69,7 +77,9 @@ void BallPhysics::applyFrictionToPositionAndVelocity(Vector2f& p, Vector2f& v, f
 float BallPhysics::timeForDistance(const Vector2f& v, float distance, float ballFriction)
 {
   ASSERT(ballFriction < 0.f);
-  if(getEndPosition(Vector2f::Zero(), v, ballFriction).squaredNorm() < sqr(distance))
+  // The rolled distance until the ball stops is v^2 / (-2 * a).
+  const float speed = v.norm();                              // unit: millimeter / second
+  if(sqr(sqr(speed) / (-2000.f * ballFriction)) < sqr(distance))
   {
     return std::numeric_limits<float>::max();
   }
@@ -78,8 +88,7 @@ float BallPhysics::timeForDistance(const Vector2f& v, float distance, float ball
     // Compute time by solving the standard equation:
     // s = v * t + 0.5 * a * t^2  with v = velocity, a = ballFriction, s = distance
     const float s = distance / 1000.f;                       // unit: meter
-    const Vector2f velmps = v / 1000.f;                      // unit: meter / second
-    const float vb = velmps.norm() / ballFriction;           // unit: seconds
+    const float vb = speed / 1000.f / ballFriction;          // unit: seconds
     const float radicand = vb * vb + 2.f * s / ballFriction; // unit: seconds^2
     if(radicand < 0.f)
       return std::numeric_limits<float>::max();
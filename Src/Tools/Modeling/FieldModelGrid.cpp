@@ -0,0 +1,45 @@
+/**
+ * @file FieldModelGrid.cpp
+ *
+ * Implementation of a grid that maps positions on the field to the elements
+ * of the field model that might be close to them.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "FieldModelGrid.h"
+#include "Platform/BHAssert.h"
+#include <cmath>
+
+void FieldModelGrid::build(const Boundaryf& area, float cellSize, std::size_t numOfElements, float maxDistance,
+                           const std::function<float(std::size_t, const Vector2f&)>& getDistance)
+{
+  ASSERT(cellSize > 0.f);
+  ASSERT(numOfElements <= 0xffff);
+  this->area = area;
+  this->cellSize = cellSize;
+  width = std::max(1, static_cast<int>(std::ceil(area.x.getSize() / cellSize)));
+  height = std::max(1, static_cast<int>(std::ceil(area.y.getSize() / cellSize)));
+
+  all.resize(numOfElements);
+  for(std::size_t i = 0; i < numOfElements; ++i)
+    all[i] = static_cast<unsigned short>(i);
+
+  // The distance function is 1-Lipschitz, so an element that is in range of any point of a cell
+  // is at most half a cell diagonal farther away from the center of that cell.
+  const float cellRange = maxDistance + cellSize * std::sqrt(0.5f);
+  cellStarts.clear();
+  cellStarts.reserve(width * height + 1);
+  indices.clear();
+  for(int y = 0; y < height; ++y)
+    for(int x = 0; x < width; ++x)
+    {
+      cellStarts.push_back(static_cast<unsigned>(indices.size()));
+      const Vector2f center(area.x.min + (static_cast<float>(x) + 0.5f) * cellSize,
+                            area.y.min + (static_cast<float>(y) + 0.5f) * cellSize);
+      for(std::size_t i = 0; i < numOfElements; ++i)
+        if(getDistance(i, center) <= cellRange)
+          indices.push_back(static_cast<unsigned short>(i));
+    }
+  cellStarts.push_back(static_cast<unsigned>(indices.size()));
+}
@@ -0,0 +1,71 @@
+/**
+ * @file FieldModelGrid.h
+ *
+ * Declaration of a grid that maps positions on the field to the elements of
+ * the field model (e.g. lines or intersections) that might be close to them.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Math/Boundary.h"
+#include "Math/Eigen.h"
+#include <functional>
+#include <vector>
+
+/**
+ * @class FieldModelGrid
+ *
+ * A grid over the field. Each cell lists the indices of all elements of
+ * a field model that are at most a certain distance away from any point
+ * inside the cell. Thereby, a lookup returns a small superset of all
+ * elements in range of a point. The indices are sorted in ascending order,
+ * so that the candidates are visited in the order of the original list.
+ * Points outside the grid are mapped to all elements.
+ */
+class FieldModelGrid
+{
+  Boundaryf area;                       /**< The area covered by the grid. */
+  float cellSize = 1.f;                 /**< The edge length of a single square cell. */
+  int width = 0;                        /**< The number of cells in x direction. */
+  int height = 0;                       /**< The number of cells in y direction. */
+  std::vector<unsigned> cellStarts;     /**< The index of the first entry of each cell in \c indices. One extra entry marks the end. */
+  std::vector<unsigned short> indices;  /**< The element indices of all cells, one cell after another. */
+  std::vector<unsigned short> all;      /**< The indices of all elements (for points outside of the grid). */
+
+public:
+  /**
+   * Builds the grid.
+   * @param area The area covered by the grid.
+   * @param cellSize The edge length of a single square cell.
+   * @param numOfElements The number of elements of the field model.
+   * @param maxDistance The maximum distance between a point and an element that is still looked up.
+   * @param getDistance A function that returns the distance between an element (given by its index) and a point.
+   */
+  void build(const Boundaryf& area, float cellSize, std::size_t numOfElements, float maxDistance,
+             const std::function<float(std::size_t, const Vector2f&)>& getDistance);
+
+  /**
+   * Determines the elements that might be in range of a point.
+   * @param point The point in field coordinates.
+   * @param begin The first index of an element that might be in range.
+   * @param end The end of the indices of the elements that might be in range.
+   */
+  void getCandidates(const Vector2f& point, const unsigned short*& begin, const unsigned short*& end) const
+  {
+    const int x = static_cast<int>((point.x() - area.x.min) / cellSize);
+    const int y = static_cast<int>((point.y() - area.y.min) / cellSize);
+    if(point.x() < area.x.min || point.y() < area.y.min || x >= width || y >= height)
+    {
+      begin = all.data();
+      end = begin + all.size();
+    }
+    else
+    {
+      const std::size_t cell = y * width + x;
+      begin = indices.data() + cellStarts[cell];
+      end = indices.data() + cellStarts[cell + 1];
+    }
+  }
+};
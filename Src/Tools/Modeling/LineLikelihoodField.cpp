@@ -0,0 +1,50 @@
+/**
+ * @file LineLikelihoodField.cpp
+ *
+ * Implementation of a precomputed distance field over the pitch that maps
+ * field positions to the distance to the closest field line of a certain
+ * orientation.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "LineLikelihoodField.h"
+#include "Math/Geometry.h"
+#include <algorithm>
+#include <cmath>
+
+void LineLikelihoodField::build(const Boundaryf& area, float cellSize, const std::vector<Segment>& segments)
+{
+  this->area = area;
+  this->cellSize = cellSize;
+  width = std::max(1, static_cast<int>(std::ceil(area.x.getSize() / cellSize)));
+  height = std::max(1, static_cast<int>(std::ceil(area.y.getSize() / cellSize)));
+
+  // Lines that are clearly parallel to one axis are only added to one field.
+  std::vector<const Segment*> segmentsPerField[2];
+  for(const Segment& segment : segments)
+  {
+    const Vector2f dir = segment.to - segment.from;
+    const float ratio = std::abs(dir.x()) / std::max(std::abs(dir.y()), 1e-6f);
+    if(ratio > 0.5f)
+      segmentsPerField[0].push_back(&segment);
+    if(ratio < 2.f)
+      segmentsPerField[1].push_back(&segment);
+  }
+
+  for(int i = 0; i < 2; ++i)
+  {
+    distances[i].resize(width * height);
+    unsigned char* cell = distances[i].data();
+    for(int y = 0; y < height; ++y)
+      for(int x = 0; x < width; ++x)
+      {
+        const Vector2f center(area.x.min + (static_cast<float>(x) + 0.5f) * cellSize,
+                              area.y.min + (static_cast<float>(y) + 0.5f) * cellSize);
+        float distance = maxDistance;
+        for(const Segment* segment : segmentsPerField[i])
+          distance = std::min(distance, Geometry::getDistanceToEdge(Geometry::Line(segment->from, segment->to - segment->from), center));
+        *cell++ = static_cast<unsigned char>(std::lround(distance / distanceStep));
+      }
+  }
+}
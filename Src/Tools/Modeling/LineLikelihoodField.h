@@ -0,0 +1,67 @@
+/**
+ * @file LineLikelihoodField.h
+ *
+ * Declaration of a precomputed distance field over the pitch that maps
+ * field positions to the distance to the closest field line of a certain
+ * orientation.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "Math/Boundary.h"
+#include "Math/Eigen.h"
+#include <vector>
+
+/**
+ * @class LineLikelihoodField
+ *
+ * Two distance fields over the pitch, one for lines that are rather parallel to the
+ * x axis of the field and one for lines that are rather parallel to its y axis.
+ * Lines that are neither (e.g. parts of the center circle) are added to both.
+ * The distances are stored as bytes in a coarse quantization.
+ */
+class LineLikelihoodField
+{
+public:
+  /** A line segment of the field model. */
+  struct Segment
+  {
+    Vector2f from; /**< The first end point (in field coordinates). */
+    Vector2f to;   /**< The second end point (in field coordinates). */
+  };
+
+  /**
+   * Builds the distance fields.
+   * @param area The area covered by the fields.
+   * @param cellSize The edge length of a single square cell (in mm).
+   * @param segments The line segments of the field model.
+   */
+  void build(const Boundaryf& area, float cellSize, const std::vector<Segment>& segments);
+
+  /**
+   * Returns the distance between a point and the closest line with a similar orientation.
+   * @param point The point (in field coordinates).
+   * @param parallelToX Are lines searched that are rather parallel to the x axis?
+   * @return The distance (in mm). A large value is returned for points outside the field.
+   */
+  float getDistance(const Vector2f& point, bool parallelToX) const
+  {
+    const int x = static_cast<int>((point.x() - area.x.min) / cellSize);
+    const int y = static_cast<int>((point.y() - area.y.min) / cellSize);
+    if(point.x() < area.x.min || point.y() < area.y.min || x >= width || y >= height)
+      return maxDistance;
+    return static_cast<float>(distances[parallelToX ? 0 : 1][y * width + x]) * distanceStep;
+  }
+
+private:
+  static constexpr float distanceStep = 10.f; /**< The quantization of the distances (in mm). */
+  static constexpr float maxDistance = 255.f * distanceStep; /**< The largest distance that can be stored (in mm). */
+
+  Boundaryf area;                                 /**< The area covered by the fields. */
+  float cellSize = 1.f;                           /**< The edge length of a single square cell (in mm). */
+  int width = 0;                                  /**< The number of cells in x direction. */
+  int height = 0;                                 /**< The number of cells in y direction. */
+  std::vector<unsigned char> distances[2];        /**< The quantized distances for lines parallel to the x axis and to the y axis. */
+};
@@ -103,9 +103,8 @@ void UKFPose2D::landmarkSensorUpdate(const Vector2f& landmarkPosition, const Vec
   Vector2f landmarkReadings[7];
   for(int i = 0; i < 7; ++i)
   {
-    Pose2f pose(sigmaPoints[i].z(), sigmaPoints[i].head<2>());
-    Vector2f landmarkPosRel = pose.invert() * landmarkPosition; // TODO: optimize this
-    landmarkReadings[i] = Vector2f(landmarkPosRel.x(), landmarkPosRel.y());
+    landmarkReadings[i] = landmarkPosition - sigmaPoints[i].head<2>();
+    landmarkReadings[i].rotate(-sigmaPoints[i].z());
   }
 
   // computeMeanOfLandmarkReadings
@@ -147,45 +146,14 @@ void UKFPose2D::landmarkSensorUpdate(const Vector2f& landmarkPosition, const Vec
 
 void UKFPose2D::lineSensorUpdate(bool lineIsParallelToWorldModelXAxis, const Vector2f& reading, const Matrix2f& readingCov)
 {
-  generateSigmaPoints();
-
-  // computeLineReadings
-  Vector2f lineReadings[7];
-  if(lineIsParallelToWorldModelXAxis)
-    for(int i = 0; i < 7; ++i)
-      lineReadings[i] = Vector2f(sigmaPoints[i].y(), sigmaPoints[i].z());
-  else
-    for(int i = 0; i < 7; ++i)
-      lineReadings[i] = Vector2f(sigmaPoints[i].x(), sigmaPoints[i].z());
-
-  // computeMeanOfLineReadings
-  Vector2f lineReadingMean = lineReadings[0];
-  for(int i = 1; i < 7; ++i)
-    lineReadingMean += lineReadings[i];
-  lineReadingMean *= 1.f / 7.f;
-
-  // computeCovOfLineReadingsAndSigmaPoints
-  Matrix2x3f lineReadingAndMeanCov = Matrix2x3f::Zero();
-  for(int i = 0; i < 3; ++i)
-  {
-    const Vector2f d1 = lineReadings[i * 2 + 1] - lineReadingMean;
-    lineReadingAndMeanCov += (Matrix2x3f() << d1 * l(0, i), d1 * l(1, i), d1 * l(2, i)).finished();
-    const Vector2f d2 = lineReadings[i * 2 + 2] - lineReadingMean;
-    lineReadingAndMeanCov += (Matrix2x3f() << d2 * -l(0, i), d2 * -l(1, i), d2 * -l(2, i)).finished();
-  }
-  lineReadingAndMeanCov *= 0.5f;
+  // The reading is a linear function of the state. Therefore, the unscented
+  // transform would yield the mean and the covariance of the state projected
+  // onto the reading, which can be computed directly without sigma points.
+  const int index = lineIsParallelToWorldModelXAxis ? 1 : 0;
+  const Vector2f lineReadingMean(mean(index), Angle::normalize(mean.z()));
+  const Matrix2x3f lineReadingAndMeanCov = (Matrix2x3f() << cov.row(index), cov.row(2)).finished();
+  const Matrix2f lineReadingCov = (Matrix2f() << cov(index, index), cov(index, 2), cov(2, index), cov(2, 2)).finished();
 
-  // computeCovOfLineReadingsReadings
-  const Vector2f d = lineReadings[0] - lineReadingMean;
-  Matrix2f lineReadingCov = (Matrix2f() << d * d.x(), d * d.y()).finished();
-  for(int i = 1; i < 7; ++i)
-  {
-    const Vector2f d = lineReadings[i] - lineReadingMean;
-    lineReadingCov += (Matrix2f() << d * d.x(), d * d.y()).finished();
-  }
-  lineReadingCov *= 0.5f;
-
-  lineReadingMean.y() = Angle::normalize(lineReadingMean.y());
   const Matrix3x2f kalmanGain = lineReadingAndMeanCov.transpose() * (lineReadingCov + readingCov).inverse();
   Vector2f innovation = reading - lineReadingMean;
   innovation.y() = Angle::normalize(innovation.y());
@@ -198,48 +166,15 @@ void UKFPose2D::lineSensorUpdate(bool lineIsParallelToWorldModelXAxis, const Vec
 
 void UKFPose2D::poseSensorUpdate(const Vector3f& reading, const Matrix3f& readingCov)
 {
-  generateSigmaPoints();
-
-  // computePoseReadings
-  Vector3f poseReadings[7];
-  for(int i = 0; i < 7; ++i)
-    poseReadings[i] = sigmaPoints[i];
-
-  // computeMeanOfPoseReadings
-  Vector3f poseReadingMean = poseReadings[0];
-  for(int i = 1; i < 7; ++i)
-    poseReadingMean += poseReadings[i];
-  poseReadingMean *= 1.f / 7.f;
-
-  // computeCovOfPoseReadingsAndSigmaPoints
-  Matrix3f poseReadingAndMeanCov = Matrix3f::Zero();
-  for(int i = 0; i < 3; ++i)
-  {
-    const Vector3f d1 = poseReadings[i * 2 + 1] - poseReadingMean;
-    poseReadingAndMeanCov += (Matrix3f() << d1 * l(0, i), d1 * l(1, i), d1 * l(2, i)).finished();
-    const Vector3f d2 = poseReadings[i * 2 + 2] - poseReadingMean;
-    poseReadingAndMeanCov += (Matrix3f() << d2 * -l(0, i), d2 * -l(1, i), d2 * -l(2, i)).finished();
-  }
-  poseReadingAndMeanCov *= 0.5f;
-
-  // computeCovOfPoseReadingsReadings
-  Matrix3f poseReadingCov;
-  const Vector3f d = poseReadings[0] - poseReadingMean;
-  poseReadingCov << d * d.x(), d * d.y(), d * d.z();
-  for(int i = 1; i < 7; ++i)
-  {
-    const Vector3f d = poseReadings[i] - poseReadingMean;
-    poseReadingCov += (Matrix3f() << d * d.x(), d * d.y(), d * d.z()).finished();
-  }
-  poseReadingCov *= 0.5f;
-
+  // The reading is the state itself, so the unscented transform is not needed (see lineSensorUpdate).
+  Vector3f poseReadingMean = mean;
   poseReadingMean.z() = Angle::normalize(poseReadingMean.z());
-  const Matrix3f kalmanGain = poseReadingAndMeanCov.transpose() * (poseReadingCov + readingCov).inverse();
+  const Matrix3f kalmanGain = cov.transpose() * (cov + readingCov).inverse();
   Vector3f innovation = reading - poseReadingMean;
   innovation.z() = Angle::normalize(innovation.z());
   const Vector3f correction = kalmanGain * innovation;
   mean += correction;
   mean.z() = Angle::normalize(mean.z());
-  cov -= kalmanGain * poseReadingAndMeanCov;
+  cov -= kalmanGain * cov;
   Covariance::fixCovariance<3>(cov);
 }
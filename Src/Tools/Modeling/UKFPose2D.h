@@ -21,6 +21,8 @@
  */
 class UKFPose2D
 {
+  friend class UKFPose2DBatch;
+
 protected:
   Vector3f mean = Vector3f::Zero();   /**< The estimated pose in 2D. */
   Matrix3f cov = Matrix3f::Zero();    /**< The covariance matrix of the estimate. */
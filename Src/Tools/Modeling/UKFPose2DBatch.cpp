@@ -0,0 +1,132 @@
+/**
+ * @file UKFPose2DBatch.cpp
+ *
+ * Implementation of a class that performs updates of many UKFPose2D
+ * hypotheses at once.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "UKFPose2DBatch.h"
+#include "Math/BHMath.h"
+#include <algorithm>
+#include <cmath>
+
+void UKFPose2DBatch::resize(std::size_t count)
+{
+  for(std::vector<float>* v : {&x, &y, &rot, &c00, &c01, &c02, &c11, &c12, &c22, &odoX, &odoY, &odoRot})
+    v->resize(count);
+}
+
+void UKFPose2DBatch::load(std::size_t index, const UKFPose2D& hypothesis, const Pose2f& odometryOffset)
+{
+  x[index] = hypothesis.mean.x();
+  y[index] = hypothesis.mean.y();
+  rot[index] = hypothesis.mean.z();
+  c00[index] = hypothesis.cov(0, 0);
+  c01[index] = (hypothesis.cov(1, 0) + hypothesis.cov(0, 1)) * 0.5f;
+  c02[index] = (hypothesis.cov(2, 0) + hypothesis.cov(0, 2)) * 0.5f;
+  c11[index] = hypothesis.cov(1, 1);
+  c12[index] = (hypothesis.cov(2, 1) + hypothesis.cov(1, 2)) * 0.5f;
+  c22[index] = hypothesis.cov(2, 2);
+  odoX[index] = odometryOffset.translation.x();
+  odoY[index] = odometryOffset.translation.y();
+  odoRot[index] = odometryOffset.rotation;
+}
+
+void UKFPose2DBatch::store(std::size_t index, UKFPose2D& hypothesis) const
+{
+  hypothesis.mean << x[index], y[index], rot[index];
+  hypothesis.cov << c00[index], c01[index], c02[index],
+                    c01[index], c11[index], c12[index],
+                    c02[index], c12[index], c22[index];
+}
+
+void UKFPose2DBatch::motionUpdate(std::size_t count, const Pose2f& filterProcessDeviation,
+                                  const Pose2f& odometryDeviation, const Vector2f& odometryRotationDeviation)
+{
+  const float processNoiseX = sqr(filterProcessDeviation.translation.x());
+  const float processNoiseY = sqr(filterProcessDeviation.translation.y());
+  const float processNoiseRot = sqr(filterProcessDeviation.rotation);
+
+  for(std::size_t i = 0; i < count; ++i)
+  {
+    // Cholesky decomposition (see UKFPose2D::generateSigmaPoints)
+    float l11 = std::sqrt(std::max(c00[i], 0.f));
+    if(l11 == 0.f) l11 = 0.0000000001f;
+    const float l21 = c01[i] / l11;
+    const float l31 = c02[i] / l11;
+    float l22 = std::sqrt(std::max(c11[i] - l21 * l21, 0.f));
+    if(l22 == 0.f) l22 = 0.0000000001f;
+    const float l32 = (c12[i] - l31 * l21) / l22;
+    const float l33 = std::sqrt(std::max(c22[i] - l31 * l31 - l32 * l32, 0.f));
+
+    // The sigma points only differ in three rotational offsets from the mean. Their sines and
+    // cosines are derived from those of the mean and the offsets instead of being computed directly.
+    const float c = std::cos(rot[i]);
+    const float s = std::sin(rot[i]);
+    const float offsets[3] = {l31, l32, l33};
+    float cosines[7] = {c};
+    float sines[7] = {s};
+    for(int j = 0; j < 3; ++j)
+    {
+      const float cb = std::cos(offsets[j]);
+      const float sb = std::sin(offsets[j]);
+      cosines[j * 2 + 1] = c * cb - s * sb;
+      sines[j * 2 + 1] = s * cb + c * sb;
+      cosines[j * 2 + 2] = c * cb + s * sb;
+      sines[j * 2 + 2] = s * cb - c * sb;
+    }
+
+    // Sigma points, moved by the odometry rotated to their own orientations
+    const float sx[7] = {x[i], x[i] + l11, x[i] - l11, x[i], x[i], x[i], x[i]};
+    const float sy[7] = {y[i], y[i] + l21, y[i] - l21, y[i] + l22, y[i] - l22, y[i], y[i]};
+    const float sz[7] = {rot[i], rot[i] + l31, rot[i] - l31, rot[i] + l32, rot[i] - l32, rot[i] + l33, rot[i] - l33};
+    float px[7], py[7], pz[7];
+    float meanX = 0.f, meanY = 0.f, meanZ = 0.f;
+    for(int j = 0; j < 7; ++j)
+    {
+      px[j] = sx[j] + odoX[i] * cosines[j] - odoY[i] * sines[j];
+      py[j] = sy[j] + odoX[i] * sines[j] + odoY[i] * cosines[j];
+      pz[j] = sz[j] + odoRot[i];
+      meanX += px[j];
+      meanY += py[j];
+      meanZ += pz[j];
+    }
+    meanX *= 1.f / 7.f;
+    meanY *= 1.f / 7.f;
+    meanZ *= 1.f / 7.f;
+
+    // Covariance of the sigma points
+    float cxx = 0.f, cxy = 0.f, cxz = 0.f, cyy = 0.f, cyz = 0.f, czz = 0.f;
+    for(int j = 0; j < 7; ++j)
+    {
+      const float dx = px[j] - meanX;
+      const float dy = py[j] - meanY;
+      const float dz = pz[j] - meanZ;
+      cxx += dx * dx;
+      cxy += dx * dy;
+      cxz += dx * dz;
+      cyy += dy * dy;
+      cyz += dy * dz;
+      czz += dz * dz;
+    }
+
+    // Process noise
+    const float cm = std::cos(meanZ);
+    const float sm = std::sin(meanZ);
+    const float odoMeanX = cm * odoX[i] - sm * odoY[i];
+    const float odoMeanY = sm * odoX[i] + cm * odoY[i];
+
+    x[i] = meanX;
+    y[i] = meanY;
+    rot[i] = Angle::normalize(meanZ);
+    c00[i] = cxx * 0.5f + processNoiseX + sqr(odoMeanX * odometryDeviation.translation.x());
+    c01[i] = cxy * 0.5f;
+    c02[i] = cxz * 0.5f;
+    c11[i] = cyy * 0.5f + processNoiseY + sqr(odoMeanY * odometryDeviation.translation.y());
+    c12[i] = cyz * 0.5f;
+    c22[i] = czz * 0.5f + processNoiseRot + sqr(odoRot[i] * odometryDeviation.rotation)
+             + sqr(odoMeanX * odometryRotationDeviation.x()) + sqr(odoMeanY * odometryRotationDeviation.y());
+  }
+}
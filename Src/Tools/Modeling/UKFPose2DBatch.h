@@ -0,0 +1,86 @@
+/**
+ * @file UKFPose2DBatch.h
+ *
+ * Declaration of a class that performs updates of many UKFPose2D hypotheses
+ * at once. The states and covariances of all hypotheses are stored as a
+ * structure of arrays, so that the update loops run over contiguous memory.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include "UKFPose2D.h"
+#include <vector>
+
+/**
+ * @class UKFPose2DBatch
+ *
+ * Computes the same motion update as UKFPose2D::motionUpdate, but for many
+ * hypotheses in a single pass. The batch only holds temporary data, i.e.
+ * the hypotheses are copied into it, updated, and copied back.
+ */
+class UKFPose2DBatch
+{
+  std::vector<float> x;   /**< The x coordinates of the means. */
+  std::vector<float> y;   /**< The y coordinates of the means. */
+  std::vector<float> rot; /**< The rotations of the means. */
+  std::vector<float> c00, c01, c02, c11, c12, c22; /**< The upper triangles of the covariances. */
+  std::vector<float> odoX, odoY, odoRot; /**< The odometry offsets per hypothesis. */
+
+public:
+  /**
+   * Pose update of many hypotheses based on the assumed robot motion.
+   * @param hypotheses The first of the consecutive hypotheses to update.
+   * @param count The number of hypotheses.
+   * @param odometryOffsets The odometry offset for each hypothesis.
+   * @param filterProcessDeviation Process noise for Kalman filter update
+   * @param odometryDeviation The assumed uncertainty in odometry information
+   * @param odometryRotationDeviation Additional odometry uncertainty of rotation that affects translation
+   */
+  template<typename T>
+  void motionUpdate(T* hypotheses, std::size_t count, const std::vector<Pose2f>& odometryOffsets,
+                    const Pose2f& filterProcessDeviation, const Pose2f& odometryDeviation,
+                    const Vector2f& odometryRotationDeviation)
+  {
+    ASSERT(odometryOffsets.size() >= count);
+    resize(count);
+    for(std::size_t i = 0; i < count; ++i)
+      load(i, hypotheses[i], odometryOffsets[i]);
+    motionUpdate(count, filterProcessDeviation, odometryDeviation, odometryRotationDeviation);
+    for(std::size_t i = 0; i < count; ++i)
+      store(i, hypotheses[i]);
+  }
+
+private:
+  /**
+   * Sets the number of hypotheses the batch can hold.
+   * @param count The number of hypotheses.
+   */
+  void resize(std::size_t count);
+
+  /**
+   * Copies a hypothesis and its odometry offset into the batch.
+   * @param index The index in the batch.
+   * @param hypothesis The hypothesis copied.
+   * @param odometryOffset The odometry offset for this hypothesis.
+   */
+  void load(std::size_t index, const UKFPose2D& hypothesis, const Pose2f& odometryOffset);
+
+  /**
+   * Copies a hypothesis back from the batch.
+   * @param index The index in the batch.
+   * @param hypothesis The hypothesis that is overwritten.
+   */
+  void store(std::size_t index, UKFPose2D& hypothesis) const;
+
+  /**
+   * Performs the motion update on the hypotheses in the batch.
+   * @param count The number of hypotheses.
+   * @param filterProcessDeviation Process noise for Kalman filter update
+   * @param odometryDeviation The assumed uncertainty in odometry information
+   * @param odometryRotationDeviation Additional odometry uncertainty of rotation that affects translation
+   */
+  void motionUpdate(std::size_t count, const Pose2f& filterProcessDeviation,
+                    const Pose2f& odometryDeviation, const Vector2f& odometryRotationDeviation);
+};
@@ -7,68 +7,138 @@
 
 #include "ForwardKinematic.h"
 #include "Representations/Infrastructure/JointAngles.h"
+#include "Representations/Configuration/MassCalibration.h"
 #include "Representations/Configuration/RobotDimensions.h"
 #include "Math/BHMath.h"
 #include "Math/Pose3f.h"
 #include "Math/SE3fWithCov.h"
 #include "Math/Rotation.h"
+#include <type_traits>
 
+namespace
+{
+  /**
+   * Creates the transformation of a rotational joint. The variance of the joint
+   * is only used if the limbs propagate covariances.
+   * @param rotation The rotation of the joint.
+   * @param variance The variance of the joint angle around each axis.
+   * @return The transformation.
+   */
+  template<typename Limb>
+  Limb joint(const RotationMatrix& rotation, const Vector3f& variance)
+  {
+    if constexpr(std::is_same_v<Limb, SE3WithCov>)
+      return SE3WithCov(rotation, variance.asDiagonal());
+    else
+      return Pose3f(rotation);
+  }
+}
+
+template<typename Limb>
 void ForwardKinematic::calculateArmChain(Arms::Arm arm, const JointAngles& joints, const RobotDimensions& robotDimensions,
-                                         ENUM_INDEXED_ARRAY(SE3WithCov, Limbs::Limb)& limbs)
+                                         ENUM_INDEXED_ARRAY(Limb, Limbs::Limb)& limbs)
 {
   const int sign = arm == Arms::left ? 1 : -1;
   Limbs::Limb shoulderLimb = arm == Arms::left ? Limbs::shoulderLeft : Limbs::shoulderRight;
   Joints::Joint shoulderJoint = arm == Arms::left ? Joints::lShoulderPitch : Joints::rShoulderPitch;
 
-  SE3WithCov& shoulder = limbs[shoulderLimb];
-  SE3WithCov& biceps = limbs[shoulderLimb + 1];
-  SE3WithCov& elbow = limbs[shoulderLimb + 2];
-  SE3WithCov& foreArm = limbs[shoulderLimb + 3];
-  SE3WithCov& wrist = limbs[shoulderLimb + 4];
+  Limb& shoulder = limbs[shoulderLimb];
+  Limb& biceps = limbs[shoulderLimb + 1];
+  Limb& elbow = limbs[shoulderLimb + 2];
+  Limb& foreArm = limbs[shoulderLimb + 3];
+  Limb& wrist = limbs[shoulderLimb + 4];
 
-  shoulder = SE3WithCov(Pose3f(robotDimensions.armOffset.x(), robotDimensions.armOffset.y() * sign, robotDimensions.armOffset.z())) *= SE3WithCov(
-      RotationMatrix::aroundY(joints.angles[shoulderJoint]), Vector3f(0.f, joints.variance[shoulderJoint], 0.f).asDiagonal());
-  biceps = shoulder *
-           SE3WithCov(RotationMatrix::aroundZ(joints.angles[shoulderJoint + 1]), Vector3f(0.f, 0.f, joints.variance[shoulderJoint + 1]).asDiagonal());
-  elbow = (biceps + Vector3f(robotDimensions.upperArmLength, robotDimensions.yOffsetElbowToShoulder * sign, 0)) *= SE3WithCov(RotationMatrix::aroundX(
-      joints.angles[shoulderJoint + 2]), Vector3f(joints.variance[shoulderJoint + 2], 0.f, 0.f).asDiagonal());
-  foreArm = elbow * SE3WithCov(RotationMatrix::aroundZ(joints.angles[shoulderJoint + 3]), Vector3f(0.f, 0.f, joints.variance[shoulderJoint + 3]).asDiagonal());
-  wrist = (foreArm + Vector3f(robotDimensions.xOffsetElbowToWrist, 0, 0)) *= SE3WithCov(RotationMatrix::aroundX(joints.angles[shoulderJoint + 4]),
-                                                                                        Vector3f(joints.variance[shoulderJoint + 4], 0.f, 0.f).asDiagonal());
+  shoulder = Limb(Pose3f(robotDimensions.armOffset.x(), robotDimensions.armOffset.y() * sign, robotDimensions.armOffset.z())) *= joint<Limb>(
+      RotationMatrix::aroundY(joints.angles[shoulderJoint]), Vector3f(0.f, joints.variance[shoulderJoint], 0.f));
+  biceps = shoulder * joint<Limb>(RotationMatrix::aroundZ(joints.angles[shoulderJoint + 1]), Vector3f(0.f, 0.f, joints.variance[shoulderJoint + 1]));
+  elbow = (biceps + Vector3f(robotDimensions.upperArmLength, robotDimensions.yOffsetElbowToShoulder * sign, 0)) *= joint<Limb>(RotationMatrix::aroundX(
+      joints.angles[shoulderJoint + 2]), Vector3f(joints.variance[shoulderJoint + 2], 0.f, 0.f));
+  foreArm = elbow * joint<Limb>(RotationMatrix::aroundZ(joints.angles[shoulderJoint + 3]), Vector3f(0.f, 0.f, joints.variance[shoulderJoint + 3]));
+  wrist = (foreArm + Vector3f(robotDimensions.xOffsetElbowToWrist, 0, 0)) *= joint<Limb>(RotationMatrix::aroundX(joints.angles[shoulderJoint + 4]),
+                                                                                         Vector3f(joints.variance[shoulderJoint + 4], 0.f, 0.f));
 }
 
+template<typename Limb>
 void ForwardKinematic::calculateLegChain(Legs::Leg leg, const JointAngles& joints, const RobotDimensions& robotDimensions,
-                                         ENUM_INDEXED_ARRAY(SE3WithCov, Limbs::Limb)& limbs)
+                                         ENUM_INDEXED_ARRAY(Limb, Limbs::Limb)& limbs)
 {
   const int sign = leg == Legs::left ? 1 : -1;
   Limbs::Limb pelvisLimb = leg == Legs::left ? Limbs::pelvisLeft : Limbs::pelvisRight;
   Joints::Joint hipJoint = leg == Legs::left ? Joints::lHipYawPitch : Joints::rHipYawPitch;
 
-  SE3WithCov& pelvis = limbs[pelvisLimb];
-  SE3WithCov& hip = limbs[pelvisLimb + 1];
-  SE3WithCov& thigh = limbs[pelvisLimb + 2];
-  SE3WithCov& tibia = limbs[pelvisLimb + 3];
-  SE3WithCov& ankle = limbs[pelvisLimb + 4];
-  SE3WithCov& foot = limbs[pelvisLimb + 5];
+  Limb& pelvis = limbs[pelvisLimb];
+  Limb& hip = limbs[pelvisLimb + 1];
+  Limb& thigh = limbs[pelvisLimb + 2];
+  Limb& tibia = limbs[pelvisLimb + 3];
+  Limb& ankle = limbs[pelvisLimb + 4];
+  Limb& foot = limbs[pelvisLimb + 5];
 
-  pelvis = SE3WithCov(Pose3f(0.f, robotDimensions.yHipOffset * sign, 0.f)) *
+  pelvis = Limb(Pose3f(0.f, robotDimensions.yHipOffset * sign, 0.f)) *
            (Rotation::aroundX(pi_4 * sign) *
-            SE3WithCov(Rotation::aroundZ(joints.angles[hipJoint] * -sign), Vector3f(0.f, 0.f, joints.variance[hipJoint]).asDiagonal()) *
+            joint<Limb>(Rotation::aroundZ(joints.angles[hipJoint] * -sign), Vector3f(0.f, 0.f, joints.variance[hipJoint])) *
             Rotation::aroundX(-pi_4 * sign)); // HitYawPitch
-  hip = pelvis * SE3WithCov(RotationMatrix::aroundX(joints.angles[hipJoint + 1]), Vector3f(joints.variance[hipJoint + 1], 0.f, 0.f).asDiagonal()); // HipRoll
-  thigh = hip * SE3WithCov(RotationMatrix::aroundY(joints.angles[hipJoint + 2]), Vector3f(0.f, joints.variance[hipJoint + 2], 0.f).asDiagonal()); // Hit Pitch
-  tibia = (thigh + Vector3f(0, 0, -robotDimensions.upperLegLength)) *= SE3WithCov(RotationMatrix::aroundY(joints.angles[hipJoint + 3]),
-                                                                                  Vector3f(0.f, joints.variance[hipJoint + 3], 0.f).asDiagonal()); // KneePitch
-  ankle = (tibia + Vector3f(0, 0, -robotDimensions.lowerLegLength)) *= SE3WithCov(RotationMatrix::aroundY(joints.angles[hipJoint + 4]),
-                                                                                  Vector3f(0.f, joints.variance[hipJoint + 4], 0.f).asDiagonal()); // AnklePitch
-  foot = ankle * SE3WithCov(RotationMatrix::aroundX(joints.angles[hipJoint + 5]), Vector3f(joints.variance[hipJoint + 5], 0.f, 0.f).asDiagonal());
+  hip = pelvis * joint<Limb>(RotationMatrix::aroundX(joints.angles[hipJoint + 1]), Vector3f(joints.variance[hipJoint + 1], 0.f, 0.f)); // HipRoll
+  thigh = hip * joint<Limb>(RotationMatrix::aroundY(joints.angles[hipJoint + 2]), Vector3f(0.f, joints.variance[hipJoint + 2], 0.f)); // Hit Pitch
+  tibia = (thigh + Vector3f(0, 0, -robotDimensions.upperLegLength)) *= joint<Limb>(RotationMatrix::aroundY(joints.angles[hipJoint + 3]),
+                                                                                   Vector3f(0.f, joints.variance[hipJoint + 3], 0.f)); // KneePitch
+  ankle = (tibia + Vector3f(0, 0, -robotDimensions.lowerLegLength)) *= joint<Limb>(RotationMatrix::aroundY(joints.angles[hipJoint + 4]),
+                                                                                   Vector3f(0.f, joints.variance[hipJoint + 4], 0.f)); // AnklePitch
+  foot = ankle * joint<Limb>(RotationMatrix::aroundX(joints.angles[hipJoint + 5]), Vector3f(joints.variance[hipJoint + 5], 0.f, 0.f));
+}
+
+Pose3f ForwardKinematic::calculateSole(Legs::Leg leg, const JointAngles& joints, const RobotDimensions& robotDimensions, Pose3f* tibia)
+{
+  const int sign = leg == Legs::left ? 1 : -1;
+  Joints::Joint hipJoint = leg == Legs::left ? Joints::lHipYawPitch : Joints::rHipYawPitch;
+
+  Pose3f pose = Pose3f(0.f, robotDimensions.yHipOffset * sign, 0.f) *
+                (Rotation::aroundX(pi_4 * sign) * Rotation::aroundZ(joints.angles[hipJoint] * -sign) * Rotation::aroundX(-pi_4 * sign)); // HipYawPitch
+  pose.rotateX(joints.angles[hipJoint + 1]); // HipRoll
+  pose.rotateY(joints.angles[hipJoint + 2]); // HipPitch
+  pose.translate(0.f, 0.f, -robotDimensions.upperLegLength).rotateY(joints.angles[hipJoint + 3]); // KneePitch
+  if(tibia)
+    *tibia = pose;
+  pose.translate(0.f, 0.f, -robotDimensions.lowerLegLength).rotateY(joints.angles[hipJoint + 4]); // AnklePitch
+  pose.rotateX(joints.angles[hipJoint + 5]); // AnkleRoll
+  return pose.translate(0.f, 0.f, -robotDimensions.footHeight);
 }
 
-void ForwardKinematic::calculateHeadChain(const JointAngles& joints, const RobotDimensions& robotDimensions, ENUM_INDEXED_ARRAY(SE3WithCov, Limbs::Limb)& limbs)
+template<typename Limb>
+void ForwardKinematic::calculateHeadChain(const JointAngles& joints, const RobotDimensions& robotDimensions, ENUM_INDEXED_ARRAY(Limb, Limbs::Limb)& limbs)
 {
-  limbs[Limbs::neck] = SE3WithCov(Pose3f(0.f, 0.f, robotDimensions.hipToNeckLength)) *= SE3WithCov(RotationMatrix::aroundZ(joints.angles[Joints::headYaw]),
-                                                                                                   Vector3f(0.f, 0.f,
-                                                                                                            joints.variance[Joints::headYaw]).asDiagonal());
-  limbs[Limbs::head] = limbs[Limbs::neck] * SE3WithCov(RotationMatrix::aroundY(joints.angles[Joints::headPitch]),
-                                                       Vector3f(0.f, joints.variance[Joints::headPitch], 0.f).asDiagonal());
+  limbs[Limbs::neck] = Limb(Pose3f(0.f, 0.f, robotDimensions.hipToNeckLength)) *= joint<Limb>(RotationMatrix::aroundZ(joints.angles[Joints::headYaw]),
+                                                                                             Vector3f(0.f, 0.f, joints.variance[Joints::headYaw]));
+  limbs[Limbs::head] = limbs[Limbs::neck] * joint<Limb>(RotationMatrix::aroundY(joints.angles[Joints::headPitch]),
+                                                        Vector3f(0.f, joints.variance[Joints::headPitch], 0.f));
 }
+
+Vector3f ForwardKinematic::calculateCenterOfMass(const JointAngles& joints, const RobotDimensions& robotDimensions, const MassCalibration& massCalibration)
+{
+  ENUM_INDEXED_ARRAY(Pose3f, Limbs::Limb) limbs;
+  return calculateCenterOfMass(joints, robotDimensions, massCalibration, limbs);
+}
+
+Vector3f ForwardKinematic::calculateCenterOfMass(const JointAngles& joints, const RobotDimensions& robotDimensions, const MassCalibration& massCalibration,
+                                                 ENUM_INDEXED_ARRAY(Pose3f, Limbs::Limb)& limbs)
+{
+  calculateHeadChain(joints, robotDimensions, limbs);
+  calculateArmChain(Arms::left, joints, robotDimensions, limbs);
+  calculateArmChain(Arms::right, joints, robotDimensions, limbs);
+  calculateLegChain(Legs::left, joints, robotDimensions, limbs);
+  calculateLegChain(Legs::right, joints, robotDimensions, limbs);
+
+  Vector3f centerOfMass = Vector3f::Zero();
+  for(int i = 0; i < Limbs::numOfLimbs; i++)
+  {
+    const MassCalibration::MassInfo& limb = massCalibration.masses[i];
+    centerOfMass += (limbs[i] * limb.offset) * limb.mass;
+  }
+  return centerOfMass / massCalibration.totalMass;
+}
+
+template void ForwardKinematic::calculateArmChain<SE3WithCov>(Arms::Arm, const JointAngles&, const RobotDimensions&, ENUM_INDEXED_ARRAY(SE3WithCov, Limbs::Limb)&);
+template void ForwardKinematic::calculateArmChain<Pose3f>(Arms::Arm, const JointAngles&, const RobotDimensions&, ENUM_INDEXED_ARRAY(Pose3f, Limbs::Limb)&);
+template void ForwardKinematic::calculateLegChain<SE3WithCov>(Legs::Leg, const JointAngles&, const RobotDimensions&, ENUM_INDEXED_ARRAY(SE3WithCov, Limbs::Limb)&);
+template void ForwardKinematic::calculateLegChain<Pose3f>(Legs::Leg, const JointAngles&, const RobotDimensions&, ENUM_INDEXED_ARRAY(Pose3f, Limbs::Limb)&);
+template void ForwardKinematic::calculateHeadChain<SE3WithCov>(const JointAngles&, const RobotDimensions&, ENUM_INDEXED_ARRAY(SE3WithCov, Limbs::Limb)&);
+template void ForwardKinematic::calculateHeadChain<Pose3f>(const JointAngles&, const RobotDimensions&, ENUM_INDEXED_ARRAY(Pose3f, Limbs::Limb)&);
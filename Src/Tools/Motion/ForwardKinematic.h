@@ -9,16 +9,61 @@
 #include "Streaming/EnumIndexedArray.h"
 #include "RobotParts/Arms.h"
 #include "RobotParts/Limbs.h"
+#include "Math/Eigen.h"
 
 struct JointAngles;
+struct MassCalibration;
+struct Pose3f;
 struct SE3WithCov;
 struct RobotDimensions;
 
+/**
+ * The chains are available for limbs of type SE3WithCov, which propagate the joint
+ * variances, and for limbs of type Pose3f, which are much cheaper to compute if
+ * only the poses are of interest.
+ */
 namespace ForwardKinematic
 {
-  void calculateArmChain(Arms::Arm arm, const JointAngles& joints, const RobotDimensions& robotDimensions, ENUM_INDEXED_ARRAY(SE3WithCov, Limbs::Limb)& limbs);
+  template<typename Limb>
+  void calculateArmChain(Arms::Arm arm, const JointAngles& joints, const RobotDimensions& robotDimensions, ENUM_INDEXED_ARRAY(Limb, Limbs::Limb)& limbs);
+
+  template<typename Limb>
+  void calculateLegChain(Legs::Leg leg, const JointAngles& joints, const RobotDimensions& robotDimensions, ENUM_INDEXED_ARRAY(Limb, Limbs::Limb)& limbs);
+
+  /**
+   * Calculates the pose of a sole relative to the torso without propagating the
+   * joint variances. This is much cheaper than calculating the whole leg chain
+   * if only the pose of the sole is of interest.
+   * @param leg The leg of which the sole pose is calculated.
+   * @param joints The joint angles.
+   * @param robotDimensions The dimensions of the robot.
+   * @param tibia If not \c nullptr, the pose of the tibia is also returned here.
+   * @return The pose of the sole.
+   */
+  Pose3f calculateSole(Legs::Leg leg, const JointAngles& joints, const RobotDimensions& robotDimensions, Pose3f* tibia = nullptr);
+
+  template<typename Limb>
+  void calculateHeadChain(const JointAngles& joints, const RobotDimensions& robotDimensions, ENUM_INDEXED_ARRAY(Limb, Limbs::Limb)& limbs);
 
-  void calculateLegChain(Legs::Leg leg, const JointAngles& joints, const RobotDimensions& robotDimensions, ENUM_INDEXED_ARRAY(SE3WithCov, Limbs::Limb)& limbs);
+  /**
+   * Calculates the center of mass relative to the torso without propagating the
+   * joint variances.
+   * @param joints The joint angles.
+   * @param robotDimensions The dimensions of the robot.
+   * @param massCalibration The mass calibration of the robot.
+   * @return The position of the center of mass.
+   */
+  Vector3f calculateCenterOfMass(const JointAngles& joints, const RobotDimensions& robotDimensions, const MassCalibration& massCalibration);
 
-  void calculateHeadChain(const JointAngles& joints, const RobotDimensions& robotDimensions, ENUM_INDEXED_ARRAY(SE3WithCov, Limbs::Limb)& limbs);
+  /**
+   * Calculates the center of mass relative to the torso without propagating the
+   * joint variances. The poses of all limbs are calculated anyway and returned.
+   * @param joints The joint angles.
+   * @param robotDimensions The dimensions of the robot.
+   * @param massCalibration The mass calibration of the robot.
+   * @param limbs The poses of all limbs relative to the torso are returned here.
+   * @return The position of the center of mass.
+   */
+  Vector3f calculateCenterOfMass(const JointAngles& joints, const RobotDimensions& robotDimensions, const MassCalibration& massCalibration,
+                                 ENUM_INDEXED_ARRAY(Pose3f, Limbs::Limb)& limbs);
 };
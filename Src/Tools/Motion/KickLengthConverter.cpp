@@ -1,5 +1,5 @@
 /**
- * @file KickLengthConverter.h
+ * @file KickLengthConverter.cpp
  * This file contains functions to convert the kick length into the kick power
  *
  * @author Philip Reichenberg
@@ -8,50 +8,37 @@
 
 namespace KickLengthConverter
 {
-  std::vector<KickLengthPair> getKickLengthPassPairList()
+  /**
+   * Interpolates the kick power for a kick length in a piecewise linear way.
+   * @param pairs The interpolation information.
+   * @param range The range of the kick lengths of the kick.
+   * @param length The requested length.
+   * @return The resulting kick power.
+   */
+  template<std::size_t n>
+  static float interpolatePower(const std::array<KickLengthPair, n>& pairs, const Rangef& range, const float length)
   {
-    return { { 0.f, 0.15f }, { 0.08f, 0.15f }, { 0.6f, 0.25f }, { 0.95f, 0.8f }, { 1.f, 1.f } };
-  }
-
-  std::vector<KickLengthPair> getKickLengthPairList()
-  {
-    return { { 0.f, 0.2f }, { 0.5f, 0.5f }, { 1.f, 1.f } };
+    const float useLength = range.limit(length);
+    const float lengthWidth = range.getSize();
+    for(std::size_t index = 1; index < n; index++)
+    {
+      if(lengthWidth * pairs[index].rangeIncrease + range.min > useLength)
+      {
+        const float minIndexLength = lengthWidth * pairs[index - 1].rangeIncrease + range.min;
+        const float maxIndexLength = lengthWidth * pairs[index].rangeIncrease + range.min;
+        const float ratio = (useLength - minIndexLength) / (maxIndexLength - minIndexLength);
+        return pairs[index - 1].powerIncrease * (1.f - ratio) + pairs[index].powerIncrease * ratio;
+      }
+    }
+    return 1.f;
   }
 
   float kickLengthToPower(const KickInfo::KickType kickType, const float length, const Angle direction, const KickInfo& theKickInfo)
   {
     if(kickType == KickInfo::forwardFastRight || kickType == KickInfo::forwardFastLeft)
-    {
-      const float useLength = theKickInfo[kickType].range.limit(length);
-      const float lengthWidth = theKickInfo[kickType].range.getSize();
-      for(std::size_t index = 1; index < kickLengthPair.size(); index++)
-      {
-        if(lengthWidth * kickLengthPair[index].rangeIncrease + theKickInfo[kickType].range.min > useLength)
-        {
-          const float minIndexLength = lengthWidth * kickLengthPair[index - 1].rangeIncrease + theKickInfo[kickType].range.min;
-          const float maxIndexLength = lengthWidth * kickLengthPair[index].rangeIncrease + theKickInfo[kickType].range.min;
-          const float ratio = (useLength - minIndexLength) / (maxIndexLength - minIndexLength);
-          return kickLengthPair[index - 1].powerIncrease * (1.f - ratio) + kickLengthPair[index].powerIncrease * ratio;
-        }
-      }
-      return 1.f;
-    }
+      return interpolatePower(kickLengthPair, theKickInfo[kickType].range, length);
     if(kickType == KickInfo::forwardFastRightPass || kickType == KickInfo::forwardFastLeftPass)
-    {
-      const float useLength = theKickInfo[kickType].range.limit(length);
-      const float lengthWidth = theKickInfo[kickType].range.getSize();
-      for(std::size_t index = 1; index < kickLengthPassPair.size(); index++)
-      {
-        if(lengthWidth * kickLengthPassPair[index].rangeIncrease + theKickInfo[kickType].range.min > useLength)
-        {
-          const float minIndexLength = lengthWidth * kickLengthPassPair[index - 1].rangeIncrease + theKickInfo[kickType].range.min;
-          const float maxIndexLength = lengthWidth * kickLengthPassPair[index].rangeIncrease + theKickInfo[kickType].range.min;
-          const float ratio = (useLength - minIndexLength) / (maxIndexLength - minIndexLength);
-          return kickLengthPassPair[index - 1].powerIncrease * (1.f - ratio) + kickLengthPassPair[index].powerIncrease * ratio;
-        }
-      }
-      return 1.f;
-    }
+      return interpolatePower(kickLengthPassPair, theKickInfo[kickType].range, length);
     else
     {
       Rangef useKickRange = theKickInfo[kickType].range;
@@ -4,34 +4,28 @@
  *
  * @author Philip Reichenberg
  */
+#pragma once
+
 #include "Representations/Configuration/KickInfo.h"
+#include <array>
 
 namespace KickLengthConverter
 {
   struct KickLengthPair
   {
-    const float rangeIncrease; /**< The % range relative to the max range. */
-    const float powerIncrease; /**< The power value. */
+    float rangeIncrease; /**< The % range relative to the max range. */
+    float powerIncrease; /**< The power value. */
   };
 
   /**
-   * Interpolation information for kicks
-   */
-  std::vector<KickLengthPair> getKickLengthPairList();
-  /**
-   * Interpolation information for kicks
-   */
-  std::vector<KickLengthPair> getKickLengthPassPairList();
-
-  /**
-   * Interpolation information for kicks
+   * Interpolation information for passes
    */
-  const std::vector<KickLengthPair> kickLengthPassPair = getKickLengthPassPairList();
+  constexpr std::array<KickLengthPair, 5> kickLengthPassPair = {{{0.f, 0.15f}, {0.08f, 0.15f}, {0.6f, 0.25f}, {0.95f, 0.8f}, {1.f, 1.f}}};
 
   /**
    * Interpolation information for kicks
    */
-  const std::vector<KickLengthPair> kickLengthPair = getKickLengthPairList();
+  constexpr std::array<KickLengthPair, 3> kickLengthPair = {{{0.f, 0.2f}, {0.5f, 0.5f}, {1.f, 1.f}}};
 
   /**
    * Converts a kick length (in mm) to a kick power (in [0, 1]). Maybe this should be done in motion instead.
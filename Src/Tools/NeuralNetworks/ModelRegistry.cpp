@@ -0,0 +1,52 @@
+/**
+ * @file ModelRegistry.cpp
+ *
+ * This file implements a process-wide registry of neural network models.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "ModelRegistry.h"
+#include "Framework/StartupTrace.h"
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * Returns a model of a certain type from the registry of that type.
+ * @tparam Model The type of the model.
+ * @param filename The path to the model file.
+ * @param uint8Inputs The indices of the inputs that are encoded as unsigned chars.
+ * @return The model.
+ */
+template<typename Model> static std::shared_ptr<const Model> getModel(const std::string& filename, std::initializer_list<std::size_t> uint8Inputs)
+{
+  static std::mutex mutex;
+  static std::unordered_map<std::string, std::weak_ptr<const Model>> models;
+
+  // The same file with different input encodings results in different models.
+  std::string key = filename;
+  for(std::size_t index : uint8Inputs)
+    key += ":" + std::to_string(index);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  std::shared_ptr<const Model> model = models[key].lock();
+  if(!model)
+  {
+    StartupTrace::Step step("model", filename.c_str());
+    std::shared_ptr<Model> newModel = std::make_shared<Model>(filename);
+    for(std::size_t index : uint8Inputs)
+      newModel->setInputUInt8(index);
+    models[key] = model = newModel;
+  }
+  return model;
+}
+
+std::shared_ptr<const NeuralNetwork::Model> ModelRegistry::get(const std::string& filename, std::initializer_list<std::size_t> uint8Inputs)
+{
+  return getModel<NeuralNetwork::Model>(filename, uint8Inputs);
+}
+
+std::shared_ptr<const NeuralNetworkONNX::Model> ModelRegistry::getONNX(const std::string& filename, std::initializer_list<std::size_t> uint8Inputs)
+{
+  return getModel<NeuralNetworkONNX::Model>(filename, uint8Inputs);
+}
@@ -0,0 +1,42 @@
+/**
+ * @file ModelRegistry.h
+ *
+ * This file declares a process-wide registry of neural network models. It
+ * allows the instances of a module in different threads and, in the
+ * simulator, in different robots to share a model instead of loading it from
+ * its file again. The compiled networks cannot be shared, because each of
+ * them owns its input and output tensors.
+ *
+ * @author Thomas Röfer
+ */
+
+#pragma once
+
+#include <CompiledNN/Model.h>
+#include <CompiledNN2ONNX/Model.h>
+#include <initializer_list>
+#include <memory>
+#include <string>
+
+namespace ModelRegistry
+{
+  /**
+   * Returns a model, loading it only if it is not already used elsewhere.
+   * Models are not changed after they were loaded, so they can be used
+   * concurrently, e.g. to compile networks in several threads. A model is
+   * freed when its last user releases it.
+   * @param filename The path to the model file.
+   * @param uint8Inputs The indices of the inputs that are encoded as unsigned chars.
+   * @return The model.
+   */
+  std::shared_ptr<const NeuralNetwork::Model> get(const std::string& filename, std::initializer_list<std::size_t> uint8Inputs = {});
+
+  /**
+   * Returns an ONNX model, loading it only if it is not already used elsewhere.
+   * The same rules as for \c get apply.
+   * @param filename The path to the model file.
+   * @param uint8Inputs The indices of the inputs that are encoded as unsigned chars.
+   * @return The model.
+   */
+  std::shared_ptr<const NeuralNetworkONNX::Model> getONNX(const std::string& filename, std::initializer_list<std::size_t> uint8Inputs = {});
+}
@@ -8,6 +8,13 @@
 
 #include <algorithm>
 #include <span>
+#ifdef TARGET_ROBOT
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#endif
 #include <asmjit/asmjit.h>
 #include <onnxruntime_cxx_api.h>
 #ifdef MACOS
@@ -49,6 +56,7 @@ namespace NeuralNetworkONNX
     std::vector<Ort::Value> inputTensors; /**< The pre-allocated tensors for each input. */
     std::vector<Ort::Value> outputTensors; /**< The pre-allocated tensors for each output. */
     std::vector<unsigned char*> uint8Buffers; /**< For each input that is encoded as unsigned chars, a buffer of the required size is provided. Otherwise, the entry is nullptr. */
+    std::vector<const void*> externalInputs; /**< For each input, the external buffer it is read from or nullptr if the internal buffer is used. */
 
     /**
      * Helper method to create a single ONNX environment that hosts the global
@@ -63,6 +71,31 @@ namespace NeuralNetworkONNX
       return environment;
     }
 
+#ifdef TARGET_ROBOT
+    /**
+     * Returns the path of the optimized version of a model in the cache on the
+     * robot. It depends on the contents of the model file and the version of
+     * ONNX runtime, so that a changed model is never confused with an old one.
+     * The cache survives restarts of bhumand, which can then skip the graph
+     * optimization.
+     * @param filename The path to the .onnx file.
+     * @return The path to the optimized model. Empty if the model cannot be read.
+     */
+    static std::string cachedFilename(const std::string& filename)
+    {
+      std::ifstream stream(filename, std::ios::binary);
+      if(!stream)
+        return "";
+      std::uint64_t hash = 14695981039346656037ull; // FNV-1a
+      for(std::istreambuf_iterator<char> i(stream), end; i != end; ++i)
+        hash = (hash ^ static_cast<unsigned char>(*i)) * 1099511628211ull;
+      char key[17];
+      std::snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(hash));
+      return "/home/nao/.cache/bhuman/" + std::filesystem::path(filename).stem().string()
+             + "-" + std::to_string(ORT_API_VERSION) + "-" + key + ".onnx";
+    }
+#endif
+
     /** Clear all buffers. */
     void clear()
     {
@@ -78,6 +111,7 @@ namespace NeuralNetworkONNX
       inputSizes.clear();
       inputTensors.clear();
       uint8Buffers.clear();
+      externalInputs.clear();
       outputNames.clear();
       outputDims.clear();
       outputSizes.clear();
@@ -190,7 +224,29 @@ namespace NeuralNetworkONNX
       std::copy(model.filename.begin(), model.filename.end(), filename.begin());
       session = Ort::Session(*env, filename.c_str(), sessionOptions);
 #elif defined TARGET_ROBOT
-      session = Ort::Session(*env, model.filename.c_str(), sessionOptions);
+      // Load the optimized model from the cache if it exists. Otherwise, ONNX
+      // runtime writes it to the cache. A temporary name is used, so that an
+      // interrupted write never leaves a corrupt model in the cache.
+      const std::string cached = cachedFilename(model.filename);
+      std::error_code error;
+      if(!cached.empty() && std::filesystem::exists(cached, error))
+      {
+        sessionOptions.SetGraphOptimizationLevel(ORT_DISABLE_ALL);
+        session = Ort::Session(*env, cached.c_str(), sessionOptions);
+      }
+      else
+      {
+        const std::string temp = cached + ".tmp";
+        if(!cached.empty())
+        {
+          std::filesystem::create_directories(std::filesystem::path(cached).parent_path(), error);
+          if(!error)
+            sessionOptions.SetOptimizedModelFilePath(temp.c_str());
+        }
+        session = Ort::Session(*env, model.filename.c_str(), sessionOptions);
+        if(!cached.empty())
+          std::filesystem::rename(temp, cached, error);
+      }
 #else
       session = Ort::Session(environment(), model.filename.c_str(), sessionOptions);
 #endif
@@ -208,6 +264,7 @@ namespace NeuralNetworkONNX
         inputSizes.emplace_back(size);
         inputTensors.emplace_back(Ort::Value::CreateTensor<float>(allocator, inputDims.back().data(), inputDims.back().size()));
         uint8Buffers.emplace_back(model.isUint8.find(i) != model.isUint8.end() ? new unsigned char[size] : nullptr);
+        externalInputs.emplace_back(nullptr);
       }
 
       // Create the names, tensors, dimensions, and sizes for all outputs.
@@ -235,7 +292,8 @@ namespace NeuralNetworkONNX
         if(uint8Buffers[i])
         {
           float* pDest = inputTensors[i].GetTensorMutableData<float>();
-          for(unsigned char* pSrc = uint8Buffers[i], * pEnd = pSrc + inputSizes[i]; pSrc < pEnd;)
+          const unsigned char* pSrc = externalInputs[i] ? static_cast<const unsigned char*>(externalInputs[i]) : uint8Buffers[i];
+          for(const unsigned char* pEnd = pSrc + inputSizes[i]; pSrc < pEnd;)
             *pDest++ = *pSrc++;
         }
 
@@ -271,11 +329,38 @@ namespace NeuralNetworkONNX
     Tensor input(size_t index)
     {
       if(uint8Buffers[index])
-        return Tensor(reinterpret_cast<float*>(uint8Buffers[index]), inputSizes[index], inputDims[index]);
+        return Tensor(reinterpret_cast<float*>(externalInputs[index] ? const_cast<void*>(externalInputs[index]) : uint8Buffers[index]),
+                      inputSizes[index], inputDims[index]);
       else
         return Tensor(inputTensors[index].GetTensorMutableData<float>(), inputSizes[index], inputDims[index]);
     }
 
+    /**
+     * Binds an external buffer to an input, so that the network reads it
+     * directly instead of requiring a copy into the input tensor. The buffer
+     * must contain as many values as the input has and must stay valid until
+     * the input is bound to something else. Its values are unsigned chars if
+     * the input was declared to be encoded that way and floats otherwise.
+     * While bound, \c input returns a tensor that refers to the buffer.
+     * @param index The index of the input.
+     * @param data The external buffer or nullptr to use the internal buffer again.
+     */
+    void setInput(size_t index, const void* data)
+    {
+      if(data == externalInputs[index])
+        return;
+      externalInputs[index] = data;
+      if(!uint8Buffers[index])
+      {
+        if(data)
+          inputTensors[index] = Ort::Value::CreateTensor<float>(Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault),
+                                                                static_cast<float*>(const_cast<void*>(data)), inputSizes[index],
+                                                                inputDims[index].data(), inputDims[index].size());
+        else
+          inputTensors[index] = Ort::Value::CreateTensor<float>(allocator, inputDims[index].data(), inputDims[index].size());
+      }
+    }
+
     /**
      * Returns the output tensor.
      * @return The output tensor.
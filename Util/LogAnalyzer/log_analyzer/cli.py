@@ -13,18 +13,20 @@ import pybh.logs as bhlogs
 from rich.console import Console
 from rich.progress import track
 
-from .statistics.annotation import Annotation
 from .statistics.behavior_oscillation import BehaviorOscillation
-from .statistics.motion_oscillation import MotionOscillation
-from .statistics.target_oscillation import TargetOscillation
+from .statistics.native import Annotation, MotionOscillation, NativeStatistic, TargetOscillation
 from .statistics.walking_oscillation import WalkingOscillation
 
 if TYPE_CHECKING:
     from .statistics.statistic import Statistic
 
+# Statistics that cannot be computed natively, because they observe strings.
 stat_classes: list[type[Statistic]] = [
-    Annotation,
     BehaviorOscillation,
+]
+
+native_stat_classes: list[type[NativeStatistic]] = [
+    Annotation,
     TargetOscillation,
 ]
 
@@ -41,6 +43,57 @@ def prepare_paths(path: Path, exclude_invisibles: bool = True) -> list[Path]:
     return [log_path for log_path in path.rglob("*.log") if matcher.match(str(log_path.name))]
 
 
+def relative_path(log_path: Path, path: Path) -> Path | str:
+    try:
+        return log_path.relative_to(path) if log_path != path else log_path.name
+    except ValueError:
+        msg = f"Log path {log_path} is not a subpath of {path}. This should not happen."
+        raise ValueError(msg) from None
+
+
+def analyze(
+    logs: list[Path], stats: list[NativeStatistic], n_threads: int
+) -> list[bhlogs.AnalysisResult]:
+    """Computes native statistics for all logs in a single pass per log.
+
+    Args:
+        logs (list[Path]): The logs to analyze.
+        stats (list[NativeStatistic]): The statistics to compute.
+        n_threads (int): The number of logs analyzed in parallel. 0 uses all available CPUs.
+    """
+    analyzer = bhlogs.Analyzer()
+    for stat in stats:
+        stat.configure(analyzer)
+    return analyzer.run([str(log_path) for log_path in logs], num_threads=n_threads)
+
+
+def print_native(
+    path: Path, logs: list[Path], stat: NativeStatistic, quiet: bool, n_threads: int, unit: str = ""
+) -> None:
+    """Prints the hits of a native statistic for each log."""
+    console = Console()
+    for log_path, result in zip(logs, analyze(logs, [stat], n_threads)):
+        rel_path = relative_path(log_path, path)
+        if result.error:
+            console.print(f"{rel_path}: could not parse.")
+            continue
+        rule = result.rules[stat.name]
+        if not quiet:
+            stat.print(console, rule)
+        console.print(f"{rel_path}: {rule.hits}{unit}")
+
+
+n_threads_option = click.option(
+    "-n",
+    "--n-threads",
+    "n_threads",
+    type=click.IntRange(min=0),
+    default=1,
+    show_default=True,
+    help="Number of logs analyzed in parallel. Set to 0 to use all available CPUs.",
+)
+
+
 @click.group()
 def cli() -> None:
     """Analyze logs in the B-Human format.
@@ -111,7 +164,7 @@ def report(path: Path, include_invisibles: bool, n_processes: int) -> None:
 
     The number of processes to use can be adjusted with the `--n-processes` parameter. Set it to 0
     to use all available CPUs. To avoid overloading the system of an unsuspecting user, the
-    default has been set to 1.
+    default has been set to 1. The statistics computed natively use the same number of threads.
 
     The `--include-invisibles` flag can be used to include logs against the Invisibles team (a.k.a.
     a testgame).
@@ -122,8 +175,22 @@ def report(path: Path, include_invisibles: bool, n_processes: int) -> None:
     if n_processes < 1:
         n_processes = mp.cpu_count()
 
+    native_stats = [stat_class() for stat_class in native_stat_classes]
+    native_results = analyze(logs, native_stats, n_processes)
+
     with ProcessPoolExecutor(max_workers=n_processes) as executor:
-        for log_path, stats in executor.map(report_worker, logs):
+        for (log_path, stats), native_result in zip(
+            executor.map(report_worker, logs), native_results
+        ):
+            if not native_result.error and len(stats) > 0:
+                for stat in native_stats:
+                    rule = native_result.rules[stat.name]
+                    console = Console(file=StringIO(), record=True)
+                    stat.print(console, rule)
+                    save_html(console, log_path, stat.name, rule.hits)
+                    stats[stat.name] = rule.hits
+            else:
+                stats = {}
             cli_console.rule(str(log_path.relative_to(path)))
             if len(stats) > 0:
                 for name, hits in stats.items():
@@ -152,15 +219,17 @@ def report_worker(log_path: Path) -> tuple[Path, dict[str, int]]:
             for stat in stats:
                 stat.update(frame=frame, frame_idx=frame_idx)
         for stat in stats:
-            save_path = log_path.with_suffix(".html").with_stem(
-                log_path.stem + "-" + stat.__class__.__name__ + "-" + str(stat.hits)
-            )
-            stat.console.save_html(str(save_path))
+            save_html(stat.console, log_path, stat.__class__.__name__, stat.hits)
         return log_path, {stat.__class__.__name__: stat.hits for stat in stats}
     except RuntimeError:
         return log_path, {}
 
 
+def save_html(console: Console, log_path: Path, name: str, hits: int) -> None:
+    save_path = log_path.with_suffix(".html").with_stem(log_path.stem + "-" + name + "-" + str(hits))
+    console.save_html(str(save_path))
+
+
 @cli.command(hidden=True)
 @click.argument(
     "path",
@@ -204,12 +273,14 @@ def report_worker(log_path: Path) -> tuple[Path, dict[str, int]]:
     show_default=True,
     help="Threshold in frames to group hits together.",
 )
-def motion(
+@n_threads_option
+def motion(  # noqa: PLR0913
     path: Path,
     threshold: int,
     grouping_threshold: int,
     quiet: bool,
     include_invisibles: bool,
+    n_threads: int,
 ) -> None:
     """Print potential oscillations in motion status.
 
@@ -223,29 +294,12 @@ def motion(
     As a visual aid to identify oscillations in close proximity to each other, ellipses (...) are
     printed between hits that are separated by a certain number frames. This may be adjusted with
     the `--grouping-threshold` parameter.
+
+    The number of logs analyzed in parallel can be adjusted with the `--n-threads` parameter.
     """
-    console = Console()
     logs = prepare_paths(path, exclude_invisibles=not include_invisibles)
-
-    for log_path in logs:
-        log = bhlogs.Log(str(log_path))
-        stats = MotionOscillation(
-            console=console,
-            threshold=threshold,
-            grouping_threshold=grouping_threshold,
-            quiet=quiet,
-        )
-        try:
-            rel_path = log_path.relative_to(path) if log_path != path else log_path.name
-        except ValueError:
-            msg = f"Log path {log_path} is not a subpath of {path}. This should not happen."
-            raise ValueError(msg) from None
-        try:
-            for frame_idx, frame in enumerate(track(log, transient=True, console=console)):
-                stats.update(frame=frame, frame_idx=frame_idx)
-            console.print(f"{rel_path}: {stats.hits} hits")
-        except RuntimeError:
-            console.print(f"{rel_path}: could not parse.")
+    stat = MotionOscillation(threshold=threshold, grouping_threshold=grouping_threshold)
+    print_native(path, logs, stat, quiet, n_threads, unit=" hits")
 
 
 @cli.command()
@@ -482,6 +536,7 @@ def walking(
     show_default=True,
     help="Threshold in frames to group hits together.",
 )
+@n_threads_option
 def target(  # noqa: PLR0913
     path: Path,
     buffer_size: int,
@@ -489,6 +544,7 @@ def target(  # noqa: PLR0913
     grouping_threshold: int,
     quiet: bool,
     include_invisibles: bool,
+    n_threads: int,
 ) -> None:
     """Print potential oscillations in ball target vectors.
 
@@ -506,32 +562,16 @@ def target(  # noqa: PLR0913
     As a visual aid to identify oscillations in close proximity to each other, ellipses (...) are
     printed between hits that are separated by a certain number frames. This may be adjusted with
     the `--grouping-threshold` parameter.
+
+    The number of logs analyzed in parallel can be adjusted with the `--n-threads` parameter.
     """
-    console = Console()
     logs = prepare_paths(path, exclude_invisibles=not include_invisibles)
-
-    rad_threshold = np.deg2rad(threshold)
-
-    for log_path in logs:
-        log = bhlogs.Log(str(log_path))
-        stats = TargetOscillation(
-            buffer_length=buffer_size,
-            threshold=rad_threshold,
-            grouping_threshold=grouping_threshold,
-            console=console,
-            quiet=quiet,
-        )
-        try:
-            rel_path = log_path.relative_to(path) if log_path != path else log_path.name
-        except ValueError:
-            msg = f"Log path {log_path} is not a subpath of {path}. This should not happen."
-            raise ValueError(msg) from None
-        try:
-            for frame_idx, frame in enumerate(track(log, transient=True, console=console)):
-                stats.update(frame=frame, frame_idx=frame_idx)
-            console.print(f"{rel_path}: {stats.hits}")
-        except RuntimeError:
-            console.print(f"{rel_path}: could not parse.")
+    stat = TargetOscillation(
+        buffer_length=buffer_size,
+        threshold=np.deg2rad(threshold),
+        grouping_threshold=grouping_threshold,
+    )
+    print_native(path, logs, stat, quiet, n_threads)
 
 
 @cli.command()
@@ -558,10 +598,21 @@ def target(  # noqa: PLR0913
     show_default=True,
     help="Include matching logs against the Invisibles team (a.k.a. a testgame).",
 )
+@click.option(
+    "-p",
+    "--pattern",
+    "pattern",
+    type=str,
+    default="",
+    help="Only print annotations whose name or description contain this regular expression.",
+)
+@n_threads_option
 def annotation(
     path: Path,
     quiet: bool,
     include_invisibles: bool,
+    pattern: str,
+    n_threads: int,
 ) -> None:
     """Print annotations from logs.
 
@@ -572,23 +623,10 @@ def annotation(
     want to investigate further.
 
     This may also be combined with other CLI-Tools such as `grep` to prepare canary-like reports for
-    quick identification of issues.
-    """
-    console = Console()
+    quick identification of issues. The annotations can also be filtered natively with the
+    `--pattern` parameter.
 
+    The number of logs analyzed in parallel can be adjusted with the `--n-threads` parameter.
+    """
     logs = prepare_paths(path, exclude_invisibles=not include_invisibles)
-    for log_path in logs:
-        log = bhlogs.Log(str(log_path))
-
-        stats = Annotation(console=console, quiet=quiet)
-        try:
-            rel_path = log_path.relative_to(path) if log_path != path else log_path.name
-        except ValueError:
-            msg = f"Log path {log_path} is not a subpath of {path}. This should not happen."
-            raise ValueError(msg) from None
-        try:
-            for frame_idx, frame in enumerate(track(log, transient=True, console=console)):
-                stats.update(frame=frame, frame_idx=frame_idx)
-            console.print(f"{rel_path}: {stats.hits}")
-        except RuntimeError:
-            console.print(f"{rel_path}: could not parse.")
+    print_native(path, logs, Annotation(pattern=pattern), quiet, n_threads)
@@ -10,7 +10,7 @@ if TYPE_CHECKING:
 
 
 class _Node:
-    def __init__(self, node: bhlogs.Record) -> None:
+    def __init__(self, node: bhlogs.LazyRecord) -> None:
         self.option: str = node.option  # pyright: ignore[reportAttributeAccessIssue]
         self.depth: int = node.depth  # pyright: ignore[reportAttributeAccessIssue]
         # self.state: str = node.state
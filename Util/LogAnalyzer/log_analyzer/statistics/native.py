@@ -0,0 +1,98 @@
+from __future__ import annotations
+
+from typing import TYPE_CHECKING
+
+import numpy as np
+
+from .util.motion import Motion
+
+if TYPE_CHECKING:
+    import pybh.logs as bhlogs
+    from rich.console import Console
+
+
+class NativeStatistic:
+    """A statistic that is computed by the native analyzer of pybh.
+
+    The statistic only configures a rule of a `pybh.logs.Analyzer` and formats its results. This
+    allows to analyze all logs in a single pass per log and in parallel.
+    """
+
+    def __init__(self, *, grouping_threshold: int) -> None:
+        self.name = self.__class__.__name__
+        self._grouping_threshold = grouping_threshold
+
+    def configure(self, analyzer: bhlogs.Analyzer) -> None:
+        raise NotImplementedError
+
+    def format(self, event: bhlogs.AnalysisEvent) -> str:
+        raise NotImplementedError
+
+    def distance(self, event: bhlogs.AnalysisEvent) -> int:
+        """Returns the position of an event that is used to group hits."""
+        return event.update
+
+    def print(self, console: Console, result: bhlogs.RuleResult) -> None:
+        """Prints all hits. Ellipses (...) separate hits that are far apart."""
+        last: int | None = None
+        for event in result.events:
+            if last is not None and self.distance(event) - last > self._grouping_threshold:
+                console.print("...")
+            console.print(self.format(event))
+            last = self.distance(event)
+
+
+class Annotation(NativeStatistic):
+    def __init__(self, pattern: str = "", *, grouping_threshold: int = 60 * 3) -> None:
+        super().__init__(grouping_threshold=grouping_threshold)
+        self._pattern = pattern
+
+    def configure(self, analyzer: bhlogs.Analyzer) -> None:
+        analyzer.add_annotation_filter(self.name, pattern=self._pattern)
+
+    def format(self, event: bhlogs.AnalysisEvent) -> str:
+        return f"(frame {event.frame:07} thread {event.thread:9}): {event.text}"
+
+    def distance(self, event: bhlogs.AnalysisEvent) -> int:
+        return event.frame
+
+
+class MotionOscillation(NativeStatistic):
+    def __init__(self, threshold: int = 10, *, grouping_threshold: int = 60 * 3) -> None:
+        super().__init__(grouping_threshold=grouping_threshold)
+        self._threshold = threshold
+
+    def configure(self, analyzer: bhlogs.Analyzer) -> None:
+        analyzer.add_change_oscillation(
+            self.name, "Cognition", "MotionRequest.motion", threshold=self._threshold
+        )
+
+    def format(self, event: bhlogs.AnalysisEvent) -> str:
+        return f"(frame {event.frame}): motion {Motion(int(event.previous)).name} -> {Motion(int(event.value)).name}"
+
+
+class TargetOscillation(NativeStatistic):
+    def __init__(
+        self,
+        buffer_length: int = 60,
+        threshold: float = np.deg2rad(10),
+        *,
+        grouping_threshold: int = 60,
+    ) -> None:
+        super().__init__(grouping_threshold=grouping_threshold)
+        self._buffer_length = buffer_length
+        self._threshold = threshold
+
+    def configure(self, analyzer: bhlogs.Analyzer) -> None:
+        analyzer.add_angle_oscillation(
+            self.name,
+            "Cognition",
+            ["MotionRequest.targetDirection", "RobotPose.rotation"],
+            window=self._buffer_length,
+            threshold=self._threshold,
+            condition="MotionRequest.motion",
+            condition_value=Motion.WALK_TO_BALL_AND_KICK.value,
+        )
+
+    def format(self, event: bhlogs.AnalysisEvent) -> str:
+        return f"(frame {event.frame}, cognition frame {event.update}): {np.rad2deg(event.value):.3f}° mean absolute angular difference over {self._buffer_length} frames"